@@ -0,0 +1,209 @@
+/*
+  ==============================================================================
+
+    This file contains the entry point for the headless batch renderer.
+
+    It runs CompressorAudioProcessor over audio files (or folders of them)
+    with settings loaded from a state file saved by getStateInformation().
+    Build it as a console application that compiles the plugin's Source
+    files alongside this one, with the same JucePlugin_* definitions as the
+    plugin target.
+
+    Usage:
+        BatchRender --preset <file> --output <folder> [--threads <n>]
+                    [--block <samples>] [--oversampling] <files or folders...>
+
+    Every file is rendered by a fresh prepareToPlay() on a processor owned by
+    one worker thread, so the output does not depend on how files are
+    scheduled: any thread count is bit-identical to --threads 1.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <iostream>
+#include "../../Source/PluginProcessor.h"
+
+//==============================================================================
+struct RenderSettings
+{
+    MemoryBlock preset;
+    File outputFolder;
+    int blockSize = 512;
+    bool oversampling = false;
+};
+
+//==============================================================================
+/** Owns one processor and renders files claimed from a shared queue until it runs dry. */
+class RenderThread  : public Thread
+{
+public:
+    RenderThread (const RenderSettings& s, const Array<File>& f, std::atomic<int>& next, int index)
+        : Thread ("Render " + String (index)), settings (s), files (f), nextFile (next)
+    {
+        formatManager.registerBasicFormats();
+    }
+
+    void run() override
+    {
+        CompressorAudioProcessor processor;
+        processor.setNonRealtime (true);
+        processor.setFilteringEnbaled (settings.oversampling);
+        processor.setStateInformation (settings.preset.getData(), static_cast<int> (settings.preset.getSize()));
+
+        for (int index = nextFile++; index < files.size() && ! threadShouldExit(); index = nextFile++)
+        {
+            if (renderFile (processor, files.getReference (index)))
+                ++numFilesRendered;
+            else
+                ++numFilesFailed;
+        }
+    }
+
+    double secondsOfAudio = 0.0;
+    int numFilesRendered = 0, numFilesFailed = 0;
+
+private:
+    bool renderFile (CompressorAudioProcessor& processor, const File& input)
+    {
+        std::unique_ptr<AudioFormatReader> reader (formatManager.createReaderFor (input));
+
+        if (reader == nullptr)
+            return false;
+
+        const auto numChannels = static_cast<int> (reader->numChannels);
+        const auto sampleRate = reader->sampleRate;
+
+        if (numChannels < 1 || numChannels > CompressorAudioProcessor::maxChannels)
+            return false;
+
+        auto* format = formatManager.findFormatForFileExtension (input.getFileExtension());
+        auto output = settings.outputFolder.getChildFile (input.getFileName());
+        output.deleteFile();
+
+        std::unique_ptr<OutputStream> stream (output.createOutputStream());
+
+        if (format == nullptr || stream == nullptr)
+            return false;
+
+        std::unique_ptr<AudioFormatWriter> writer (format->createWriterFor (stream.get(), sampleRate, static_cast<unsigned int> (numChannels),
+                                                                             static_cast<int> (reader->bitsPerSample), reader->metadataValues, 0));
+
+        if (writer == nullptr)
+            return false;
+
+        stream.release();
+
+        processor.setPlayConfigDetails (numChannels, numChannels, sampleRate, settings.blockSize);
+        processor.prepareToPlay (sampleRate, settings.blockSize);
+
+        // Drop the plugin's latency from the front and flush the same amount of tail through at the end
+        const auto latency = static_cast<int64> (processor.getLatencySamples());
+        const auto totalLength = reader->lengthInSamples;
+
+        AudioBuffer<float> buffer (numChannels, settings.blockSize);
+        MidiBuffer midi;
+
+        for (int64 position = 0; position < totalLength + latency; position += settings.blockSize)
+        {
+            const auto numSamples = static_cast<int> (jmin (static_cast<int64> (settings.blockSize), totalLength + latency - position));
+
+            buffer.clear();
+            reader->read (&buffer, 0, numSamples, position, true, true);
+
+            processor.processBlock (buffer, midi);
+
+            const auto skip = static_cast<int> (jlimit (static_cast<int64> (0), static_cast<int64> (numSamples), latency - position));
+
+            if (skip < numSamples && ! writer->writeFromAudioSampleBuffer (buffer, skip, numSamples - skip))
+                return false;
+        }
+
+        processor.releaseResources();
+        secondsOfAudio += static_cast<double> (totalLength) / sampleRate;
+        return true;
+    }
+
+    const RenderSettings& settings;
+    const Array<File>& files;
+    std::atomic<int>& nextFile;
+    AudioFormatManager formatManager;
+};
+
+//==============================================================================
+static void addInputFiles (const File& input, Array<File>& files)
+{
+    if (input.isDirectory())
+    {
+        for (const auto& entry : RangedDirectoryIterator (input, true, "*.wav;*.flac;*.aif;*.aiff", File::findFiles))
+            files.add (entry.getFile());
+    }
+    else if (input.existsAsFile())
+    {
+        files.add (input);
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    ScopedJuceInitialiser_GUI juceInitialiser;
+
+    ArgumentList args (argc, argv);
+    RenderSettings settings;
+    Array<File> files;
+    int numThreads = SystemStats::getNumCpus();
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        const auto& arg = args[i];
+
+        if (arg == "--preset" && i + 1 < args.size())
+            args[++i].resolveAsExistingFile().loadFileAsData (settings.preset);
+        else if (arg == "--output" && i + 1 < args.size())
+            settings.outputFolder = args[++i].resolveAsFile();
+        else if (arg == "--threads" && i + 1 < args.size())
+            numThreads = jmax (1, args[++i].text.getIntValue());
+        else if (arg == "--block" && i + 1 < args.size())
+            settings.blockSize = jlimit (16, 65536, args[++i].text.getIntValue());
+        else if (arg == "--oversampling")
+            settings.oversampling = true;
+        else
+            addInputFiles (arg.resolveAsFile(), files);
+    }
+
+    if (settings.preset.isEmpty() || settings.outputFolder == File() || files.isEmpty())
+    {
+        std::cerr << "Usage: BatchRender --preset <file> --output <folder> [--threads <n>] [--block <samples>] [--oversampling] <files or folders...>" << std::endl;
+        return 1;
+    }
+
+    settings.outputFolder.createDirectory();
+
+    std::atomic<int> nextFile { 0 };
+    OwnedArray<RenderThread> threads;
+
+    const auto startTime = Time::getMillisecondCounterHiRes();
+
+    for (int i = 0; i < jmin (numThreads, files.size()); ++i)
+        threads.add (new RenderThread (settings, files, nextFile, i))->startThread();
+
+    double secondsOfAudio = 0.0;
+    int numFilesRendered = 0, numFilesFailed = 0;
+
+    for (auto* thread : threads)
+    {
+        thread->waitForThreadToExit (-1);
+        secondsOfAudio += thread->secondsOfAudio;
+        numFilesRendered += thread->numFilesRendered;
+        numFilesFailed += thread->numFilesFailed;
+    }
+
+    const auto elapsedSeconds = (Time::getMillisecondCounterHiRes() - startTime) * 0.001;
+
+    std::cout << "Rendered " << numFilesRendered << " files (" << numFilesFailed << " failed) on "
+              << threads.size() << " threads" << std::endl
+              << "Audio: " << secondsOfAudio << " s, wall clock: " << elapsedSeconds << " s, real-time factor: "
+              << (elapsedSeconds > 0.0 ? secondsOfAudio / elapsedSeconds : 0.0) << "x" << std::endl;
+
+    return numFilesFailed > 0 ? 1 : 0;
+}
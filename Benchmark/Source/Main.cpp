@@ -0,0 +1,1171 @@
+/*
+  ==============================================================================
+
+    This file contains the processBlock benchmark suite.
+
+    It drives CompressorAudioProcessor directly through prepareToPlay and
+    processBlock over a sweep of block sizes, sample rates, channel counts,
+    oversampling on/off, parameter settings and test signals, and reports
+    ns/sample, real-time factor and p50/p99/max per-block time. The
+    "channels" group runs layouts up to 64 channels, where ns per channel
+    sample shows how close to linear the cost per channel stays, and the
+    "precision" group compares the native single and double precision paths
+    with a double-precision host feeding the float path through conversion
+    copies, as hosts do for plugins without double support. The "detector"
+    group prices the RMS and true-peak detectors against the peak detector
+    across channel counts and RMS windows, and the "idle" group shows what
+    silent and mostly silent input saves over continuous noise, with and
+    without make-up gain. The "metering" group prices the level meters an
+    open editor switches on, against the same cases without them. The
+    "host" group runs host buffers from 1 to 8192 samples, and buffers that
+    don't match the announced size, both as they come and regrouped into
+    fixed sub-blocks (blockMode=1). The "gainComputer" group times the gain
+    computer on its own, per sample: the curve table against the hard-knee
+    log2/exp2 path it replaced and the soft-knee path still used while
+    settings glide, and records the worst error each has against the exact
+    curve. Every case also records the DSP memory one prepared instance
+    holds and the latency it reports. Build it as a
+    console application compiling the plugin's Source files alongside this
+    one, with the same JucePlugin_* definitions as the plugin target.
+
+    --verify runs correctness checks instead of timings, and exits with 1 if
+    any fails. The null checks render noise at ratio 1:1 through a 50% mix
+    and through a fully wet one, which must match wherever the compressed
+    signal picks up phase shift, in multiband and in every oversampling mode.
+    The kernel on its own must match dsp::Compressor's gain within 1e-4 dB
+    where it computes the curve and within 0.031 dB where it reads the table.
+    It then checks the cost bounds below against the best of three timed runs,
+    so a loaded machine can fail them but not pass them by chance:
+
+        metering        an open editor's meters take at most 1% of the
+                        real-time budget at 2 and 64 channels, 64-sample blocks
+        oversampling    detector-only 4x oversampling costs less than the
+                        full path at 4x, at 2 and 8 channels
+        channels        ns per channel sample at 16 and 64 channels stays
+                        within 1.5x of stereo, unlinked and zone-linked
+        precision       the native double path costs no more than a double
+                        host converting around the float path, at 64 and
+                        512-sample blocks
+        detector        RMS with a 50 ms window costs within 1.1x of a 1 ms
+                        one, and RMS and true peak stay within 1.5x and 3x
+                        of the peak detector
+        idle            silence costs at most a tenth of noise, and bursts
+                        (100 ms of noise a second) at most half, oversampled
+                        with 20 ms lookahead
+        host            regrouped 1- and 8-sample host buffers cost at most
+                        2x of 512-sample ones, and 8192-sample buffers sent
+                        after announcing 512 at most 1.1x, split as they come
+        gainComputer    reading the curve table costs less per sample than
+                        the log2/exp2 hard-knee path it replaced, at 512-
+                        sample rows
+
+    --editor opens a number of editors' worth of knobs (40 by default) with
+    the knob drawing the plugin shipped with, which rescales a frame out of
+    the whole filmstrip on every repaint, and with the current cached one,
+    painting each into an Image. It reports the open time of all of them and
+    the cost of one knob repaint at 1x and 2x display scale, plus the open
+    time of the real editor.
+
+    Usage:
+        Benchmark [--quick] [--seconds <s>] [--output <results.csv>]
+                  [--compare <baseline.csv>] [--filter <substring>]
+        Benchmark --verify
+        Benchmark --editor [--editors <n>]
+
+    Results are written as CSV, one row per case. Passing a CSV from an earlier
+    commit as --compare prints the ns/sample change for every matching case
+    and flags those more than 10% slower.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <iostream>
+#include <numeric>
+#include "../../Source/PluginProcessor.h"
+#include "../../Source/PluginEditor.h"
+#include "../../Source/KnobImage.h"
+
+//==============================================================================
+enum class Signal
+{
+    noise,
+    sine,
+    transients,
+    silence,
+    bursts
+};
+
+static const char* getSignalName (Signal signal)
+{
+    switch (signal)
+    {
+        case Signal::noise:      return "noise";
+        case Signal::sine:       return "sine";
+        case Signal::transients: return "transients";
+        case Signal::silence:    return "silence";
+        case Signal::bursts:     return "bursts";
+    }
+
+    return "";
+}
+
+static void fillSignal (AudioBuffer<float>& buffer, Signal signal, double sampleRate)
+{
+    Random random (0x5eed);
+
+    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+    {
+        auto* samples = buffer.getWritePointer (channel);
+
+        for (int i = 0; i < buffer.getNumSamples(); ++i)
+        {
+            switch (signal)
+            {
+                case Signal::noise:
+                    samples[i] = random.nextFloat() * 2.0f - 1.0f;
+                    break;
+
+                case Signal::sine:
+                    samples[i] = 0.5f * std::sin (MathConstants<float>::twoPi * 997.0f * static_cast<float> (i / sampleRate));
+                    break;
+
+                case Signal::transients:
+                {
+                    // a decaying click every 100 ms over a quiet noise floor
+                    const auto sinceClick = i % static_cast<int> (sampleRate * 0.1);
+                    samples[i] = 0.01f * (random.nextFloat() * 2.0f - 1.0f)
+                               + std::exp (-static_cast<float> (sinceClick) / 200.0f) * (sinceClick % 2 == 0 ? 0.9f : -0.9f);
+                    break;
+                }
+
+                case Signal::silence:
+                    samples[i] = 0.0f;
+                    break;
+
+                case Signal::bursts:
+                    // 100 ms of noise a second, like a mostly idle track in a large session
+                    samples[i] = i < static_cast<int> (sampleRate * 0.1) ? random.nextFloat() * 2.0f - 1.0f : 0.0f;
+                    break;
+            }
+        }
+    }
+}
+
+//==============================================================================
+enum class Precision
+{
+    single,
+    native,
+    converted
+};
+
+static const char* getPrecisionName (Precision precision)
+{
+    switch (precision)
+    {
+        case Precision::single:    return "single";
+        case Precision::native:    return "double";
+        case Precision::converted: return "converted";
+    }
+
+    return "";
+}
+
+//==============================================================================
+struct BenchmarkCase
+{
+    String group;
+    double sampleRate = 48000.0;
+    int blockSize = 512;
+    int numChannels = 2;
+    bool oversampling = false;
+    Signal signal = Signal::noise;
+    Precision precision = Precision::single;
+    int hostBlockSize = 0;      // what processBlock() is actually called with; 0 for blockSize
+    bool metering = false;      // as while the editor is open
+    StringPairArray parameters;
+
+    int getHostBlockSize() const { return hostBlockSize > 0 ? hostBlockSize : blockSize; }
+
+    String getKey() const
+    {
+        String key;
+        key << group << "|" << sampleRate << "|" << blockSize << "|" << numChannels << "|"
+            << (oversampling ? "os" : "direct") << "|" << getSignalName (signal);
+
+        // Single precision keeps the keys of results recorded before the precision cases existed
+        if (precision != Precision::single)
+            key << "|" << getPrecisionName (precision);
+
+        if (hostBlockSize > 0)
+            key << "|host=" << hostBlockSize;
+
+        if (metering)
+            key << "|metering";
+
+        for (auto& id : parameters.getAllKeys())
+            key << "|" << id << "=" << parameters[id];
+
+        return key;
+    }
+};
+
+struct BenchmarkResult
+{
+    double nsPerSample = 0.0, nsPerChannelSample = 0.0, realTimeFactor = 0.0;
+    double p50Micros = 0.0, p99Micros = 0.0, maxMicros = 0.0;
+    size_t dspMemoryBytes = 0;
+    int latencySamples = 0;
+    double gainErrordB = 0.0;
+};
+
+static void setParameter (CompressorAudioProcessor& processor, const String& id, float value)
+{
+    if (auto* parameter = processor.getState().getParameter (id))
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (value));
+    else
+        std::cerr << "Unknown parameter: " << id << std::endl;
+}
+
+static BenchmarkResult runCase (const BenchmarkCase& benchmarkCase, double secondsOfAudio)
+{
+    CompressorAudioProcessor processor;
+    processor.setFilteringEnbaled (benchmarkCase.oversampling);
+    processor.setMeteringEnabled (benchmarkCase.metering);
+
+    for (auto& id : benchmarkCase.parameters.getAllKeys())
+        setParameter (processor, id, benchmarkCase.parameters[id].getFloatValue());
+
+    processor.setPlayConfigDetails (benchmarkCase.numChannels, benchmarkCase.numChannels, benchmarkCase.sampleRate, benchmarkCase.blockSize);
+    processor.setProcessingPrecision (benchmarkCase.precision == Precision::native ? AudioProcessor::doublePrecision
+                                                                                   : AudioProcessor::singlePrecision);
+    processor.prepareToPlay (benchmarkCase.sampleRate, benchmarkCase.blockSize);
+
+    // One second of source material, looped block by block
+    AudioBuffer<float> source (benchmarkCase.numChannels, static_cast<int> (benchmarkCase.sampleRate));
+    fillSignal (source, benchmarkCase.signal, benchmarkCase.sampleRate);
+
+    const auto hostBlockSize = benchmarkCase.getHostBlockSize();
+    AudioBuffer<float> buffer (benchmarkCase.numChannels, hostBlockSize);
+    AudioBuffer<double> doubleBuffer (benchmarkCase.numChannels, hostBlockSize);
+    MidiBuffer midi;
+
+    const auto numBlocks = jmax (100, static_cast<int> (secondsOfAudio * benchmarkCase.sampleRate / hostBlockSize));
+    const auto numWarmUpBlocks = 10;
+    std::vector<double> blockSeconds;
+    blockSeconds.reserve (static_cast<size_t> (numBlocks));
+
+    int sourcePosition = 0;
+
+    for (int block = 0; block < numWarmUpBlocks + numBlocks; ++block)
+    {
+        if (sourcePosition + hostBlockSize > source.getNumSamples())
+            sourcePosition = 0;
+
+        for (int channel = 0; channel < benchmarkCase.numChannels; ++channel)
+        {
+            if (benchmarkCase.precision == Precision::single)
+                buffer.copyFrom (channel, 0, source, channel, sourcePosition, hostBlockSize);
+            else
+                for (int i = 0; i < hostBlockSize; ++i)
+                    doubleBuffer.setSample (channel, i, static_cast<double> (source.getSample (channel, sourcePosition + i)));
+        }
+
+        sourcePosition += hostBlockSize;
+
+        const auto start = Time::getHighResolutionTicks();
+
+        switch (benchmarkCase.precision)
+        {
+            case Precision::single:
+                processor.processBlock (buffer, midi);
+                break;
+
+            case Precision::native:
+                processor.processBlock (doubleBuffer, midi);
+                break;
+
+            case Precision::converted:
+                // What a double-precision host does around a float-only plugin
+                buffer.makeCopyOf (doubleBuffer, true);
+                processor.processBlock (buffer, midi);
+                doubleBuffer.makeCopyOf (buffer, true);
+                break;
+        }
+
+        const auto end = Time::getHighResolutionTicks();
+
+        if (block >= numWarmUpBlocks)
+            blockSeconds.push_back (Time::highResolutionTicksToSeconds (end - start));
+    }
+
+    const auto dspMemoryBytes = processor.getDspMemoryBytes();
+    const auto latencySamples = processor.getLatencySamples();
+    processor.releaseResources();
+
+    const auto totalSeconds = std::accumulate (blockSeconds.begin(), blockSeconds.end(), 0.0);
+    const auto totalSamples = static_cast<double> (numBlocks) * hostBlockSize;
+
+    std::sort (blockSeconds.begin(), blockSeconds.end());
+    const auto percentile = [&blockSeconds] (double p) { return blockSeconds[static_cast<size_t> (p * (blockSeconds.size() - 1))] * 1.0e6; };
+
+    BenchmarkResult result;
+    result.nsPerSample = totalSeconds * 1.0e9 / totalSamples;
+    result.nsPerChannelSample = result.nsPerSample / benchmarkCase.numChannels;
+    result.realTimeFactor = (totalSamples / benchmarkCase.sampleRate) / totalSeconds;
+    result.p50Micros = percentile (0.5);
+    result.p99Micros = percentile (0.99);
+    result.maxMicros = blockSeconds.back() * 1.0e6;
+    result.dspMemoryBytes = dspMemoryBytes;
+    result.latencySamples = latencySamples;
+    return result;
+}
+
+//==============================================================================
+/** Runs rows of detector levels through one way of computing the gain, outside the
+    processor. The "path" parameter picks "table", "softKnee" (the log2/exp2 curve
+    the compressor falls back to while settings glide) or "hardKnee" (the log2/exp2
+    curve as it was before the knee and tables).
+*/
+static BenchmarkResult runGainComputer (const BenchmarkCase& benchmarkCase, double secondsOfAudio)
+{
+    const auto path = benchmarkCase.parameters["path"];
+    const auto toLog2 = 0.166096404f;
+
+    GainCurveSettings settings;
+    settings.threshold = benchmarkCase.parameters["threshold"].getFloatValue() * toLog2;
+    settings.slope = 1.0f / benchmarkCase.parameters["ratio"].getFloatValue() - 1.0f;
+    settings.knee = benchmarkCase.parameters["knee"].getFloatValue() * toLog2;
+
+    HeapBlock<float> gains (GainCurveTable::numNodes);
+    GainCurveTable::build (gains, settings);
+
+    // One second of levels spread evenly in dB from -80 to +20 dBFS, in random order
+    const auto numLevels = static_cast<int> (benchmarkCase.sampleRate);
+    std::vector<float> levels (static_cast<size_t> (numLevels));
+    Random random (0x5eed);
+
+    for (auto& level : levels)
+        level = Decibels::decibelsToGain (random.nextFloat() * 100.0f - 80.0f, -200.0f);
+
+    const auto blockSize = benchmarkCase.blockSize;
+    std::vector<float> row (static_cast<size_t> (blockSize));
+
+    const auto computeRow = [&] (float* rowData)
+    {
+        if (path == "table")
+        {
+            GainCurveTable::lookup (gains, rowData, static_cast<size_t> (blockSize));
+        }
+        else if (path == "softKnee")
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                const auto level = FastMath::log2 (jmax (rowData[i], 1.0e-20f));
+                rowData[i] = FastMath::exp2 (GainCurveSettings::getGain (level, settings.threshold, settings.slope, settings.knee));
+            }
+        }
+        else
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                const auto level = FastMath::log2 (jmax (rowData[i], 1.0e-20f));
+                rowData[i] = FastMath::exp2 (jmin (0.0f, settings.slope * (level - settings.threshold)));
+            }
+        }
+    };
+
+    const auto numBlocks = jmax (100, static_cast<int> (secondsOfAudio * benchmarkCase.sampleRate / blockSize));
+    const auto numWarmUpBlocks = 10;
+    std::vector<double> blockSeconds;
+    blockSeconds.reserve (static_cast<size_t> (numBlocks));
+
+    BenchmarkResult result;
+    int levelPosition = 0;
+
+    for (int block = 0; block < numWarmUpBlocks + numBlocks; ++block)
+    {
+        if (levelPosition + blockSize > numLevels)
+            levelPosition = 0;
+
+        std::copy (levels.begin() + levelPosition, levels.begin() + levelPosition + blockSize, row.begin());
+
+        const auto start = Time::getHighResolutionTicks();
+        computeRow (row.data());
+        const auto end = Time::getHighResolutionTicks();
+
+        if (block >= numWarmUpBlocks)
+            blockSeconds.push_back (Time::highResolutionTicksToSeconds (end - start));
+
+        // Each path is measured against the exact curve it stands for, and the
+        // hard-knee path never had a knee
+        for (int i = 0; i < blockSize; ++i)
+        {
+            const auto level = std::log2 (static_cast<double> (levels[static_cast<size_t> (levelPosition + i)]));
+            const auto exact = GainCurveTable::getExactGain (level, path == "hardKnee" ? GainCurveSettings { settings.threshold, settings.slope, 0.0f } : settings);
+            result.gainErrordB = jmax (result.gainErrordB, std::abs (std::log2 (static_cast<double> (row[static_cast<size_t> (i)])) - exact) * 6.02059991);
+        }
+
+        levelPosition += blockSize;
+    }
+
+    const auto totalSeconds = std::accumulate (blockSeconds.begin(), blockSeconds.end(), 0.0);
+    const auto totalSamples = static_cast<double> (numBlocks) * blockSize;
+
+    std::sort (blockSeconds.begin(), blockSeconds.end());
+    const auto percentile = [&blockSeconds] (double p) { return blockSeconds[static_cast<size_t> (p * (blockSeconds.size() - 1))] * 1.0e6; };
+
+    result.nsPerSample = totalSeconds * 1.0e9 / totalSamples;
+    result.nsPerChannelSample = result.nsPerSample;
+    result.realTimeFactor = (totalSamples / benchmarkCase.sampleRate) / totalSeconds;
+    result.p50Micros = percentile (0.5);
+    result.p99Micros = percentile (0.99);
+    result.maxMicros = blockSeconds.back() * 1.0e6;
+    return result;
+}
+
+//==============================================================================
+/** A case with moderate compression, so the gain computer is always working. */
+static BenchmarkCase makeCase (const String& group)
+{
+    BenchmarkCase benchmarkCase;
+    benchmarkCase.group = group;
+    benchmarkCase.parameters.set ("threshold", "-30");
+    benchmarkCase.parameters.set ("ratio", "4");
+    benchmarkCase.parameters.set ("attack", "5");
+    benchmarkCase.parameters.set ("release", "50");
+    return benchmarkCase;
+}
+
+/** The fastest of three one-second runs of a case, in ns per sample, so the cost bounds
+    --verify checks are not thrown by one run the scheduler interrupted.
+*/
+static double getBestNsPerSample (const BenchmarkCase& benchmarkCase)
+{
+    auto best = std::numeric_limits<double>::max();
+
+    for (int run = 0; run < 3; ++run)
+        best = jmin (best, runCase (benchmarkCase, 1.0).nsPerSample);
+
+    return best;
+}
+
+//==============================================================================
+/** Renders a second of noise through a processor with these settings, starting from prepareToPlay(). */
+static AudioBuffer<float> renderNoise (const StringPairArray& settings, bool oversampling)
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int numChannels = 2, blockSize = 512;
+
+    CompressorAudioProcessor processor;
+    processor.setFilteringEnbaled (oversampling);
+
+    for (auto& id : settings.getAllKeys())
+        setParameter (processor, id, settings[id].getFloatValue());
+
+    processor.setPlayConfigDetails (numChannels, numChannels, sampleRate, blockSize);
+    processor.prepareToPlay (sampleRate, blockSize);
+
+    AudioBuffer<float> output (numChannels, static_cast<int> (sampleRate));
+    fillSignal (output, Signal::noise, sampleRate);
+    MidiBuffer midi;
+
+    for (int start = 0; start + blockSize <= output.getNumSamples(); start += blockSize)
+    {
+        AudioBuffer<float> block (output.getArrayOfWritePointers(), numChannels, start, blockSize);
+        processor.processBlock (block, midi);
+    }
+
+    processor.releaseResources();
+    return output;
+}
+
+/** The largest difference between two renders after the first quarter second, in dBFS. */
+static double getResidualDecibels (const AudioBuffer<float>& a, const AudioBuffer<float>& b)
+{
+    const auto settle = a.getNumSamples() / 4;
+    float residual = 0.0f;
+
+    for (int channel = 0; channel < a.getNumChannels(); ++channel)
+        for (int i = settle; i < a.getNumSamples(); ++i)
+            residual = jmax (residual, std::abs (a.getSample (channel, i) - b.getSample (channel, i)));
+
+    return Decibels::gainToDecibels (static_cast<double> (residual), -200.0);
+}
+
+/** The worst gain difference between SIMDCompressor and dsp::Compressor, in dB, over a second
+    of unlinked noise with the peak detector and a hard knee, which both should treat alike.
+*/
+static double getCompressorErrorDecibels (float threshold)
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int numChannels = 5, blockSize = 512;
+    const dsp::ProcessSpec spec { sampleRate, static_cast<uint32> (blockSize), static_cast<uint32> (numChannels) };
+
+    AudioBuffer<float> input (numChannels, static_cast<int> (sampleRate));
+    fillSignal (input, Signal::noise, sampleRate);
+    AudioBuffer<float> expected (input), actual (input);
+
+    dsp::Compressor<float> reference;
+    reference.setThreshold (threshold);
+    reference.setRatio (4.0f);
+    reference.setAttack (1.0f);
+    reference.setRelease (100.0f);
+    reference.prepare (spec);
+
+    // Settings first, so prepare() builds their table and nothing glides
+    MemoryArena arena;
+    SIMDCompressor<float> compressor;
+    compressor.setThreshold (threshold);
+    compressor.setRatio (4.0f);
+    compressor.setAttack (1.0f);
+    compressor.setRelease (100.0f);
+    compressor.prepare (arena, spec);
+
+    for (int start = 0; start + blockSize <= input.getNumSamples(); start += blockSize)
+    {
+        dsp::AudioBlock<float> expectedBlock (expected.getArrayOfWritePointers(), numChannels, static_cast<size_t> (start), blockSize);
+        dsp::AudioBlock<float> actualBlock (actual.getArrayOfWritePointers(), numChannels, static_cast<size_t> (start), blockSize);
+        reference.process (dsp::ProcessContextReplacing<float> (expectedBlock));
+        compressor.process (dsp::ProcessContextReplacing<float> (actualBlock));
+    }
+
+    compressor.release();
+
+    // Gains are compared where the input is loud enough for the ratio to mean something
+    double worst = 0.0;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        for (int i = 0; i < input.getNumSamples(); ++i)
+            if (std::abs (input.getSample (channel, i)) > 1.0e-3f)
+                worst = jmax (worst, std::abs (20.0 * std::log10 (static_cast<double> (actual.getSample (channel, i))
+                                                                 / static_cast<double> (expected.getSample (channel, i)))));
+
+    return worst;
+}
+
+static int runChecks()
+{
+    int numFailures = 0;
+
+    const auto report = [&numFailures] (const String& name, double measured, double limit, const char* unit)
+    {
+        const auto passed = measured <= limit;
+        numFailures += passed ? 0 : 1;
+        std::cout << (passed ? "PASS " : "FAIL ") << name << ": " << String (measured, 5) << " " << unit
+                  << " (limit " << String (limit, 5) << ")" << std::endl;
+    };
+
+    // At 1:1 the compressed signal is the input through the chain's filters and
+    // delays, so a 50% mix must match it wherever the dry signal is filtered alike
+    struct NullCase
+    {
+        const char* name;
+        bool oversampling;
+        std::initializer_list<std::pair<const char*, const char*>> settings;
+    };
+
+    const NullCase nullCases[] =
+    {
+        { "multiband",                false, { { "bands", "3" } } },
+        { "oversampled IIR",          true,  { { "osFactor", "2" }, { "osFilter", "0" } } },
+        { "oversampled FIR",          true,  { { "osFactor", "2" }, { "osFilter", "1" } } },
+        { "oversampled multiband",    true,  { { "osFactor", "2" }, { "osFilter", "0" }, { "bands", "3" } } },
+        { "detector only",            true,  { { "osFactor", "2" }, { "osFilter", "0" }, { "osMode", "1" } } },
+        { "multiband with lookahead", true,  { { "osFactor", "1" }, { "bands", "5" }, { "lookahead", "5" } } },
+    };
+
+    for (auto& nullCase : nullCases)
+    {
+        StringPairArray settings;
+        settings.set ("ratio", "1");
+
+        for (auto& setting : nullCase.settings)
+            settings.set (setting.first, setting.second);
+
+        const auto wet = renderNoise (settings, nullCase.oversampling);
+        settings.set ("mix", "50");
+        const auto mixed = renderNoise (settings, nullCase.oversampling);
+
+        report ("50% mix null, " + String (nullCase.name), getResidualDecibels (wet, mixed), -100.0, "dBFS");
+    }
+
+    // -70 dB is below the curve table, so it checks the log2/exp2 path; -30 dB reads the table
+    report ("dsp::Compressor match, computed curve", getCompressorErrorDecibels (-70.0f), 1.0e-4, "dB");
+    report ("dsp::Compressor match, curve table", getCompressorErrorDecibels (-30.0f), 0.031, "dB");
+
+    // An open editor's meters may take at most 1% of the real-time budget, even at the widest
+    // layout and small blocks, where measuring every channel weighs most against the DSP
+    for (auto numChannels : { 2, 64 })
+    {
+        auto benchmarkCase = makeCase ("metering");
+        benchmarkCase.numChannels = numChannels;
+        benchmarkCase.blockSize = 64;
+
+        const auto plain = getBestNsPerSample (benchmarkCase);
+        benchmarkCase.metering = true;
+        const auto metered = getBestNsPerSample (benchmarkCase);
+
+        report ("metering overhead, " + String (numChannels) + " channels", (metered - plain) * benchmarkCase.sampleRate * 1.0e-7, 1.0, "% of real time");
+    }
+
+    // Cost bounds given as the ratio of one case's ns per sample to another's
+    const auto reportRatio = [&report] (const String& name, const BenchmarkCase& measured, const BenchmarkCase& reference, double limit)
+    {
+        report (name, getBestNsPerSample (measured) / getBestNsPerSample (reference), limit, "x");
+    };
+
+    // Detector-only oversampling leaves the audio path at the base rate, so it must undercut the full path
+    for (auto numChannels : { 2, 8 })
+    {
+        auto fullPath = makeCase ("parameter");
+        fullPath.numChannels = numChannels;
+        fullPath.oversampling = true;
+        fullPath.parameters.set ("osFactor", "2");
+
+        auto detectorOnly = fullPath;
+        detectorOnly.parameters.set ("osMode", "1");
+
+        reportRatio ("detector-only over full-path oversampling, " + String (numChannels) + " channels", detectorOnly, fullPath, 1.0);
+    }
+
+    // Per-channel cost should stay close to linear as layouts widen
+    for (auto link : { "0", "1" })
+    {
+        auto stereo = makeCase ("channels");
+        stereo.parameters.set ("link", link);
+        stereo.parameters.set ("linkGroups", "1");
+        const auto stereoCost = getBestNsPerSample (stereo) / stereo.numChannels;
+
+        for (auto numChannels : { 16, 64 })
+        {
+            auto wide = stereo;
+            wide.numChannels = numChannels;
+
+            report ("ns per channel sample over stereo, " + String (numChannels) + " channels, link " + link,
+                    getBestNsPerSample (wide) / numChannels / stereoCost, 1.5, "x");
+        }
+    }
+
+    // The double engine exists so hosts stop paying for conversion copies
+    for (auto blockSize : { 64, 512 })
+    {
+        auto converted = makeCase ("precision");
+        converted.blockSize = blockSize;
+        converted.numChannels = 8;
+        converted.precision = Precision::converted;
+
+        auto native = converted;
+        native.precision = Precision::native;
+
+        reportRatio ("native double over converted float, " + String (blockSize) + "-sample blocks", native, converted, 1.0);
+    }
+
+    // The running sum makes RMS cost the same for any window, and true peak only interpolates the detector
+    {
+        auto peak = makeCase ("detector");
+        peak.parameters.set ("detector", "0");
+
+        auto shortRms = makeCase ("detector");
+        shortRms.parameters.set ("detector", "1");
+        shortRms.parameters.set ("rmsWindow", "1");
+
+        auto longRms = shortRms;
+        longRms.parameters.set ("rmsWindow", "50");
+
+        auto truePeak = peak;
+        truePeak.parameters.set ("detector", "2");
+
+        reportRatio ("RMS 50 ms window over 1 ms window", longRms, shortRms, 1.1);
+        reportRatio ("RMS detector over peak detector", longRms, peak, 1.5);
+        reportRatio ("true-peak detector over peak detector", truePeak, peak, 3.0);
+    }
+
+    // What a mostly silent session saves, with the oversampling and lookahead latency the tail has to cover
+    {
+        auto noise = makeCase ("idle");
+        noise.oversampling = true;
+        noise.parameters.set ("lookahead", "20");
+
+        auto bursts = noise;
+        bursts.signal = Signal::bursts;
+
+        auto silence = noise;
+        silence.signal = Signal::silence;
+
+        reportRatio ("silence over noise", silence, noise, 0.1);
+        reportRatio ("bursts over noise", bursts, noise, 0.5);
+    }
+
+    // Regrouping should amortise the chain's per-call work over tiny host buffers, and
+    // splitting an oversized buffer should cost no more than the host sending it in pieces
+    {
+        auto announced = makeCase ("host");
+        announced.oversampling = true;
+        announced.parameters.set ("blockMode", "1");
+
+        for (auto blockSize : { 1, 8 })
+        {
+            auto tiny = announced;
+            tiny.blockSize = blockSize;
+            reportRatio ("regrouped " + String (blockSize) + "-sample host buffers over 512", tiny, announced, 2.0);
+        }
+
+        announced.parameters.set ("blockMode", "0");
+        auto oversized = announced;
+        oversized.hostBlockSize = 8192;
+        reportRatio ("8192-sample host buffers split into 512", oversized, announced, 1.1);
+    }
+
+    // The table exists to take the transcendentals out of the gain computer
+    {
+        const auto getBestGainComputerNs = [] (const char* path)
+        {
+            auto benchmarkCase = makeCase ("gainComputer");
+            benchmarkCase.numChannels = 1;
+            benchmarkCase.parameters.set ("path", path);
+            benchmarkCase.parameters.set ("knee", "0");
+
+            auto best = std::numeric_limits<double>::max();
+
+            for (int run = 0; run < 3; ++run)
+                best = jmin (best, runGainComputer (benchmarkCase, 1.0).nsPerSample);
+
+            return best;
+        };
+
+        report ("curve table over hard-knee gain computer", getBestGainComputerNs ("table") / getBestGainComputerNs ("hardKnee"), 1.0, "x");
+    }
+
+    return numFailures;
+}
+
+//==============================================================================
+/** The knob drawing the plugin started with: each repaint rescales a frame straight out of the whole filmstrip. */
+class LegacyKnobLookAndFeel  : public LookAndFeel_V4
+{
+public:
+    LegacyKnobLookAndFeel()
+        : filmstrip (ImageCache::getFromMemory (KnobImage::png, KnobImage::pngSize))
+    {
+    }
+
+    void drawRotarySlider (Graphics& g, int x, int y, int width, int height, float,
+                           float, float, Slider& slider) override
+    {
+        const auto rotation = (slider.getValue() - slider.getMinimum()) / (slider.getMaximum() - slider.getMinimum());
+        const auto frameSize = filmstrip.getWidth();
+        const auto frameId = static_cast<int> (std::ceil (rotation * (filmstrip.getHeight() / frameSize - 1.0)));
+        const auto radius = jmin (width / 2.0f, height / 2.0f);
+        const auto rx = x + width * 0.5f - radius - 1.0f;
+        const auto ry = y + height * 0.5f - radius;
+
+        g.drawImage (filmstrip, static_cast<int> (rx), static_cast<int> (ry), 2 * static_cast<int> (radius), 2 * static_cast<int> (radius),
+                     0, frameId * frameSize, frameSize, frameSize);
+    }
+
+private:
+    Image filmstrip;
+};
+
+/** The editor's five knobs where it puts them, with a look and feel of their own as each editor has. */
+template <typename KnobLookAndFeel>
+struct KnobPanel  : public Component
+{
+    KnobPanel()
+    {
+        for (int i = 0; i < numElementsInArray (knobs); ++i)
+        {
+            knobs[i].setSliderStyle (Slider::RotaryVerticalDrag);
+            knobs[i].setTextBoxStyle (Slider::NoTextBox, true, 0, 0);
+            knobs[i].setLookAndFeel (&lookAndFeel);
+            knobs[i].setBounds ((600 / 6) * (i + 1) - 50, 90, 100, 100);
+            addAndMakeVisible (knobs[i]);
+        }
+
+        setSize (600, 300);
+    }
+
+    ~KnobPanel() override
+    {
+        for (auto& knob : knobs)
+            knob.setLookAndFeel (nullptr);
+    }
+
+    KnobLookAndFeel lookAndFeel;
+    Slider knobs[5];
+};
+
+/** Milliseconds to create every component and paint each into an Image, all kept open together as in a session. */
+template <typename CreateComponent>
+static double timeOpenMilliseconds (int numEditors, CreateComponent&& createComponent)
+{
+    // Both knob drawings decode the same bytes, so neither may find the other's image cached
+    ImageCache::releaseUnusedImages();
+
+    OwnedArray<Component> components;
+    const auto start = Time::getHighResolutionTicks();
+
+    for (int i = 0; i < numEditors; ++i)
+    {
+        auto* component = components.add (createComponent (i));
+        component->createComponentSnapshot (component->getLocalBounds());
+    }
+
+    return Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - start) * 1.0e3;
+}
+
+/** Microseconds per repaint of one 100 px knob, swept across its range, at a display scale. */
+static double timeKnobRepaintMicroseconds (LookAndFeel& lookAndFeel, float scale)
+{
+    constexpr int numPaints = 2000;
+
+    Slider knob (Slider::RotaryVerticalDrag, Slider::NoTextBox);
+    knob.setRange (0.0, 1.0);
+    knob.setLookAndFeel (&lookAndFeel);
+    knob.setBounds (0, 0, 100, 100);
+
+    Image image (Image::ARGB, roundToInt (100 * scale), roundToInt (100 * scale), true);
+    Graphics g (image);
+    g.addTransform (AffineTransform::scale (scale));
+
+    // The first paint at a size fills the frame cache, which opening already pays for
+    knob.paintEntireComponent (g, false);
+
+    const auto start = Time::getHighResolutionTicks();
+
+    for (int i = 0; i < numPaints; ++i)
+    {
+        knob.setValue (static_cast<double> (i % 128) / 127.0, dontSendNotification);
+        knob.paintEntireComponent (g, false);
+    }
+
+    const auto seconds = Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - start);
+    knob.setLookAndFeel (nullptr);
+    return seconds * 1.0e6 / numPaints;
+}
+
+static void runEditorBenchmark (int numEditors)
+{
+    const auto legacyOpen = timeOpenMilliseconds (numEditors, [] (int) { return new KnobPanel<LegacyKnobLookAndFeel>(); });
+    const auto currentOpen = timeOpenMilliseconds (numEditors, [] (int) { return new KnobPanel<myLookAndFeelV1>(); });
+
+    std::cout << numEditors << " editors' knobs open and painted: legacy " << String (legacyOpen, 1)
+              << " ms, current " << String (currentOpen, 1) << " ms" << std::endl;
+
+    // The processors are made up front, so only the editors are timed
+    OwnedArray<CompressorAudioProcessor> processors;
+
+    for (int i = 0; i < numEditors; ++i)
+        processors.add (new CompressorAudioProcessor());
+
+    const auto editorOpen = timeOpenMilliseconds (numEditors, [&processors] (int i) { return new CompressorAudioProcessorEditor (*processors[i]); });
+    std::cout << numEditors << " editors open and painted: " << String (editorOpen, 1) << " ms" << std::endl;
+
+    for (auto scale : { 1.0f, 2.0f })
+    {
+        LegacyKnobLookAndFeel legacy;
+        myLookAndFeelV1 current;
+
+        std::cout << "Knob repaint at " << scale << "x: legacy " << String (timeKnobRepaintMicroseconds (legacy, scale), 2)
+                  << " us, current " << String (timeKnobRepaintMicroseconds (current, scale), 2) << " us" << std::endl;
+    }
+}
+
+//==============================================================================
+static Array<BenchmarkCase> createCases (bool quick)
+{
+    Array<BenchmarkCase> cases;
+
+    const Array<int> blockSizes = quick ? Array<int> { 64, 512, 4096 } : Array<int> { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    const Array<double> sampleRates = quick ? Array<double> { 48000.0 } : Array<double> { 44100.0, 48000.0, 96000.0, 192000.0 };
+
+    for (auto sampleRate : sampleRates)
+        for (auto blockSize : blockSizes)
+            for (auto numChannels : { 1, 2 })
+                for (auto oversampling : { false, true })
+                {
+                    auto benchmarkCase = makeCase ("core");
+                    benchmarkCase.sampleRate = sampleRate;
+                    benchmarkCase.blockSize = blockSize;
+                    benchmarkCase.numChannels = numChannels;
+                    benchmarkCase.oversampling = oversampling;
+                    cases.add (benchmarkCase);
+                }
+
+    // Surround beds and ambisonic stems, unlinked and with one detector per zone
+    for (auto numChannels : { 1, 2, 6, 8, 12, 16, 32, 64 })
+        for (auto oversampling : { false, true })
+            for (auto link : { "0", "1" })
+            {
+                auto benchmarkCase = makeCase ("channels");
+                benchmarkCase.numChannels = numChannels;
+                benchmarkCase.oversampling = oversampling;
+                benchmarkCase.parameters.set ("link", link);
+                benchmarkCase.parameters.set ("linkGroups", "1");
+                cases.add (benchmarkCase);
+            }
+
+    for (auto blockSize : { 64, 512, 4096 })
+        for (auto numChannels : { 2, 8 })
+            for (auto oversampling : { false, true })
+                for (auto precision : { Precision::single, Precision::native, Precision::converted })
+                {
+                    auto benchmarkCase = makeCase ("precision");
+                    benchmarkCase.blockSize = blockSize;
+                    benchmarkCase.numChannels = numChannels;
+                    benchmarkCase.oversampling = oversampling;
+                    benchmarkCase.precision = precision;
+                    cases.add (benchmarkCase);
+                }
+
+    for (auto numChannels : { 1, 2, 8 })
+        for (auto oversampling : { false, true })
+            for (auto detector : { "0", "1", "2" })
+            {
+                auto benchmarkCase = makeCase ("detector");
+                benchmarkCase.numChannels = numChannels;
+                benchmarkCase.oversampling = oversampling;
+                benchmarkCase.parameters.set ("detector", detector);
+                cases.add (benchmarkCase);
+            }
+
+    // The running sum should cost the same whatever the window
+    for (auto rmsWindow : { "1", "10", "50" })
+    {
+        auto benchmarkCase = makeCase ("detector");
+        benchmarkCase.parameters.set ("detector", "1");
+        benchmarkCase.parameters.set ("rmsWindow", rmsWindow);
+        cases.add (benchmarkCase);
+    }
+
+    for (auto signal : { Signal::noise, Signal::bursts, Signal::silence })
+        for (auto oversampling : { false, true })
+            for (auto lookahead : { "0", "20" })
+            {
+                auto benchmarkCase = makeCase ("idle");
+                benchmarkCase.signal = signal;
+                benchmarkCase.oversampling = oversampling;
+                benchmarkCase.parameters.set ("lookahead", lookahead);
+                cases.add (benchmarkCase);
+            }
+
+    // What an open editor's meters cost; nothing drains the FIFO, so this includes dropping frames
+    for (auto numChannels : { 2, 8, 64 })
+        for (auto blockSize : { 64, 512 })
+            for (auto metering : { false, true })
+            {
+                auto benchmarkCase = makeCase ("metering");
+                benchmarkCase.numChannels = numChannels;
+                benchmarkCase.blockSize = blockSize;
+                benchmarkCase.metering = metering;
+                cases.add (benchmarkCase);
+            }
+
+    // Make-up gain lowers the silence threshold and lengthens the tail, so idling starts later
+    for (auto signal : { Signal::bursts, Signal::silence })
+        for (auto gain : { "20", "40" })
+        {
+            auto benchmarkCase = makeCase ("idle");
+            benchmarkCase.signal = signal;
+            benchmarkCase.parameters.set ("gain", gain);
+            cases.add (benchmarkCase);
+        }
+
+    // Every power-of-two host buffer from 1 to 8192 samples, announced correctly
+    for (int blockSize = 1; blockSize <= 8192; blockSize *= (quick ? 8 : 2))
+        for (auto oversampling : { false, true })
+            for (auto blockMode : { "0", "1" })
+            {
+                auto benchmarkCase = makeCase ("host");
+                benchmarkCase.blockSize = blockSize;
+                benchmarkCase.oversampling = oversampling;
+                benchmarkCase.parameters.set ("blockMode", blockMode);
+                cases.add (benchmarkCase);
+            }
+
+    // Hosts announcing 512 and then sending something else
+    for (auto hostBlockSize : { 1, 37, 1000, 8192 })
+        for (auto blockMode : { "0", "1" })
+        {
+            auto benchmarkCase = makeCase ("host");
+            benchmarkCase.hostBlockSize = hostBlockSize;
+            benchmarkCase.oversampling = true;
+            benchmarkCase.parameters.set ("blockMode", blockMode);
+            cases.add (benchmarkCase);
+        }
+
+    // One gain row per block, as the compressor computes it for a linked or mono row
+    for (auto path : { "hardKnee", "softKnee", "table" })
+        for (auto knee : { "0", "6", "24" })
+        {
+            if (String (path) == "hardKnee" && String (knee) != "0")
+                continue;
+
+            auto benchmarkCase = makeCase ("gainComputer");
+            benchmarkCase.numChannels = 1;
+            benchmarkCase.parameters.set ("path", path);
+            benchmarkCase.parameters.set ("knee", knee);
+            cases.add (benchmarkCase);
+        }
+
+    for (auto signal : { Signal::noise, Signal::sine, Signal::transients })
+        for (auto oversampling : { false, true })
+        {
+            auto benchmarkCase = makeCase ("signal");
+            benchmarkCase.signal = signal;
+            benchmarkCase.oversampling = oversampling;
+            cases.add (benchmarkCase);
+        }
+
+    // Each parameter swept across its range with the others at their defaults
+    const std::pair<const char*, StringArray> sweeps[] =
+    {
+        { "attack",    { "0", "1", "20" } },
+        { "release",   { "0", "50", "200" } },
+        { "ratio",     { "1", "4", "30" } },
+        { "threshold", { "-50", "-20", "0" } },
+        { "gain",      { "-15", "0", "40" } },
+        { "link",      { "0", "1" } },
+        { "linkGroups", { "0", "1" } },
+        { "osFactor",  { "0", "1", "2", "3", "4" } },
+        { "osFilter",  { "0", "1" } },
+        { "osMode",    { "0", "1" } },
+        { "lookahead", { "0", "5", "20" } },
+        { "bands",     { "1", "3", "5" } },
+        { "detector",  { "0", "1", "2" } },
+        { "keyFilter", { "0", "1", "2" } },
+        { "mix",       { "0", "50", "100" } },
+        { "knee",      { "0", "6", "24" } },
+    };
+
+    for (auto& sweep : sweeps)
+        for (auto& value : sweep.second)
+        {
+            auto benchmarkCase = makeCase ("parameter");
+            benchmarkCase.oversampling = true;
+            benchmarkCase.parameters.set (sweep.first, value);
+            cases.add (benchmarkCase);
+        }
+
+    return cases;
+}
+
+//==============================================================================
+static const char* csvHeader = "key,group,sampleRate,blockSize,channels,oversampling,signal,parameters,nsPerSample,realTimeFactor,p50us,p99us,maxus,nsPerChannelSample,precision,dspKiB,hostBlockSize,latency,gainErrordB,metering";
+
+static String toCsvRow (const BenchmarkCase& benchmarkCase, const BenchmarkResult& result)
+{
+    String parameters;
+
+    for (auto& id : benchmarkCase.parameters.getAllKeys())
+        parameters << id << "=" << benchmarkCase.parameters[id] << " ";
+
+    String row;
+    row << benchmarkCase.getKey().quoted() << "," << benchmarkCase.group << "," << benchmarkCase.sampleRate << ","
+        << benchmarkCase.blockSize << "," << benchmarkCase.numChannels << "," << (benchmarkCase.oversampling ? 1 : 0) << ","
+        << getSignalName (benchmarkCase.signal) << "," << parameters.trim().quoted() << ","
+        << String (result.nsPerSample, 3) << "," << String (result.realTimeFactor, 2) << ","
+        << String (result.p50Micros, 2) << "," << String (result.p99Micros, 2) << "," << String (result.maxMicros, 2) << ","
+        << String (result.nsPerChannelSample, 3) << "," << getPrecisionName (benchmarkCase.precision) << ","
+        << String (result.dspMemoryBytes / 1024.0, 1) << ","
+        << benchmarkCase.getHostBlockSize() << "," << result.latencySamples << "," << String (result.gainErrordB, 5)
+        << "," << (benchmarkCase.metering ? 1 : 0);
+    return row;
+}
+
+static std::map<String, double> loadBaseline (const File& file)
+{
+    std::map<String, double> nsPerSampleByKey;
+    StringArray lines;
+    file.readLines (lines);
+
+    for (int i = 1; i < lines.size(); ++i)
+    {
+        StringArray columns;
+        columns.addTokens (lines[i], ",", "\"");
+
+        if (columns.size() >= 9)
+            nsPerSampleByKey[columns[0].unquoted()] = columns[8].getDoubleValue();
+    }
+
+    return nsPerSampleByKey;
+}
+
+int main (int argc, char* argv[])
+{
+    ScopedJuceInitialiser_GUI juceInitialiser;
+
+    ArgumentList args (argc, argv);
+    bool quick = false;
+    double secondsOfAudio = 2.0;
+    File outputFile, baselineFile;
+    String filter;
+
+    if (args.containsOption ("--verify"))
+        return runChecks() > 0 ? 1 : 0;
+
+    if (args.containsOption ("--editor"))
+    {
+        runEditorBenchmark (args.containsOption ("--editors") ? jmax (1, args.getValueForOption ("--editors").getIntValue()) : 40);
+        return 0;
+    }
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        const auto& arg = args[i];
+
+        if (arg == "--quick")
+            quick = true;
+        else if (arg == "--seconds" && i + 1 < args.size())
+            secondsOfAudio = jmax (0.1, args[++i].text.getDoubleValue());
+        else if (arg == "--output" && i + 1 < args.size())
+            outputFile = args[++i].resolveAsFile();
+        else if (arg == "--compare" && i + 1 < args.size())
+            baselineFile = args[++i].resolveAsFile();
+        else if (arg == "--filter" && i + 1 < args.size())
+            filter = args[++i].text;
+    }
+
+    const auto baseline = baselineFile.existsAsFile() ? loadBaseline (baselineFile) : std::map<String, double>();
+    StringArray rows { csvHeader };
+    int numRegressions = 0;
+
+    for (auto& benchmarkCase : createCases (quick))
+    {
+        const auto key = benchmarkCase.getKey();
+
+        if (filter.isNotEmpty() && ! key.contains (filter))
+            continue;
+
+        const auto result = benchmarkCase.group == "gainComputer" ? runGainComputer (benchmarkCase, secondsOfAudio)
+                                                                  : runCase (benchmarkCase, secondsOfAudio);
+        rows.add (toCsvRow (benchmarkCase, result));
+
+        std::cout << key << ": " << String (result.nsPerSample, 2) << " ns/sample ("
+                  << String (result.nsPerChannelSample, 2) << " per channel), "
+                  << String (result.realTimeFactor, 1) << "x real time, p50/p99/max "
+                  << String (result.p50Micros, 1) << "/" << String (result.p99Micros, 1) << "/" << String (result.maxMicros, 1) << " us, "
+                  << String (result.dspMemoryBytes / 1024.0, 1) << " KiB, " << result.latencySamples << " samples latency";
+
+        if (benchmarkCase.group == "gainComputer")
+            std::cout << ", worst error " << String (result.gainErrordB, 4) << " dB";
+
+        const auto previous = baseline.find (key);
+
+        if (previous != baseline.end() && previous->second > 0.0)
+        {
+            const auto change = (result.nsPerSample / previous->second - 1.0) * 100.0;
+            std::cout << " (" << (change >= 0.0 ? "+" : "") << String (change, 1) << "%" << (change > 10.0 ? ", REGRESSION" : "") << ")";
+            numRegressions += change > 10.0 ? 1 : 0;
+        }
+
+        std::cout << std::endl;
+    }
+
+    if (outputFile != File())
+        outputFile.replaceWithText (rows.joinIntoString ("\n") + "\n");
+
+    return numRegressions > 0 ? 1 : 0;
+}
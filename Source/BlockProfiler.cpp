@@ -0,0 +1,183 @@
+/*
+  ==============================================================================
+
+    This file contains the processor's built-in timing instrumentation.
+
+  ==============================================================================
+*/
+
+#include "BlockProfiler.h"
+
+#if COMPRESSOR_PROFILING
+
+//==============================================================================
+const char* BlockProfiler::getStageName (int stage) noexcept
+{
+    switch (stage)
+    {
+        case upsample:   return "upsample";
+        case compressor: return "compressor";
+        case gain:       return "gain";
+        case downsample: return "downsample";
+        case block:      return "block";
+        default:         break;
+    }
+
+    return "";
+}
+
+void BlockProfiler::prepare (double newSampleRate) noexcept
+{
+    sampleRate.store (newSampleRate, std::memory_order_relaxed);
+}
+
+void BlockProfiler::setBudgetFraction (double newFraction) noexcept
+{
+    budgetFraction.store (jlimit (0.01, 1.0, newFraction), std::memory_order_relaxed);
+}
+
+//==============================================================================
+BlockProfiler::ScopedBlock::ScopedBlock (BlockProfiler& p, int n) noexcept
+    : profiler (p.isEnabled() ? &p : nullptr), numSamples (n), start (0)
+{
+    if (profiler == nullptr)
+        return;
+
+    profiler->clearIfRequested();
+    start = Time::getHighResolutionTicks();
+}
+
+BlockProfiler::ScopedBlock::~ScopedBlock()
+{
+    if (profiler == nullptr)
+        return;
+
+    const auto ticks = Time::getHighResolutionTicks() - start;
+    profiler->record (block, ticks);
+
+    const auto budgetSeconds = profiler->getBudgetFraction() * numSamples / profiler->sampleRate.load (std::memory_order_relaxed);
+
+    if (Time::highResolutionTicksToSeconds (ticks) > budgetSeconds)
+        profiler->overruns.store (profiler->overruns.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+//==============================================================================
+int BlockProfiler::getBin (int64 ticks) noexcept
+{
+    const auto value = static_cast<uint32> (jlimit<int64> (0, 0xffffffff, ticks));
+
+    if (value < 4)
+        return static_cast<int> (value);
+
+    // The top set bit picks the octave and the two bits below it the quarter
+    auto octave = 2;
+
+    while (octave < 31 && (value >> (octave + 1)) != 0)
+        ++octave;
+
+    return octave * 4 + static_cast<int> ((value >> (octave - 2)) & 3);
+}
+
+int64 BlockProfiler::getBinUpperEdge (int bin) noexcept
+{
+    if (bin < 4)
+        return bin;
+
+    const auto octave = bin / 4;
+    return ((static_cast<int64> (5 + bin % 4)) << (octave - 2)) - 1;
+}
+
+void BlockProfiler::record (int stage, int64 ticks) noexcept
+{
+    auto& histogram = histograms[stage];
+    auto& bin = histogram.bins[getBin (ticks)];
+
+    bin.store (bin.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (ticks > histogram.maxTicks.load (std::memory_order_relaxed))
+        histogram.maxTicks.store (ticks, std::memory_order_relaxed);
+}
+
+void BlockProfiler::clearIfRequested() noexcept
+{
+    if (! resetRequested.exchange (false, std::memory_order_relaxed))
+        return;
+
+    for (auto& histogram : histograms)
+    {
+        for (auto& bin : histogram.bins)
+            bin.store (0, std::memory_order_relaxed);
+
+        histogram.maxTicks.store (0, std::memory_order_relaxed);
+    }
+
+    overruns.store (0, std::memory_order_relaxed);
+}
+
+//==============================================================================
+BlockProfiler::StageStatistics BlockProfiler::getStatistics (int stage) const noexcept
+{
+    const auto& histogram = histograms[stage];
+
+    // Work from one copy of the bins, so the percentiles agree with each other
+    // even if the audio thread records while we read
+    uint32 counts[numBins];
+    uint64 total = 0;
+
+    for (int bin = 0; bin < numBins; ++bin)
+    {
+        counts[bin] = histogram.bins[bin].load (std::memory_order_relaxed);
+        total += counts[bin];
+    }
+
+    StageStatistics statistics;
+    statistics.count = total;
+    statistics.maxMicros = Time::highResolutionTicksToSeconds (histogram.maxTicks.load (std::memory_order_relaxed)) * 1.0e6;
+
+    if (total == 0)
+        return statistics;
+
+    const auto percentile = [&] (double p)
+    {
+        const auto rank = static_cast<uint64> (std::ceil (p * static_cast<double> (total)));
+        uint64 seen = 0;
+
+        for (int bin = 0; bin < numBins; ++bin)
+        {
+            seen += counts[bin];
+
+            if (seen >= rank)
+                return jmin (statistics.maxMicros, Time::highResolutionTicksToSeconds (getBinUpperEdge (bin)) * 1.0e6);
+        }
+
+        return statistics.maxMicros;
+    };
+
+    statistics.p50Micros = percentile (0.5);
+    statistics.p99Micros = percentile (0.99);
+    return statistics;
+}
+
+String BlockProfiler::createReport() const
+{
+    String report;
+    report << "stage,count,p50us,p99us,maxus" << newLine;
+
+    for (int stage = 0; stage < numStages; ++stage)
+    {
+        const auto statistics = getStatistics (stage);
+        report << getStageName (stage) << "," << String (statistics.count) << ","
+               << String (statistics.p50Micros, 2) << "," << String (statistics.p99Micros, 2) << ","
+               << String (statistics.maxMicros, 2) << newLine;
+    }
+
+    report << "overruns," << String (getNumOverruns()) << ",budget," << String (getBudgetFraction(), 2) << newLine;
+    return report;
+}
+
+bool BlockProfiler::writeReport (const File& file) const
+{
+    return file.replaceWithText (createReport());
+}
+
+#endif
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    This file contains the processor's built-in timing instrumentation: per
+    stage histograms of processBlock and a count of blocks that ran over a
+    share of their real-time budget.
+
+    It is compiled in when COMPRESSOR_PROFILING is 1, which is the default in
+    debug builds only. Release builds can opt in by defining it to 1. When it
+    is 0 the class and every COMPRESSOR_PROFILE_* macro disappear. When it is
+    compiled in but switched off, each measured scope costs one relaxed
+    atomic load.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#ifndef COMPRESSOR_PROFILING
+ #if JUCE_DEBUG
+  #define COMPRESSOR_PROFILING 1
+ #else
+  #define COMPRESSOR_PROFILING 0
+ #endif
+#endif
+
+#if COMPRESSOR_PROFILING
+
+//==============================================================================
+/** Lock-free timing histograms, written by the audio thread and read by any other.
+
+    Durations come from Time::getHighResolutionTicks(), which is the finest
+    counter JUCE exposes on every platform (nanoseconds on macOS and Linux).
+    They are binned in quarter octaves, so p50 and p99 are upper bounds within
+    25% of the true value. The maximum is exact.
+*/
+class BlockProfiler
+{
+public:
+    enum Stage
+    {
+        upsample = 0,
+        compressor,
+        gain,
+        downsample,
+        block,
+        numStages
+    };
+
+    static const char* getStageName (int stage) noexcept;
+
+    //==============================================================================
+    /** Sets the rate the block budget is worked out from. Safe to call while running. */
+    void prepare (double sampleRate) noexcept;
+
+    void setEnabled (bool shouldBeEnabled) noexcept     { enabled.store (shouldBeEnabled, std::memory_order_relaxed); }
+    bool isEnabled() const noexcept                     { return enabled.load (std::memory_order_relaxed); }
+
+    /** A block counts as an overrun once it takes longer than this share of its duration. */
+    void setBudgetFraction (double newFraction) noexcept;
+    double getBudgetFraction() const noexcept           { return budgetFraction.load (std::memory_order_relaxed); }
+
+    /** Asks the audio thread to clear every histogram at the start of its next block. */
+    void reset() noexcept                               { resetRequested.store (true, std::memory_order_relaxed); }
+
+    //==============================================================================
+    /** Times one stage from construction to destruction. */
+    class ScopedStage
+    {
+    public:
+        ScopedStage (BlockProfiler* p, Stage s) noexcept
+            : profiler (p != nullptr && p->isEnabled() ? p : nullptr), stage (s),
+              start (profiler != nullptr ? Time::getHighResolutionTicks() : 0)
+        {
+        }
+
+        ~ScopedStage()
+        {
+            if (profiler != nullptr)
+                profiler->record (stage, Time::getHighResolutionTicks() - start);
+        }
+
+    private:
+        BlockProfiler* profiler;
+        Stage stage;
+        int64 start;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedStage)
+    };
+
+    /** Times a whole processBlock() call and checks it against the block's budget. */
+    class ScopedBlock
+    {
+    public:
+        ScopedBlock (BlockProfiler& p, int n) noexcept;
+        ~ScopedBlock();
+
+    private:
+        BlockProfiler* profiler;
+        int numSamples;
+        int64 start;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedBlock)
+    };
+
+    //==============================================================================
+    struct StageStatistics
+    {
+        uint64 count = 0;
+        double p50Micros = 0.0, p99Micros = 0.0, maxMicros = 0.0;
+    };
+
+    /** Reads a consistent-enough view of the histograms. Safe from any thread. */
+    StageStatistics getStatistics (int stage) const noexcept;
+    uint64 getNumOverruns() const noexcept              { return overruns.load (std::memory_order_relaxed); }
+
+    /** One line per stage plus the overrun count, for the editor's dump button. */
+    String createReport() const;
+    bool writeReport (const File& file) const;
+
+private:
+    // Four bins per octave of ticks, covering 1 tick up to 2^32
+    static constexpr int numBins = 32 * 4;
+
+    static int getBin (int64 ticks) noexcept;
+    static int64 getBinUpperEdge (int bin) noexcept;
+
+    void record (int stage, int64 ticks) noexcept;
+    void clearIfRequested() noexcept;
+
+    //==============================================================================
+    // The audio thread is the only writer, so counts are loaded and stored rather than fetch_added
+    struct Histogram
+    {
+        std::atomic<uint32> bins[numBins] {};
+        std::atomic<int64> maxTicks { 0 };
+    };
+
+    Histogram histograms[numStages];
+    std::atomic<uint64> overruns { 0 };
+
+    std::atomic<bool> enabled { false }, resetRequested { false };
+    std::atomic<double> budgetFraction { 0.5 }, sampleRate { 44100.0 };
+};
+
+#define COMPRESSOR_PROFILE_STAGE(profiler, stage) \
+    const BlockProfiler::ScopedStage JUCE_JOIN_MACRO (profiledStage, __LINE__) (profiler, BlockProfiler::stage)
+
+#define COMPRESSOR_PROFILE_BLOCK(profiler, numSamples) \
+    const BlockProfiler::ScopedBlock JUCE_JOIN_MACRO (profiledBlock, __LINE__) (profiler, numSamples)
+
+#else
+
+class BlockProfiler;
+
+#define COMPRESSOR_PROFILE_STAGE(profiler, stage)
+#define COMPRESSOR_PROFILE_BLOCK(profiler, numSamples)
+
+#endif
@@ -0,0 +1,769 @@
+/*
+  ==============================================================================
+
+    This file contains the compressor's DSP chain, templated on sample type.
+
+  ==============================================================================
+*/
+
+#include "CompressorEngine.h"
+
+//==============================================================================
+void CompressorParameters::attach (AudioProcessorValueTreeState& state)
+{
+    attack.attach (state, "attack");
+    release.attach (state, "release");
+    ratio.attach (state, "ratio");
+    threshold.attach (state, "threshold");
+    gain.attach (state, "gain");
+    link.attach (state, "link");
+    linkGroups.attach (state, "linkGroups");
+    oversamplingFactor.attach (state, "osFactor");
+    oversamplingFilter.attach (state, "osFilter");
+    oversamplingMode.attach (state, "osMode");
+    lookahead.attach (state, "lookahead");
+    bands.attach (state, "bands");
+    detector.attach (state, "detector");
+    rmsWindow.attach (state, "rmsWindow");
+    keyFilter.attach (state, "keyFilter");
+    keyFrequency.attach (state, "keyFreq");
+    keyListen.attach (state, "keyListen");
+    mix.attach (state, "mix");
+    knee.attach (state, "knee");
+    bypass.attach (state, "bypass");
+    blockMode.attach (state, "blockMode");
+
+    for (int i = 0; i < maxCrossovers; ++i)
+        crossovers[i].attach (state, "xover" + String (i + 1));
+
+    customLinkGroups.attach (state, "customLinkGroups");
+
+    for (int channel = 0; channel < maxChannels; ++channel)
+        channelLinkGroups[channel].attach (state, "linkGroup" + String (channel + 1));
+
+    for (int band = 0; band < maxBands; ++band)
+    {
+        const String index (band + 1);
+        bandParameters[band].attack.attach (state, "attack" + index);
+        bandParameters[band].release.attach (state, "release" + index);
+        bandParameters[band].ratio.attach (state, "ratio" + index);
+        bandParameters[band].threshold.attach (state, "threshold" + index);
+    }
+}
+
+void CompressorParameters::invalidate() noexcept
+{
+    for (auto* parameter : { &attack, &release, &ratio, &threshold, &gain, &link, &linkGroups,
+                             &oversamplingFactor, &oversamplingFilter, &oversamplingMode,
+                             &lookahead, &bands, &detector, &rmsWindow, &keyFilter, &keyFrequency, &keyListen, &mix, &knee, &bypass, &blockMode, &customLinkGroups })
+        parameter->invalidate();
+
+    for (auto& crossover : crossovers)
+        crossover.invalidate();
+
+    for (auto& channelLinkGroup : channelLinkGroups)
+        channelLinkGroup.invalidate();
+
+    for (auto& band : bandParameters)
+        for (auto* parameter : { &band.attack, &band.release, &band.ratio, &band.threshold })
+            parameter->invalidate();
+}
+
+//==============================================================================
+template <typename SampleType>
+void CompressorEngine<SampleType>::prepare (double sampleRate, int samplesPerBlock, int newNumChannels,
+                                            int newNumSidechainChannels, int newSidechainChannelOffset,
+                                            const int* newZoneLinkGroups, WorkerPool* newWorkerPool,
+                                            MemoryArena& arena, int oversamplingOrder)
+{
+    currentSampleRate = sampleRate;
+    currentBlockSize = samplesPerBlock;
+    numChannels = static_cast<size_t> (newNumChannels);
+    workerPool = newWorkerPool;
+    maxOrder = jlimit (0, maxOversamplingOrder, oversamplingOrder);
+
+    // Everything downstream of the oversamplers is sized for the largest factor prepared for
+    dsp::ProcessSpec spec;
+    spec.sampleRate = sampleRate;
+    spec.maximumBlockSize = static_cast<uint32> (samplesPerBlock << maxOrder);
+    spec.numChannels = static_cast<uint32> (newNumChannels);
+
+    // The true-peak detector's lag is made up with more lookahead
+    const int maxLookaheadSamples = static_cast<int> (std::ceil (maxLookaheadMs * 0.001 * sampleRate)) + TruePeakDetector::latencySamples;
+    const int maxRmsWindowSamples = static_cast<int> (std::ceil (maxRmsWindowMs * 0.001 * sampleRate));
+
+    compressor.prepare (arena, spec, maxLookaheadSamples << maxOrder, maxRmsWindowSamples << maxOrder);
+
+    crossover.prepare (arena, spec);
+
+    for (auto& bandCompressor : bandCompressors)
+        bandCompressor.prepare (arena, spec, maxLookaheadSamples << maxOrder, maxRmsWindowSamples << maxOrder);
+
+    bandStorage = allocateBlock (arena, numChannels * maxBands, spec.maximumBlockSize);
+    dryStorage = allocateBlock (arena, numChannels, static_cast<size_t> (samplesPerBlock));
+
+    // Nothing on the key path allocates once playing, whether or not a sidechain is connected
+    numSidechainChannels = newNumSidechainChannels;
+    sidechainChannelOffset = newSidechainChannelOffset;
+    keyStorage = allocateBlock (arena, numChannels, static_cast<size_t> (samplesPerBlock));
+    keyChannels = arena.allocate<const SampleType*> (numChannels);
+    keyFilter.prepare ({ sampleRate, static_cast<uint32> (samplesPerBlock), static_cast<uint32> (jmax (numSidechainChannels, newNumChannels)) });
+
+    zoneLinkGroups = arena.allocate<int> (numChannels);
+    std::copy (newZoneLinkGroups, newZoneLinkGroups + numChannels, zoneLinkGroups);
+    customLinkGroups = arena.allocate<int> (numChannels);
+
+    // The oversampling stages only depend on the channel count, so a re-prepare
+    // keeps them and just makes sure their buffers fit the block size
+    if (oversamplers.size() != 2 * maxOrder || oversamplingChannels != numChannels)
+    {
+        oversamplers.clear();
+        dryOversamplers.clear();
+        keyOversamplers.clear();
+        detectorOversamplers.clear();
+        oversamplingChannels = numChannels;
+
+        for (auto filter : { Oversampling::filterHalfBandPolyphaseIIR, Oversampling::filterHalfBandFIREquiripple })
+        {
+            const bool isMaxQuality = filter == Oversampling::filterHalfBandFIREquiripple;
+
+            for (int order = 1; order <= maxOrder; ++order)
+            {
+                oversamplers.add (new Oversampling (numChannels, static_cast<size_t> (order), filter, isMaxQuality, true));
+                dryOversamplers.add (new Oversampling (numChannels, static_cast<size_t> (order), filter, isMaxQuality, true));
+                keyOversamplers.add (new Oversampling (numChannels, static_cast<size_t> (order), filter, isMaxQuality, true));
+            }
+        }
+
+        for (int order = 1; order <= maxOrder; ++order)
+            detectorOversamplers.add (new Oversampling (numChannels, static_cast<size_t> (order), Oversampling::filterHalfBandPolyphaseIIR, false));
+    }
+
+    maxLatencySamples = maxLookaheadSamples;
+
+    for (auto* stage : oversamplers)
+    {
+        stage->initProcessing (static_cast<size_t> (samplesPerBlock));
+        maxLatencySamples = jmax (maxLatencySamples, maxLookaheadSamples + roundToInt (stage->getLatencyInSamples()));
+    }
+
+    for (auto* stages : { &dryOversamplers, &keyOversamplers })
+        for (auto* stage : *stages)
+            stage->initProcessing (static_cast<size_t> (samplesPerBlock));
+
+    // Detector-only mode holds the audio back by the detector stage's latency on top of the lookahead
+    int maxDetectorLatencySamples = 0;
+
+    for (auto* stage : detectorOversamplers)
+    {
+        stage->initProcessing (static_cast<size_t> (samplesPerBlock));
+        maxDetectorLatencySamples = jmax (maxDetectorLatencySamples, roundToInt (stage->getLatencyInSamples()));
+    }
+
+    baseRateDelay.prepare (arena, newNumChannels, maxLookaheadSamples + maxDetectorLatencySamples);
+    maxLatencySamples = jmax (maxLatencySamples, maxLookaheadSamples + maxDetectorLatencySamples);
+
+    // The dry signal waits for the compressed one, however late any setting makes it
+    outputMixer.prepare (arena, sampleRate, newNumChannels, samplesPerBlock, maxLatencySamples);
+
+    oversampling = nullptr;
+    dryOversampling = nullptr;
+    detectorOversampling = nullptr;
+    keyOversampling = nullptr;
+    dryChainRunning = false;
+    currentOversamplingOrder = -1;
+    currentOversamplingFilter = -1;
+    currentOversamplingMode = -1;
+    currentNumBands = -1;
+    currentLookaheadSamples = -1;
+    detectorLagSamples = 0;
+    silentSamples = 0;
+    idle = false;
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::release()
+{
+    oversamplers.clear();
+    dryOversamplers.clear();
+    keyOversamplers.clear();
+    detectorOversamplers.clear();
+    oversampling = dryOversampling = detectorOversampling = keyOversampling = nullptr;
+    oversamplingChannels = 0;
+
+    compressor.release();
+
+    for (auto& bandCompressor : bandCompressors)
+        bandCompressor.release();
+}
+
+template <typename SampleType>
+size_t CompressorEngine<SampleType>::getExternalMemoryBytes() const noexcept
+{
+    // Each oversampling stage buffers a block at its own rate, so an order n
+    // stage holds 2 + 4 + ... + 2^n blocks. The filter states are negligible.
+    size_t numBlocks = 0;
+
+    for (auto* stages : { &oversamplers, &dryOversamplers, &keyOversamplers, &detectorOversamplers })
+        for (int i = 0; i < stages->size(); ++i)
+            numBlocks += (static_cast<size_t> (2) << (i % maxOrder + 1)) - 2;
+
+    auto tableBytes = compressor.getExternalMemoryBytes();
+
+    for (auto& bandCompressor : bandCompressors)
+        tableBytes += bandCompressor.getExternalMemoryBytes();
+
+    return numBlocks * numChannels * static_cast<size_t> (currentBlockSize) * sizeof (SampleType) + tableBytes;
+}
+
+template <typename SampleType>
+typename CompressorEngine<SampleType>::Block CompressorEngine<SampleType>::allocateBlock (MemoryArena& arena, size_t numBlockChannels, size_t numSamples)
+{
+    auto** channels = arena.allocate<SampleType*> (numBlockChannels);
+
+    for (size_t channel = 0; channel < numBlockChannels; ++channel)
+        channels[channel] = arena.allocate<SampleType> (numSamples);
+
+    return Block (channels, numBlockChannels, numSamples);
+}
+
+//==============================================================================
+template <typename SampleType>
+void CompressorEngine<SampleType>::updateParameters (CompressorParameters& parameters)
+{
+    // Only push values that moved, so the ballistics aren't recomputed every block
+    if (parameters.gain.changed())
+        outputMixer.setGainDecibels (static_cast<SampleType> (parameters.gain.get()));
+
+    if (parameters.mix.changed())
+        outputMixer.setMix (static_cast<SampleType> (parameters.mix.get() * 0.01f));
+
+    if (parameters.attack.changed())
+        compressor.setAttack (parameters.attack.get());
+
+    if (parameters.release.changed())
+        compressor.setRelease (parameters.release.get());
+
+    if (parameters.ratio.changed())
+        compressor.setRatio (parameters.ratio.get());
+
+    if (parameters.threshold.changed())
+        compressor.setThreshold (parameters.threshold.get());
+
+    // The knee is the same for every band
+    if (parameters.knee.changed())
+    {
+        compressor.setKnee (parameters.knee.get());
+
+        for (auto& bandCompressor : bandCompressors)
+            bandCompressor.setKnee (parameters.knee.get());
+    }
+
+    // Every band keys from the same kind of detector as the full-band compressor
+    if (parameters.detector.changed())
+    {
+        const auto mode = static_cast<typename Compressor::DetectorMode> (parameters.detector.getIndex());
+        compressor.setDetectorMode (mode);
+
+        for (auto& bandCompressor : bandCompressors)
+            bandCompressor.setDetectorMode (mode);
+    }
+
+    if (parameters.rmsWindow.changed())
+    {
+        compressor.setRmsWindow (parameters.rmsWindow.get());
+
+        for (auto& bandCompressor : bandCompressors)
+            bandCompressor.setRmsWindow (parameters.rmsWindow.get());
+    }
+
+    if (parameters.keyFilter.changed())
+    {
+        currentKeyFilterType = parameters.keyFilter.getIndex();
+
+        if (currentKeyFilterType > 0)
+            keyFilter.setType (currentKeyFilterType == 1 ? dsp::StateVariableTPTFilterType::highpass : dsp::StateVariableTPTFilterType::bandpass);
+    }
+
+    if (parameters.keyFrequency.changed())
+        keyFilter.setCutoffFrequency (static_cast<SampleType> (parameters.keyFrequency.get()));
+
+    const bool linkChanged = parameters.link.changed();
+    bool linkGroupsChanged = parameters.linkGroups.changed();
+    linkGroupsChanged = parameters.customLinkGroups.changed() || linkGroupsChanged;
+
+    // Every channel's group is read, so none is left reporting a stale change
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        linkGroupsChanged = parameters.channelLinkGroups[channel].changed() || linkGroupsChanged;
+
+    if (linkChanged || linkGroupsChanged)
+        applyLinkGroups (parameters);
+
+    // Bands that are switched off still follow their parameters, so they come back in tune
+    for (int i = 0; i < CompressorParameters::maxCrossovers; ++i)
+        if (parameters.crossovers[i].changed())
+            crossover.setCrossoverFrequency (i, parameters.crossovers[i].get());
+
+    for (int band = 0; band < maxBands; ++band)
+    {
+        auto& bandParameters = parameters.bandParameters[band];
+        auto& bandCompressor = bandCompressors[band];
+
+        if (bandParameters.attack.changed())
+            bandCompressor.setAttack (bandParameters.attack.get());
+
+        if (bandParameters.release.changed())
+            bandCompressor.setRelease (bandParameters.release.get());
+
+        if (bandParameters.ratio.changed())
+            bandCompressor.setRatio (bandParameters.ratio.get());
+
+        if (bandParameters.threshold.changed())
+            bandCompressor.setThreshold (bandParameters.threshold.get());
+    }
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::applyLinkGroups (const CompressorParameters& parameters)
+{
+    const bool link = parameters.link.getBool();
+    const bool custom = parameters.customLinkGroups.getBool();
+    const bool zones = parameters.linkGroups.getIndex() == 1;
+
+    // Custom groups take over from the scheme while they are switched on
+    if (link && custom)
+        for (size_t channel = 0; channel < numChannels; ++channel)
+            customLinkGroups[channel] = jmax (0, parameters.channelLinkGroups[channel].getIndex()) - 1;
+
+    auto apply = [&] (Compressor& target)
+    {
+        if (link && custom)
+            target.setLinkGroups (customLinkGroups);
+        else if (link && zones)
+            target.setLinkGroups (zoneLinkGroups);
+        else
+            target.setLinkMode (link ? Compressor::LinkMode::linked : Compressor::LinkMode::unlinked);
+    };
+
+    apply (compressor);
+
+    for (auto& bandCompressor : bandCompressors)
+        apply (bandCompressor);
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::updateOversampling (const CompressorParameters& parameters, bool oversamplingEnabled)
+{
+    const int order = oversamplingEnabled ? jmin (maxOrder, parameters.oversamplingFactor.getIndex()) : 0;
+    const int filter = parameters.oversamplingFilter.getIndex();
+    const int mode = parameters.oversamplingMode.getIndex();
+    const int numBands = parameters.bands.getIndex();
+
+    if (order == currentOversamplingOrder && filter == currentOversamplingFilter && mode == currentOversamplingMode && numBands == currentNumBands)
+        return;
+
+    currentOversamplingOrder = order;
+    currentOversamplingFilter = filter;
+    currentOversamplingMode = mode;
+    currentNumBands = numBands;
+
+    // In detector-only mode just the gain computation is oversampled; the audio stays at the base rate.
+    // The band split has to happen on the audio itself, so multiband always runs the full path.
+    const bool detectorOnly = mode == 1 && numBands == 1;
+
+    oversampling = (order > 0 && ! detectorOnly) ? oversamplers[filter * maxOrder + order - 1] : nullptr;
+    dryOversampling = (order > 0 && ! detectorOnly) ? dryOversamplers[filter * maxOrder + order - 1] : nullptr;
+    detectorOversampling = (order > 0 && detectorOnly) ? detectorOversamplers[order - 1] : nullptr;
+
+    // The full path upsamples the key with the audio's filter, so the detector hears it
+    // exactly as late as the audio it is applied to
+    keyOversampling = (order > 0 && ! detectorOnly) ? keyOversamplers[filter * maxOrder + order - 1] : nullptr;
+
+    for (auto* stage : { oversampling, detectorOversampling, keyOversampling })
+        if (stage != nullptr)
+            stage->reset();
+
+    // The compressor runs at the oversampled rate, so retune it without reallocating
+    const double processingRate = currentSampleRate * (1 << order);
+
+    compressor.setSampleRate (processingRate);
+    compressor.reset();
+
+    // Only the detector-only path runs this delay, so it holds whatever that path last saw
+    baseRateDelay.reset();
+
+    crossover.setSampleRate (processingRate);
+    crossover.setNumBands (numBands);
+    crossover.reset();
+
+    for (auto& bandCompressor : bandCompressors)
+    {
+        bandCompressor.setSampleRate (processingRate);
+        bandCompressor.reset();
+    }
+
+    // The latency is about to change, so the captured dry input no longer lines up
+    outputMixer.reset();
+    dryChainRunning = false;
+
+    // The detector stage only upsamples, but what it reports covers its way down too.
+    // Delaying the audio by all of it just adds a sample or two of lookahead.
+    if (oversampling != nullptr)
+        oversamplingLatency = roundToInt (oversampling->getLatencyInSamples());
+    else if (detectorOversampling != nullptr)
+        oversamplingLatency = roundToInt (detectorOversampling->getLatencyInSamples());
+    else
+        oversamplingLatency = 0;
+
+    // the lookahead window is counted in oversampled samples, so it has to follow the factor
+    currentLookaheadSamples = -1;
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::updateLookahead (const CompressorParameters& parameters)
+{
+    const int lookaheadSamples = roundToInt (parameters.lookahead.get() * 0.001 * currentSampleRate);
+
+    // The true-peak detector trails its input by a few samples at whatever rate it
+    // runs. Holding the audio back as many base-rate samples covers that at every
+    // factor, and keeps the direct path from ever running later than the oversampled one.
+    const int lagSamples = compressor.getDetectorLatency();
+
+    if (lookaheadSamples == currentLookaheadSamples && lagSamples == detectorLagSamples)
+        return;
+
+    currentLookaheadSamples = lookaheadSamples;
+    detectorLagSamples = lagSamples;
+
+    // Whole base-rate samples keep the reported latency exact at every factor
+    const int delaySamples = (lookaheadSamples + lagSamples) << currentOversamplingOrder;
+    compressor.setLookahead (delaySamples);
+
+    for (auto& bandCompressor : bandCompressors)
+        bandCompressor.setLookahead (delaySamples);
+
+    baseRateDelay.setDelay (detectorOversampling != nullptr ? lookaheadSamples + lagSamples + oversamplingLatency : 0);
+
+    // The dry copy of the oversampling stage makes up that part of the delay itself
+    outputMixer.setDelay (getLatencySamples() - (dryOversampling != nullptr ? oversamplingLatency : 0));
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::updateTail (const CompressorParameters& parameters) noexcept
+{
+    auto releaseMs = parameters.release.get();
+
+    if (currentNumBands > 1)
+        for (int band = 0; band < currentNumBands; ++band)
+            releaseMs = jmax (releaseMs, parameters.bandParameters[band].release.get());
+
+    // Make-up gain would lift anything at the threshold back into earshot, so the input
+    // has to be that much quieter. Cuts leave it as it is: the output only gets quieter.
+    const auto makeUpGain = jmax (1.0, Decibels::decibelsToGain (static_cast<double> (parameters.gain.get())));
+    const auto silence = silenceThreshold / makeUpGain;
+    silenceLevel = static_cast<SampleType> (silence);
+
+    // The envelope falls by e^(2 pi) per release time, so falling to silence takes ln(1 / silence) / (2 pi) of them
+    const auto releaseSeconds = releaseMs * 0.001 * std::log (1.0 / silence) / MathConstants<double>::twoPi;
+    const auto rmsSeconds = parameters.detector.getIndex() == 1 ? parameters.rmsWindow.get() * 0.001 : 0.0;
+
+    tailSamples = getLatencySamples() + static_cast<int64> (std::ceil ((releaseSeconds + rmsSeconds + filterTailMs * 0.001) * currentSampleRate));
+}
+
+//==============================================================================
+template <typename SampleType>
+void CompressorEngine<SampleType>::process (AudioBuffer<SampleType>& buffer, bool listening, bool isNonRealtime) noexcept
+{
+    nonRealtime = isNonRealtime;
+
+    // Idle through long silences. The states are flushed on the way in, so when
+    // signal returns the chain starts from zero exactly as after prepare().
+    const auto numSamples = buffer.getNumSamples();
+    silentSamples = isSilent (buffer) ? silentSamples + numSamples : 0;
+
+    // The buffer also carries the sidechain channels, which are never part of the output
+    auto block = Block (buffer).getSubsetChannelBlock (0, numChannels);
+
+    if (silentSamples > tailSamples)
+    {
+        if (! idle)
+            reset();
+
+        // Still captured, so the dry signal is exact from the first block after idling
+        idle = true;
+        outputMixer.pushDry (block);
+
+        for (size_t channel = 0; channel < numChannels; ++channel)
+            buffer.clear (static_cast<int> (channel), 0, numSamples);
+
+        return;
+    }
+
+    idle = false;
+
+    const bool hasKey = prepareKey (buffer, block);
+
+    // Listening replaces the output with the key, which goes through the dry
+    // signal's delay and filters so it stays lined up with everything else.
+    // Otherwise oversample the whole chain, just the detector, or nothing.
+    if (listening)
+    {
+        outputMixer.pushDry (hasKey ? keyBlock : ConstBlock (block));
+
+        COMPRESSOR_PROFILE_STAGE (profiler, gain);
+        readDry (block);
+        return;
+    }
+
+    outputMixer.pushDry (block);
+
+    if (oversampling != nullptr)
+    {
+        Block osBlock;
+        ConstBlock osKey;
+
+        {
+            COMPRESSOR_PROFILE_STAGE (profiler, upsample);
+            osBlock = oversampling->processSamplesUp (block);
+
+            if (hasKey)
+                osKey = keyOversampling->processSamplesUp (keyBlock);
+        }
+
+        processChain (Context (osBlock), hasKey ? &osKey : nullptr);
+
+        COMPRESSOR_PROFILE_STAGE (profiler, downsample);
+        oversampling->processSamplesDown (block);
+    }
+    else if (detectorOversampling != nullptr)
+    {
+        // compute the gain curve from an upsampled copy, then apply it at the base rate
+        Block detectorBlock;
+
+        {
+            COMPRESSOR_PROFILE_STAGE (profiler, upsample);
+            detectorBlock = hasKey ? detectorOversampling->processSamplesUp (keyBlock)
+                                   : detectorOversampling->processSamplesUp (block);
+        }
+
+        {
+            COMPRESSOR_PROFILE_STAGE (profiler, compressor);
+            compressor.computeGains (detectorBlock, getChannelWorkers (detectorBlock.getNumSamples()));
+            baseRateDelay.process (block);
+            compressor.applyGainsDecimated (block, static_cast<size_t> (1 << currentOversamplingOrder));
+        }
+    }
+    else
+    {
+        processChain (Context (block), hasKey ? &keyBlock : nullptr);
+    }
+
+    // Gain and mix in one pass at the base rate, where the dry signal is
+    COMPRESSOR_PROFILE_STAGE (profiler, gain);
+
+    if (outputMixer.isFullyWet() || ! dryNeedsFilters())
+    {
+        dryChainRunning = false;
+        outputMixer.process (block);
+    }
+    else
+    {
+        auto dry = dryStorage.getSubBlock (0, block.getNumSamples());
+        readDry (dry);
+
+        const ConstBlock filteredDry (dry);
+        outputMixer.process (block, &filteredDry);
+    }
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::readDry (Block& dry) noexcept
+{
+    outputMixer.readDry (dry);
+
+    if (! dryNeedsFilters())
+    {
+        dryChainRunning = false;
+        return;
+    }
+
+    // The chain only runs while some dry signal is heard, so its states are
+    // cleared whenever it starts rather than holding whatever it last saw
+    if (! dryChainRunning)
+    {
+        if (dryOversampling != nullptr)
+            dryOversampling->reset();
+
+        crossover.resetAllpass();
+        dryChainRunning = true;
+    }
+
+    // Whole-sample delays commute with the filters, so the lookahead already
+    // applied by the ring leaves only the filters' phase to match
+    if (dryOversampling != nullptr)
+    {
+        auto osDry = dryOversampling->processSamplesUp (dry);
+
+        if (currentNumBands > 1)
+            crossover.processAllpass (osDry);
+
+        dryOversampling->processSamplesDown (dry);
+    }
+    else
+    {
+        crossover.processAllpass (dry);
+    }
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::processChain (const Context& context, const ConstBlock* key) noexcept
+{
+    COMPRESSOR_PROFILE_STAGE (profiler, compressor);
+
+    if (currentNumBands > 1)
+        processBands (context.getOutputBlock(), key);
+    else if (key != nullptr)
+        compressor.processWithKey (context, *key, getChannelWorkers (context.getOutputBlock().getNumSamples()));
+    else
+        compressor.process (context, getChannelWorkers (context.getOutputBlock().getNumSamples()));
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::processBands (Block& block, const ConstBlock* key) noexcept
+{
+    const auto numSamples = block.getNumSamples();
+
+    Block bands (bandStorage);
+
+    for (int band = 0; band < currentNumBands; ++band)
+        bandBlocks[band] = bands.getSubsetChannelBlock (static_cast<size_t> (band) * numChannels, numChannels).getSubBlock (0, numSamples);
+
+    crossover.process (block, bandBlocks);
+
+    // An external key drives every band's detector with the full-band key signal
+    bandKey = key;
+
+    auto compressBand = [] (void* context, int band)
+    {
+        auto& engine = *static_cast<CompressorEngine*> (context);
+        const Context bandContext (engine.bandBlocks[band]);
+
+        if (engine.bandKey != nullptr)
+            engine.bandCompressors[band].processWithKey (bandContext, *engine.bandKey);
+        else
+            engine.bandCompressors[band].process (bandContext);
+    };
+
+    if (nonRealtime && numSamples >= minSamplesForWorkers && workerPool != nullptr && workerPool->getNumWorkers() > 0)
+    {
+        workerPool->run (currentNumBands, compressBand, this);
+    }
+    else
+    {
+        for (int band = 0; band < currentNumBands; ++band)
+            compressBand (this, band);
+    }
+
+    block.copyFrom (bandBlocks[0]);
+
+    for (int band = 1; band < currentNumBands; ++band)
+        block.add (bandBlocks[band]);
+}
+
+template <typename SampleType>
+bool CompressorEngine<SampleType>::prepareKey (AudioBuffer<SampleType>& buffer, const Block& mainBlock) noexcept
+{
+    // With no sidechain and no key filter the detector just reads the main input
+    if (numSidechainChannels == 0 && currentKeyFilterType == 0)
+        return false;
+
+    const auto numSamples = mainBlock.getNumSamples();
+    Block source;
+
+    if (numSidechainChannels > 0)
+    {
+        // the sidechain channels are ours to overwrite, so the filter runs on them in place
+        source = Block (buffer).getSubsetChannelBlock (static_cast<size_t> (sidechainChannelOffset), static_cast<size_t> (numSidechainChannels));
+    }
+    else
+    {
+        source = keyStorage.getSubBlock (0, numSamples);
+        source.copyFrom (mainBlock);
+    }
+
+    if (currentKeyFilterType > 0)
+        keyFilter.process (Context (source));
+
+    // A mono key feeds every channel's detector
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        keyChannels[channel] = source.getChannelPointer (source.getNumChannels() == 1 ? 0 : channel);
+
+    keyBlock = ConstBlock (keyChannels, numChannels, numSamples);
+    return true;
+}
+
+template <typename SampleType>
+WorkerPool* CompressorEngine<SampleType>::getChannelWorkers (size_t numSamples) const noexcept
+{
+    // As with the bands, the audio thread never waits on other threads while playing live
+    if (! nonRealtime || workerPool == nullptr || workerPool->getNumWorkers() == 0)
+        return nullptr;
+
+    return numSamples * numChannels >= minChannelSamplesForWorkers ? workerPool : nullptr;
+}
+
+//==============================================================================
+template <typename SampleType>
+bool CompressorEngine<SampleType>::isSilent (const AudioBuffer<SampleType>& buffer) const noexcept
+{
+    // Sidechain channels count too: a keyed compressor must react the moment its key starts
+    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        if (buffer.getMagnitude (channel, 0, buffer.getNumSamples()) > silenceLevel)
+            return false;
+
+    return true;
+}
+
+template <typename SampleType>
+void CompressorEngine<SampleType>::reset() noexcept
+{
+    for (auto* stage : { oversampling, dryOversampling, detectorOversampling, keyOversampling })
+        if (stage != nullptr)
+            stage->reset();
+
+    dryChainRunning = false;
+    compressor.reset();
+    crossover.reset();
+
+    for (auto& bandCompressor : bandCompressors)
+        bandCompressor.reset();
+
+    keyFilter.reset();
+    baseRateDelay.reset();
+    outputMixer.reset();
+}
+
+template <typename SampleType>
+float CompressorEngine<SampleType>::getGainReduction (size_t numSamples) const noexcept
+{
+    // the gain rows are at the compressor's rate, which is oversampled in both oversampling modes
+    numSamples <<= currentOversamplingOrder;
+
+    float minimumGain = 1.0f;
+
+    if (currentNumBands > 1)
+    {
+        for (int band = 0; band < currentNumBands; ++band)
+            minimumGain = jmin (minimumGain, bandCompressors[band].getMinimumGain (numSamples));
+    }
+    else
+    {
+        minimumGain = compressor.getMinimumGain (numSamples);
+    }
+
+    return Decibels::gainToDecibels (minimumGain, -100.0f);
+}
+
+//==============================================================================
+template class CompressorEngine<float>;
+template class CompressorEngine<double>;
@@ -0,0 +1,233 @@
+/*
+  ==============================================================================
+
+    This file contains the compressor's DSP chain - key path, oversampling,
+    single or multiband compression, output gain and dry/wet mix - templated on sample
+    type, so the processor can run it natively in single or double precision.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SIMDCompressor.h"
+#include "CrossoverBank.h"
+#include "WorkerPool.h"
+#include "ParameterCache.h"
+#include "BlockProfiler.h"
+#include "MemoryArena.h"
+#include "OutputMixer.h"
+
+//==============================================================================
+/** Every parameter the chain reads, attached once to the processor's state. */
+struct CompressorParameters
+{
+    static constexpr int maxBands = CrossoverBank<float>::maxBands;
+    static constexpr int maxCrossovers = CrossoverBank<float>::maxCrossovers;
+    static constexpr int maxChannels = 64;
+
+    // Custom link groups run from 1 to this; 0 gives a channel its own detector
+    static constexpr int maxLinkGroups = 8;
+
+    void attach (AudioProcessorValueTreeState& state);
+
+    /** Makes every parameter report a change on its next read, so a freshly
+        prepared engine picks up all the current values.
+    */
+    void invalidate() noexcept;
+
+    CachedParameter attack, release, ratio, threshold, gain, link, linkGroups;
+    CachedParameter oversamplingFactor, oversamplingFilter, oversamplingMode;
+    CachedParameter lookahead, bands, detector, rmsWindow;
+    CachedParameter keyFilter, keyFrequency, keyListen;
+    CachedParameter mix, knee;
+    CachedParameter bypass, blockMode;
+    CachedParameter crossovers[maxCrossovers];
+    CachedParameter customLinkGroups;
+    CachedParameter channelLinkGroups[maxChannels];
+
+    struct Band
+    {
+        CachedParameter attack, release, ratio, threshold;
+    };
+
+    Band bandParameters[maxBands];
+};
+
+//==============================================================================
+template <typename SampleType>
+class CompressorEngine
+{
+public:
+    static constexpr int maxOversamplingOrder = 4;
+    static constexpr float maxLookaheadMs = 20.0f;
+    static constexpr float maxRmsWindowMs = 50.0f;
+
+    //==============================================================================
+    /** Takes everything any setting can need from the arena, so nothing allocates
+        while playing. zoneLinkGroups holds one link group per channel for the zone
+        link scheme; custom groups come from the parameters. Buffers, delays and
+        oversampling stages are only sized for factors up to 2^oversamplingOrder,
+        and higher settings run at that factor until the engine is prepared for
+        them; an engine prepared with order 0 always runs at the base rate.
+    */
+    void prepare (double sampleRate, int samplesPerBlock, int numChannels,
+                  int numSidechainChannels, int sidechainChannelOffset,
+                  const int* zoneLinkGroups, WorkerPool* workerPool,
+                  MemoryArena& arena, int oversamplingOrder = maxOversamplingOrder);
+
+    /** The highest oversampling order the last prepare() made room for. */
+    int getPreparedOversamplingOrder() const noexcept   { return maxOrder; }
+
+    /** Frees the oversampling stages and gain curve tables. The arena memory belongs to the caller. */
+    void release();
+
+    /** Roughly what the oversampling stages and gain curve tables hold outside the arena, in bytes. */
+    size_t getExternalMemoryBytes() const noexcept;
+
+    /** Flushes every filter, envelope and delay to zero without reallocating. */
+    void reset() noexcept;
+
+    /** Pushes any parameter values that changed since the last call into the chain. */
+    void updateParameters (CompressorParameters& parameters);
+
+    /** Switches the oversampling stage and band count if they changed, without allocating. */
+    void updateOversampling (const CompressorParameters& parameters, bool oversamplingEnabled);
+    void updateLookahead (const CompressorParameters& parameters);
+
+    /** The oversampling stage's latency plus the lookahead, in base-rate samples. In
+        detector-only mode the detector stage's latency counts, since the audio waits
+        for it, and so does the true-peak detector's lag when it is selected.
+    */
+    int getLatencySamples() const noexcept          { return oversamplingLatency + jmax (0, currentLookaheadSamples) + detectorLagSamples; }
+
+    /** The most getLatencySamples() can report with any setting. */
+    int getMaxLatencySamples() const noexcept       { return maxLatencySamples; }
+
+    /** Works out how quiet the input must be to count as silent, so that it stays
+        below -120 dBFS after the output gain, and how long it must stay that way
+        before the chain can idle: the latency, the slowest release falling as far,
+        the RMS window and a margin for the filters to ring out.
+    */
+    void updateTail (const CompressorParameters& parameters) noexcept;
+    double getTailSeconds() const noexcept          { return static_cast<double> (tailSamples) / currentSampleRate; }
+
+    /** True while silence has outlasted the tail and process() is only clearing the output. */
+    bool isIdle() const noexcept                    { return idle; }
+
+    //==============================================================================
+    /** Processes the main channels of a processBlock() buffer in place. Any
+        sidechain channels after them are used as the key, and may be overwritten.
+    */
+    void process (AudioBuffer<SampleType>& buffer, bool listening, bool isNonRealtime) noexcept;
+
+    /** The deepest gain reduction in the last block, in dB, for metering. */
+    float getGainReduction (size_t numSamples) const noexcept;
+
+    /** Stage timings go to this profiler when it is compiled in and enabled. */
+    void setProfiler (BlockProfiler* newProfiler) noexcept  { profiler = newProfiler; }
+
+private:
+    using Compressor = SIMDCompressor<SampleType>;
+    using Oversampling = dsp::Oversampling<SampleType>;
+    using Block = dsp::AudioBlock<SampleType>;
+    using ConstBlock = dsp::AudioBlock<const SampleType>;
+    using Context = dsp::ProcessContextReplacing<SampleType>;
+
+    static constexpr int maxBands = CrossoverBank<SampleType>::maxBands;
+
+    void applyLinkGroups (const CompressorParameters& parameters);
+    bool prepareKey (AudioBuffer<SampleType>& buffer, const Block& mainBlock) noexcept;
+    void readDry (Block& dry) noexcept;
+    bool dryNeedsFilters() const noexcept           { return dryOversampling != nullptr || currentNumBands > 1; }
+    void processChain (const Context& context, const ConstBlock* key) noexcept;
+    void processBands (Block& block, const ConstBlock* key) noexcept;
+    WorkerPool* getChannelWorkers (size_t numSamples) const noexcept;
+    bool isSilent (const AudioBuffer<SampleType>& buffer) const noexcept;
+    static Block allocateBlock (MemoryArena& arena, size_t numBlockChannels, size_t numSamples);
+
+    //==============================================================================
+    Compressor compressor;
+
+    // Output gain and dry/wet mix, at the base rate after any downsampling
+    OutputMixer<SampleType> outputMixer;
+
+    // While any dry signal is heard it goes through a copy of the oversampling stage
+    // and the crossover's allpass, so it adds to the compressed signal in phase
+    OwnedArray<Oversampling> dryOversamplers;
+    Oversampling* dryOversampling = nullptr;
+    Block dryStorage;
+    bool dryChainRunning = false;
+
+    // One pre-initialised stage per filter type and factor prepared for, so switching never allocates.
+    // They are kept across prepare() calls until the channel count or order changes.
+    OwnedArray<Oversampling> oversamplers;
+    size_t oversamplingChannels = 0;
+    Oversampling* oversampling = nullptr;
+    int currentOversamplingOrder = -1;
+    int currentOversamplingFilter = -1;
+    int currentOversamplingMode = -1;
+
+    // Cheap IIR stages that only upsample the detector input in "Detector Only" mode
+    OwnedArray<Oversampling> detectorOversamplers;
+    Oversampling* detectorOversampling = nullptr;
+
+    // Audio-path delay for detector-only mode, where the compressor's own delay
+    // would run at the oversampled rate the audio never sees. It covers the
+    // detector stage's latency as well as the lookahead.
+    LookaheadDelay<SampleType> baseRateDelay;
+    int currentLookaheadSamples = -1;
+    int detectorLagSamples = 0;
+    int oversamplingLatency = 0;
+    int maxOrder = maxOversamplingOrder;
+    int maxLatencySamples = 0;
+
+    // Multiband mode: the crossover feeds one compressor per band, summed before the output gain
+    CrossoverBank<SampleType> crossover;
+    Compressor bandCompressors[maxBands];
+    Block bandStorage;
+    Block bandBlocks[maxBands];
+    int currentNumBands = -1;
+    const ConstBlock* bandKey = nullptr;
+
+    // The detector's key: the sidechain bus when it is enabled, otherwise the main input,
+    // which is only copied into keyStorage when the key filter needs somewhere to write
+    int numSidechainChannels = 0;
+    int sidechainChannelOffset = 0;
+    dsp::StateVariableTPTFilter<SampleType> keyFilter;
+    Block keyStorage;
+    const SampleType** keyChannels = nullptr;
+    ConstBlock keyBlock;
+    int currentKeyFilterType = 0;
+
+    // Upsamples the key for the full oversampling path, one stage per audio stage
+    OwnedArray<Oversampling> keyOversamplers;
+    Oversampling* keyOversampling = nullptr;
+
+    // Bands only go wide on large offline blocks, where the hand-off cost is worth it;
+    // wide layouts split their detector rows once an offline block has enough work
+    WorkerPool* workerPool = nullptr;
+    bool nonRealtime = false;
+    static constexpr size_t minSamplesForWorkers = 2048;
+    static constexpr size_t minChannelSamplesForWorkers = 32768;
+
+    int* zoneLinkGroups = nullptr;
+    int* customLinkGroups = nullptr;
+
+    // Anything that would leave the output quieter than -120 dBFS, on every input and
+    // key channel, counts as silence; once it has lasted the whole tail the states are
+    // flushed and the chain skipped
+    static constexpr double silenceThreshold = 1.0e-6;
+    static constexpr double filterTailMs = 20.0;
+    SampleType silenceLevel = static_cast<SampleType> (silenceThreshold);
+    int64 tailSamples = 0;
+    int64 silentSamples = 0;
+    bool idle = false;
+
+    BlockProfiler* profiler = nullptr;
+
+    double currentSampleRate = 44100.0;
+    int currentBlockSize = 0;
+    size_t numChannels = 0;
+};
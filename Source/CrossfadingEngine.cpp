@@ -0,0 +1,240 @@
+/*
+  ==============================================================================
+
+    This file contains the switch between the oversampled, direct and bypass
+    paths.
+
+  ==============================================================================
+*/
+
+#include "CrossfadingEngine.h"
+
+//==============================================================================
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::attach (AudioProcessorValueTreeState& state)
+{
+    directParameters.attach (state);
+}
+
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::prepare (double sampleRate, int samplesPerBlock, int newNumChannels,
+                                             int numSidechainChannels, int sidechainChannelOffset,
+                                             const int* zoneLinkGroups, WorkerPool* workerPool,
+                                             MemoryArena& arena, int oversamplingOrder)
+{
+    currentSampleRate = sampleRate;
+    numChannels = static_cast<size_t> (newNumChannels);
+    numBufferChannels = jmax (newNumChannels, numSidechainChannels > 0 ? sidechainChannelOffset + numSidechainChannels : 0);
+
+    // Nothing past here ever sees more than one sub-block
+    blocks.prepare (arena, numBufferChannels, samplesPerBlock);
+    const auto blockSize = blocks.getBlockSize();
+
+    oversampled.prepare (sampleRate, blockSize, newNumChannels, numSidechainChannels, sidechainChannelOffset, zoneLinkGroups, workerPool, arena, oversamplingOrder);
+    direct.prepare (sampleRate, blockSize, newNumChannels, numSidechainChannels, sidechainChannelOffset, zoneLinkGroups, workerPool, arena, 0);
+    directParameters.invalidate();
+
+    directDelay.prepare (arena, newNumChannels, oversampled.getMaxLatencySamples());
+    bypassDelay.prepare (arena, newNumChannels, oversampled.getMaxLatencySamples());
+
+    // The engines take a whole AudioBuffer, so this one stays outside the arena and
+    // only reallocates when it has to grow
+    incomingBuffer.setSize (numBufferChannels, blockSize, false, false, true);
+
+    fadeSamples = jmax<int64> (1, static_cast<int64> (fadeMs * 0.001 * sampleRate));
+    switching = false;
+    needsInitialPath = true;
+}
+
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::release()
+{
+    oversampled.release();
+    direct.release();
+    blocks.release();
+    incomingBuffer.setSize (0, 0);
+    needsInitialPath = true;
+}
+
+template <typename SampleType>
+size_t CrossfadingEngine<SampleType>::getExternalMemoryBytes() const noexcept
+{
+    return oversampled.getExternalMemoryBytes() + direct.getExternalMemoryBytes() + blocks.getExternalMemoryBytes()
+         + static_cast<size_t> (incomingBuffer.getNumChannels()) * static_cast<size_t> (incomingBuffer.getNumSamples()) * sizeof (SampleType);
+}
+
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::update (CompressorParameters& parameters, Path target) noexcept
+{
+    blocks.setRegroup (parameters.blockMode.getIndex() == 1);
+
+    oversampled.updateParameters (parameters);
+    oversampled.updateOversampling (parameters, true);
+    oversampled.updateLookahead (parameters);
+    oversampled.updateTail (parameters);
+
+    direct.updateParameters (directParameters);
+    direct.updateOversampling (directParameters, false);
+    direct.updateLookahead (directParameters);
+    direct.updateTail (directParameters);
+
+    const auto latency = oversampled.getLatencySamples();
+    directDelay.setDelay (latency - direct.getLatencySamples());
+    bypassDelay.setDelay (latency);
+
+    // The first block after prepare() plays the target straight away
+    if (needsInitialPath)
+    {
+        current = target;
+        needsInitialPath = false;
+        return;
+    }
+
+    if (switching || target == current)
+        return;
+
+    incoming = target;
+    resetPath (incoming);
+    switching = true;
+    switchPosition = 0;
+    warmUpSamples = latency + static_cast<int64> (warmUpMs * 0.001 * currentSampleRate);
+}
+
+template <typename SampleType>
+double CrossfadingEngine<SampleType>::getTailSeconds() const noexcept
+{
+    const auto pathTail = jmax (oversampled.getTailSeconds(), direct.getTailSeconds() + directDelay.getDelay() / currentSampleRate);
+    return pathTail + blocks.getLatencySamples() / currentSampleRate;
+}
+
+//==============================================================================
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::process (AudioBuffer<SampleType>& buffer, bool listening, bool isNonRealtime) noexcept
+{
+    nonRealtime = isNonRealtime;
+    blocks.process (buffer, [this, listening] (AudioBuffer<SampleType>& subBlock) { processSubBlock (subBlock, listening); });
+}
+
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::processSubBlock (AudioBuffer<SampleType>& buffer, bool listening) noexcept
+{
+    // The bypass delay always holds the latest input, so a host bypass can take
+    // over from any path mid-stream without a gap
+    if (current != Path::bypassed && ! (switching && incoming == Path::bypassed))
+        bypassDelay.push (dsp::AudioBlock<SampleType> (buffer).getSubsetChannelBlock (0, numChannels));
+
+    if (! switching)
+    {
+        processPath (current, buffer, listening);
+        return;
+    }
+
+    const auto numSamples = buffer.getNumSamples();
+    incomingBuffer.setSize (numBufferChannels, numSamples, false, false, true);
+
+    for (int channel = 0; channel < jmin (numBufferChannels, buffer.getNumChannels()); ++channel)
+        incomingBuffer.copyFrom (channel, 0, buffer, channel, 0, numSamples);
+
+    processPath (current, buffer, listening);
+    processPath (incoming, incomingBuffer, listening);
+
+    // Silent until the warm-up is over, then a linear ramp onto the incoming path
+    for (size_t channel = 0; channel < numChannels; ++channel)
+    {
+        auto* output = buffer.getWritePointer (static_cast<int> (channel));
+        const auto* input = incomingBuffer.getReadPointer (static_cast<int> (channel));
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto fadePosition = switchPosition + i - warmUpSamples;
+
+            if (fadePosition > 0)
+            {
+                const auto gain = fadePosition >= fadeSamples ? SampleType (1)
+                                                              : static_cast<SampleType> (fadePosition) / static_cast<SampleType> (fadeSamples);
+                output[i] += gain * (input[i] - output[i]);
+            }
+        }
+    }
+
+    switchPosition += numSamples;
+
+    if (switchPosition >= warmUpSamples + fadeSamples)
+    {
+        current = incoming;
+        switching = false;
+    }
+}
+
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::processBypassed (AudioBuffer<SampleType>& buffer) noexcept
+{
+    // The host has already cut over, so there is nothing to fade from. The
+    // bypass delay has been following the input, so it plays on seamlessly.
+    current = Path::bypassed;
+    switching = false;
+    blocks.process (buffer, [this] (AudioBuffer<SampleType>& subBlock) { processPath (Path::bypassed, subBlock, false); });
+}
+
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::processPath (Path path, AudioBuffer<SampleType>& buffer, bool listening) noexcept
+{
+    auto block = dsp::AudioBlock<SampleType> (buffer).getSubsetChannelBlock (0, numChannels);
+
+    switch (path)
+    {
+        case Path::oversampled:
+            oversampled.process (buffer, listening, nonRealtime);
+            break;
+
+        case Path::direct:
+            direct.process (buffer, listening, nonRealtime);
+            directDelay.process (block);
+            break;
+
+        case Path::bypassed:
+            bypassDelay.process (block);
+            break;
+    }
+}
+
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::resetPath (Path path) noexcept
+{
+    switch (path)
+    {
+        case Path::oversampled:
+            oversampled.reset();
+            break;
+
+        case Path::direct:
+            direct.reset();
+            directDelay.reset();
+            break;
+
+        case Path::bypassed:
+            // Fed on every sub-block whatever is playing, so it is always warm
+            break;
+    }
+}
+
+template <typename SampleType>
+float CrossfadingEngine<SampleType>::getGainReduction() const noexcept
+{
+    if (current == Path::bypassed || blocks.getLastBlockSize() == 0)
+        return 0.0f;
+
+    const auto& engine = current == Path::oversampled ? oversampled : direct;
+    return engine.isIdle() ? 0.0f : engine.getGainReduction (static_cast<size_t> (blocks.getLastBlockSize()));
+}
+
+template <typename SampleType>
+void CrossfadingEngine<SampleType>::setProfiler (BlockProfiler* profiler) noexcept
+{
+    oversampled.setProfiler (profiler);
+    direct.setProfiler (profiler);
+}
+
+//==============================================================================
+template class CrossfadingEngine<float>;
+template class CrossfadingEngine<double>;
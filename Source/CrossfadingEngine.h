@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    This file contains the switch between the processor's three signal paths:
+    the oversampled engine, the direct engine and bypass.
+
+    All three report the same latency. The direct and bypass paths are delayed
+    to line up with the oversampled one, so switching never moves the audio on
+    the host's timeline. A switch first warms the incoming path up on a copy of
+    the input for its latency plus warmUpMs, so its delays are full and its
+    envelopes have caught up. It then crossfades over fadeMs. Every buffer it
+    uses is allocated in prepare(), so switching never allocates.
+
+    Host buffers reach the paths through a FixedBlockAdapter, so the engines
+    are prepared for its sub-block size rather than the host's buffer size.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "CompressorEngine.h"
+#include "Lookahead.h"
+#include "FixedBlockAdapter.h"
+
+//==============================================================================
+enum class EnginePath
+{
+    direct = 0,
+    oversampled,
+    bypassed
+};
+
+//==============================================================================
+template <typename SampleType>
+class CrossfadingEngine
+{
+public:
+    using Path = EnginePath;
+
+    /** The direct engine keeps its own parameter cache, since both engines follow every change. */
+    void attach (AudioProcessorValueTreeState& state);
+
+    /** Host buffers run as they come, and only buffers longer than samplesPerBlock
+        are split, unless the blockMode parameter asks for fixed sub-blocks (see
+        FixedBlockAdapter). Both modes are prepared for, so it can change at any time.
+    */
+    void prepare (double sampleRate, int samplesPerBlock, int numChannels,
+                  int numSidechainChannels, int sidechainChannelOffset,
+                  const int* zoneLinkGroups, WorkerPool* workerPool,
+                  MemoryArena& arena, int oversamplingOrder);
+
+    /** The highest oversampling order the oversampled engine has room for; higher
+        factors play at this one until the engine is prepared again.
+    */
+    int getPreparedOversamplingOrder() const noexcept   { return oversampled.getPreparedOversamplingOrder(); }
+
+    /** Frees what the engines hold outside the arena. */
+    void release();
+
+    /** What the engines hold outside the arena, in bytes. */
+    size_t getExternalMemoryBytes() const noexcept;
+
+    /** Brings both engines up to date and starts a switch if target differs from
+        the path playing. A target that changes mid-switch waits for it to finish.
+    */
+    void update (CompressorParameters& parameters, Path target) noexcept;
+
+    /** The oversampled engine's latency, which every path is aligned to, plus any sub-block buffering. */
+    int getLatencySamples() const noexcept          { return oversampled.getLatencySamples() + blocks.getLatencySamples(); }
+    double getTailSeconds() const noexcept;
+
+    //==============================================================================
+    void process (AudioBuffer<SampleType>& buffer, bool listening, bool isNonRealtime) noexcept;
+
+    /** Plays the bypass path immediately, for hosts that call processBlockBypassed(). */
+    void processBypassed (AudioBuffer<SampleType>& buffer) noexcept;
+
+    /** The playing engine's deepest gain reduction in the last sub-block it ran, or 0
+        when bypassed or idle.
+    */
+    float getGainReduction() const noexcept;
+
+    void setProfiler (BlockProfiler* profiler) noexcept;
+
+private:
+    static constexpr double warmUpMs = 50.0;
+    static constexpr double fadeMs = 20.0;
+
+    void processSubBlock (AudioBuffer<SampleType>& buffer, bool listening) noexcept;
+    void processPath (Path path, AudioBuffer<SampleType>& buffer, bool listening) noexcept;
+    void resetPath (Path path) noexcept;
+
+    //==============================================================================
+    CompressorEngine<SampleType> oversampled, direct;
+    CompressorParameters directParameters;
+
+    FixedBlockAdapter<SampleType> blocks;
+
+    // Bring the direct and bypass paths up to the oversampled engine's latency
+    LookaheadDelay<SampleType> directDelay, bypassDelay;
+
+    // The incoming path runs on this copy of the input, sidechain included, while switching
+    AudioBuffer<SampleType> incomingBuffer;
+    int numBufferChannels = 0;
+
+    Path current = Path::direct, incoming = Path::direct;
+    bool switching = false;
+    int64 switchPosition = 0, warmUpSamples = 0, fadeSamples = 1;
+
+    double currentSampleRate = 44100.0;
+    size_t numChannels = 0;
+    bool nonRealtime = false;
+    bool needsInitialPath = true;
+};
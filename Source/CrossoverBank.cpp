@@ -0,0 +1,310 @@
+/*
+  ==============================================================================
+
+    This file contains the Linkwitz-Riley crossover bank used by the
+    multiband compressor.
+
+  ==============================================================================
+*/
+
+#include "CrossoverBank.h"
+
+namespace
+{
+    // Two cascaded Butterworth TPT state-variable sections (as dsp::LinkwitzRileyFilter)
+    template <typename Vec>
+    inline void splitLR4 (Vec x, Vec g, Vec h, Vec* s, Vec& low, Vec& high) noexcept
+    {
+        const auto R2 = MathConstants<typename Vec::ElementType>::sqrt2;
+
+        const auto yH = (x - (g + R2) * s[0] - s[1]) * h;
+        const auto yB = g * yH + s[0];
+        s[0] = g * yH + yB;
+        const auto yL = g * yB + s[1];
+        s[1] = g * yB + yL;
+
+        const auto yH2 = (yL - (g + R2) * s[2] - s[3]) * h;
+        const auto yB2 = g * yH2 + s[2];
+        s[2] = g * yH2 + yB2;
+        const auto yL2 = g * yB2 + s[3];
+        s[3] = g * yB2 + yL2;
+
+        low = yL2;
+        high = yL - yB * R2 + yH - yL2;
+    }
+
+    // The 2nd-order allpass that LR4 low + high sums to
+    template <typename Vec>
+    inline Vec allpass (Vec x, Vec g, Vec h, Vec* s) noexcept
+    {
+        const auto R2 = MathConstants<typename Vec::ElementType>::sqrt2;
+
+        const auto yH = (x - (g + R2) * s[0] - s[1]) * h;
+        const auto yB = g * yH + s[0];
+        s[0] = g * yH + yB;
+        const auto yL = g * yB + s[1];
+        s[1] = g * yB + yL;
+
+        return yL - yB * R2 + yH;
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+void CrossoverBank<SampleType>::prepare (MemoryArena& arena, const dsp::ProcessSpec& spec)
+{
+    jassert (spec.numChannels > 0);
+
+    numChannels = spec.numChannels;
+    numGroups = (numChannels + Vec::size() - 1) / Vec::size();
+    stateStorage = arena.allocate<SampleType> (numGroups * numStates * Vec::size());
+    tiles = arena.allocate<SampleType> (static_cast<size_t> (maxBands) * tileLength * Vec::size());
+
+    setSampleRate (spec.sampleRate);
+    reset();
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::reset()
+{
+    if (stateStorage != nullptr)
+        FloatVectorOperations::clear (stateStorage, static_cast<int> (numGroups * numStates * Vec::size()));
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::resetAllpass() noexcept
+{
+    if (stateStorage == nullptr)
+        return;
+
+    for (size_t group = 0; group < numGroups; ++group)
+        FloatVectorOperations::clear (stateStorage + (group * numStates + static_cast<size_t> (referenceState (0))) * Vec::size(),
+                                      static_cast<int> (2 * maxCrossovers * Vec::size()));
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::setSampleRate (double newSampleRate)
+{
+    jassert (newSampleRate > 0);
+
+    sampleRate = newSampleRate;
+    updateCoefficients();
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::setNumBands (int newNumBands)
+{
+    jassert (newNumBands >= 1 && newNumBands <= maxBands);
+
+    newNumBands = jlimit (1, maxBands, newNumBands);
+
+    if (newNumBands != numBands)
+    {
+        numBands = newNumBands;
+        reset();
+    }
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::setCrossoverFrequency (int crossoverIndex, float newFrequencyHz)
+{
+    jassert (isPositiveAndBelow (crossoverIndex, maxCrossovers));
+
+    if (frequencies[crossoverIndex] != newFrequencyHz)
+    {
+        frequencies[crossoverIndex] = newFrequencyHz;
+        updateCoefficients();
+    }
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::updateCoefficients()
+{
+    for (int i = 0; i < maxCrossovers; ++i)
+    {
+        const auto frequency = jlimit (10.0, sampleRate * 0.49, static_cast<double> (frequencies[i]));
+
+        g[i] = static_cast<SampleType> (std::tan (MathConstants<double>::pi * frequency / sampleRate));
+        h[i] = SampleType (1) / (SampleType (1) + MathConstants<SampleType>::sqrt2 * g[i] + g[i] * g[i]);
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+int CrossoverBank<SampleType>::compensationState (int band, int crossover) noexcept
+{
+    jassert (band < crossover && crossover < maxCrossovers);
+
+    const auto pair = band * (2 * maxCrossovers - band - 1) / 2 + (crossover - band - 1);
+    return 4 * maxCrossovers + 2 * pair;
+}
+
+template <typename SampleType>
+int CrossoverBank<SampleType>::referenceState (int crossover) noexcept
+{
+    return 4 * maxCrossovers + 2 * numCompensationPairs + 2 * crossover;
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::loadStates (size_t group, Vec* states) const noexcept
+{
+    alignas (32) SampleType lanes[Vec::SIMDNumElements];
+    const auto* source = stateStorage + group * numStates * Vec::size();
+
+    for (int i = 0; i < numStates; ++i, source += Vec::size())
+    {
+        std::copy (source, source + Vec::size(), lanes);
+        states[i] = Vec::fromRawArray (lanes);
+    }
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::saveStates (size_t group, const Vec* states) noexcept
+{
+    alignas (32) SampleType lanes[Vec::SIMDNumElements];
+    auto* destination = stateStorage + group * numStates * Vec::size();
+
+    for (int i = 0; i < numStates; ++i, destination += Vec::size())
+    {
+        states[i].copyToRawArray (lanes);
+        std::copy (lanes, lanes + Vec::size(), destination);
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+void CrossoverBank<SampleType>::process (const dsp::AudioBlock<const SampleType>& input, dsp::AudioBlock<SampleType>* bands) noexcept
+{
+    jassert (input.getNumChannels() == numChannels);
+
+    const auto numSamples = input.getNumSamples();
+    const auto numCrossovers = numBands - 1;
+
+    Vec gains[maxCrossovers], normalisers[maxCrossovers];
+
+    for (int i = 0; i < numCrossovers; ++i)
+    {
+        gains[i] = Vec::expand (g[i]);
+        normalisers[i] = Vec::expand (h[i]);
+    }
+
+    for (size_t group = 0; group < numGroups; ++group)
+    {
+        const auto first = group * Vec::size();
+        const auto numLanes = jmin (Vec::size(), numChannels - first);
+
+        const SampleType* inputs[Vec::SIMDNumElements] = {};
+        SampleType* outputs[maxBands][Vec::SIMDNumElements] = {};
+
+        for (size_t lane = 0; lane < numLanes; ++lane)
+        {
+            inputs[lane] = input.getChannelPointer (first + lane);
+
+            for (int band = 0; band < numBands; ++band)
+                outputs[band][lane] = bands[band].getChannelPointer (first + lane);
+        }
+
+        Vec states[numStates];
+        loadStates (group, states);
+
+        // Lanes without a channel run on whatever the tiles hold and are never written back
+        for (size_t start = 0; start < numSamples; start += tileLength)
+        {
+            const auto length = jmin (tileLength, numSamples - start);
+
+            for (size_t lane = 0; lane < numLanes; ++lane)
+                for (size_t i = 0; i < length; ++i)
+                    tileFrame (numCrossovers, i)[lane] = inputs[lane][start + i];
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                auto remainder = Vec::fromRawArray (tileFrame (numCrossovers, i));
+
+                for (int crossover = 0; crossover < numCrossovers; ++crossover)
+                {
+                    Vec low, high;
+                    splitLR4 (remainder, gains[crossover], normalisers[crossover], states + 4 * crossover, low, high);
+
+                    // match the phase of everything split off further up the tree
+                    for (int above = crossover + 1; above < numCrossovers; ++above)
+                        low = allpass (low, gains[above], normalisers[above], states + compensationState (crossover, above));
+
+                    low.copyToRawArray (tileFrame (crossover, i));
+                    remainder = high;
+                }
+
+                remainder.copyToRawArray (tileFrame (numCrossovers, i));
+            }
+
+            for (int band = 0; band < numBands; ++band)
+                for (size_t lane = 0; lane < numLanes; ++lane)
+                    for (size_t i = 0; i < length; ++i)
+                        outputs[band][lane][start + i] = tileFrame (band, i)[lane];
+        }
+
+        saveStates (group, states);
+    }
+}
+
+template <typename SampleType>
+void CrossoverBank<SampleType>::processAllpass (dsp::AudioBlock<SampleType>& block) noexcept
+{
+    jassert (block.getNumChannels() == numChannels);
+
+    const auto numSamples = block.getNumSamples();
+    const auto numCrossovers = numBands - 1;
+
+    Vec gains[maxCrossovers], normalisers[maxCrossovers];
+
+    for (int i = 0; i < numCrossovers; ++i)
+    {
+        gains[i] = Vec::expand (g[i]);
+        normalisers[i] = Vec::expand (h[i]);
+    }
+
+    for (size_t group = 0; group < numGroups; ++group)
+    {
+        const auto first = group * Vec::size();
+        const auto numLanes = jmin (Vec::size(), numChannels - first);
+
+        Vec states[numStates];
+        loadStates (group, states);
+
+        for (size_t start = 0; start < numSamples; start += tileLength)
+        {
+            const auto length = jmin (tileLength, numSamples - start);
+
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                const auto* channel = block.getChannelPointer (first + lane) + start;
+
+                for (size_t i = 0; i < length; ++i)
+                    tileFrame (0, i)[lane] = channel[i];
+            }
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                auto x = Vec::fromRawArray (tileFrame (0, i));
+
+                for (int crossover = 0; crossover < numCrossovers; ++crossover)
+                    x = allpass (x, gains[crossover], normalisers[crossover], states + referenceState (crossover));
+
+                x.copyToRawArray (tileFrame (0, i));
+            }
+
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                auto* channel = block.getChannelPointer (first + lane) + start;
+
+                for (size_t i = 0; i < length; ++i)
+                    channel[i] = tileFrame (0, i)[lane];
+            }
+        }
+
+        saveStates (group, states);
+    }
+}
+
+//==============================================================================
+template class CrossoverBank<float>;
+template class CrossoverBank<double>;
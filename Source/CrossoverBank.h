@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+
+    This file contains the Linkwitz-Riley crossover bank used by the
+    multiband compressor.
+
+    The input is split by a tree of 4th-order Linkwitz-Riley filters: each
+    split peels the lowest band off whatever is left above the previous
+    crossover. Every band then passes through the 2nd-order allpasses of the
+    crossovers above it, so all bands share the same phase response and the
+    summed bands equal the input through processAllpass() - a null test
+    against that path cancels exactly when every band is at unity.
+
+    Channels run in SIMD lanes, so a stereo or quad signal costs the same
+    as a mono one. Each register's channels are transposed into interleaved
+    tiles a stretch at a time, so the filters load and store whole frames
+    rather than gathering one sample per lane. SampleType is float or
+    double; double gets half as many lanes per register.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "MemoryArena.h"
+
+//==============================================================================
+template <typename SampleType>
+class CrossoverBank
+{
+public:
+    static constexpr int maxBands = 5;
+    static constexpr int maxCrossovers = maxBands - 1;
+
+    //==============================================================================
+    void prepare (MemoryArena& arena, const dsp::ProcessSpec& spec);
+    void reset();
+
+    /** Retunes every filter for a new rate without reallocating. */
+    void setSampleRate (double newSampleRate);
+    void setNumBands (int newNumBands);
+    void setCrossoverFrequency (int crossoverIndex, float newFrequencyHz);
+
+    int getNumBands() const noexcept                 { return numBands; }
+
+    //==============================================================================
+    /** Splits the input into getNumBands() blocks, lowest band first. Each band
+        block needs the input's channel count and at least its length.
+    */
+    void process (const dsp::AudioBlock<const SampleType>& input, dsp::AudioBlock<SampleType>* bands) noexcept;
+
+    /** Runs the allpass chain the summed bands follow, to bring a dry signal
+        into phase with them for mixing or null testing.
+    */
+    void processAllpass (dsp::AudioBlock<SampleType>& block) noexcept;
+
+    /** Clears only the states processAllpass() uses, leaving the band split running. */
+    void resetAllpass() noexcept;
+
+private:
+    using Vec = dsp::SIMDRegister<SampleType>;
+
+    // Per channel group: 4 LR4 states per crossover, 2 allpass states per
+    // (band, higher crossover) pair, and 2 per crossover for processAllpass()
+    static constexpr int numCompensationPairs = maxCrossovers * (maxCrossovers - 1) / 2;
+    static constexpr int numStates = 4 * maxCrossovers + 2 * numCompensationPairs + 2 * maxCrossovers;
+
+    static int compensationState (int band, int crossover) noexcept;
+    static int referenceState (int crossover) noexcept;
+
+    void updateCoefficients();
+    void loadStates (size_t group, Vec* states) const noexcept;
+    void saveStates (size_t group, const Vec* states) noexcept;
+
+    // One interleaved tile per band; the highest band's also holds the input
+    static constexpr size_t tileLength = 64;
+    SampleType* tileFrame (int band, size_t i) const noexcept   { return tiles + (static_cast<size_t> (band) * tileLength + i) * Vec::size(); }
+
+    //==============================================================================
+    SampleType* stateStorage = nullptr;
+    SampleType* tiles = nullptr;
+    size_t numChannels = 0, numGroups = 0;
+
+    double sampleRate = 44100.0;
+    int numBands = 1;
+    float frequencies[maxCrossovers] = { 120.0f, 500.0f, 2000.0f, 6000.0f };
+    SampleType g[maxCrossovers] = {}, h[maxCrossovers] = {};
+};
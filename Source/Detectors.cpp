@@ -0,0 +1,153 @@
+/*
+  ==============================================================================
+
+    This file contains the RMS and true-peak detectors used by the compressor.
+
+  ==============================================================================
+*/
+
+#include "Detectors.h"
+
+//==============================================================================
+void RunningMeanSquare::prepare (MemoryArena& arena, int maxWindowLength)
+{
+    // the slot being written must never be one the window still reads
+    const auto capacity = nextPowerOfTwo (jmax (1, maxWindowLength) + 1);
+
+    values = arena.allocate<float> (static_cast<size_t> (capacity));
+    mask = capacity - 1;
+    windowLength = jlimit (1, mask, windowLength);
+    inverseLength = 1.0 / windowLength;
+
+    reset();
+}
+
+void RunningMeanSquare::reset() noexcept
+{
+    if (values != nullptr)
+        FloatVectorOperations::clear (values, mask + 1);
+
+    writePosition = 0;
+    sum = 0.0;
+    samplesUntilResync = windowLength;
+}
+
+void RunningMeanSquare::setWindowLength (int newWindowLength) noexcept
+{
+    jassert (newWindowLength >= 1 && newWindowLength <= mask);
+    newWindowLength = jlimit (1, mask, newWindowLength);
+
+    if (newWindowLength != windowLength)
+    {
+        // The ring still holds the older samples, so the new window starts full
+        windowLength = newWindowLength;
+        inverseLength = 1.0 / windowLength;
+        resync();
+    }
+}
+
+void RunningMeanSquare::resync() noexcept
+{
+    auto exactSum = 0.0;
+
+    for (int i = 1; i <= windowLength; ++i)
+        exactSum += values[(writePosition - i) & mask];
+
+    sum = exactSum;
+    samplesUntilResync = windowLength;
+}
+
+void RunningMeanSquare::process (float* squares, size_t numSamples) noexcept
+{
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const auto value = squares[i];
+
+        sum += value - values[(writePosition - windowLength) & mask];
+        values[writePosition] = value;
+        writePosition = (writePosition + 1) & mask;
+
+        if (--samplesUntilResync == 0)
+            resync();
+
+        squares[i] = static_cast<float> (std::sqrt (jmax (0.0, sum) * inverseLength));
+    }
+}
+
+//==============================================================================
+TruePeakDetector::TruePeakDetector()
+{
+    // Phase k estimates the signal k/4 of a sample after the tap latencySamples back
+    constexpr auto halfWidth = tapsPerPhase / 2 + 0.5;
+
+    for (int phase = 0; phase < numPhases; ++phase)
+    {
+        auto sum = 0.0;
+
+        for (int tap = 0; tap < tapsPerPhase; ++tap)
+        {
+            const auto x = latencySamples - tap - static_cast<double> (phase) / numPhases;
+            const auto sinc = x == 0.0 ? 1.0 : std::sin (MathConstants<double>::pi * x) / (MathConstants<double>::pi * x);
+            const auto window = 0.5 + 0.5 * std::cos (MathConstants<double>::pi * x / halfWidth);
+
+            coefficients[phase][tap] = static_cast<float> (sinc * window);
+            sum += sinc * window;
+        }
+
+        for (auto& coefficient : coefficients[phase])
+            coefficient = static_cast<float> (coefficient / sum);
+    }
+}
+
+void TruePeakDetector::prepare (MemoryArena& arena, int newNumChannels)
+{
+    numChannels = newNumChannels;
+    history = arena.allocate<float> (static_cast<size_t> (numChannels * 2 * tapsPerPhase));
+    positions = arena.allocate<int> (static_cast<size_t> (numChannels));
+
+    reset();
+}
+
+void TruePeakDetector::reset() noexcept
+{
+    if (history != nullptr)
+        FloatVectorOperations::clear (history, numChannels * 2 * tapsPerPhase);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        positions[channel] = 0;
+}
+
+template <typename SampleType>
+void TruePeakDetector::process (int channel, const SampleType* input, float* peak, size_t numSamples) noexcept
+{
+    jassert (isPositiveAndBelow (channel, numChannels));
+
+    auto* taps = history + channel * 2 * tapsPerPhase;
+    auto position = positions[channel];
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        position = (position == 0 ? tapsPerPhase : position) - 1;
+        taps[position] = taps[position + tapsPerPhase] = static_cast<float> (input[i]);
+
+        const auto* newest = taps + position;
+        auto magnitude = peak[i];
+
+        for (auto& phase : coefficients)
+        {
+            auto value = 0.0f;
+
+            for (int tap = 0; tap < tapsPerPhase; ++tap)
+                value += phase[tap] * newest[tap];
+
+            magnitude = jmax (magnitude, std::abs (value));
+        }
+
+        peak[i] = magnitude;
+    }
+
+    positions[channel] = position;
+}
+
+template void TruePeakDetector::process<float> (int, const float*, float*, size_t) noexcept;
+template void TruePeakDetector::process<double> (int, const double*, float*, size_t) noexcept;
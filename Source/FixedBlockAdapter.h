@@ -0,0 +1,184 @@
+/*
+  ==============================================================================
+
+    This file contains the adapter between the host's buffers and the block
+    size the DSP chain is prepared for.
+
+    Hosts don't always call processBlock() with the buffer size they
+    announced: some send larger or irregular buffers, and some run 1 to 32
+    samples at a time, where the chain's per-call overhead outweighs the
+    work. By default host buffers run as they come, without buffering or
+    latency, and only buffers longer than the chain was prepared for are
+    split. With regrouping switched on, every host buffer, whatever its
+    size, is regrouped into sub-blocks of exactly fixedBlockSize. That costs
+    one sub-block of latency, but the chain always runs the same,
+    vector-sized amount of work per call, which only pays off when the
+    host's buffers are tiny.
+
+    The chain is prepared for whichever mode needs more, so the mode can
+    change while playing. Either way the chain never sees more samples than
+    it was prepared for, so processBlock() never allocates, whatever the
+    host sends.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "MemoryArena.h"
+
+//==============================================================================
+template <typename SampleType>
+class FixedBlockAdapter
+{
+public:
+    /** The regrouped sub-block size: long enough to amortise the chain's per-call work,
+        short enough that its latency is about a millisecond.
+    */
+    static constexpr int fixedBlockSize = 64;
+    static constexpr int minBlockSize = 32;
+    static constexpr int maxBlockSize = 8192;
+
+    /** hostBlockSize is rounded up to a power of two within [minBlockSize, maxBlockSize].
+        numChannels covers every channel of the host's buffer, sidechain included.
+    */
+    void prepare (MemoryArena& arena, int newNumChannels, int hostBlockSize)
+    {
+        numChannels = newNumChannels;
+        blockSize = jmax (fixedBlockSize, nextPowerOfTwo (jlimit (minBlockSize, maxBlockSize, hostBlockSize)));
+
+        // The chain takes a whole AudioBuffer, so the scratch stays outside the arena and
+        // only reallocates when it has to grow. A power-of-two length keeps every channel
+        // on a vector boundary.
+        scratch.setSize (numChannels, blockSize, false, true, true);
+
+        outputs = arena.allocate<SampleType*> (static_cast<size_t> (numChannels));
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            outputs[channel] = arena.allocate<SampleType> (static_cast<size_t> (fixedBlockSize));
+
+        reset();
+    }
+
+    /** Switches regrouping on or off. A change clears whatever was buffered and
+        moves the latency, so it is meant for settings that change rarely.
+    */
+    void setRegroup (bool shouldRegroup) noexcept
+    {
+        if (shouldRegroup != regroup)
+        {
+            regroup = shouldRegroup;
+            reset();
+        }
+    }
+
+    void release()
+    {
+        scratch.setSize (0, 0);
+        outputs = nullptr;
+    }
+
+    /** Clears the buffered input and output without reallocating. */
+    void reset() noexcept
+    {
+        scratch.setSize (numChannels, regroup ? fixedBlockSize : blockSize, false, false, true);
+        scratch.clear();
+
+        if (outputs != nullptr)
+            for (int channel = 0; channel < numChannels; ++channel)
+                FloatVectorOperations::clear (outputs[channel], fixedBlockSize);
+
+        position = 0;
+        lastBlockSize = 0;
+    }
+
+    /** The most samples the chain is ever handed at once. */
+    int getBlockSize() const noexcept               { return blockSize; }
+    int getLatencySamples() const noexcept          { return regroup ? fixedBlockSize : 0; }
+
+    /** The length of the last sub-block the chain ran, or 0 if it hasn't run since reset(). */
+    int getLastBlockSize() const noexcept           { return lastBlockSize; }
+
+    size_t getExternalMemoryBytes() const noexcept
+    {
+        return static_cast<size_t> (scratch.getNumChannels()) * static_cast<size_t> (scratch.getNumSamples()) * sizeof (SampleType);
+    }
+
+    //==============================================================================
+    /** Runs processSubBlock (AudioBuffer<SampleType>&) over the host's buffer in sub-blocks,
+        leaving the processed audio in the host's buffer.
+    */
+    template <typename ProcessSubBlock>
+    void process (AudioBuffer<SampleType>& buffer, ProcessSubBlock&& processSubBlock) noexcept
+    {
+        const auto numSamples = buffer.getNumSamples();
+        const auto numBufferChannels = jmin (numChannels, buffer.getNumChannels());
+
+        if (regroup)
+        {
+            // Each host sample goes into the sub-block being gathered, and comes back out
+            // from the same place in the last one processed, exactly fixedBlockSize samples later
+            for (int done = 0; done < numSamples;)
+            {
+                const auto chunk = jmin (numSamples - done, fixedBlockSize - position);
+
+                for (int channel = 0; channel < numBufferChannels; ++channel)
+                {
+                    auto* host = buffer.getWritePointer (channel, done);
+                    FloatVectorOperations::copy (scratch.getWritePointer (channel, position), host, chunk);
+                    FloatVectorOperations::copy (host, outputs[channel] + position, chunk);
+                }
+
+                done += chunk;
+                position += chunk;
+
+                if (position == fixedBlockSize)
+                {
+                    processSubBlock (scratch);
+
+                    for (int channel = 0; channel < numBufferChannels; ++channel)
+                        FloatVectorOperations::copy (outputs[channel], scratch.getReadPointer (channel), fixedBlockSize);
+
+                    position = 0;
+                    lastBlockSize = fixedBlockSize;
+                }
+            }
+
+            return;
+        }
+
+        // Anything the chain was prepared for runs in place, with no copies
+        if (numSamples <= blockSize)
+        {
+            processSubBlock (buffer);
+            lastBlockSize = numSamples;
+            return;
+        }
+
+        for (int done = 0; done < numSamples; done += blockSize)
+        {
+            const auto chunk = jmin (blockSize, numSamples - done);
+            scratch.setSize (numChannels, chunk, false, false, true);
+
+            for (int channel = 0; channel < numBufferChannels; ++channel)
+                scratch.copyFrom (channel, 0, buffer, channel, done, chunk);
+
+            processSubBlock (scratch);
+
+            for (int channel = 0; channel < numBufferChannels; ++channel)
+                buffer.copyFrom (channel, done, scratch, channel, 0, chunk);
+
+            lastBlockSize = chunk;
+        }
+    }
+
+private:
+    AudioBuffer<SampleType> scratch;
+    SampleType** outputs = nullptr;
+
+    int numChannels = 0;
+    int blockSize = fixedBlockSize;
+    int position = 0, lastBlockSize = 0;
+    bool regroup = false;
+};
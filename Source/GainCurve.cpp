@@ -0,0 +1,210 @@
+/*
+  ==============================================================================
+
+    This file contains the compressor's precomputed gain curve tables.
+
+  ==============================================================================
+*/
+
+#include "GainCurve.h"
+
+namespace
+{
+    constexpr int fractionBits = 23 - 6;    // mantissa bits below the node index
+    static_assert ((1 << (23 - fractionBits)) == GainCurveTable::segmentsPerOctave, "nodes must split octaves in powers of two");
+
+    /** log2 (1 + j / segmentsPerOctave) for each node of one octave, from the
+        2/ln2 * atanh(t) series, which is exact to float precision in 11 terms.
+    */
+    struct OctaveLevels
+    {
+        constexpr OctaveLevels() : levels {}
+        {
+            for (int j = 0; j < GainCurveTable::segmentsPerOctave; ++j)
+            {
+                const auto m = 1.0 + static_cast<double> (j) / GainCurveTable::segmentsPerOctave;
+                const auto t = (m - 1.0) / (m + 1.0);
+
+                auto power = t;
+                auto sum = 0.0;
+
+                for (int n = 0; n < 11; ++n, power *= t * t)
+                    sum += power / (2 * n + 1);
+
+                levels[j] = sum * 2.8853900817779268;
+            }
+        }
+
+        double levels[GainCurveTable::segmentsPerOctave];
+    };
+
+    constexpr OctaveLevels octaveLevels;
+}
+
+//==============================================================================
+GainCurveTable::Builder::Builder()
+    : TimeSliceThread ("Gain curve builder")
+{
+    addTimeSliceClient (this);
+    startThread (3);
+}
+
+GainCurveTable::Builder::~Builder()
+{
+    stopThread (1000);
+}
+
+int GainCurveTable::Builder::useTimeSlice()
+{
+    // Settings rarely move, and until their table is ready the compressor works
+    // the curve out itself, so there's no hurry to notice
+    if (! pending.exchange (false))
+        return idleMs;
+
+    const ScopedLock sl (lock);
+
+    for (auto* table : tables)
+        table->buildIfDirty();
+
+    return busyMs;
+}
+
+//==============================================================================
+GainCurveTable::~GainCurveTable()
+{
+    release();
+}
+
+void GainCurveTable::prepare (const GainCurveSettings& settings)
+{
+    // The builder may be halfway through a table; taking its lock waits for it
+    const ScopedLock sl (builder->lock);
+
+    if (curves == nullptr)
+        curves.allocate (3, false);
+
+    setSettings (settings);
+    curves[0].settings = settings;
+    build (curves[0].gains, settings);
+
+    published = curves.get();
+    reading = nullptr;
+    dirty = false;
+
+    builder->tables.addIfNotAlreadyThere (this);
+}
+
+void GainCurveTable::release()
+{
+    const ScopedLock sl (builder->lock);
+    builder->tables.removeFirstMatchingValue (this);
+
+    published = nullptr;
+    reading = nullptr;
+    curves.free();
+}
+
+void GainCurveTable::setSettings (const GainCurveSettings& newSettings) noexcept
+{
+    threshold.store (newSettings.threshold, std::memory_order_relaxed);
+    slope.store (newSettings.slope, std::memory_order_relaxed);
+    knee.store (newSettings.knee, std::memory_order_relaxed);
+
+    dirty.store (true, std::memory_order_release);
+    builder->pending.store (true, std::memory_order_release);
+}
+
+const float* GainCurveTable::acquire (const GainCurveSettings& settings) noexcept
+{
+    // Announce what we're about to read, then check it wasn't replaced in the
+    // meantime, so the builder can never pick it to build into
+    auto* curve = published.load();
+
+    for (;;)
+    {
+        reading = curve;
+        auto* latest = published.load();
+
+        if (latest == curve)
+            break;
+
+        curve = latest;
+    }
+
+    if (curve == nullptr || curve->settings != settings || ! covers (settings))
+        return nullptr;
+
+    return curve->gains;
+}
+
+void GainCurveTable::buildIfDirty() noexcept
+{
+    if (! dirty.exchange (false, std::memory_order_acquire))
+        return;
+
+    auto* current = published.load();
+    const GainCurveSettings wanted { threshold.load (std::memory_order_relaxed),
+                                     slope.load (std::memory_order_relaxed),
+                                     knee.load (std::memory_order_relaxed) };
+
+    if (current == nullptr || current->settings == wanted || ! covers (wanted))
+        return;
+
+    auto* inUse = reading.load();
+    auto* spare = curves.get();
+
+    while (spare == current || spare == inUse)
+        ++spare;
+
+    spare->settings = wanted;
+    build (spare->gains, wanted);
+    published = spare;
+}
+
+//==============================================================================
+double GainCurveTable::getExactGain (double level, const GainCurveSettings& settings) noexcept
+{
+    const auto overshoot = level - settings.threshold;
+    const auto halfKnee = 0.5 * settings.knee;
+
+    if (overshoot <= -halfKnee)
+        return 0.0;
+
+    if (overshoot >= halfKnee)
+        return settings.slope * overshoot;
+
+    const auto intoKnee = overshoot + halfKnee;
+    return settings.slope * intoKnee * intoKnee / (2.0 * settings.knee);
+}
+
+void GainCurveTable::build (float* gains, const GainCurveSettings& settings) noexcept
+{
+    for (int node = 0; node < numNodes; ++node)
+    {
+        const auto level = lowestOctave + node / segmentsPerOctave + octaveLevels.levels[node % segmentsPerOctave];
+        gains[node] = static_cast<float> (std::exp2 (getExactGain (level, settings)));
+    }
+}
+
+void GainCurveTable::lookup (const float* gains, float* levelInGainOut, size_t numSamples) noexcept
+{
+    // Float bits from the bottom of the table up count nodes in the exponent and
+    // top mantissa bits, and the position between them in the rest
+    constexpr auto lowestBits = static_cast<uint32_t> (127 + lowestOctave) << 23;
+    constexpr auto maxPosition = static_cast<int32_t> (numSegments) << fractionBits;
+    constexpr auto fractionMask = (1 << fractionBits) - 1;
+    constexpr auto fractionScale = 1.0f / static_cast<float> (1 << fractionBits);
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        uint32_t bits;
+        std::memcpy (&bits, levelInGainOut + i, sizeof (bits));
+
+        // Dropping the sign bit reads -0 as silence rather than as a huge level
+        const auto position = jlimit (0, maxPosition, static_cast<int32_t> ((bits & 0x7fffffffu) - lowestBits));
+        const auto node = position >> fractionBits;
+        const auto fraction = static_cast<float> (position & fractionMask) * fractionScale;
+
+        levelInGainOut[i] = gains[node] + fraction * (gains[node + 1] - gains[node]);
+    }
+}
@@ -0,0 +1,206 @@
+/*
+  ==============================================================================
+
+    This file contains the compressor's gain computer: the static curve from
+    detector level to gain, the fast log2/exp2 approximations it is evaluated
+    with while settings glide, and the precomputed curve tables it is read
+    from the rest of the time.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+namespace FastMath
+{
+    /** Approximates std::log2 for positive normal floats.
+        Max absolute error is 4e-6 (2.4e-5 dB when used as a level).
+    */
+    inline float log2 (float x) noexcept
+    {
+        uint32_t bits;
+        std::memcpy (&bits, &x, sizeof (bits));
+
+        // Pull the exponent out so that the mantissa lands in [sqrt(0.5), sqrt(2))
+        const auto offset = (bits - 0x3f3504f3u) & 0xff800000u;
+        const auto exponent = static_cast<int32_t> (offset) >> 23;
+        const auto mantissaBits = bits - offset;
+
+        float m;
+        std::memcpy (&m, &mantissaBits, sizeof (m));
+
+        // 2/ln2 * atanh(t) series, t in [-0.172, 0.172]
+        const auto t = (m - 1.0f) / (m + 1.0f);
+        const auto t2 = t * t;
+
+        return static_cast<float> (exponent)
+             + t * (2.88539008f + t2 * (0.961796694f + t2 * (0.577078016f + t2 * 0.412198583f)));
+    }
+
+    /** Approximates std::exp2 for x in [-126, 0]; inputs outside are clamped.
+        Max relative error is 2.5e-7 (2.2e-6 dB).
+    */
+    inline float exp2 (float x) noexcept
+    {
+        x = jlimit (-126.0f, 0.0f, x);
+
+        const auto n = std::floor (x + 0.5f);
+        const auto f = (x - n) * 0.693147181f;
+
+        const auto scaleBits = static_cast<uint32_t> (static_cast<int32_t> (n) + 127) << 23;
+        float scale;
+        std::memcpy (&scale, &scaleBits, sizeof (scale));
+
+        return scale * (1.0f + f * (1.0f + f * (0.5f + f * (0.166666667f
+                      + f * (0.0416666667f + f * (0.00833333333f + f * 0.00138888889f))))));
+    }
+}
+
+//==============================================================================
+/** The static curve, with every level in log2 units (dB * log2(10) / 20).
+
+    Below threshold - knee / 2 the gain is unity and above threshold + knee / 2
+    it falls by slope per unit of overshoot, where slope = 1 / ratio - 1.
+    Across the knee a quadratic joins the two, matching both in value and
+    slope. A zero knee is the hard knee dsp::Compressor has.
+*/
+struct GainCurveSettings
+{
+    float threshold = 0.0f, slope = 0.0f, knee = 0.0f;
+
+    bool operator== (const GainCurveSettings& other) const noexcept
+    {
+        return threshold == other.threshold && slope == other.slope && knee == other.knee;
+    }
+
+    bool operator!= (const GainCurveSettings& other) const noexcept    { return ! operator== (other); }
+
+    /** The gain for a level, both in log2 units. Branch-free, so loops over it auto-vectorise. */
+    static float getGain (float level, float threshold, float slope, float knee) noexcept
+    {
+        const auto overshoot = level - threshold;
+        const auto halfKnee = 0.5f * knee;
+        const auto intoKnee = jlimit (0.0f, knee, overshoot + halfKnee);
+
+        return slope * (intoKnee * intoKnee * (0.5f / jmax (knee, 1.0e-6f)) + jmax (0.0f, overshoot - halfKnee));
+    }
+};
+
+//==============================================================================
+/** The gain curve for one set of settings, sampled into a table that a level
+    is looked up in with a few integer operations, no log2 or exp2.
+
+    Nodes sit at segmentsPerOctave even steps of each octave's mantissa, so a
+    float level's exponent and top mantissa bits are the node index and the
+    bits below are the position between two nodes. The nodes' log2 levels
+    come from a one-octave base table generated at compile time; building a
+    curve only takes an exp2 per node, and happens on one background thread
+    shared by every table in the process. It only wakes up tables whose
+    settings have changed, and sleeps for idleMs while none have. The
+    finished table is published with an atomic pointer swap, and one of
+    three buffers is always free to build into without touching anything the
+    audio thread can still be reading.
+
+    Interpolating linearly between nodes, the gain stays within 0.031 dB of
+    the exact curve with a hard knee (only in the segment that straddles the
+    threshold), within 0.0022 dB with a 1 dB knee and within 0.0005 dB with a
+    knee of 6 dB or more, for any ratio up to 30:1. Levels below the table
+    read its first node, and curves whose knee starts below it are never
+    looked up (see covers()). Levels above +30 dBFS read its last node.
+*/
+class GainCurveTable
+{
+public:
+    static constexpr int segmentsPerOctave = 64;
+    static constexpr int lowestOctave = -11;    // -66.2 dBFS
+    static constexpr int highestOctave = 5;     // +30.1 dBFS
+    static constexpr int numSegments = (highestOctave - lowestOctave) * segmentsPerOctave;
+
+    // One more node than segments to end the last one, and a spare so the
+    // top node can interpolate like any other
+    static constexpr int numNodes = numSegments + 2;
+
+    GainCurveTable() = default;
+    ~GainCurveTable();
+
+    /** Allocates the tables and builds the curve for these settings before returning. */
+    void prepare (const GainCurveSettings& settings);
+
+    /** Stops following the settings and frees the tables. */
+    void release();
+
+    size_t getMemoryBytes() const noexcept          { return curves != nullptr ? 3 * sizeof (Curve) : 0; }
+
+    /** Asks for a curve for new settings. It is built in the background, so this
+        never blocks and is safe to call from the audio thread.
+    */
+    void setSettings (const GainCurveSettings& newSettings) noexcept;
+
+    /** The published table if it was built for these settings and covers every
+        level where they reduce gain, otherwise nullptr. Call it once per block,
+        from the audio thread only: the table stays valid until the next call.
+    */
+    const float* acquire (const GainCurveSettings& settings) noexcept;
+
+    /** True if the table's range reaches below where these settings start reducing gain. */
+    static bool covers (const GainCurveSettings& settings) noexcept
+    {
+        return settings.threshold - 0.5f * settings.knee >= static_cast<float> (lowestOctave);
+    }
+
+    /** The exact curve in double precision, which tables are built from and measured against. */
+    static double getExactGain (double level, const GainCurveSettings& settings) noexcept;
+
+    /** Fills a table's numNodes gains from the exact curve. */
+    static void build (float* gains, const GainCurveSettings& settings) noexcept;
+
+    /** Replaces each level in a row with its gain, read from a table. */
+    static void lookup (const float* gains, float* levelInGainOut, size_t numSamples) noexcept;
+
+private:
+    struct Curve
+    {
+        GainCurveSettings settings;
+        float gains[numNodes];
+    };
+
+    /** The one thread and client that builds every prepared table's curves. */
+    struct Builder  : public TimeSliceThread,
+                      private TimeSliceClient
+    {
+        Builder();
+        ~Builder() override;
+
+        int useTimeSlice() override;
+
+        // Held while building, so a table is never freed under it
+        CriticalSection lock;
+        Array<GainCurveTable*> tables;
+
+        // Set along with any table's dirty flag, so an idle slice doesn't visit every table
+        std::atomic<bool> pending { false };
+
+        static constexpr int idleMs = 100;
+        static constexpr int busyMs = 5;
+    };
+
+    void buildIfDirty() noexcept;
+
+    //==============================================================================
+    SharedResourcePointer<Builder> builder;
+    HeapBlock<Curve> curves;
+
+    // Only the builder publishes, and it never builds into what the audio thread
+    // has published or is reading
+    std::atomic<Curve*> published { nullptr }, reading { nullptr };
+
+    // Written by the audio thread, read by the builder; a torn read just builds a
+    // table nobody asks for, and the dirty flag set again brings it back for the right one
+    std::atomic<float> threshold { 0.0f }, slope { 0.0f }, knee { 0.0f };
+    std::atomic<bool> dirty { false };
+
+    JUCE_DECLARE_NON_COPYABLE (GainCurveTable)
+};
@@ -0,0 +1,4137 @@
+/*
+  ==============================================================================
+
+    This file contains Resources/knob2.png as bytes, so the knob filmstrip is
+    part of the plugin binary whatever builds it. Regenerate it with JUCE's
+    BinaryBuilder, or any byte dump in this layout, when the image changes.
+
+  ==============================================================================
+*/
+
+#include "KnobImage.h"
+
+namespace KnobImage
+{
+    static const unsigned char data[] =
+    {
+137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,128,0,0,32,0,8,6,0,0,0,18,51,76,143,0,3,120,112,73,68,65,84,120,218,236,189,219,123,28,87,153,239,223,127,128,111,116,233,235,36,74,226,36,78,130,
+200,222,227,208,48,228,224,32,79,236,196,56,145,15,58,171,229,131,108,203,146,101,91,146,207,182,146,8,162,48,152,1,178,25,206,48,52,204,110,192,1,115,26,134,131,152,48,176,7,16,51,19,6,193,204,48,
+143,2,252,102,4,179,155,92,249,214,23,189,126,239,167,118,149,89,89,89,85,93,213,170,238,174,86,175,245,60,159,199,126,108,169,14,239,247,173,111,173,115,229,114,174,184,226,138,43,174,184,226,138,43,
+174,184,178,30,202,220,220,124,135,144,23,10,194,188,80,20,22,133,101,97,85,184,46,220,16,42,62,55,252,127,91,245,127,102,209,255,157,121,255,24,28,171,195,69,54,187,130,119,9,147,66,73,88,17,84,157,
+88,241,207,193,185,186,92,228,155,84,46,95,126,110,131,208,43,20,133,178,160,154,68,217,191,6,174,101,131,83,166,206,229,210,165,103,123,132,171,66,69,80,25,163,226,95,91,143,83,42,93,209,59,133,5,
+161,156,65,209,195,40,251,215,220,233,20,172,177,92,188,248,76,94,40,9,170,22,166,167,207,168,163,71,39,85,161,112,80,245,245,13,169,167,159,222,171,158,120,98,151,250,179,63,123,66,189,227,29,143,
+171,71,31,237,86,143,60,242,14,15,254,254,216,99,127,166,182,109,219,225,253,204,83,79,237,81,189,189,131,106,100,228,128,58,114,100,66,157,58,117,90,213,122,29,254,61,228,157,162,201,132,191,150,36,
+200,231,207,95,86,199,142,77,169,161,161,81,181,107,215,110,79,76,68,213,69,14,227,225,135,31,139,228,161,135,182,122,112,172,157,59,159,86,3,3,35,106,124,252,184,119,206,132,137,112,205,37,66,68,185,
+112,97,174,83,40,10,42,14,179,179,231,212,129,3,135,189,39,59,16,59,45,209,117,225,163,120,231,59,123,212,232,232,33,53,51,115,86,197,189,110,255,30,221,171,65,47,242,52,205,241,68,197,97,108,108,220,
+42,122,154,79,123,24,111,127,251,163,161,144,12,7,15,30,81,113,239,131,123,118,194,159,191,220,45,44,87,11,22,239,243,193,193,130,234,238,222,158,57,225,225,79,255,244,145,155,112,61,212,57,168,55,
+196,72,2,238,189,187,45,197,63,119,238,210,21,65,69,113,226,196,140,87,25,171,135,232,105,11,111,99,247,238,94,53,53,53,173,170,221,39,177,104,39,225,187,132,165,168,128,240,196,243,20,101,241,105,
+143,35,252,219,222,246,240,235,216,179,167,207,115,132,42,73,64,76,214,119,239,226,217,179,23,11,66,69,80,97,12,15,239,87,91,183,110,203,180,205,199,21,94,135,255,167,5,17,117,239,126,108,10,235,82,
+252,51,103,46,44,8,42,12,218,236,180,193,91,205,230,163,68,135,183,190,245,161,215,65,61,230,240,225,99,42,42,22,196,106,189,137,95,138,186,225,254,254,225,150,183,249,106,194,155,236,221,219,95,45,9,
+74,45,47,252,233,211,231,59,132,69,65,217,152,152,56,161,158,124,242,169,117,99,243,113,132,207,231,223,126,19,122,30,233,84,10,139,143,31,187,142,86,21,127,163,176,20,118,115,251,247,143,173,91,155,
+175,38,188,9,93,206,17,73,64,12,55,182,148,248,179,179,231,54,10,175,208,91,103,3,203,111,7,155,143,18,29,222,242,150,63,189,9,45,133,176,120,249,177,220,216,42,226,119,8,75,97,55,67,219,184,157,108,
+190,154,240,58,140,53,68,36,1,49,205,254,235,96,102,230,236,34,125,227,38,180,131,25,168,105,87,155,143,18,62,224,193,7,223,166,30,127,252,73,47,86,182,24,18,219,76,139,63,61,125,166,68,39,142,201,
+201,147,179,94,101,175,221,109,62,74,120,29,154,138,244,130,218,98,73,140,179,42,254,66,92,241,219,217,230,195,68,183,37,1,177,11,73,130,108,245,19,136,101,21,176,45,27,140,146,57,155,143,47,252,150,
+45,111,189,9,147,87,194,226,74,204,179,34,126,151,80,177,93,36,195,182,206,230,147,11,175,67,239,104,72,2,16,243,230,143,29,136,77,45,97,85,38,251,246,13,56,155,175,81,116,157,63,249,147,188,247,32,
+217,98,76,236,155,42,190,84,84,174,80,89,49,97,64,199,217,124,237,194,35,186,9,125,39,182,88,163,65,179,196,239,182,93,16,51,118,156,205,167,39,188,14,51,142,66,146,160,241,147,74,166,166,166,151,153,
+236,96,178,125,251,78,103,243,53,216,124,20,255,243,127,190,197,131,202,180,45,230,104,209,104,241,231,108,23,66,119,166,179,249,116,158,246,64,116,19,90,85,33,73,208,152,57,134,199,143,159,234,20,
+148,9,179,99,157,205,215,79,248,128,255,241,63,30,244,234,88,54,13,208,166,238,9,48,57,121,178,40,40,19,218,172,206,230,235,43,124,0,113,181,105,128,54,245,22,63,111,59,49,77,62,103,243,233,139,110,
+10,175,67,211,48,36,9,234,183,248,100,98,226,196,53,38,113,232,48,189,41,120,239,59,155,79,255,105,183,241,192,3,91,188,159,163,197,101,234,129,70,245,18,63,111,57,153,183,142,206,217,124,227,132,215,
+161,197,101,211,4,173,82,79,128,99,199,166,74,172,191,211,161,93,234,108,190,126,54,31,38,188,14,51,171,76,93,208,42,85,241,199,199,143,119,50,119,205,132,241,125,103,243,141,121,218,109,188,249,205,
+127,226,85,190,109,218,160,89,154,9,176,96,158,192,124,250,157,205,55,70,120,68,55,97,145,172,37,1,210,27,50,62,122,116,178,204,188,125,29,106,161,206,230,27,99,243,97,194,7,48,98,104,234,131,102,105,
+137,223,99,57,184,215,45,233,108,190,49,54,31,69,87,215,255,244,174,197,166,17,218,173,57,1,142,28,153,184,202,46,25,58,44,216,116,54,223,156,167,93,23,94,135,201,182,166,78,104,183,38,241,165,141,
+191,65,168,208,214,215,97,226,162,179,249,198,11,111,138,174,67,95,140,169,147,175,221,134,181,36,64,175,121,80,154,29,206,230,27,111,243,81,188,233,77,255,195,131,241,24,75,18,244,214,156,0,99,99,
+227,69,122,155,116,24,241,115,54,223,28,155,15,19,62,128,145,66,83,47,52,92,75,2,148,205,3,210,238,116,54,223,28,155,183,137,174,67,119,188,37,1,106,107,13,28,58,116,180,75,80,58,180,253,157,205,55,
+215,230,195,184,255,254,7,60,232,19,48,117,67,203,90,18,96,210,60,16,187,118,56,155,111,174,205,135,9,31,192,43,218,146,0,147,137,19,64,158,246,18,79,188,14,107,215,156,205,63,216,244,167,221,38,124,
+0,175,104,83,55,180,76,156,0,98,37,43,216,137,14,59,108,58,155,111,190,205,135,113,223,125,111,246,244,48,117,67,203,164,226,119,88,14,242,6,235,119,54,223,28,155,183,9,31,192,207,219,180,67,211,216,
+9,32,109,253,60,237,125,29,246,233,115,54,159,13,155,183,9,175,195,26,2,83,63,52,77,146,0,5,243,0,84,46,156,205,111,201,212,211,30,6,195,244,150,4,136,191,150,112,116,244,208,60,189,74,58,84,0,157,
+205,103,87,248,123,239,237,186,9,21,65,83,63,52,141,157,0,133,194,193,34,219,172,235,208,255,239,108,62,59,54,111,19,62,128,145,90,83,63,52,77,146,0,139,230,1,216,130,221,217,124,118,108,222,38,124,0,
+245,52,75,2,196,223,93,100,100,228,192,50,59,87,233,48,218,228,108,62,59,54,111,99,243,230,55,121,16,47,83,63,52,77,146,0,171,230,1,24,253,115,54,159,29,155,183,9,31,192,117,91,18,96,53,118,2,12,15,
+239,191,206,242,35,29,108,197,217,124,118,108,222,38,124,0,199,55,245,67,211,216,9,48,52,52,122,131,207,175,232,84,19,222,217,124,115,158,246,48,76,253,208,52,73,2,84,204,3,56,155,207,182,240,247,220,
+115,255,235,176,36,64,37,118,2,12,14,22,42,244,252,233,56,155,207,150,205,135,9,31,96,234,135,166,73,18,224,134,45,1,156,205,103,199,230,195,132,7,254,223,146,0,241,95,1,3,3,35,215,249,184,129,14,117,
+0,103,243,217,178,121,147,187,239,190,207,131,99,153,250,161,105,236,4,232,239,31,94,101,64,65,135,86,128,179,249,108,217,188,41,124,0,215,109,234,135,166,73,18,96,217,60,0,253,0,206,230,179,99,243,
+54,225,3,136,145,37,1,226,119,4,245,245,13,45,50,253,75,135,158,64,103,243,15,100,238,105,183,193,67,106,234,135,166,73,18,160,104,30,128,177,0,103,243,217,21,254,174,187,238,189,9,19,119,44,9,16,127,
+48,168,183,119,112,158,229,95,58,12,49,58,155,207,142,205,219,132,15,224,75,44,166,126,104,26,59,1,246,237,27,40,176,239,143,14,43,80,179,110,243,51,51,167,213,135,62,244,97,117,246,236,133,117,111,
+243,54,225,3,120,88,77,253,208,52,73,2,228,205,3,176,21,76,150,109,254,75,95,250,178,122,237,181,215,110,242,173,111,125,103,93,219,188,141,77,155,54,123,176,66,200,146,0,241,167,132,237,221,219,223,
+193,103,205,76,76,235,207,138,205,155,226,7,224,4,235,213,230,109,194,3,63,111,211,14,77,19,205,12,150,95,88,49,15,66,83,48,107,181,249,48,241,129,215,193,122,181,121,83,248,0,226,107,17,127,37,241,
+186,128,61,123,250,74,76,4,213,161,37,144,165,218,124,148,248,112,234,212,236,186,181,249,48,120,72,77,221,208,50,113,2,236,222,221,59,201,166,3,58,59,118,188,51,51,181,249,106,226,191,244,210,151,
+215,173,205,219,184,243,206,123,60,248,24,165,169,27,90,214,146,0,93,230,129,122,122,246,101,162,211,38,174,248,235,213,230,109,194,7,176,119,147,37,1,106,251,178,136,8,94,70,116,29,58,25,154,217,105,
+131,184,209,226,127,105,221,219,188,77,120,32,254,166,94,104,88,243,254,0,242,203,69,243,128,172,15,108,86,167,205,90,196,95,79,54,31,6,221,245,150,4,168,125,131,8,177,147,94,44,69,135,54,102,51,250,
+230,107,21,127,61,218,188,201,29,119,220,237,193,231,249,76,189,208,112,45,9,176,65,168,152,7,101,104,184,145,93,180,181,136,191,94,109,222,38,60,16,119,139,248,104,87,251,38,81,148,167,158,218,115,
+149,94,64,29,62,106,216,168,190,249,36,226,183,131,205,155,194,7,176,26,200,212,9,237,214,188,79,224,174,93,187,123,88,108,104,66,75,160,222,67,176,113,197,111,39,155,183,193,241,109,26,161,93,42,187,
+133,202,129,202,230,193,169,112,212,115,36,14,113,171,137,223,110,54,111,227,246,219,239,242,166,235,89,196,79,103,171,88,138,84,252,22,168,252,233,208,41,84,175,33,216,181,136,191,158,109,222,20,62,
+128,239,6,152,250,160,89,154,9,208,105,57,129,215,39,144,246,76,155,90,197,95,239,54,111,138,30,16,124,73,204,66,186,31,144,218,185,243,233,18,123,4,232,176,100,60,205,113,247,90,196,111,23,155,15,
+131,174,95,83,23,180,74,253,139,33,210,198,204,211,206,52,193,5,210,152,112,145,68,252,118,180,249,176,167,223,166,9,90,213,229,187,65,114,224,107,230,201,120,255,172,117,210,69,92,241,219,213,230,77,
+58,59,55,121,127,50,243,199,34,126,125,62,26,69,121,226,137,93,121,166,134,153,240,225,136,90,199,221,227,136,223,238,54,31,136,174,67,205,223,166,5,26,213,245,219,129,114,130,162,237,196,244,11,36,
+157,112,81,77,252,171,87,191,212,246,54,111,10,15,220,91,136,248,245,253,112,36,69,154,127,157,52,1,77,182,110,221,150,104,8,182,86,241,219,201,230,195,160,15,198,166,1,218,52,228,251,193,242,222,159,
+227,221,111,194,24,65,156,209,184,90,196,111,71,155,55,185,237,182,59,189,138,159,45,246,104,210,208,47,136,203,9,151,109,23,194,171,32,170,111,254,47,254,226,3,137,196,111,87,155,55,133,7,238,55,68,
+252,198,126,62,158,242,248,227,79,118,211,15,96,194,188,193,168,238,217,31,255,248,39,85,197,119,54,255,122,225,3,88,240,97,139,57,90,228,154,81,228,196,87,108,23,68,171,32,172,183,110,113,241,123,
+161,226,59,155,127,163,232,1,236,205,24,34,254,149,92,51,139,180,69,151,104,143,154,208,76,177,181,221,79,156,56,101,17,255,37,103,243,33,194,3,175,85,91,140,137,125,174,217,101,219,182,29,93,66,133,
+46,73,19,22,146,216,106,242,36,193,119,191,187,40,175,131,31,171,247,189,239,253,206,230,35,160,131,205,22,91,63,230,93,185,44,20,185,144,66,200,69,122,217,235,106,243,201,68,135,91,111,189,195,115,
+208,176,184,18,243,92,150,74,119,247,246,5,102,10,153,48,137,148,137,35,174,54,191,41,150,232,1,196,132,216,217,98,74,172,115,89,44,114,97,37,219,5,211,50,176,37,129,179,249,55,10,31,136,79,204,66,
+196,47,229,178,92,36,107,23,201,92,19,61,9,156,205,219,133,7,94,147,196,202,22,67,98,155,203,122,145,139,239,16,150,184,9,27,212,9,156,205,219,161,243,44,44,110,126,76,59,114,173,80,228,66,55,10,175,
+132,221,12,173,131,118,183,121,19,220,49,66,124,98,185,49,215,74,101,235,214,109,27,133,37,6,137,108,208,79,208,174,54,175,115,203,45,183,123,15,68,88,156,252,24,182,150,248,90,18,116,8,139,97,55,71,
+143,33,182,215,78,54,31,136,14,220,15,51,170,34,196,39,118,29,185,86,47,143,62,218,93,162,31,59,12,234,5,237,96,243,129,240,64,7,79,84,76,136,89,110,61,21,185,161,133,168,27,102,40,153,142,143,245,
+106,243,1,92,51,175,191,42,226,47,228,214,99,121,228,145,119,20,132,10,203,152,194,96,188,187,21,132,79,34,58,4,21,189,168,123,247,99,83,200,173,231,242,240,195,143,117,9,75,204,106,9,131,186,1,235,
+13,90,221,230,3,168,231,176,117,75,212,61,251,49,233,202,181,75,145,155,189,82,37,32,55,167,156,183,154,205,7,4,95,240,170,118,159,196,34,215,142,229,161,135,182,118,11,203,130,138,130,68,192,62,121,
+53,100,217,230,129,223,99,110,36,194,87,187,47,255,222,187,115,237,94,36,8,115,49,130,229,65,29,129,238,210,172,9,79,19,150,214,76,220,251,224,158,115,174,252,177,200,123,191,83,40,242,254,143,3,79,
+24,187,148,4,201,208,12,155,71,116,156,137,107,137,123,221,254,61,118,58,197,67,138,84,150,242,194,53,42,77,113,225,21,65,111,26,245,5,186,150,245,132,72,75,116,254,206,43,136,10,29,46,196,57,147,92,
+163,127,79,121,167,112,178,68,40,37,12,242,77,104,107,99,201,180,38,168,140,145,24,65,29,34,72,140,64,100,254,30,44,183,162,181,193,147,141,179,144,80,28,131,239,37,213,122,29,254,61,56,225,107,45,
+242,164,117,10,11,66,153,167,174,69,40,251,215,236,172,62,229,100,232,17,174,10,149,12,138,94,241,175,173,199,41,85,231,34,149,174,13,66,175,80,20,202,84,194,154,68,217,191,6,174,101,131,83,166,73,37,
+159,127,123,151,48,41,148,132,21,230,208,215,137,21,255,28,156,171,203,69,62,187,9,209,33,228,133,130,48,47,20,133,69,97,89,88,21,174,11,55,132,138,207,13,255,223,86,253,159,89,244,127,103,222,63,6,
+199,234,112,145,117,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,201,76,153,155,155,239,16,242,66,65,152,23,138,194,162,176,44,172,10,215,133,27,66,197,231,134,255,
+111,171,254,207,44,250,191,51,239,31,131,99,185,174,224,12,11,222,37,76,10,37,97,69,80,117,98,197,63,7,231,114,131,65,205,42,151,47,63,183,65,232,21,138,66,89,80,77,162,236,95,3,215,226,134,131,235,
+93,46,93,122,182,71,184,42,84,4,149,49,42,254,181,185,9,33,41,139,222,41,44,8,229,12,138,30,70,217,191,102,55,37,172,214,114,241,226,51,121,161,36,168,90,152,158,62,163,142,30,157,84,133,194,65,213,
+215,55,228,125,71,143,29,181,217,95,143,237,86,88,132,25,172,201,227,239,108,196,192,238,91,252,12,159,92,235,237,29,84,35,35,7,212,145,35,19,234,212,169,211,170,214,235,240,239,193,77,10,77,40,252,
+181,36,65,62,127,254,178,58,118,108,74,13,13,141,122,95,204,66,204,96,165,109,149,197,152,85,151,109,5,11,57,56,22,159,99,25,24,24,81,227,227,199,189,115,38,76,132,107,46,17,34,202,133,11,115,157,66,
+81,80,113,152,157,61,167,14,28,56,236,61,217,230,242,234,181,138,174,11,31,5,31,103,26,29,61,164,102,102,206,170,184,215,237,223,163,123,53,232,69,158,166,57,158,168,56,140,141,141,91,69,79,243,105,
+15,35,106,197,15,201,112,240,224,17,21,247,62,184,103,39,252,249,203,221,194,114,181,96,241,62,31,28,44,120,251,228,101,77,120,208,23,130,112,61,212,57,168,55,196,72,2,238,189,61,23,135,158,59,119,
+233,138,160,162,56,113,98,198,171,140,213,67,244,180,133,183,177,123,119,175,154,154,154,86,213,238,147,88,180,147,240,93,194,82,84,64,120,226,121,138,178,248,180,199,17,222,92,52,178,103,79,159,231,
+8,85,146,128,152,172,239,222,197,179,103,47,22,132,138,160,194,24,30,222,239,237,144,149,101,155,143,43,188,14,255,79,11,34,234,222,253,216,172,207,45,98,206,156,185,176,32,168,48,104,179,211,6,111,
+53,155,175,182,100,204,92,77,68,61,230,240,225,99,42,42,22,196,106,189,137,95,138,186,225,254,254,225,150,183,249,106,194,155,236,221,219,95,45,9,90,127,155,184,211,167,207,119,8,139,130,178,49,49,
+113,194,251,218,229,122,177,249,56,194,235,75,205,232,121,164,83,41,44,62,126,236,58,90,85,252,141,194,82,216,205,237,223,63,182,110,109,190,154,240,38,116,57,71,36,1,49,108,173,173,98,103,103,207,
+109,20,94,161,183,206,6,150,223,14,54,95,109,177,41,155,88,4,208,82,8,139,151,31,203,141,173,34,126,135,176,20,118,51,180,141,219,201,230,171,9,175,195,88,67,68,18,16,211,236,191,14,102,102,206,46,
+210,55,110,66,59,152,129,154,118,181,249,40,225,3,216,138,134,79,193,17,43,91,12,137,109,166,197,159,158,62,83,162,19,199,228,228,201,89,175,178,215,238,54,31,37,188,14,77,69,122,65,109,177,36,198,89,
+21,127,33,174,248,237,108,243,97,162,219,146,128,216,133,36,65,182,250,9,196,178,10,216,150,13,70,201,156,205,199,23,126,203,150,183,222,132,201,43,97,113,37,230,89,17,191,75,168,216,46,146,97,91,103,
+243,201,133,215,161,119,52,36,1,136,121,243,199,14,196,166,150,176,42,147,125,251,6,156,205,215,40,186,14,27,96,242,32,217,98,76,236,155,42,190,84,84,174,80,89,49,97,64,199,217,124,237,194,35,186,9,
+125,39,182,88,163,65,179,196,239,182,93,16,51,118,156,205,167,39,188,14,51,142,66,146,160,241,147,74,166,166,166,151,153,236,96,178,125,251,78,103,243,53,216,124,20,236,77,12,84,166,109,49,71,139,70,
+139,63,103,187,16,186,51,157,205,167,243,180,7,162,155,208,170,10,73,130,198,204,49,60,126,252,84,167,160,76,152,29,235,108,190,126,194,7,176,121,53,117,44,155,6,104,83,247,4,152,156,60,89,20,148,9,
+109,86,103,243,245,21,62,128,184,218,52,64,155,122,139,159,183,157,152,38,159,179,249,244,69,55,133,215,161,105,24,146,4,245,91,124,50,49,113,226,26,147,56,116,152,222,20,188,247,157,205,167,255,180,
+219,224,75,41,252,28,45,46,83,15,52,170,151,248,121,203,201,188,117,116,206,230,27,39,188,14,45,46,155,38,104,149,122,2,28,59,54,85,98,253,157,14,237,82,103,243,245,179,249,48,225,117,152,89,101,234,
+130,86,169,138,63,62,126,188,147,185,107,38,140,239,59,155,111,204,211,110,131,15,86,81,249,182,105,131,102,105,38,192,130,121,2,243,233,119,54,223,24,225,17,221,132,69,178,150,4,72,111,200,248,232,
+209,201,50,243,246,117,168,133,58,155,111,140,205,135,9,31,192,136,161,169,15,154,165,37,126,143,229,224,94,183,164,179,249,198,216,124,20,124,21,141,107,177,105,132,118,107,78,128,35,71,38,174,178,
+75,134,14,11,54,157,205,55,231,105,215,133,215,97,178,173,169,19,218,173,73,124,105,227,111,16,42,180,245,117,152,184,232,108,190,241,194,155,162,235,208,23,99,234,228,107,183,97,45,9,208,107,30,148,
+102,135,179,249,198,219,124,20,124,224,18,24,143,177,36,65,111,205,9,48,54,54,94,164,183,73,135,17,63,103,243,205,177,249,48,225,3,24,41,52,245,66,195,181,36,64,217,60,32,237,78,103,243,205,177,121,
+155,232,58,116,199,91,18,160,182,214,192,161,67,71,187,4,165,67,219,223,217,124,115,109,62,140,251,239,127,192,131,62,1,83,55,180,172,37,1,38,205,3,177,107,135,179,249,230,218,124,152,240,1,188,162,
+45,9,48,153,56,1,228,105,47,241,196,235,176,118,205,217,252,131,77,127,218,109,194,7,240,138,54,117,67,203,196,9,32,86,178,130,157,232,176,195,166,179,249,230,219,124,24,247,221,247,102,79,15,83,55,
+180,76,42,126,135,229,32,111,176,126,103,243,205,177,121,155,240,1,252,188,77,59,52,141,157,0,210,214,207,211,222,215,97,159,62,103,243,217,176,121,155,240,58,172,33,48,245,67,211,36,9,80,48,15,64,
+229,194,217,252,150,76,61,237,97,48,76,111,73,128,248,107,9,71,71,15,205,211,171,164,67,5,208,217,124,118,133,191,247,222,174,155,80,17,52,245,67,211,216,9,80,40,28,44,178,205,186,14,253,255,206,230,
+179,99,243,54,225,3,24,169,53,245,67,211,36,9,176,104,30,128,45,216,157,205,103,199,230,109,194,7,80,79,179,36,64,252,221,69,70,70,14,44,179,115,149,14,163,77,206,230,179,99,243,54,54,111,126,147,7,
+241,50,245,67,211,36,9,176,106,30,128,209,63,103,243,217,177,121,155,240,1,92,183,37,1,86,99,39,192,240,240,254,235,44,63,210,193,86,156,205,103,199,230,109,194,7,112,124,83,63,52,141,157,0,67,67,163,
+55,248,252,138,78,53,225,157,205,55,231,105,15,195,212,15,77,147,36,64,197,60,128,179,249,108,11,127,207,61,247,191,14,75,2,84,98,39,192,224,96,161,66,207,159,142,179,249,108,217,124,152,240,1,166,
+126,104,154,36,1,110,216,18,192,217,124,118,108,62,76,120,224,255,45,9,16,255,21,48,48,48,114,157,143,27,232,80,7,112,54,159,45,155,55,185,251,238,251,60,56,150,169,31,154,198,78,128,254,254,225,85,6,
+20,116,104,5,56,155,207,150,205,155,194,7,112,221,166,126,104,154,36,1,150,205,3,208,15,224,108,62,59,54,111,19,62,128,24,89,18,32,126,71,80,95,223,208,34,211,191,116,232,9,116,54,255,64,230,158,118,
+27,60,164,166,126,104,154,36,1,138,230,1,24,11,112,54,159,93,225,239,186,235,222,155,48,113,199,146,0,241,7,131,122,123,7,231,89,254,165,195,16,99,150,109,126,207,158,94,53,55,247,172,58,126,252,100,
+91,216,188,77,248,0,190,196,98,234,135,166,177,19,96,223,190,129,2,251,254,232,176,2,53,171,54,255,231,127,126,69,189,246,218,107,55,121,249,229,239,123,73,186,158,109,222,38,124,0,15,171,169,31,154,
+38,73,128,188,121,0,182,130,201,162,205,127,234,83,127,245,58,241,3,62,240,129,23,215,181,205,219,216,180,105,179,7,43,132,44,9,16,127,74,216,222,189,253,29,124,214,204,196,180,254,102,214,230,223,
+242,150,183,169,175,125,237,235,86,241,225,155,223,252,219,117,109,243,54,225,129,159,183,105,135,166,137,102,6,203,47,172,152,7,161,41,152,133,218,252,142,29,239,84,255,240,15,63,10,21,31,62,250,209,
+143,175,107,155,55,133,15,32,190,22,241,87,18,175,11,216,179,167,175,196,68,80,29,90,2,205,174,205,143,140,236,87,191,250,213,127,68,138,191,188,188,44,215,186,109,93,219,124,24,60,164,166,110,104,
+153,56,1,118,239,238,157,100,211,1,29,158,188,102,118,218,156,58,53,27,41,60,252,221,223,189,236,37,234,122,182,121,27,119,222,121,143,7,31,163,52,117,67,203,90,18,160,203,60,80,79,207,190,166,117,
+218,60,255,252,11,85,197,191,122,245,165,215,189,247,215,171,205,219,132,15,96,239,38,75,2,212,246,101,17,17,188,140,232,58,116,50,52,186,211,230,99,31,251,68,85,241,63,252,225,143,182,141,205,219,
+132,7,226,111,234,133,134,53,239,15,32,191,92,52,15,200,250,192,70,245,205,227,52,95,254,242,181,170,226,207,207,191,187,173,108,62,12,186,235,45,9,80,251,6,17,98,39,189,88,138,14,109,204,70,116,209,
+254,217,159,237,80,127,255,247,63,136,20,254,15,127,248,131,215,243,215,110,54,111,114,199,29,119,123,240,121,62,83,47,52,92,75,2,108,16,42,230,65,25,26,174,103,223,252,192,192,176,250,215,127,253,
+215,72,241,255,245,95,255,77,245,247,15,181,157,205,219,132,7,226,110,17,31,237,106,223,36,138,242,212,83,123,174,210,11,168,195,71,13,235,53,40,195,19,205,147,29,37,254,15,126,240,3,169,237,110,111,
+75,155,55,133,15,96,53,144,169,19,218,173,121,159,192,93,187,118,247,176,216,208,132,247,115,218,67,176,207,61,247,174,170,239,123,234,4,188,126,218,213,230,109,112,124,155,70,104,151,202,110,161,114,
+160,178,121,112,42,28,105,14,193,126,248,195,31,169,42,62,173,129,118,182,121,27,183,223,126,151,55,93,207,34,126,58,91,197,82,164,226,183,64,229,79,135,78,161,52,132,231,223,190,248,197,151,170,138,
+255,238,119,47,180,189,205,155,194,7,240,221,0,83,31,52,75,51,1,58,45,39,240,250,4,214,50,211,134,238,90,122,238,170,137,127,234,212,76,219,219,188,41,122,64,240,37,49,11,233,126,64,106,231,206,167,
+75,236,17,160,195,146,241,90,39,92,236,219,215,175,126,254,243,229,72,225,255,227,63,254,67,13,13,21,156,205,91,132,15,160,235,215,212,5,173,82,255,98,136,180,49,243,180,51,77,112,129,164,19,46,198,
+199,39,213,239,127,255,251,72,241,25,237,35,193,156,205,135,195,211,111,211,4,173,234,242,221,32,57,240,53,243,100,188,127,146,76,186,184,124,249,153,170,150,255,213,175,126,205,187,57,103,243,118,58,
+59,55,121,127,50,243,199,34,126,125,62,26,69,121,226,137,93,121,166,134,153,240,225,136,56,227,238,47,190,248,161,170,226,127,242,147,159,118,54,31,34,186,14,53,127,155,22,104,84,215,111,7,202,9,138,
+182,19,211,47,16,53,4,251,137,79,124,178,170,248,47,188,240,231,206,230,171,8,15,220,91,136,248,245,253,112,36,69,154,127,157,52,1,77,182,110,221,22,58,26,71,47,85,53,241,103,102,206,56,155,175,34,
+124,0,125,48,54,13,208,166,33,223,15,150,247,254,28,239,126,19,198,8,108,9,240,244,211,123,66,133,127,245,213,87,213,232,232,1,103,243,85,68,135,219,110,187,211,171,27,217,98,143,38,13,253,130,184,
+156,112,217,118,33,188,10,108,61,117,255,254,239,191,122,131,248,63,249,201,146,216,214,59,157,205,199,16,30,184,223,16,241,27,251,249,120,138,52,209,186,105,166,153,48,29,203,214,116,59,124,120,92,
+253,230,55,191,185,41,254,215,191,254,13,111,201,185,179,249,234,194,7,176,224,195,22,115,180,200,53,163,200,137,175,216,46,136,86,129,45,9,24,196,41,20,14,120,211,148,156,205,199,19,61,128,189,25,67,
+196,191,146,107,102,145,182,232,18,237,81,19,154,41,174,54,191,118,225,129,215,170,45,198,196,62,215,236,178,109,219,142,46,161,66,151,164,9,11,73,92,109,190,118,225,129,14,54,91,108,253,152,119,229,
+178,80,228,66,10,33,23,233,101,175,179,249,100,162,195,173,183,222,225,57,104,88,92,137,121,46,75,165,187,123,251,2,51,133,76,152,68,202,196,17,103,243,155,98,137,30,64,76,136,157,45,166,196,58,151,
+197,34,23,86,178,93,48,45,3,91,18,56,155,127,163,240,129,248,196,44,68,252,82,46,203,69,178,118,145,204,53,209,147,192,217,188,93,120,224,53,73,172,108,49,36,182,185,172,23,185,248,14,97,137,155,176,
+65,157,192,217,188,29,58,207,194,226,230,199,180,35,215,10,69,46,116,163,240,74,216,205,208,58,104,119,155,55,193,29,35,196,39,150,27,115,173,84,182,110,221,182,81,88,98,144,200,6,253,4,237,106,243,
+58,183,220,114,187,247,64,132,197,201,143,97,107,137,175,37,65,135,176,24,118,115,244,24,98,123,237,100,243,129,232,192,253,48,163,42,66,124,98,215,145,107,245,242,232,163,221,37,250,177,195,160,94,
+208,14,54,31,8,15,116,240,68,197,132,152,229,214,83,145,27,90,136,186,97,134,146,233,248,88,175,54,31,192,53,243,250,171,34,254,66,110,61,150,71,30,121,71,65,168,48,65,36,12,198,187,91,65,248,36,162,
+67,80,209,139,186,119,63,54,133,220,122,46,15,63,252,88,151,176,196,172,150,48,168,27,176,222,160,213,109,62,128,122,14,91,183,68,221,179,31,147,174,92,187,20,185,217,43,85,2,114,115,202,121,171,217,
+124,64,240,5,175,106,247,73,44,114,237,88,30,122,104,107,183,176,44,168,40,72,4,236,147,87,67,150,109,30,248,61,230,70,34,124,181,251,242,239,189,59,215,238,69,130,48,23,35,88,30,212,17,232,46,205,
+154,240,52,97,105,205,196,189,15,238,57,231,202,31,139,188,247,59,133,34,239,255,56,240,132,49,195,40,72,134,102,216,60,162,227,76,92,75,220,235,246,239,177,211,41,30,82,164,178,148,23,174,81,105,138,
+11,175,136,96,111,96,186,150,245,132,72,75,116,254,206,43,136,10,29,46,196,57,147,92,163,127,79,121,167,112,178,68,40,37,12,242,77,104,107,99,201,180,38,168,140,145,24,65,29,34,72,140,64,100,254,30,
+44,183,162,181,193,147,141,179,4,27,85,49,121,181,214,235,240,239,193,9,95,107,145,39,173,83,88,16,202,60,117,45,66,217,191,102,103,245,41,39,67,143,112,85,168,100,80,244,138,127,109,61,78,169,58,23,
+169,116,109,16,122,133,162,80,166,18,214,36,202,254,53,112,45,27,156,50,77,42,249,252,219,187,132,73,161,36,172,48,135,190,78,172,248,231,224,92,93,46,242,217,77,136,14,33,47,20,132,121,161,40,44,10,
+203,194,170,112,93,184,33,84,124,110,248,255,182,234,255,204,162,255,59,243,254,49,56,86,135,139,172,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,74,102,
+202,220,220,124,135,144,23,10,194,188,80,20,22,133,101,97,85,184,46,220,16,42,62,55,252,127,91,245,127,102,209,255,157,121,255,24,28,203,117,5,103,88,240,46,97,82,40,9,43,130,170,19,43,254,57,56,151,
+27,12,106,86,185,124,249,185,13,66,175,80,20,202,130,106,18,101,255,26,184,22,55,28,92,239,114,233,210,179,61,194,85,161,34,168,140,81,241,175,205,77,8,73,89,244,78,97,65,40,103,80,244,48,202,254,53,
+187,41,97,181,150,139,23,159,201,11,37,65,213,194,244,244,25,117,244,232,164,42,20,14,170,190,190,33,239,59,122,236,168,205,254,122,108,183,194,34,204,96,77,30,127,103,35,6,118,223,226,103,248,228,90,
+111,239,160,26,25,57,160,142,28,153,80,167,78,157,86,181,94,135,127,15,110,82,104,66,225,175,37,9,242,249,243,151,213,177,99,83,106,104,104,212,251,98,22,98,6,43,109,171,44,198,172,186,108,43,88,200,
+193,177,248,28,203,192,192,136,26,31,63,238,157,51,97,34,92,115,137,16,81,46,92,152,235,20,138,130,138,195,236,236,57,117,224,192,97,239,201,54,151,87,175,85,116,93,248,40,248,56,211,232,232,33,53,51,
+115,86,197,189,110,255,30,221,171,65,47,242,52,205,241,68,197,97,108,108,220,42,122,154,79,123,24,81,43,126,72,134,131,7,143,168,184,247,193,61,59,225,207,95,238,22,150,171,5,139,247,249,224,96,193,
+219,39,47,107,194,131,190,16,132,235,161,206,65,189,33,70,18,112,239,237,185,56,244,220,185,75,87,4,21,197,137,19,51,94,101,172,30,162,167,45,188,13,118,69,159,154,154,86,213,238,147,88,180,147,240,
+93,194,82,84,64,120,226,121,138,178,248,180,199,17,222,92,52,178,103,79,159,231,8,85,146,128,152,172,239,222,197,179,103,47,22,132,138,160,194,24,30,222,239,237,144,149,101,155,143,43,188,14,255,79,
+11,34,234,222,253,216,172,207,45,98,206,156,185,176,32,168,48,104,179,211,6,111,53,155,175,182,100,204,92,77,68,61,230,240,225,99,42,42,22,196,106,189,137,95,138,186,225,254,254,225,150,183,249,106,
+194,155,236,221,219,95,45,9,90,127,155,184,211,167,207,119,8,139,130,178,49,49,113,194,251,218,229,122,177,249,56,194,235,75,205,232,121,164,83,41,44,62,126,236,58,90,85,252,141,194,82,216,205,237,
+223,63,182,110,109,190,154,240,38,116,57,71,36,1,49,108,173,173,98,103,103,207,109,20,94,161,183,206,6,150,223,14,54,95,109,177,41,155,88,4,208,82,8,139,151,31,203,141,173,34,126,135,176,20,118,51,
+180,141,219,201,230,171,9,175,195,88,67,68,18,16,211,236,191,14,102,102,206,46,210,55,110,66,59,152,129,154,118,181,249,40,225,3,216,138,134,79,193,17,43,91,12,137,109,166,197,159,158,62,83,162,19,
+199,228,228,201,89,175,178,215,238,54,31,37,188,14,77,69,122,65,109,177,36,198,89,21,127,33,174,248,237,108,243,97,162,219,146,128,216,133,36,65,182,250,9,196,178,10,216,150,13,70,201,156,205,199,23,
+126,203,150,183,222,132,201,43,97,113,37,230,89,17,191,75,168,216,46,146,97,91,103,243,201,133,215,161,119,52,36,1,136,121,243,199,14,196,166,150,176,42,147,125,251,6,156,205,215,40,186,14,27,96,242,
+32,217,98,76,236,155,42,190,84,84,174,80,89,49,97,64,199,217,124,237,194,35,186,9,125,39,182,88,163,65,179,196,239,182,93,16,51,118,156,205,167,39,188,14,51,142,66,146,160,241,147,74,166,166,166,151,
+153,236,96,178,125,251,78,103,243,53,216,124,20,236,77,12,84,166,109,49,71,139,70,139,63,103,187,16,186,51,157,205,167,243,180,7,162,155,208,170,10,73,130,198,204,49,60,126,252,84,167,160,76,152,29,
+235,108,190,126,194,7,176,121,53,117,44,155,6,104,83,247,4,152,156,60,89,20,148,9,109,86,103,243,245,21,62,128,184,218,52,64,155,122,139,159,183,157,152,38,159,179,249,244,69,55,133,215,161,105,24,
+146,4,245,91,124,50,49,113,226,26,147,56,116,152,222,20,188,247,157,205,167,255,180,219,224,75,41,252,28,45,46,83,15,52,170,151,248,121,203,201,188,117,116,206,230,27,39,188,14,45,46,155,38,104,149,
+122,2,28,59,54,85,98,253,157,14,237,82,103,243,245,179,249,48,225,117,152,89,101,234,130,86,169,138,63,62,126,188,147,185,107,38,140,239,59,155,111,204,211,110,131,15,86,81,249,182,105,131,102,105,38,
+192,130,121,2,243,233,119,54,223,24,225,17,221,132,69,178,150,4,72,111,200,248,232,209,201,50,243,246,117,168,133,58,155,111,140,205,135,9,31,192,136,161,169,15,154,165,37,126,143,229,224,94,183,164,
+179,249,198,216,124,20,124,21,141,107,177,105,132,118,107,78,128,35,71,38,174,178,75,134,14,11,54,157,205,55,231,105,215,133,215,97,178,173,169,19,218,173,73,124,105,227,111,16,42,180,245,117,152,184,
+232,108,190,241,194,155,162,235,208,23,99,234,228,107,183,97,45,9,208,107,30,148,102,135,179,249,198,219,124,20,124,224,18,24,143,177,36,65,111,205,9,48,54,54,94,164,183,73,135,17,63,103,243,205,177,
+249,48,225,3,24,41,52,245,66,195,181,36,64,217,60,32,237,78,103,243,205,177,121,155,232,58,116,199,91,18,160,182,214,192,161,67,71,187,4,165,67,219,223,217,124,115,109,62,140,251,239,127,192,131,62,1,
+83,55,180,172,37,1,38,205,3,177,107,135,179,249,230,218,124,152,240,1,188,162,45,9,48,153,56,1,228,105,47,241,196,235,176,118,205,217,252,131,77,127,218,109,194,7,240,138,54,117,67,203,196,9,32,86,
+178,130,157,232,176,195,166,179,249,230,219,124,24,247,221,247,102,79,15,83,55,180,76,42,126,135,229,32,111,176,126,103,243,205,177,121,155,240,1,252,188,77,59,52,141,157,0,210,214,207,211,222,215,97,
+159,62,103,243,217,176,121,155,240,58,172,33,48,245,67,211,36,9,80,48,15,64,229,194,217,252,150,76,61,237,97,48,76,111,73,128,248,107,9,71,71,15,205,211,171,164,67,5,208,217,124,118,133,191,247,222,
+174,155,80,17,52,245,67,211,216,9,80,40,28,44,178,205,186,14,253,255,206,230,179,99,243,54,225,3,24,169,53,245,67,211,36,9,176,104,30,128,45,216,157,205,103,199,230,109,194,7,80,79,179,36,64,252,221,
+69,70,70,14,44,179,115,149,14,163,77,206,230,179,99,243,54,54,111,126,147,7,241,50,245,67,211,36,9,176,106,30,128,209,63,103,243,217,177,121,155,240,1,92,183,37,1,86,99,39,192,240,240,254,235,44,63,
+210,193,86,156,205,103,199,230,109,194,7,112,124,83,63,52,141,157,0,67,67,163,55,248,252,138,78,53,225,157,205,55,231,105,15,195,212,15,77,147,36,64,197,60,128,179,249,108,11,127,207,61,247,191,14,75,
+2,84,98,39,192,224,96,161,66,207,159,142,179,249,108,217,124,152,240,1,166,126,104,154,36,1,110,216,18,192,217,124,118,108,62,76,120,224,255,45,9,16,255,21,48,48,48,114,157,143,27,232,80,7,112,54,159,
+45,155,55,185,251,238,251,60,56,150,169,31,154,198,78,128,254,254,225,85,6,20,116,104,5,56,155,207,150,205,155,194,7,112,221,166,126,104,154,36,1,150,205,3,208,15,224,108,62,59,54,111,19,62,128,24,89,
+18,32,126,71,80,95,223,208,34,211,191,116,232,9,116,54,255,64,230,158,118,27,60,164,166,126,104,154,36,1,138,230,1,24,11,200,170,205,51,56,117,226,196,180,58,126,252,164,119,206,118,176,121,147,187,
+238,186,247,38,76,220,177,36,64,252,193,160,222,222,193,121,150,127,233,48,196,152,69,155,159,156,60,161,86,86,94,85,175,189,246,154,199,47,127,249,75,181,103,79,239,186,183,121,155,240,1,124,137,197,
+212,15,77,99,39,192,190,125,3,5,246,253,209,97,5,106,214,108,254,67,31,250,240,77,225,117,254,246,111,191,181,238,109,222,38,124,0,15,171,169,31,154,38,73,128,188,121,0,182,130,201,74,109,126,231,206,
+167,212,226,226,247,172,226,195,234,234,234,186,183,121,27,155,54,109,246,96,133,144,37,1,226,79,9,219,187,183,191,131,207,154,153,152,214,223,140,218,252,204,204,25,79,224,48,241,225,39,63,249,201,
+186,183,121,155,240,192,207,219,180,67,211,68,51,131,229,23,86,204,131,208,20,108,102,109,254,19,159,248,84,164,240,1,83,83,167,214,189,205,155,194,7,16,95,139,248,43,137,215,5,236,217,211,87,98,34,
+168,14,45,129,102,116,218,80,169,251,225,15,255,79,85,225,255,229,95,126,174,70,71,15,182,133,205,135,193,67,106,234,134,150,137,19,96,247,238,222,73,54,29,208,217,177,227,157,13,239,180,185,112,225,
+114,172,167,254,11,95,184,234,53,7,219,193,230,109,220,121,231,61,30,124,140,210,212,13,45,107,73,128,46,243,64,61,61,251,26,214,105,195,57,62,251,217,207,197,18,255,217,103,231,219,202,230,109,194,7,
+176,119,147,37,1,106,251,178,136,8,94,70,116,29,58,25,234,221,91,55,48,48,172,126,250,211,127,172,42,252,210,210,79,85,127,255,80,219,217,188,77,120,32,254,166,94,104,88,243,254,0,242,203,69,243,128,
+172,15,172,103,223,252,115,207,189,43,214,83,95,44,126,206,59,119,59,218,124,24,116,215,91,18,160,246,13,34,196,78,122,177,20,29,218,152,245,232,155,103,180,241,139,95,188,90,85,248,63,252,225,15,234,
+252,249,139,109,109,243,38,119,220,113,183,7,159,231,51,245,66,195,181,36,192,6,161,98,30,20,177,210,28,148,217,191,255,144,250,249,207,127,94,85,252,31,252,224,135,146,209,123,219,218,230,109,194,3,
+113,183,136,143,118,181,111,18,69,121,234,169,61,87,233,5,212,225,163,134,105,141,198,189,231,61,239,141,101,249,31,255,248,39,157,205,91,132,15,96,53,144,169,19,218,173,121,159,192,93,187,118,247,
+176,216,208,132,90,250,90,134,96,25,176,248,234,87,191,86,85,248,255,250,175,255,82,167,78,205,58,155,183,136,30,192,241,109,26,161,93,42,187,133,202,129,202,230,193,169,112,212,58,246,126,244,232,
+132,250,213,175,126,85,85,252,239,126,119,81,237,216,177,211,217,124,4,183,223,126,151,55,93,207,34,126,58,91,197,82,164,226,183,64,229,79,135,78,161,90,38,93,124,224,3,47,198,178,252,23,95,252,144,
+179,249,42,194,7,240,221,0,83,31,52,75,51,1,58,45,39,240,250,4,226,206,180,121,252,241,39,212,183,190,245,237,170,194,175,172,172,168,99,199,142,59,155,175,34,122,64,240,37,49,11,233,126,64,106,231,
+206,167,75,236,17,160,195,146,241,56,227,238,39,78,156,82,191,253,237,111,171,138,255,245,175,255,141,218,186,117,155,179,249,24,194,7,208,245,107,234,130,86,169,127,49,68,218,152,121,218,153,38,184,
+64,212,216,251,7,62,240,193,88,150,255,222,247,190,207,217,124,2,225,131,167,223,166,9,90,213,229,187,65,114,224,107,230,201,120,255,132,141,189,63,245,212,238,170,194,51,133,235,224,193,195,206,230,
+99,138,14,157,157,155,188,63,153,249,99,17,191,62,31,141,162,60,241,196,174,60,83,195,76,248,112,132,109,48,134,230,91,148,248,47,189,244,101,207,65,156,205,223,29,75,116,29,106,254,54,45,208,168,174,
+223,14,148,19,20,109,39,166,95,192,28,148,233,235,27,12,21,127,126,254,221,206,230,107,16,30,184,183,16,241,235,251,225,72,138,52,255,58,105,2,154,80,121,179,245,205,127,238,115,127,253,58,225,255,
+233,159,254,89,13,14,142,56,155,175,65,248,0,250,96,108,26,160,77,67,190,31,44,239,253,57,222,253,38,140,17,216,218,238,167,78,205,168,143,126,244,227,234,217,103,223,165,30,120,224,79,156,205,215,32,
+58,220,118,219,157,94,197,207,22,123,52,105,232,23,196,229,132,203,182,11,225,85,224,106,243,233,11,15,220,111,136,248,141,253,124,60,229,241,199,159,236,166,31,192,132,121,131,174,54,191,118,155,215,
+133,15,96,252,196,22,115,180,200,53,163,200,137,175,216,46,136,86,129,179,249,116,68,15,96,190,99,136,248,87,114,205,44,210,22,93,162,61,106,66,51,197,217,252,218,133,7,94,171,182,24,19,251,92,179,
+203,182,109,59,186,132,10,93,146,38,44,36,113,54,95,187,240,64,7,155,45,182,126,204,187,114,89,40,114,33,133,144,139,244,178,215,217,124,50,209,225,214,91,239,240,28,52,44,174,196,60,151,165,210,221,
+189,125,129,153,66,38,76,34,101,226,136,179,249,77,177,68,15,32,38,196,206,22,83,98,157,203,98,145,11,43,217,46,152,150,129,45,9,156,205,191,81,248,64,124,98,22,34,126,41,151,229,34,89,187,72,230,154,
+232,73,224,108,222,46,60,240,154,36,86,182,24,18,219,92,214,139,92,124,135,176,196,77,216,160,78,224,108,222,14,157,103,97,113,243,99,218,145,107,133,34,23,186,81,120,37,236,102,104,29,180,187,205,
+155,224,142,17,226,19,203,141,185,86,42,91,183,110,219,40,44,49,72,100,131,126,130,118,181,121,157,91,110,185,221,123,32,194,226,228,199,176,181,196,215,146,160,67,88,12,187,57,122,12,177,189,118,178,
+249,64,116,224,126,152,15,17,33,62,177,235,200,181,122,121,244,209,238,18,253,216,97,80,47,104,7,155,15,132,135,96,109,68,4,165,220,122,42,114,67,11,81,55,204,80,50,29,31,235,213,230,3,184,102,94,127,
+85,196,95,200,173,199,242,200,35,239,40,8,21,150,49,133,193,120,119,43,8,159,68,116,8,42,122,81,247,238,199,166,144,91,207,229,225,135,31,235,18,150,152,213,18,6,117,3,214,27,180,186,205,7,80,207,97,
+235,150,168,123,246,99,210,149,107,151,34,55,123,165,74,64,110,78,57,111,53,155,15,8,190,224,85,237,62,137,69,174,29,203,67,15,109,237,22,150,5,21,5,137,128,125,242,106,200,178,205,3,191,199,220,72,
+132,175,118,95,254,189,119,231,218,189,72,16,230,98,4,203,131,58,2,221,165,89,19,158,38,44,173,153,184,247,193,61,231,92,249,99,145,247,126,167,80,228,253,31,7,158,48,118,41,9,146,161,25,54,143,232,
+56,19,215,18,247,186,253,123,236,116,138,135,20,169,44,229,133,107,84,154,226,194,43,130,222,52,234,11,116,45,235,9,145,150,232,252,157,87,16,21,58,92,136,115,38,185,70,255,158,242,78,225,100,137,80,
+74,24,228,155,208,214,198,146,105,77,80,25,35,49,130,58,68,144,24,129,200,252,61,88,110,69,107,131,39,27,103,33,161,56,6,223,75,170,245,58,252,123,112,194,215,90,228,73,235,20,22,132,50,79,93,139,80,
+246,175,217,89,125,202,201,208,35,92,21,42,25,20,189,226,95,91,143,83,170,206,69,42,93,27,132,94,161,40,148,169,132,53,137,178,127,13,92,203,6,167,76,147,74,62,255,246,46,97,82,40,9,43,204,161,175,19,
+43,254,57,56,87,151,139,124,118,19,162,67,200,11,5,97,94,40,10,139,194,178,176,42,92,23,110,8,21,159,27,254,191,173,250,63,179,232,255,206,188,127,12,142,213,225,34,235,138,43,174,184,226,138,43,174,
+184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,146,153,50,55,55,223,33,228,133,130,48,47,20,133,69,97,89,88,21,174,11,55,132,138,207,13,255,223,86,253,159,89,244,127,103,222,63,6,199,
+114,93,193,25,22,188,75,152,20,74,194,138,160,234,196,138,127,14,206,229,6,131,154,85,46,95,126,110,131,208,43,20,133,178,160,154,68,217,191,6,174,197,13,7,215,187,92,186,244,108,143,112,85,168,8,42,
+99,84,252,107,115,19,66,82,22,189,83,88,16,202,25,20,61,140,178,127,205,110,74,88,173,229,226,197,103,242,66,73,80,181,48,61,125,70,29,61,58,169,10,133,131,170,175,111,200,251,142,30,59,106,179,191,
+30,219,173,176,8,51,88,147,199,223,217,136,129,221,183,248,25,62,185,214,219,59,168,70,70,14,168,35,71,38,212,169,83,167,85,173,215,225,223,131,155,20,154,80,248,107,73,130,124,254,252,101,117,236,
+216,148,26,26,26,245,190,152,133,152,193,74,219,42,139,49,171,46,219,10,22,114,112,44,62,199,50,48,48,162,198,199,143,123,231,76,152,8,215,92,34,68,148,11,23,230,58,133,162,160,226,48,59,123,78,29,56,
+112,216,123,178,205,229,213,107,21,93,23,62,10,62,206,52,58,122,72,205,204,156,85,113,175,219,191,71,247,106,208,139,60,77,115,60,81,113,24,27,27,183,138,158,230,211,30,70,212,138,31,146,225,224,193,
+35,42,238,125,112,207,78,248,243,151,187,133,229,106,193,226,125,62,56,88,240,246,201,203,154,240,160,47,4,225,122,168,115,80,111,136,145,4,220,123,123,46,14,61,119,238,210,21,65,69,113,226,196,140,
+87,25,171,135,232,105,11,111,99,247,238,94,53,53,53,173,170,221,39,177,104,39,225,187,132,165,168,128,240,196,243,20,101,241,105,143,35,188,185,104,100,207,158,62,207,17,170,36,1,49,89,223,189,139,
+103,207,94,44,8,21,65,133,49,60,188,223,219,33,43,203,54,31,87,120,29,254,159,22,68,212,189,251,177,89,159,91,196,156,57,115,97,65,80,97,208,102,167,13,222,106,54,95,109,201,152,185,154,136,122,204,
+225,195,199,84,84,44,136,213,122,19,191,20,117,195,253,253,195,45,111,243,213,132,55,217,187,183,191,90,18,180,254,54,113,167,79,159,239,16,22,5,101,99,98,226,132,247,181,203,245,98,243,113,132,215,
+151,154,209,243,72,167,82,88,124,252,216,117,180,170,248,27,133,165,176,155,219,191,127,108,221,218,124,53,225,77,232,114,142,72,2,98,216,90,91,197,206,206,158,219,40,188,66,111,157,13,44,191,29,108,
+190,218,98,83,54,177,8,160,165,16,22,47,63,150,27,91,69,252,14,97,41,236,102,104,27,183,147,205,87,19,94,135,177,134,136,36,32,166,217,127,29,204,204,156,93,164,111,220,132,118,48,3,53,237,106,243,81,
+194,7,176,21,13,159,130,35,86,182,24,18,219,76,139,63,61,125,166,68,39,142,201,201,147,179,94,101,175,221,109,62,74,120,29,154,138,244,130,218,98,73,140,179,42,254,66,92,241,219,217,230,195,68,183,37,
+1,177,11,73,130,108,245,19,136,101,21,176,45,27,140,146,57,155,143,47,252,150,45,111,189,9,147,87,194,226,74,204,179,34,126,151,80,177,93,36,195,182,206,230,147,11,175,67,239,104,72,2,16,243,230,143,
+29,136,77,45,97,85,38,251,246,13,56,155,175,81,116,29,54,192,228,65,178,197,152,216,55,85,124,169,168,92,161,178,98,194,128,142,179,249,218,133,71,116,19,250,78,108,177,70,131,102,137,223,109,187,32,
+102,236,56,155,79,79,120,29,102,28,133,36,65,227,39,149,76,77,77,47,51,217,193,100,251,246,157,206,230,107,176,249,40,216,155,24,168,76,219,98,142,22,141,22,127,206,118,33,116,103,58,155,79,231,105,
+15,68,55,161,85,21,146,4,141,153,99,120,252,248,169,78,65,153,48,59,214,217,124,253,132,15,96,243,106,234,88,54,13,208,166,238,9,48,57,121,178,40,40,19,218,172,206,230,235,43,124,0,113,181,105,128,54,
+245,22,63,111,59,49,77,62,103,243,233,139,110,10,175,67,211,48,36,9,234,183,248,100,98,226,196,53,38,113,232,48,189,41,120,239,59,155,79,255,105,183,193,151,82,248,57,90,92,166,30,104,84,47,241,243,
+150,147,121,235,232,156,205,55,78,120,29,90,92,54,77,208,42,245,4,56,118,108,170,196,250,59,29,218,165,206,230,235,103,243,97,194,235,48,179,202,212,5,173,82,21,127,124,252,120,39,115,215,76,24,223,
+119,54,223,152,167,221,6,31,172,162,242,109,211,6,205,210,76,128,5,243,4,230,211,239,108,190,49,194,35,186,9,139,100,45,9,144,222,144,241,209,163,147,101,230,237,235,80,11,117,54,223,24,155,15,19,62,
+128,17,67,83,31,52,75,75,252,30,203,193,189,110,73,103,243,141,177,249,40,248,42,26,215,98,211,8,237,214,156,0,71,142,76,92,101,151,12,29,22,108,58,155,111,206,211,174,11,175,195,100,91,83,39,180,91,
+147,248,210,198,223,32,84,104,235,235,48,113,209,217,124,227,133,55,69,215,161,47,198,212,201,215,110,195,90,18,160,215,60,40,205,14,103,243,141,183,249,40,248,192,37,48,30,99,73,130,222,154,19,96,
+108,108,188,72,111,147,14,35,126,206,230,155,99,243,97,194,7,48,82,104,234,133,134,107,73,128,178,121,64,218,157,206,230,155,99,243,54,209,117,232,142,183,36,64,109,173,129,67,135,142,118,9,74,135,
+182,191,179,249,230,218,124,24,247,223,255,128,7,125,2,166,110,104,89,75,2,76,154,7,98,215,14,103,243,205,181,249,48,225,3,120,69,91,18,96,50,113,2,200,211,94,226,137,215,97,237,154,179,249,7,155,254,
+180,219,132,15,224,21,109,234,134,150,137,19,64,172,100,5,59,209,97,135,77,103,243,205,183,249,48,238,187,239,205,158,30,166,110,104,153,84,252,14,203,65,222,96,253,206,230,155,99,243,54,225,3,248,
+121,155,118,104,26,59,1,164,173,159,167,189,175,195,62,125,206,230,179,97,243,54,225,117,88,67,96,234,135,166,73,18,160,96,30,128,202,133,179,249,45,153,122,218,195,96,152,222,146,0,241,215,18,142,
+142,30,154,167,87,73,135,10,160,179,249,236,10,127,239,189,93,55,161,34,104,234,135,166,177,19,160,80,56,88,100,155,117,29,250,255,157,205,103,199,230,109,194,7,48,82,107,234,135,166,73,18,96,209,60,
+0,91,176,59,155,207,142,205,219,132,15,160,158,102,73,128,248,187,139,140,140,28,88,102,231,42,29,70,155,156,205,103,199,230,109,108,222,252,38,15,226,101,234,135,166,73,18,96,213,60,0,163,127,206,
+230,179,99,243,54,225,3,184,110,75,2,172,198,78,128,225,225,253,215,89,126,164,131,173,56,155,207,142,205,219,132,15,224,248,166,126,104,26,59,1,134,134,70,111,240,249,21,157,106,194,59,155,111,206,
+211,30,134,169,31,154,38,73,128,138,121,0,103,243,217,22,254,158,123,238,127,29,150,4,168,196,78,128,193,193,66,133,158,63,29,103,243,217,178,249,48,225,3,76,253,208,52,73,2,220,176,37,128,179,249,
+236,216,124,152,240,192,255,91,18,32,254,43,96,96,96,228,58,31,55,208,161,14,224,108,62,91,54,111,114,247,221,247,121,112,44,83,63,52,141,157,0,253,253,195,171,12,40,232,208,10,112,54,159,45,155,55,
+133,15,224,186,77,253,208,52,73,2,44,155,7,160,31,192,217,124,118,108,222,38,124,0,49,178,36,64,252,142,160,190,190,161,69,166,127,233,208,19,152,85,155,31,27,59,162,78,159,62,235,45,145,106,23,155,
+143,130,135,212,212,15,77,147,36,64,209,60,0,99,1,89,179,249,129,129,97,245,189,239,253,157,122,237,181,215,110,242,204,51,207,181,133,205,155,220,117,215,189,55,97,226,142,37,1,226,15,6,245,246,14,
+206,179,252,75,135,33,198,172,216,60,255,255,161,15,125,248,117,194,235,60,250,232,59,214,189,205,219,132,15,224,75,44,166,126,104,26,59,1,246,237,27,40,176,239,143,14,246,154,133,218,252,196,196,148,
+250,217,207,126,22,42,62,28,56,48,182,238,109,222,38,124,0,15,171,169,31,154,38,73,128,188,121,0,182,130,105,102,109,254,177,199,182,169,82,233,243,145,194,7,236,220,249,212,186,183,121,27,155,54,109,
+246,96,133,144,37,1,226,79,9,219,187,183,191,131,207,154,153,152,214,223,168,218,252,229,203,207,168,255,252,207,255,140,37,254,167,62,245,87,109,97,243,54,225,129,159,183,105,135,166,137,102,6,203,
+47,172,152,7,161,41,216,200,78,155,189,123,251,212,183,191,253,157,88,194,255,246,183,255,159,186,120,241,114,219,216,188,41,124,0,241,181,136,191,146,120,93,192,158,61,125,37,38,130,234,208,18,104,
+84,167,205,7,62,240,98,44,225,225,175,255,186,228,85,252,218,201,230,195,224,33,53,117,67,203,196,9,176,123,119,239,36,155,14,232,236,216,241,206,186,119,218,28,57,50,174,254,241,31,255,49,150,240,
+255,252,207,175,168,241,241,201,182,179,121,27,119,222,121,143,7,31,163,52,117,67,203,90,18,160,203,60,80,79,207,190,186,245,205,63,252,240,86,245,217,207,126,46,246,83,255,226,139,31,106,91,155,183,
+9,31,192,222,77,150,4,168,237,203,34,34,120,25,209,117,232,100,72,187,111,254,252,249,139,234,213,87,127,29,75,248,239,126,119,81,106,180,253,109,109,243,54,225,129,248,155,122,161,97,205,251,3,200,
+47,23,205,3,178,62,48,173,190,249,167,159,222,163,190,241,141,111,198,18,126,117,245,119,94,47,159,179,249,112,232,174,183,36,64,237,27,68,136,157,244,98,41,58,180,49,211,24,137,187,114,229,47,98,219,
+253,23,190,240,69,47,241,156,205,219,185,227,142,187,61,248,60,159,169,23,26,174,37,1,54,8,21,243,160,12,13,215,42,252,193,131,99,234,71,63,250,113,44,225,127,254,243,101,53,57,121,194,217,124,21,225,
+129,184,91,196,71,187,218,55,137,162,60,245,212,158,171,244,2,234,240,81,195,164,194,191,237,109,15,121,157,52,113,159,250,15,127,248,163,158,203,56,155,143,22,62,128,213,64,166,78,104,183,230,125,2,
+119,237,218,221,195,98,67,19,90,2,113,199,221,103,103,207,168,95,253,234,63,98,9,255,242,203,223,247,70,249,156,205,87,23,61,128,227,219,52,66,187,84,118,11,149,3,149,205,131,83,225,168,38,252,147,79,
+238,82,95,249,202,87,99,9,95,46,151,213,187,222,245,188,179,249,4,194,195,237,183,223,229,77,215,179,136,159,206,86,177,20,169,248,45,80,249,211,161,83,40,106,210,197,185,115,23,99,219,253,151,190,
+244,101,111,241,169,179,249,100,194,7,240,221,0,83,31,52,75,51,1,58,45,39,240,250,4,108,227,238,140,71,199,17,254,223,254,237,223,212,169,83,51,206,230,107,16,61,32,248,146,152,133,116,63,32,181,115,
+231,211,37,246,8,208,225,169,181,141,183,211,61,91,77,252,143,127,252,147,222,232,162,179,249,218,132,15,160,235,215,212,5,173,82,255,98,136,180,49,243,180,51,77,112,1,51,1,122,123,7,66,133,255,225,
+15,255,143,26,25,217,239,108,126,141,194,7,79,191,77,19,180,170,203,119,131,228,192,215,204,147,241,254,177,13,193,126,249,203,215,222,32,254,194,194,159,59,155,95,163,232,208,217,185,201,251,147,153,
+63,22,241,235,243,209,40,202,19,79,236,202,51,53,204,132,15,71,216,122,233,158,127,254,5,245,181,175,125,93,125,242,147,159,242,90,4,206,230,107,23,30,209,117,168,249,219,180,64,163,186,126,59,80,78,
+80,180,157,152,126,1,215,105,83,127,225,129,123,11,17,191,190,31,142,164,72,243,175,147,38,160,201,214,173,219,92,109,62,101,155,15,131,62,24,155,6,104,211,144,239,7,203,123,127,142,119,191,9,99,4,
+206,230,211,125,218,117,110,187,237,78,175,226,103,139,61,154,52,244,11,226,114,194,101,219,133,240,42,112,54,159,190,240,192,253,134,136,223,216,207,199,83,30,127,252,201,110,250,1,76,152,55,232,108,
+126,237,54,175,11,31,64,7,155,45,230,104,145,107,70,145,19,95,177,93,16,173,2,103,243,233,136,30,192,222,140,33,226,95,201,53,179,72,91,116,137,246,168,9,205,20,103,243,107,23,30,120,173,218,98,76,
+236,115,205,46,219,182,237,232,18,42,116,73,154,208,213,235,108,190,118,225,129,14,54,91,108,253,152,119,229,178,80,228,66,10,33,23,233,101,175,179,249,100,162,195,173,183,222,225,57,104,88,92,137,
+121,46,75,165,187,123,251,2,51,133,76,152,203,199,196,17,103,243,155,98,137,30,64,76,136,157,45,166,196,58,151,197,34,23,86,178,93,48,45,3,91,18,56,155,127,163,240,129,248,196,44,68,252,82,46,203,69,
+178,118,145,204,53,209,147,192,217,188,93,120,224,53,73,172,108,49,36,182,185,172,23,185,248,14,97,137,155,176,65,157,192,217,188,29,58,207,194,226,230,199,180,35,215,10,69,46,116,163,240,74,216,205,
+208,58,104,119,155,55,249,127,123,32,132,138,79,44,55,230,90,169,108,221,186,109,163,176,196,32,145,13,250,9,218,213,230,117,110,185,229,118,239,129,8,139,147,31,195,214,18,95,75,130,14,97,49,236,230,
+232,49,196,246,218,201,230,3,209,129,251,97,70,85,132,248,196,174,35,215,234,229,209,71,187,75,244,99,135,65,189,160,29,108,62,16,30,130,201,179,17,148,114,235,169,200,13,45,68,221,48,67,201,116,124,
+172,87,155,15,224,154,121,253,85,17,127,33,183,30,203,35,143,188,163,32,84,88,198,20,6,227,221,173,32,124,18,209,33,168,232,69,221,187,31,155,66,110,61,151,135,31,126,172,75,88,98,86,75,24,212,13,88,
+111,208,234,54,31,64,61,135,173,91,162,238,217,143,73,87,174,93,138,220,236,149,42,1,185,57,229,188,213,108,62,32,248,130,87,181,251,36,22,185,118,44,15,61,180,181,91,88,22,84,20,36,2,246,201,171,33,
+203,54,15,252,30,115,35,17,190,218,125,249,247,222,157,107,247,34,65,152,139,17,44,15,234,8,116,151,102,77,120,154,176,180,102,226,222,7,247,156,115,229,143,69,222,251,157,66,145,247,127,28,120,194,
+216,63,32,72,134,102,216,60,162,227,76,92,75,220,235,246,239,177,211,41,30,82,164,178,148,23,174,81,105,138,11,175,8,122,211,168,47,208,181,172,39,68,90,162,243,119,94,65,84,232,112,33,206,153,228,26,
+253,123,202,59,133,147,37,66,41,97,144,111,66,91,27,75,166,53,65,101,140,196,8,234,16,65,98,4,34,243,247,96,185,21,173,13,158,108,156,133,132,226,24,124,47,169,214,235,240,239,193,9,95,107,145,39,173,
+83,88,16,202,60,117,45,66,217,191,102,103,245,41,39,67,143,112,85,168,100,80,244,138,127,109,61,78,169,58,23,169,116,109,16,122,133,162,80,166,18,214,36,202,254,53,112,45,27,156,50,77,42,249,252,219,
+187,132,73,161,36,172,48,135,190,78,172,248,231,224,92,93,46,242,217,77,136,14,33,47,20,132,121,161,40,44,10,203,194,170,112,93,184,33,84,124,110,248,255,182,234,255,204,162,255,59,243,254,49,56,86,
+135,139,172,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,74,102,202,220,220,124,135,144,23,10,194,188,80,20,22,133,101,97,85,184,46,220,16,42,62,55,252,
+127,91,245,127,102,209,255,157,121,255,24,28,203,117,5,103,88,240,46,97,82,40,9,43,130,170,19,43,254,57,56,151,27,12,106,86,185,124,249,185,13,66,175,80,20,202,130,106,18,101,255,26,184,22,55,28,92,
+239,114,233,210,179,61,194,85,161,34,168,140,81,241,175,205,77,8,73,89,244,78,97,65,40,103,80,244,48,202,254,53,187,41,97,181,150,139,23,159,201,11,37,65,213,194,244,244,25,117,244,232,164,42,20,14,
+170,190,190,33,239,59,122,236,168,205,254,122,108,183,194,34,204,96,77,30,127,103,35,6,118,223,226,103,248,228,90,111,239,160,26,25,57,160,142,28,153,80,167,78,157,86,181,94,135,127,15,110,82,104,66,
+225,175,37,9,242,249,243,151,213,177,99,83,106,104,104,212,251,98,22,98,6,43,109,171,44,198,172,186,108,43,88,200,193,177,248,28,203,192,192,136,26,31,63,238,157,51,97,34,92,115,137,16,81,46,92,152,
+235,20,138,130,138,195,236,236,57,117,224,192,97,239,201,54,151,87,175,85,116,93,248,40,248,56,211,232,232,33,53,51,115,86,197,189,110,255,30,221,171,65,47,242,52,205,241,68,197,97,108,108,220,42,122,
+154,79,123,24,81,43,126,72,134,131,7,143,168,184,247,193,61,59,225,207,95,238,22,150,171,5,139,247,249,224,96,193,219,39,47,107,194,131,190,16,132,235,161,206,65,189,33,70,18,112,239,237,185,56,244,
+220,185,75,87,4,21,197,137,19,51,94,101,172,30,162,167,45,188,141,221,187,123,213,212,212,180,170,118,159,196,162,157,132,239,18,150,162,2,194,19,207,83,148,197,167,61,142,240,230,162,145,61,123,250,
+60,71,168,146,4,196,100,125,247,46,158,61,123,177,32,84,4,21,198,240,240,126,111,135,172,44,219,124,92,225,117,248,127,90,16,81,247,238,199,102,125,110,17,115,230,204,133,5,65,133,65,155,157,54,120,
+171,217,124,181,37,99,230,106,34,234,49,135,15,31,83,81,177,32,86,235,77,252,82,212,13,247,247,15,183,188,205,87,19,222,100,239,222,254,106,73,208,250,219,196,157,62,125,190,67,88,20,148,141,137,137,
+19,222,215,46,215,139,205,199,17,94,95,106,70,207,35,157,74,97,241,241,99,215,209,170,226,111,20,150,194,110,110,255,254,177,117,107,243,213,132,55,161,203,57,34,9,136,97,107,109,21,59,59,123,110,163,
+240,10,189,117,54,176,252,118,176,249,106,139,77,217,196,34,128,150,66,88,188,252,88,110,108,21,241,59,132,165,176,155,161,109,220,78,54,95,77,120,29,198,26,34,146,128,152,102,255,117,48,51,115,118,
+145,190,113,19,218,193,12,212,180,171,205,71,9,31,192,86,52,124,10,142,88,217,98,72,108,51,45,254,244,244,153,18,157,56,38,39,79,206,122,149,189,118,183,249,40,225,117,104,42,210,11,106,139,37,49,206,
+170,248,11,113,197,111,103,155,15,19,221,150,4,196,46,36,9,178,213,79,32,150,85,192,182,108,48,74,230,108,62,190,240,91,182,188,245,38,76,94,9,139,43,49,207,138,248,93,66,197,118,145,12,219,58,155,79,
+46,188,14,189,163,33,9,64,204,155,63,118,32,54,181,132,85,153,236,219,55,224,108,190,70,209,117,216,0,147,7,201,22,99,98,223,84,241,165,162,114,133,202,138,9,3,58,206,230,107,23,30,209,77,232,59,177,
+197,26,13,154,37,126,183,237,130,152,177,227,108,62,61,225,117,152,113,20,146,4,141,159,84,50,53,53,189,204,100,7,147,237,219,119,58,155,175,193,230,163,96,111,98,160,50,109,139,57,90,52,90,252,57,
+219,133,208,157,233,108,62,157,167,61,16,221,132,86,85,72,18,52,102,142,225,241,227,167,58,5,101,194,236,88,103,243,245,19,62,128,205,171,169,99,217,52,64,155,186,39,192,228,228,201,162,160,76,104,
+179,58,155,175,175,240,1,196,213,166,1,218,212,91,252,188,237,196,52,249,156,205,167,47,186,41,188,14,77,195,144,36,168,223,226,147,137,137,19,215,152,196,161,195,244,166,224,189,239,108,62,253,167,
+221,6,95,74,225,231,104,113,153,122,160,81,189,196,207,91,78,230,173,163,115,54,223,56,225,117,104,113,217,52,65,171,212,19,224,216,177,169,18,235,239,116,104,151,58,155,175,159,205,135,9,175,195,204,
+42,83,23,180,74,85,252,241,241,227,157,204,93,51,97,124,223,217,124,99,158,118,27,124,176,138,202,183,77,27,52,75,51,1,22,204,19,152,79,191,179,249,198,8,143,232,38,44,146,181,36,64,122,67,198,71,143,
+78,150,153,183,175,67,45,212,217,124,99,108,62,76,248,0,70,12,77,125,208,44,45,241,123,44,7,247,186,37,157,205,55,198,230,163,224,171,104,92,139,77,35,180,91,115,2,28,57,50,113,149,93,50,116,88,176,
+233,108,190,57,79,187,46,188,14,147,109,77,157,208,110,77,226,75,27,127,131,80,161,173,175,195,196,69,103,243,141,23,222,20,93,135,190,24,83,39,95,187,13,107,73,128,94,243,160,52,59,156,205,55,222,
+230,163,224,3,151,192,120,140,37,9,122,107,78,128,177,177,241,34,189,77,58,140,248,57,155,111,142,205,135,9,31,192,72,161,169,23,26,174,37,1,202,230,1,105,119,58,155,111,142,205,219,68,215,161,59,222,
+146,0,181,181,6,14,29,58,218,37,40,29,218,254,206,230,155,107,243,97,220,127,255,3,30,244,9,152,186,161,101,45,9,48,105,30,136,93,59,156,205,55,215,230,195,132,15,224,21,109,73,128,201,196,9,32,79,
+123,137,39,94,135,181,107,206,230,31,108,250,211,110,19,62,128,87,180,169,27,90,38,78,0,177,146,21,236,68,135,29,54,157,205,55,223,230,195,184,239,190,55,123,122,152,186,161,101,82,241,59,44,7,121,
+131,245,59,155,111,142,205,219,132,15,224,231,109,218,161,105,236,4,144,182,126,158,246,190,14,251,244,57,155,207,134,205,219,132,215,97,13,129,169,31,154,38,73,128,130,121,0,42,23,206,230,183,100,
+234,105,15,131,97,122,75,2,196,95,75,56,58,122,104,158,94,37,29,42,128,206,230,179,43,252,189,247,118,221,132,138,160,169,31,154,198,78,128,66,225,96,145,109,214,117,232,255,119,54,159,29,155,183,9,
+31,192,72,173,169,31,154,38,73,128,69,243,0,108,193,238,108,62,59,54,111,19,62,128,122,154,37,1,226,239,46,50,50,114,96,153,157,171,116,24,109,114,54,159,29,155,183,177,121,243,155,60,136,151,169,31,
+154,38,73,128,85,243,0,140,254,57,155,207,142,205,219,132,15,224,186,45,9,176,26,59,1,134,135,247,95,103,249,145,14,182,226,108,62,59,54,111,19,62,128,227,155,250,161,105,236,4,24,26,26,189,193,231,
+87,116,170,9,239,108,190,57,79,123,24,166,126,104,154,36,1,42,230,1,156,205,103,91,248,123,238,185,255,117,88,18,160,18,59,1,6,7,11,21,122,254,116,156,205,103,203,230,195,132,15,48,245,67,211,36,9,
+112,195,150,0,206,230,179,99,243,97,194,3,255,111,73,128,248,175,128,129,129,145,235,124,220,64,135,58,128,179,249,108,217,188,201,221,119,223,231,193,177,76,253,208,52,118,2,244,247,15,175,50,160,
+160,67,43,192,217,124,182,108,222,20,62,128,235,54,245,67,211,36,9,176,108,30,128,126,128,44,218,124,111,239,128,154,155,123,78,77,76,76,181,149,205,219,132,15,32,70,150,4,136,223,17,212,215,55,180,
+200,244,47,29,122,2,179,100,243,61,61,251,212,23,191,120,85,189,246,218,107,55,249,206,119,190,219,54,54,31,5,15,169,169,31,154,38,73,128,162,121,0,198,2,178,96,243,172,137,255,204,103,138,175,19,94,
+231,61,239,121,111,91,216,188,201,93,119,221,123,19,38,238,88,18,32,254,96,80,111,239,224,60,203,191,116,24,98,108,102,109,158,17,174,15,127,248,163,161,194,7,124,249,203,215,218,194,230,109,194,7,
+240,37,22,83,63,52,141,157,0,251,246,13,20,216,247,71,135,21,168,205,168,205,211,252,124,223,251,222,175,126,247,187,223,85,21,31,62,248,193,255,213,22,54,111,19,62,128,135,213,212,15,77,147,36,64,
+222,60,0,91,193,52,186,54,255,174,119,61,175,86,86,86,98,9,15,255,252,207,255,236,45,89,111,7,155,183,177,105,211,102,15,86,8,89,18,32,254,148,176,189,123,251,59,248,172,153,137,105,253,245,106,187,
+95,184,112,73,253,252,231,203,177,133,47,151,203,222,147,255,150,183,188,173,109,108,222,38,60,240,243,54,237,208,52,209,204,96,249,133,21,243,32,52,5,235,41,252,169,83,51,234,39,63,89,138,45,60,124,
+252,227,159,244,190,52,218,110,54,111,10,31,64,124,45,226,175,36,94,23,176,103,79,95,137,137,160,58,180,4,234,209,105,115,228,200,49,245,242,203,223,79,36,252,231,62,247,191,213,147,79,238,106,91,155,
+15,131,135,212,212,13,45,19,39,192,238,221,189,147,108,58,160,179,99,199,59,83,237,162,29,25,217,175,190,249,205,191,77,36,60,181,252,189,123,251,218,218,230,109,220,121,231,61,30,124,140,210,212,13,
+45,107,73,128,46,243,64,116,190,164,33,60,2,190,244,210,151,18,9,255,183,127,251,45,47,97,156,205,219,133,15,96,239,38,75,2,212,246,101,17,17,188,140,232,58,116,50,212,42,60,150,253,217,207,126,46,
+145,240,223,255,254,223,171,163,71,39,156,205,87,17,30,136,191,169,23,26,214,188,63,128,252,114,209,60,32,235,3,147,14,200,80,73,251,216,199,62,158,72,248,159,254,244,167,82,41,156,117,54,95,69,116,
+29,186,235,45,9,80,251,6,17,98,39,189,88,138,14,109,204,184,194,51,132,252,254,247,127,80,253,247,127,255,119,108,225,127,241,139,95,72,51,240,178,179,249,4,194,223,113,199,221,30,124,158,207,212,11,
+13,215,146,0,27,132,138,121,80,134,134,171,13,193,62,255,252,11,234,215,191,254,117,108,225,95,125,245,215,234,221,239,94,112,54,95,131,240,64,220,45,226,163,93,237,155,68,81,158,122,106,207,85,122,1,
+117,248,168,97,152,240,12,207,46,47,199,239,196,193,29,254,226,47,62,160,30,124,240,173,206,230,99,136,110,10,31,192,88,137,169,19,218,173,121,159,192,93,187,118,247,176,216,208,132,150,128,109,220,
+253,239,255,254,7,177,197,255,200,71,62,230,93,184,179,249,205,53,137,30,192,241,109,26,161,93,42,187,133,202,129,202,230,193,169,112,152,226,179,102,48,142,240,197,226,103,189,181,134,206,230,215,38,
+60,220,126,251,93,94,93,203,34,126,58,91,197,82,164,226,183,64,229,79,135,78,33,219,164,139,168,247,254,213,171,47,73,173,116,175,179,249,26,109,222,20,62,128,57,18,166,62,104,150,102,2,116,90,78,224,
+245,9,152,227,238,84,254,76,225,191,241,141,111,170,193,193,17,103,243,41,138,30,16,124,73,204,66,186,31,144,218,185,243,233,18,123,4,232,96,227,182,161,215,19,39,166,189,158,190,82,233,11,106,108,
+236,136,179,249,58,8,31,64,215,175,169,11,90,165,254,197,16,105,99,230,105,103,154,224,2,237,62,4,219,8,155,15,123,250,109,154,160,85,93,190,27,36,7,190,102,158,140,247,143,235,180,105,204,211,30,208,
+217,185,201,251,147,153,63,22,241,235,243,209,40,202,19,79,236,202,51,53,204,132,89,56,206,230,235,43,60,162,235,80,243,183,105,129,70,117,253,118,160,156,160,104,59,49,253,2,206,230,235,47,60,112,
+111,33,226,215,247,195,145,20,105,254,117,210,4,52,97,192,199,217,124,186,54,31,6,125,48,54,13,208,166,33,223,15,150,247,254,28,239,126,19,198,8,156,205,167,251,180,235,220,118,219,157,94,197,207,22,
+123,52,105,232,23,196,229,132,203,182,11,225,85,224,108,62,125,225,129,251,13,17,191,177,159,143,167,60,254,248,147,221,244,3,152,48,111,208,217,252,218,109,94,23,62,128,5,31,182,152,163,69,174,25,69,
+78,124,197,118,65,180,10,156,205,167,35,122,0,227,44,33,226,95,201,53,179,72,91,116,137,246,168,9,205,20,103,243,107,23,30,120,173,218,98,76,236,115,205,46,219,182,237,232,18,42,116,73,154,176,144,
+196,217,124,237,194,3,29,108,182,216,250,49,239,202,101,161,200,133,20,66,46,210,203,94,103,243,201,68,135,91,111,189,195,115,208,176,184,18,243,92,150,74,119,247,246,5,102,10,153,48,137,148,137,35,
+206,230,55,197,18,61,128,152,16,59,91,76,137,117,46,139,69,46,172,100,187,96,90,6,182,36,112,54,255,70,225,3,241,137,89,136,248,165,92,150,139,100,237,34,153,107,162,39,129,179,121,187,240,192,107,
+146,88,217,98,72,108,115,89,47,114,241,29,194,18,55,97,131,58,129,179,121,59,116,158,133,197,205,143,105,71,174,21,138,92,232,70,225,149,176,155,161,117,208,238,54,111,130,59,70,136,79,44,55,230,90,
+169,108,221,186,109,163,176,196,32,145,13,250,9,218,213,230,117,110,185,229,118,239,129,8,139,147,31,195,214,18,95,75,130,14,97,49,236,230,232,49,196,246,218,201,230,3,209,129,251,97,70,85,132,248,
+196,174,35,215,234,229,209,71,187,75,244,99,135,65,189,160,29,108,62,16,30,232,224,137,138,9,49,203,173,167,34,55,180,16,117,195,12,37,211,241,177,94,109,62,128,107,230,245,87,69,252,133,220,122,44,
+143,60,242,142,130,80,97,53,80,24,140,119,183,130,240,73,68,135,160,162,23,117,239,126,108,10,185,245,92,30,126,248,177,46,97,137,89,45,97,80,55,96,189,65,171,219,124,0,245,28,182,110,137,186,103,63,
+38,93,185,118,41,114,179,87,170,4,228,230,148,243,86,179,249,128,224,11,94,213,238,147,88,228,218,177,60,244,208,214,110,97,89,80,81,144,8,216,39,175,134,44,219,60,240,123,204,141,68,248,106,247,229,
+223,123,119,174,221,139,4,97,46,70,176,60,168,35,208,93,154,53,225,105,194,210,154,137,123,31,220,115,206,149,63,22,121,239,119,10,69,222,255,113,224,9,99,151,146,32,25,154,97,243,136,142,51,113,45,
+113,175,219,191,199,78,167,120,72,145,202,82,94,184,70,165,41,46,188,34,232,77,163,190,64,215,178,158,16,105,137,206,223,121,5,81,161,195,133,56,103,146,107,244,239,41,239,20,78,150,8,165,132,65,190,
+9,109,109,44,153,214,4,149,49,18,35,168,67,4,137,17,136,204,223,131,229,86,180,54,120,178,113,22,18,138,99,176,97,117,173,215,225,223,131,19,190,214,34,79,90,167,176,32,148,121,234,90,132,178,127,205,
+206,234,83,78,134,30,225,170,80,201,160,232,21,255,218,122,156,82,117,46,82,233,218,32,244,10,69,161,76,37,172,73,148,253,107,224,90,54,56,101,154,84,242,249,183,119,9,147,66,73,88,97,14,125,157,88,
+241,207,193,185,186,92,228,179,155,16,29,66,94,40,8,243,66,81,88,20,150,133,85,225,186,112,67,168,248,220,240,255,109,213,255,153,69,255,119,230,253,99,112,172,14,23,89,87,92,113,197,21,87,92,113,197,
+21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,149,204,148,185,185,249,14,33,47,20,132,121,161,40,44,10,203,194,170,112,93,184,33,84,124,110,248,255,182,234,255,204,162,255,59,243,254,49,56,150,
+235,10,206,176,224,93,194,164,80,18,86,4,85,39,86,252,115,112,46,55,24,212,172,114,249,242,115,27,132,94,161,40,148,5,213,36,202,254,53,112,45,110,56,184,222,229,210,165,103,123,132,171,66,69,80,25,
+163,226,95,155,155,16,146,178,232,157,194,130,80,206,160,232,97,148,253,107,118,83,194,106,45,23,47,62,147,23,74,130,170,133,233,233,51,234,232,209,73,85,40,28,84,125,125,67,222,119,244,216,81,155,
+253,245,216,110,133,69,152,193,154,60,254,206,70,12,236,190,197,207,240,201,181,222,222,65,53,50,114,64,29,57,50,161,78,157,58,173,106,189,14,255,30,220,164,208,132,194,95,75,18,228,243,231,47,171,99,
+199,166,212,208,208,168,247,197,44,196,12,86,218,86,89,140,89,117,217,86,176,144,131,99,241,57,150,129,129,17,53,62,126,220,59,103,194,68,184,230,18,33,162,92,184,48,215,41,20,5,21,135,217,217,115,
+234,192,129,195,222,147,109,46,175,94,171,232,186,240,81,240,113,166,209,209,67,106,102,230,172,138,123,221,254,61,186,87,131,94,228,105,154,227,137,138,195,216,216,184,85,244,52,159,246,48,162,86,
+252,144,12,7,15,30,81,113,239,131,123,118,194,159,191,220,45,44,87,11,22,239,243,193,193,130,183,79,94,214,132,7,125,33,8,215,67,157,131,122,67,140,36,224,222,219,115,113,232,185,115,151,174,8,42,138,
+19,39,102,188,202,88,61,68,79,91,120,27,187,119,247,170,169,169,105,85,237,62,137,69,59,9,223,37,44,69,5,132,39,158,167,40,139,79,123,28,225,205,69,35,123,246,244,121,142,80,37,9,136,201,250,238,93,
+60,123,246,98,65,168,8,42,140,225,225,253,222,14,89,89,182,249,184,194,235,240,255,180,32,162,238,221,143,205,250,220,34,230,204,153,11,11,130,10,131,54,59,109,240,86,179,249,106,75,198,204,213,68,
+212,99,14,31,62,166,162,98,65,172,214,155,248,165,168,27,238,239,31,110,121,155,175,38,188,201,222,189,253,213,146,160,245,183,137,59,125,250,124,135,176,40,40,27,19,19,39,188,175,93,174,23,155,143,
+35,188,190,212,140,158,71,58,149,194,226,227,199,174,163,85,197,223,40,44,133,221,220,254,253,99,235,214,230,171,9,111,66,151,115,68,18,16,195,214,218,42,118,118,246,220,70,225,21,122,235,108,96,249,
+237,96,243,213,22,155,178,137,69,0,45,133,176,120,249,177,220,216,42,226,119,8,75,97,55,67,219,184,157,108,190,154,240,58,140,53,68,36,1,49,205,254,235,96,102,230,236,34,125,227,38,180,131,25,168,105,
+87,155,143,18,62,128,173,104,248,20,28,177,178,197,144,216,102,90,252,233,233,51,37,58,113,76,78,158,156,245,42,123,237,110,243,81,194,235,208,84,164,23,212,22,75,98,156,85,241,23,226,138,223,206,54,
+31,38,186,45,9,136,93,72,18,100,171,159,64,44,171,128,109,217,96,148,204,217,124,124,225,183,108,121,235,77,152,188,18,22,87,98,158,21,241,187,132,138,237,34,25,182,117,54,159,92,120,29,122,71,67,18,
+128,152,55,127,236,64,108,106,9,171,50,217,183,111,192,217,124,141,162,235,176,1,38,15,146,45,198,196,190,169,226,75,69,229,10,149,21,19,6,116,156,205,215,46,60,162,155,208,119,98,139,53,26,52,75,252,
+110,219,5,49,99,199,217,124,122,194,235,48,227,40,36,9,26,63,169,100,106,106,122,153,201,14,38,219,183,239,116,54,95,131,205,71,193,222,196,64,101,218,22,115,180,104,180,248,115,182,11,161,59,211,217,
+124,58,79,123,32,186,9,173,170,144,36,104,204,28,195,227,199,79,117,10,202,132,217,177,206,230,235,39,124,0,155,87,83,199,178,105,128,54,117,79,128,201,201,147,69,65,153,208,102,117,54,95,95,225,3,
+136,171,77,3,180,169,183,248,121,219,137,105,242,57,155,79,95,116,83,120,29,154,134,33,73,80,191,197,39,19,19,39,174,49,137,67,135,233,77,193,123,223,217,124,250,79,187,13,190,148,194,207,209,226,50,
+245,64,163,122,137,159,183,156,204,91,71,231,108,190,113,194,235,208,226,178,105,130,86,169,39,192,177,99,83,37,214,223,233,208,46,117,54,95,63,155,15,19,94,135,153,85,166,46,104,149,170,248,227,227,
+199,59,153,187,102,194,248,190,179,249,198,60,237,54,248,96,21,149,111,155,54,104,150,102,2,44,152,39,48,159,126,103,243,141,17,30,209,77,88,36,107,73,128,244,134,140,143,30,157,44,51,111,95,135,90,
+168,179,249,198,216,124,152,240,1,140,24,154,250,160,89,90,226,247,88,14,238,117,75,58,155,111,140,205,71,193,87,209,184,22,155,70,104,183,230,4,56,114,100,226,42,187,100,232,176,96,211,217,124,115,
+158,118,93,120,29,38,219,154,58,161,221,154,196,151,54,254,6,161,66,91,95,135,137,139,206,230,27,47,188,41,186,14,125,49,166,78,190,118,27,214,146,0,189,230,65,105,118,56,155,111,188,205,71,193,7,46,
+129,241,24,75,18,244,214,156,0,99,99,227,69,122,155,116,24,241,115,54,223,28,155,15,19,62,128,145,66,83,47,52,92,75,2,148,205,3,210,238,116,54,223,28,155,183,137,174,67,119,188,37,1,106,107,13,28,58,
+116,180,75,80,58,180,253,157,205,55,215,230,195,184,255,254,7,60,232,19,48,117,67,203,90,18,96,210,60,16,187,118,56,155,111,174,205,135,9,31,192,43,218,146,0,147,137,19,64,158,246,18,79,188,14,107,
+215,156,205,63,216,244,167,221,38,124,0,175,104,83,55,180,76,156,0,98,37,43,216,137,14,59,108,58,155,111,190,205,135,113,223,125,111,246,244,48,117,67,203,164,226,119,88,14,242,6,235,119,54,223,28,
+155,183,9,31,192,207,219,180,67,211,216,9,32,109,253,60,237,125,29,246,233,115,54,159,13,155,183,9,175,195,26,2,83,63,52,77,146,0,5,243,0,84,46,156,205,111,201,212,211,30,6,195,244,150,4,136,191,150,
+112,116,244,208,60,189,74,58,84,0,157,205,103,87,248,123,239,237,186,9,21,65,83,63,52,141,157,0,133,194,193,34,219,172,235,208,255,239,108,62,59,54,111,19,62,128,145,90,83,63,52,77,146,0,139,230,1,
+216,130,221,217,124,118,108,222,38,124,0,245,52,75,2,196,223,93,100,100,228,192,50,59,87,233,48,218,228,108,62,59,54,111,99,243,230,55,121,16,47,83,63,52,77,146,0,171,230,1,24,253,115,54,159,29,155,
+183,9,31,192,117,91,18,96,53,118,2,12,15,239,191,206,242,35,29,108,197,217,124,118,108,222,38,124,0,199,55,245,67,211,216,9,48,52,52,122,131,207,175,232,84,19,222,217,124,115,158,246,48,76,253,208,52,
+73,2,84,204,3,56,155,207,182,240,247,220,115,255,235,176,36,64,37,118,2,12,14,22,42,244,252,233,56,155,207,150,205,135,9,31,96,234,135,166,73,18,224,134,45,1,156,205,103,199,230,195,132,7,254,223,146,
+0,241,95,1,3,3,35,215,249,184,129,14,117,0,103,243,217,178,121,147,187,239,190,207,131,99,153,250,161,105,236,4,232,239,31,94,101,64,65,135,86,64,214,158,118,54,83,124,215,187,158,87,239,123,223,251,
+37,195,71,218,206,230,77,225,3,184,110,83,63,52,77,146,0,203,230,1,232,7,200,138,240,3,3,195,234,175,255,186,164,94,123,237,181,215,241,204,51,207,181,141,205,219,132,15,32,70,150,4,136,223,17,212,
+215,55,180,200,244,47,29,122,2,155,109,243,39,78,76,171,239,126,119,241,13,194,7,252,231,127,254,151,247,115,237,96,243,81,240,144,154,250,161,105,146,4,40,154,7,96,44,160,25,79,59,206,243,252,243,47,
+168,127,249,151,127,9,21,94,135,117,114,237,96,243,38,119,221,117,239,77,152,184,99,73,128,248,131,65,189,189,131,243,44,255,210,97,136,177,145,194,63,253,244,30,245,137,79,124,74,253,254,247,191,143,
+37,60,252,230,55,191,109,27,155,183,9,31,192,151,88,76,253,208,52,118,2,236,219,55,80,96,223,31,29,158,172,70,216,252,225,195,227,234,171,95,253,122,108,209,117,206,159,191,212,54,54,111,19,62,128,
+135,213,212,15,77,147,36,64,222,60,0,91,193,212,75,116,126,230,210,165,57,245,227,31,255,36,177,232,229,114,89,125,234,83,127,165,122,122,246,182,149,205,219,216,180,105,179,7,43,132,44,9,16,127,74,
+216,222,189,253,29,124,214,204,196,180,254,181,10,255,248,227,79,168,23,95,252,144,122,245,213,87,19,11,191,188,252,11,245,194,11,127,238,213,17,218,209,230,109,194,3,63,111,211,14,77,19,205,12,150,
+95,88,49,15,66,176,211,16,126,120,120,84,125,254,243,95,172,201,230,191,247,189,191,83,167,78,205,180,189,205,155,194,7,16,95,139,248,43,137,215,5,236,217,211,87,98,34,168,14,45,129,181,244,205,207,
+204,156,86,127,247,119,47,215,36,124,169,244,5,175,179,199,217,252,230,72,120,72,77,221,208,50,113,2,236,222,221,59,201,166,3,58,59,118,188,51,177,240,15,63,188,85,189,231,61,239,85,191,248,197,47,19,
+139,190,178,242,170,250,224,7,255,151,215,227,231,108,62,90,248,59,239,188,199,131,143,81,154,186,161,101,45,9,208,101,30,168,167,103,95,108,225,247,236,233,85,159,254,244,103,164,146,246,135,196,194,
+255,232,71,63,86,23,46,92,170,218,148,107,87,155,183,9,31,192,222,77,150,4,168,237,203,34,34,120,25,209,117,232,100,136,18,126,124,124,82,253,205,223,124,179,38,155,255,202,87,190,166,14,29,58,226,
+108,190,138,232,54,225,129,248,155,122,161,97,205,251,3,200,47,23,205,3,178,62,48,108,36,238,165,151,190,156,88,116,58,122,62,254,241,79,170,93,187,122,156,205,215,32,186,14,221,245,150,4,168,125,131,
+8,177,147,94,44,69,135,54,166,109,8,246,244,233,115,137,132,255,217,207,254,197,27,201,99,141,129,179,249,181,9,127,199,29,119,123,240,121,62,83,47,52,92,75,2,108,16,42,230,65,25,26,54,135,93,63,246,
+177,79,196,18,254,59,223,249,174,58,126,252,164,179,249,26,109,222,38,60,160,129,69,124,180,171,125,147,40,202,83,79,237,185,74,47,160,14,181,114,51,1,230,230,158,141,20,254,115,159,251,223,170,175,
+111,208,217,252,26,69,55,133,15,96,53,144,169,19,218,173,121,159,192,93,187,118,247,176,216,208,132,150,128,57,238,254,242,203,223,127,157,232,191,250,213,127,120,147,53,182,110,221,230,108,62,197,
+167,221,132,227,219,52,66,187,84,118,11,149,3,149,205,131,83,225,176,141,185,227,4,188,14,168,19,56,155,223,92,87,225,225,246,219,239,242,166,235,89,196,79,103,171,88,138,84,252,22,168,252,233,208,41,
+212,110,51,109,154,109,243,166,240,1,124,55,192,212,7,205,210,76,128,78,203,9,188,62,129,118,154,105,211,76,155,55,69,15,8,190,36,102,33,221,15,72,237,220,249,116,137,61,2,116,88,50,238,108,126,115,
+83,132,15,160,235,215,212,5,173,82,255,98,136,180,49,243,180,51,77,112,1,103,243,245,183,249,176,167,223,166,9,90,213,229,187,65,114,224,107,230,201,120,255,56,155,111,204,211,30,208,217,185,201,251,
+147,153,63,22,241,235,243,209,40,202,19,79,236,202,51,53,204,132,15,71,56,155,175,175,240,136,174,67,205,223,166,5,26,213,245,219,129,114,130,162,237,196,244,11,56,155,175,191,240,192,189,133,136,95,
+223,15,71,82,164,249,215,73,19,208,132,206,30,103,243,233,218,124,24,244,193,216,52,64,155,134,124,63,88,222,251,115,188,251,77,24,35,112,54,159,238,211,174,115,219,109,119,122,21,63,91,236,209,164,
+161,95,16,151,19,46,219,46,132,87,129,179,249,244,133,7,238,55,68,252,198,126,62,158,242,248,227,79,118,211,15,96,194,188,65,103,243,107,183,121,93,248,0,22,124,216,98,142,22,185,102,20,57,241,21,219,
+5,209,42,112,54,159,142,232,1,204,155,8,17,255,74,174,153,69,218,162,75,180,71,77,104,166,56,155,95,187,240,192,107,213,22,99,98,159,107,118,217,182,109,71,151,80,161,75,210,132,133,36,206,230,107,23,
+30,232,96,179,197,214,143,121,87,46,11,69,46,164,16,114,145,94,246,58,155,79,38,58,220,122,235,29,158,131,134,197,149,152,231,178,84,186,187,183,47,48,83,200,132,73,164,76,28,113,54,191,41,150,232,1,
+196,132,216,217,98,74,172,115,89,44,114,97,37,219,5,211,50,176,37,129,179,249,55,10,31,136,79,204,66,196,47,229,178,92,36,107,23,201,92,19,61,9,156,205,219,133,7,94,147,196,202,22,67,98,155,203,122,
+145,139,239,16,150,184,9,27,212,9,156,205,219,161,243,44,44,110,126,76,59,114,173,80,228,66,55,10,175,132,221,12,173,131,118,183,121,19,220,49,66,124,98,185,49,215,74,101,235,214,109,27,133,37,6,137,
+108,208,79,208,174,54,175,115,203,45,183,123,15,68,88,156,252,24,182,150,248,90,18,116,8,139,97,55,71,143,33,182,215,78,54,31,136,14,220,15,51,170,34,196,39,118,29,185,86,47,143,62,218,93,162,31,59,
+12,234,5,237,96,243,129,240,64,7,79,84,76,136,89,110,61,21,185,161,133,168,27,102,40,153,142,143,245,106,243,1,92,51,175,191,42,226,47,228,214,99,121,228,145,119,20,132,10,203,152,194,96,188,187,21,
+132,79,34,58,4,21,189,168,123,247,99,83,200,173,231,242,240,195,143,117,9,75,204,106,9,131,186,1,235,13,90,221,230,3,168,231,176,117,75,212,61,251,49,233,202,181,75,145,155,189,82,37,32,55,167,156,
+183,154,205,7,4,95,240,170,118,159,196,34,215,142,229,161,135,182,118,11,203,130,138,130,68,192,62,121,53,100,217,230,129,223,99,110,36,194,87,187,47,255,222,187,115,237,94,36,8,115,49,130,229,65,29,
+129,238,210,172,9,79,19,150,214,76,220,251,224,158,115,174,252,177,200,123,191,83,40,242,254,143,3,79,24,187,148,4,201,208,12,155,71,116,156,137,107,137,123,221,254,61,118,58,197,67,138,84,150,242,
+194,53,42,77,113,225,21,65,111,26,245,5,186,150,245,132,72,75,116,254,206,43,136,10,29,46,196,57,147,92,163,127,79,121,167,112,178,68,40,37,12,242,77,104,107,99,201,180,38,168,140,145,24,65,29,34,72,
+140,64,100,254,30,44,183,162,181,193,147,141,179,144,80,28,131,239,37,213,122,29,254,61,56,225,107,45,242,164,117,10,11,66,153,167,174,69,40,251,215,236,172,62,229,100,232,17,174,10,149,12,138,94,241,
+175,173,199,41,85,231,34,149,174,13,66,175,80,20,202,84,194,154,68,217,191,6,174,101,131,83,166,73,37,159,127,123,151,48,41,148,132,21,230,208,215,137,21,255,28,156,171,203,69,62,187,9,209,33,228,133,
+130,48,47,20,133,69,97,89,88,21,174,11,55,132,138,207,13,255,223,86,253,159,89,244,127,103,222,63,6,199,234,112,145,117,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,
+92,201,76,153,155,155,239,16,242,66,65,152,23,138,194,162,176,44,172,10,215,133,27,66,197,231,134,255,111,171,254,207,44,250,191,51,239,31,131,99,185,174,224,12,11,222,37,76,10,37,97,69,80,117,98,197,
+63,7,231,114,131,65,205,42,151,47,63,183,65,232,21,138,66,89,80,77,162,236,95,3,215,226,134,131,235,93,46,93,122,182,71,184,42,84,4,149,49,42,254,181,185,9,33,41,139,222,41,44,8,229,12,138,30,70,217,
+191,102,55,37,172,214,114,241,226,51,121,161,36,168,90,152,158,62,163,142,30,157,84,133,194,65,213,215,55,228,125,71,143,29,181,217,95,143,237,86,88,132,25,172,201,227,239,108,196,192,238,91,252,12,
+159,92,235,237,29,84,35,35,7,212,145,35,19,234,212,169,211,170,214,235,240,239,193,77,10,77,40,252,181,36,65,62,127,254,178,58,118,108,74,13,13,141,122,95,204,66,204,96,165,109,149,197,152,85,151,109,
+5,11,57,56,22,159,99,25,24,24,81,227,227,199,189,115,38,76,132,107,46,17,34,202,133,11,115,157,66,81,80,113,152,157,61,167,14,28,56,236,61,217,230,242,234,181,138,174,11,31,5,31,103,26,29,61,164,102,
+102,206,170,184,215,237,223,163,123,53,232,69,158,166,57,158,168,56,140,141,141,91,69,79,243,105,15,35,106,197,15,201,112,240,224,17,21,247,62,184,103,39,252,249,203,221,194,114,181,96,241,62,31,28,
+44,120,251,228,101,77,120,208,23,130,112,61,212,57,168,55,196,72,2,238,189,61,23,135,158,59,119,233,138,160,162,56,113,98,198,171,140,213,67,244,180,133,183,177,123,119,175,154,154,154,86,213,238,147,
+88,180,147,240,93,194,82,84,64,120,226,121,138,178,248,180,199,17,222,92,52,178,103,79,159,231,8,85,146,128,152,172,239,222,197,179,103,47,22,132,138,160,194,24,30,222,239,237,144,149,101,155,143,43,
+188,14,255,79,11,34,234,222,253,216,172,207,45,98,206,156,185,176,32,168,48,104,179,211,6,111,53,155,175,182,100,204,92,77,68,61,230,240,225,99,42,42,22,196,106,189,137,95,138,186,225,254,254,225,150,
+183,249,106,194,155,236,221,219,95,45,9,90,127,155,184,211,167,207,119,8,139,130,178,49,49,113,194,251,218,229,122,177,249,56,194,235,75,205,232,121,164,83,41,44,62,126,236,58,90,85,252,141,194,82,
+216,205,237,223,63,182,110,109,190,154,240,38,116,57,71,36,1,49,108,173,173,98,103,103,207,109,20,94,161,183,206,6,150,223,14,54,95,109,177,41,155,88,4,208,82,8,139,151,31,203,141,173,34,126,135,176,
+20,118,51,180,141,219,201,230,171,9,175,195,88,67,68,18,16,211,236,191,14,102,102,206,46,210,55,110,66,59,152,129,154,118,181,249,40,225,3,216,138,134,79,193,17,43,91,12,137,109,166,197,159,158,62,83,
+162,19,199,228,228,201,89,175,178,215,238,54,31,37,188,14,77,69,122,65,109,177,36,198,89,21,127,33,174,248,237,108,243,97,162,219,146,128,216,133,36,65,182,250,9,196,178,10,216,150,13,70,201,156,205,
+199,23,126,203,150,183,222,132,201,43,97,113,37,230,89,17,191,75,168,216,46,146,97,91,103,243,201,133,215,161,119,52,36,1,136,121,243,199,14,196,166,150,176,42,147,125,251,6,156,205,215,40,186,14,27,
+96,242,32,217,98,76,236,155,42,190,84,84,174,80,89,49,97,64,199,217,124,237,194,35,186,9,125,39,182,88,163,65,179,196,239,182,93,16,51,118,156,205,167,39,188,14,51,142,66,146,160,241,147,74,166,166,
+166,151,153,236,96,178,125,251,78,103,243,53,216,124,20,236,77,12,84,166,109,49,71,139,70,139,63,103,187,16,186,51,157,205,167,243,180,7,162,155,208,170,10,73,130,198,204,49,60,126,252,84,167,160,76,
+152,29,235,108,190,126,194,7,176,121,53,117,44,155,6,104,83,247,4,152,156,60,89,20,148,9,109,86,103,243,245,21,62,128,184,218,52,64,155,122,139,159,183,157,152,38,159,179,249,244,69,55,133,215,161,
+105,24,146,4,245,91,124,50,49,113,226,26,147,56,116,152,222,20,188,247,157,205,167,255,180,219,224,75,41,252,28,45,46,83,15,52,170,151,248,121,203,201,188,117,116,206,230,27,39,188,14,45,46,155,38,
+104,149,122,2,28,59,54,85,98,253,157,14,237,82,103,243,245,179,249,48,225,117,152,89,101,234,130,86,169,138,63,62,126,188,147,185,107,38,140,239,59,155,111,204,211,110,131,15,86,81,249,182,105,131,
+102,105,38,192,130,121,2,243,233,119,54,223,24,225,17,221,132,69,178,150,4,72,111,200,248,232,209,201,50,243,246,117,168,133,58,155,111,140,205,135,9,31,192,136,161,169,15,154,165,37,126,143,229,224,
+94,183,164,179,249,198,216,124,20,124,21,141,107,177,105,132,118,107,78,128,35,71,38,174,178,75,134,14,11,54,157,205,55,231,105,215,133,215,97,178,173,169,19,218,173,73,124,105,227,111,16,42,180,245,
+117,152,184,232,108,190,241,194,155,162,235,208,23,99,234,228,107,183,97,45,9,208,107,30,148,102,135,179,249,198,219,124,20,124,224,18,24,143,177,36,65,111,205,9,48,54,54,94,164,183,73,135,17,63,103,
+243,205,177,249,48,225,3,24,41,52,245,66,195,181,36,64,217,60,32,237,78,103,243,205,177,121,155,232,58,116,199,91,18,160,182,214,192,161,67,71,187,4,165,67,219,223,217,124,115,109,62,140,251,239,127,
+192,131,62,1,83,55,180,172,37,1,38,205,3,177,107,135,179,249,230,218,124,152,240,1,188,162,45,9,48,153,56,1,228,105,47,241,196,235,176,118,205,217,252,131,77,127,218,109,194,7,240,138,54,117,67,203,
+196,9,32,86,178,130,157,232,176,195,166,179,249,230,219,124,24,247,221,247,102,79,15,83,55,180,76,42,126,135,229,32,111,176,126,103,243,205,177,121,155,240,1,252,188,77,59,52,141,157,0,210,214,207,
+211,222,215,97,159,62,103,243,217,176,121,155,240,58,172,33,48,245,67,211,36,9,80,48,15,64,229,194,217,252,150,76,61,237,97,48,76,111,73,128,248,107,9,71,71,15,205,211,171,164,67,5,208,217,124,118,
+133,191,247,222,174,155,80,17,52,245,67,211,216,9,80,40,28,44,178,205,186,14,253,255,206,230,179,99,243,54,225,3,24,169,53,245,67,211,36,9,176,104,30,128,45,216,157,205,103,199,230,109,194,7,80,79,
+179,36,64,252,221,69,70,70,14,44,179,115,149,14,163,77,206,230,179,99,243,54,54,111,126,147,7,241,50,245,67,211,36,9,176,106,30,128,209,63,103,243,217,177,121,155,240,1,92,183,37,1,86,99,39,192,240,
+240,254,235,44,63,210,193,86,156,205,103,199,230,109,194,7,112,124,83,63,52,141,157,0,67,67,163,55,248,252,138,78,53,225,157,205,55,231,105,15,195,212,15,77,147,36,64,197,60,128,179,249,108,11,127,
+207,61,247,191,14,75,2,84,98,39,192,224,96,161,66,207,159,142,179,249,108,217,124,152,240,1,166,126,104,154,36,1,110,216,18,192,217,124,118,108,62,76,120,224,255,45,9,16,255,21,48,48,48,114,157,143,
+27,232,80,7,200,146,205,211,217,113,233,210,156,250,252,231,191,168,254,242,47,63,162,182,111,127,178,237,108,222,228,238,187,239,243,224,88,166,126,104,26,59,1,250,251,135,87,25,80,208,161,21,208,
+236,167,29,23,154,157,61,163,190,246,181,175,171,215,94,123,237,117,188,250,234,171,222,134,148,237,100,243,166,240,1,92,183,169,31,154,38,73,128,101,243,0,244,3,52,75,248,137,137,41,245,133,47,92,85,
+191,255,253,239,223,32,188,206,39,63,249,233,182,177,121,155,240,1,196,204,146,0,241,59,130,250,250,134,22,153,254,165,67,79,96,35,109,254,224,193,49,245,153,207,20,213,175,127,253,235,72,209,117,190,
+254,245,111,180,141,205,71,193,67,106,234,135,166,73,18,160,104,30,128,177,128,122,63,237,3,3,195,234,35,31,249,152,250,229,47,255,53,182,232,58,239,121,207,123,219,198,230,77,238,186,235,222,155,48,
+113,199,146,0,241,7,131,122,123,7,231,89,254,165,195,16,99,61,132,103,145,233,251,223,255,1,245,79,255,244,79,53,137,30,245,244,175,103,155,183,9,31,192,151,88,76,253,208,52,118,2,236,219,55,80,96,
+223,31,29,86,160,166,101,243,212,216,159,127,254,5,245,195,31,254,159,53,137,78,197,239,211,159,254,140,26,29,61,216,118,54,111,19,62,128,135,213,212,15,77,147,36,64,222,60,0,91,193,172,69,244,255,
+215,108,123,70,125,247,187,139,107,18,157,138,224,231,63,255,5,53,62,62,217,214,54,111,99,211,166,205,30,172,16,178,36,64,252,41,97,123,247,246,119,240,89,51,19,211,250,171,9,79,223,65,88,179,45,41,
+95,253,234,215,212,244,244,172,119,13,206,230,237,194,3,63,111,211,14,77,19,205,12,150,95,88,49,15,66,83,48,142,240,65,179,237,191,255,251,191,215,36,250,183,191,253,29,117,225,194,101,245,208,67,143,
+182,101,109,62,137,240,1,184,173,69,252,149,196,235,2,246,236,233,43,49,17,84,135,150,64,152,232,125,125,131,137,155,109,54,126,240,131,31,170,119,189,235,121,239,155,122,237,94,155,143,43,186,14,15,
+169,169,27,90,38,78,128,221,187,123,39,217,116,64,103,199,142,119,90,223,239,251,247,31,90,147,232,63,253,233,63,170,247,189,239,253,106,215,174,158,182,235,180,73,75,248,59,239,188,199,131,7,199,212,
+13,45,107,73,128,46,243,64,61,61,251,172,237,247,111,124,227,111,18,139,254,139,95,252,210,235,195,199,57,218,185,211,38,45,225,3,104,86,91,18,160,182,47,139,136,224,101,68,215,161,147,193,236,170,
+229,9,174,181,217,230,108,62,185,232,54,225,1,45,76,189,208,176,230,253,1,228,151,139,230,1,89,31,104,38,192,167,63,253,87,161,162,255,238,119,191,179,54,219,156,205,175,253,105,55,161,187,222,146,0,
+181,111,16,33,118,210,139,165,232,208,198,52,199,222,217,46,238,251,223,255,254,27,154,109,167,78,189,177,217,230,108,62,125,225,239,184,227,110,15,70,67,77,189,208,112,45,9,176,65,168,152,7,101,104,
+216,190,97,225,152,215,4,36,33,218,109,8,182,81,54,111,19,30,136,191,69,124,180,171,125,147,40,202,83,79,237,185,74,47,160,14,31,53,108,199,153,54,89,176,121,83,248,0,122,90,77,157,208,110,205,251,4,
+238,218,181,187,135,197,134,38,180,4,218,109,166,77,22,108,222,6,199,183,105,132,118,169,236,22,42,7,42,155,7,167,194,225,108,190,177,54,111,227,246,219,239,242,186,220,45,226,167,179,85,44,69,42,126,
+11,84,254,116,232,20,114,54,223,88,155,55,133,15,224,187,1,166,62,104,150,102,2,116,90,78,224,245,9,56,155,111,140,205,155,162,7,4,95,18,179,144,238,7,164,118,238,124,186,196,30,1,58,44,25,119,54,191,
+185,41,194,7,208,245,107,234,130,86,169,127,49,68,218,152,121,218,153,38,184,128,179,249,250,219,124,216,211,111,211,4,173,234,242,221,32,57,240,53,243,100,188,127,156,205,55,230,105,15,232,236,220,
+228,253,201,204,31,139,248,245,249,104,20,229,137,39,118,229,153,26,102,66,199,143,179,249,250,10,143,232,58,212,252,109,90,160,81,93,191,29,40,39,40,218,78,76,191,128,179,249,250,11,15,220,91,136,
+248,245,253,112,36,69,154,127,157,52,1,77,182,110,221,230,108,62,101,155,15,131,62,24,155,6,104,211,144,239,7,203,123,127,142,119,191,9,99,4,206,230,211,125,218,117,110,187,237,78,175,226,103,139,61,
+154,52,244,11,226,114,194,101,219,133,240,42,112,54,159,190,240,192,253,134,136,223,216,207,199,83,30,127,252,201,110,250,1,76,152,55,232,108,126,237,54,175,11,31,192,130,15,91,204,209,34,215,140,34,
+39,190,98,187,32,90,5,206,230,211,17,61,128,189,25,67,196,191,146,107,102,145,182,232,18,237,81,19,154,41,206,230,215,46,60,240,90,181,197,152,216,231,154,93,182,109,219,209,37,84,232,146,52,97,54,
+144,179,249,218,133,7,58,216,108,177,245,99,222,149,203,66,145,11,41,132,92,164,151,189,206,230,147,137,14,183,222,122,135,231,160,97,113,37,230,185,44,149,238,238,237,11,204,20,50,97,18,41,19,71,156,
+205,111,138,37,122,0,49,33,118,182,152,18,235,92,22,139,92,88,201,118,193,180,12,108,73,224,108,254,141,194,7,226,19,179,16,241,75,185,44,23,201,218,69,50,215,68,79,2,103,243,118,225,129,215,36,177,
+178,197,144,216,230,178,94,228,226,59,132,37,110,194,6,117,2,103,243,118,232,60,11,139,155,31,211,142,92,43,20,185,208,141,194,43,97,55,67,235,160,221,109,222,4,119,140,16,159,88,110,204,181,82,217,
+186,117,219,70,97,137,65,34,27,244,19,180,171,205,235,220,114,203,237,222,3,17,22,39,63,134,173,37,190,150,4,29,194,98,216,205,209,99,136,237,181,147,205,7,162,3,247,195,140,170,8,241,137,93,71,174,
+213,203,163,143,118,151,232,199,14,131,122,65,59,216,124,32,60,208,193,19,21,19,98,150,91,79,69,110,104,33,234,134,25,74,166,227,99,189,218,124,0,215,204,235,175,138,248,11,185,245,88,30,121,228,29,5,
+161,194,50,166,48,24,239,110,5,225,147,136,14,65,69,47,234,222,253,216,20,114,235,185,60,252,240,99,93,194,18,179,90,194,8,22,151,182,186,205,7,80,207,97,235,150,168,123,246,99,210,149,107,151,34,55,
+123,165,74,64,110,78,57,111,53,155,15,8,190,224,85,237,62,137,69,174,29,203,67,15,109,237,22,150,5,21,5,137,128,125,242,106,200,178,205,3,191,199,220,72,132,175,118,95,254,189,119,231,218,189,72,16,
+230,98,4,203,131,58,2,221,165,89,19,158,38,44,173,153,184,247,193,61,231,92,249,99,145,247,126,167,80,228,253,31,7,158,48,118,41,9,146,161,25,54,143,232,56,19,215,18,247,186,253,123,236,116,138,135,
+20,169,44,229,133,107,84,154,226,194,43,130,222,52,234,11,116,45,235,9,145,150,232,252,157,87,16,21,58,92,136,115,38,185,70,255,158,242,78,225,100,137,80,74,24,228,155,208,214,198,146,105,77,80,25,35,
+49,130,58,68,144,24,129,200,252,61,88,110,69,107,131,39,27,103,33,161,56,6,95,42,169,245,58,252,123,112,194,215,90,228,73,235,20,22,132,50,79,93,139,80,246,175,217,89,125,202,201,208,35,92,21,42,25,
+20,189,226,95,91,143,83,170,206,69,42,93,27,132,94,161,40,148,169,132,53,137,178,127,13,92,203,6,167,76,147,74,62,255,246,46,97,82,40,9,43,204,161,175,19,43,254,57,56,87,151,139,124,118,19,162,67,200,
+11,5,97,94,40,10,139,194,178,176,42,92,23,110,8,21,159,27,254,191,173,250,63,179,232,255,206,188,127,12,142,213,225,34,235,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,
+138,43,174,184,146,153,50,55,55,223,33,228,133,130,48,47,20,133,69,97,89,88,21,174,11,55,132,138,207,13,255,223,86,253,159,89,244,127,103,222,63,6,199,114,93,193,25,22,188,75,152,20,74,194,138,160,
+234,196,138,127,14,206,229,6,131,154,85,46,95,126,110,131,208,43,20,133,178,160,154,68,217,191,6,174,197,13,7,215,187,92,186,244,108,143,112,85,168,8,42,99,84,252,107,115,19,66,82,22,189,83,88,16,202,
+25,20,61,140,178,127,205,110,74,88,173,229,226,197,103,242,66,73,80,181,48,61,125,70,29,61,58,169,10,133,131,170,175,111,200,251,142,30,59,106,179,191,30,219,173,176,8,51,88,147,199,223,217,136,129,
+221,183,248,25,62,185,214,219,59,168,70,70,14,168,35,71,38,212,169,83,167,85,173,215,225,223,131,155,20,154,80,248,107,73,130,124,254,252,101,117,236,216,148,26,26,26,245,190,152,133,152,193,74,219,
+42,139,49,171,46,219,10,22,114,112,44,62,199,50,48,48,162,198,199,143,123,231,76,152,8,215,92,34,68,148,11,23,230,58,133,162,160,226,48,59,123,78,29,56,112,216,123,178,205,229,213,107,21,93,23,62,10,
+62,206,52,58,122,72,205,204,156,85,113,175,219,191,71,247,106,208,139,60,77,115,60,81,113,24,27,27,183,138,158,230,211,30,70,212,138,31,146,225,224,193,35,42,238,125,112,207,78,248,243,151,187,133,
+229,106,193,226,125,62,56,88,240,246,201,203,154,240,160,47,4,225,122,168,115,80,111,136,145,4,220,123,123,46,14,61,119,238,210,21,65,69,113,226,196,140,87,25,171,135,232,105,11,111,99,247,238,94,53,
+53,53,173,170,221,39,177,104,39,225,187,132,165,168,128,240,196,243,20,101,241,105,143,35,188,185,104,100,207,158,62,207,17,170,36,1,49,89,223,189,139,103,207,94,44,8,21,65,133,49,60,188,223,219,33,
+43,203,54,31,87,120,29,254,159,22,68,212,189,251,177,89,159,91,196,156,57,115,97,65,80,97,208,102,167,13,222,106,54,95,109,201,152,185,154,136,122,204,225,195,199,84,84,44,136,213,122,19,191,20,117,
+195,253,253,195,45,111,243,213,132,55,217,187,183,191,90,18,180,254,54,113,167,79,159,239,16,22,5,101,99,98,226,132,247,181,203,245,98,243,113,132,215,151,154,209,243,72,167,82,88,124,252,216,117,180,
+170,248,27,133,165,176,155,219,191,127,108,221,218,124,53,225,77,232,114,142,72,2,98,216,90,91,197,206,206,158,219,40,188,66,111,157,13,44,191,29,108,190,218,98,83,54,177,8,160,165,16,22,47,63,150,27,
+91,69,252,14,97,41,236,102,104,27,183,147,205,87,19,94,135,177,134,136,36,32,166,217,127,29,204,204,156,93,164,111,220,132,118,48,3,53,237,106,243,81,194,7,176,21,13,159,130,35,86,182,24,18,219,76,
+139,63,61,125,166,68,39,142,201,201,147,179,94,101,175,221,109,62,74,120,29,154,138,244,130,218,98,73,140,179,42,254,66,92,241,219,217,230,195,68,183,37,1,177,11,73,130,108,245,19,136,101,21,176,45,
+27,140,146,57,155,143,47,252,150,45,111,189,9,147,87,194,226,74,204,179,34,126,151,80,177,93,36,195,182,206,230,147,11,175,67,239,104,72,2,16,243,230,143,29,136,77,45,97,85,38,251,246,13,56,155,175,
+81,116,29,54,192,228,65,178,197,152,216,55,85,124,169,168,92,161,178,98,194,128,142,179,249,218,133,71,116,19,250,78,108,177,70,131,102,137,223,109,187,32,102,236,56,155,79,79,120,29,102,28,133,36,65,
+227,39,149,76,77,77,47,51,217,193,100,251,246,157,206,230,107,176,249,40,216,155,24,168,76,219,98,142,22,141,22,127,206,118,33,116,103,58,155,79,231,105,15,68,55,161,85,21,146,4,141,153,99,120,252,
+248,169,78,65,153,48,59,214,217,124,253,132,15,96,243,106,234,88,54,13,208,166,238,9,48,57,121,178,40,40,19,218,172,206,230,235,43,124,0,113,181,105,128,54,245,22,63,111,59,49,77,62,103,243,233,139,
+110,10,175,67,211,48,36,9,234,183,248,100,98,226,196,53,38,113,232,48,189,41,120,239,59,155,79,255,105,183,193,151,82,248,57,90,92,166,30,104,84,47,241,243,150,147,121,235,232,156,205,55,78,120,29,90,
+92,54,77,208,42,245,4,56,118,108,170,196,250,59,29,218,165,206,230,235,103,243,97,194,235,48,179,202,212,5,173,82,21,127,124,252,120,39,115,215,76,24,223,119,54,223,152,167,221,6,31,172,162,242,109,
+211,6,205,210,76,128,5,243,4,230,211,239,108,190,49,194,35,186,9,139,100,45,9,144,222,144,241,209,163,147,101,230,237,235,80,11,117,54,223,24,155,15,19,62,128,17,67,83,31,52,75,75,252,30,203,193,189,
+110,73,103,243,141,177,249,40,248,42,26,215,98,211,8,237,214,156,0,71,142,76,92,101,151,12,29,22,108,58,155,111,206,211,174,11,175,195,100,91,83,39,180,91,147,248,210,198,223,32,84,104,235,235,48,113,
+209,217,124,227,133,55,69,215,161,47,198,212,201,215,110,195,90,18,160,215,60,40,205,14,103,243,141,183,249,40,248,192,37,48,30,99,73,130,222,154,19,96,108,108,188,72,111,147,14,35,126,206,230,155,99,
+243,97,194,7,48,82,104,234,133,134,107,73,128,178,121,64,218,157,206,230,155,99,243,54,209,117,232,142,183,36,64,109,173,129,67,135,142,118,9,74,135,182,191,179,249,230,218,124,24,247,223,255,128,7,
+125,2,166,110,104,89,75,2,76,154,7,98,215,14,103,243,205,181,249,48,225,3,120,69,91,18,96,50,113,2,200,211,94,226,137,215,97,237,154,179,249,7,155,254,180,219,132,15,224,21,109,234,134,150,137,19,64,
+172,100,5,59,209,97,135,77,103,243,205,183,249,48,238,187,239,205,158,30,166,110,104,153,84,252,14,203,65,222,96,253,206,230,155,99,243,54,225,3,248,121,155,118,104,26,59,1,164,173,159,167,189,175,
+195,62,125,206,230,179,97,243,54,225,117,88,67,96,234,135,166,73,18,160,96,30,128,202,133,179,249,45,153,122,218,195,96,152,222,146,0,241,215,18,142,142,30,154,167,87,73,135,10,160,179,249,236,10,127,
+239,189,93,55,161,34,104,234,135,166,177,19,160,80,56,88,100,155,117,29,250,255,157,205,103,199,230,109,194,7,48,82,107,234,135,166,73,18,96,209,60,0,91,176,59,155,207,142,205,219,132,15,160,158,102,
+73,128,248,187,139,140,140,28,88,102,231,42,29,70,155,156,205,103,199,230,109,108,222,252,38,15,226,101,234,135,166,73,18,96,213,60,0,163,127,206,230,179,99,243,54,225,3,184,110,75,2,172,198,78,128,
+225,225,253,215,89,126,164,131,173,56,155,207,142,205,219,132,15,224,248,166,126,104,26,59,1,134,134,70,111,240,249,21,157,106,194,59,155,111,206,211,30,134,169,31,154,38,73,128,138,121,0,103,243,217,
+22,254,158,123,238,127,29,150,4,168,196,78,128,193,193,66,133,158,63,29,103,243,217,178,249,48,225,3,76,253,208,52,73,2,220,176,37,64,86,108,126,215,174,30,53,55,247,172,186,118,237,43,234,71,63,250,
+145,250,196,39,62,41,149,212,135,219,202,230,195,132,7,254,223,146,0,241,95,1,3,3,35,215,249,184,129,14,117,128,102,217,60,125,16,167,78,205,170,98,241,115,234,231,63,95,86,175,189,246,218,27,120,249,
+229,151,219,206,230,77,238,190,251,62,15,142,101,234,135,166,177,19,160,191,127,120,149,1,5,29,90,1,141,122,218,57,246,216,216,81,245,151,127,249,17,245,15,255,240,35,171,224,54,14,30,60,220,86,54,
+111,10,31,192,117,155,250,161,105,146,4,88,54,15,64,63,64,61,133,239,239,31,82,239,121,207,123,213,183,190,245,29,245,127,255,239,255,141,45,186,206,212,212,169,182,177,121,155,240,1,188,10,45,9,16,
+191,35,168,175,111,104,145,233,95,58,244,4,166,105,243,108,31,123,241,226,101,245,210,75,95,82,43,43,43,53,9,174,67,210,208,7,222,46,54,31,5,15,169,169,31,154,38,73,128,162,121,0,222,195,107,121,218,
+31,121,228,49,117,226,196,41,245,233,79,127,70,189,242,202,207,214,44,184,206,202,202,171,114,236,233,182,178,121,147,187,238,186,247,38,76,220,177,36,64,252,193,160,222,222,193,121,150,127,233,48,
+196,152,84,248,3,7,198,212,139,47,126,72,253,224,7,63,76,85,112,224,152,31,252,224,255,82,251,247,31,106,75,155,183,9,31,192,151,88,76,253,208,52,118,2,236,219,55,80,96,223,31,29,86,160,86,19,125,223,
+190,126,245,238,119,47,168,191,249,155,111,170,223,253,238,119,169,10,254,179,159,253,204,115,143,227,199,79,122,243,223,219,221,230,109,194,7,240,176,154,250,161,105,146,4,200,155,7,96,43,152,48,225,
+223,247,190,247,171,127,255,247,95,165,42,248,171,175,190,234,213,15,168,39,144,124,237,88,155,79,34,58,108,218,180,217,131,21,66,150,4,136,63,37,108,239,222,254,14,62,107,102,98,90,63,54,207,19,159,
+134,224,229,114,89,125,251,219,223,81,47,188,240,94,121,95,13,186,218,124,13,194,3,63,111,211,14,77,19,205,12,150,95,88,49,15,66,83,208,172,205,255,248,199,63,174,89,116,122,241,104,235,211,230,39,
+185,218,177,211,38,45,225,3,104,2,90,196,95,73,188,46,96,207,158,190,18,19,65,117,104,9,152,237,247,159,252,100,41,182,224,203,203,191,80,159,253,236,231,188,94,61,62,15,235,58,109,210,17,93,135,135,
+212,212,13,45,19,39,192,238,221,189,147,108,58,160,179,99,199,59,223,144,0,47,188,240,231,161,130,255,246,183,191,85,95,249,202,87,189,126,123,250,239,219,181,111,190,17,194,223,121,231,61,30,124,140,
+210,212,13,45,107,73,128,46,243,64,61,61,251,172,163,113,52,245,126,243,155,223,120,239,241,197,197,239,169,43,87,254,66,13,13,21,92,223,124,157,108,222,38,124,0,123,55,89,18,160,182,47,139,136,224,
+101,68,215,161,147,193,13,193,54,247,105,183,9,15,196,223,212,11,13,107,222,31,64,126,185,104,30,144,245,129,237,58,211,38,43,54,31,6,221,245,150,4,168,125,131,8,177,147,94,44,69,135,54,102,59,207,
+180,201,130,205,155,220,113,199,221,30,140,175,152,122,161,225,90,18,96,131,80,49,15,202,208,176,179,249,230,216,188,77,120,32,238,22,241,209,174,246,77,162,40,79,61,181,231,42,189,128,58,124,212,208,
+217,124,115,158,118,83,248,0,70,66,77,157,208,110,205,251,4,238,218,181,187,135,197,134,38,180,4,156,205,55,222,230,109,112,124,155,70,104,151,202,110,161,114,160,178,121,112,42,28,206,230,27,107,243,
+54,110,191,253,46,111,186,158,69,252,116,182,138,165,72,197,111,129,202,159,14,157,66,206,230,27,107,243,166,240,1,124,55,192,212,7,205,210,76,128,78,203,9,188,62,1,103,243,141,177,121,83,244,128,224,
+75,98,22,210,253,128,212,206,157,79,151,216,35,64,135,37,227,206,230,55,55,69,248,0,186,126,77,93,208,42,245,47,134,72,27,51,79,59,211,4,23,112,54,95,127,155,15,123,250,109,154,160,85,93,190,27,36,7,
+190,102,158,140,247,143,179,249,198,60,237,1,157,157,155,188,63,153,249,99,17,191,62,31,141,162,60,241,196,174,60,179,115,76,248,112,132,179,249,250,10,143,232,58,212,252,109,90,160,81,93,191,29,40,
+39,40,218,78,76,191,128,179,249,250,11,15,220,91,136,248,245,253,112,36,69,154,127,157,52,1,77,152,224,225,108,62,93,155,15,131,62,24,155,6,104,211,144,239,7,203,123,127,142,119,191,9,99,4,206,230,
+211,125,218,117,110,187,237,78,175,226,103,139,61,154,52,244,11,226,114,194,101,219,133,240,42,112,54,159,190,240,192,253,134,136,223,216,207,199,83,30,127,252,201,110,250,1,76,152,55,232,108,126,237,
+54,175,11,31,192,130,15,91,204,209,34,215,140,34,39,190,98,187,32,90,5,206,230,211,17,61,128,189,25,67,196,191,146,107,102,145,182,232,18,237,81,19,154,41,206,230,215,46,60,240,90,181,197,152,216,231,
+154,93,254,127,246,222,237,59,174,163,204,251,239,63,192,55,186,244,117,18,37,113,18,39,65,228,34,179,154,25,114,48,200,191,216,33,56,200,7,89,182,228,150,15,178,44,75,150,109,201,231,131,146,8,16,33,
+102,152,1,134,211,64,160,201,76,3,38,49,100,8,188,3,154,23,134,4,18,49,144,1,17,32,239,18,48,195,104,50,244,202,149,111,125,209,245,123,62,123,246,54,149,74,237,238,221,173,62,236,86,63,181,214,103,
+197,177,165,125,120,190,79,125,119,85,237,170,218,27,55,110,238,17,74,12,73,186,48,215,95,109,190,118,225,129,1,54,95,108,195,152,247,100,210,80,228,66,114,49,23,25,100,175,218,124,117,162,195,141,55,
+222,18,56,104,92,92,137,121,38,77,165,183,119,211,28,51,133,92,152,68,202,196,17,181,249,117,137,68,143,32,38,196,206,23,83,98,157,73,99,145,11,43,248,46,152,158,129,47,9,212,230,223,46,124,36,62,49,
+139,17,191,144,73,115,145,172,157,39,115,93,236,36,80,155,247,11,15,60,38,137,149,47,134,196,54,147,246,34,23,223,37,44,112,19,62,104,19,168,205,251,97,240,44,46,110,97,76,187,50,237,80,228,66,215,10,
+175,198,221,12,189,131,78,183,121,23,220,177,140,248,196,114,109,166,157,202,134,13,27,215,10,11,188,36,242,193,56,65,167,218,188,205,13,55,220,28,84,136,184,56,133,49,108,47,241,173,36,232,18,230,
+227,110,142,17,67,108,175,147,108,62,18,29,184,31,102,84,149,17,159,216,117,101,218,189,60,248,96,111,129,113,236,56,104,23,116,130,205,71,194,3,3,60,229,98,66,204,50,171,169,200,13,205,149,187,97,94,
+37,51,240,177,90,109,62,130,107,230,241,87,65,252,185,204,106,44,15,60,240,222,156,80,98,25,83,28,188,239,110,7,225,171,17,29,162,134,94,185,123,15,99,147,203,172,230,114,255,253,239,233,17,22,152,
+213,18,7,109,3,214,27,180,187,205,71,208,206,97,235,150,114,247,28,198,164,39,211,41,69,110,246,82,133,128,92,159,114,222,110,54,31,17,125,193,171,210,125,18,139,76,39,150,251,238,219,208,43,44,178,
+241,99,57,72,4,236,147,71,67,154,109,30,248,61,230,70,34,124,165,251,10,239,189,55,211,233,69,130,48,147,32,88,1,180,17,24,46,77,155,240,116,97,233,205,36,189,15,238,57,163,229,207,69,158,251,221,66,
+158,231,127,18,168,97,236,82,18,37,67,43,108,30,209,113,38,174,37,233,117,135,247,216,173,138,199,20,105,44,101,133,43,52,154,146,194,35,130,209,52,218,11,12,45,219,9,81,47,209,249,51,143,32,26,116,
+184,16,231,172,230,26,195,123,202,170,194,213,37,66,161,202,32,95,135,190,54,150,76,111,130,198,24,137,17,181,33,162,196,136,68,230,207,209,114,43,122,27,212,108,156,133,132,226,24,124,47,169,214,235,
+8,239,65,133,175,181,72,77,235,22,230,132,34,181,174,77,40,134,215,172,86,95,231,100,232,19,46,11,165,20,138,94,10,175,173,79,149,106,112,145,70,215,26,161,95,200,11,69,26,97,45,162,24,94,3,215,178,
+70,149,105,81,201,102,223,221,35,76,8,5,97,137,57,244,13,98,41,60,7,231,234,209,200,167,55,33,186,132,172,144,19,102,133,188,48,47,44,10,203,194,85,225,154,80,10,185,22,254,221,114,248,51,243,225,239,
+204,134,199,224,88,93,26,89,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,73,77,153,153,153,237,18,178,66,78,152,21,242,194,188,176,40,44,11,87,133,107,66,41,228,90,
+248,119,203,225,207,204,135,191,51,27,30,131,99,233,80,112,138,5,239,17,38,132,130,176,36,152,6,177,20,158,131,115,233,203,160,86,149,139,23,159,88,35,244,11,121,161,40,152,22,81,12,175,129,107,209,
+215,193,141,46,23,46,60,222,39,92,22,74,130,73,25,165,240,218,116,66,72,157,69,239,22,230,132,98,10,69,143,163,24,94,179,78,9,171,181,156,63,255,88,86,40,8,166,22,166,166,78,153,67,135,38,76,46,183,
+223,236,220,57,24,124,71,143,29,181,217,95,143,237,86,88,132,25,173,201,227,207,108,196,192,238,91,252,12,159,92,235,239,223,109,246,236,217,103,70,71,199,205,241,227,39,77,173,215,17,222,131,78,10,
+173,82,248,43,213,4,249,236,217,139,230,240,225,73,51,56,56,28,124,49,11,49,163,149,182,21,22,99,86,92,182,21,45,228,224,88,124,142,101,215,174,61,102,108,236,72,112,206,42,19,225,138,38,66,153,114,
+238,220,76,183,144,23,76,18,78,156,56,99,246,237,59,24,212,108,119,121,245,74,69,183,133,47,7,31,103,26,30,62,96,166,167,79,155,164,215,29,222,163,62,26,236,34,181,105,134,26,149,132,145,145,49,175,
+232,245,172,237,113,148,91,241,67,50,236,223,63,106,146,222,7,247,172,194,159,189,216,43,44,86,10,22,207,243,221,187,115,193,62,121,105,19,30,236,133,32,92,15,109,14,218,13,9,146,128,123,239,204,197,
+161,103,206,92,184,36,152,114,28,61,58,29,52,198,26,33,122,189,133,247,177,117,107,191,153,156,156,50,149,238,147,88,116,146,240,61,194,66,185,128,80,227,169,69,105,172,237,73,132,119,23,141,108,219,
+182,51,112,132,10,73,64,76,86,247,232,226,233,211,231,115,66,73,48,113,12,13,237,13,118,200,74,179,205,39,21,222,134,127,167,7,81,238,222,195,216,172,206,45,98,78,157,58,55,39,152,56,232,179,211,7,
+111,55,155,175,180,100,204,93,77,68,59,230,224,193,195,166,92,44,136,213,106,19,191,80,238,134,7,6,134,218,222,230,43,9,239,178,125,251,64,165,36,104,255,109,226,78,158,60,219,37,204,11,198,199,248,
+248,209,224,107,151,171,197,230,147,8,111,47,53,99,228,145,65,165,184,248,132,177,235,106,87,241,215,10,11,113,55,183,119,239,200,170,181,249,74,194,187,48,228,92,38,9,136,97,123,109,21,123,226,196,
+153,181,194,171,140,214,249,192,242,59,193,230,43,45,54,101,19,139,8,122,10,113,241,10,99,185,182,93,196,239,18,22,226,110,134,190,113,39,217,124,37,225,109,120,215,80,38,9,136,105,250,31,7,211,211,
+167,231,25,27,119,161,31,204,139,154,78,181,249,114,194,71,176,21,13,159,130,35,86,190,24,18,219,84,139,63,53,117,170,192,32,142,203,177,99,39,130,198,94,167,219,124,57,225,109,232,42,50,10,234,139,
+37,49,78,171,248,115,73,197,239,100,155,143,19,221,151,4,196,46,38,9,210,53,78,32,150,149,195,182,124,240,150,76,109,62,185,240,247,222,251,174,235,48,121,37,46,174,196,60,45,226,247,8,37,223,69,242,
+218,86,109,190,122,225,109,24,29,141,73,0,98,222,250,119,7,98,83,11,88,149,203,142,29,187,212,230,107,20,221,134,13,48,169,72,190,24,19,251,150,138,47,13,149,75,52,86,92,120,161,163,54,95,187,240,136,
+238,194,216,137,47,214,104,208,42,241,123,125,23,196,140,29,181,249,250,9,111,195,140,163,152,36,104,254,164,146,201,201,169,69,38,59,184,108,218,244,136,218,124,13,54,95,14,246,38,6,26,211,190,152,
+163,69,179,197,159,241,93,8,195,153,106,243,245,169,237,145,232,46,244,170,98,146,160,57,115,12,143,28,57,222,45,24,23,102,199,170,205,55,78,248,8,54,175,166,141,229,211,0,109,26,158,0,19,19,199,242,
+130,113,161,207,170,54,223,88,225,35,136,171,79,3,180,105,180,248,89,223,137,233,242,169,205,215,95,116,87,120,27,186,134,49,73,208,184,197,39,227,227,71,175,48,137,195,134,233,77,209,115,95,109,190,
+254,181,221,7,95,74,225,231,232,113,185,122,160,81,163,196,207,122,78,22,172,163,83,155,111,158,240,54,244,184,124,154,160,85,221,19,224,240,225,201,2,235,239,108,232,151,170,205,55,206,230,227,132,
+183,97,102,149,171,11,90,213,85,252,177,177,35,221,204,93,115,225,253,190,218,124,115,106,187,15,62,88,69,227,219,167,13,154,213,51,1,230,220,19,184,181,95,109,190,57,194,35,186,11,139,100,61,9,80,
+191,87,198,135,14,77,20,153,183,111,67,43,84,109,190,57,54,31,39,124,4,111,12,93,125,208,172,94,226,247,121,14,30,12,75,170,205,55,199,230,203,193,87,209,184,22,159,70,104,183,226,4,24,29,29,191,204,
+46,25,54,44,216,84,155,111,77,109,183,133,183,97,178,173,171,19,218,173,72,124,233,227,175,17,74,244,245,109,152,184,168,54,223,124,225,93,209,109,24,139,113,117,10,181,91,179,146,4,232,119,15,74,183,
+67,109,190,249,54,95,14,62,112,9,188,143,241,36,65,127,205,9,48,50,50,150,103,180,201,134,55,126,106,243,173,177,249,56,225,35,120,83,232,234,133,134,43,73,128,162,123,64,250,157,106,243,173,177,121,
+159,232,54,12,199,123,18,160,182,222,192,129,3,135,122,4,99,67,223,95,109,190,181,54,31,199,221,119,223,19,192,152,128,171,27,90,214,146,0,19,238,129,216,181,67,109,190,181,54,31,39,124,4,143,104,79,
+2,76,84,157,0,82,219,11,212,120,27,214,174,169,205,255,69,203,107,187,79,248,8,30,209,174,110,104,89,117,2,136,149,44,97,39,54,236,176,169,54,223,122,155,143,227,174,187,222,25,232,225,234,134,150,
+213,138,223,229,57,200,219,172,95,109,190,53,54,239,19,62,130,159,247,105,135,166,137,19,64,250,250,89,250,251,54,236,211,167,54,159,14,155,247,9,111,195,26,2,87,63,52,173,38,1,114,238,1,104,92,168,
+205,223,155,170,218,30,7,175,233,61,9,144,124,45,225,240,240,129,89,70,149,108,104,0,170,205,167,87,248,59,239,236,185,14,13,65,87,63,52,77,156,0,185,220,254,60,219,172,219,48,254,175,54,159,30,155,
+247,9,31,193,155,90,87,63,52,173,38,1,230,221,3,176,5,187,218,124,122,108,222,39,124,4,237,52,79,2,36,223,93,100,207,158,125,139,236,92,101,195,219,38,181,249,244,216,188,143,245,235,223,17,64,188,92,
+253,208,180,154,4,88,118,15,192,219,63,181,249,244,216,188,79,248,8,174,219,147,0,203,137,19,96,104,104,239,85,150,31,217,96,43,106,243,233,177,121,159,240,17,28,223,213,15,77,19,39,192,224,224,240,
+53,62,191,98,83,73,120,181,249,214,212,246,56,92,253,208,180,154,4,40,185,7,80,155,79,183,240,119,220,113,247,91,240,36,64,41,113,2,236,222,157,43,49,242,103,147,6,155,223,186,117,135,57,121,242,180,
+249,204,103,62,103,190,247,189,239,155,223,253,238,119,230,143,127,252,163,121,230,153,127,8,126,167,147,108,62,78,248,8,87,63,52,173,38,1,174,249,18,160,89,54,207,59,135,161,161,97,51,51,243,132,201,
+231,159,49,47,189,244,146,121,227,141,55,204,155,111,190,25,203,215,191,126,185,163,108,62,78,120,224,223,61,9,144,252,17,176,107,215,158,171,124,220,192,134,54,64,35,68,223,184,113,147,25,29,61,108,
+158,124,242,41,243,141,111,60,107,126,254,243,87,203,10,93,142,108,246,175,58,202,230,93,110,191,253,174,0,142,229,234,135,166,137,19,96,96,96,104,153,23,10,54,244,2,86,42,252,150,45,125,230,248,241,
+105,243,201,79,254,157,121,225,133,239,154,223,254,246,183,53,139,237,79,128,119,119,148,205,187,194,71,112,221,174,126,104,90,77,2,44,186,7,96,28,32,169,240,60,46,6,6,6,205,185,115,23,205,23,191,248,
+180,249,193,15,126,104,254,243,63,255,88,87,177,93,46,95,126,182,163,108,222,39,124,4,143,66,79,2,36,31,8,218,185,115,112,158,233,95,54,140,4,198,9,190,119,239,1,243,161,15,205,153,66,225,107,102,97,
+97,161,161,66,187,208,54,40,20,190,26,36,102,39,217,124,57,136,133,171,31,154,86,147,0,121,247,0,188,11,240,137,255,236,179,207,53,77,108,90,253,180,254,63,243,153,207,154,19,39,78,153,190,190,237,29,
+107,243,46,183,221,118,231,117,104,68,123,18,32,249,203,160,254,254,221,179,44,255,178,225,21,163,251,124,159,153,121,188,97,98,47,46,46,154,111,126,243,91,230,99,31,251,184,57,124,248,136,121,232,
+161,135,59,174,53,95,173,240,17,124,137,197,213,15,77,19,39,192,142,29,187,114,236,251,99,195,10,84,183,81,247,143,255,248,213,186,136,253,202,43,11,129,141,127,240,131,31,54,195,195,251,131,249,237,
+218,154,175,94,248,8,42,171,171,31,154,86,147,0,89,247,0,108,5,227,38,192,199,63,254,183,85,9,205,160,13,13,194,47,124,225,105,115,246,236,5,201,202,93,129,155,116,250,160,205,74,106,187,205,186,117,
+235,3,88,33,228,73,128,228,83,194,182,111,31,232,226,179,102,46,110,215,142,137,7,191,248,197,47,188,98,255,246,183,175,75,87,239,59,230,19,159,248,148,57,122,116,74,46,234,3,29,59,54,223,44,225,129,
+159,247,105,135,166,85,205,12,150,95,88,114,15,66,87,208,29,166,125,240,193,247,6,78,128,133,51,152,51,58,58,22,76,31,215,177,249,198,218,188,43,124,4,241,245,136,191,84,245,186,128,109,219,118,22,
+152,8,106,67,79,64,95,193,166,167,182,251,160,146,186,186,161,101,213,9,176,117,107,255,4,155,14,216,108,222,252,126,125,5,155,82,225,111,189,245,142,0,62,70,233,234,134,150,181,36,64,143,123,160,190,
+190,29,250,10,54,5,54,239,19,62,130,189,155,60,9,80,219,151,69,68,240,34,162,219,48,200,160,54,223,218,218,238,19,30,136,191,171,23,26,214,188,63,128,252,114,222,61,160,175,129,167,54,223,92,155,143,
+131,225,122,79,2,212,190,65,132,216,73,63,150,98,67,31,83,109,190,181,54,239,114,203,45,183,7,240,121,62,87,47,52,92,73,2,172,17,74,238,65,121,53,172,54,223,26,155,247,9,15,196,221,35,62,218,213,190,
+73,20,229,209,71,183,93,102,20,208,134,143,26,170,205,183,166,182,187,194,71,48,40,231,234,132,118,43,222,39,112,203,150,173,125,44,54,116,161,39,160,54,223,124,155,247,193,241,125,26,161,93,93,118,
+11,149,3,21,221,131,211,224,80,155,111,174,205,251,184,249,230,219,130,233,122,30,241,235,179,85,44,69,26,126,115,52,254,108,24,20,82,155,111,174,205,187,194,71,240,221,0,87,31,52,171,103,2,116,123,
+78,16,140,9,168,205,55,199,230,93,209,35,162,47,137,121,168,239,7,164,30,121,228,3,5,246,8,176,97,201,184,218,252,250,150,8,31,193,208,175,171,11,90,213,253,139,33,210,199,204,210,207,116,193,5,212,
+230,27,111,243,113,181,223,167,9,90,53,228,187,65,114,224,43,238,201,120,254,168,205,55,167,182,71,116,119,175,11,254,203,204,31,143,248,141,249,104,20,229,225,135,183,100,153,26,230,194,135,35,212,
+230,27,43,60,162,219,208,242,247,105,129,70,13,253,118,160,156,32,239,59,49,227,2,106,243,141,23,30,184,183,24,241,27,251,225,72,138,116,255,186,233,2,186,108,216,176,81,109,190,206,54,31,7,99,48,62,
+13,208,166,41,223,15,150,231,254,12,207,126,23,222,17,168,205,215,183,182,219,220,116,211,173,65,195,207,23,123,52,105,234,23,196,229,132,139,190,11,225,81,160,54,95,127,225,129,251,141,17,191,185,
+159,143,167,60,244,208,251,122,25,7,112,97,222,160,218,252,202,109,222,22,62,130,5,31,190,152,163,69,166,21,69,78,124,201,119,65,244,10,212,230,235,35,122,4,43,159,99,196,191,148,105,101,145,190,232,
+2,253,81,23,186,41,106,243,43,23,30,120,172,250,98,76,236,51,173,46,27,55,110,238,17,74,12,73,186,176,144,68,109,190,118,225,129,1,54,95,108,195,152,247,100,210,80,228,66,114,49,23,25,100,175,218,124,
+117,162,195,141,55,222,18,56,104,92,92,137,121,38,77,165,183,119,211,28,51,133,92,152,68,202,196,17,181,249,117,137,68,143,32,38,196,206,23,83,98,157,73,99,145,11,43,248,46,152,158,129,47,9,212,230,
+223,46,124,36,62,49,139,17,191,144,73,115,145,172,157,39,115,93,236,36,80,155,247,11,15,60,38,137,149,47,134,196,54,147,246,34,23,223,37,44,112,19,62,104,19,168,205,251,97,240,44,46,110,97,76,187,50,
+237,80,228,66,215,10,175,198,221,12,189,131,78,183,121,23,220,177,140,248,196,114,109,166,157,202,134,13,27,215,10,11,188,36,242,193,56,65,167,218,188,205,13,55,220,28,84,136,184,56,133,49,108,47,241,
+173,36,232,18,230,227,110,142,17,67,108,175,147,108,62,18,29,184,31,102,84,149,17,159,216,117,101,218,189,60,248,96,111,129,113,236,56,104,23,116,130,205,71,194,3,3,60,229,98,66,204,50,171,169,200,13,
+205,149,187,97,94,37,51,240,177,90,109,62,130,107,230,241,87,65,252,185,204,106,44,15,60,240,222,156,80,98,25,83,28,188,239,110,7,225,171,17,29,162,134,94,185,123,15,99,147,203,172,230,114,255,253,
+239,233,17,22,152,213,18,7,109,3,214,27,180,187,205,71,208,206,97,235,150,114,247,28,198,164,39,211,41,69,110,246,82,133,128,92,159,114,222,110,54,31,17,125,193,171,210,125,18,139,76,39,150,251,238,
+219,208,43,44,178,49,100,57,72,4,236,147,71,67,154,109,30,248,61,230,70,34,124,165,251,10,239,189,55,211,233,69,130,48,147,32,88,1,180,17,24,46,77,155,240,116,97,233,205,36,189,15,238,57,163,229,207,
+69,158,251,221,66,158,231,127,18,168,97,236,82,18,37,67,43,108,30,209,113,38,174,37,233,117,135,247,216,173,138,199,20,105,44,101,133,43,52,154,146,194,35,130,209,52,218,11,12,45,219,9,81,47,209,249,
+51,143,32,26,116,184,16,231,172,230,26,195,123,202,170,194,213,37,66,161,202,32,95,135,190,54,150,76,111,130,198,24,137,17,181,33,162,196,136,68,230,207,209,114,43,122,27,212,108,156,133,132,226,24,
+124,0,163,214,235,8,239,65,133,175,181,72,77,235,22,230,132,34,181,174,77,40,134,215,172,86,95,231,100,232,19,46,11,165,20,138,94,10,175,173,79,149,106,112,145,70,215,26,161,95,200,11,69,26,97,45,162,
+24,94,3,215,178,70,149,105,81,201,102,223,221,35,76,8,5,97,137,57,244,13,98,41,60,7,231,234,209,200,167,55,33,186,132,172,144,19,102,133,188,48,47,44,10,203,194,85,225,154,80,10,185,22,254,221,114,
+248,51,243,225,239,204,134,199,224,88,93,26,89,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,73,77,153,153,153,237,18,178,66,78,152,21,242,194,188,176,40,44,11,87,133,
+107,66,41,228,90,248,119,203,225,207,204,135,191,51,27,30,131,99,233,80,112,138,5,239,17,38,132,130,176,36,152,6,177,20,158,131,115,233,203,160,86,149,139,23,159,88,35,244,11,121,161,40,152,22,81,12,
+175,129,107,209,215,193,141,46,23,46,60,222,39,92,22,74,130,73,25,165,240,218,116,66,72,157,69,239,22,230,132,98,10,69,143,163,24,94,179,78,9,171,181,156,63,255,88,86,40,8,166,22,166,166,78,153,67,
+135,38,76,46,183,223,236,220,57,24,124,71,143,29,181,217,95,143,237,86,88,132,25,173,201,227,207,108,196,192,238,91,252,12,159,92,235,239,223,109,246,236,217,103,70,71,199,205,241,227,39,77,173,215,
+17,222,131,78,10,173,82,248,43,213,4,249,236,217,139,230,240,225,73,51,56,56,28,124,49,11,49,163,149,182,21,22,99,86,92,182,21,45,228,224,88,124,142,101,215,174,61,102,108,236,72,112,206,42,19,225,
+138,38,66,153,114,238,220,76,183,144,23,76,18,78,156,56,99,246,237,59,24,212,108,119,121,245,74,69,183,133,47,7,31,103,26,30,62,96,166,167,79,155,164,215,29,222,163,62,26,236,34,181,105,134,26,149,
+132,145,145,49,175,232,245,172,237,113,148,91,241,67,50,236,223,63,106,146,222,7,247,172,194,159,189,216,43,44,86,10,22,207,243,221,187,115,193,62,121,105,19,30,236,133,32,92,15,109,14,218,13,9,146,
+128,123,239,204,197,161,103,206,92,184,36,152,114,28,61,58,29,52,198,26,33,122,189,133,247,177,117,107,191,153,156,156,50,149,238,147,88,116,146,240,61,194,66,185,128,80,227,169,69,105,172,237,73,132,
+119,23,141,108,219,182,51,112,132,10,73,64,76,86,247,232,226,233,211,231,115,66,73,48,113,12,13,237,13,118,200,74,179,205,39,21,222,134,127,167,7,81,238,222,195,216,172,206,45,98,78,157,58,55,39,152,
+56,232,179,211,7,111,55,155,175,180,100,204,93,77,68,59,230,224,193,195,166,92,44,136,213,106,19,191,80,238,134,7,6,134,218,222,230,43,9,239,178,125,251,64,165,36,104,255,109,226,78,158,60,219,37,204,
+11,198,199,248,248,209,224,107,151,171,197,230,147,8,111,47,53,99,228,145,65,165,184,248,132,177,235,106,87,241,215,10,11,113,55,183,119,239,200,170,181,249,74,194,187,48,228,92,38,9,136,97,123,109,
+21,123,226,196,153,181,194,171,140,214,249,192,242,59,193,230,43,45,54,101,19,139,8,122,10,113,241,10,99,185,182,93,196,239,18,22,226,110,134,190,113,39,217,124,37,225,109,120,215,80,38,9,136,105,250,
+31,7,211,211,167,231,25,27,119,161,31,204,139,154,78,181,249,114,194,71,176,21,13,159,130,35,86,190,24,18,219,84,139,63,53,117,170,192,32,142,203,177,99,39,130,198,94,167,219,124,57,225,109,232,42,50,
+10,234,139,37,49,78,171,248,115,73,197,239,100,155,143,19,221,151,4,196,46,38,9,210,53,78,32,150,149,195,182,124,240,150,76,109,62,185,240,247,222,251,174,235,48,121,37,46,174,196,60,45,226,247,8,37,
+223,69,242,218,86,109,190,122,225,109,24,29,141,73,0,98,222,250,119,7,98,83,11,88,149,203,142,29,187,212,230,107,20,221,134,13,48,169,72,190,24,19,251,150,138,47,13,149,75,52,86,92,120,161,163,54,95,
+187,240,136,238,194,216,137,47,214,104,208,42,241,123,125,23,196,140,29,181,249,250,9,111,195,140,163,152,36,104,254,164,146,201,201,169,69,38,59,184,108,218,244,136,218,124,13,54,95,14,246,38,6,26,
+211,190,152,163,69,179,197,159,241,93,8,195,153,106,243,245,169,237,145,232,46,244,170,98,146,160,57,115,12,143,28,57,222,45,24,23,102,199,170,205,55,78,248,8,54,175,166,141,229,211,0,109,26,158,0,19,
+19,199,242,130,113,161,207,170,54,223,88,225,35,136,171,79,3,180,105,180,248,89,223,137,233,242,169,205,215,95,116,87,120,27,186,134,49,73,208,184,197,39,227,227,71,175,48,137,195,134,233,77,209,115,
+95,109,190,254,181,221,7,95,74,225,231,232,113,185,122,160,81,163,196,207,122,78,22,172,163,83,155,111,158,240,54,244,184,124,154,160,85,221,19,224,240,225,201,2,235,239,108,232,151,170,205,55,206,
+230,227,132,183,97,102,149,171,11,90,213,85,252,177,177,35,221,204,93,115,225,253,190,218,124,115,106,187,15,62,88,69,227,219,167,13,154,213,51,1,230,220,19,184,181,95,109,190,57,194,35,186,11,139,
+100,61,9,80,191,87,198,135,14,77,20,153,183,111,67,43,84,109,190,57,54,31,39,124,4,111,12,93,125,208,172,94,226,247,121,14,30,12,75,170,205,55,199,230,203,193,87,209,184,22,159,70,104,183,226,4,24,29,
+29,191,204,46,25,54,44,216,84,155,111,77,109,183,133,183,97,178,173,171,19,218,173,72,124,233,227,175,17,74,244,245,109,152,184,168,54,223,124,225,93,209,109,24,139,113,117,10,181,91,179,146,4,232,
+119,15,74,183,67,109,190,249,54,95,14,62,112,9,188,143,241,36,65,127,205,9,48,50,50,150,103,180,201,134,55,126,106,243,173,177,249,56,225,35,120,83,232,234,133,134,43,73,128,162,123,64,250,157,106,
+243,173,177,121,159,232,54,12,199,123,18,160,182,222,192,129,3,135,122,4,99,67,223,95,109,190,181,54,31,199,221,119,223,19,192,152,128,171,27,90,214,146,0,19,238,129,216,181,67,109,190,181,54,31,39,
+124,4,143,104,79,2,76,84,157,0,82,219,11,212,120,27,214,174,169,205,255,69,203,107,187,79,248,8,30,209,174,110,104,89,117,2,136,149,44,97,39,54,236,176,169,54,223,122,155,143,227,174,187,222,25,232,
+225,234,134,150,213,138,223,229,57,200,219,172,95,109,190,53,54,239,19,62,130,159,247,105,135,166,137,19,64,250,250,89,250,251,54,236,211,167,54,159,14,155,247,9,111,195,26,2,87,63,52,173,38,1,114,
+238,1,104,92,168,205,223,155,170,218,30,7,175,233,61,9,144,124,45,225,240,240,129,89,70,149,108,104,0,170,205,167,87,248,59,239,236,185,14,13,65,87,63,52,77,156,0,185,220,254,60,219,172,219,48,254,
+175,54,159,30,155,247,9,31,193,155,90,87,63,52,173,38,1,230,221,3,176,5,187,218,124,122,108,222,39,124,4,237,52,79,2,36,223,93,100,207,158,125,139,236,92,101,195,219,38,181,249,244,216,188,143,245,
+235,223,17,64,188,92,253,208,180,154,4,88,118,15,192,219,63,181,249,244,216,188,79,248,8,174,219,147,0,203,137,19,96,104,104,239,85,150,31,217,96,43,106,243,233,177,121,159,240,17,28,223,213,15,77,19,
+39,192,224,224,240,53,62,191,98,83,73,248,102,219,252,95,253,213,253,230,209,71,183,154,135,31,126,127,71,218,124,37,92,253,208,180,154,4,40,185,7,104,102,109,199,109,120,183,189,111,223,136,57,117,
+234,172,121,234,169,143,153,47,125,41,111,94,120,225,59,102,97,225,167,230,247,191,255,189,121,243,205,55,175,243,173,111,61,31,28,171,147,108,222,229,142,59,238,126,11,158,4,40,37,78,128,221,187,115,
+37,70,254,108,234,37,252,255,110,136,248,168,244,75,247,155,19,39,78,155,39,159,124,202,124,241,139,95,50,207,63,255,109,243,242,203,47,155,165,165,165,183,136,155,148,167,159,254,82,71,217,124,156,
+240,17,174,126,104,90,77,2,92,243,37,64,37,209,249,153,205,155,223,47,13,142,189,102,106,234,164,153,155,123,210,252,253,223,127,209,124,243,155,223,50,47,189,244,99,243,250,235,255,175,38,113,147,
+240,218,107,191,238,40,155,143,19,30,248,119,79,2,36,127,4,236,218,181,231,42,31,55,176,161,230,250,68,191,116,233,175,205,143,126,244,162,249,205,111,126,211,48,113,147,240,242,203,175,116,156,205,
+187,220,126,251,93,1,28,203,213,15,77,19,39,192,192,192,208,50,47,20,108,120,46,187,226,231,243,95,105,169,232,54,231,206,93,236,56,155,119,133,143,224,186,93,253,208,180,154,4,88,116,15,192,56,128,
+253,124,231,179,46,173,20,252,79,127,250,147,249,213,175,126,101,190,255,253,121,115,242,228,153,142,179,121,159,240,17,60,10,61,9,144,124,32,104,231,206,193,121,166,127,217,48,18,104,55,230,104,200,
+53,82,224,95,255,250,55,230,95,255,245,71,230,217,103,159,51,159,249,204,231,204,236,236,135,204,145,35,199,130,107,121,239,123,255,191,142,183,249,114,80,73,93,253,208,180,154,4,200,187,7,224,93,128,
+219,162,127,229,149,133,154,196,125,253,245,215,131,70,33,141,195,207,127,254,11,230,67,31,250,136,57,118,108,90,186,42,185,224,77,150,219,167,239,228,214,124,82,225,111,187,237,206,235,48,113,199,
+147,0,201,95,6,245,247,239,158,101,249,151,13,194,184,253,247,129,129,65,243,111,255,246,179,183,136,75,55,142,238,220,243,207,255,147,116,239,158,14,186,121,211,211,167,76,46,183,47,24,180,33,59,117,
+208,166,49,194,71,240,37,22,87,63,52,77,156,0,59,118,236,202,177,239,143,13,43,80,227,70,232,182,109,235,15,6,110,104,40,234,216,124,115,108,222,39,124,4,149,213,213,15,77,171,73,128,172,123,0,182,
+130,209,177,249,244,216,188,143,117,235,214,7,80,25,61,9,144,124,74,216,246,237,3,93,124,214,204,197,29,186,213,87,176,173,179,121,159,240,192,207,251,180,67,211,170,102,6,203,47,44,185,7,161,43,168,
+175,96,211,97,243,174,240,17,196,215,35,254,82,213,235,2,182,109,219,89,96,34,168,13,61,1,181,249,244,212,118,31,84,82,87,55,180,172,58,1,182,110,237,159,96,211,1,27,198,249,213,230,211,41,252,173,
+183,222,17,192,199,40,93,221,208,178,150,4,232,113,15,212,215,183,67,109,62,5,54,239,19,62,130,189,155,60,9,80,219,151,69,68,240,34,162,219,48,200,160,54,223,218,218,238,19,30,136,191,171,23,26,214,
+188,63,128,252,114,222,61,32,235,3,213,230,91,107,243,113,48,92,239,73,128,218,55,136,16,59,233,199,82,108,232,99,170,205,183,214,230,93,110,185,229,246,0,62,207,231,234,133,134,43,73,128,53,66,201,
+61,40,35,126,106,243,173,177,121,159,240,64,220,61,226,163,93,237,155,68,81,30,125,116,219,101,70,1,109,248,168,161,218,124,107,106,187,43,124,4,171,129,92,157,208,110,197,251,4,110,217,178,181,143,
+197,134,46,244,4,212,230,155,111,243,62,56,190,79,35,180,171,203,110,161,114,160,162,123,112,26,28,106,243,205,181,121,31,55,223,124,91,48,93,207,35,126,125,182,138,165,72,195,111,142,198,159,13,131,
+66,106,243,205,181,121,87,248,8,190,27,224,234,131,102,245,76,128,110,207,9,130,49,1,181,249,230,216,188,43,122,68,244,37,49,15,245,253,128,212,35,143,124,160,192,30,1,54,44,25,87,155,95,223,18,225,
+35,24,250,117,117,65,171,186,127,49,68,250,152,89,250,153,46,184,128,218,124,227,109,62,174,246,251,52,65,171,134,124,55,72,14,124,197,61,25,207,31,181,249,230,212,246,136,238,238,117,193,127,153,249,
+227,17,191,49,31,141,162,60,252,240,150,44,83,195,92,248,112,132,218,124,99,133,71,116,27,90,254,62,45,208,168,161,223,14,148,19,228,125,39,102,92,64,109,190,241,194,3,247,22,35,126,99,63,28,73,145,
+238,95,55,93,64,23,22,138,168,205,215,215,230,227,96,12,198,167,1,218,52,229,251,193,242,220,159,225,217,239,194,59,2,181,249,250,214,118,155,155,110,186,53,104,248,249,98,143,38,77,253,130,184,156,
+112,209,119,33,60,10,212,230,235,47,60,112,191,49,226,55,247,243,241,148,135,30,122,95,47,227,0,46,204,27,84,155,95,185,205,219,194,71,176,224,195,23,115,180,200,180,162,200,137,47,249,46,136,94,129,
+218,124,125,68,143,96,111,198,24,241,47,101,90,89,164,47,186,64,127,212,133,110,138,218,252,202,133,7,30,171,190,24,19,251,76,171,203,198,141,155,123,132,18,67,146,46,44,36,81,155,175,93,120,96,128,
+205,23,219,48,230,61,153,52,20,185,144,92,204,69,6,217,171,54,95,157,232,112,227,141,183,4,14,26,23,87,98,158,73,83,233,237,221,52,199,76,33,23,38,145,50,113,68,109,126,93,34,209,35,136,9,177,243,197,
+148,88,103,210,88,228,194,10,190,11,166,103,224,75,2,181,249,183,11,31,137,79,204,98,196,47,100,210,92,36,107,231,201,92,23,59,9,212,230,253,194,3,143,73,98,229,139,33,177,205,164,189,200,197,119,9,
+11,220,132,15,218,4,106,243,126,24,60,139,139,91,24,211,174,76,59,20,185,208,181,194,171,113,55,67,239,160,211,109,222,5,119,44,35,62,177,92,155,105,167,178,97,195,198,181,194,2,47,137,124,48,78,208,
+169,54,111,115,195,13,55,95,223,117,45,6,98,216,94,226,91,73,208,37,204,199,221,28,35,134,216,94,39,217,124,36,58,112,63,204,168,42,35,62,177,235,202,180,123,121,240,193,222,2,227,216,113,208,46,232,
+4,155,143,132,7,6,120,202,197,132,152,101,86,83,145,27,154,43,119,195,188,74,102,224,99,181,218,124,4,215,204,227,175,130,248,115,153,213,88,30,120,224,189,57,161,196,50,166,56,120,223,221,14,194,87,
+35,58,68,13,189,114,247,30,198,38,151,89,205,229,254,251,223,211,35,44,48,171,37,14,218,6,172,55,104,119,155,143,160,157,195,214,45,229,238,57,140,73,79,166,83,138,220,236,165,10,1,185,62,229,188,221,
+108,62,34,250,130,87,165,251,36,22,153,78,44,247,221,183,161,87,88,20,76,57,72,4,236,147,71,67,154,109,30,248,61,230,70,34,124,165,251,10,239,189,55,211,233,69,130,48,147,32,88,1,180,17,24,46,77,155,
+240,116,97,233,205,36,189,15,238,57,163,229,207,69,158,251,221,66,158,231,127,18,168,97,236,82,18,37,67,43,108,30,209,113,38,174,37,233,117,135,247,216,173,138,199,20,105,44,101,133,43,52,154,146,194,
+35,130,209,52,218,11,12,45,219,9,81,47,209,249,51,143,32,26,116,184,16,231,172,230,26,195,123,202,170,194,213,37,66,161,202,32,95,135,190,54,150,76,111,130,198,24,137,17,181,33,162,196,136,68,230,207,
+209,114,43,122,27,212,108,156,133,132,226,24,124,11,169,214,235,8,239,65,133,175,181,72,77,235,22,230,132,34,181,174,77,40,134,215,172,86,95,231,100,232,19,46,11,165,20,138,94,10,175,173,79,149,106,
+112,145,70,215,26,161,95,200,11,69,26,97,45,162,24,94,3,215,178,70,149,105,81,201,102,223,221,35,76,8,5,97,137,57,244,13,98,41,60,7,231,234,209,200,167,55,33,186,132,172,144,19,102,133,188,48,47,44,
+10,203,194,85,225,154,80,10,185,22,254,221,114,248,51,243,225,239,204,134,199,224,88,93,26,89,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,73,77,153,153,153,237,18,
+178,66,78,152,21,242,194,188,176,40,44,11,87,133,107,66,41,228,90,248,119,203,225,207,204,135,191,51,27,30,131,99,233,80,112,138,5,239,17,38,132,130,176,36,152,6,177,20,158,131,115,233,203,160,86,149,
+139,23,159,88,35,244,11,121,161,40,152,22,81,12,175,129,107,209,215,193,141,46,23,46,60,222,39,92,22,74,130,73,25,165,240,218,116,66,72,157,69,239,22,230,132,98,10,69,143,163,24,94,179,78,9,171,181,
+156,63,255,88,86,40,8,166,22,166,166,78,153,67,135,38,76,46,183,223,236,220,57,24,124,71,143,29,181,217,95,143,237,86,88,132,25,173,201,227,207,108,196,192,238,91,252,12,159,92,235,239,223,109,246,
+236,217,103,70,71,199,205,241,227,39,77,173,215,17,222,131,78,10,173,82,248,43,213,4,249,236,217,139,230,240,225,73,51,56,56,28,124,49,11,49,163,149,182,21,22,99,86,92,182,21,45,228,224,88,124,142,
+101,215,174,61,102,108,236,72,112,206,42,19,225,138,38,66,153,114,238,220,76,183,144,23,76,18,78,156,56,99,246,237,59,24,212,108,119,121,245,74,69,183,133,47,7,31,103,26,30,62,96,166,167,79,155,164,
+215,29,222,163,62,26,236,34,181,105,134,26,149,132,145,145,49,175,232,245,172,237,113,148,91,241,67,50,236,223,63,106,146,222,7,247,172,194,159,189,216,43,44,86,10,22,207,243,221,187,115,193,62,121,
+105,19,30,236,133,32,92,15,109,14,218,13,9,146,128,123,239,204,197,161,103,206,92,184,36,152,114,28,61,58,29,52,198,26,33,122,189,133,247,177,117,107,191,153,156,156,50,149,238,147,88,116,146,240,61,
+194,66,185,128,80,227,169,69,105,172,237,73,132,119,23,141,108,219,182,51,112,132,10,73,64,76,86,247,232,226,233,211,231,115,66,73,48,113,12,13,237,13,118,200,74,179,205,39,21,222,134,127,167,7,81,
+238,222,195,216,172,206,45,98,78,157,58,55,39,152,56,232,179,211,7,111,55,155,175,180,100,204,93,77,68,59,230,224,193,195,166,92,44,136,213,106,19,191,80,238,134,7,6,134,218,222,230,43,9,239,178,125,
+251,64,165,36,104,255,109,226,78,158,60,219,37,204,11,198,199,248,248,209,224,107,151,171,197,230,147,8,111,47,53,99,228,145,65,165,184,248,132,177,235,106,87,241,215,10,11,113,55,183,119,239,200,170,
+181,249,74,194,187,48,228,92,38,9,136,97,123,109,21,123,226,196,153,181,194,171,140,214,249,192,242,59,193,230,43,45,54,101,19,139,8,122,10,113,241,10,99,185,182,93,196,239,18,22,226,110,134,190,113,
+39,217,124,37,225,109,120,215,80,38,9,136,105,250,31,7,211,211,167,231,25,27,119,161,31,204,139,154,78,181,249,114,194,71,176,21,13,159,130,35,86,190,24,18,219,84,139,63,53,117,170,192,32,142,203,177,
+99,39,130,198,94,167,219,124,57,225,109,232,42,50,10,234,139,37,49,78,171,248,115,73,197,239,100,155,143,19,221,151,4,196,46,38,9,210,53,78,32,150,149,195,182,124,240,150,76,109,62,185,240,247,222,
+251,174,235,48,121,37,46,174,196,60,45,226,247,8,37,223,69,242,218,86,109,190,122,225,109,24,29,141,73,0,98,222,250,119,7,98,83,11,88,149,203,142,29,187,212,230,107,20,221,134,13,48,169,72,190,24,19,
+251,150,138,47,13,149,75,52,86,92,120,161,163,54,95,187,240,136,238,194,216,137,47,214,104,208,42,241,123,125,23,196,140,29,181,249,250,9,111,195,140,163,152,36,104,254,164,146,201,201,169,69,38,59,
+184,108,218,244,136,218,124,13,54,95,14,246,38,6,26,211,190,152,163,69,179,197,159,241,93,8,195,153,106,243,245,169,237,145,232,46,244,170,98,146,160,57,115,12,143,28,57,222,45,24,23,102,199,170,205,
+55,78,248,8,54,175,166,141,229,211,0,109,26,158,0,19,19,199,242,130,113,161,207,170,54,223,88,225,35,136,171,79,3,180,105,180,248,89,223,137,233,242,169,205,215,95,116,87,120,27,186,134,49,73,208,184,
+197,39,227,227,71,175,48,137,195,134,233,77,209,115,95,109,190,254,181,221,7,95,74,225,231,232,113,185,122,160,81,163,196,207,122,78,22,172,163,83,155,111,158,240,54,244,184,124,154,160,85,221,19,224,
+240,225,201,2,235,239,108,232,151,170,205,55,206,230,227,132,183,97,102,149,171,11,90,213,85,252,177,177,35,221,204,93,115,225,253,190,218,124,115,106,187,15,62,88,69,227,219,167,13,154,213,51,1,230,
+220,19,184,181,95,109,190,57,194,35,186,11,139,100,61,9,80,191,87,198,135,14,77,20,153,183,111,67,43,84,109,190,57,54,31,39,124,4,111,12,93,125,208,172,94,226,247,121,14,30,12,75,170,205,55,199,230,
+203,193,87,209,184,22,159,70,104,183,226,4,24,29,29,191,204,46,25,54,44,216,84,155,111,77,109,183,133,183,97,178,173,171,19,218,173,72,124,233,227,175,17,74,244,245,109,152,184,168,54,223,124,225,93,
+209,109,24,139,113,117,10,181,91,179,146,4,232,119,15,74,183,67,109,190,249,54,95,14,62,112,9,188,143,241,36,65,127,205,9,48,50,50,150,103,180,201,134,55,126,106,243,173,177,249,56,225,35,120,83,232,
+234,133,134,43,73,128,162,123,64,250,157,106,243,173,177,121,159,232,54,12,199,123,18,160,182,222,192,129,3,135,122,4,99,67,223,95,109,190,181,54,31,199,221,119,223,19,192,152,128,171,27,90,214,146,0,
+19,238,129,216,181,67,109,190,181,54,31,39,124,4,143,104,79,2,76,84,157,0,82,219,11,212,120,27,214,174,169,205,255,69,203,107,187,79,248,8,30,209,174,110,104,89,117,2,136,149,44,97,39,54,236,176,169,
+54,223,122,155,143,227,174,187,222,25,232,225,234,134,150,213,138,223,229,57,200,219,172,95,109,190,53,54,239,19,62,130,159,247,105,135,166,137,19,64,250,250,89,250,251,54,236,211,167,54,159,14,155,
+247,9,111,195,26,2,87,63,52,173,38,1,114,238,1,104,92,168,205,223,155,170,218,30,7,175,233,61,9,144,124,45,225,240,240,129,89,70,149,108,104,0,170,205,167,87,248,59,239,236,185,14,13,65,87,63,52,77,
+156,0,185,220,254,60,219,172,219,48,254,175,54,159,30,155,247,9,31,193,155,90,87,63,52,173,38,1,230,221,3,176,5,187,218,124,122,108,222,39,124,4,237,52,79,2,36,223,93,100,207,158,125,139,236,92,101,
+195,219,38,181,249,244,216,188,143,245,235,223,17,64,188,92,253,208,180,154,4,88,118,15,192,219,63,181,249,244,216,188,79,248,8,174,219,147,0,203,137,19,96,104,104,239,85,150,31,217,96,43,205,18,30,
+72,56,30,59,155,55,63,18,126,194,101,151,220,196,94,51,50,50,106,198,199,143,152,227,199,79,152,51,103,206,155,137,137,163,29,105,243,62,225,35,56,190,171,31,154,38,78,128,193,193,225,107,124,126,197,
+38,78,120,246,178,25,25,57,36,162,76,154,169,169,255,21,229,177,199,158,48,31,254,240,147,230,99,31,251,184,249,212,167,62,109,62,255,249,47,152,124,254,25,243,213,175,126,221,92,185,242,77,243,157,
+239,124,215,204,207,255,139,121,241,197,151,204,79,127,250,111,230,151,191,252,165,249,237,111,95,55,127,248,195,31,204,27,111,188,97,222,124,243,205,170,248,241,143,127,18,108,48,221,73,54,95,9,87,
+63,52,173,38,1,74,238,1,124,226,127,232,67,115,85,139,213,40,158,126,250,203,29,101,243,46,119,220,113,247,91,240,36,64,41,113,2,236,222,157,43,49,242,103,227,138,191,109,91,127,106,196,135,151,95,
+126,165,163,108,62,78,248,8,87,63,52,173,38,1,174,249,18,192,126,142,95,184,240,88,170,18,224,217,103,159,235,40,155,143,19,30,248,119,79,2,36,127,4,236,218,181,231,42,31,55,176,161,13,96,39,192,228,
+228,177,212,136,191,188,188,28,52,18,59,205,230,93,110,191,253,174,0,142,229,234,135,166,137,19,96,96,96,104,153,23,10,54,244,2,220,214,252,15,126,240,195,134,8,90,44,22,205,127,253,215,127,153,165,
+165,37,243,218,107,175,153,159,255,252,85,243,147,159,188,28,156,239,159,255,249,123,230,249,231,255,201,92,190,252,13,243,204,51,255,104,62,241,137,79,154,247,189,111,75,71,218,188,43,124,4,215,237,
+234,135,166,213,36,192,162,123,0,186,101,110,55,238,47,255,242,190,160,149,255,189,239,125,223,188,240,194,119,204,115,207,93,49,133,194,215,204,151,190,148,55,159,253,236,231,69,156,79,153,167,158,
+250,152,249,224,7,63,28,60,50,78,157,58,99,142,30,157,50,135,14,49,187,248,128,100,229,80,48,159,157,157,68,55,110,220,116,125,176,73,91,243,181,9,31,65,140,60,9,144,124,32,104,231,206,193,121,166,
+127,217,32,142,14,218,220,147,186,218,238,131,74,234,234,135,166,213,36,64,222,61,0,131,50,58,54,159,94,225,111,187,237,206,235,48,113,199,147,0,201,95,6,245,247,239,158,101,249,151,13,175,24,117,108,
+62,61,54,239,19,62,130,47,177,184,250,161,105,226,4,216,177,99,87,142,125,127,108,88,129,170,54,159,30,155,247,9,31,65,101,117,245,67,211,106,18,32,235,30,128,241,120,181,249,244,216,188,143,117,235,
+214,7,176,66,200,147,0,201,167,132,109,223,62,208,197,103,205,92,92,235,87,155,111,157,205,251,132,7,126,222,167,29,154,86,53,51,88,126,97,201,61,8,93,65,181,249,116,216,188,43,124,4,241,245,136,191,
+84,245,186,128,109,219,118,22,152,8,106,67,79,64,109,62,61,181,221,7,149,212,213,13,45,171,78,128,173,91,251,39,24,164,177,217,188,249,253,106,243,41,21,254,214,91,239,8,224,99,148,174,110,104,89,75,
+2,244,184,7,234,235,219,161,54,159,2,155,247,9,31,193,222,77,158,4,168,237,203,34,34,120,17,209,109,24,100,80,155,111,109,109,247,9,15,196,223,213,11,13,107,222,31,64,126,57,239,30,144,245,129,106,
+243,173,181,249,56,24,174,247,36,64,237,27,68,136,157,244,99,41,54,244,49,213,230,91,107,243,46,183,220,114,123,0,47,213,92,189,208,112,37,9,176,70,40,185,7,229,213,176,218,124,107,108,222,39,60,16,
+119,143,248,104,87,251,38,81,148,71,31,221,118,153,81,64,27,38,130,170,205,183,166,182,187,194,71,176,26,200,213,9,237,86,188,79,224,150,45,91,251,88,108,232,66,79,64,109,190,249,54,239,131,227,251,
+52,66,187,186,236,22,42,7,42,186,7,167,193,161,54,223,92,155,247,113,243,205,183,5,147,104,60,226,215,103,171,88,138,52,252,230,104,252,217,48,40,164,54,223,92,155,119,133,143,224,187,1,174,62,104,86,
+207,4,232,246,156,32,24,19,80,155,111,142,205,187,162,71,68,95,18,243,80,223,15,72,61,242,200,7,10,236,17,96,195,146,113,181,249,245,45,17,62,130,161,95,87,23,180,170,251,23,67,164,143,153,165,159,
+233,130,11,168,205,55,222,230,227,106,191,79,19,180,106,200,119,131,228,192,87,220,147,241,252,81,155,111,78,109,143,232,238,94,23,252,151,153,63,30,241,27,243,209,40,202,195,15,111,201,50,53,204,133,
+15,71,168,205,55,86,120,68,183,161,229,239,211,2,141,26,250,237,64,57,65,222,119,98,198,5,212,230,27,47,60,112,111,49,226,55,246,195,145,20,233,254,117,211,5,116,97,121,182,218,124,125,109,62,14,198,
+96,124,26,160,77,83,190,31,44,207,253,25,158,253,46,188,35,80,155,175,111,109,183,185,233,166,91,131,134,159,47,246,104,210,212,47,136,203,9,23,125,23,194,163,64,109,190,254,194,3,247,27,35,126,115,
+63,31,79,121,232,161,247,245,50,14,224,194,188,65,181,249,149,219,188,45,124,4,11,62,124,49,71,139,76,43,138,156,248,146,239,130,232,21,168,205,215,71,244,8,246,102,140,17,255,82,166,149,69,250,162,
+11,244,71,93,232,166,168,205,175,92,120,224,177,234,139,49,177,207,180,186,108,220,184,185,71,40,49,36,233,194,66,18,181,249,218,133,7,6,216,124,177,13,99,222,147,73,67,145,11,201,197,92,100,144,189,
+106,243,213,137,14,55,222,120,75,224,160,113,113,37,230,153,52,149,222,222,77,115,204,20,114,97,18,41,19,71,212,230,215,37,18,61,130,152,16,59,95,76,137,117,38,141,69,46,172,224,187,96,122,6,190,36,
+80,155,127,187,240,145,248,196,44,70,252,66,38,205,69,178,118,158,204,117,177,147,64,109,222,47,60,240,152,36,86,190,24,18,219,76,218,139,92,124,151,176,192,77,248,160,77,160,54,239,135,193,179,184,
+184,133,49,237,202,180,67,145,11,93,43,188,26,119,51,244,14,58,221,230,93,112,199,50,226,19,203,181,153,118,42,27,54,108,92,43,44,240,146,200,7,227,4,157,106,243,54,55,220,112,115,80,33,226,226,20,
+198,176,189,196,183,146,160,75,152,143,187,57,70,12,177,189,78,178,249,72,116,224,126,152,81,85,70,124,98,215,149,105,247,242,224,131,189,5,198,177,227,160,93,208,9,54,31,9,15,12,240,148,139,9,49,203,
+172,166,34,55,52,87,238,134,121,149,204,192,199,106,181,249,8,174,153,199,95,5,241,231,50,171,177,60,240,192,123,115,66,137,101,76,113,240,190,187,29,132,175,70,116,136,26,122,229,238,61,140,77,46,
+179,154,203,253,247,191,167,71,88,96,86,75,28,180,13,88,111,208,238,54,31,65,59,135,173,91,202,221,115,24,147,158,76,167,20,185,217,75,21,2,114,125,202,121,187,217,124,68,244,5,175,74,247,73,44,50,
+157,88,238,187,111,67,175,176,40,152,114,144,8,216,39,143,134,52,219,60,240,123,204,141,68,248,74,247,21,222,123,111,166,211,139,4,97,38,65,176,2,104,35,48,92,154,54,225,233,194,210,155,73,122,31,220,
+115,70,203,159,139,60,247,187,133,60,207,255,36,80,195,216,165,36,74,134,86,216,60,162,227,76,92,75,210,235,14,239,177,91,21,143,41,210,88,202,10,87,104,52,37,133,71,4,163,105,180,23,24,90,182,19,162,
+94,162,243,103,30,65,52,232,112,33,206,89,205,53,134,247,148,85,133,171,75,132,66,149,65,190,14,125,109,44,153,222,4,141,49,18,35,106,67,68,137,17,137,204,159,163,229,86,244,54,168,217,56,11,9,197,49,
+248,94,82,173,215,17,222,131,10,95,107,145,154,214,45,204,9,69,106,93,155,80,12,175,89,173,190,206,201,208,39,92,22,74,41,20,189,20,94,91,159,42,213,224,34,141,174,53,66,191,144,23,138,52,194,90,68,
+49,188,6,174,101,141,42,211,162,146,205,190,187,71,152,16,10,194,18,115,232,27,196,82,120,14,206,213,163,145,79,111,66,116,9,89,33,39,204,10,121,97,94,88,20,150,133,171,194,53,161,20,114,45,252,187,
+229,240,103,230,195,223,153,13,143,193,177,186,52,178,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,146,154,50,51,51,219,37,100,133,156,48,43,228,133,121,97,81,88,22,
+174,10,215,132,82,200,181,240,239,150,195,159,153,15,127,103,54,60,6,199,210,161,224,20,11,222,35,76,8,5,97,73,48,13,98,41,60,7,231,210,151,65,173,42,23,47,62,177,70,232,23,242,66,81,48,45,162,24,94,
+3,215,162,175,131,27,93,46,92,120,188,79,184,44,148,4,147,50,74,225,181,233,132,144,58,139,222,45,204,9,197,20,138,30,71,49,188,102,157,18,86,107,57,127,254,177,172,80,16,76,45,76,77,157,50,135,14,77,
+152,92,110,191,217,185,115,48,248,142,30,59,106,179,191,30,219,173,176,8,51,90,147,199,159,217,136,129,221,183,248,25,62,185,214,223,191,219,236,217,179,207,140,142,142,155,227,199,79,154,90,175,35,
+188,7,157,20,90,165,240,87,170,9,242,217,179,23,205,225,195,147,102,112,112,56,248,98,22,98,70,43,109,43,44,198,172,184,108,43,90,200,193,177,248,28,203,174,93,123,204,216,216,145,224,156,85,38,194,
+21,77,132,50,229,220,185,153,110,33,47,152,36,156,56,113,198,236,219,119,48,168,217,238,242,234,149,138,110,11,95,14,62,206,52,60,124,192,76,79,159,54,73,175,59,188,71,125,52,216,69,106,211,12,53,42,
+9,35,35,99,94,209,235,89,219,227,40,183,226,135,100,216,191,127,212,36,189,15,238,89,133,63,123,177,87,88,172,20,44,158,231,187,119,231,130,125,242,210,38,60,216,11,65,184,30,218,28,180,27,18,36,1,
+247,222,153,139,67,207,156,185,112,73,48,229,56,122,116,58,104,140,53,66,244,122,11,239,99,235,214,126,51,57,57,101,42,221,39,177,232,36,225,123,132,133,114,1,161,198,83,139,210,88,219,147,8,239,46,
+26,217,182,109,103,224,8,21,146,128,152,172,238,209,197,211,167,207,231,132,146,96,226,24,26,218,27,236,144,149,102,155,79,42,188,13,255,78,15,162,220,189,135,177,89,157,91,196,156,58,117,110,78,48,
+113,208,103,167,15,222,110,54,95,105,201,152,187,154,136,118,204,193,131,135,77,185,88,16,171,213,38,126,161,220,13,15,12,12,181,189,205,87,18,222,101,251,246,129,74,73,208,254,219,196,157,60,121,182,
+75,152,23,140,143,241,241,163,193,215,46,87,139,205,39,17,222,94,106,198,200,35,131,74,113,241,9,99,215,213,174,226,175,21,22,226,110,110,239,222,145,85,107,243,149,132,119,97,200,185,76,18,16,195,
+246,218,42,246,196,137,51,107,133,87,25,173,243,129,229,119,130,205,87,90,108,202,38,22,17,244,20,226,226,21,198,114,109,187,136,223,37,44,196,221,12,125,227,78,178,249,74,194,219,240,174,161,76,18,
+16,211,244,63,14,166,167,79,207,51,54,238,66,63,152,23,53,157,106,243,229,132,143,96,43,26,62,5,71,172,124,49,36,182,169,22,127,106,234,84,129,65,28,151,99,199,78,4,141,189,78,183,249,114,194,219,208,
+85,100,20,212,23,75,98,156,86,241,231,146,138,223,201,54,31,39,186,47,9,136,93,76,18,164,107,156,64,44,43,135,109,249,224,45,153,218,124,114,225,239,189,247,93,215,97,242,74,92,92,137,121,90,196,239,
+17,74,190,139,228,181,173,218,124,245,194,219,48,58,26,147,0,196,188,245,239,14,196,166,22,176,42,151,29,59,118,169,205,215,40,186,13,27,96,82,145,124,49,38,246,45,21,95,26,42,151,104,172,184,240,66,
+71,109,190,118,225,17,221,133,177,19,95,172,209,160,85,226,247,250,46,136,25,59,106,243,245,19,222,134,25,71,49,73,208,252,73,37,147,147,83,139,76,118,112,217,180,233,17,181,249,26,108,190,28,236,77,
+12,52,166,125,49,71,139,102,139,63,227,187,16,134,51,213,230,235,83,219,35,209,93,232,85,197,36,65,115,230,24,30,57,114,188,91,48,46,204,142,85,155,111,156,240,17,108,94,77,27,203,167,1,218,52,60,1,
+38,38,142,229,5,227,66,159,85,109,190,177,194,71,16,87,159,6,104,211,104,241,179,190,19,211,229,83,155,175,191,232,174,240,54,116,13,99,146,160,113,139,79,198,199,143,94,97,18,135,13,211,155,162,231,
+190,218,124,253,107,187,15,190,148,194,207,209,227,114,245,64,163,70,137,159,245,156,44,88,71,167,54,223,60,225,109,232,113,249,52,65,171,186,39,192,225,195,147,5,214,223,217,208,47,85,155,111,156,
+205,199,9,111,195,204,42,87,23,180,170,171,248,99,99,71,186,153,187,230,194,251,125,181,249,230,212,118,31,124,176,138,198,183,79,27,52,171,103,2,204,185,39,112,107,191,218,124,115,132,71,116,23,22,
+201,122,18,160,126,175,140,15,29,154,40,50,111,223,134,86,168,218,124,115,108,62,78,248,8,222,24,186,250,160,89,189,196,239,243,28,60,24,150,84,155,111,142,205,151,131,175,162,113,45,62,141,208,110,
+197,9,48,58,58,126,153,93,50,108,88,176,169,54,223,154,218,110,11,111,195,100,91,87,39,180,91,145,248,210,199,95,35,148,232,235,219,48,113,81,109,190,249,194,187,162,219,48,22,227,234,20,106,183,102,
+37,9,208,239,30,148,110,135,218,124,243,109,190,28,124,224,18,120,31,227,73,130,254,154,19,96,100,100,44,207,104,147,13,111,252,212,230,91,99,243,113,194,71,240,166,208,213,11,13,87,146,0,69,247,128,
+244,59,213,230,91,99,243,62,209,109,24,142,247,36,64,109,189,129,3,7,14,245,8,198,134,190,191,218,124,107,109,62,142,187,239,190,39,128,49,1,87,55,180,172,37,1,38,220,3,177,107,135,218,124,107,109,62,
+78,248,8,30,209,158,4,152,168,58,1,164,182,23,168,241,54,172,93,83,155,255,139,150,215,118,159,240,17,60,162,93,221,208,178,234,4,16,43,89,194,78,108,216,97,83,109,190,245,54,31,199,93,119,189,51,208,
+195,213,13,45,171,21,191,203,115,144,183,89,191,218,124,107,108,222,39,124,4,63,239,211,14,77,19,39,128,244,245,179,244,247,109,216,167,79,109,62,29,54,239,19,222,134,53,4,174,126,104,90,77,2,228,220,
+3,208,184,80,155,191,55,85,181,61,14,94,211,123,18,32,249,90,194,225,225,3,179,140,42,217,208,0,84,155,79,175,240,119,222,217,115,29,26,130,174,126,104,154,56,1,114,185,253,121,182,89,183,97,252,95,
+109,62,61,54,239,19,62,130,55,181,174,126,104,90,77,2,204,187,7,96,11,118,181,249,244,216,188,79,248,8,218,105,158,4,72,190,187,200,158,61,251,22,217,185,202,134,183,77,174,216,76,8,249,187,191,251,
+140,249,254,247,231,205,11,47,124,199,92,185,242,77,243,213,175,126,205,124,249,203,95,49,159,255,252,223,155,79,126,242,239,204,165,75,31,55,31,250,208,71,204,204,204,227,230,244,233,115,230,216,177,
+105,115,248,48,51,138,14,154,193,193,156,217,177,99,64,158,89,125,226,48,15,7,187,134,113,241,106,243,213,139,14,235,215,191,35,128,120,185,250,161,105,53,9,176,236,30,128,183,127,110,2,252,240,135,
+255,106,222,124,243,205,186,83,44,22,205,127,253,215,127,153,165,165,37,243,218,107,191,54,63,255,249,171,230,229,151,95,14,206,247,207,255,252,61,243,252,243,223,54,223,248,198,179,230,31,254,161,32,
+73,246,169,160,125,210,105,54,239,19,62,130,235,246,36,192,114,226,4,24,26,218,123,149,229,71,54,212,76,219,230,39,39,143,55,68,252,90,88,94,94,150,174,207,96,71,217,188,79,248,8,142,239,234,135,166,
+137,19,96,112,112,248,26,159,95,177,113,159,239,23,47,62,150,154,4,128,103,159,125,174,163,108,190,18,174,126,104,90,77,2,148,220,3,184,141,185,237,219,119,166,42,1,94,126,249,149,142,178,121,151,59,
+238,184,251,45,120,18,160,148,56,1,118,239,206,149,24,249,179,241,181,230,63,248,193,185,212,36,192,211,79,127,185,163,108,62,78,248,8,87,63,52,173,38,1,174,249,18,192,215,109,227,5,209,129,3,163,102,
+124,124,210,76,77,157,48,103,206,156,147,22,255,19,230,195,31,254,136,249,216,199,62,30,244,4,62,255,249,47,152,124,254,43,210,67,248,122,208,83,120,225,133,239,154,249,249,127,49,47,190,248,146,249,
+233,79,127,106,126,241,139,95,154,223,254,246,117,243,135,63,252,193,188,241,198,27,85,139,255,227,31,255,36,232,65,116,146,205,199,9,15,252,187,39,1,146,63,2,118,237,218,115,149,143,27,216,208,6,104,
+214,160,13,255,207,139,39,62,28,177,105,211,251,204,163,143,110,13,186,139,116,27,233,62,210,141,60,126,124,58,72,182,137,137,201,142,181,121,151,219,111,191,43,128,99,185,250,161,105,226,4,24,24,24,
+90,230,133,130,13,189,0,29,180,73,151,205,187,194,71,112,221,174,126,104,90,77,2,44,186,7,96,28,64,199,230,211,99,243,62,225,35,136,145,39,1,146,15,4,237,220,57,56,207,244,47,27,70,2,117,108,254,158,
+212,213,118,31,84,82,87,63,52,173,38,1,242,238,1,120,23,160,54,159,94,225,111,187,237,206,235,208,126,242,36,64,242,151,65,253,253,187,103,89,254,101,195,43,70,181,249,244,216,188,79,248,8,122,68,174,
+126,104,154,56,1,118,236,216,149,99,223,31,27,86,160,170,205,167,199,230,125,194,71,80,89,93,253,208,180,154,4,200,186,7,96,43,24,181,249,244,216,188,143,117,235,214,7,176,66,200,147,0,201,167,132,
+109,223,62,208,197,103,205,92,92,235,87,155,111,157,205,251,132,7,126,222,167,29,154,86,53,51,88,126,97,201,61,8,93,65,181,249,116,216,188,43,124,4,241,245,136,191,84,245,186,128,109,219,118,22,152,8,
+106,67,79,64,109,62,61,181,221,7,149,212,213,13,45,171,78,128,173,91,251,39,216,116,192,102,243,230,247,171,205,167,84,248,91,111,189,35,128,143,81,186,186,161,101,45,9,208,227,30,168,175,111,135,218,
+124,10,108,222,39,124,4,123,55,121,18,160,182,47,139,136,224,69,68,183,97,144,65,109,190,181,181,221,39,60,16,127,87,47,52,172,121,127,0,249,229,188,123,64,94,255,170,205,183,214,230,227,96,184,222,
+147,0,181,111,16,33,118,210,143,165,216,208,199,84,155,111,173,205,187,220,114,203,237,1,124,158,207,213,11,13,87,146,0,107,132,146,123,80,94,13,171,205,183,198,230,125,194,3,113,247,136,143,118,181,
+111,18,69,121,244,209,109,151,25,5,180,225,163,134,106,243,173,169,237,174,240,17,172,6,114,117,66,187,21,239,19,184,101,203,214,62,22,27,186,208,19,80,155,111,190,205,251,224,248,62,141,208,174,46,
+187,133,202,129,138,238,193,105,112,168,205,55,215,230,125,220,124,243,109,193,116,61,143,248,245,217,42,150,34,13,191,57,26,127,54,12,10,169,205,55,215,230,93,225,35,248,110,128,171,15,154,213,51,1,
+186,61,39,8,198,4,212,230,155,99,243,174,232,17,209,151,196,60,212,247,3,82,143,60,242,129,2,107,240,108,88,50,174,54,191,190,37,194,71,48,244,235,234,130,86,117,255,98,136,244,49,179,244,51,93,112,1,
+181,249,198,219,124,92,237,247,105,130,86,13,249,110,144,28,248,138,123,50,158,63,106,243,205,169,237,17,221,221,235,130,255,50,243,199,35,126,99,62,26,69,121,248,225,45,89,166,134,185,176,79,128,218,
+124,99,133,71,116,27,90,254,62,45,208,168,161,223,14,148,19,228,125,39,102,92,64,109,190,241,194,3,247,22,35,126,99,63,28,73,145,238,95,55,93,64,23,150,113,169,205,215,215,230,227,96,12,198,167,1,218,
+52,229,251,193,242,220,159,225,217,239,194,59,2,181,249,250,214,118,155,155,110,186,53,104,248,249,98,143,38,77,253,130,184,156,112,209,119,33,60,10,212,230,235,47,60,112,191,49,226,55,247,243,241,
+148,135,30,122,95,47,227,0,46,204,27,84,155,95,185,205,219,194,71,176,224,195,23,115,180,200,180,162,200,137,47,249,46,136,94,129,218,124,125,68,143,96,111,198,24,241,47,101,90,89,164,47,186,64,127,
+212,133,110,138,218,252,202,133,7,30,171,190,24,19,251,76,171,203,198,141,155,123,132,18,67,146,46,44,36,81,155,175,93,120,96,128,205,23,219,48,230,61,153,52,20,185,144,92,204,69,6,217,171,54,95,157,
+232,112,227,141,183,4,14,26,23,87,98,158,73,83,233,237,221,52,199,76,33,23,38,145,50,113,68,109,126,93,34,209,35,136,9,177,243,197,148,88,103,210,88,228,194,10,190,11,166,103,224,75,2,181,249,183,11,
+31,137,79,204,98,196,47,100,210,92,36,107,231,201,92,23,59,9,212,230,253,194,3,143,73,98,229,139,33,177,205,164,189,200,197,119,9,11,220,132,15,218,4,106,243,126,24,60,139,139,91,24,211,174,76,59,20,
+185,208,181,194,171,113,55,67,239,160,211,109,222,5,119,44,35,62,177,92,155,105,167,178,97,195,198,181,194,2,47,137,124,48,78,208,169,54,111,115,195,13,55,7,21,34,46,78,97,12,219,75,124,43,9,186,132,
+249,184,155,99,196,16,219,235,36,155,143,68,7,238,39,218,16,51,6,98,215,149,105,247,242,224,131,189,5,198,177,227,160,93,208,9,54,31,9,15,12,240,148,139,9,49,203,172,166,34,55,52,87,238,134,121,149,
+204,192,199,106,181,249,8,174,153,199,95,5,241,231,50,171,177,60,240,192,123,115,66,137,101,76,113,240,190,187,29,132,175,70,116,136,26,122,229,238,61,140,77,46,179,154,203,253,247,191,167,71,88,96,
+86,75,28,180,13,88,111,208,238,54,31,65,59,135,173,91,202,221,115,24,147,158,76,167,20,185,217,75,21,2,114,125,202,121,187,217,124,68,244,5,175,74,247,73,44,50,157,88,238,187,111,67,175,176,40,152,
+114,144,8,216,39,143,134,52,219,60,240,123,204,141,68,248,74,247,21,222,123,111,166,211,139,4,97,38,65,176,2,104,35,48,92,154,54,225,233,194,210,155,73,122,31,220,115,70,203,159,139,60,247,187,133,60,
+207,255,36,80,195,216,165,36,74,134,86,216,60,162,227,76,92,75,210,235,14,239,177,91,21,143,41,210,88,202,10,87,104,52,37,133,71,4,163,105,180,23,24,90,182,19,162,94,162,243,103,30,65,52,232,162,47,
+154,84,115,141,225,61,101,85,225,234,18,161,80,101,144,175,67,95,27,75,166,55,65,99,140,196,136,218,16,81,98,68,34,243,231,104,185,21,189,13,106,54,206,66,66,113,12,190,151,84,235,117,132,247,160,194,
+215,90,164,166,117,11,115,66,145,90,215,38,20,195,107,86,171,175,115,50,244,9,151,133,82,10,69,47,133,215,214,167,74,53,184,72,163,107,141,208,47,228,133,34,141,176,22,81,12,175,129,107,89,163,202,
+180,168,100,179,239,238,17,38,132,130,176,196,28,250,6,177,20,158,131,115,245,104,228,211,155,16,93,66,86,200,9,179,66,94,152,23,22,133,101,225,170,112,77,40,133,92,11,255,110,57,252,153,249,240,119,
+102,195,99,112,172,46,141,172,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,164,166,204,204,204,118,9,89,33,39,204,10,121,97,94,88,20,150,133,171,194,53,161,20,114,45,
+252,187,229,240,103,230,195,223,153,13,143,193,177,116,40,56,197,130,247,8,19,66,65,88,18,76,131,88,10,207,193,185,244,101,80,171,202,197,139,79,172,17,250,133,188,80,20,76,139,40,134,215,192,181,232,
+235,224,70,151,11,23,30,239,19,46,11,37,193,164,140,82,120,109,58,33,164,206,162,119,11,115,66,49,133,162,199,81,12,175,89,167,132,213,90,206,159,127,44,43,20,4,83,11,83,83,167,204,161,67,19,38,151,
+219,111,118,238,28,12,190,163,199,142,218,236,175,199,118,43,44,194,140,214,228,241,103,54,98,96,247,45,126,134,79,174,245,247,239,54,123,246,236,51,163,163,227,230,248,241,147,166,214,235,8,239,65,
+39,133,86,41,252,149,106,130,124,246,236,69,115,248,240,164,25,28,28,14,190,152,133,152,209,74,219,10,139,49,43,46,219,138,22,114,112,44,62,199,178,107,215,30,51,54,118,36,56,103,149,137,112,69,19,
+161,76,57,119,110,166,91,200,11,38,9,39,78,156,49,251,246,29,12,106,182,187,188,122,165,162,219,194,151,131,143,51,13,15,31,48,211,211,167,77,210,235,14,239,81,31,13,118,145,218,52,67,141,74,194,200,
+200,152,87,244,122,214,246,56,202,173,248,33,25,246,239,31,53,73,239,131,123,86,225,207,94,236,21,22,43,5,139,231,249,238,221,185,96,159,188,180,9,15,246,66,16,174,135,54,7,237,134,4,73,192,189,119,
+230,226,208,51,103,46,92,18,76,57,142,30,157,14,26,99,141,16,189,222,194,251,216,186,181,223,76,78,78,153,74,247,73,44,58,73,248,30,97,161,92,64,168,241,212,162,52,214,246,36,194,187,139,70,182,109,
+219,25,56,66,133,36,32,38,171,123,116,241,244,233,243,57,161,36,152,56,134,134,246,6,59,100,165,217,230,147,10,111,195,191,211,131,40,119,239,97,108,86,231,22,49,167,78,157,155,19,76,28,244,217,233,
+131,183,155,205,87,90,50,230,174,38,162,29,115,240,224,97,83,46,22,196,106,181,137,95,40,119,195,3,3,67,109,111,243,149,132,119,217,190,125,160,82,18,180,255,54,113,39,79,158,237,18,230,5,227,99,124,
+252,104,240,181,203,213,98,243,73,132,183,151,154,49,242,200,160,82,92,124,194,216,117,181,171,248,107,133,133,184,155,219,187,119,100,213,218,124,37,225,93,24,114,46,147,4,196,176,189,182,138,61,113,
+226,204,90,225,85,70,235,124,96,249,157,96,243,149,22,155,178,137,69,4,61,133,184,120,133,177,92,219,46,226,119,9,11,113,55,67,223,184,147,108,190,146,240,54,188,107,40,147,4,196,52,253,143,131,233,
+233,211,243,140,141,187,208,15,230,69,77,167,218,124,57,225,35,216,138,134,79,193,17,43,95,12,137,109,170,197,159,154,58,85,96,16,199,229,216,177,19,65,99,175,211,109,190,156,240,54,116,21,25,5,245,
+197,146,24,167,85,252,185,164,226,119,178,205,199,137,238,75,2,98,23,147,4,233,26,39,16,203,202,97,91,62,120,75,166,54,159,92,248,123,239,125,215,117,152,188,18,23,87,98,158,22,241,123,132,146,239,34,
+121,109,171,54,95,189,240,54,140,142,198,36,0,49,111,253,187,3,177,169,5,172,202,101,199,142,93,106,243,53,138,110,195,6,152,84,36,95,140,137,125,75,197,151,134,202,37,26,43,46,188,208,81,155,175,93,
+120,68,119,97,236,196,23,107,52,104,149,248,189,190,11,98,198,142,218,124,253,132,183,97,198,81,76,18,52,127,82,201,228,228,212,34,147,29,92,54,109,122,68,109,190,6,155,47,7,123,19,3,141,105,95,204,
+209,162,217,226,207,248,46,132,225,76,181,249,250,212,246,72,116,23,122,85,49,73,208,156,57,134,71,142,28,239,22,140,11,179,99,213,230,27,39,124,4,155,87,211,198,242,105,128,54,13,79,128,137,137,99,
+121,193,184,208,103,85,155,111,172,240,17,196,213,167,1,218,52,90,252,172,239,196,116,249,212,230,235,47,186,43,188,13,93,195,152,36,104,220,226,147,241,241,163,87,152,196,97,195,244,166,232,185,175,
+54,95,255,218,238,131,47,165,240,115,244,184,92,61,208,168,81,226,103,61,39,11,214,209,169,205,55,79,120,27,122,92,62,77,208,170,238,9,112,248,240,100,129,245,119,54,244,75,213,230,27,103,243,113,194,
+219,48,179,202,213,5,173,234,42,254,216,216,145,110,230,174,185,240,126,95,109,190,57,181,221,7,31,172,162,241,237,211,6,205,234,153,0,115,238,9,220,218,175,54,223,28,225,17,221,133,69,178,158,4,168,
+223,43,227,67,135,38,138,204,219,183,161,21,170,54,223,28,155,143,19,62,130,55,134,174,62,104,86,47,241,251,60,7,15,134,37,213,230,155,99,243,229,224,171,104,92,139,79,35,180,91,113,2,140,142,142,95,
+102,151,12,27,22,108,170,205,183,166,182,219,194,219,48,217,214,213,9,237,86,36,190,244,241,215,8,37,250,250,54,76,92,84,155,111,190,240,174,232,54,140,197,184,58,133,218,173,89,73,2,244,187,7,165,
+219,161,54,223,124,155,47,7,31,184,4,222,199,120,146,160,191,230,4,24,25,25,203,51,218,100,195,27,63,181,249,214,216,124,156,240,17,188,41,116,245,66,195,149,36,64,209,61,32,253,78,181,249,214,216,
+188,79,116,27,134,227,61,9,80,91,111,224,192,129,67,61,130,177,161,239,175,54,223,90,155,143,227,238,187,239,9,96,76,192,213,13,45,107,73,128,9,247,64,236,218,161,54,223,90,155,143,19,62,130,71,180,
+39,1,38,170,78,0,169,237,5,106,188,13,107,215,212,230,255,162,229,181,221,39,124,4,143,104,87,55,180,172,58,1,196,74,150,176,19,27,118,216,84,155,111,189,205,199,113,215,93,239,12,244,112,117,67,203,
+106,197,239,242,28,228,109,214,175,54,223,26,155,247,9,31,193,207,251,180,67,211,196,9,32,125,253,44,253,125,27,246,233,83,155,79,135,205,251,132,183,97,13,129,171,31,154,86,147,0,57,247,0,52,46,226,
+4,223,185,115,183,233,235,219,30,116,67,212,230,155,87,219,227,224,53,189,39,1,146,175,37,28,30,62,48,203,168,146,13,13,64,87,248,161,161,97,243,179,159,253,220,188,249,230,155,215,89,90,90,50,47,191,
+252,138,249,246,183,95,48,95,250,82,222,60,245,212,199,204,169,83,236,235,59,18,12,84,224,32,106,243,245,23,254,206,59,123,174,67,67,208,213,15,77,19,39,64,46,183,63,207,54,235,54,140,255,187,54,255,
+202,43,11,111,17,63,41,175,191,254,255,204,75,47,253,216,124,243,155,207,155,47,124,225,139,230,35,31,249,168,153,158,62,41,231,217,103,30,126,248,253,65,98,168,205,87,47,124,4,111,106,93,253,208,180,
+154,4,152,119,15,192,22,236,182,157,99,51,181,136,159,148,223,252,230,55,230,71,63,122,209,60,247,220,21,243,185,207,125,222,124,232,67,115,230,216,177,41,105,139,236,145,12,223,220,241,54,239,19,62,
+2,151,245,36,64,242,221,69,246,236,217,183,200,206,85,54,188,109,178,19,128,13,12,26,153,0,149,248,211,159,254,100,126,245,171,215,204,252,252,191,152,211,167,207,118,156,205,251,88,191,254,29,1,56,
+164,171,31,154,86,147,0,203,238,1,120,251,231,54,234,242,249,103,90,154,4,54,231,207,207,116,148,205,251,132,143,224,186,61,9,176,156,56,1,134,134,246,94,101,249,145,13,182,226,107,205,127,236,99,31,
+15,172,26,203,110,101,2,188,242,202,43,29,101,243,62,225,35,56,190,171,31,154,38,78,128,193,193,225,107,124,126,197,166,82,55,142,214,58,255,165,17,71,99,142,70,29,141,59,26,121,223,250,214,243,65,
+163,143,198,95,163,18,224,181,215,126,221,81,54,95,9,87,63,52,173,38,1,74,238,1,234,213,119,255,223,253,240,30,149,126,233,1,115,242,228,105,243,228,147,79,153,47,126,241,75,230,249,231,191,45,221,
+199,151,131,110,100,45,9,240,244,211,95,234,40,155,119,185,227,142,187,223,130,39,1,74,137,19,96,247,238,92,137,145,63,155,102,14,218,240,184,97,220,129,177,3,198,16,24,75,96,76,225,133,23,190,99,22,
+22,126,106,126,255,251,223,191,69,124,28,134,99,118,146,205,199,9,31,225,234,135,166,213,36,192,53,95,2,164,105,208,230,47,255,242,62,233,138,246,153,205,155,31,233,72,155,143,19,30,248,119,79,2,36,
+127,4,236,218,181,231,42,31,55,176,193,186,117,108,62,93,54,239,114,251,237,119,5,112,44,87,63,52,77,156,0,3,3,67,203,188,80,176,193,150,117,108,62,93,54,239,10,31,193,117,187,250,161,105,53,9,176,
+232,30,128,113,0,29,155,79,143,205,251,132,143,32,70,158,4,72,62,16,180,115,231,224,60,211,191,108,24,9,84,155,191,39,117,181,221,7,149,212,213,15,77,171,73,128,188,123,0,222,5,168,205,167,87,248,219,
+110,187,243,58,76,220,241,36,64,242,151,65,253,253,187,103,89,254,101,195,43,70,181,249,244,216,188,79,248,8,190,196,226,234,135,166,137,19,96,199,142,93,57,246,253,177,97,5,170,218,124,122,108,222,
+39,124,4,149,213,213,15,77,171,73,128,172,123,0,182,130,81,155,79,143,205,251,88,183,110,125,0,19,111,60,9,144,124,74,216,246,237,3,93,124,214,204,197,181,126,181,249,214,217,188,79,120,224,231,125,
+218,161,105,85,51,131,229,23,150,220,131,208,21,84,155,79,135,205,187,194,71,16,95,143,248,75,85,175,11,216,182,109,103,129,137,160,54,244,4,212,230,211,83,219,125,80,73,93,221,208,178,234,4,216,186,
+181,127,130,77,7,108,54,111,126,191,218,124,74,133,191,245,214,59,2,248,24,165,171,27,90,214,146,0,61,238,129,250,250,118,168,205,167,192,230,125,194,71,176,119,147,39,1,106,251,178,136,8,94,68,116,
+27,6,25,212,230,91,91,219,125,194,3,241,119,245,66,195,154,247,7,144,95,206,187,7,100,125,160,218,124,107,109,62,14,134,235,61,9,80,251,6,17,98,39,253,88,138,13,125,76,181,249,214,218,188,203,45,183,
+220,30,192,231,249,92,189,208,112,37,9,176,70,40,185,7,229,213,176,218,124,107,108,222,39,60,16,119,143,248,104,87,251,38,81,148,71,31,221,118,153,81,64,27,214,4,168,205,183,166,182,187,194,71,176,26,
+200,213,9,237,86,188,79,224,150,45,91,251,88,5,228,66,79,64,109,190,249,54,239,131,227,251,52,66,187,186,236,22,42,7,42,186,7,167,193,161,54,223,92,155,247,113,243,205,183,93,95,170,231,80,159,173,98,
+41,210,240,155,163,241,103,195,160,144,218,124,115,109,222,21,62,130,239,6,184,250,160,89,61,19,160,219,115,130,96,76,64,109,190,57,54,239,138,30,17,125,73,204,67,125,63,32,245,200,35,31,40,48,87,223,
+134,37,227,106,243,235,91,34,124,4,67,191,174,46,104,85,247,47,134,72,31,51,75,63,211,5,23,80,155,111,188,205,199,213,126,159,38,104,213,144,239,6,201,129,175,184,39,227,249,163,54,223,156,218,30,209,
+221,189,46,248,47,51,127,60,226,55,230,163,81,148,135,31,222,146,101,106,152,11,31,142,80,155,111,172,240,136,110,67,203,223,167,5,26,53,244,219,129,114,130,188,239,196,140,11,168,205,55,94,120,224,
+222,98,196,111,236,135,35,41,210,253,235,166,11,232,178,97,195,70,181,249,58,219,124,28,140,193,248,52,64,155,166,124,63,88,158,251,51,60,251,93,120,71,160,54,95,223,218,110,115,211,77,183,6,13,63,95,
+236,209,164,169,95,16,151,19,46,250,46,132,71,129,218,124,253,133,7,238,55,70,252,230,126,62,158,242,208,67,239,235,101,28,192,133,121,131,106,243,43,183,121,91,248,8,22,124,248,98,142,22,153,86,20,
+57,241,37,223,5,209,43,80,155,175,143,232,17,236,205,24,35,254,165,76,43,139,244,69,23,232,143,186,208,77,81,155,95,185,240,192,99,213,23,99,98,159,105,117,217,184,113,115,143,80,98,72,210,133,133,36,
+106,243,181,11,15,12,176,249,98,27,198,188,39,147,134,34,23,146,139,185,200,32,123,213,230,171,19,29,110,188,241,150,192,65,227,226,74,204,51,105,42,189,189,155,230,152,41,228,194,36,82,38,142,168,
+205,175,75,36,122,4,49,33,118,190,152,18,235,76,26,139,92,88,193,119,193,244,12,124,73,160,54,255,118,225,35,241,137,89,140,248,133,76,154,139,100,237,60,153,235,98,39,129,218,188,95,120,224,49,73,
+172,124,49,36,182,153,180,23,185,248,46,97,129,155,240,65,155,64,109,222,15,131,103,113,113,11,99,218,149,105,135,34,23,186,86,120,53,238,102,232,29,116,186,205,187,224,142,101,196,39,150,107,51,237,
+84,54,108,216,184,86,88,224,37,145,15,198,9,58,213,230,109,110,184,225,230,160,66,196,197,41,140,97,123,137,111,37,65,151,48,31,119,115,140,24,98,123,157,100,243,145,232,192,253,48,163,170,140,248,
+196,174,43,211,238,229,193,7,123,11,140,99,199,65,187,160,19,108,62,18,30,24,224,41,23,19,98,150,89,77,69,110,104,174,220,13,243,42,153,129,143,213,106,243,17,92,51,143,191,10,226,207,101,86,99,121,
+224,129,247,230,132,18,203,152,226,224,125,119,59,8,95,141,232,16,53,244,202,221,123,24,155,92,102,53,151,251,239,127,79,143,176,192,172,150,56,104,27,176,222,160,221,109,62,130,118,14,91,183,148,187,
+231,48,38,61,153,78,41,114,179,151,42,4,228,250,148,243,118,179,249,136,232,11,94,149,238,147,88,100,58,177,220,119,223,134,94,97,145,47,142,150,131,68,192,62,121,52,164,217,230,129,223,99,110,36,194,
+87,186,175,240,222,123,51,157,94,36,8,51,9,130,21,64,27,129,225,210,180,9,79,23,150,222,76,210,251,224,158,51,90,254,92,228,185,223,45,228,121,254,39,129,26,198,46,37,81,50,180,194,230,17,29,103,226,
+90,146,94,119,120,143,221,170,120,76,145,198,82,86,184,66,163,41,41,60,34,24,77,163,189,192,208,178,157,16,245,18,157,63,243,8,162,65,135,11,113,206,106,174,49,188,167,172,42,92,93,34,20,170,12,242,
+117,232,107,99,201,244,38,104,140,145,24,81,27,34,74,140,72,100,254,28,45,183,162,183,65,205,198,89,72,40,142,193,247,146,106,189,142,240,30,84,248,90,139,212,180,110,97,78,40,82,235,218,132,98,120,
+205,106,245,117,78,134,62,225,178,80,74,161,232,165,240,218,250,84,169,6,23,105,116,173,17,250,133,188,80,164,17,214,34,138,225,53,112,45,107,84,153,22,149,108,246,221,61,194,132,80,16,150,152,67,223,
+32,150,194,115,112,174,30,141,124,122,19,162,75,200,10,57,97,86,200,11,243,194,162,176,44,92,21,174,9,165,144,107,225,223,45,135,63,51,31,254,206,108,120,12,142,213,165,145,213,162,69,139,22,45,90,
+180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,150,212,148,153,153,217,46,33,43,228,132,89,33,47,204,11,139,194,178,112,85,184,38,148,66,174,133,127,183,28,254,204,124,248,59,179,225,49,56,
+150,14,5,167,88,240,30,97,66,40,8,75,130,105,16,75,225,57,56,151,190,12,106,85,185,120,241,137,53,66,191,144,23,138,130,105,17,197,240,26,184,22,125,29,220,232,114,225,194,227,125,194,101,161,36,152,
+148,81,10,175,77,39,132,212,89,244,110,97,78,40,166,80,244,56,138,225,53,235,148,176,90,203,249,243,143,101,133,130,96,106,97,106,234,148,57,116,104,194,228,114,251,205,206,157,131,193,119,244,216,81,
+155,253,245,216,110,133,69,152,209,154,60,254,204,70,12,236,190,197,207,240,201,181,254,254,221,102,207,158,125,102,116,116,220,28,63,126,210,212,122,29,225,61,232,164,208,42,133,191,82,77,144,207,
+158,189,104,14,31,158,52,131,131,195,193,23,179,16,51,90,105,91,97,49,102,197,101,91,209,66,14,142,197,231,88,118,237,218,99,198,198,142,4,231,172,50,17,174,104,34,148,41,231,206,205,116,11,121,193,
+36,225,196,137,51,102,223,190,131,65,205,118,151,87,175,84,116,91,248,114,240,113,166,225,225,3,102,122,250,180,73,122,221,225,61,234,163,193,46,82,155,102,168,81,73,24,25,25,243,138,94,207,218,30,71,
+185,21,63,36,195,254,253,163,38,233,125,112,207,42,252,217,139,189,194,98,165,96,241,60,223,189,59,23,236,147,151,54,225,193,94,8,194,245,208,230,160,221,144,32,9,184,247,206,92,28,122,230,204,133,75,
+130,41,199,209,163,211,65,99,172,17,162,215,91,120,31,91,183,246,155,201,201,41,83,233,62,137,69,39,9,223,35,44,148,11,8,53,158,90,148,198,218,158,68,120,119,209,200,182,109,59,3,71,168,144,4,196,100,
+117,143,46,158,62,125,62,39,148,4,19,199,208,208,222,96,135,172,52,219,124,82,225,109,248,119,122,16,229,238,61,140,205,234,220,34,230,212,169,115,115,130,137,131,62,59,125,240,118,179,249,74,75,198,
+220,213,68,180,99,14,30,60,108,202,197,130,88,173,54,241,11,229,110,120,96,96,168,237,109,190,146,240,46,219,183,15,84,74,130,246,223,38,238,228,201,179,93,194,188,96,124,140,143,31,13,190,118,185,90,
+108,62,137,240,246,82,51,70,30,25,84,138,139,79,24,187,174,118,21,127,173,176,16,119,115,123,247,142,172,90,155,175,36,188,11,67,206,101,146,128,24,182,215,86,177,39,78,156,89,43,188,202,104,157,15,
+44,191,19,108,190,210,98,83,54,177,136,160,167,16,23,175,48,150,107,219,69,252,46,97,33,238,102,232,27,119,146,205,87,18,222,134,119,13,101,146,128,152,166,255,113,48,61,125,122,158,177,113,23,250,
+193,188,168,233,84,155,47,39,124,4,91,209,240,41,56,98,229,139,33,177,77,181,248,83,83,167,10,12,226,184,28,59,118,34,104,236,117,186,205,151,19,222,134,174,34,163,160,190,88,18,227,180,138,63,151,84,
+252,78,182,249,56,209,125,73,64,236,98,146,32,93,227,4,98,89,57,108,203,7,111,201,212,230,147,11,127,239,189,239,186,14,147,87,226,226,74,204,211,34,126,143,80,242,93,36,175,109,213,230,171,23,222,
+134,209,209,152,4,32,230,173,127,119,32,54,181,128,85,185,236,216,177,75,109,190,70,209,109,216,0,147,138,228,139,49,177,111,169,248,210,80,185,68,99,197,133,23,58,106,243,181,11,143,232,46,140,157,
+248,98,141,6,173,18,191,215,119,65,204,216,81,155,175,159,240,54,204,56,138,73,130,230,79,42,153,156,156,90,100,178,131,203,166,77,143,168,205,215,96,243,229,96,111,98,160,49,237,139,57,90,52,91,252,
+25,223,133,48,156,169,54,95,159,218,30,137,238,66,175,42,38,9,154,51,199,240,200,145,227,221,130,113,97,118,172,218,124,227,132,143,96,243,106,218,88,62,13,208,166,225,9,48,49,113,44,47,24,23,250,172,
+106,243,141,21,62,130,184,250,52,64,155,70,139,159,245,157,152,46,159,218,124,253,69,119,133,183,161,107,24,147,4,141,91,124,50,62,126,244,10,147,56,108,152,222,20,61,247,213,230,235,95,219,125,240,
+165,20,126,142,30,151,171,7,26,53,74,252,172,231,100,193,58,58,181,249,230,9,111,67,143,203,167,9,90,213,61,1,14,31,158,44,176,254,206,134,126,169,218,124,227,108,62,78,120,27,102,86,185,186,160,85,
+93,197,31,27,59,210,205,220,53,23,222,239,171,205,55,167,182,251,224,131,85,52,190,125,218,160,89,61,19,96,206,61,129,91,251,213,230,155,35,60,162,187,176,72,214,147,0,245,123,101,124,232,208,68,145,
+121,251,54,180,66,213,230,155,99,243,113,194,71,240,198,208,213,7,205,234,37,126,159,231,224,193,176,164,218,124,115,108,190,28,124,21,141,107,241,105,132,118,43,78,128,209,209,241,203,236,146,97,195,
+130,77,181,249,214,212,118,91,120,27,38,219,186,58,161,221,138,196,151,62,254,26,161,68,95,223,134,137,139,106,243,205,23,222,21,221,134,177,24,87,167,80,187,53,43,73,128,126,247,160,116,59,212,230,
+155,111,243,229,224,3,151,192,251,24,79,18,244,215,156,0,35,35,99,121,70,155,108,120,227,167,54,223,26,155,143,19,62,130,55,133,174,94,104,184,146,4,40,186,7,164,223,169,54,223,26,155,247,137,110,195,
+112,188,39,1,106,235,13,28,56,112,168,71,48,54,244,253,213,230,91,107,243,113,220,125,247,61,1,140,9,184,186,161,101,45,9,48,225,30,136,93,59,212,230,91,107,243,113,194,71,240,136,246,36,192,68,213,9,
+32,181,189,64,141,183,97,237,154,218,252,95,180,188,182,251,132,143,224,17,237,234,134,150,85,39,128,88,201,18,118,98,195,14,155,174,224,156,240,19,159,248,148,249,218,215,190,110,46,93,250,107,51,62,
+62,105,54,111,126,191,218,124,19,106,187,203,93,119,189,51,208,196,213,13,45,171,21,191,203,115,144,183,89,63,27,28,252,242,151,191,52,111,190,249,230,219,120,253,245,215,205,119,191,251,127,204,223,
+253,221,103,204,244,244,41,179,117,235,14,181,249,6,10,31,193,207,251,180,67,211,196,9,32,125,253,44,253,125,27,246,233,115,109,254,111,255,246,147,94,241,227,248,227,31,255,104,126,248,195,127,53,79,
+63,253,101,115,225,194,99,114,204,61,193,241,212,230,87,46,188,13,107,8,92,253,208,180,154,4,200,185,7,160,113,225,62,207,191,250,213,175,87,149,0,113,44,44,252,52,56,214,135,63,252,17,105,176,140,6,
+123,253,170,205,87,39,186,13,175,233,61,9,144,124,45,225,240,240,129,89,70,149,108,104,0,186,9,240,196,19,31,172,75,2,248,248,213,175,126,101,158,127,254,159,204,199,63,254,183,230,200,145,163,193,27,
+47,181,249,120,238,188,179,231,58,180,203,92,253,208,52,113,2,228,114,251,243,108,179,110,195,248,191,175,97,247,220,115,223,108,88,18,184,252,238,119,191,51,223,255,254,188,249,236,103,63,111,78,157,
+58,35,174,212,223,177,54,239,19,62,130,55,181,174,126,104,90,77,2,204,187,7,192,150,227,90,240,251,247,31,52,115,115,79,6,61,1,236,188,89,9,1,111,188,241,63,242,248,248,90,144,148,157,100,243,62,225,
+35,104,87,121,18,32,249,238,34,123,246,236,91,100,231,42,27,222,54,37,237,194,113,1,52,240,46,92,152,9,26,124,63,248,193,15,131,6,96,35,19,225,27,223,120,174,163,108,222,199,250,245,239,8,224,177,232,
+234,135,166,213,36,192,178,123,0,222,254,173,180,27,247,129,15,108,51,83,83,39,205,167,62,245,105,243,157,239,124,215,252,246,183,191,173,107,18,208,77,237,20,155,247,9,31,193,117,123,18,96,57,113,2,
+12,13,237,189,202,242,35,27,106,117,35,6,109,24,75,56,116,104,220,124,244,163,151,130,90,252,234,171,175,174,32,1,238,235,24,155,247,9,31,193,241,93,253,208,52,113,2,12,14,14,95,227,243,43,54,149,132,
+175,231,160,13,110,195,69,63,246,216,19,38,159,127,198,188,244,210,143,229,89,255,70,89,241,191,254,245,203,29,101,243,149,112,245,67,211,106,18,160,228,30,32,13,99,243,140,38,158,60,121,218,124,230,
+51,159,51,223,251,222,247,131,94,1,109,139,103,158,249,135,224,231,58,201,230,93,238,184,227,238,183,224,73,128,82,226,4,216,189,59,87,98,228,207,70,199,230,211,101,243,113,194,71,184,250,161,105,53,
+9,112,205,151,0,58,54,159,30,155,143,19,30,248,119,79,2,36,127,4,236,218,181,231,42,31,55,176,161,13,160,99,243,233,178,121,151,219,111,191,43,128,99,185,250,161,105,226,4,24,24,24,90,230,133,130,13,
+189,0,181,249,116,217,188,43,124,4,215,237,234,135,166,213,36,192,162,123,0,90,230,106,243,233,177,121,159,240,17,196,200,147,0,201,7,130,118,238,28,156,103,250,151,13,35,129,106,243,247,164,174,182,
+251,160,146,186,250,161,105,53,9,144,119,15,192,187,0,181,249,244,10,127,219,109,119,94,135,17,81,79,2,36,127,25,212,223,191,123,150,229,95,54,188,98,84,155,79,143,205,251,132,143,224,75,44,174,126,
+104,154,56,1,118,236,216,149,99,223,31,27,222,199,171,205,167,199,230,125,194,71,80,89,93,253,208,180,154,4,200,186,7,96,43,24,181,249,244,216,188,143,117,235,214,7,176,66,200,147,0,201,167,132,109,
+223,62,208,197,103,205,92,92,235,87,155,111,157,205,251,132,7,126,222,167,29,154,86,53,51,88,126,97,201,61,8,93,65,181,249,116,216,188,43,124,4,241,245,136,191,84,245,186,128,109,219,118,22,152,8,106,
+67,79,64,109,62,61,181,221,7,149,212,213,13,45,171,78,128,173,91,251,39,216,116,192,134,5,31,106,243,233,20,254,214,91,239,8,96,126,133,171,27,90,214,146,0,61,238,129,250,250,118,168,205,167,192,230,
+125,194,71,176,119,147,39,1,106,251,178,136,8,94,68,116,27,6,25,212,230,91,91,219,125,194,3,241,119,245,66,195,154,247,7,144,95,206,187,7,100,125,160,218,124,107,109,62,14,134,235,61,9,80,251,6,17,98,
+39,253,88,138,13,125,76,181,249,214,218,188,203,45,183,220,30,192,231,249,92,189,208,112,37,9,176,70,40,185,7,229,213,176,218,124,107,108,222,39,60,16,119,143,248,104,87,251,38,81,148,71,31,221,118,
+153,81,64,27,62,106,168,54,223,154,218,238,10,31,193,106,32,87,39,180,91,241,62,129,91,182,108,237,99,177,161,11,61,1,181,249,230,219,188,15,142,239,211,8,237,234,178,91,168,28,168,232,30,156,6,135,
+218,124,115,109,222,199,205,55,223,22,76,215,243,136,95,159,173,98,41,210,240,155,163,241,103,195,160,144,218,124,115,109,222,21,62,130,239,6,184,250,160,89,61,19,160,219,115,130,96,76,64,109,190,57,
+54,239,138,30,17,125,73,204,67,125,63,32,245,200,35,31,40,176,71,128,13,75,198,213,230,215,183,68,248,8,134,126,93,93,208,170,238,95,12,145,62,102,150,126,166,11,46,160,54,223,120,155,143,171,253,62,
+77,208,170,33,223,13,146,3,95,113,79,198,243,71,109,190,57,181,61,162,187,123,93,240,95,102,254,120,196,111,204,71,163,40,15,63,188,37,203,212,48,23,62,28,161,54,223,88,225,17,221,134,150,191,79,11,
+52,106,232,183,3,229,4,121,223,137,25,23,80,155,111,188,240,192,189,197,136,223,216,15,71,82,164,251,215,77,23,208,101,195,134,141,106,243,117,182,249,56,24,131,241,105,128,54,77,249,126,176,60,247,
+103,120,246,187,240,142,64,109,190,190,181,221,230,166,155,110,13,26,126,190,216,163,73,83,191,32,46,39,92,244,93,8,143,2,181,249,250,11,15,220,111,140,248,205,253,124,60,229,161,135,222,215,203,56,
+128,11,243,6,213,230,87,110,243,182,240,17,44,248,240,197,28,45,50,173,40,114,226,75,190,11,162,87,160,54,95,31,209,35,216,6,47,70,252,75,153,86,22,233,139,46,208,31,117,161,155,162,54,191,114,225,
+129,199,170,47,198,196,62,211,234,178,113,227,230,30,161,196,144,164,11,11,73,212,230,107,23,30,24,96,243,197,54,140,121,79,38,13,69,46,36,23,115,145,65,246,170,205,87,39,58,220,120,227,45,129,131,
+198,197,149,152,103,210,84,122,123,55,205,49,83,200,133,73,164,76,28,81,155,95,151,72,244,8,98,66,236,124,49,37,214,153,52,22,185,176,130,239,130,233,25,248,146,64,109,254,237,194,71,226,19,179,24,
+241,11,153,52,23,201,218,121,50,215,197,78,2,181,121,191,240,192,99,146,88,249,98,72,108,51,105,47,114,241,93,194,2,55,225,131,54,129,218,188,31,6,207,226,226,22,198,180,43,211,14,69,46,116,173,240,
+106,220,205,208,59,232,116,155,119,193,29,203,136,79,44,215,102,218,169,108,216,176,113,173,176,192,75,34,31,140,19,116,170,205,219,220,112,195,205,65,133,136,139,83,24,195,246,18,223,74,130,46,97,62,
+238,230,24,49,196,246,58,201,230,35,209,129,251,97,70,85,25,241,137,93,87,166,221,203,131,15,246,22,24,199,142,131,118,65,39,216,124,36,60,48,192,83,46,38,196,44,179,154,138,220,208,92,185,27,230,85,
+50,3,31,171,213,230,35,184,102,30,127,21,196,159,203,172,198,242,192,3,239,205,9,37,150,49,197,193,251,238,118,16,190,26,209,33,106,232,149,187,247,48,54,185,204,106,46,247,223,255,158,30,97,129,89,
+45,113,208,54,96,189,65,187,219,124,4,237,28,182,110,41,119,207,97,76,122,50,157,82,228,102,47,85,8,200,245,41,231,237,102,243,17,209,23,188,42,221,39,177,200,116,98,185,239,190,13,189,194,162,96,202,
+65,34,96,159,60,26,210,108,243,192,239,49,55,18,225,43,221,87,120,239,189,153,78,47,18,132,153,4,193,10,160,141,192,112,105,218,132,167,11,75,111,38,233,125,112,207,25,45,127,46,242,220,239,22,242,60,
+255,147,64,13,99,151,146,40,25,90,97,243,136,142,51,113,45,73,175,59,188,199,110,85,60,166,72,99,41,43,92,161,209,148,20,30,17,140,166,209,94,96,104,217,78,136,122,137,206,159,121,4,209,160,195,133,
+56,103,53,215,24,222,83,86,21,174,46,17,10,85,6,249,58,244,181,177,100,122,19,52,198,72,140,168,13,17,37,70,36,50,127,142,150,91,209,219,160,102,227,44,36,20,199,224,123,73,181,94,71,120,15,42,124,
+173,69,106,90,183,48,39,20,169,117,109,66,49,188,102,181,250,58,39,67,159,112,89,40,165,80,244,82,120,109,125,170,84,131,139,52,186,214,8,253,66,94,40,210,8,107,17,197,240,26,184,150,53,170,76,139,74,
+54,251,238,30,97,66,40,8,75,204,161,111,16,75,225,57,56,87,143,70,62,189,9,209,37,100,133,156,48,43,228,133,121,97,81,88,22,174,10,215,132,82,200,181,240,239,150,195,159,153,15,127,103,54,60,6,199,
+234,210,200,106,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,75,106,202,204,204,108,151,144,21,114,194,172,144,23,230,133,69,97,89,184,42,92,19,74,33,215,194,191,91,14,
+127,102,62,252,157,217,240,24,28,75,135,130,83,44,120,143,48,33,20,132,37,193,52,136,165,240,28,156,75,95,6,181,170,92,188,248,196,26,161,95,200,11,69,193,180,136,98,120,13,92,139,190,14,110,116,185,
+112,225,241,62,225,178,80,18,76,202,40,133,215,166,19,66,234,44,122,183,48,39,20,83,40,122,28,197,240,154,117,74,88,173,229,252,249,199,178,66,65,48,181,48,53,117,202,28,58,52,97,114,185,253,102,231,
+206,193,224,59,122,236,168,205,254,122,108,183,194,34,204,104,77,30,127,102,35,6,118,223,226,103,248,228,90,127,255,110,179,103,207,62,51,58,58,110,142,31,63,105,106,189,142,240,30,116,82,104,149,194,
+95,169,38,200,103,207,94,52,135,15,79,154,193,193,225,224,139,89,136,25,173,180,173,176,24,179,226,178,173,104,33,7,199,226,115,44,187,118,237,49,99,99,71,130,115,86,153,8,87,52,17,202,148,115,231,
+102,186,133,188,96,146,112,226,196,25,179,111,223,193,160,102,187,203,171,87,42,186,45,124,57,248,56,211,240,240,1,51,61,125,218,36,189,238,240,30,245,209,96,23,169,77,51,212,168,36,140,140,140,121,
+69,175,103,109,143,163,220,138,31,146,97,255,254,81,147,244,62,184,103,21,254,236,197,94,97,177,82,176,120,158,239,222,157,11,246,201,75,155,240,96,47,4,225,122,104,115,208,110,72,144,4,220,123,103,
+46,14,61,115,230,194,37,193,148,227,232,209,233,160,49,214,8,209,235,45,188,143,173,91,251,205,228,228,148,169,116,159,196,162,147,132,239,17,22,202,5,132,26,79,45,74,99,109,79,34,188,187,104,100,219,
+182,157,129,35,84,72,2,98,178,186,71,23,79,159,62,159,19,74,130,137,99,104,104,111,176,67,86,154,109,62,169,240,54,252,59,61,136,114,247,30,198,102,117,110,17,115,234,212,185,57,193,196,65,159,157,62,
+120,187,217,124,165,37,99,238,106,34,218,49,7,15,30,54,229,98,65,172,86,155,248,133,114,55,60,48,48,212,246,54,95,73,120,151,237,219,7,42,37,65,251,111,19,119,242,228,217,46,97,94,48,62,198,199,143,6,
+95,187,92,45,54,159,68,120,123,169,25,35,143,12,42,197,197,39,140,93,87,187,138,191,86,88,136,187,185,189,123,71,86,173,205,87,18,222,133,33,231,50,73,64,12,219,107,171,216,19,39,206,172,21,94,101,
+180,206,7,150,223,9,54,95,105,177,41,155,88,68,208,83,136,139,87,24,203,181,237,34,126,151,176,16,119,51,244,141,59,201,230,43,9,111,195,187,134,50,73,64,76,211,255,56,152,158,62,61,207,216,184,11,
+253,96,94,212,116,170,205,151,19,62,130,173,104,248,20,28,177,242,197,144,216,166,90,252,169,169,83,5,6,113,92,142,29,59,17,52,246,58,221,230,203,9,111,67,87,145,81,80,95,44,137,113,90,197,159,75,42,
+126,39,219,124,156,232,190,36,32,118,49,73,144,174,113,2,177,172,28,182,229,131,183,100,106,243,201,133,191,247,222,119,93,135,201,43,113,113,37,230,105,17,191,71,40,249,46,146,215,182,106,243,213,11,
+111,195,232,104,76,2,16,243,214,191,59,16,155,90,192,170,92,118,236,216,165,54,95,163,232,54,108,128,73,69,242,197,152,216,183,84,124,105,168,92,162,177,226,194,11,29,181,249,218,133,71,116,23,198,78,
+124,177,70,131,86,137,223,235,187,32,102,236,168,205,215,79,120,27,102,28,197,36,65,243,39,149,76,78,78,45,50,217,193,101,211,166,71,212,230,107,176,249,114,176,55,49,208,152,246,197,28,45,154,45,254,
+140,239,66,24,206,84,155,175,79,109,143,68,119,161,87,21,147,4,205,153,99,120,228,200,241,110,193,184,48,59,86,109,190,113,194,71,176,121,53,109,44,159,6,104,211,240,4,152,152,56,150,23,140,11,125,86,
+181,249,198,10,31,65,92,125,26,160,77,163,197,207,250,78,76,151,79,109,190,254,162,187,194,219,208,53,140,73,130,198,45,62,25,31,63,122,133,73,28,54,76,111,138,158,251,106,243,245,175,237,62,248,82,
+10,63,71,143,203,213,3,141,26,37,126,214,115,178,96,29,157,218,124,243,132,183,161,199,229,211,4,173,234,158,0,135,15,79,22,88,127,103,67,191,84,109,190,113,54,31,39,188,13,51,171,92,93,208,170,174,
+226,143,141,29,233,102,238,154,11,239,247,213,230,155,83,219,125,240,193,42,26,223,62,109,208,172,158,9,48,231,158,192,173,253,106,243,205,17,30,209,93,88,36,235,73,128,250,189,50,62,116,104,162,200,
+188,125,27,90,161,106,243,205,177,249,56,225,35,120,99,232,234,131,102,245,18,191,207,115,240,96,88,82,109,190,57,54,95,14,190,138,198,181,248,52,66,187,21,39,192,232,232,248,101,118,201,176,97,193,
+166,218,124,107,106,187,45,188,13,147,109,93,157,208,110,69,226,75,31,127,141,80,162,175,111,195,196,69,181,249,230,11,239,138,110,195,88,140,171,83,168,221,154,149,36,64,191,123,80,186,29,106,243,
+205,183,249,114,240,129,75,224,125,140,39,9,250,107,78,128,145,145,177,60,163,77,54,188,241,83,155,111,141,205,199,9,31,193,155,66,87,47,52,92,73,2,20,221,3,210,239,84,155,111,141,205,251,68,183,97,
+56,222,147,0,181,245,6,14,28,56,212,35,24,27,250,254,62,225,63,253,233,207,154,255,248,143,255,48,197,98,209,252,223,255,251,3,243,55,127,243,9,233,155,142,168,205,55,73,120,184,251,238,123,2,24,19,
+112,117,67,203,90,18,96,194,61,16,187,118,184,53,254,210,165,143,155,55,223,124,211,203,127,252,199,127,154,231,159,255,39,243,193,15,126,216,236,216,49,160,54,223,64,225,35,120,68,123,18,96,162,234,
+4,144,218,94,160,198,219,176,118,205,181,245,133,133,159,198,38,128,203,175,126,245,154,249,199,127,44,152,83,167,206,6,61,9,181,249,218,68,247,9,31,193,35,218,213,13,45,171,78,0,177,146,37,236,196,
+134,29,54,221,4,120,229,149,133,196,9,224,242,242,203,175,152,207,126,246,243,230,240,225,35,129,171,168,205,215,38,122,196,93,119,189,51,208,196,213,13,45,171,21,191,203,115,144,183,53,246,176,242,
+39,159,124,170,230,4,176,161,253,240,189,239,205,203,35,229,175,205,208,208,176,218,124,149,194,71,240,243,62,237,208,52,113,2,72,95,63,75,127,223,134,125,250,226,90,243,52,250,94,127,253,245,186,36,
+66,196,239,126,247,59,243,220,115,87,204,204,204,227,230,209,71,183,170,205,87,16,222,134,53,4,174,126,104,90,77,2,228,220,3,208,184,168,212,154,231,196,31,249,200,71,205,119,191,251,127,204,127,255,
+247,127,215,53,33,126,241,139,95,152,47,127,249,43,230,248,241,233,96,23,177,78,182,249,74,240,154,222,147,0,201,215,18,14,15,31,152,101,84,201,134,6,96,181,221,184,131,7,199,204,167,62,245,105,243,
+226,139,47,214,53,25,224,197,23,95,10,142,125,224,192,104,199,217,188,143,59,239,236,185,14,13,65,87,63,52,77,156,0,185,220,254,60,219,172,219,208,106,95,73,55,142,29,188,143,31,63,17,212,226,127,255,
+247,127,175,251,227,98,106,234,100,71,217,188,79,248,8,222,212,186,250,161,105,53,9,48,239,30,0,1,235,57,104,179,101,75,159,185,120,241,49,243,236,179,207,153,165,165,165,21,39,193,159,254,244,167,
+160,151,210,41,54,239,19,62,130,118,154,39,1,146,239,46,178,103,207,190,69,118,174,178,225,109,83,35,7,109,216,69,243,163,31,189,100,254,249,159,191,23,136,89,75,18,28,59,54,213,49,54,239,99,253,250,
+119,4,208,30,114,245,67,211,106,18,96,217,61,0,111,255,154,53,104,195,177,71,71,15,155,79,127,250,51,230,199,63,254,73,226,4,24,25,25,237,24,155,247,9,31,193,117,123,18,96,57,113,2,12,13,237,189,202,
+242,35,27,108,165,85,163,117,88,251,244,244,73,243,149,175,252,131,89,92,92,244,138,255,131,31,252,176,163,108,222,39,124,4,199,119,245,67,211,196,9,48,56,56,124,141,207,175,216,84,18,190,153,131,54,
+140,11,204,204,60,97,174,92,249,150,249,201,79,94,54,127,255,247,95,52,239,126,247,3,29,101,243,149,112,245,67,211,106,18,160,228,30,64,199,230,211,45,252,29,119,220,253,22,60,9,80,74,156,0,187,119,
+231,74,140,252,217,232,216,124,186,108,62,78,248,8,87,63,52,173,38,1,174,249,18,64,199,230,211,99,243,113,194,3,255,238,73,128,228,143,0,233,146,93,165,91,102,67,27,64,109,62,93,54,239,114,251,237,
+119,5,112,44,87,63,52,77,156,0,3,3,67,203,140,235,219,208,11,80,155,79,151,205,187,194,71,112,221,174,126,104,90,77,2,44,186,7,96,28,64,109,62,61,54,239,19,62,130,24,121,18,32,249,64,208,206,157,131,
+243,76,255,178,97,36,80,109,254,158,212,213,118,31,84,82,87,63,52,173,38,1,242,238,1,120,23,160,54,159,94,225,111,187,237,206,235,48,113,199,147,0,201,95,6,245,247,239,158,101,249,151,13,175,24,213,
+230,211,99,243,62,225,35,248,18,139,171,31,154,38,78,128,29,59,118,229,216,247,199,134,21,168,106,243,233,177,121,159,240,17,84,86,87,63,52,173,38,1,178,238,1,216,10,70,109,62,61,54,239,99,221,186,
+245,1,172,16,242,36,64,242,41,97,219,183,15,116,241,89,51,23,215,250,213,230,91,103,243,62,225,129,159,247,105,135,166,85,205,12,150,95,88,114,15,66,87,80,109,62,29,54,239,10,31,65,124,61,226,47,85,
+189,46,96,219,182,157,5,38,130,218,208,19,80,155,79,79,109,247,65,37,117,117,67,203,170,19,96,235,214,254,9,54,29,176,217,188,249,253,106,243,41,21,254,214,91,239,8,224,99,148,174,110,104,89,75,2,244,
+184,7,234,235,219,161,54,159,2,155,247,9,31,193,222,77,158,4,168,237,203,34,34,120,17,209,109,24,100,80,155,111,109,109,247,9,15,196,223,213,11,13,107,222,31,64,126,57,239,30,144,233,89,106,243,173,
+181,249,56,24,174,247,36,64,237,27,68,136,157,244,99,41,54,244,49,213,230,91,107,243,46,183,220,114,123,0,159,231,115,245,66,195,149,36,192,26,161,228,30,148,87,195,106,243,173,177,121,159,240,64,220,
+61,226,163,93,237,155,68,81,30,125,116,219,101,70,1,109,248,168,161,218,124,107,106,187,43,124,4,171,129,92,157,208,110,197,251,4,110,217,178,181,143,197,134,46,244,4,212,230,155,111,243,62,56,190,79,
+35,180,171,203,110,161,114,160,162,123,112,26,28,106,243,205,181,121,31,55,223,124,91,48,93,207,35,126,125,182,138,165,72,195,111,142,198,159,13,131,66,106,243,205,181,121,87,248,8,190,27,224,234,131,
+102,245,76,128,110,207,9,130,49,1,181,249,230,216,188,43,122,68,244,37,49,15,245,253,128,212,35,143,124,160,192,30,1,54,44,25,87,155,95,223,18,225,35,24,250,117,117,65,171,186,127,49,68,250,152,89,
+250,153,46,184,128,218,124,227,109,62,174,246,251,52,65,171,134,124,55,72,14,124,197,61,25,207,31,181,249,230,212,246,136,238,238,117,193,127,153,249,227,17,191,49,31,141,162,60,252,240,150,44,83,195,
+92,248,112,132,218,124,99,133,71,116,27,90,254,62,45,208,168,161,223,14,148,19,228,125,39,102,92,64,109,190,241,194,3,247,22,35,126,99,63,28,73,145,238,95,55,93,64,23,118,238,82,155,175,175,205,199,
+193,24,140,79,3,180,105,202,247,131,229,185,63,195,179,223,133,119,4,106,243,245,173,237,54,55,221,116,107,208,240,243,197,30,77,154,250,5,113,57,225,162,239,66,120,20,168,205,215,95,120,224,126,99,
+196,111,238,231,227,41,15,61,244,190,94,198,1,92,152,55,168,54,191,114,155,183,133,143,96,193,135,47,230,104,145,105,69,145,19,95,242,93,16,189,2,181,249,250,136,30,193,222,140,49,226,95,202,180,178,
+72,95,116,129,254,168,11,221,20,181,249,149,11,15,60,86,125,49,38,246,153,86,151,141,27,55,247,8,37,134,36,93,88,72,162,54,95,187,240,192,0,155,47,182,97,204,123,50,105,40,114,33,185,152,139,12,178,
+87,109,190,58,209,225,198,27,111,9,28,52,46,174,196,60,147,166,210,219,187,105,142,153,66,46,76,34,101,226,136,218,252,186,68,162,71,16,19,98,231,139,41,177,206,164,177,200,133,21,124,23,76,207,192,
+151,4,106,243,111,23,62,18,159,152,197,136,95,200,164,185,72,214,206,147,185,46,118,18,168,205,251,133,7,30,147,196,202,23,67,98,155,73,123,145,139,239,18,22,184,9,31,180,9,212,230,253,48,120,22,23,
+183,48,166,93,153,118,40,114,161,107,133,87,227,110,134,222,65,167,219,188,11,238,88,70,124,98,185,54,211,78,101,195,134,141,107,133,5,94,18,249,96,156,160,83,109,222,230,134,27,110,14,42,68,92,156,
+194,24,182,151,248,86,18,116,9,243,113,55,199,136,33,182,215,73,54,31,137,14,220,15,51,170,202,136,79,236,186,50,237,94,30,124,176,183,192,56,118,28,180,11,58,193,230,35,225,129,1,158,114,49,33,102,
+153,213,84,228,134,230,202,221,48,175,146,25,248,88,173,54,31,193,53,243,248,171,32,254,92,102,53,150,7,30,120,111,78,40,177,140,41,14,222,119,183,131,240,213,136,14,81,67,175,220,189,135,177,201,101,
+86,115,185,255,254,247,244,8,11,204,106,137,131,182,1,235,13,218,221,230,35,104,231,176,117,75,185,123,14,99,210,147,233,148,34,55,123,169,66,64,174,79,57,111,55,155,143,136,190,224,85,233,62,137,69,
+166,19,203,125,247,109,232,21,22,5,83,14,18,1,251,228,209,144,102,155,7,126,143,185,145,8,95,233,190,194,123,239,205,116,122,145,32,204,36,8,86,0,109,4,134,75,211,38,60,93,88,122,51,73,239,131,123,
+206,104,249,115,145,231,126,183,144,231,249,159,4,106,24,187,148,68,201,208,10,155,71,116,156,137,107,73,122,221,225,61,118,171,226,49,69,26,75,89,225,10,141,166,164,240,136,96,52,141,246,2,67,203,
+118,66,212,75,116,254,204,35,136,6,29,46,196,57,171,185,198,240,158,178,170,112,117,137,80,168,50,200,215,161,175,141,37,211,155,160,49,70,98,68,109,136,40,49,34,145,249,115,180,220,138,222,6,53,27,
+103,33,161,56,6,223,75,170,245,58,194,123,80,225,107,45,82,211,186,133,57,161,72,173,107,19,138,225,53,171,213,215,57,25,250,132,203,66,41,133,162,151,194,107,235,83,165,26,92,164,209,181,70,232,23,
+242,66,145,70,88,139,40,134,215,192,181,172,81,101,90,84,178,217,119,247,8,19,66,65,88,98,14,125,131,88,10,207,193,185,122,52,242,233,77,136,46,33,43,228,132,89,33,47,204,11,139,194,178,112,85,184,38,
+148,66,174,133,127,183,28,254,204,124,248,59,179,225,49,56,86,151,70,86,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,82,83,102,102,102,187,132,172,144,19,102,133,188,
+48,47,44,10,203,194,85,225,154,80,10,185,22,254,221,114,248,51,243,225,239,204,134,199,224,88,58,20,156,98,193,123,132,9,161,32,44,9,166,65,44,133,231,224,92,250,50,168,85,229,226,197,39,214,8,253,66,
+94,40,10,166,69,20,195,107,224,90,244,117,112,163,203,133,11,143,247,9,151,133,146,96,82,70,41,188,54,157,16,82,103,209,187,133,57,161,152,66,209,227,40,134,215,172,83,194,106,45,231,207,63,150,21,10,
+130,169,133,169,169,83,230,208,161,9,147,203,237,55,59,119,14,6,223,209,99,71,109,246,215,99,187,21,22,97,70,107,242,248,51,27,49,176,251,22,63,195,39,215,250,251,119,155,61,123,246,153,209,209,113,
+115,252,248,73,83,235,117,132,247,160,147,66,171,20,254,74,53,65,62,123,246,162,57,124,120,210,12,14,14,7,95,204,66,204,104,165,109,133,197,152,21,151,109,69,11,57,56,22,159,99,217,181,107,143,25,27,
+59,18,156,179,202,68,184,162,137,80,166,156,59,55,211,45,228,5,147,132,19,39,206,152,125,251,14,6,53,219,93,94,189,82,209,109,225,203,193,199,153,134,135,15,152,233,233,211,38,233,117,135,247,168,143,
+6,187,72,109,154,161,70,37,97,100,100,204,43,122,61,107,123,28,229,86,252,144,12,251,247,143,154,164,247,193,61,171,240,103,47,246,10,139,149,130,197,243,124,247,238,92,176,79,94,218,132,7,123,33,8,
+215,67,155,131,118,67,130,36,224,222,59,115,113,232,153,51,23,46,9,166,28,71,143,78,7,141,177,70,136,94,111,225,125,108,221,218,111,38,39,167,76,165,251,36,22,157,36,124,143,176,80,46,32,212,120,106,
+81,26,107,123,18,225,221,69,35,219,182,237,12,28,161,66,18,16,147,213,61,186,120,250,244,249,156,80,18,76,28,67,67,123,131,29,178,210,108,243,73,133,183,225,223,233,65,148,187,247,48,54,171,115,139,
+152,83,167,206,205,9,38,14,250,236,244,193,219,205,230,43,45,25,115,87,19,209,142,57,120,240,176,41,23,11,98,181,218,196,47,148,187,225,129,129,161,182,183,249,74,194,187,108,223,62,80,41,9,218,127,
+155,184,147,39,207,118,9,243,130,241,49,62,126,52,248,218,229,106,177,249,36,194,219,75,205,24,121,100,80,41,46,62,97,236,186,218,85,252,181,194,66,220,205,237,221,59,178,106,109,190,146,240,46,12,57,
+151,73,2,98,216,94,91,197,158,56,113,102,173,240,42,163,117,62,176,252,78,176,249,74,139,77,217,196,34,130,158,66,92,188,194,88,174,109,23,241,187,132,133,184,155,161,111,220,73,54,95,73,120,27,222,
+53,148,73,2,98,154,254,199,193,244,244,233,121,198,198,93,232,7,243,162,166,83,109,190,156,240,17,108,69,195,167,224,136,149,47,134,196,54,213,226,79,77,157,42,48,136,227,114,236,216,137,160,177,215,
+233,54,95,78,120,27,186,138,140,130,250,98,73,140,211,42,254,92,82,241,59,217,230,227,68,247,37,1,177,139,73,130,116,141,19,136,101,229,176,45,31,188,37,83,155,79,46,252,189,247,190,235,58,76,94,137,
+139,43,49,79,139,248,61,66,201,119,145,188,182,85,155,175,94,120,27,70,71,99,18,128,152,183,254,221,129,216,212,2,86,229,178,99,199,46,181,249,26,69,183,97,3,76,42,146,47,198,196,190,165,226,75,67,
+229,18,141,21,23,94,232,168,205,215,46,60,162,187,48,118,226,139,53,26,180,74,252,94,223,5,49,99,71,109,190,126,194,219,48,227,40,38,9,154,63,169,100,114,114,106,145,201,14,46,155,54,61,162,54,95,131,
+205,151,131,189,137,129,198,180,47,230,104,209,108,241,103,124,23,194,112,166,218,124,125,106,123,36,186,11,189,170,152,36,104,206,28,195,35,71,142,119,11,198,133,217,177,106,243,141,19,62,130,205,
+171,105,99,249,52,64,155,134,39,192,196,196,177,188,96,92,232,179,170,205,55,86,248,8,226,234,211,0,109,26,45,126,214,119,98,186,124,106,243,245,23,221,21,222,134,174,97,76,18,52,110,241,201,248,248,
+209,43,76,226,176,97,122,83,244,220,87,155,175,127,109,247,193,151,82,248,57,122,92,174,30,104,212,40,241,179,158,147,5,235,232,212,230,155,39,188,13,61,46,159,38,104,85,247,4,56,124,120,178,192,250,
+59,27,250,165,106,243,141,179,249,56,225,109,152,89,229,234,130,86,117,21,127,108,236,72,55,115,215,92,120,191,175,54,223,156,218,238,131,15,86,209,248,246,105,131,102,245,76,128,57,247,4,110,237,87,
+155,111,142,240,136,238,194,34,89,79,2,212,239,149,241,161,67,19,69,230,237,219,208,10,85,155,111,142,205,199,9,31,193,27,67,87,31,52,171,151,248,125,158,131,7,195,146,106,243,205,177,249,114,240,85,
+52,174,197,167,17,218,173,56,1,70,71,199,47,179,75,134,13,11,54,213,230,91,83,219,109,225,109,152,108,235,234,132,118,43,18,95,250,248,107,132,18,125,125,27,38,46,250,68,31,27,155,48,83,83,39,131,134,
+137,218,124,253,133,119,69,183,97,44,198,213,41,212,110,205,74,18,160,223,61,40,221,14,87,120,86,184,252,232,71,47,154,55,223,124,243,58,223,254,246,11,230,204,153,115,193,0,145,218,124,227,132,7,62,
+112,9,188,143,241,36,65,127,205,9,48,50,50,150,103,180,201,134,55,126,174,173,127,229,43,255,240,22,241,109,222,120,227,13,115,249,242,179,230,216,177,41,181,249,21,218,124,156,240,17,188,41,116,245,
+66,195,149,36,64,209,61,160,107,239,240,179,159,253,60,54,1,108,126,247,187,223,75,178,60,35,207,166,195,106,243,117,18,221,6,183,245,36,64,109,189,129,3,7,14,245,8,198,134,190,191,175,81,247,157,239,
+124,55,81,2,216,188,246,218,175,205,231,62,247,247,102,207,158,189,106,243,43,20,30,238,190,251,158,0,198,4,92,221,208,178,150,4,152,112,15,196,174,29,190,134,29,53,186,218,4,176,249,217,207,126,102,
+254,246,111,63,105,118,236,24,80,155,175,81,248,8,30,209,158,4,152,168,58,1,164,182,23,168,241,54,172,93,139,107,208,81,147,159,121,230,31,205,239,127,255,135,21,37,195,139,47,190,100,62,242,145,143,
+6,139,73,212,230,147,11,31,193,35,218,213,13,45,171,78,0,177,146,37,236,196,134,29,54,147,180,230,143,29,155,54,223,248,198,179,230,127,254,231,127,86,148,12,223,255,254,188,121,236,177,39,130,243,
+170,205,199,139,30,113,215,93,239,12,244,112,117,67,203,106,197,239,242,28,228,109,214,95,169,53,127,223,125,15,6,93,65,186,132,43,73,4,120,254,249,111,155,83,167,206,4,215,208,233,54,239,19,62,130,
+159,247,105,135,166,137,19,64,250,250,89,250,251,54,236,211,183,146,110,28,99,5,143,63,62,107,230,231,255,101,69,137,64,183,242,235,95,191,108,142,28,57,218,177,54,239,19,222,134,53,4,174,126,104,90,
+77,2,228,220,3,208,184,168,215,160,13,109,137,39,159,124,202,188,244,210,143,87,148,12,116,43,191,252,229,175,72,35,103,180,163,108,190,18,188,166,247,36,64,242,181,132,195,195,7,102,25,85,178,65,180,
+70,244,221,183,111,223,105,254,230,111,62,145,120,44,33,14,30,51,157,98,243,62,238,188,179,231,58,52,4,93,253,208,52,113,2,228,114,251,243,108,179,110,195,248,127,163,7,109,134,134,134,131,177,129,95,
+255,250,215,53,37,193,83,79,125,172,99,108,222,39,124,4,111,106,93,253,208,180,154,4,152,119,15,192,22,236,205,28,155,31,25,57,100,242,249,175,72,183,242,247,85,184,192,119,58,198,230,125,194,71,208,
+78,243,36,64,242,221,69,246,236,217,183,200,206,85,54,188,109,106,213,216,252,145,35,199,130,134,31,13,192,114,9,240,197,47,126,169,99,108,222,199,250,245,239,8,32,102,174,126,104,90,77,2,44,187,7,
+224,237,95,171,135,104,121,244,156,60,121,58,232,18,190,189,65,248,59,243,254,247,127,160,99,108,222,39,124,4,215,237,73,128,229,196,9,48,52,180,247,42,203,143,108,176,149,52,141,205,179,199,224,197,
+139,143,153,175,125,237,235,230,211,159,254,140,121,248,225,247,119,148,205,251,132,143,224,248,174,126,104,154,56,1,6,7,135,175,241,249,21,155,74,194,235,216,124,107,106,123,28,174,126,104,90,77,2,
+148,220,3,232,43,216,116,11,127,199,29,119,191,5,79,2,148,18,39,192,238,221,185,18,35,127,54,250,10,54,93,54,31,39,124,132,171,31,154,86,147,0,215,124,9,160,54,159,30,155,143,19,30,248,119,79,2,36,
+127,4,236,218,181,231,42,31,55,176,161,13,160,54,159,46,155,119,185,253,246,187,2,56,150,171,31,154,38,78,128,129,129,161,101,94,40,216,208,11,80,155,79,151,205,187,194,71,112,221,174,126,104,90,77,2,
+44,186,7,96,28,224,255,103,239,221,190,227,184,234,188,239,254,3,124,163,75,95,39,145,29,39,113,18,68,46,242,174,102,61,228,224,32,191,177,131,113,34,31,36,203,146,219,103,91,7,203,182,36,159,109,197,
+209,48,10,65,129,60,4,134,211,144,164,97,210,12,102,80,14,240,64,64,28,39,48,104,194,27,102,20,6,86,16,25,152,17,195,234,248,202,183,190,232,122,127,159,122,170,204,206,206,222,213,85,173,62,84,119,
+239,189,214,103,217,203,150,234,240,251,254,234,91,251,92,206,230,211,99,243,38,225,67,136,145,33,1,226,119,4,245,245,13,204,51,253,75,133,158,64,103,243,247,164,238,105,55,193,67,170,235,135,166,73,
+18,32,175,31,128,177,0,103,243,233,21,254,182,219,238,188,1,147,102,12,9,16,127,48,168,183,119,247,52,203,191,84,24,98,116,54,159,30,155,55,9,31,66,47,169,174,31,154,198,78,128,157,59,251,115,236,251,
+163,194,10,84,103,243,233,177,121,147,240,33,60,172,186,126,104,154,36,1,178,250,1,216,10,198,217,124,122,108,222,196,186,117,235,125,88,33,100,72,128,248,83,194,118,236,216,213,193,103,205,116,116,
+235,119,54,223,56,155,55,9,15,252,188,73,59,52,77,52,51,88,126,97,73,63,8,77,65,103,243,233,176,121,93,248,16,226,107,16,127,41,241,186,128,237,219,251,10,76,4,85,161,37,224,108,62,61,79,187,9,30,82,
+93,55,180,76,156,0,219,182,245,142,178,233,128,202,230,205,31,115,54,159,82,225,111,189,245,14,31,166,223,235,186,161,101,37,9,208,165,31,168,167,103,167,179,249,20,216,188,73,248,16,246,110,50,36,64,
+101,95,22,17,193,139,136,174,66,39,131,179,249,198,62,237,38,225,129,248,235,122,161,97,197,251,3,200,47,231,245,3,178,78,207,217,124,99,109,222,6,221,245,134,4,168,124,131,8,177,147,94,44,69,133,54,
+166,179,249,198,218,188,206,218,181,183,251,176,162,90,215,11,13,87,146,0,171,132,146,126,80,134,134,157,205,55,198,230,77,194,3,113,55,136,143,118,149,111,18,69,121,244,209,237,87,232,5,84,225,163,
+134,206,230,27,243,180,235,194,135,176,26,72,215,9,237,86,188,79,224,214,173,219,122,88,108,168,67,75,192,217,124,253,109,222,4,199,55,105,132,118,85,217,45,84,14,84,212,15,78,133,195,217,124,125,109,
+222,196,154,53,183,249,211,245,12,226,87,103,171,88,138,84,252,102,168,252,169,208,41,228,108,190,190,54,175,11,31,194,119,3,116,125,208,172,154,9,208,105,56,129,223,39,224,108,190,62,54,175,139,30,
+18,126,73,204,64,117,63,32,181,101,203,99,5,246,8,80,97,201,184,179,249,245,13,17,62,132,174,95,93,23,180,170,250,23,67,164,141,153,165,157,169,131,11,56,155,175,189,205,219,158,126,147,38,104,85,147,
+239,6,201,129,231,244,147,241,254,113,54,95,159,167,61,164,179,115,157,255,39,51,127,12,226,215,230,163,81,148,71,30,217,154,101,106,152,14,31,142,112,54,95,91,225,17,93,133,154,191,73,11,52,170,233,
+183,3,229,4,121,211,137,233,23,112,54,95,123,225,129,123,179,136,95,219,15,71,82,164,249,215,73,19,80,103,195,134,141,206,230,171,108,243,54,232,131,49,105,128,54,117,249,126,176,188,247,167,120,247,
+235,48,70,224,108,190,186,79,187,202,45,183,220,234,87,252,76,177,71,147,186,126,65,92,78,184,104,186,16,94,5,206,230,171,47,60,112,191,22,241,235,251,249,120,202,195,15,127,180,155,126,0,29,230,13,
+58,155,95,185,205,171,194,135,176,224,195,20,115,180,200,52,162,200,137,103,77,23,68,171,192,217,124,117,68,15,97,131,44,139,248,179,153,70,22,105,139,46,208,30,213,161,153,226,108,126,229,194,3,175,
+85,83,140,137,125,166,209,101,227,198,205,93,66,137,46,73,29,22,146,56,155,175,92,120,160,131,205,20,219,32,230,93,153,52,20,185,144,156,229,34,253,236,117,54,159,76,116,184,249,230,181,190,131,218,
+226,74,204,51,105,42,221,221,155,102,152,41,164,195,36,82,38,142,56,155,95,23,75,244,16,98,66,236,76,49,37,214,153,52,22,185,176,130,233,130,105,25,152,146,192,217,252,251,133,15,197,39,102,22,241,11,
+153,52,23,201,218,121,50,87,71,77,2,103,243,102,225,129,215,36,177,50,197,144,216,102,210,94,228,226,59,132,5,110,194,4,117,2,103,243,102,232,60,179,197,45,136,105,71,166,25,138,92,232,106,225,77,219,
+205,208,58,104,119,155,215,193,29,35,196,39,150,171,51,205,84,54,108,216,184,90,88,96,144,200,4,253,4,237,106,243,42,55,221,180,198,127,32,108,113,10,98,216,92,226,43,73,208,33,204,219,110,142,30,67,
+108,175,157,108,62,20,29,184,31,102,84,69,136,79,236,58,50,205,94,30,124,176,187,64,63,182,13,234,5,237,96,243,161,240,64,7,79,84,76,136,89,166,149,138,220,208,76,212,13,51,148,76,199,71,171,218,124,
+8,215,204,235,175,140,248,51,153,86,44,15,60,240,145,156,80,98,25,147,13,198,187,155,65,248,36,162,67,88,209,139,186,247,32,54,185,76,43,151,251,239,127,168,75,88,96,86,139,13,234,6,172,55,104,118,
+155,15,161,158,195,214,45,81,247,28,196,164,43,211,46,69,110,118,182,76,64,110,76,57,111,54,155,15,9,191,224,85,238,62,137,69,166,29,203,125,247,109,232,22,22,5,47,10,18,1,251,228,213,144,102,155,7,
+126,143,185,145,8,95,238,190,130,123,239,206,180,123,145,32,76,197,8,150,15,117,4,186,75,211,38,60,77,88,90,51,113,239,131,123,206,184,242,215,34,239,253,78,33,207,251,63,14,60,97,236,82,18,38,67,35,
+108,30,209,113,38,174,37,238,117,7,247,216,233,20,183,20,169,44,101,133,57,42,77,113,225,21,65,111,26,245,5,186,150,213,132,168,150,232,252,157,87,16,21,58,92,136,115,38,185,198,224,158,178,78,225,
+100,137,80,72,24,228,27,208,214,198,146,105,77,80,25,35,49,194,58,68,152,24,161,200,252,61,92,110,69,107,131,39,27,103,33,161,56,6,223,75,170,244,58,130,123,112,194,87,90,228,73,235,20,102,132,34,79,
+93,147,80,12,174,217,89,125,149,147,161,71,184,34,148,82,40,122,41,184,182,30,167,84,141,139,84,186,86,9,189,66,94,40,82,9,107,16,197,224,26,184,150,85,78,153,6,149,108,246,195,93,194,168,80,16,150,
+152,67,95,35,150,130,115,112,174,46,23,249,244,38,68,135,144,21,114,194,180,144,23,230,133,69,97,89,184,38,92,23,74,1,215,131,127,91,14,126,102,62,248,157,233,224,24,28,171,195,69,214,21,87,92,113,
+197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,37,53,101,106,106,186,67,200,10,57,97,90,200,11,243,194,162,176,44,92,19,174,11,165,128,235,193,191,45,7,63,51,31,252,206,116,112,
+12,142,229,186,130,83,44,120,151,48,42,20,132,37,193,171,17,75,193,57,56,151,27,12,106,84,185,116,233,137,85,66,175,144,23,138,130,215,32,138,193,53,112,45,110,56,184,214,229,226,197,203,61,194,21,
+161,36,120,41,163,20,92,155,155,16,82,101,209,59,133,25,161,152,66,209,109,20,131,107,118,83,194,42,45,23,46,60,158,21,10,130,87,9,227,227,167,189,163,71,71,189,92,238,128,215,215,55,224,127,71,143,
+29,181,217,95,143,237,86,88,132,25,174,201,227,239,108,196,192,238,91,252,12,159,92,235,237,221,237,237,217,179,223,59,114,100,196,59,121,242,148,87,233,117,4,247,224,38,133,38,20,126,46,73,144,207,
+157,187,228,13,15,143,121,3,3,123,253,47,102,33,102,184,210,182,204,98,204,178,203,182,194,133,28,28,139,207,177,244,247,239,241,134,134,142,249,231,76,152,8,115,46,17,34,202,249,243,83,157,66,94,240,
+226,48,57,121,214,219,191,255,176,255,100,235,203,171,87,42,186,42,124,20,124,156,105,239,222,131,222,196,196,25,47,238,117,7,247,232,94,13,106,145,167,105,138,39,42,14,135,14,13,25,69,175,230,211,
+110,35,106,197,15,201,112,224,192,17,47,238,125,112,207,78,248,115,151,186,133,197,114,193,226,125,190,123,119,206,223,39,47,109,194,131,186,16,132,235,161,206,65,189,33,70,18,112,239,237,185,56,244,
+236,217,139,179,130,23,197,241,227,19,126,101,172,22,162,87,91,120,19,219,182,245,122,99,99,227,94,185,251,36,22,237,36,124,151,176,16,21,16,158,120,158,162,52,62,237,113,132,215,23,141,108,223,222,
+231,59,66,153,36,32,38,173,221,187,120,230,204,133,156,80,18,60,27,131,131,251,252,29,178,210,108,243,113,133,87,225,255,105,65,68,221,123,16,155,214,220,34,230,244,233,243,51,130,103,131,54,59,109,
+240,102,179,249,114,75,198,244,213,68,212,99,14,31,30,246,162,98,65,172,90,77,252,66,212,13,239,218,53,216,244,54,95,78,120,157,29,59,118,149,75,130,230,223,38,238,212,169,115,29,194,188,224,153,24,
+25,57,238,127,237,178,85,108,62,142,240,234,82,51,122,30,233,84,178,197,39,136,93,71,179,138,191,90,88,176,221,220,190,125,135,90,214,230,203,9,175,67,151,115,68,18,16,195,230,218,42,118,114,242,236,
+106,225,77,122,235,76,96,249,237,96,243,229,22,155,178,137,69,8,45,5,91,188,130,88,174,110,22,241,59,132,5,219,205,208,54,110,39,155,47,39,188,10,99,13,17,73,64,76,211,255,58,152,152,56,51,79,223,184,
+14,237,96,6,106,218,213,230,163,132,15,97,43,26,62,5,71,172,76,49,36,182,169,22,127,124,252,116,129,78,28,157,19,39,38,253,202,94,187,219,124,148,240,42,52,21,233,5,53,197,146,24,167,85,252,153,184,
+226,183,179,205,219,68,55,37,1,177,179,36,65,186,250,9,196,178,114,216,150,9,70,201,156,205,199,23,254,222,123,63,116,3,38,175,216,226,74,204,211,34,126,151,80,50,93,36,195,182,206,230,147,11,175,66,
+239,168,37,1,136,121,227,199,14,196,166,22,176,42,157,157,59,251,157,205,87,40,186,10,27,96,242,32,153,98,76,236,27,42,190,84,84,102,169,172,232,48,160,227,108,190,114,225,17,93,135,190,19,83,172,209,
+160,81,226,119,155,46,136,25,59,206,230,171,39,188,10,51,142,44,73,80,255,73,37,99,99,227,139,76,118,208,217,180,105,139,179,249,10,108,62,10,246,38,6,42,211,166,152,163,69,189,197,159,50,93,8,221,
+153,206,230,171,243,180,135,162,235,208,170,178,36,65,125,230,24,30,59,118,178,83,240,116,152,29,235,108,190,118,194,135,176,121,53,117,44,147,6,104,83,243,4,24,29,61,145,23,60,29,218,172,206,230,107,
+43,124,8,113,53,105,128,54,181,22,63,107,58,49,77,62,103,243,213,23,93,23,94,133,166,161,37,9,106,183,248,100,100,228,248,28,147,56,84,152,222,20,190,247,157,205,87,255,105,55,193,151,82,248,57,90,92,
+186,30,104,84,43,241,179,134,147,249,235,232,156,205,215,79,120,21,90,92,38,77,208,170,234,9,48,60,60,86,96,253,157,10,237,82,103,243,181,179,121,155,240,42,204,172,210,117,65,171,170,138,63,52,116,
+172,147,185,107,58,140,239,59,155,175,207,211,110,130,15,86,81,249,54,105,131,102,213,76,128,25,253,4,250,211,239,108,190,62,194,35,186,14,139,100,13,9,80,189,33,227,163,71,71,139,204,219,87,161,22,
+106,18,254,111,255,246,73,239,249,231,95,240,46,93,186,236,108,190,198,194,135,48,98,168,235,131,102,213,18,191,199,112,112,191,91,82,23,255,103,63,251,153,119,245,234,213,27,188,253,246,239,189,103,
+159,253,156,183,101,203,163,206,230,87,96,243,81,240,85,52,174,197,164,17,218,173,56,1,142,28,25,185,194,46,25,42,44,216,212,197,255,248,199,103,222,35,190,206,215,191,254,13,169,176,28,116,54,191,
+194,167,93,21,94,133,201,182,186,78,104,183,34,241,165,141,191,74,40,209,214,87,97,226,162,254,110,255,202,87,158,143,76,128,144,249,249,31,122,167,78,157,113,54,95,225,211,110,131,190,24,93,167,64,
+187,85,43,73,128,94,253,160,52,59,76,149,186,139,23,167,98,37,64,200,191,255,251,191,123,159,248,196,172,191,16,212,217,124,229,194,3,31,184,4,198,99,12,73,208,91,113,2,28,58,52,148,167,183,73,133,17,
+63,91,133,238,165,151,94,78,148,4,240,63,255,243,63,222,115,207,189,32,175,149,126,103,243,21,10,31,194,72,161,174,23,26,174,36,1,138,250,1,105,119,70,213,230,79,156,24,247,190,251,221,239,37,78,4,
+120,245,213,111,123,35,35,199,156,205,39,16,93,133,238,120,67,2,84,214,26,56,120,240,104,151,224,169,208,246,143,91,155,103,75,151,175,126,245,31,188,119,223,125,55,113,34,252,242,151,191,244,30,127,
+124,250,134,27,56,155,143,22,30,238,190,251,30,31,250,4,116,221,208,178,146,4,24,213,15,196,174,29,73,155,113,172,128,125,250,233,79,123,191,249,205,127,36,78,132,63,252,225,15,222,103,63,251,119,254,
+186,2,103,243,209,194,135,240,138,54,36,192,104,226,4,144,167,189,192,19,175,194,218,181,149,52,227,206,158,61,239,253,248,199,63,169,232,245,240,141,111,92,241,155,145,237,110,243,54,225,67,120,69,
+235,186,161,101,226,4,16,43,89,194,78,84,216,97,179,26,109,119,142,117,229,202,55,43,74,132,31,253,232,199,210,140,60,219,214,54,111,227,174,187,62,232,235,161,235,134,150,73,197,239,48,28,228,125,
+214,191,210,182,59,142,242,185,207,125,222,123,231,157,119,18,39,194,91,111,253,198,251,228,39,159,246,155,145,237,102,243,38,225,67,248,121,147,118,104,26,59,1,164,173,159,165,189,175,66,165,174,86,
+157,54,252,27,149,190,95,254,114,33,113,34,20,139,69,239,249,231,243,126,51,178,93,108,222,36,188,10,107,8,116,253,208,52,73,2,228,244,3,80,185,168,71,223,252,240,240,49,191,57,88,201,235,129,206,168,
+118,176,249,114,48,76,111,72,128,248,107,9,247,238,61,56,77,175,146,10,118,93,207,46,218,29,59,250,252,238,101,58,138,226,38,192,31,255,248,199,182,176,121,19,119,222,217,117,3,42,130,186,126,104,26,
+59,1,114,185,3,121,182,89,87,161,255,191,17,125,243,244,113,63,249,228,83,222,191,253,219,191,199,74,130,173,91,123,218,194,230,77,194,135,48,82,171,235,135,166,73,18,96,94,63,0,91,176,55,186,111,126,
+124,252,148,247,131,31,204,91,197,255,239,255,254,111,255,231,218,193,230,77,194,135,80,79,51,36,64,252,221,69,246,236,217,191,200,206,85,42,60,137,105,233,155,31,24,200,121,47,190,248,245,247,37,192,
+229,203,127,211,54,54,111,98,253,250,15,248,16,47,93,63,52,77,146,0,203,250,1,24,253,75,91,223,60,239,58,230,33,124,234,83,207,248,73,209,78,54,111,18,62,132,235,54,36,192,114,236,4,24,28,220,119,141,
+229,71,42,216,138,27,130,77,143,205,155,132,15,225,248,186,126,104,26,59,1,6,6,246,94,231,243,43,42,229,132,119,125,243,141,121,218,109,232,250,161,105,146,4,40,233,7,112,67,176,233,22,254,142,59,238,
+126,15,134,4,40,197,78,128,221,187,115,37,122,254,84,156,205,167,203,230,109,194,135,232,250,161,105,146,4,184,110,74,0,103,243,233,177,121,155,240,192,255,27,18,32,254,43,160,191,127,207,53,62,110,
+160,66,29,192,217,124,186,108,94,231,246,219,239,242,225,88,186,126,104,26,59,1,118,237,26,92,102,64,65,133,86,128,179,249,116,217,188,46,124,8,215,173,235,135,166,73,18,96,81,63,0,253,0,206,230,211,
+99,243,38,225,67,136,145,33,1,226,119,4,245,245,13,204,51,253,75,133,158,64,103,243,247,164,238,105,55,193,67,170,235,135,166,73,18,32,175,31,128,177,0,103,243,233,21,254,182,219,238,188,1,19,119,12,
+9,16,127,48,168,183,119,247,52,203,191,84,232,118,117,54,159,30,155,55,9,31,194,151,88,116,253,208,52,118,2,236,220,217,159,99,223,31,21,86,160,58,155,79,143,205,155,132,15,225,97,213,245,67,211,36,9,
+144,213,15,192,86,48,206,230,211,99,243,38,214,173,91,239,195,10,33,67,2,196,159,18,182,99,199,174,14,62,107,166,163,91,191,179,249,198,217,188,73,120,224,231,77,218,161,105,162,153,193,242,11,75,250,
+65,104,10,58,155,79,135,205,235,194,135,16,95,131,248,75,137,215,5,108,223,222,87,96,34,168,10,45,1,103,243,233,121,218,77,240,144,234,186,161,101,226,4,216,182,173,119,148,77,7,84,54,111,254,152,179,
+249,148,10,127,235,173,119,248,176,20,79,215,13,45,43,73,128,46,253,64,61,61,59,157,205,167,192,230,77,194,135,176,119,147,33,1,42,251,178,136,8,94,68,116,21,58,25,156,205,55,246,105,55,9,15,196,95,
+215,11,13,43,222,31,64,126,57,175,31,144,245,129,206,230,27,107,243,54,232,174,55,36,64,229,27,68,136,157,244,98,41,42,180,49,157,205,55,214,230,117,214,174,189,221,135,101,244,186,94,104,184,146,4,
+88,37,148,244,131,50,52,236,108,190,49,54,111,18,30,136,187,65,124,180,171,124,147,40,202,163,143,110,191,66,47,160,10,31,53,116,54,223,152,167,93,23,62,132,213,64,186,78,104,183,226,125,2,183,110,
+221,214,195,98,67,29,90,2,206,230,235,111,243,38,56,190,73,35,180,171,202,110,161,114,160,162,126,112,42,28,206,230,235,107,243,38,214,172,185,205,159,174,103,16,191,58,91,197,82,164,226,55,67,229,79,
+133,78,33,103,243,245,181,121,93,248,16,190,27,160,235,131,102,213,76,128,78,195,9,252,62,1,103,243,245,177,121,93,244,144,240,75,98,6,170,251,1,169,45,91,30,43,176,71,128,10,75,198,157,205,175,111,
+136,240,33,116,253,234,186,160,85,213,191,24,34,109,204,44,237,76,29,92,192,217,124,237,109,222,246,244,155,52,65,171,154,124,55,72,14,60,167,159,140,247,143,179,249,250,60,237,33,157,157,235,252,63,
+153,249,99,16,191,54,31,141,162,60,242,200,214,44,83,195,116,248,112,132,179,249,218,10,143,232,42,212,252,77,90,160,81,77,191,29,40,39,200,155,78,76,191,128,179,249,218,11,15,220,155,69,252,218,126,
+56,146,34,205,191,78,154,128,58,236,215,231,108,190,186,54,111,131,62,24,147,6,104,83,151,239,7,203,123,127,138,119,191,14,99,4,206,230,171,251,180,171,220,114,203,173,126,197,207,20,123,52,169,235,
+23,196,229,132,139,166,11,225,85,224,108,190,250,194,3,247,107,17,191,190,159,143,167,60,252,240,71,187,233,7,208,97,222,160,179,249,149,219,188,42,124,8,11,62,76,49,71,139,76,35,138,156,120,214,116,
+65,180,10,156,205,87,71,244,16,246,102,180,136,63,155,105,100,145,182,232,2,237,81,29,154,41,206,230,87,46,60,240,90,53,197,152,216,103,26,93,54,110,220,220,37,148,232,146,212,97,33,137,179,249,202,
+133,7,58,216,76,177,13,98,222,149,73,67,145,11,201,89,46,210,207,94,103,243,201,68,135,155,111,94,235,59,168,45,174,196,60,147,166,210,221,189,105,134,153,66,58,76,34,101,226,136,179,249,117,177,68,
+15,33,38,196,206,20,83,98,157,73,99,145,11,43,152,46,152,150,129,41,9,156,205,191,95,248,80,124,98,102,17,191,144,73,115,145,172,157,39,115,117,212,36,112,54,111,22,30,120,77,18,43,83,12,137,109,38,
+237,69,46,190,67,88,224,38,76,80,39,112,54,111,134,206,51,91,220,130,152,118,100,154,161,200,133,174,22,222,180,221,12,173,131,118,183,121,29,220,49,66,124,98,185,58,211,76,101,195,134,141,171,133,5,
+6,137,76,208,79,208,174,54,175,114,211,77,107,252,7,194,22,167,32,134,205,37,190,146,4,29,194,188,237,230,232,49,196,246,218,201,230,67,209,129,251,97,70,85,132,248,196,174,35,211,236,229,193,7,187,
+11,244,99,219,160,94,208,14,54,31,10,15,116,240,68,197,132,152,101,90,169,200,13,205,68,221,48,67,201,116,124,180,170,205,135,112,205,188,254,202,136,63,147,105,197,242,192,3,31,201,9,37,150,49,217,
+96,188,187,25,132,79,34,58,132,21,189,168,123,15,98,147,203,180,114,185,255,254,135,186,132,5,102,181,216,160,110,192,122,131,102,183,249,16,234,57,108,221,18,117,207,65,76,186,50,237,82,228,102,103,
+203,4,228,198,148,243,102,179,249,144,240,11,94,229,238,147,88,100,218,177,220,119,223,134,110,97,81,240,162,32,17,176,79,94,13,105,182,121,224,247,152,27,137,240,229,238,43,184,247,238,76,187,23,9,
+194,84,140,96,249,80,71,160,187,52,109,194,211,132,165,53,19,247,62,184,231,140,43,127,45,242,222,239,20,242,188,255,227,192,19,198,46,37,97,50,52,194,230,17,29,103,226,90,226,94,119,112,143,157,78,
+113,75,145,202,82,86,152,163,210,20,23,94,17,244,166,81,95,160,107,89,77,136,106,137,206,223,121,5,81,161,195,133,56,103,146,107,12,238,41,235,20,78,150,8,133,132,65,190,1,109,109,44,153,214,4,149,49,
+18,35,172,67,132,137,17,138,204,223,195,229,86,180,54,120,178,113,22,18,138,99,240,189,164,74,175,35,184,7,39,124,165,69,158,180,78,97,70,40,242,212,53,9,197,224,154,157,213,87,57,25,122,132,43,66,41,
+133,162,151,130,107,235,113,74,213,184,72,165,107,149,208,43,228,133,34,149,176,6,81,12,174,129,107,89,229,148,105,80,201,102,63,220,37,140,10,5,97,137,57,244,53,98,41,56,7,231,234,114,145,79,111,66,
+116,8,89,33,39,76,11,121,97,94,88,20,150,133,107,194,117,161,20,112,61,248,183,229,224,103,230,131,223,153,14,142,193,177,58,92,100,93,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,
+92,113,197,21,87,82,83,166,166,166,59,132,172,144,19,166,133,188,48,47,44,10,203,194,53,225,186,80,10,184,30,252,219,114,240,51,243,193,239,76,7,199,224,88,174,43,56,197,130,119,9,163,66,65,88,18,188,
+26,177,20,156,131,115,185,193,160,70,149,75,151,158,88,37,244,10,121,161,40,120,13,162,24,92,3,215,226,134,131,107,93,46,94,188,220,35,92,17,74,130,151,50,74,193,181,185,9,33,85,22,189,83,152,17,138,
+41,20,221,70,49,184,102,55,37,172,210,114,225,194,227,89,161,32,120,149,48,62,126,218,59,122,116,212,203,229,14,120,125,125,3,254,119,244,216,81,155,253,245,216,110,133,69,152,225,154,60,254,206,70,
+12,236,190,197,207,240,201,181,222,222,221,222,158,61,251,189,35,71,70,188,147,39,79,121,149,94,71,112,15,110,82,104,66,225,231,146,4,249,220,185,75,222,240,240,152,55,48,176,215,255,98,22,98,134,43,
+109,203,44,198,44,187,108,43,92,200,193,177,248,28,75,127,255,30,111,104,232,152,127,206,132,137,48,231,18,33,162,156,63,63,213,41,228,5,47,14,147,147,103,189,253,251,15,251,79,182,190,188,122,165,
+162,171,194,71,193,199,153,246,238,61,232,77,76,156,241,226,94,119,112,143,238,213,160,22,121,154,166,120,162,226,112,232,208,144,81,244,106,62,237,54,162,86,252,144,12,7,14,28,241,226,222,7,247,236,
+132,63,119,169,91,88,44,23,44,222,231,187,119,231,252,125,242,210,38,60,168,11,65,184,30,234,28,212,27,98,36,1,247,222,158,139,67,207,158,189,56,43,120,81,28,63,62,225,87,198,106,33,122,181,133,55,
+177,109,91,175,55,54,54,238,149,187,79,98,209,78,194,119,9,11,81,1,225,137,231,41,74,227,211,30,71,120,125,209,200,246,237,125,190,35,148,73,2,98,210,218,189,139,103,206,92,200,9,37,193,179,49,56,184,
+207,223,33,43,205,54,31,87,120,21,254,159,22,68,212,189,7,177,105,205,45,98,78,159,62,63,35,120,54,104,179,211,6,111,54,155,47,183,100,76,95,77,68,61,230,240,225,97,47,42,22,196,170,213,196,47,68,221,
+240,174,93,131,77,111,243,229,132,215,217,177,99,87,185,36,104,254,109,226,78,157,58,215,33,204,11,158,137,145,145,227,254,215,46,91,197,230,227,8,175,46,53,163,231,145,78,37,91,124,130,216,117,52,
+171,248,171,133,5,219,205,237,219,119,168,101,109,190,156,240,58,116,57,71,36,1,49,108,174,173,98,39,39,207,174,22,222,164,183,206,4,150,223,14,54,95,110,177,41,155,88,132,208,82,176,197,43,136,229,
+234,102,17,191,67,88,176,221,12,109,227,118,178,249,114,194,171,48,214,16,145,4,196,52,253,175,131,137,137,51,243,244,141,235,208,14,102,160,166,93,109,62,74,248,16,182,162,225,83,112,196,202,20,67,
+98,155,106,241,199,199,79,23,232,196,209,57,113,98,210,175,236,181,187,205,71,9,175,66,83,145,94,80,83,44,137,113,90,197,159,137,43,126,59,219,188,77,116,83,18,16,59,75,18,164,171,159,64,44,43,135,
+109,153,96,148,204,217,124,124,225,239,189,247,67,55,96,242,138,45,174,196,60,45,226,119,9,37,211,69,50,108,235,108,62,185,240,42,244,142,90,18,128,152,55,126,236,64,108,106,1,171,210,217,185,179,223,
+217,124,133,162,171,176,1,38,15,146,41,198,196,190,161,226,75,69,101,150,202,138,14,3,58,206,230,43,23,30,209,117,232,59,49,197,26,13,26,37,126,183,233,130,152,177,227,108,190,122,194,171,48,227,200,
+146,4,245,159,84,50,54,54,190,200,100,7,157,77,155,182,56,155,175,192,230,163,96,111,98,160,50,109,138,57,90,212,91,252,41,211,133,208,157,233,108,190,58,79,123,40,186,14,173,42,75,18,212,103,142,225,
+177,99,39,59,5,79,135,217,177,206,230,107,39,124,8,155,87,83,199,50,105,128,54,53,79,128,209,209,19,121,193,211,161,205,234,108,190,182,194,135,16,87,147,6,104,83,107,241,179,166,19,211,228,115,54,95,
+125,209,117,225,85,104,26,90,146,160,118,139,79,70,70,142,207,49,137,67,133,233,77,225,123,223,217,124,245,159,118,19,124,41,133,159,163,197,165,235,129,70,181,18,63,107,56,153,191,142,206,217,124,
+253,132,87,161,197,101,210,4,173,170,158,0,195,195,99,5,214,223,169,208,46,53,9,126,246,236,5,239,165,151,94,241,190,249,205,111,73,237,244,164,179,249,42,11,175,194,204,42,93,23,180,170,170,248,67,
+67,199,58,153,187,166,195,248,190,46,254,211,79,127,218,187,122,245,234,123,248,222,247,94,147,87,197,144,179,249,42,137,30,194,7,171,168,124,155,180,65,179,106,38,192,140,126,2,253,233,15,197,253,
+207,255,252,207,247,37,64,200,220,220,75,254,10,94,103,243,149,11,143,232,58,44,146,53,36,64,245,134,140,143,30,29,45,50,111,95,133,90,168,254,126,239,238,126,216,42,190,202,139,47,126,221,219,190,
+189,215,217,252,10,133,15,97,196,80,215,7,205,170,37,126,143,225,224,126,183,164,233,189,254,250,235,175,199,74,2,248,251,191,127,206,219,188,249,99,206,230,43,20,30,248,42,26,215,98,210,8,237,86,156,
+0,71,142,140,92,97,151,12,21,22,108,218,42,118,236,200,241,214,91,111,197,78,130,191,252,229,47,222,179,207,126,238,198,39,228,157,205,151,23,61,20,94,133,201,182,186,78,104,183,34,241,165,141,191,74,
+40,209,214,87,97,226,98,185,218,252,236,236,167,34,235,3,58,239,188,243,142,247,212,83,179,206,230,19,136,174,66,95,140,174,83,160,221,170,149,36,64,175,126,80,154,29,113,107,243,44,242,252,236,103,
+255,206,127,202,227,38,194,111,126,243,31,222,229,203,127,227,108,62,166,240,192,7,46,129,241,24,67,18,244,86,156,0,135,14,13,229,233,109,82,97,196,47,105,51,238,145,71,62,230,125,229,43,207,199,78,2,
+120,227,141,95,121,103,206,156,115,54,31,67,248,16,70,10,117,189,208,112,37,9,80,212,15,72,187,179,210,78,155,158,158,157,126,11,32,73,34,252,236,103,255,236,119,38,57,155,55,139,174,66,119,188,33,1,
+42,107,13,28,60,120,180,75,240,84,104,251,87,163,237,206,118,47,244,9,36,73,132,215,94,251,190,92,195,145,182,183,121,27,119,223,125,143,15,125,2,186,110,104,89,73,2,140,234,7,98,215,142,106,118,218,
+28,56,112,216,239,37,76,146,8,47,189,244,178,159,64,237,106,243,54,225,67,120,69,27,18,96,52,113,2,200,211,94,224,137,87,97,237,90,45,58,109,70,71,143,123,63,249,201,79,19,37,66,161,240,117,121,165,
+236,104,59,155,183,9,31,194,43,90,215,13,45,19,39,128,88,201,18,118,162,194,14,155,181,236,180,153,156,60,227,45,44,252,107,162,68,160,114,185,105,211,71,219,202,230,109,220,117,215,7,125,61,116,221,
+208,50,169,248,29,134,131,188,207,250,107,213,105,115,233,210,101,111,113,49,126,103,82,177,88,244,59,147,232,154,110,7,155,55,9,31,194,207,155,180,67,211,216,9,32,109,253,44,237,125,21,222,187,245,
+238,155,159,153,249,132,183,180,180,20,59,17,222,124,243,77,127,155,216,86,183,121,147,240,42,172,33,208,245,67,211,36,9,144,211,15,64,229,162,17,125,243,255,235,127,221,239,61,243,204,103,188,63,255,
+249,207,177,146,224,179,159,253,92,203,219,124,57,24,166,55,36,64,252,181,132,123,247,30,156,166,87,73,133,10,96,35,251,230,63,242,145,255,215,251,194,23,190,84,54,1,230,230,94,110,121,155,55,113,231,
+157,93,55,160,34,168,235,135,166,177,19,32,151,59,144,103,80,71,133,254,255,52,244,205,111,217,242,168,151,207,127,205,154,0,159,252,228,211,109,97,243,38,225,67,24,169,213,245,67,211,36,9,48,175,31,
+128,119,107,154,250,230,119,236,232,243,174,92,249,230,123,196,255,193,15,230,219,198,230,77,194,135,80,79,51,36,64,252,221,69,246,236,217,191,200,206,85,42,140,54,165,113,8,182,191,127,208,187,124,
+121,218,59,118,236,120,91,217,188,137,245,235,63,224,67,188,116,253,208,52,73,2,44,235,7,96,244,207,13,193,166,199,230,77,194,135,112,221,134,4,88,142,157,0,131,131,251,174,177,252,72,5,91,113,67,176,
+233,177,121,147,240,33,28,95,215,15,77,99,39,192,192,192,222,235,76,222,84,41,39,188,235,155,111,204,211,110,67,215,15,77,147,36,64,73,63,128,179,249,116,11,127,199,29,119,191,7,67,2,148,98,39,192,
+238,221,185,18,61,127,42,206,230,211,101,243,54,225,67,116,253,208,52,73,2,92,55,37,128,179,249,244,216,188,77,120,224,255,13,9,16,255,21,208,223,191,231,26,31,55,80,161,14,224,108,62,93,54,175,115,
+251,237,119,249,112,44,93,63,52,141,157,0,187,118,13,46,51,160,160,66,43,192,217,124,186,108,94,23,62,132,235,214,245,67,211,36,9,176,168,31,128,126,0,103,243,233,177,121,147,240,33,196,200,144,0,241,
+59,130,250,250,6,230,153,254,165,66,79,160,179,249,123,82,247,180,155,224,33,213,245,67,211,36,9,144,215,15,192,88,128,179,249,244,10,127,219,109,119,222,128,137,59,134,4,136,63,24,212,219,187,123,
+154,229,95,42,12,49,58,155,79,143,205,155,132,15,97,153,157,174,31,154,198,78,128,157,59,251,115,236,251,163,194,10,84,103,243,233,177,121,147,240,33,60,172,186,126,104,154,36,1,178,250,1,216,10,198,
+217,124,122,108,222,196,186,117,235,125,88,33,100,72,128,248,83,194,118,236,216,213,193,103,205,116,116,235,119,54,223,56,155,55,9,15,252,188,73,59,52,77,52,51,88,126,97,73,63,8,77,65,103,243,233,176,
+121,93,248,16,226,107,16,127,41,241,186,128,237,219,251,10,76,4,85,161,37,224,108,62,61,79,187,9,30,82,93,55,180,76,156,0,219,182,245,142,178,233,128,10,187,121,56,155,79,167,240,183,222,122,135,15,
+31,163,212,117,67,203,74,18,160,75,63,16,171,123,157,205,55,222,230,77,194,135,176,119,147,33,1,42,251,178,136,8,94,68,116,21,58,25,156,205,55,246,105,55,9,15,196,95,215,11,13,43,222,31,64,126,57,175,
+31,144,245,129,206,230,27,107,243,54,232,174,55,36,64,229,27,68,136,157,244,98,41,42,180,49,157,205,55,214,230,117,214,174,189,221,135,207,243,233,122,161,225,74,18,96,149,80,210,15,202,208,176,179,
+249,198,216,188,73,120,32,238,6,241,209,174,242,77,162,40,143,62,186,253,10,189,128,42,124,212,208,217,124,99,158,118,93,248,16,86,3,233,58,161,221,138,247,9,220,186,117,91,15,139,13,117,104,9,56,155,
+175,191,205,155,224,248,38,141,208,174,42,187,133,202,129,138,250,193,169,112,56,155,175,175,205,155,88,179,230,54,127,186,158,65,252,234,108,21,75,145,138,223,12,149,63,21,58,133,156,205,215,215,230,
+117,225,67,248,110,128,174,15,154,85,51,1,58,13,39,240,251,4,156,205,215,199,230,117,209,67,194,47,137,25,168,238,7,164,182,108,121,172,192,30,1,42,44,25,119,54,191,190,33,194,135,208,245,171,235,130,
+86,85,255,98,136,180,49,179,180,51,117,112,1,103,243,181,183,121,219,211,111,210,4,173,106,242,221,32,57,240,156,126,50,222,63,206,230,235,243,180,135,116,118,174,243,255,100,230,143,65,252,218,124,
+52,138,242,200,35,91,179,76,13,211,97,119,46,103,243,181,21,30,209,85,168,249,155,180,64,163,154,126,59,80,78,144,55,157,152,126,1,103,243,181,23,30,184,55,139,248,181,253,112,36,69,154,127,157,52,1,
+117,216,26,222,217,124,117,109,222,6,125,48,38,13,208,166,46,223,15,150,247,254,20,239,126,29,198,8,156,205,87,247,105,87,185,229,150,91,253,138,159,41,246,104,82,215,47,136,203,9,23,77,23,194,171,
+192,217,124,245,133,7,238,215,34,126,125,63,31,79,121,248,225,143,118,211,15,160,195,188,65,103,243,43,183,121,85,248,16,22,124,152,98,142,22,153,70,20,57,241,172,233,130,104,21,56,155,175,142,232,33,
+236,205,104,17,127,54,211,200,34,109,209,5,218,163,58,52,83,156,205,175,92,120,224,181,106,138,49,177,207,52,186,108,220,184,185,75,40,209,37,169,195,66,18,103,243,149,11,15,116,176,153,98,27,196,188,
+43,147,134,34,23,146,179,92,164,159,189,206,230,147,137,14,55,223,188,214,119,80,91,92,137,121,38,77,165,187,123,211,12,51,133,116,152,68,202,196,17,103,243,235,98,137,30,66,76,136,157,41,166,196,58,
+147,198,34,23,86,48,93,48,45,3,83,18,56,155,127,191,240,161,248,196,204,34,126,33,147,230,34,89,59,79,230,234,168,73,224,108,222,44,60,240,154,36,86,166,24,18,219,76,218,139,92,124,135,176,192,77,152,
+160,78,224,108,222,12,157,103,182,184,5,49,237,200,52,67,145,11,93,45,188,105,187,25,90,7,237,110,243,58,184,99,132,248,196,114,117,166,153,202,134,13,27,87,11,11,12,18,153,160,159,160,93,109,94,229,
+166,155,214,248,15,132,45,78,65,12,155,75,124,37,9,58,132,121,219,205,209,99,136,237,181,147,205,135,162,3,247,19,126,100,219,2,177,235,200,52,123,121,240,193,238,2,253,216,54,168,23,180,131,205,135,
+194,3,29,60,81,49,33,102,153,86,42,114,67,51,81,55,204,80,50,29,31,173,106,243,33,92,51,175,191,50,226,207,100,90,177,60,240,192,71,114,66,137,101,76,54,24,239,110,6,225,147,136,14,97,69,47,234,222,
+131,216,228,50,173,92,238,191,255,161,46,97,129,89,45,54,168,27,176,222,160,217,109,62,132,122,14,91,183,68,221,115,16,147,174,76,187,20,185,217,217,50,1,185,49,229,188,217,108,62,36,252,130,87,185,
+251,36,22,153,118,44,247,221,183,161,91,88,20,188,40,72,4,236,147,87,67,154,109,30,248,61,230,70,34,124,185,251,10,238,189,59,211,238,69,130,48,21,35,88,62,212,17,232,46,77,155,240,52,97,105,205,196,
+189,15,238,57,227,202,95,139,188,247,59,133,60,239,255,56,240,132,177,75,73,152,12,141,176,121,68,199,153,184,150,184,215,29,220,99,167,83,220,82,164,178,148,21,230,168,52,197,133,87,4,189,105,212,23,
+232,90,86,19,162,90,162,243,119,94,65,84,232,112,33,206,153,228,26,131,123,202,58,133,147,37,66,33,97,144,111,64,91,27,75,166,53,65,101,140,196,8,235,16,97,98,132,34,243,247,112,185,21,173,13,158,108,
+156,133,132,226,24,124,47,169,210,235,8,238,193,9,95,105,145,39,173,83,152,17,138,60,117,77,66,49,184,102,103,245,85,78,134,30,225,138,80,74,161,232,165,224,218,122,156,82,53,46,82,233,90,37,244,10,
+121,161,72,37,172,65,20,131,107,224,90,86,57,101,26,84,178,217,15,119,9,163,66,65,88,98,14,125,141,88,10,206,193,185,186,92,228,211,155,16,29,66,86,200,9,211,66,94,152,23,22,133,101,225,154,112,93,40,
+5,92,15,254,109,57,248,153,249,224,119,166,131,99,112,172,14,23,89,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,149,212,148,169,169,233,14,33,43,228,132,105,33,47,
+204,11,139,194,178,112,77,184,46,148,2,174,7,255,182,28,252,204,124,240,59,211,193,49,56,150,235,10,78,177,224,93,194,168,80,16,150,4,175,70,44,5,231,224,92,110,48,168,81,229,210,165,39,86,9,189,66,
+94,40,10,94,131,40,6,215,192,181,184,225,224,90,151,139,23,47,247,8,87,132,146,224,165,140,82,112,109,110,66,72,149,69,239,20,102,132,98,10,69,183,81,12,174,217,77,9,171,180,92,184,240,120,86,40,8,94,
+37,140,143,159,246,142,30,29,245,114,185,3,94,95,223,128,255,29,61,118,212,102,127,61,182,91,97,17,102,184,38,143,191,179,17,3,187,111,241,51,124,114,173,183,119,183,183,103,207,126,239,200,145,17,
+239,228,201,83,94,165,215,17,220,131,155,20,154,80,248,185,36,65,62,119,238,146,55,60,60,230,13,12,236,245,191,152,133,152,225,74,219,50,139,49,203,46,219,10,23,114,112,44,62,199,210,223,191,199,27,
+26,58,230,159,51,97,34,204,185,68,136,40,231,207,79,117,10,121,193,139,195,228,228,89,111,255,254,195,254,147,173,47,175,94,169,232,170,240,81,240,113,166,189,123,15,122,19,19,103,188,184,215,29,220,
+163,123,53,168,69,158,166,41,158,168,56,28,58,52,100,20,189,154,79,187,141,168,21,63,36,195,129,3,71,188,184,247,193,61,59,225,207,93,234,22,22,203,5,139,247,249,238,221,57,127,159,188,180,9,15,234,
+66,16,174,135,58,7,245,134,24,73,192,189,183,231,226,208,179,103,47,206,10,94,20,199,143,79,248,149,177,90,136,94,109,225,77,108,219,214,235,141,141,141,123,229,238,147,88,180,147,240,93,194,66,84,64,
+120,226,121,138,210,248,180,199,17,94,95,52,178,125,123,159,239,8,101,146,128,152,180,118,239,226,153,51,23,114,66,73,240,108,12,14,238,243,119,200,74,179,205,199,21,94,133,255,167,5,17,117,239,65,
+108,90,115,139,152,211,167,207,207,8,158,13,218,236,180,193,155,205,230,203,45,25,211,87,19,81,143,57,124,120,216,139,138,5,177,106,53,241,11,81,55,188,107,215,96,211,219,124,57,225,117,118,236,216,
+85,46,9,154,127,155,184,83,167,206,117,8,243,130,103,98,100,228,184,255,181,203,86,177,249,56,194,171,75,205,232,121,164,83,201,22,159,32,118,29,205,42,254,106,97,193,118,115,251,246,29,106,89,155,47,
+39,188,14,93,206,17,73,64,12,155,107,171,216,201,201,179,171,133,55,233,173,51,129,229,183,131,205,151,91,108,202,38,22,33,180,20,108,241,10,98,185,186,89,196,239,16,22,108,55,67,219,184,157,108,190,
+156,240,42,140,53,68,36,1,49,77,255,235,96,98,226,204,60,125,227,58,180,131,25,168,105,87,155,143,18,62,132,173,104,248,20,28,177,50,197,144,216,166,90,252,241,241,211,5,58,113,116,78,156,152,244,43,
+123,237,110,243,81,194,171,208,84,164,23,212,20,75,98,156,86,241,103,226,138,223,206,54,111,19,221,148,4,196,206,146,4,233,234,39,16,203,202,97,91,38,24,37,115,54,31,95,248,123,239,253,208,13,152,188,
+98,139,43,49,79,139,248,93,66,201,116,145,12,219,58,155,79,46,188,10,189,163,150,4,32,230,141,31,59,16,155,90,192,170,116,118,238,236,119,54,95,161,232,42,108,128,201,131,100,138,49,177,111,168,248,
+82,81,153,165,178,162,195,128,142,179,249,202,133,71,116,29,250,78,76,177,70,131,70,137,223,109,186,32,102,236,56,155,175,158,240,42,204,56,178,36,65,253,39,149,140,141,141,47,50,217,65,103,211,166,
+45,206,230,43,176,249,40,216,155,24,168,76,155,98,142,22,245,22,127,202,116,33,116,103,58,155,175,206,211,30,138,174,67,171,202,146,4,245,153,99,120,236,216,201,78,193,211,97,118,172,179,249,218,9,31,
+194,230,213,212,177,76,26,160,77,205,19,96,116,244,68,94,240,116,104,179,58,155,175,173,240,33,196,213,164,1,218,212,90,252,172,233,196,52,249,76,194,127,234,83,207,120,223,253,238,247,188,175,126,
+245,31,164,22,59,224,108,62,161,232,186,240,42,52,13,45,73,80,187,197,39,35,35,199,231,152,196,161,194,244,166,240,189,175,10,252,234,171,223,246,174,94,189,250,30,158,121,230,51,206,230,19,62,237,38,
+248,82,10,63,71,139,75,215,3,141,106,37,126,214,112,50,127,29,157,110,235,7,14,28,126,159,248,33,191,248,197,191,120,67,67,163,206,230,43,20,94,133,22,151,73,19,180,170,122,2,12,15,143,21,88,127,167,
+66,187,212,244,94,31,31,63,101,77,128,144,23,94,248,170,247,208,67,27,157,205,87,32,188,10,51,171,116,93,208,170,170,226,15,13,29,235,100,238,154,14,227,251,166,4,216,178,229,209,178,9,0,191,251,221,
+239,188,115,231,46,58,155,79,40,122,8,31,172,162,242,109,210,6,205,170,153,0,51,250,9,244,167,95,183,244,203,151,167,99,37,1,188,252,242,171,254,76,33,103,243,255,79,44,209,117,88,36,107,72,128,234,
+13,25,31,61,58,90,100,222,190,10,181,208,114,181,249,222,222,126,239,219,223,254,78,172,36,40,22,139,222,83,79,205,58,155,79,32,124,8,35,134,186,62,104,86,45,241,123,12,7,247,187,37,227,214,230,47,92,
+152,242,222,126,251,247,177,18,225,103,63,251,103,191,18,233,108,190,188,240,192,87,209,184,22,147,70,104,183,226,4,56,114,100,228,10,187,100,168,176,96,51,105,51,142,25,46,244,7,196,125,45,124,249,
+203,95,241,29,198,217,188,93,120,21,94,161,186,78,104,183,34,241,165,141,191,74,40,209,214,87,97,226,98,165,77,184,225,225,99,222,47,127,185,16,43,9,222,122,235,45,111,114,242,180,179,121,139,232,42,
+244,197,232,58,5,218,173,90,73,2,244,234,7,165,217,81,141,182,251,255,254,223,207,198,118,131,111,126,243,91,126,203,162,157,109,62,10,62,112,9,140,199,24,146,160,183,226,4,56,116,104,40,79,111,147,
+10,35,126,213,234,180,233,235,219,237,119,21,199,73,130,63,255,249,207,222,199,63,62,211,214,54,111,19,62,132,145,66,93,47,52,92,73,2,20,245,3,210,238,172,118,167,205,212,212,101,239,157,119,222,137,
+149,8,63,252,225,143,188,193,193,189,109,105,243,38,209,85,232,142,55,36,64,101,173,129,131,7,143,118,9,158,10,109,255,90,117,218,176,80,242,197,23,11,177,95,11,127,247,119,95,104,75,155,183,113,247,
+221,247,248,208,39,160,235,134,150,149,36,192,168,126,32,118,237,168,117,111,221,232,232,113,239,87,191,250,255,98,37,193,155,111,254,218,27,27,59,209,86,54,111,19,62,132,87,180,33,1,70,19,39,128,60,
+237,5,158,120,21,214,174,213,171,183,238,217,103,63,23,219,13,190,254,245,127,244,95,77,237,96,243,54,225,67,136,131,174,27,90,38,78,0,177,146,37,236,68,133,29,54,235,217,55,207,150,42,63,248,193,124,
+172,36,248,211,159,254,36,117,137,39,218,194,230,109,220,117,215,7,125,61,116,221,208,50,169,248,29,134,131,188,207,250,235,213,69,123,249,242,223,120,255,245,95,255,21,43,17,94,120,33,223,242,54,111,
+18,62,132,159,55,105,135,166,177,19,64,218,250,89,218,251,42,236,211,215,200,190,121,58,159,254,241,31,191,17,43,9,30,123,108,123,75,219,188,73,120,21,214,16,232,250,161,105,146,4,200,233,7,160,114,
+145,134,190,249,177,177,147,222,175,127,253,111,145,9,112,248,240,80,75,219,124,57,24,166,55,36,64,252,181,132,123,247,30,156,166,87,73,133,10,96,90,134,96,249,55,154,129,182,4,160,174,210,202,54,111,
+226,206,59,187,110,64,69,80,215,15,77,99,39,64,46,119,32,207,54,235,42,88,112,218,134,96,7,6,114,222,143,126,244,227,247,136,255,196,19,31,111,11,155,55,9,31,194,72,173,174,31,154,38,73,128,121,253,0,
+108,193,158,214,33,216,35,71,134,189,51,103,206,137,245,245,180,141,205,155,132,15,161,158,102,72,128,248,187,139,236,217,179,127,145,157,171,84,24,109,114,67,176,233,177,121,19,235,215,127,192,135,
+120,233,250,161,105,146,4,88,214,15,192,232,159,27,130,77,143,205,155,132,15,225,186,13,9,176,28,59,1,6,7,247,93,99,249,145,10,182,226,134,96,211,99,243,38,225,67,56,190,174,31,154,198,78,128,129,129,
+189,215,249,252,138,74,57,225,157,205,55,230,105,183,161,235,135,166,73,18,160,164,31,192,217,124,186,133,191,227,142,187,223,131,33,1,74,177,19,96,247,238,92,137,158,63,21,103,243,233,178,121,155,
+240,33,186,126,104,154,36,1,174,155,18,192,217,124,122,108,222,38,60,240,255,134,4,136,255,10,232,239,223,115,141,145,56,21,234,0,206,230,211,101,243,58,183,223,126,151,15,199,210,245,67,211,216,9,
+176,107,215,224,50,3,10,42,180,2,156,205,167,203,230,117,225,67,184,110,93,63,52,77,146,0,139,250,1,232,7,112,54,159,30,155,55,9,31,66,140,12,9,16,191,35,168,175,111,96,158,233,95,42,244,4,58,155,191,
+39,117,79,187,9,30,82,93,63,52,77,146,0,121,253,0,140,5,56,155,79,175,240,183,221,118,231,13,152,184,99,72,128,248,131,65,189,189,187,167,89,254,165,194,16,163,179,249,244,216,188,73,248,16,190,196,
+162,235,135,166,177,19,96,231,206,254,28,251,254,168,176,2,213,217,124,122,108,222,36,124,8,15,171,174,31,154,38,73,128,172,126,0,182,130,113,54,159,30,155,55,177,110,221,122,31,86,8,25,18,32,254,148,
+176,29,59,118,117,240,89,51,29,221,250,157,205,55,206,230,77,194,3,63,111,210,14,77,19,205,12,150,95,88,210,15,66,83,208,217,124,58,108,94,23,62,132,248,26,196,95,74,188,46,96,251,246,190,2,19,65,85,
+104,9,56,155,79,207,211,110,130,135,84,215,13,45,19,39,192,182,109,189,163,108,58,160,178,121,243,199,156,205,167,84,248,91,111,189,195,135,53,150,186,110,104,89,73,2,116,233,7,234,233,217,233,108,62,
+5,54,111,18,62,132,189,155,12,9,80,217,151,69,68,240,34,162,171,208,201,224,108,190,177,79,187,73,120,32,254,186,94,104,88,241,254,0,242,203,121,253,128,204,185,119,54,223,88,155,183,65,119,189,33,1,
+42,223,32,66,236,164,23,75,81,161,141,233,108,190,177,54,175,179,118,237,237,62,124,158,79,215,11,13,87,146,0,171,132,146,126,80,134,134,157,205,55,198,230,77,194,3,113,55,136,143,118,149,111,18,69,
+121,244,209,237,87,232,5,84,97,203,55,103,243,141,121,218,117,225,67,88,13,164,235,132,118,43,222,39,112,235,214,109,61,44,54,212,161,37,224,108,190,254,54,111,130,227,155,52,66,187,170,236,22,42,7,
+42,234,7,167,194,225,108,190,190,54,111,98,205,154,219,252,233,122,6,241,171,179,85,44,69,42,126,51,84,254,84,232,20,114,54,95,95,155,215,133,15,225,187,1,186,62,104,86,205,4,232,52,156,192,239,19,
+112,54,95,31,155,215,69,15,9,191,36,102,160,186,31,144,218,178,229,177,2,123,4,168,176,100,220,217,252,250,134,8,31,66,215,175,174,11,90,85,253,139,33,210,198,204,210,206,212,193,5,156,205,215,222,
+230,109,79,191,73,19,180,170,201,119,131,228,192,115,250,201,120,255,56,155,175,207,211,30,210,217,185,206,255,147,153,63,6,241,107,243,209,40,202,35,143,108,205,50,53,76,135,109,221,157,205,215,86,
+120,68,87,161,230,111,210,2,141,106,250,237,64,57,65,222,116,98,250,5,156,205,215,94,120,224,222,44,226,215,246,195,145,20,105,254,117,210,4,212,217,176,97,163,179,249,42,219,188,13,250,96,76,26,160,
+77,93,190,31,44,239,253,41,222,253,58,140,17,56,155,175,238,211,174,114,203,45,183,250,21,63,83,236,209,164,174,95,16,151,19,46,154,46,132,87,129,179,249,234,11,15,220,175,69,252,250,126,62,158,242,
+240,195,31,237,166,31,64,135,121,131,206,230,87,110,243,170,240,33,44,248,48,197,28,45,50,141,40,114,226,89,211,5,209,42,112,54,95,29,209,67,216,155,209,34,254,108,166,145,69,218,162,11,180,71,117,
+104,166,56,155,95,185,240,192,107,213,20,99,98,159,105,116,217,184,113,115,151,80,162,75,82,135,133,36,206,230,43,23,30,232,96,51,197,54,136,121,87,38,13,69,46,36,103,185,72,63,123,157,205,39,19,29,
+110,190,121,173,239,160,182,184,18,243,76,154,74,119,247,166,25,102,10,233,48,137,148,137,35,206,230,215,197,18,61,132,152,16,59,83,76,137,117,38,141,69,46,172,96,186,96,90,6,166,36,112,54,255,126,
+225,67,241,137,153,69,252,66,38,205,69,178,118,158,204,213,81,147,192,217,188,89,120,224,53,73,172,76,49,36,182,153,180,23,185,248,14,97,129,155,48,65,157,192,217,188,25,58,207,108,113,11,98,218,145,
+105,134,34,23,186,90,120,211,118,51,180,14,218,221,230,117,112,199,8,241,137,229,234,76,51,149,13,27,54,174,22,22,24,36,50,65,63,65,187,218,188,202,77,55,173,241,31,8,91,156,130,24,54,151,248,74,18,
+116,8,243,182,155,163,199,16,219,107,39,155,15,69,7,238,135,25,85,17,226,19,187,142,76,179,151,7,31,236,46,208,143,109,131,122,65,59,216,124,40,60,208,193,19,21,19,98,150,105,165,34,55,52,19,117,195,
+12,37,211,241,209,170,54,31,194,53,243,250,43,35,254,76,166,21,203,3,15,124,36,39,148,88,198,100,131,241,238,102,16,62,137,232,16,86,244,162,238,61,136,77,46,211,202,229,254,251,31,234,18,22,152,213,
+98,131,186,1,235,13,154,221,230,67,168,231,176,117,75,212,61,7,49,233,202,180,75,145,155,157,45,19,144,27,83,206,155,205,230,67,194,47,120,149,187,79,98,145,105,199,114,223,125,27,186,133,69,193,139,
+130,68,192,62,121,53,164,217,230,129,223,99,110,36,194,151,187,175,224,222,187,51,237,94,36,8,83,49,130,229,67,29,129,238,210,180,9,79,19,150,214,76,220,251,224,158,51,174,252,181,200,123,191,83,200,
+243,254,143,3,79,24,187,148,132,201,208,8,155,71,116,156,137,107,137,123,221,193,61,118,58,197,45,69,42,75,89,97,142,74,83,92,120,69,208,155,70,125,129,174,101,53,33,170,37,58,127,231,21,68,133,14,23,
+226,156,73,174,49,184,167,172,83,56,89,34,20,18,6,249,6,180,181,177,100,90,19,84,198,72,140,176,14,17,38,70,40,50,127,15,151,91,209,218,224,201,198,89,72,40,142,193,247,146,42,189,142,224,30,156,240,
+149,22,121,210,58,133,25,161,200,83,215,36,20,131,107,118,86,95,229,100,232,17,174,8,165,20,138,94,10,174,173,199,41,85,227,34,149,174,85,66,175,144,23,138,84,194,26,68,49,184,6,174,101,149,83,166,65,
+37,155,253,112,151,48,42,20,132,37,230,208,215,136,165,224,28,156,171,203,69,62,189,9,209,33,100,133,156,48,45,228,133,121,97,81,88,22,174,9,215,133,82,192,245,224,223,150,131,159,153,15,126,103,58,
+56,6,199,234,112,145,117,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,73,77,153,154,154,238,16,178,66,78,152,22,242,194,188,176,40,44,11,215,132,235,66,41,224,122,
+240,111,203,193,207,204,7,191,51,29,28,131,99,185,174,224,20,11,222,37,140,10,5,97,73,240,106,196,82,112,14,206,229,6,131,26,85,46,93,122,98,149,208,43,228,133,162,224,53,136,98,112,13,92,139,27,14,
+174,117,185,120,241,114,143,112,69,40,9,94,202,40,5,215,230,38,132,84,89,244,78,97,70,40,166,80,116,27,197,224,154,221,148,176,74,203,133,11,143,103,133,130,224,85,194,248,248,105,239,232,209,81,47,
+151,59,224,245,245,13,248,223,209,99,71,109,246,215,99,187,21,22,97,134,107,242,248,59,27,49,176,251,22,63,195,39,215,122,123,119,123,123,246,236,247,142,28,25,241,78,158,60,229,85,122,29,193,61,184,
+73,161,9,133,159,75,18,228,115,231,46,121,195,195,99,222,192,192,94,255,139,89,136,25,174,180,45,179,24,179,236,178,173,112,33,7,199,226,115,44,253,253,123,188,161,161,99,254,57,19,38,194,156,75,132,
+136,114,254,252,84,167,144,23,188,56,76,78,158,245,246,239,63,236,63,217,250,242,234,149,138,174,10,31,5,31,103,218,187,247,160,55,49,113,198,139,123,221,193,61,186,87,131,90,228,105,154,226,137,138,
+195,161,67,67,70,209,171,249,180,219,136,90,241,67,50,28,56,112,196,139,123,31,220,179,19,254,220,165,110,97,177,92,176,120,159,239,222,157,243,247,201,75,155,240,160,46,4,225,122,168,115,80,111,136,
+145,4,220,123,123,46,14,61,123,246,226,172,224,69,113,252,248,132,95,25,171,133,232,213,22,222,196,182,109,189,222,216,216,184,87,238,62,137,69,59,9,223,37,44,68,5,132,39,158,167,40,141,79,123,28,225,
+245,69,35,219,183,247,249,142,80,38,9,136,73,107,247,46,158,57,115,33,39,148,4,207,198,224,224,62,127,135,172,52,219,124,92,225,85,248,127,90,16,81,247,30,196,166,53,183,136,57,125,250,252,140,224,
+217,160,205,78,27,188,217,108,190,220,146,49,125,53,17,245,152,195,135,135,189,168,88,16,171,86,19,191,16,117,195,187,118,13,54,189,205,151,19,94,103,199,142,93,229,146,160,249,183,137,59,117,234,92,
+135,48,47,120,38,70,70,142,251,95,187,108,21,155,143,35,188,186,212,140,158,71,58,149,108,241,9,98,215,209,172,226,175,22,22,108,55,183,111,223,161,150,181,249,114,194,235,208,229,28,145,4,196,176,
+185,182,138,157,156,60,187,90,120,147,222,58,19,88,126,59,216,124,185,197,166,108,98,17,66,75,193,22,175,32,150,171,155,69,252,14,97,193,118,51,180,141,219,201,230,203,9,175,194,88,67,68,18,16,211,
+244,191,14,38,38,206,204,211,55,174,67,59,152,129,154,118,181,249,40,225,67,216,138,134,79,193,17,43,83,12,137,109,170,197,31,31,63,93,160,19,71,231,196,137,73,191,178,215,238,54,31,37,188,10,77,69,
+122,65,77,177,36,198,105,21,127,38,174,248,237,108,243,54,209,77,73,64,236,44,73,144,174,126,2,177,172,28,182,101,130,81,50,103,243,241,133,191,247,222,15,221,128,201,43,182,184,18,243,180,136,223,37,
+148,76,23,201,176,173,179,249,228,194,171,208,59,106,73,0,98,222,248,177,3,177,169,5,172,74,103,231,206,126,103,243,21,138,174,194,6,152,60,72,166,24,19,251,134,138,47,21,149,89,42,43,58,12,232,56,
+155,175,92,120,68,215,161,239,196,20,107,52,104,148,248,221,166,11,98,198,142,179,249,234,9,175,194,140,35,75,18,212,127,82,201,216,216,248,34,147,29,116,54,109,218,226,108,190,2,155,143,130,189,137,
+129,202,180,41,230,104,81,111,241,167,76,23,66,119,166,73,248,11,23,166,188,23,94,248,170,247,201,79,62,237,207,216,117,54,31,95,116,29,90,85,150,36,168,207,28,195,99,199,78,118,10,158,14,179,99,77,
+79,249,55,190,241,77,239,234,213,171,55,248,245,175,255,205,59,114,100,216,217,124,66,225,67,216,188,154,58,150,73,3,180,169,121,2,140,142,158,200,11,158,14,109,86,93,252,67,135,142,190,71,124,149,
+217,217,79,59,155,79,40,124,8,177,53,105,128,54,181,22,63,107,58,49,77,62,211,251,253,194,133,75,214,4,128,151,95,126,213,175,51,56,155,143,39,188,10,77,67,75,18,212,110,241,201,200,200,241,57,38,113,
+168,48,189,41,124,239,235,150,206,74,157,168,4,128,255,248,143,223,138,117,157,112,54,31,67,244,16,190,148,194,207,209,226,210,245,64,163,90,137,159,53,156,204,95,71,23,85,161,251,252,231,191,88,54,9,
+224,51,159,249,172,179,249,24,194,171,224,158,38,77,208,170,234,9,48,60,60,86,96,253,157,10,237,210,56,181,249,179,103,207,123,127,250,211,159,202,38,193,247,190,247,154,183,117,107,143,179,249,50,
+194,171,48,179,74,215,5,173,170,42,254,208,208,177,78,230,174,233,48,190,31,183,54,191,125,123,175,55,63,255,195,178,73,240,135,63,252,193,155,152,56,229,108,62,66,244,16,62,88,69,229,219,164,13,154,
+85,51,1,102,244,19,232,79,127,220,218,252,223,253,221,23,98,189,18,190,240,133,47,57,155,183,136,174,195,34,89,67,2,84,111,200,248,232,209,209,34,243,246,85,168,133,86,218,118,63,113,98,194,123,251,
+237,223,151,77,130,31,253,232,199,222,142,29,125,109,111,243,54,225,67,24,49,212,245,65,179,106,137,223,99,56,184,223,45,185,146,182,59,23,253,237,111,255,159,178,73,176,188,188,236,157,59,119,161,
+173,109,62,10,190,138,198,181,152,52,66,187,21,39,192,145,35,35,87,216,37,67,133,5,155,213,234,180,249,244,167,255,119,172,87,194,243,207,191,208,214,54,111,18,94,133,201,182,186,78,104,183,34,241,
+165,141,191,74,40,209,214,87,97,226,98,53,59,109,134,134,70,189,197,197,183,202,38,193,235,175,255,220,235,239,31,108,75,155,55,137,174,66,95,140,174,83,160,221,170,149,36,64,175,126,80,154,29,181,
+232,180,97,144,232,159,254,105,174,108,18,188,251,238,187,222,227,143,63,209,118,54,31,5,31,184,4,198,99,12,73,208,91,113,2,28,58,52,148,167,183,73,133,17,191,90,246,214,61,249,228,83,177,94,9,47,190,
+88,240,143,213,78,54,111,19,62,132,145,66,93,47,52,92,73,2,20,245,3,210,238,172,117,223,252,190,125,7,189,55,222,248,85,217,36,224,103,246,238,61,208,54,54,111,18,93,229,255,14,192,189,47,1,42,107,13,
+28,60,120,180,75,240,84,104,251,215,171,139,150,87,204,139,47,126,61,150,27,124,252,227,79,182,141,205,219,184,251,238,123,124,232,19,208,117,67,203,74,18,96,84,63,16,187,118,212,187,111,158,247,125,
+156,36,248,230,55,255,201,111,154,182,186,205,219,132,15,225,21,109,72,128,209,196,9,32,79,123,129,39,94,133,181,107,141,232,155,223,181,107,192,111,1,148,75,130,197,197,69,127,14,66,43,219,188,77,
+248,16,94,209,186,110,104,153,56,1,196,74,150,176,19,21,118,216,108,100,223,252,115,207,61,31,203,13,198,199,79,181,180,205,219,184,235,174,15,250,122,232,186,161,101,82,241,59,12,7,121,159,245,55,
+162,139,246,204,153,243,126,239,96,84,2,44,44,44,180,180,205,155,132,15,225,231,77,218,161,105,236,4,144,182,126,150,246,190,10,251,244,165,101,80,230,177,199,182,123,63,252,225,143,34,187,143,91,217,
+230,77,194,171,176,134,64,215,15,77,147,36,64,78,63,0,149,139,180,13,193,218,70,22,95,123,237,251,45,109,243,229,96,152,222,144,0,241,215,18,238,221,123,112,154,94,37,21,42,128,105,28,130,61,113,98,
+220,159,67,16,138,255,155,223,252,135,215,219,219,223,210,54,111,226,206,59,187,110,64,69,80,215,15,77,99,39,64,46,119,32,207,54,235,42,244,255,167,117,8,150,97,233,241,241,73,63,25,56,119,59,216,188,
+73,248,16,154,195,186,126,104,154,36,1,230,245,3,208,87,239,134,96,211,99,243,38,225,67,168,167,25,18,32,254,238,34,123,246,236,95,100,231,42,21,70,155,220,16,108,122,108,222,196,250,245,31,240,33,94,
+186,126,104,154,36,1,150,245,3,208,53,235,134,96,211,99,243,38,225,67,184,110,67,2,44,199,78,128,193,193,125,215,88,126,164,130,173,56,155,79,143,205,155,132,15,225,248,186,126,104,26,59,1,6,6,246,94,
+103,81,135,74,57,225,157,205,55,230,105,183,161,235,135,166,73,18,160,164,31,192,217,124,186,133,191,227,142,187,223,131,33,1,74,177,19,96,247,238,92,137,158,63,21,103,243,233,178,121,155,240,33,186,
+126,104,154,36,1,174,155,18,192,217,124,122,108,222,38,60,240,255,134,4,136,255,10,232,239,223,115,141,143,27,168,80,7,112,54,159,46,155,215,185,253,246,187,124,56,150,174,31,154,198,78,128,93,187,6,
+151,25,80,80,161,21,224,108,62,93,54,175,11,31,194,117,235,250,161,105,146,4,88,212,15,64,63,128,179,249,244,216,188,73,248,16,98,100,72,128,248,29,65,125,125,3,243,76,255,82,161,39,208,217,252,61,
+169,123,218,77,240,144,234,250,161,105,146,4,200,235,7,96,44,192,217,124,122,133,191,237,182,59,111,192,196,29,67,2,196,31,12,234,237,221,61,205,242,47,21,134,24,157,205,167,199,230,77,194,135,240,37,
+22,93,63,52,141,157,0,59,119,246,231,216,247,71,133,197,156,206,230,211,99,243,38,225,67,120,88,117,253,208,52,73,2,100,245,3,176,21,140,179,249,244,216,188,137,117,235,214,251,176,66,200,144,0,241,
+167,132,237,216,177,171,131,207,154,233,232,214,239,108,190,113,54,111,18,30,248,121,147,118,104,154,104,102,176,252,194,146,126,16,154,130,206,230,211,97,243,186,240,33,196,215,32,254,82,226,117,1,
+219,183,247,21,152,8,170,66,75,192,217,124,122,158,118,19,255,119,63,166,62,157,228,11,67,182,109,235,29,101,211,1,149,205,155,63,230,108,62,165,194,223,122,235,29,62,124,140,82,215,13,45,43,73,128,
+46,253,64,61,61,59,157,205,167,192,230,77,194,135,176,119,147,33,1,42,251,178,136,8,94,68,116,21,58,25,156,205,55,246,105,55,9,15,196,95,215,11,13,43,222,31,64,126,57,175,31,144,245,129,206,230,27,
+107,243,54,232,174,55,36,64,229,27,68,136,157,244,98,41,42,180,49,157,205,55,214,230,117,214,174,189,221,135,207,243,233,122,161,225,74,18,96,149,80,210,15,202,208,176,179,249,198,216,188,73,120,32,
+238,6,241,209,174,242,77,162,40,143,62,186,253,10,189,128,42,124,212,208,217,124,99,158,118,93,248,16,86,3,233,58,161,221,138,247,9,220,186,117,91,15,139,13,117,104,9,56,155,175,191,205,155,224,248,
+38,141,208,174,42,187,133,202,129,138,250,193,169,112,56,155,175,175,205,155,88,179,230,54,127,186,158,65,252,234,108,21,75,145,138,223,12,149,63,21,58,133,156,205,215,215,230,117,225,67,248,110,128,
+174,15,154,85,51,1,58,13,39,240,251,4,156,205,215,199,230,117,209,67,194,47,137,25,168,238,7,164,182,108,121,172,192,30,1,42,44,25,119,54,191,190,33,194,135,208,245,171,235,130,86,85,255,98,136,180,
+49,179,180,51,117,112,1,103,243,181,183,121,219,211,111,210,4,173,106,242,221,32,57,240,156,126,50,222,63,206,230,235,243,180,135,116,118,174,243,255,100,230,143,65,252,218,124,52,138,242,200,35,91,
+179,76,13,211,97,135,14,103,243,181,21,30,209,85,168,249,155,180,64,163,154,126,59,80,78,144,55,157,152,126,1,103,243,181,23,30,184,55,139,248,181,253,112,36,69,154,127,157,52,1,117,54,108,216,232,
+108,190,202,54,111,131,62,24,147,6,104,83,151,239,7,203,123,127,138,119,191,14,99,4,206,230,171,251,180,171,220,114,203,173,126,197,207,20,123,52,169,235,23,196,229,132,139,166,11,225,85,224,108,190,
+250,194,3,247,107,17,191,190,159,143,167,60,252,240,71,187,233,7,208,97,222,160,179,249,149,219,188,42,124,8,11,62,76,49,71,139,76,35,138,156,120,214,116,65,180,10,156,205,87,71,244,16,246,102,180,
+136,63,155,105,100,145,182,232,2,237,81,29,154,41,206,230,87,46,60,240,90,53,197,152,216,103,26,93,54,110,220,220,37,148,232,146,212,97,33,137,179,249,202,133,7,58,216,76,177,13,98,222,149,73,67,145,
+11,201,89,46,210,207,94,103,243,201,68,135,155,111,94,235,59,168,45,174,196,60,147,166,210,221,189,105,134,153,66,58,76,34,101,226,136,179,249,117,177,68,15,33,38,196,206,20,83,98,157,73,99,145,11,43,
+152,46,152,150,129,41,9,156,205,191,95,248,80,124,98,102,17,191,144,73,115,145,172,157,39,115,117,212,36,112,54,111,22,30,120,77,18,43,83,12,137,109,38,237,69,46,190,67,88,224,38,76,80,39,112,54,111,
+134,206,51,91,220,130,152,118,100,154,161,200,133,174,22,222,180,221,12,173,131,118,183,121,29,220,49,66,124,98,185,58,211,76,101,195,134,141,171,133,5,6,137,76,208,79,208,174,54,175,114,211,77,107,
+252,7,194,22,167,32,134,205,37,190,146,4,29,194,188,237,230,232,49,196,246,218,201,230,67,209,129,251,97,70,85,132,248,196,174,35,211,236,229,193,7,187,11,244,99,219,160,94,208,14,54,31,10,15,116,240,
+68,197,132,152,101,90,169,200,13,205,68,221,48,67,201,116,124,180,170,205,135,112,205,188,254,202,136,63,147,105,197,242,192,3,31,201,9,37,150,49,217,96,188,187,25,132,79,34,58,132,21,189,168,123,15,
+98,147,203,180,114,185,255,254,135,186,132,5,102,181,216,160,110,192,122,131,102,183,249,16,234,57,108,221,18,117,207,65,76,186,50,237,82,228,102,103,203,4,228,198,148,243,102,179,249,144,240,11,94,
+229,238,147,88,100,218,177,220,119,223,134,110,97,81,240,162,32,17,176,79,94,13,105,182,121,224,247,152,27,137,240,229,238,43,184,247,238,76,187,23,9,194,84,140,96,249,80,71,160,187,52,109,194,211,
+132,165,53,19,247,62,184,231,140,43,127,45,242,222,239,20,242,188,255,227,192,19,198,46,37,97,50,52,194,230,17,29,103,226,90,226,94,119,112,143,157,78,113,75,145,202,82,86,152,163,210,20,23,94,17,244,
+166,81,95,160,107,89,77,136,106,137,206,223,121,5,81,161,195,133,56,103,146,107,12,238,41,235,20,78,150,8,133,132,65,190,1,109,109,44,153,214,4,149,49,18,35,172,67,132,137,17,138,204,223,195,229,86,
+180,54,120,178,113,22,18,138,99,240,189,164,74,175,35,184,7,39,124,165,69,158,180,78,97,70,40,242,212,53,9,197,224,154,157,213,87,57,25,122,132,43,66,41,133,162,151,130,107,235,113,74,213,184,72,165,
+107,149,208,43,228,133,34,149,176,6,81,12,174,129,107,89,229,148,105,80,201,102,63,220,37,140,10,5,97,137,57,244,53,98,41,56,7,231,234,114,145,79,111,66,116,8,89,33,39,76,11,121,97,94,88,20,150,133,
+107,194,117,161,20,112,61,248,183,229,224,103,230,131,223,153,14,142,193,177,58,92,100,93,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,82,83,166,166,166,59,132,
+172,144,19,166,133,188,48,47,44,10,203,194,53,225,186,80,10,184,30,252,219,114,240,51,243,193,239,76,7,199,224,88,174,43,56,197,130,119,9,163,66,65,88,18,188,26,177,20,156,131,115,185,193,160,70,149,
+75,151,158,88,37,244,10,121,161,40,120,13,162,24,92,3,215,226,134,131,107,93,46,94,188,220,35,92,17,74,130,151,50,74,193,181,185,9,33,85,22,189,83,152,17,138,41,20,221,70,49,184,102,55,37,172,210,114,
+225,194,227,89,161,32,120,149,48,62,126,218,59,122,116,212,203,229,14,120,125,125,3,254,119,244,216,81,155,253,245,216,110,133,69,152,225,154,60,254,206,70,12,236,190,197,207,240,201,181,222,222,221,
+222,158,61,251,189,35,71,70,188,147,39,79,121,149,94,71,112,15,110,82,104,66,225,231,146,4,249,220,185,75,222,240,240,152,55,48,176,215,255,98,22,98,134,43,109,203,44,198,44,187,108,43,92,200,193,177,
+248,28,75,127,255,30,111,104,232,152,127,206,132,137,48,231,18,33,162,156,63,63,213,41,228,5,47,14,147,147,103,189,253,251,15,251,79,182,190,188,122,165,162,171,194,71,193,199,153,246,238,61,232,77,
+76,156,241,226,94,119,112,143,238,213,160,22,121,154,166,120,162,226,112,232,208,144,81,244,106,62,237,54,162,86,252,144,12,7,14,28,241,226,222,7,247,236,132,63,119,169,91,88,44,23,44,222,231,187,119,
+231,252,125,242,210,38,60,168,11,65,184,30,234,28,212,27,98,36,1,247,222,158,139,67,207,158,189,56,43,120,81,28,63,62,225,87,198,106,33,122,181,133,55,177,109,91,175,55,54,54,238,149,187,79,98,209,78,
+194,119,9,11,81,1,225,137,231,41,74,227,211,30,71,120,125,209,200,246,237,125,190,35,148,73,2,98,210,218,189,139,103,206,92,200,9,37,193,179,49,56,184,207,223,33,43,205,54,31,87,120,21,254,159,22,68,
+212,189,7,177,105,205,45,98,78,159,62,63,35,120,54,104,179,211,6,111,54,155,47,183,100,76,95,77,68,61,230,240,225,97,47,42,22,196,170,213,196,47,68,221,240,174,93,131,77,111,243,229,132,215,217,177,
+99,87,185,36,104,254,109,226,78,157,58,215,33,204,11,158,137,145,145,227,254,215,46,91,197,230,227,8,175,46,53,163,231,145,78,37,91,124,130,216,117,52,171,248,171,133,5,219,205,237,219,119,168,101,
+109,190,156,240,58,116,57,71,36,1,49,108,174,173,98,39,39,207,174,22,222,164,183,206,4,150,223,14,54,95,110,177,41,155,88,132,208,82,176,197,43,136,229,234,102,17,191,67,88,176,221,12,109,227,118,178,
+249,114,194,171,48,214,16,145,4,196,52,253,175,131,137,137,51,243,244,141,235,208,14,102,160,166,93,109,62,74,248,16,182,162,225,83,112,196,202,20,67,98,155,106,241,199,199,79,23,232,196,209,57,113,
+98,210,175,236,181,187,205,71,9,175,66,83,145,94,80,83,44,137,113,90,197,159,137,43,126,59,219,188,77,116,83,18,16,59,75,18,164,171,159,64,44,43,135,109,153,96,148,204,217,124,124,225,239,189,247,67,
+55,96,242,138,45,174,196,60,45,226,119,9,37,211,69,50,108,235,108,62,185,240,42,244,142,90,18,128,152,55,126,236,64,108,106,1,171,210,217,185,179,223,217,124,133,162,171,176,1,38,15,146,41,198,196,
+190,161,226,75,69,101,150,202,138,14,3,58,38,209,121,175,29,59,118,194,219,191,255,144,179,249,50,162,235,208,119,98,138,53,26,52,74,252,110,211,5,49,99,199,244,180,79,76,156,242,254,248,199,63,122,
+87,175,94,245,121,237,181,239,123,155,54,125,212,217,124,25,225,85,152,113,100,73,130,250,79,42,25,27,27,95,100,178,131,206,166,77,91,140,54,255,246,219,111,223,16,63,228,141,55,126,229,245,247,15,58,
+155,47,35,60,123,19,3,149,105,83,204,209,162,222,226,79,153,46,132,238,76,211,251,157,190,110,93,252,144,119,222,249,79,111,116,244,184,179,121,139,232,58,180,170,44,73,80,159,57,134,199,142,157,236,
+20,60,29,102,199,218,222,235,143,62,186,205,154,0,33,83,83,151,157,205,71,8,31,194,230,213,212,177,76,26,160,77,205,19,96,116,244,68,94,240,116,104,179,70,85,234,242,249,175,149,77,130,103,158,249,76,
+219,219,124,148,240,33,196,213,164,1,218,212,90,252,172,233,196,52,249,226,212,230,191,248,197,47,151,77,130,175,125,237,31,218,222,230,109,194,171,208,52,180,36,65,237,22,159,140,140,28,159,99,18,
+135,10,211,155,194,247,126,156,218,252,223,254,237,39,202,38,193,119,190,243,93,239,161,135,54,182,181,205,71,193,151,82,248,57,90,92,186,30,104,84,43,241,179,134,147,249,235,232,146,54,225,38,38,78,
+123,255,243,63,127,137,76,130,95,254,114,193,219,177,163,175,109,109,222,38,188,10,45,46,147,38,104,85,245,4,24,30,30,43,176,254,78,133,118,105,165,109,247,125,251,14,122,111,189,245,155,200,36,248,
+253,239,127,47,14,51,212,182,54,111,19,94,133,153,85,186,46,104,85,85,241,135,134,142,117,50,119,77,135,241,253,149,116,218,208,164,249,233,79,127,86,246,149,112,238,220,133,182,180,249,114,240,193,
+42,42,223,38,109,208,172,154,9,48,163,159,64,127,250,43,237,180,225,223,231,230,94,42,155,4,179,179,159,106,75,155,55,137,174,195,34,89,67,2,84,111,200,248,232,209,209,34,243,246,85,168,133,86,179,
+211,230,203,95,254,74,217,36,120,238,185,23,218,210,230,109,194,135,48,98,168,235,131,102,213,18,191,199,112,112,191,91,178,218,157,54,79,62,249,201,178,73,240,202,43,175,74,139,227,193,182,178,249,
+40,248,42,26,215,98,210,8,237,86,156,0,71,142,140,92,97,151,12,21,22,108,214,170,183,110,114,242,140,247,238,187,239,70,38,193,235,175,255,220,175,127,180,147,205,155,132,87,97,178,173,174,19,218,173,
+72,124,105,227,175,18,74,180,245,85,152,184,88,203,190,121,134,139,127,251,219,223,69,38,193,239,126,247,59,255,231,218,197,230,77,162,171,208,23,163,235,20,104,183,106,37,9,208,171,31,148,102,71,61,
+186,104,121,194,255,249,159,95,143,76,2,156,98,114,242,116,91,216,124,20,124,224,18,24,143,49,36,65,111,197,9,112,232,208,80,158,222,38,21,70,252,234,213,55,79,146,189,252,242,43,101,235,5,51,51,79,
+181,133,205,219,132,15,161,89,173,235,133,134,43,73,128,162,126,64,218,157,245,238,155,255,202,87,158,47,155,4,95,250,210,223,183,188,205,155,68,87,161,59,222,144,0,149,181,6,14,30,60,218,37,120,42,
+180,253,27,213,55,255,212,83,179,101,147,224,91,223,154,51,58,64,43,217,188,141,187,239,190,199,135,62,1,93,55,180,172,36,1,70,245,3,177,107,71,35,251,230,79,159,62,87,54,9,126,242,147,159,122,155,55,
+127,172,101,109,222,38,124,8,175,104,67,2,140,38,78,0,121,218,11,60,241,42,172,93,107,244,160,204,129,3,135,141,211,203,84,222,122,235,45,127,160,164,21,109,222,38,124,8,175,104,93,55,180,76,156,0,98,
+37,75,216,137,10,59,108,166,97,8,150,25,70,191,248,197,191,68,38,1,61,139,173,106,243,54,238,186,235,131,190,30,186,110,104,153,84,252,14,195,65,222,103,253,141,236,155,167,27,250,213,87,191,99,77,
+128,239,126,247,181,150,181,121,147,240,33,252,188,73,59,52,141,157,0,210,214,207,210,222,87,97,159,190,52,14,193,62,255,124,222,152,0,207,62,251,185,150,181,121,147,240,42,172,33,208,245,67,211,36,9,
+144,211,15,64,229,34,173,67,176,140,20,170,226,255,244,167,63,245,19,181,85,109,190,28,116,162,25,18,32,254,90,194,189,123,15,78,211,171,164,66,5,48,205,67,176,140,79,92,190,60,237,157,56,49,209,242,
+54,111,226,206,59,187,110,64,69,80,215,15,77,99,39,64,46,119,32,207,54,235,42,244,255,187,33,216,244,216,188,73,248,16,70,106,117,253,208,52,73,2,204,235,7,96,11,118,55,4,155,30,155,55,9,31,194,235,
+207,144,0,241,119,23,217,179,103,255,34,171,121,84,24,109,106,183,153,54,105,182,121,19,235,215,127,192,135,120,233,250,161,105,146,4,88,214,15,192,192,140,179,249,244,216,188,73,248,16,174,219,144,0,
+203,177,19,96,112,112,223,53,150,31,169,96,43,206,230,211,99,243,38,225,67,56,190,174,31,154,198,78,128,129,129,189,215,249,252,138,74,57,225,157,205,55,230,105,183,161,235,135,166,73,18,160,164,31,
+192,217,124,186,133,191,227,142,187,223,131,33,1,74,177,19,96,247,238,92,137,158,63,21,103,243,233,178,121,155,240,33,186,126,104,154,36,1,174,155,18,192,217,124,122,108,222,38,60,240,255,134,4,136,
+255,10,232,239,223,115,141,143,27,168,80,7,112,54,159,46,155,215,185,253,246,187,124,56,150,174,31,154,198,78,128,93,187,6,151,25,80,80,161,21,224,108,62,93,54,175,11,31,194,117,235,250,161,105,146,4,
+88,212,15,64,63,128,179,249,244,216,188,73,248,16,98,100,72,128,248,29,65,125,125,3,243,76,255,82,161,39,208,217,252,61,169,123,218,77,240,144,234,250,161,105,146,4,200,235,7,96,44,192,217,124,122,
+133,191,237,182,59,111,192,196,29,67,2,196,31,12,234,237,221,61,205,240,170,10,67,140,206,230,211,99,243,38,225,67,248,18,139,174,31,154,198,78,128,157,59,251,115,236,251,163,194,10,84,103,243,233,
+177,121,147,240,33,60,172,186,126,104,154,36,1,178,250,1,216,10,198,217,124,122,108,222,196,186,117,235,125,88,33,100,72,128,248,83,194,118,236,216,213,193,103,205,116,116,235,119,54,223,56,155,55,9,
+15,252,188,73,59,52,77,52,51,88,126,97,73,63,8,77,65,103,243,233,176,121,93,248,16,226,107,16,127,41,241,186,128,237,219,251,10,76,4,85,161,37,224,108,62,61,79,187,9,30,82,93,55,180,76,156,0,219,182,
+245,142,178,233,128,10,75,174,156,205,167,83,248,91,111,189,195,135,143,81,234,186,161,101,37,9,208,165,31,168,167,103,167,179,249,20,216,188,73,248,16,246,110,50,36,64,101,95,22,17,193,139,136,174,
+66,39,131,179,249,198,62,237,38,225,129,248,235,122,161,97,197,251,3,200,47,231,245,3,178,62,208,217,124,99,109,222,6,221,245,134,4,168,124,131,8,177,147,94,44,69,133,54,166,179,249,198,218,188,206,
+218,181,183,251,240,121,62,93,47,52,92,73,2,172,18,74,250,65,25,26,118,54,223,24,155,55,9,15,196,221,32,62,218,85,190,73,20,229,209,71,183,95,161,23,80,133,143,63,57,155,111,204,211,174,11,31,194,106,
+32,93,39,180,91,241,62,129,91,183,110,235,97,177,161,14,45,1,103,243,245,183,121,19,28,223,164,17,218,85,101,183,80,57,80,81,63,56,21,14,103,243,245,181,121,19,107,214,220,230,79,215,51,136,95,157,
+173,98,41,82,241,155,161,242,167,66,167,144,179,249,250,218,188,46,124,8,219,225,232,250,160,89,53,19,160,211,112,2,191,79,192,217,124,125,108,94,23,61,36,252,146,152,129,234,126,64,106,203,150,199,
+10,236,17,160,194,146,113,103,243,235,27,34,124,8,93,191,186,46,104,85,245,47,134,72,27,51,75,59,83,7,23,112,54,95,123,155,183,61,253,38,77,208,170,38,223,13,146,3,207,233,39,227,253,227,108,190,62,
+79,123,72,103,231,58,255,79,102,254,24,196,175,205,71,163,40,143,60,178,53,203,212,48,29,118,236,114,54,95,91,225,17,93,133,154,191,73,11,52,170,233,183,3,229,4,121,211,137,233,23,112,54,95,123,225,
+129,123,179,136,95,219,15,71,82,164,249,215,73,19,80,103,195,134,141,206,230,171,108,243,54,232,131,49,105,128,54,117,249,126,176,188,247,167,120,247,235,48,70,224,108,190,186,79,187,202,45,183,220,
+234,87,252,76,177,71,147,186,126,65,92,78,184,104,186,16,94,5,206,230,171,47,60,112,191,22,241,235,251,249,120,202,195,15,127,180,155,126,0,29,230,13,58,155,95,185,205,171,194,135,176,224,195,20,115,
+180,200,52,162,200,137,103,77,23,68,171,192,217,124,117,68,15,97,111,70,139,248,179,153,70,22,105,139,46,208,30,213,161,153,226,108,126,229,194,3,175,85,83,140,137,125,166,209,101,227,198,205,93,66,
+137,46,73,29,22,146,56,155,175,92,120,160,131,205,20,219,32,230,93,153,52,20,185,144,156,229,34,253,236,117,54,159,76,116,184,249,230,181,190,131,218,226,74,204,51,105,42,221,221,155,102,152,41,164,
+195,36,82,38,142,56,155,95,23,75,244,16,98,66,236,76,49,37,214,153,52,22,185,176,130,233,130,105,25,152,146,192,217,252,251,133,15,197,39,102,22,241,11,153,52,23,201,218,121,50,87,71,77,2,103,243,102,
+225,129,215,36,177,50,197,144,216,102,210,94,228,226,59,132,5,110,194,4,117,2,103,243,102,232,60,179,197,45,136,105,71,166,25,138,92,232,106,225,77,219,205,208,58,104,119,155,215,193,29,35,196,39,150,
+171,51,205,84,54,108,216,184,90,88,96,144,200,4,253,4,237,106,243,42,55,221,180,198,127,32,108,113,10,98,216,92,226,43,73,208,33,204,219,110,142,30,67,108,175,157,108,62,20,29,184,31,102,84,69,136,79,
+236,58,50,205,94,30,124,176,187,64,63,182,13,234,5,237,96,243,161,240,64,7,79,84,76,136,89,166,149,138,220,208,76,212,13,51,148,76,199,71,171,218,124,8,215,204,235,175,140,248,51,153,86,44,15,60,240,
+145,156,80,98,25,147,13,198,187,155,65,248,36,162,67,88,209,139,186,247,32,54,185,76,43,151,251,239,127,168,75,88,96,86,139,13,234,6,172,55,104,118,155,15,161,158,195,214,45,81,247,28,196,164,43,211,
+46,69,110,118,182,76,64,110,76,57,111,54,155,15,9,191,224,85,238,62,137,69,166,29,203,125,247,109,232,22,22,5,47,10,18,1,251,228,213,144,102,155,7,126,143,185,145,8,95,238,190,130,123,239,206,180,123,
+145,32,76,197,8,150,15,117,4,186,75,211,38,60,77,88,90,51,113,239,131,123,206,184,242,215,34,239,253,78,33,207,251,63,14,60,97,236,82,18,38,67,35,108,30,209,113,38,174,37,238,117,7,247,216,233,20,183,
+20,169,44,101,133,57,42,77,113,225,21,65,111,26,245,5,186,150,213,132,168,150,232,252,157,87,16,21,58,92,136,115,38,185,198,224,158,178,78,225,100,137,80,72,24,228,27,208,214,198,146,105,77,80,25,35,
+49,194,58,68,152,24,161,200,252,61,92,110,69,107,131,39,27,103,33,161,56,6,223,75,170,244,58,130,123,112,194,87,90,228,73,235,20,102,132,34,79,93,147,80,12,174,217,89,125,149,147,161,71,184,34,148,82,
+40,122,41,184,182,30,167,84,141,139,84,186,86,9,189,66,94,40,82,9,107,16,197,224,26,184,150,85,78,153,6,149,108,246,195,93,194,168,80,16,150,152,67,95,35,150,130,115,112,174,46,23,249,244,38,68,135,
+144,21,114,194,180,144,23,230,133,69,97,89,184,38,92,23,74,1,215,131,127,91,14,126,102,62,248,157,233,224,24,28,171,195,69,214,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,
+87,92,113,37,53,101,106,106,186,67,200,10,57,97,90,200,11,243,194,162,176,44,92,19,174,11,165,128,235,193,191,45,7,63,51,31,252,206,116,112,12,142,229,186,130,83,44,120,151,48,42,20,132,37,193,171,17,
+75,193,57,56,151,27,12,106,84,185,116,233,137,85,66,175,144,23,138,130,215,32,138,193,53,112,45,110,56,184,214,229,226,197,203,61,194,21,161,36,120,41,163,20,92,155,155,16,82,101,209,59,133,25,161,
+152,66,209,109,20,131,107,118,83,194,42,45,23,46,60,158,21,10,130,87,9,227,227,167,189,163,71,71,189,92,238,128,215,215,55,224,127,71,143,29,181,217,95,143,237,86,88,132,25,174,201,227,239,108,196,
+192,238,91,252,12,159,92,235,237,221,237,237,217,179,223,59,114,100,196,59,121,242,148,87,233,117,4,247,224,38,133,38,20,126,46,73,144,207,157,187,228,13,15,143,121,3,3,123,253,47,102,33,102,184,210,
+182,204,98,204,178,203,182,194,133,28,28,139,207,177,244,247,239,241,134,134,142,249,231,76,152,8,115,46,17,34,202,249,243,83,157,66,94,240,226,48,57,121,214,219,191,255,176,255,100,235,203,171,87,42,
+186,42,124,20,124,156,105,239,222,131,222,196,196,25,47,238,117,7,247,232,94,13,106,145,167,105,138,39,42,14,135,14,13,25,69,175,230,211,110,35,106,197,15,201,112,224,192,17,47,238,125,112,207,78,248,
+115,151,186,133,197,114,193,226,125,190,123,119,206,223,39,47,109,194,131,186,16,132,235,161,206,65,189,33,70,18,112,239,237,185,56,244,236,217,139,179,130,23,197,241,227,19,126,101,172,22,162,87,91,
+120,19,219,182,245,122,99,99,227,94,185,251,36,22,237,36,124,151,176,16,21,16,158,120,158,162,52,62,237,113,132,215,23,141,108,223,222,231,59,66,153,36,32,38,173,221,187,120,230,204,133,156,80,18,60,
+27,131,131,251,252,29,178,210,108,243,113,133,87,225,255,105,65,68,221,123,16,155,214,220,34,230,244,233,243,51,130,103,131,54,59,109,240,102,179,249,114,75,198,244,213,68,212,99,14,31,30,246,162,98,
+65,172,90,77,252,66,212,13,239,218,53,216,244,54,95,78,120,157,29,59,118,149,75,130,230,223,38,238,212,169,115,29,194,188,224,153,24,25,57,238,127,237,178,85,108,62,142,240,234,82,51,122,30,233,84,
+178,197,39,136,93,71,179,138,191,90,88,176,221,220,190,125,135,90,214,230,203,9,175,67,151,115,68,18,16,195,230,218,42,118,114,242,236,106,225,77,122,235,76,96,249,237,96,243,229,22,155,178,137,69,8,
+45,5,91,188,130,88,174,110,22,241,59,132,5,219,205,208,54,110,39,155,47,39,188,10,99,13,17,73,64,76,211,255,58,152,152,56,51,79,223,184,14,237,96,6,106,218,213,230,163,132,15,97,43,26,62,5,71,172,76,
+49,36,182,169,22,127,124,252,116,129,78,28,157,19,39,38,253,202,94,187,219,124,148,240,42,52,21,233,5,53,197,146,24,167,85,252,153,184,226,183,179,205,219,68,55,37,1,177,179,36,65,186,250,9,196,178,
+114,216,150,9,70,201,156,205,199,23,254,222,123,63,116,3,38,175,216,226,74,204,211,34,126,151,80,50,93,36,195,182,38,161,47,94,156,242,126,242,147,159,122,111,188,241,134,247,249,207,127,177,45,109,
+62,74,120,21,122,71,45,9,64,204,27,63,118,32,54,181,128,85,233,236,220,217,111,21,255,234,213,171,239,225,149,87,94,109,75,155,183,137,174,194,6,152,60,72,166,24,19,251,134,138,47,21,149,89,42,43,58,
+12,232,216,108,158,39,95,79,0,53,9,218,205,230,109,162,235,208,119,98,138,53,26,52,74,252,110,211,5,49,99,39,234,221,254,175,255,250,134,49,1,224,229,151,95,109,75,155,143,18,94,133,25,71,150,36,168,
+255,164,146,177,177,241,69,38,59,232,108,218,180,37,178,82,199,59,223,150,0,122,18,180,147,205,71,193,222,196,64,101,218,20,115,180,168,183,248,83,166,11,161,59,51,78,109,30,145,163,147,224,149,182,
+180,121,147,232,58,180,170,44,73,80,159,57,134,199,142,157,236,20,60,29,102,199,38,169,205,87,146,4,237,96,243,54,225,67,216,188,154,58,150,73,3,180,169,121,2,140,142,158,200,11,158,14,109,214,164,
+205,184,184,73,208,78,54,31,37,124,8,113,53,105,128,54,181,22,63,107,58,49,77,190,74,155,113,136,92,46,9,218,205,230,109,194,171,208,52,180,36,65,237,22,159,140,140,28,159,99,18,135,10,211,155,194,
+247,126,165,157,54,73,146,160,93,108,62,10,190,148,194,207,209,226,210,245,64,163,90,137,159,53,156,204,95,71,87,141,78,155,114,73,240,210,75,175,180,149,205,219,132,87,161,197,101,210,4,173,170,158,
+0,195,195,99,5,214,223,169,208,46,173,102,167,77,37,73,208,202,54,111,19,94,133,153,85,186,46,104,85,85,241,135,134,142,117,50,119,77,135,241,253,106,119,218,196,73,130,118,177,249,114,240,193,42,42,
+223,38,109,208,172,154,9,48,163,159,64,127,250,171,217,105,131,200,209,73,240,114,219,216,188,73,116,29,22,201,26,18,160,122,67,198,71,143,142,22,153,183,175,66,45,180,150,93,180,73,146,160,213,109,
+222,38,124,8,35,134,186,62,104,86,45,241,123,12,7,247,187,37,107,221,69,139,200,229,146,160,29,108,62,10,190,138,198,181,152,52,66,187,21,39,192,145,35,35,87,216,37,67,133,5,155,245,234,155,79,154,4,
+173,106,243,38,225,85,152,108,171,235,132,118,43,18,95,218,248,171,132,18,109,125,21,38,46,214,179,111,62,78,18,180,186,205,155,68,87,161,47,70,215,41,208,110,213,74,18,160,87,63,40,205,142,70,244,
+205,151,75,130,185,185,151,91,218,230,163,224,3,151,192,120,140,33,9,122,43,78,128,67,135,134,242,244,54,169,48,226,215,168,190,249,184,73,208,170,54,111,19,62,132,145,66,93,47,52,92,73,2,20,245,3,
+210,238,108,100,223,60,34,71,39,193,75,45,107,243,38,209,85,232,142,55,36,64,101,173,129,131,7,143,118,9,158,10,109,255,52,12,193,38,77,130,86,178,121,27,119,223,125,143,15,125,2,186,110,104,89,73,2,
+140,234,7,98,215,142,180,12,193,34,114,185,36,104,69,155,183,9,31,194,43,218,144,0,163,137,19,64,158,246,2,79,188,10,107,215,210,52,4,91,46,9,78,159,62,219,114,54,111,19,62,132,87,180,174,27,90,38,78,
+0,177,146,37,236,68,133,29,54,211,54,4,27,149,4,204,63,108,69,155,183,113,215,93,31,244,245,208,117,67,203,164,226,119,24,14,242,62,235,79,203,16,172,45,9,46,92,152,106,73,155,55,9,31,194,207,155,180,
+67,211,216,9,32,109,253,44,237,125,21,246,233,75,243,16,172,158,4,223,255,254,15,90,214,230,77,194,171,176,134,64,215,15,77,147,36,64,78,63,0,149,139,180,15,193,158,58,117,86,108,255,11,222,249,243,
+151,90,218,230,203,193,48,189,33,1,226,175,37,220,187,247,224,52,189,74,42,84,0,221,16,108,122,133,191,243,206,174,27,80,17,212,245,67,211,216,9,144,203,29,200,179,205,186,10,253,255,237,52,211,38,
+237,54,111,18,62,132,145,90,93,63,52,77,146,0,243,250,1,216,130,189,157,102,218,164,221,230,77,194,135,80,79,51,36,64,252,221,69,246,236,217,191,200,206,85,42,140,54,57,155,79,143,205,155,88,191,254,
+3,62,196,75,215,15,77,147,36,192,178,126,0,70,255,156,205,167,199,230,77,194,135,112,221,134,4,88,142,157,0,131,131,251,174,177,252,72,5,91,113,54,159,30,155,55,9,31,194,241,117,253,208,52,118,2,12,
+12,236,189,206,231,87,84,202,9,239,108,190,49,79,187,13,93,63,52,77,146,0,37,253,0,206,230,211,45,252,29,119,220,253,30,12,9,80,138,157,0,187,119,231,74,244,252,169,56,155,79,151,205,219,132,15,209,
+245,67,211,36,9,112,221,148,0,206,230,211,99,243,54,225,129,255,55,36,64,252,87,64,127,255,158,107,124,220,64,133,58,128,179,249,116,217,188,206,237,183,223,229,195,177,116,253,208,52,118,2,236,218,
+53,184,204,128,130,10,173,0,103,243,233,178,121,93,248,16,174,91,215,15,77,147,36,192,162,126,0,250,1,156,205,167,199,230,77,194,135,16,35,67,2,196,239,8,234,235,27,152,103,250,151,10,61,129,206,230,
+239,73,221,211,110,130,135,84,215,15,77,147,36,64,94,63,0,99,1,206,230,211,43,252,109,183,221,121,3,38,238,24,18,32,254,96,80,111,239,238,105,150,127,169,48,196,232,108,62,61,54,111,18,62,132,47,177,
+232,250,161,105,236,4,216,185,179,63,199,190,63,42,172,64,117,54,159,30,155,55,9,31,194,195,170,235,135,166,73,18,32,171,31,128,173,96,156,205,167,199,230,77,172,91,183,222,135,21,66,134,4,136,63,37,
+108,199,142,93,29,124,214,76,71,183,126,103,243,141,179,121,147,240,192,207,155,180,67,211,68,51,131,229,23,150,244,131,208,20,116,54,159,14,155,215,133,15,33,190,6,241,151,18,175,11,216,190,189,175,
+192,68,80,21,90,2,206,230,211,243,180,155,224,33,213,117,67,203,196,9,176,109,91,239,40,155,14,168,108,222,252,49,103,243,41,21,254,214,91,239,240,225,99,148,186,110,104,89,73,2,116,233,7,234,233,217,
+233,108,62,5,54,111,18,62,132,189,155,12,9,80,217,151,69,68,240,34,162,171,208,201,224,108,190,177,79,187,73,120,32,254,186,94,104,88,241,254,0,242,203,121,253,128,172,15,116,54,223,88,155,183,65,119,
+189,33,1,42,223,32,66,236,164,23,75,81,161,141,233,108,190,177,54,175,179,118,237,237,62,124,158,79,215,11,13,87,146,0,171,132,146,126,80,134,134,157,205,55,198,230,77,194,3,113,55,136,143,118,149,
+111,18,69,121,244,209,237,87,232,5,84,225,163,134,206,230,27,243,180,235,194,135,176,26,72,215,9,237,86,188,79,224,214,173,219,122,88,108,168,67,75,192,217,124,253,109,222,4,199,55,105,132,118,85,217,
+45,84,14,84,212,15,78,133,195,217,124,125,109,222,196,154,53,183,249,211,245,12,226,87,103,171,88,138,84,252,102,168,252,169,208,41,228,108,190,190,54,175,11,31,194,119,3,116,125,208,172,154,9,208,
+105,56,129,223,39,224,108,190,62,54,175,139,30,18,126,73,204,64,117,63,32,181,101,203,99,5,246,8,80,97,201,184,179,249,245,13,17,62,132,174,95,93,23,180,170,250,23,67,164,141,153,165,157,169,131,11,
+56,155,175,189,205,219,158,126,147,38,104,85,147,239,6,201,129,231,244,147,241,254,113,54,95,159,167,61,164,179,115,157,255,39,51,127,12,226,215,230,163,81,148,71,30,217,154,101,106,152,14,31,142,112,
+54,95,91,225,17,93,133,154,191,73,11,52,170,233,183,3,229,4,121,211,137,233,23,112,54,95,123,225,129,123,179,136,95,219,15,71,82,164,249,215,73,19,80,103,195,134,141,206,230,171,108,243,54,232,131,49,
+105,128,54,117,249,126,176,188,247,167,120,247,235,48,70,224,108,190,186,79,187,202,45,183,220,234,87,252,76,177,71,147,186,126,65,92,78,184,104,186,16,94,5,206,230,171,47,60,112,191,22,241,235,251,
+249,120,202,195,15,127,180,155,126,0,29,230,13,58,155,95,185,205,171,194,135,176,224,195,20,115,180,200,52,162,200,137,103,77,23,68,171,192,217,124,117,68,15,97,111,70,139,248,179,153,70,22,105,139,
+46,208,30,213,161,153,226,108,126,229,194,3,175,85,83,140,137,125,166,209,101,227,198,205,93,66,137,46,73,29,22,146,56,155,175,92,120,160,131,205,20,219,32,230,93,153,52,20,185,144,156,229,34,253,236,
+117,54,159,76,116,184,249,230,181,190,131,218,226,74,204,51,105,42,221,221,155,102,152,41,164,195,36,82,38,142,56,155,95,23,75,244,16,98,66,236,76,49,37,214,153,52,22,185,176,130,233,130,105,25,152,
+146,192,217,252,251,133,15,197,39,102,22,241,11,153,52,23,201,218,121,50,87,71,77,2,103,243,102,225,129,215,36,177,50,197,144,216,102,210,94,228,226,59,132,5,110,194,4,117,2,103,243,102,232,60,179,
+197,45,136,105,71,166,25,138,92,232,106,225,77,219,205,208,58,104,119,155,215,193,29,35,196,39,150,171,51,205,84,54,108,216,184,90,88,96,144,200,4,253,4,237,106,243,42,55,221,180,198,127,32,108,113,
+10,98,216,92,226,43,73,208,33,204,219,110,142,30,67,108,175,157,108,62,20,29,184,31,102,84,69,136,79,236,58,50,205,94,30,124,176,187,64,63,182,13,234,5,237,96,243,161,240,64,7,79,84,76,136,89,166,149,
+138,220,208,76,212,13,51,148,76,199,71,171,218,124,8,215,204,235,175,140,248,51,153,86,44,15,60,240,145,156,80,98,25,147,13,198,187,155,65,248,36,162,67,88,209,139,186,247,32,54,185,76,43,151,251,239,
+127,168,75,88,96,86,139,13,234,6,172,55,104,118,155,15,161,158,195,214,45,81,247,28,196,164,43,211,46,69,110,118,182,76,64,110,76,57,111,54,155,15,9,191,224,85,238,62,137,69,166,29,203,125,247,109,
+232,22,22,5,47,10,18,1,251,228,213,144,102,155,7,126,143,185,145,8,95,238,190,130,123,239,206,180,123,145,32,76,197,8,150,15,117,4,186,75,211,38,60,77,88,90,51,113,239,131,123,206,184,242,215,34,239,
+253,78,33,207,251,63,14,60,97,236,82,18,38,67,35,108,30,209,113,38,174,37,238,117,7,247,216,233,20,183,20,169,44,101,133,57,42,77,113,225,21,65,111,26,245,5,186,150,213,132,168,150,232,252,157,87,16,
+21,58,92,136,115,38,185,198,224,158,178,78,225,100,137,80,72,24,228,27,208,214,198,146,105,77,80,25,35,49,194,58,68,152,24,161,200,252,61,92,110,69,107,131,39,27,103,33,161,56,6,223,75,170,244,58,130,
+123,112,194,87,90,228,73,235,20,102,132,34,79,93,147,80,12,174,217,89,125,149,147,161,71,184,34,148,82,40,122,41,184,182,30,167,84,141,139,84,186,86,9,189,66,94,40,82,9,107,16,197,224,26,184,150,85,
+78,153,6,149,108,246,195,93,194,168,80,16,150,152,67,95,35,150,130,115,112,174,46,23,249,244,38,68,135,144,21,114,194,180,144,23,230,133,69,97,89,184,38,92,23,74,1,215,131,127,91,14,126,102,62,248,
+157,233,224,24,28,171,195,69,214,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,37,53,101,106,106,186,67,200,10,57,97,90,200,11,243,194,162,176,44,92,19,174,11,165,
+128,235,193,191,45,7,63,51,31,252,206,116,112,12,142,229,186,130,83,44,120,151,48,42,20,132,37,193,171,17,75,193,57,56,151,27,12,106,84,185,116,233,137,85,66,175,144,23,138,130,215,32,138,193,53,112,
+45,110,56,184,214,229,226,197,203,61,194,21,161,36,120,41,163,20,92,155,155,16,82,101,209,59,133,25,161,152,66,209,109,20,131,107,118,83,194,42,45,23,46,60,158,21,10,130,87,9,227,227,167,189,163,71,
+71,189,92,238,128,215,215,55,224,127,71,143,29,181,217,95,143,237,86,88,132,25,174,201,227,239,108,196,192,238,91,252,12,159,92,235,237,221,237,237,217,179,223,59,114,100,196,59,121,242,148,87,233,
+117,4,247,224,38,133,38,20,126,46,73,144,207,157,187,228,13,15,143,121,3,3,123,253,47,102,33,102,184,210,182,204,98,204,178,203,182,194,133,28,28,139,207,177,244,247,239,241,134,134,142,249,231,76,
+152,8,115,46,17,34,202,249,243,83,157,66,94,240,226,48,57,121,214,219,191,255,176,255,100,235,203,171,87,42,186,42,124,20,124,156,105,239,222,131,222,196,196,25,47,238,117,7,247,232,94,13,106,145,167,
+105,138,39,42,14,135,14,13,25,69,175,230,211,110,35,106,197,15,201,112,224,192,17,47,238,125,112,207,78,248,115,151,186,133,197,114,193,226,125,190,123,119,206,223,39,47,109,194,131,186,16,132,235,
+161,206,65,189,33,70,18,112,239,237,185,56,244,236,217,139,179,130,23,197,241,227,19,126,101,172,22,162,87,91,120,19,219,182,245,122,99,99,227,94,185,251,36,22,237,36,124,151,176,16,21,16,158,120,158,
+162,52,62,237,113,132,215,23,141,108,223,222,231,59,66,153,36,32,38,173,221,187,120,230,204,133,156,80,18,60,27,131,131,251,252,29,178,210,108,243,113,133,87,225,255,105,65,68,221,123,16,155,214,220,
+34,230,244,233,243,51,130,103,131,54,59,109,240,102,179,249,114,75,198,244,213,68,212,99,14,31,30,246,162,98,65,172,90,77,252,66,212,13,239,218,53,216,244,54,95,78,120,157,29,59,118,149,75,130,230,
+223,38,238,212,169,115,29,194,188,224,153,24,25,57,238,127,237,178,85,108,62,142,240,234,82,51,122,30,233,84,178,197,39,136,93,71,179,138,191,90,88,176,221,220,190,125,135,90,214,230,203,9,175,67,151,
+115,68,18,16,195,230,218,42,118,114,242,236,106,225,77,122,235,76,96,249,237,96,243,229,22,155,178,137,69,8,45,5,91,188,130,88,174,110,22,241,59,132,5,219,205,208,54,110,39,155,47,39,188,10,99,13,17,
+73,64,76,211,255,58,152,152,56,51,79,223,184,14,237,96,6,106,218,213,230,163,132,15,97,43,26,62,5,71,172,76,49,36,182,169,22,127,124,252,116,129,78,28,157,19,39,38,253,202,158,77,248,92,110,191,63,4,
+219,234,54,31,37,188,10,77,69,122,65,77,177,36,198,105,21,127,38,174,248,161,192,19,19,167,189,183,223,126,219,187,122,245,170,207,87,191,250,15,45,111,243,54,209,77,73,64,236,44,73,144,174,126,2,177,
+172,28,182,101,130,81,50,147,205,115,131,127,252,227,31,111,136,31,242,165,47,125,185,229,109,62,138,123,239,253,208,13,152,188,98,139,43,49,79,139,248,93,66,201,116,145,12,219,218,222,233,99,99,39,
+222,39,126,200,147,79,62,213,242,54,31,37,188,10,189,163,150,4,32,230,141,31,59,16,155,90,192,170,116,118,238,236,143,172,212,237,223,127,200,154,0,48,57,121,166,229,109,222,38,186,10,27,96,242,32,
+153,98,76,236,27,42,190,84,84,102,169,172,232,48,160,19,167,54,255,218,107,223,183,38,192,95,254,242,23,63,73,90,221,230,109,162,235,208,119,98,138,53,26,52,74,252,110,211,5,49,99,39,110,109,126,211,
+166,143,122,111,188,241,43,107,18,188,245,214,111,164,117,176,173,229,109,62,74,120,21,102,28,89,146,160,254,147,74,198,198,198,23,153,236,160,179,105,211,150,68,205,184,254,254,65,239,157,119,254,
+211,154,4,63,253,233,207,34,19,160,85,108,62,10,246,38,6,42,211,166,152,163,69,189,197,159,50,93,8,221,153,149,52,227,70,71,143,71,214,7,230,230,94,106,11,155,55,137,174,67,171,202,146,4,245,153,99,
+120,236,216,201,78,193,211,97,118,236,74,218,238,83,83,151,35,147,224,239,255,254,185,182,176,121,155,240,33,108,94,77,29,203,164,1,218,212,60,1,70,71,79,228,5,79,135,54,235,74,219,238,207,60,243,153,
+200,36,248,196,39,62,217,242,54,31,37,124,8,113,53,105,128,54,181,22,63,107,58,49,77,190,106,117,218,124,237,107,255,16,153,4,167,79,159,109,121,155,183,9,175,66,211,208,146,4,181,91,124,50,50,114,
+124,142,73,28,42,76,111,10,223,251,213,234,180,249,206,119,190,107,77,128,119,223,125,87,106,195,135,91,222,230,163,224,75,41,252,28,45,46,93,15,52,170,149,248,89,195,201,252,65,156,106,247,205,63,
+244,208,70,239,151,191,92,176,38,193,111,127,251,59,255,188,173,108,243,54,225,85,104,113,153,52,65,171,170,39,192,240,240,88,129,245,119,42,180,75,107,213,69,187,99,71,159,247,251,223,255,222,154,4,
+175,191,254,115,223,117,90,217,230,109,194,171,48,179,74,215,5,173,170,42,254,208,208,177,78,230,174,233,48,190,95,203,190,249,195,135,135,34,235,3,47,191,252,74,75,219,124,57,248,96,21,149,111,147,
+54,104,86,205,4,152,209,79,160,63,253,181,234,155,63,119,238,66,100,18,60,247,220,243,45,109,243,38,209,117,88,36,107,72,128,234,13,25,31,61,58,90,100,222,190,10,181,208,122,245,205,207,206,126,42,50,
+9,62,249,201,167,91,218,230,109,194,135,48,98,168,235,131,102,213,18,191,199,112,112,191,91,178,158,125,243,207,61,247,66,100,18,156,57,115,190,101,109,62,10,190,138,198,181,152,52,66,187,21,39,192,
+145,35,35,87,216,37,67,133,5,155,141,232,155,127,229,149,87,35,147,224,224,193,35,45,107,243,38,225,85,152,108,171,235,132,118,43,18,95,218,248,171,132,18,109,125,21,38,46,54,162,111,254,195,31,126,
+192,175,253,219,18,128,233,101,143,61,182,189,37,109,222,36,186,10,125,49,186,78,129,118,171,86,146,0,189,250,65,105,118,52,114,36,142,150,199,239,126,247,59,107,18,252,226,23,255,226,55,15,91,205,
+230,163,224,3,151,192,120,140,33,9,122,43,78,128,67,135,134,242,244,54,169,48,226,215,232,65,153,125,251,14,250,61,130,182,36,120,245,213,239,180,164,205,219,132,15,97,164,80,215,11,13,87,146,0,69,
+253,128,180,59,211,48,4,59,57,121,58,178,62,240,194,11,249,150,179,121,147,232,42,56,159,33,1,42,107,13,28,60,120,180,75,240,84,104,251,167,105,8,118,102,230,169,200,36,120,250,233,79,183,156,205,219,
+184,251,238,123,124,232,19,208,117,67,203,74,18,96,84,63,16,187,118,164,109,8,150,105,228,81,73,208,215,183,187,165,108,222,38,124,8,175,104,67,2,140,38,78,0,121,218,11,60,241,42,172,93,75,227,16,236,
+183,190,53,103,77,128,39,158,248,155,150,178,121,155,240,33,188,162,117,221,208,50,113,2,136,149,44,97,39,42,236,176,153,198,33,88,254,255,39,63,249,169,49,1,78,158,156,104,57,155,183,113,215,93,31,
+244,245,208,117,67,203,164,226,119,24,14,242,62,235,79,211,16,44,67,163,111,189,245,214,251,38,148,182,162,205,155,132,15,225,231,77,218,161,105,236,4,144,182,126,150,246,190,10,251,244,165,125,166,
+13,73,240,229,47,127,197,251,238,119,191,231,61,251,236,231,252,107,109,69,155,55,9,175,194,26,2,93,63,52,77,146,0,57,253,0,84,46,218,97,166,77,51,216,124,57,232,44,51,36,64,252,181,132,123,247,30,
+156,166,87,73,133,10,96,187,204,180,73,187,205,155,184,243,206,174,27,80,17,212,245,67,211,216,9,144,203,29,200,179,205,186,10,253,255,237,52,211,38,237,54,111,18,62,132,145,90,93,63,52,77,146,0,243,
+250,1,216,130,221,217,124,122,108,222,36,124,8,117,31,67,2,196,223,93,100,207,158,253,139,236,92,165,194,104,147,179,249,244,216,188,137,245,235,63,224,67,188,116,253,208,52,73,2,44,235,7,96,244,207,
+217,124,122,108,222,36,124,8,215,109,72,128,229,216,9,48,56,184,239,26,203,143,84,176,21,103,243,233,177,121,147,240,33,28,95,215,15,77,99,39,192,192,192,222,235,124,126,69,165,156,240,206,230,27,243,
+180,219,208,245,67,211,36,9,80,210,15,224,108,62,221,194,223,113,199,221,239,193,144,0,165,216,9,176,123,119,174,68,207,159,138,179,249,116,217,188,77,248,16,93,63,52,77,146,0,215,77,9,224,108,62,61,
+54,111,19,30,248,127,67,2,196,127,5,244,247,239,185,198,199,13,84,168,3,56,155,79,151,205,235,220,126,251,93,62,28,75,215,15,77,99,39,192,174,93,131,203,12,40,168,208,10,112,54,159,46,155,215,133,15,
+225,186,117,253,208,52,73,2,44,234,7,160,31,192,217,124,122,108,222,36,124,8,49,50,36,64,252,142,160,190,190,129,121,166,127,169,208,19,232,108,254,158,212,61,237,38,120,72,117,253,208,52,73,2,228,
+245,3,48,22,224,108,62,189,194,223,118,219,157,55,96,226,142,33,1,226,15,6,245,246,238,158,102,249,151,10,67,140,206,230,211,99,243,38,225,67,248,18,139,174,31,154,198,78,128,157,59,251,115,236,251,
+163,194,10,84,103,243,233,177,121,147,240,33,60,172,186,126,104,154,36,1,178,250,1,216,146,197,217,124,122,108,222,196,186,117,235,125,88,33,100,72,128,248,83,194,118,236,216,213,193,103,205,116,116,
+235,119,54,223,56,155,55,9,15,252,188,73,59,52,77,52,51,88,126,97,73,63,8,77,65,103,243,233,176,121,93,248,16,226,107,16,127,41,241,186,128,237,219,251,10,76,4,85,161,37,224,108,62,61,79,187,9,30,82,
+93,55,180,76,156,0,219,182,245,142,178,233,128,202,230,205,31,115,54,159,82,225,111,189,245,14,31,62,70,169,235,134,150,149,36,64,151,126,160,158,158,157,206,230,83,96,243,38,225,67,216,187,201,144,0,
+149,125,89,68,4,47,34,186,10,157,12,206,230,27,251,180,155,132,7,226,175,235,133,134,21,239,15,32,191,156,215,15,200,250,64,103,243,141,181,121,27,116,215,27,18,160,242,13,34,196,78,122,177,20,21,218,
+152,206,230,27,107,243,58,107,215,222,238,195,231,249,116,189,208,112,37,9,176,74,40,233,7,101,104,216,217,124,99,108,222,36,60,16,119,131,248,104,87,249,38,81,148,71,31,221,126,133,94,64,21,190,249,
+231,108,190,49,79,187,46,124,8,171,129,116,157,208,110,197,251,4,110,221,186,173,135,197,134,58,180,4,156,205,215,223,230,77,112,124,147,70,104,87,149,221,66,229,64,69,253,224,84,56,156,205,215,215,
+230,77,172,89,115,219,141,237,243,52,170,179,85,44,69,42,126,51,84,254,84,232,20,114,54,95,95,155,215,133,15,97,95,4,93,31,52,171,102,2,116,26,78,224,247,9,56,155,175,143,205,235,162,135,132,95,18,51,
+80,221,15,72,109,217,242,88,129,61,2,84,88,50,238,108,126,125,67,132,15,161,235,87,215,5,173,170,254,197,16,105,99,102,105,103,234,224,2,206,230,107,111,243,182,167,223,164,9,90,213,228,187,65,114,
+224,57,253,100,188,127,156,205,215,231,105,15,233,236,92,231,255,201,204,31,131,248,181,249,104,20,229,145,71,182,102,153,26,166,195,135,35,156,205,215,86,120,68,87,161,230,111,210,2,141,106,250,237,
+64,57,65,222,116,98,250,5,156,205,215,94,120,224,222,44,226,215,246,195,145,20,105,254,117,210,4,212,217,176,97,163,179,249,42,219,188,13,250,96,76,26,160,77,93,190,31,44,239,253,41,222,253,58,140,17,
+56,155,175,238,211,174,114,203,45,183,250,21,63,83,236,209,164,174,95,16,151,19,46,154,46,132,87,129,179,249,234,11,15,220,175,69,252,250,126,62,158,242,240,195,31,237,166,31,64,135,121,131,206,230,
+87,110,243,170,240,33,44,248,48,197,28,45,50,141,40,114,226,89,211,5,209,42,112,54,95,29,209,67,216,155,209,34,254,108,166,145,69,218,162,11,180,71,117,104,166,56,155,95,185,240,192,107,213,20,99,98,
+159,105,116,217,184,113,115,151,80,162,75,82,135,133,36,206,230,43,23,30,232,96,51,197,54,136,121,87,38,13,69,46,36,103,185,72,63,123,157,205,39,19,29,110,190,121,173,239,160,182,184,18,243,76,154,74,
+119,247,166,25,102,10,233,48,137,148,137,35,206,230,215,197,18,61,132,152,16,59,83,76,137,117,38,141,69,46,172,96,186,96,90,6,166,36,112,54,255,126,225,67,241,137,153,69,252,66,38,205,69,178,118,158,
+204,213,81,147,192,217,188,89,120,224,53,73,172,76,49,36,182,153,180,23,185,248,14,97,129,155,48,65,157,192,217,188,25,58,207,108,113,11,98,218,145,105,134,34,23,186,90,120,211,118,51,180,14,218,221,
+230,117,112,199,8,241,137,229,234,76,51,149,13,27,54,174,22,22,24,36,50,65,63,65,187,218,188,202,77,55,173,241,31,8,91,156,130,24,54,151,248,74,18,116,8,243,182,155,163,199,16,219,107,39,155,15,69,7,
+238,135,25,85,17,226,19,187,142,76,179,151,7,31,236,46,208,143,109,131,122,65,59,216,124,40,60,208,193,19,21,19,98,150,105,165,34,55,52,19,117,195,12,37,211,241,209,170,54,31,194,53,243,250,43,35,254,
+76,166,21,203,3,15,124,36,39,148,88,198,100,131,241,238,102,16,62,137,232,16,86,244,162,238,61,136,77,46,211,202,229,254,251,31,234,18,22,152,213,98,131,186,1,235,13,154,221,230,67,168,231,176,117,75,
+212,61,7,49,233,202,180,75,145,155,157,45,19,144,27,83,206,155,205,230,67,194,47,120,149,187,79,98,145,105,199,114,223,125,27,186,133,69,193,139,130,68,192,62,121,53,164,217,230,129,223,99,110,36,194,
+151,187,175,224,222,187,51,237,94,36,8,83,49,130,229,67,29,129,238,210,180,9,79,19,150,214,76,220,251,224,158,51,174,252,181,200,123,191,83,200,243,254,143,3,79,24,187,148,132,201,208,8,155,71,116,
+156,137,107,137,123,221,193,61,118,58,197,45,69,42,75,89,97,142,74,83,92,120,69,208,155,70,125,129,174,101,53,33,170,37,58,127,231,21,68,133,14,23,226,156,73,174,49,184,167,172,83,56,89,34,20,18,6,
+249,6,180,181,177,100,90,19,84,198,72,140,176,14,17,38,70,40,50,127,15,151,91,209,218,224,201,198,89,72,40,142,193,247,146,42,189,142,224,30,156,240,149,22,121,210,58,133,25,161,200,83,215,36,20,131,
+107,118,86,95,229,100,232,17,174,8,165,20,138,94,10,174,173,199,41,85,227,34,149,174,85,66,175,144,23,138,84,194,26,68,49,184,6,174,101,149,83,166,65,37,155,253,112,151,48,42,20,132,37,230,208,215,
+136,165,224,28,156,171,203,69,62,189,9,209,33,100,133,156,48,45,228,133,121,97,81,88,22,174,9,215,133,82,192,245,224,223,150,131,159,153,15,126,103,58,56,6,199,234,112,145,117,197,21,87,92,113,197,21,
+87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,73,77,153,154,154,238,16,178,66,78,152,22,242,194,188,176,40,44,11,215,132,235,66,41,224,122,240,111,203,193,207,204,7,191,51,29,28,131,99,185,
+174,224,20,11,222,37,140,10,5,97,73,240,106,196,82,112,14,206,229,6,131,26,85,46,93,122,98,149,208,43,228,133,162,224,53,136,98,112,13,92,139,27,14,174,117,185,120,241,114,143,112,69,40,9,94,202,40,5,
+215,230,38,132,84,89,244,78,97,70,40,166,80,116,27,197,224,154,221,148,176,74,203,133,11,143,103,133,130,224,85,194,248,248,105,239,232,209,81,47,151,59,224,245,245,13,248,223,209,99,71,109,246,215,
+99,187,21,22,97,134,107,242,248,59,27,49,176,251,22,63,195,39,215,122,123,119,123,123,246,236,247,142,28,25,241,78,158,60,229,85,122,29,193,61,184,73,161,9,133,159,75,18,228,115,231,46,121,195,195,99,
+222,192,192,94,255,139,89,136,25,174,180,45,179,24,179,236,178,173,112,33,7,199,226,115,44,253,253,123,188,161,161,99,254,57,19,38,194,156,75,132,136,114,254,252,84,167,144,23,188,56,76,78,158,245,
+246,239,63,236,63,217,250,242,234,149,138,174,10,31,5,31,103,218,187,247,160,55,49,113,198,139,123,221,193,61,186,87,131,90,228,105,154,226,137,138,195,161,67,67,70,209,171,249,180,219,136,90,241,67,
+50,28,56,112,196,139,123,31,220,179,19,254,220,165,110,97,177,92,176,120,159,239,222,157,243,247,201,75,155,240,160,46,4,225,122,168,115,80,111,136,145,4,220,123,123,46,14,61,123,246,226,172,224,69,
+113,252,248,132,95,25,171,133,232,213,22,222,196,182,109,189,222,216,216,184,87,238,62,137,69,59,9,223,37,44,68,5,132,39,158,167,40,141,79,123,28,225,245,69,35,219,183,247,249,142,80,38,9,136,73,107,
+247,46,158,57,115,33,39,148,4,207,198,224,224,62,127,135,172,52,219,124,92,225,85,248,127,90,16,81,247,30,196,166,53,183,136,57,125,250,252,140,224,217,160,205,78,27,188,217,108,190,220,146,49,125,53,
+17,245,152,195,135,135,189,168,88,16,171,86,19,191,16,117,195,187,118,13,54,189,205,151,19,94,103,199,142,93,229,146,160,249,183,137,59,117,234,92,135,48,47,120,38,70,70,142,251,95,187,108,21,155,143,
+35,188,186,212,140,158,71,58,149,108,241,9,98,215,209,172,226,175,22,22,108,55,183,111,223,161,150,181,249,114,194,235,208,229,28,145,4,196,176,185,182,138,157,156,60,187,90,120,147,222,58,19,88,126,
+59,216,124,185,197,166,108,98,17,66,75,193,22,175,32,150,171,155,69,252,14,97,193,118,51,180,141,109,162,31,57,50,236,93,188,248,184,60,17,251,90,198,230,203,9,175,194,88,67,68,18,16,211,244,191,14,
+38,38,206,204,211,55,174,67,59,152,129,26,219,211,254,141,111,124,211,187,122,245,234,13,190,240,133,47,181,148,205,71,9,31,194,86,52,124,10,142,88,153,98,72,108,83,45,254,248,248,233,2,157,56,58,39,
+78,76,250,149,61,155,205,243,212,171,226,135,156,59,119,177,165,108,62,74,120,21,154,138,244,130,154,98,73,140,211,42,254,76,92,241,117,91,127,225,133,175,26,19,224,79,127,250,147,223,92,106,37,155,
+183,137,110,74,2,98,103,73,130,116,245,19,136,101,229,176,45,19,140,146,149,171,212,205,206,126,202,152,0,48,63,255,195,150,179,249,40,238,189,247,67,55,96,242,138,45,174,196,60,45,226,119,9,37,211,
+69,50,108,27,167,54,207,4,142,95,255,250,223,172,73,240,249,207,127,177,229,108,62,74,120,21,122,71,45,9,64,204,27,63,118,32,54,181,128,85,233,236,220,217,159,168,25,119,244,232,136,53,1,96,124,252,
+84,203,217,188,77,116,21,54,192,228,65,50,197,152,216,55,84,124,169,168,204,82,89,209,97,64,167,146,102,220,211,79,127,218,154,0,111,191,253,123,121,157,60,214,114,54,111,19,93,135,190,19,83,172,209,
+160,81,226,119,155,46,136,25,59,43,105,187,191,242,202,171,214,36,248,206,119,254,79,75,218,124,148,240,42,204,56,178,36,65,253,39,149,140,141,141,47,50,217,65,103,211,166,45,43,106,187,111,222,252,
+49,239,183,191,253,173,53,9,158,121,230,51,45,105,243,81,176,55,49,80,153,54,197,28,45,234,45,254,148,233,66,232,206,172,70,167,205,177,99,39,34,235,3,195,195,199,90,210,230,77,162,235,208,170,178,36,
+65,125,230,24,30,59,118,178,83,240,116,152,29,91,205,78,155,103,159,253,156,53,1,222,122,235,45,191,157,220,138,54,111,19,62,132,205,171,169,99,153,52,64,155,154,39,192,232,232,137,188,224,233,208,
+102,173,118,23,237,247,190,247,154,53,9,190,245,173,185,150,180,249,40,225,67,136,171,73,3,180,169,181,248,89,211,137,105,242,213,162,111,126,235,214,30,239,15,127,248,131,53,9,158,124,242,169,150,
+180,121,155,240,42,52,13,45,73,80,187,197,39,35,35,199,231,152,196,161,194,244,166,240,189,95,139,190,249,137,137,211,145,245,129,253,251,15,181,164,205,71,193,151,82,248,57,90,92,186,30,104,84,43,
+241,179,134,147,249,235,232,106,221,55,255,197,47,126,217,154,0,191,250,213,175,252,228,107,53,155,183,9,175,66,139,203,164,9,90,85,61,1,134,135,199,10,172,191,83,161,93,90,175,46,218,31,253,232,199,
+214,36,40,20,190,222,146,54,111,19,94,133,153,85,186,46,104,85,85,241,135,134,142,117,50,119,77,135,241,253,122,245,205,239,216,209,231,45,47,47,91,147,224,242,229,233,150,179,249,114,240,193,42,42,
+223,38,109,208,172,154,9,48,163,159,64,127,250,235,209,55,127,238,220,133,200,250,64,127,255,96,203,217,188,73,116,29,22,201,26,18,160,122,67,198,71,143,142,22,153,183,175,66,45,180,17,67,176,207,63,
+255,130,53,1,126,254,243,159,183,164,205,219,132,15,97,196,80,215,7,205,170,37,126,143,225,224,126,183,100,163,70,226,94,127,253,231,214,36,32,65,90,205,230,163,224,171,104,92,139,73,35,180,91,113,2,
+28,57,50,114,133,93,50,84,88,176,217,200,65,25,172,254,221,119,223,181,38,193,217,179,231,91,206,230,77,194,171,48,217,86,215,9,237,86,36,190,180,241,87,9,37,218,250,42,76,92,108,244,16,236,227,143,
+63,97,77,0,42,139,61,61,59,91,202,230,77,162,171,208,23,163,235,20,104,183,106,37,9,208,171,31,148,102,71,90,70,226,94,124,177,96,77,2,154,141,173,100,243,81,240,129,75,96,60,198,144,4,189,21,39,192,
+161,67,255,63,123,111,246,93,199,85,230,253,159,63,192,55,186,244,117,18,37,113,18,39,65,228,34,107,137,181,200,96,144,59,35,78,228,65,146,45,235,200,179,101,203,242,60,219,74,162,6,209,68,12,77,211,
+12,77,55,228,16,56,128,1,67,32,13,52,162,7,134,110,4,77,154,87,192,219,77,43,161,187,95,17,56,157,43,223,250,226,212,239,249,212,175,202,84,118,158,93,167,206,209,25,118,29,237,189,214,103,217,203,
+150,106,120,190,79,125,107,207,53,81,162,183,41,9,35,126,174,12,193,114,172,159,253,236,95,83,167,146,117,147,205,219,132,143,97,164,208,212,11,13,87,146,0,21,243,128,180,59,93,26,130,29,31,223,147,
+218,52,60,118,236,100,215,216,188,38,122,18,122,68,149,4,104,172,53,176,119,239,193,62,33,72,66,219,223,197,33,216,247,190,247,253,214,4,96,48,137,192,116,139,205,219,184,247,222,251,66,232,19,48,117,
+67,203,70,18,96,210,60,16,187,118,184,58,4,251,149,175,124,53,117,66,105,183,216,188,77,248,24,94,209,74,2,76,214,157,0,242,180,151,121,226,147,176,118,205,213,177,119,250,37,22,23,23,173,175,129,110,
+177,121,155,240,49,188,162,77,221,208,178,238,4,16,43,89,194,78,146,176,195,166,203,51,109,246,237,59,248,22,241,127,253,235,95,135,215,208,77,54,111,227,158,123,222,30,234,97,234,134,150,245,138,223,
+163,28,228,45,214,239,226,16,44,118,191,176,176,16,246,5,124,247,187,127,23,12,13,109,239,58,155,215,132,143,225,231,53,237,208,52,115,2,72,91,191,159,246,126,18,246,233,91,13,51,109,242,96,243,154,
+240,73,88,67,96,234,135,166,245,36,64,209,60,0,149,139,213,48,211,38,15,54,95,11,134,233,149,4,200,190,150,112,124,124,239,12,189,74,73,168,0,174,150,153,54,174,219,188,198,221,119,247,221,128,138,
+160,169,31,154,102,78,128,98,113,79,137,109,214,147,208,255,239,109,222,29,155,215,132,143,161,69,100,234,135,166,245,36,192,188,121,0,86,240,122,155,119,199,230,53,225,99,168,167,41,9,144,125,119,
+145,177,177,221,139,236,92,149,132,209,38,111,243,238,216,188,198,250,245,111,11,33,94,166,126,104,90,79,2,44,155,7,96,244,207,219,188,59,54,175,9,31,195,117,43,9,176,156,57,1,118,238,220,117,141,229,
+71,73,176,21,111,243,238,216,188,38,124,12,199,55,245,67,211,204,9,48,58,58,126,157,207,175,36,169,37,188,183,249,206,60,237,54,76,253,208,180,158,4,168,154,7,240,54,239,182,240,119,221,117,239,155,
+80,18,160,154,57,1,118,236,40,86,233,249,75,226,109,222,45,155,183,9,31,99,234,135,166,245,36,192,117,45,1,188,205,187,99,243,54,225,129,255,87,18,32,251,43,96,251,246,177,107,124,220,32,9,117,0,111,
+243,110,217,188,201,157,119,222,19,194,177,76,253,208,52,115,2,140,140,236,92,102,64,33,9,173,0,111,243,110,217,188,41,124,12,215,109,234,135,166,245,36,192,162,121,0,250,1,188,205,187,99,243,154,240,
+49,196,72,73,128,236,29,65,195,195,163,243,76,255,74,66,79,160,183,249,251,156,123,218,53,120,72,77,253,208,180,158,4,40,153,7,96,44,192,219,188,187,194,223,113,199,221,55,96,226,142,146,0,217,7,131,
+134,134,118,204,176,252,43,9,67,140,222,230,221,177,121,77,248,24,190,196,98,234,135,166,153,19,96,219,182,237,69,246,253,73,194,10,84,111,243,238,216,188,38,124,12,15,171,169,31,154,214,147,0,253,
+230,1,216,10,198,219,188,59,54,175,177,110,221,250,16,86,8,41,9,144,125,74,216,214,173,35,61,236,211,111,98,90,191,183,249,206,217,188,38,60,240,243,154,118,104,90,215,204,96,249,133,37,243,32,52,5,
+189,205,187,97,243,166,240,49,196,87,17,127,169,238,117,1,91,182,12,151,153,8,154,132,150,128,183,121,119,158,118,13,30,82,83,55,180,172,59,1,54,111,30,154,100,211,129,36,108,228,236,109,222,77,225,
+111,191,253,174,16,62,70,105,234,134,150,141,36,64,159,121,32,54,93,240,54,223,121,155,215,132,143,97,239,38,37,1,26,251,178,136,8,94,65,244,36,116,50,120,155,239,236,211,174,9,15,196,223,212,11,13,
+27,222,31,64,126,185,100,30,144,245,129,222,230,59,107,243,54,232,174,87,18,160,241,13,34,196,78,134,176,148,36,180,49,189,205,119,214,230,77,110,187,237,206,16,62,207,103,234,133,134,43,73,128,53,66,
+213,60,40,67,195,222,230,59,99,243,154,240,64,220,21,241,209,174,241,77,162,40,79,61,181,229,10,189,128,73,248,88,131,183,249,206,60,237,166,240,49,172,6,50,117,66,187,21,239,19,184,105,211,230,65,22,
+27,154,208,18,240,54,223,126,155,215,224,248,154,70,104,215,148,221,66,229,64,21,243,224,84,56,188,205,183,215,230,53,110,189,245,142,112,186,158,34,126,115,182,138,165,72,197,111,150,202,95,18,58,
+133,188,205,183,215,230,77,225,99,248,110,128,169,15,154,53,51,1,122,149,19,132,125,2,222,230,219,99,243,166,232,49,241,151,196,20,154,251,1,169,39,159,124,186,204,30,1,73,88,50,238,109,126,125,71,
+132,143,161,235,215,212,5,173,154,254,197,16,105,99,246,211,206,52,193,5,188,205,183,222,230,109,79,191,166,9,90,181,228,187,65,114,224,171,230,201,120,255,120,155,111,207,211,30,211,219,187,46,252,
+147,153,63,138,248,173,249,104,20,229,241,199,55,245,51,53,204,132,15,71,120,155,111,173,240,136,158,132,154,191,166,5,26,181,244,219,129,114,130,146,118,98,250,5,188,205,183,94,120,224,222,44,226,
+183,246,195,145,20,105,254,245,210,4,52,217,176,97,163,183,249,38,219,188,13,250,96,52,13,208,166,45,223,15,150,247,254,52,239,126,19,198,8,188,205,55,247,105,79,114,203,45,183,135,21,63,45,246,104,
+210,214,47,136,203,9,23,181,11,225,85,224,109,190,249,194,3,247,107,17,191,189,159,143,167,60,242,200,19,3,244,3,152,48,111,208,219,252,202,109,62,41,124,12,11,62,180,152,163,69,161,19,69,78,60,167,
+93,16,173,2,111,243,205,17,61,134,189,25,45,226,207,21,58,89,164,45,186,64,123,212,132,102,138,183,249,149,11,15,188,86,181,24,19,251,66,167,203,198,141,143,245,9,85,186,36,77,88,72,226,109,190,113,
+225,129,14,54,45,182,81,204,251,10,46,20,185,144,162,229,34,195,236,245,54,95,159,232,112,243,205,183,133,14,106,139,43,49,47,184,84,6,6,30,157,101,166,144,9,147,72,153,56,226,109,126,93,38,209,99,
+136,9,177,211,98,74,172,11,46,22,185,176,178,118,193,180,12,180,36,240,54,255,86,225,99,241,137,153,69,252,114,193,229,34,89,59,79,230,154,36,147,192,219,188,46,60,240,154,36,86,90,12,137,109,193,245,
+34,23,223,35,44,112,19,26,212,9,188,205,235,208,121,102,139,91,20,211,158,66,30,138,92,232,90,225,21,219,205,208,58,88,237,54,111,130,59,166,136,79,44,215,22,242,84,54,108,216,184,86,88,96,144,72,131,
+126,130,213,106,243,73,110,186,233,214,240,129,176,197,41,138,97,190,196,79,36,65,143,48,111,187,57,122,12,177,189,213,100,243,177,232,192,253,48,163,42,69,124,98,215,83,200,123,121,248,225,129,50,
+253,216,54,168,23,172,6,155,143,133,7,58,120,210,98,66,204,10,221,84,228,134,102,211,110,152,161,100,58,62,186,213,230,99,184,102,94,127,53,196,159,45,116,99,121,232,161,119,23,133,42,203,152,108,48,
+222,157,7,225,235,17,29,226,138,94,218,189,71,177,41,22,186,185,60,248,224,187,250,132,5,102,181,216,160,110,192,122,131,188,219,124,12,245,28,182,110,73,187,231,40,38,125,133,213,82,228,102,231,106,
+4,228,198,148,243,188,217,124,76,252,5,175,90,247,73,44,10,171,177,60,240,192,134,1,97,81,8,210,32,17,176,79,94,13,46,219,60,240,123,204,141,68,248,90,247,21,221,251,64,97,181,23,9,194,116,134,96,133,
+80,71,160,187,212,53,225,105,194,210,154,201,122,31,220,115,193,151,63,22,121,239,247,10,37,222,255,89,224,9,99,151,146,56,25,58,97,243,136,142,51,113,45,89,175,59,186,199,94,175,184,165,72,101,169,
+95,184,74,165,41,43,188,34,232,77,163,190,64,215,114,50,33,154,37,58,127,231,21,68,133,14,23,226,156,245,92,99,116,79,253,94,225,250,18,161,92,103,144,111,64,91,27,75,166,53,65,101,140,196,136,235,16,
+113,98,196,34,243,247,120,185,21,173,13,158,108,156,133,132,226,24,124,47,169,209,235,136,238,193,11,223,104,145,39,173,87,152,21,42,60,117,57,161,18,93,179,183,250,38,39,195,160,112,69,168,58,40,122,
+53,186,182,65,175,84,139,139,84,186,214,8,67,66,73,168,80,9,235,16,149,232,26,184,150,53,94,153,14,149,254,254,119,246,9,147,66,89,88,98,14,125,139,88,138,206,193,185,250,124,228,221,77,136,30,161,95,
+40,10,51,66,73,152,23,22,133,101,225,154,112,93,168,70,92,143,254,109,57,250,153,249,232,119,102,162,99,112,172,30,31,89,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,
+241,197,23,103,202,244,244,76,143,208,47,20,133,25,161,36,204,11,139,194,178,112,77,184,46,84,35,174,71,255,182,28,253,204,124,244,59,51,209,49,56,150,239,10,118,88,240,62,97,82,40,11,75,66,208,34,
+150,162,115,112,46,63,24,212,169,114,249,242,115,107,132,33,161,36,84,132,160,67,84,162,107,224,90,252,112,112,171,203,165,75,207,14,10,87,132,170,16,56,70,53,186,54,63,33,164,201,162,247,10,179,66,
+197,65,209,109,84,162,107,246,83,194,26,45,23,47,62,211,47,148,133,160,17,78,156,56,19,28,60,56,25,20,139,123,130,225,225,209,240,59,122,236,168,205,254,122,108,183,194,34,204,120,77,30,127,103,35,6,
+118,223,226,103,248,228,218,208,208,142,96,108,108,119,112,224,192,225,224,248,241,211,65,163,215,17,221,131,159,20,90,167,240,87,235,9,242,249,243,151,131,67,135,166,130,209,209,241,240,139,89,136,
+25,175,180,173,177,24,179,230,178,173,120,33,7,199,226,115,44,219,183,143,5,19,19,71,194,115,214,153,8,87,125,34,164,148,11,23,166,123,133,146,16,100,225,212,169,115,193,238,221,251,195,39,219,92,94,
+189,82,209,147,194,167,193,199,153,198,199,247,6,39,79,158,13,178,94,119,116,143,254,213,144,44,242,52,77,243,68,101,97,223,190,9,85,244,102,62,237,54,210,86,252,144,12,123,246,28,8,178,222,7,247,236,
+133,63,127,121,64,88,172,21,44,222,231,59,118,20,195,125,242,92,19,30,146,11,65,184,30,234,28,212,27,50,36,1,247,190,58,23,135,158,59,119,105,78,8,210,56,122,244,100,88,25,107,133,232,205,22,94,99,
+243,230,161,96,106,234,68,80,235,62,137,197,106,18,190,79,88,72,11,8,79,60,79,145,139,79,123,22,225,205,69,35,91,182,12,135,142,80,35,9,136,73,119,247,46,158,61,123,177,40,84,133,192,198,206,157,187,
+194,29,178,92,182,249,172,194,39,225,255,105,65,164,221,123,20,155,238,220,34,230,204,153,11,179,66,96,131,54,59,109,240,188,217,124,173,37,99,230,106,34,234,49,251,247,31,10,210,98,65,172,186,77,252,
+114,218,13,143,140,236,204,189,205,215,18,222,100,235,214,145,90,73,144,255,109,226,78,159,62,223,35,204,11,129,198,225,195,71,195,175,93,118,139,205,103,17,62,185,212,140,158,71,58,149,108,241,137,
+98,215,147,87,241,215,10,11,182,155,219,181,107,95,170,232,251,246,29,12,78,157,58,27,246,236,229,205,230,107,9,111,66,151,115,74,18,16,195,124,109,21,123,234,212,185,181,194,43,244,214,105,96,249,
+105,79,250,183,190,245,114,240,198,27,111,220,96,102,230,189,185,180,249,90,139,77,217,196,34,134,150,130,45,94,81,44,215,230,69,252,30,97,193,118,51,180,141,211,196,255,240,135,255,252,77,226,199,
+140,140,140,230,210,230,107,9,159,132,177,134,148,36,32,166,238,191,14,78,158,60,59,79,223,184,9,237,96,236,188,214,187,253,219,223,254,142,154,0,47,191,252,183,185,182,249,52,225,99,216,138,134,79,
+193,17,43,45,134,196,214,105,241,79,156,56,83,166,19,199,228,216,177,83,97,101,47,75,165,238,197,23,191,160,38,0,92,190,252,108,174,109,62,77,248,36,52,21,233,5,213,98,73,140,93,21,127,54,171,248,105,
+21,186,29,59,198,172,9,240,159,255,249,159,242,132,60,158,107,155,183,137,174,37,1,177,179,36,129,91,253,4,98,89,69,108,75,131,81,178,122,59,109,62,242,145,143,90,147,224,197,23,63,159,123,155,79,227,
+254,251,223,113,3,38,175,216,226,74,204,93,17,191,79,168,106,23,201,176,109,163,77,184,127,249,151,159,88,147,96,114,242,104,238,109,62,77,248,36,244,142,90,18,128,152,119,126,236,64,108,106,1,171,50,
+217,182,109,251,138,218,238,135,14,29,177,38,192,194,194,79,187,194,230,109,162,39,97,3,76,30,36,45,198,196,190,163,226,75,69,101,142,202,138,9,3,58,205,232,180,121,225,133,207,89,147,224,163,31,253,
+88,87,216,188,77,116,19,250,78,180,88,163,65,167,196,31,208,46,136,25,59,205,234,180,97,242,230,191,255,251,127,88,147,128,209,181,110,176,249,52,225,147,48,227,200,146,4,237,159,84,50,53,117,98,145,
+201,14,38,143,62,250,100,83,187,104,47,92,184,100,77,128,239,124,231,187,93,99,243,105,176,55,49,80,153,214,98,142,22,237,22,127,90,187,16,186,51,91,209,91,247,210,75,223,180,38,193,51,207,204,116,
+141,205,107,162,155,208,170,178,36,65,123,230,24,30,57,114,188,87,8,76,152,29,219,170,190,121,18,171,82,169,168,9,240,218,107,191,21,215,121,162,107,108,222,38,124,12,155,87,83,199,210,52,64,155,150,
+39,192,228,228,177,146,16,152,208,102,109,101,223,252,243,207,127,208,234,2,95,248,194,23,187,198,230,211,132,143,33,174,154,6,104,211,106,241,251,181,19,211,228,107,71,223,252,15,126,240,67,107,18,
+76,77,29,235,26,155,183,9,159,132,166,161,37,9,90,183,248,228,240,225,163,87,153,196,145,132,233,77,241,123,191,213,125,243,123,247,30,176,38,192,191,254,235,207,187,202,230,211,224,75,41,252,28,45,
+46,83,15,52,106,149,248,253,202,201,194,117,116,237,236,155,255,244,167,255,198,154,4,31,251,216,199,187,198,230,109,194,39,161,197,165,105,130,86,77,79,128,67,135,166,202,172,191,75,66,187,180,221,
+35,113,56,205,47,127,249,75,107,18,140,142,22,187,198,230,109,194,39,97,102,149,169,11,90,53,85,252,137,137,35,189,204,93,51,97,124,191,19,131,50,167,78,157,177,38,192,247,190,55,223,53,54,95,11,62,
+88,69,229,91,211,6,205,154,153,0,179,230,9,204,167,191,221,125,243,95,253,234,215,172,73,240,220,115,239,237,26,155,215,68,55,97,145,172,146,0,205,27,50,62,120,112,178,194,188,253,36,212,66,59,57,4,
+251,158,247,60,29,252,238,119,191,83,19,224,127,254,231,127,130,199,30,123,79,215,216,188,77,248,24,70,12,77,125,208,172,89,226,15,42,7,15,187,37,59,61,18,247,222,247,206,90,93,224,203,95,190,210,53,
+54,159,6,95,69,227,90,52,141,208,110,197,9,112,224,192,225,43,236,146,145,132,5,155,174,12,193,254,253,223,255,131,53,9,142,29,59,209,53,54,175,9,159,132,201,182,166,78,104,183,34,241,165,141,191,70,
+168,210,214,79,194,196,69,87,134,96,199,198,118,89,19,224,23,191,248,197,141,87,64,222,109,94,19,61,9,125,49,166,78,145,118,107,86,146,0,67,230,65,105,118,184,54,4,251,241,143,127,210,154,4,159,248,
+196,39,187,194,230,211,224,3,151,192,120,140,146,4,67,13,39,192,190,125,19,37,122,155,146,48,48,227,226,16,236,191,253,219,191,89,147,0,151,232,6,155,183,9,31,195,72,161,169,23,26,174,36,1,42,230,1,
+105,119,186,56,211,102,106,234,184,53,1,168,39,116,131,205,107,162,39,161,147,76,73,128,198,90,3,123,247,30,236,19,130,36,180,253,93,158,105,243,197,47,126,201,154,4,7,14,28,234,10,155,183,113,239,
+189,247,133,208,39,96,234,134,150,141,36,192,164,121,32,118,237,112,121,166,13,238,244,223,255,253,223,106,2,156,61,123,161,43,108,222,38,124,12,175,104,37,1,38,235,78,0,121,218,203,60,241,73,88,187,
+230,250,76,155,233,233,231,212,4,120,234,169,205,93,97,243,54,225,99,120,8,76,221,208,178,238,4,16,43,89,194,78,146,48,73,51,15,51,109,94,120,161,244,150,213,197,221,100,243,54,238,185,231,237,161,30,
+166,110,104,89,175,248,61,202,65,222,98,253,46,207,180,25,28,220,26,190,247,73,218,110,179,121,77,248,24,126,94,211,14,77,51,39,128,180,245,251,105,239,39,97,159,190,213,48,211,38,15,54,175,9,159,132,
+53,4,166,126,104,90,79,2,20,205,3,80,185,88,13,51,109,242,96,243,181,96,152,94,73,128,236,107,9,199,199,247,206,208,171,148,132,10,224,106,153,105,227,186,205,107,220,125,119,223,13,168,8,154,250,161,
+105,230,4,40,22,247,148,216,102,61,9,253,255,222,230,221,177,121,77,248,24,70,106,77,253,208,180,158,4,152,55,15,192,22,236,222,230,221,177,121,77,248,24,234,105,74,2,100,223,93,100,108,108,247,34,59,
+87,37,97,180,201,219,188,59,54,175,177,126,253,219,66,136,151,169,31,154,214,147,0,203,230,1,24,253,243,54,239,142,205,107,194,199,112,221,74,2,44,103,78,128,157,59,119,93,99,249,81,18,108,197,219,
+188,59,54,175,9,31,195,241,77,253,208,52,115,2,140,142,142,95,231,243,43,73,106,9,239,109,190,51,79,187,13,83,63,52,173,39,1,170,230,1,188,205,187,45,252,93,119,221,251,38,148,4,168,102,78,128,29,59,
+138,85,122,254,146,120,155,119,203,230,109,194,199,152,250,161,105,61,9,112,93,75,0,111,243,238,216,188,77,120,224,255,149,4,200,254,10,216,190,125,236,26,219,175,36,161,14,224,109,222,45,155,55,185,
+243,206,123,66,56,150,169,31,154,102,78,128,145,145,157,203,12,40,36,161,21,224,109,222,45,155,55,133,143,225,186,77,253,208,180,158,4,88,52,15,64,63,128,183,121,119,108,94,19,62,134,24,41,9,144,189,
+35,104,120,120,116,158,233,95,73,232,9,244,54,127,159,115,79,187,6,15,169,169,31,154,214,147,0,37,243,0,140,5,120,155,119,87,248,59,238,184,251,6,76,220,81,18,32,251,96,208,208,208,142,25,150,127,37,
+97,136,209,219,188,59,54,175,9,31,195,151,88,76,253,208,52,115,2,108,219,182,189,200,190,63,73,88,129,234,109,222,29,155,215,132,143,225,97,53,245,67,211,122,18,160,223,60,0,91,193,120,155,119,199,
+230,53,214,173,91,31,194,10,33,37,1,178,79,9,219,186,117,164,135,207,154,153,152,214,239,109,190,115,54,175,9,15,252,188,166,29,154,214,53,51,88,126,97,201,60,8,77,65,111,243,110,216,188,41,124,12,
+241,85,196,95,170,123,93,192,150,45,195,101,38,130,38,161,37,224,109,222,157,167,93,35,222,89,213,160,254,133,33,155,55,15,77,178,233,64,18,182,93,241,54,239,166,240,183,223,126,87,8,31,163,52,117,67,
+203,70,18,160,207,60,208,224,224,54,111,243,14,216,188,38,124,12,123,55,41,9,208,216,151,69,68,240,10,162,39,161,147,193,219,124,103,159,118,77,120,32,254,166,94,104,216,240,254,0,242,203,37,243,128,
+44,181,242,54,223,89,155,183,65,119,189,146,0,141,111,16,33,118,50,132,165,36,161,141,233,109,190,179,54,111,114,219,109,119,134,240,121,62,83,47,52,92,73,2,172,17,170,230,65,25,26,246,54,223,25,155,
+215,132,7,226,174,136,143,118,141,111,18,69,121,234,169,45,87,232,5,76,194,71,13,189,205,119,230,105,55,133,143,97,53,144,169,19,218,173,120,159,192,77,155,54,15,178,216,208,132,150,128,183,249,246,
+219,188,6,199,215,52,66,187,166,236,22,42,7,170,152,7,167,194,225,109,190,189,54,175,113,235,173,119,132,211,245,20,241,155,179,85,44,69,42,126,179,84,254,146,208,41,228,109,190,189,54,111,10,31,195,
+119,3,76,125,208,172,153,9,208,171,156,32,236,19,240,54,223,30,155,55,69,143,137,191,36,166,208,220,15,72,61,249,228,211,101,246,8,72,194,146,113,111,243,235,59,34,124,12,93,191,166,46,104,213,244,47,
+134,72,27,179,159,118,166,9,46,224,109,190,245,54,111,123,250,53,77,208,170,37,223,13,146,3,95,53,79,198,251,199,219,124,123,158,246,152,222,222,117,225,159,204,252,81,196,111,205,71,163,40,143,63,
+190,169,159,169,97,38,124,56,194,219,124,107,133,71,244,36,212,252,53,45,208,168,165,223,14,148,19,148,180,19,211,47,224,109,190,245,194,3,247,102,17,191,181,31,142,164,72,243,175,151,38,160,201,134,
+13,27,189,205,55,217,230,109,208,7,163,105,128,54,109,249,126,176,188,247,167,121,247,155,48,70,224,109,190,185,79,123,146,91,110,185,61,172,248,105,177,71,147,182,126,65,92,78,184,168,93,8,175,2,111,
+243,205,23,30,184,95,139,248,237,253,124,60,229,145,71,158,24,160,31,192,132,121,131,222,230,87,110,243,73,225,99,88,240,161,197,28,45,10,157,40,114,226,57,237,130,104,21,120,155,111,142,232,49,236,
+205,104,17,127,174,208,201,34,109,209,5,218,163,38,52,83,188,205,175,92,120,224,181,170,197,152,216,23,58,93,54,110,124,172,79,168,210,37,105,194,66,18,111,243,141,11,15,116,176,105,177,141,98,222,87,
+112,161,200,133,20,45,23,25,102,175,183,249,250,68,135,155,111,190,45,116,80,91,92,137,121,193,165,50,48,240,232,44,51,133,76,152,68,202,196,17,111,243,235,50,137,30,67,76,136,157,22,83,98,93,112,177,
+200,133,149,181,11,166,101,160,37,129,183,249,183,10,31,139,79,204,44,226,151,11,46,23,201,218,121,50,215,36,153,4,222,230,117,225,129,215,36,177,210,98,72,108,11,174,23,185,248,30,97,129,155,208,160,
+78,224,109,94,135,206,51,91,220,162,152,246,20,242,80,228,66,215,10,175,216,110,134,214,193,106,183,121,19,220,49,69,124,98,185,182,144,167,178,97,195,198,181,194,2,131,68,26,244,19,172,86,155,79,114,
+211,77,183,134,15,132,45,78,81,12,243,37,126,34,9,122,132,121,219,205,209,99,136,237,173,38,155,143,69,7,238,135,25,85,41,226,19,187,158,66,222,203,195,15,15,148,233,199,182,65,189,96,53,216,124,44,
+60,208,193,147,22,19,98,86,232,166,34,55,52,155,118,195,12,37,211,241,209,173,54,31,195,53,243,250,171,33,254,108,161,27,203,67,15,189,187,40,84,89,198,100,131,241,238,60,8,95,143,232,16,87,244,210,
+238,61,138,77,177,208,205,229,193,7,223,213,39,44,48,171,197,6,117,3,214,27,228,221,230,99,168,231,176,117,75,218,61,71,49,233,43,172,150,34,55,59,87,35,32,55,166,156,231,205,230,99,226,47,120,213,
+186,79,98,81,88,141,229,129,7,54,12,8,139,66,144,6,137,128,125,242,106,112,217,230,129,223,99,110,36,194,215,186,175,232,222,7,10,171,189,72,16,166,51,4,43,132,58,2,221,165,174,9,79,19,150,214,76,214,
+251,224,158,11,190,252,177,200,123,191,87,40,241,254,207,2,79,24,187,148,196,201,208,9,155,71,116,156,137,107,201,122,221,209,61,246,122,197,45,69,42,75,253,194,85,42,77,89,225,21,65,111,26,245,5,186,
+150,147,9,209,44,209,249,59,175,32,42,116,184,16,231,172,231,26,163,123,234,247,10,215,151,8,229,58,131,124,3,218,218,88,50,173,9,42,99,36,70,92,135,136,19,35,22,153,191,199,203,173,104,109,240,100,
+227,44,36,20,199,224,123,73,141,94,71,116,15,94,248,70,139,60,105,189,194,172,80,225,169,203,9,149,232,154,189,213,55,57,25,6,133,43,66,213,65,209,171,209,181,13,122,165,90,92,164,210,181,70,24,18,74,
+66,133,74,88,135,168,68,215,192,181,172,241,202,116,168,244,247,191,179,79,152,20,202,194,18,115,232,91,196,82,116,14,206,213,231,35,239,110,66,244,8,253,66,81,152,17,74,194,188,176,40,44,11,215,132,
+235,66,53,226,122,244,111,203,209,207,204,71,191,51,19,29,131,99,245,248,200,250,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,56,83,166,167,103,122,132,
+126,161,40,204,8,37,97,94,88,20,150,133,107,194,117,161,26,113,61,250,183,229,232,103,230,163,223,153,137,142,193,177,124,87,176,195,130,247,9,147,66,89,88,18,130,22,177,20,157,131,115,249,193,160,78,
+149,203,151,159,91,35,12,9,37,161,34,4,29,162,18,93,3,215,226,135,131,91,93,46,93,122,118,80,184,34,84,133,192,49,170,209,181,249,9,33,77,22,189,87,152,21,42,14,138,110,163,18,93,179,159,18,214,104,
+185,120,241,153,126,161,44,4,141,112,226,196,153,224,224,193,201,160,88,220,19,12,15,143,134,223,209,99,71,109,246,215,99,187,21,22,97,198,107,242,248,59,27,49,176,251,22,63,195,39,215,134,134,118,4,
+99,99,187,131,3,7,14,7,199,143,159,14,26,189,142,232,30,252,164,208,58,133,191,90,79,144,207,159,191,28,28,58,52,21,140,142,142,135,95,204,66,204,120,165,109,141,197,152,53,151,109,197,11,57,56,22,
+159,99,217,190,125,44,152,152,56,18,158,179,206,68,184,234,19,33,165,92,184,48,221,43,148,132,32,11,167,78,157,11,118,239,222,31,62,217,230,242,234,149,138,158,20,62,13,62,206,52,62,190,55,56,121,242,
+108,144,245,186,163,123,244,175,134,100,145,167,105,154,39,42,11,251,246,77,168,162,55,243,105,183,145,182,226,135,100,216,179,231,64,144,245,62,184,103,47,252,249,203,3,194,98,173,96,241,62,223,177,
+163,24,238,147,231,154,240,144,92,8,194,245,80,231,160,222,144,33,9,184,247,213,185,56,244,220,185,75,115,66,144,198,209,163,39,195,202,88,43,68,111,182,240,26,155,55,15,5,83,83,39,130,90,247,73,44,
+86,147,240,125,194,66,90,64,120,226,121,138,92,124,218,179,8,111,46,26,217,178,101,56,116,132,26,73,64,76,186,187,119,241,236,217,139,69,161,42,4,54,118,238,220,21,238,144,229,178,205,103,21,62,9,255,
+79,11,34,237,222,163,216,116,231,22,49,103,206,92,152,21,2,27,180,217,105,131,231,205,230,107,45,25,51,87,19,81,143,217,191,255,80,144,22,11,98,213,109,226,151,211,110,120,100,100,103,77,225,249,58,
+134,203,54,95,75,120,147,173,91,71,106,37,65,254,183,137,59,125,250,124,143,48,47,4,26,135,15,31,13,191,118,153,38,252,135,63,252,231,193,111,127,251,219,224,141,55,222,8,126,244,163,31,75,83,107,191,
+179,54,159,69,248,228,82,51,122,30,233,84,178,197,39,138,93,79,94,197,95,43,44,216,110,110,215,174,125,53,109,254,194,133,203,161,240,73,126,249,203,95,57,111,243,181,132,55,161,203,57,37,9,136,97,
+190,182,138,61,117,234,220,90,225,21,122,235,52,176,252,44,239,247,111,124,227,165,183,36,0,124,232,67,31,201,133,205,215,90,108,202,38,22,49,180,20,108,241,138,98,185,54,47,226,247,8,11,182,155,161,
+109,156,181,98,247,213,175,94,85,19,128,87,194,198,141,143,230,194,230,107,9,159,132,177,134,148,36,32,166,238,191,14,78,158,60,59,79,223,184,9,237,96,6,106,234,169,205,31,63,126,82,77,0,248,248,199,
+63,153,43,155,79,19,62,134,173,104,168,236,18,43,45,134,196,214,105,241,79,156,56,83,166,19,199,228,216,177,83,97,101,175,145,182,251,119,191,251,119,106,2,252,254,247,127,8,159,152,60,217,124,154,
+240,73,104,42,210,11,170,197,146,24,187,42,254,108,86,241,235,105,198,29,56,112,200,234,2,159,249,204,11,185,179,121,155,232,90,18,16,59,75,18,184,213,79,32,150,85,196,182,52,24,37,91,105,167,205,215,
+191,254,146,53,9,182,109,27,201,157,205,167,113,255,253,239,184,1,147,87,108,113,37,230,174,136,223,39,84,181,139,100,216,182,25,157,54,99,99,187,172,9,240,197,47,126,41,151,54,159,38,124,18,122,71,
+45,9,64,204,59,63,118,32,54,181,128,85,153,108,219,182,189,169,189,117,229,242,151,172,73,64,130,228,209,230,109,162,39,97,3,76,30,36,45,198,196,190,163,226,75,69,101,142,202,138,9,3,58,205,238,173,
+163,235,212,150,0,95,255,250,55,114,107,243,54,209,77,232,59,209,98,141,6,157,18,127,64,187,32,102,236,180,170,111,254,111,254,230,179,214,36,216,191,127,34,183,54,159,38,124,18,102,28,89,146,160,253,
+147,74,166,166,78,44,50,217,193,228,209,71,159,108,89,23,237,19,79,108,146,230,223,239,213,4,248,206,119,254,46,215,54,159,6,123,19,3,149,105,45,230,104,209,110,241,167,181,11,161,59,179,213,125,243,
+31,251,216,199,173,46,48,53,117,60,215,54,175,137,110,66,171,202,146,4,237,153,99,120,228,200,241,94,33,48,97,118,108,59,250,230,153,44,242,218,107,175,169,9,240,79,255,244,131,220,219,188,77,248,24,
+54,175,166,142,165,105,128,54,45,79,128,201,201,99,37,33,48,161,205,218,174,190,249,231,159,255,160,213,5,206,156,57,159,107,155,79,19,62,134,184,106,26,160,77,171,197,239,215,78,76,147,175,221,67,
+176,191,250,213,175,213,4,248,233,79,127,154,123,155,183,9,159,132,166,161,37,9,90,183,248,228,240,225,163,87,153,196,145,132,233,77,241,123,191,157,67,176,207,61,247,167,86,23,120,230,153,231,114,
+111,243,105,240,165,20,126,142,22,151,169,7,26,181,74,252,126,229,100,225,58,186,78,13,193,254,236,103,255,170,38,192,226,226,47,115,111,243,54,225,147,208,226,210,52,65,171,166,39,192,161,67,83,101,
+214,223,37,161,93,218,201,145,184,115,231,46,90,93,224,253,239,127,62,247,54,111,19,62,9,51,171,76,93,208,170,169,226,79,76,28,233,101,238,154,9,227,251,157,30,130,253,193,15,126,168,38,192,210,210,
+146,188,150,30,206,181,205,215,130,15,86,81,249,214,180,65,179,102,38,192,172,121,2,243,233,239,212,16,236,209,163,199,173,46,240,231,127,254,23,185,183,121,77,116,19,22,201,42,9,208,188,33,227,131,7,
+39,43,204,219,79,66,45,212,149,33,88,219,164,145,223,253,238,119,225,204,219,188,219,188,77,248,24,70,12,77,125,208,172,89,226,15,42,7,15,187,37,93,25,130,221,183,239,160,213,5,62,245,169,79,231,222,
+230,211,224,171,104,92,139,166,17,218,173,56,1,14,28,56,124,133,93,50,146,176,96,211,181,177,119,219,12,98,160,251,52,239,54,175,9,159,132,201,182,166,78,104,183,34,241,165,141,191,70,168,210,214,79,
+194,196,69,215,102,218,176,124,220,150,0,159,251,220,231,115,111,243,154,232,73,232,139,49,117,138,180,91,179,146,4,24,50,15,74,179,195,213,153,54,105,147,70,134,134,182,231,218,230,211,224,3,151,192,
+120,140,146,4,67,13,39,192,190,125,19,37,122,155,146,48,226,231,234,76,155,205,155,183,89,19,224,43,95,249,106,238,109,222,38,124,12,175,58,83,47,52,92,73,2,84,204,3,210,238,116,121,166,77,218,164,17,
+150,103,231,217,230,53,209,147,208,29,175,36,64,99,173,129,189,123,15,246,9,65,18,218,254,174,207,180,121,244,209,39,130,74,165,162,38,0,227,7,121,183,121,27,247,222,123,95,8,125,2,166,110,104,217,72,
+2,76,154,7,98,215,142,60,204,180,177,77,26,97,194,72,222,109,222,38,124,12,175,104,37,1,38,235,78,0,121,218,203,60,241,73,88,137,147,135,153,54,116,80,189,242,202,43,111,18,255,123,223,155,239,10,155,
+183,9,31,195,43,218,212,13,45,235,78,0,177,146,37,236,36,9,59,108,230,101,166,13,155,69,226,4,204,24,158,155,251,80,87,217,188,141,123,238,121,123,168,135,169,27,90,214,43,126,143,114,144,183,88,127,
+183,205,180,201,139,205,107,194,199,240,243,154,118,104,154,57,1,164,173,223,79,123,63,9,29,45,171,97,166,77,30,108,94,19,62,9,107,8,76,253,208,180,158,4,40,154,7,160,114,209,13,19,42,187,193,230,107,
+193,48,189,146,0,217,215,18,142,143,239,157,161,87,41,9,21,64,111,243,238,10,127,247,221,125,55,160,34,104,234,135,166,153,19,160,88,220,83,98,155,245,36,244,255,123,155,119,199,230,53,225,99,24,169,
+53,245,67,211,122,18,96,222,60,0,181,106,111,243,238,216,188,38,124,12,245,52,37,1,178,239,46,50,54,182,123,145,157,171,146,48,218,228,109,222,29,155,215,88,191,254,109,33,196,203,212,15,77,235,73,
+128,101,243,0,140,254,121,155,119,199,230,53,225,99,184,110,37,1,150,51,39,192,206,157,187,174,177,252,40,9,182,226,109,222,29,155,215,132,143,225,248,166,126,104,154,57,1,70,71,199,175,243,249,149,
+36,181,132,247,54,223,153,167,221,134,169,31,154,214,147,0,85,243,0,222,230,221,22,254,174,187,238,125,19,74,2,84,51,39,192,142,29,197,42,61,127,73,188,205,187,101,243,54,225,99,76,253,208,180,158,4,
+184,174,37,128,183,121,119,108,222,38,60,240,255,74,2,100,127,5,108,223,62,118,141,217,51,73,168,3,120,155,119,203,230,77,238,188,243,158,16,142,101,234,135,166,153,19,96,100,100,231,50,3,10,73,104,5,
+120,155,119,203,230,77,225,99,184,110,83,63,52,173,39,1,22,205,3,208,15,224,109,222,29,155,215,132,143,33,70,74,2,100,239,8,26,30,30,157,103,250,87,18,122,2,189,205,223,231,220,211,174,193,67,106,234,
+135,166,245,36,64,201,60,0,99,1,222,230,221,21,254,142,59,238,190,1,19,119,148,4,200,62,24,52,52,180,99,134,229,95,73,24,98,244,54,239,142,205,107,194,199,240,37,22,83,63,52,205,156,0,219,182,109,47,
+178,239,79,18,86,160,122,155,119,199,230,53,225,99,120,88,77,253,208,180,158,4,232,55,15,192,86,48,222,230,221,177,121,141,117,235,214,135,176,66,72,73,128,236,83,194,182,110,29,233,97,111,94,19,211,
+250,189,205,119,206,230,53,225,129,159,215,180,67,211,186,102,6,203,47,44,153,7,161,41,232,109,222,13,155,55,133,143,33,190,138,248,75,117,175,11,216,178,101,184,204,68,208,36,180,4,188,205,187,243,
+180,107,240,144,154,186,161,101,221,9,176,121,243,208,36,155,14,36,121,236,177,247,120,155,119,84,248,219,111,191,43,132,45,113,76,221,208,178,145,4,232,51,15,52,56,184,205,219,188,3,54,175,9,31,195,
+222,77,74,2,52,246,101,17,17,188,130,232,73,232,100,240,54,223,217,167,93,19,30,136,191,169,23,26,54,188,63,128,252,114,201,60,32,235,3,189,205,119,214,230,109,208,93,175,36,64,227,27,68,136,157,12,
+97,41,73,104,99,122,155,239,172,205,155,220,118,219,157,33,124,158,207,212,11,13,87,146,0,107,132,170,121,80,134,134,189,205,119,198,230,53,225,129,184,43,226,163,93,227,155,68,81,158,122,106,203,21,
+122,1,147,240,81,67,111,243,157,121,218,77,225,99,88,13,100,234,132,118,43,222,39,112,211,166,205,131,44,54,52,161,37,224,109,190,253,54,175,193,241,53,141,208,174,41,187,133,202,129,42,230,193,169,
+112,120,155,111,175,205,107,220,122,235,29,225,116,61,69,252,230,108,21,75,145,138,223,44,149,191,36,116,10,121,155,111,175,205,155,194,199,240,221,0,83,31,52,107,102,2,244,42,39,8,251,4,188,205,183,
+199,230,77,209,99,226,47,137,41,52,247,3,82,79,62,249,116,153,61,2,146,176,100,220,219,252,250,142,8,31,67,215,175,169,11,90,53,253,139,33,210,198,236,167,157,105,130,11,120,155,111,189,205,219,158,
+126,77,19,180,106,201,119,131,228,192,87,205,147,241,254,241,54,223,158,167,61,166,183,119,93,248,39,51,127,20,241,91,243,209,40,202,227,143,111,234,103,106,152,9,251,242,121,155,111,173,240,136,158,
+132,154,191,166,5,26,181,244,219,129,114,130,146,118,98,250,5,188,205,183,94,120,224,222,44,226,183,246,195,145,20,105,254,245,210,4,52,225,147,174,222,230,155,107,243,54,232,131,209,52,64,155,182,
+124,63,88,222,251,211,188,251,77,24,35,240,54,223,220,167,61,201,45,183,220,30,86,252,180,216,163,73,91,191,32,46,39,92,212,46,132,87,129,183,249,230,11,15,220,175,69,252,246,126,62,158,242,200,35,79,
+12,208,15,96,194,188,65,111,243,43,183,249,164,240,49,44,248,208,98,142,22,133,78,20,57,241,156,118,65,180,10,188,205,55,71,244,24,246,102,180,136,63,87,232,100,145,182,232,2,237,81,19,154,41,222,230,
+87,46,60,240,90,213,98,76,236,11,157,46,27,55,62,214,39,84,233,146,52,97,33,137,183,249,198,133,7,58,216,180,216,70,49,239,43,184,80,228,66,138,150,139,12,179,215,219,124,125,162,195,205,55,223,22,58,
+168,45,174,196,188,224,82,25,24,120,116,150,153,66,38,76,34,101,226,136,183,249,117,153,68,143,33,38,196,78,139,41,177,46,184,88,228,194,202,218,5,211,50,208,146,192,219,252,91,133,143,197,39,102,22,
+241,203,5,151,139,100,237,60,153,107,146,76,2,111,243,186,240,192,107,146,88,105,49,36,182,5,215,139,92,124,143,176,192,77,104,80,39,240,54,175,67,231,153,45,110,81,76,123,10,121,40,114,161,107,133,
+87,108,55,67,235,96,181,219,188,9,238,152,34,62,177,92,91,200,83,217,176,97,227,90,97,129,65,34,13,250,9,86,171,205,39,185,233,166,91,195,7,194,22,167,40,134,249,18,63,145,4,61,194,188,237,230,232,49,
+196,246,86,147,205,199,162,3,247,195,140,170,20,241,137,93,79,33,239,229,225,135,7,202,244,99,219,160,94,176,26,108,62,22,30,232,224,73,139,9,49,43,116,83,145,27,154,77,187,97,134,146,233,248,232,86,
+155,143,225,154,121,253,213,16,127,182,208,141,229,161,135,222,93,20,170,44,99,178,193,120,119,30,132,175,71,116,136,43,122,105,247,30,197,166,88,232,230,242,224,131,239,234,19,22,152,213,98,131,186,
+1,235,13,242,110,243,49,212,115,216,186,37,237,158,163,152,244,21,86,75,145,155,157,171,17,144,27,83,206,243,102,243,49,241,23,188,106,221,39,177,40,172,198,242,192,3,27,6,132,69,33,72,131,68,192,62,
+121,53,184,108,243,192,239,49,55,18,225,107,221,87,116,239,3,133,213,94,36,8,211,25,130,21,66,29,129,238,82,215,132,167,9,75,107,38,235,125,112,207,5,95,254,88,228,189,223,43,148,120,255,103,129,39,
+140,93,74,226,100,232,132,205,35,58,206,196,181,100,189,238,232,30,123,189,226,150,34,149,165,126,225,42,149,166,172,240,138,160,55,141,250,2,93,203,201,132,104,150,232,252,157,87,16,21,58,92,136,115,
+214,115,141,209,61,245,123,133,235,75,132,114,157,65,190,1,109,109,44,153,214,4,149,49,18,35,174,67,196,137,17,139,204,223,227,229,86,180,54,120,178,113,22,18,138,99,240,189,164,70,175,35,186,7,47,
+124,163,69,158,180,94,97,86,168,240,212,229,132,74,116,205,222,234,155,156,12,131,194,21,161,234,160,232,213,232,218,6,189,82,45,46,82,233,90,35,12,9,37,161,66,37,172,67,84,162,107,224,90,214,120,101,
+58,84,250,251,223,217,39,76,10,101,97,137,57,244,45,98,41,58,7,231,234,243,145,119,55,33,122,132,126,161,40,204,8,37,97,94,88,20,150,133,107,194,117,161,26,113,61,250,183,229,232,103,230,163,223,153,
+137,142,193,177,122,124,100,125,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,156,41,211,211,51,61,66,191,80,20,102,132,146,48,47,44,10,203,194,53,225,186,80,
+141,184,30,253,219,114,244,51,243,209,239,204,68,199,224,88,190,43,216,97,193,251,132,73,161,44,44,9,65,139,88,138,206,193,185,252,96,80,167,202,229,203,207,173,17,134,132,146,80,17,130,14,81,137,174,
+129,107,241,195,193,173,46,151,46,61,59,40,92,17,170,66,224,24,213,232,218,252,132,144,38,139,222,43,204,10,21,7,69,183,81,137,174,217,79,9,107,180,92,188,248,76,191,80,22,130,70,56,113,226,76,112,
+240,224,100,80,44,238,9,134,135,71,195,239,232,177,163,54,251,235,177,221,10,139,48,227,53,121,252,157,141,24,216,125,139,159,225,147,107,67,67,59,130,177,177,221,193,129,3,135,131,227,199,79,7,141,
+94,71,116,15,126,82,104,157,194,95,173,39,200,231,207,95,14,14,29,154,10,70,71,199,195,47,102,33,102,188,210,182,198,98,204,154,203,182,226,133,28,28,139,207,177,108,223,62,22,76,76,28,9,207,89,103,
+34,92,245,137,144,82,46,92,152,238,21,74,66,144,133,83,167,206,5,187,119,239,15,159,108,115,121,245,74,69,79,10,159,6,31,103,26,31,223,27,156,60,121,54,200,122,221,209,61,250,87,67,178,200,211,52,205,
+19,149,133,125,251,38,84,209,155,249,180,219,72,91,241,67,50,236,217,115,32,200,122,31,220,179,23,254,252,229,1,97,177,86,176,120,159,239,216,81,12,247,201,115,77,120,72,46,4,225,122,168,115,80,111,
+200,144,4,220,251,234,92,28,122,238,220,165,57,33,72,227,232,209,147,97,101,172,21,162,55,91,120,141,205,155,135,130,169,169,19,65,173,251,36,22,171,73,248,62,97,33,45,32,60,241,60,69,46,62,237,89,
+132,55,23,141,108,217,50,28,58,66,141,36,32,38,221,221,187,120,246,236,197,162,80,21,2,27,59,119,238,10,119,200,114,217,230,179,10,159,132,255,167,5,145,118,239,81,108,186,115,139,152,51,103,46,204,
+10,129,13,218,236,180,193,107,137,62,59,251,129,224,179,159,45,5,207,60,243,156,19,54,95,107,201,152,185,154,136,122,204,254,253,135,130,180,88,16,171,110,19,191,156,118,195,35,35,59,51,61,237,63,248,
+193,15,131,55,222,120,227,6,223,248,198,75,206,216,124,45,225,77,182,110,29,169,149,4,249,223,38,238,244,233,243,61,194,188,16,104,28,62,124,52,252,218,101,22,155,127,255,251,63,240,38,241,99,78,158,
+60,227,140,205,103,17,62,185,212,140,158,71,58,149,108,241,137,98,215,147,87,241,215,10,11,182,155,219,181,107,95,93,239,246,23,94,248,156,154,0,223,253,238,223,57,103,243,181,132,55,161,203,57,37,9,
+136,97,190,182,138,61,117,234,220,90,225,21,122,235,52,176,252,122,43,117,207,60,51,163,38,0,20,139,187,157,180,249,90,139,77,217,196,34,134,150,130,45,94,81,44,215,230,69,252,30,97,193,118,51,180,
+141,27,173,205,255,231,127,254,167,154,0,159,255,252,23,156,181,249,90,194,39,97,172,33,37,9,136,169,251,175,131,147,39,207,206,211,55,110,66,59,152,129,154,149,116,218,252,229,95,126,66,77,128,255,
+253,223,255,13,63,157,234,178,205,167,9,31,195,86,52,124,10,142,88,105,49,36,182,78,139,127,226,196,153,50,157,56,38,199,142,157,10,43,123,43,109,187,63,245,212,102,235,107,224,195,31,254,115,231,109,
+62,77,248,36,52,21,233,5,213,98,73,140,93,21,127,54,171,248,43,105,187,127,233,75,87,212,4,248,245,175,127,157,11,155,183,137,174,37,1,177,179,36,129,91,253,4,98,89,69,108,75,131,81,178,102,246,205,
+239,217,179,223,234,2,23,46,92,202,133,205,167,113,255,253,239,184,1,147,87,108,113,37,230,174,136,223,39,84,181,139,100,216,182,21,61,117,223,255,254,223,171,9,240,143,255,248,79,185,177,249,52,225,
+147,208,59,106,73,0,98,222,249,177,3,177,169,5,172,202,100,219,182,237,45,235,162,61,123,246,188,213,5,246,239,159,200,141,205,219,68,79,194,6,152,60,72,90,140,137,125,71,197,151,138,202,28,149,21,19,
+6,116,90,221,55,255,127,254,207,255,81,19,224,43,95,249,106,174,108,222,38,186,9,125,39,90,172,209,160,83,226,15,104,23,196,140,157,118,244,205,63,255,252,7,173,46,240,244,211,91,114,101,243,105,194,
+39,97,198,145,37,9,218,63,169,100,106,234,196,34,147,29,76,30,125,244,201,182,244,205,83,75,126,253,245,215,213,4,248,196,39,62,149,59,155,79,131,189,137,129,202,180,22,115,180,104,183,248,211,218,
+133,208,157,217,206,33,216,207,126,246,5,53,1,94,123,237,181,154,226,187,104,243,154,232,38,180,170,44,73,208,158,57,134,71,142,28,239,21,2,19,102,199,182,123,8,118,100,100,212,250,26,120,238,185,63,
+205,165,205,219,132,143,97,243,106,234,88,154,6,104,211,242,4,152,156,60,86,18,2,19,218,172,157,24,130,253,214,183,94,86,19,96,97,97,33,151,54,159,38,124,12,113,213,52,64,155,86,139,223,175,157,152,
+38,95,167,134,96,39,39,143,90,93,128,255,203,163,205,219,132,79,66,211,208,146,4,173,91,124,114,248,240,209,171,76,226,72,194,244,166,248,189,223,169,33,216,159,252,100,65,77,0,220,33,175,54,159,6,95,
+74,225,231,104,113,153,122,160,81,171,196,239,87,78,22,174,163,235,244,16,236,179,207,254,169,213,5,152,86,158,71,155,183,9,159,132,22,151,166,9,90,53,61,1,14,29,154,42,179,254,46,9,237,82,23,134,96,
+249,243,213,87,95,85,19,224,51,159,121,33,183,54,111,19,62,9,51,171,76,93,208,170,169,226,79,76,28,233,101,238,154,9,227,251,174,12,193,218,230,10,188,254,250,239,111,124,173,60,111,54,95,11,62,88,69,
+229,91,211,6,205,154,153,0,179,230,9,204,167,191,211,67,176,180,143,109,175,129,63,251,179,185,220,218,188,38,186,9,139,100,149,4,104,222,144,241,193,131,147,21,230,237,39,161,22,234,218,76,155,47,
+127,249,43,106,2,48,110,144,103,155,183,9,31,195,136,161,169,15,154,53,75,252,65,229,224,97,183,164,107,19,46,118,239,222,103,117,1,166,143,231,213,230,211,224,171,104,92,139,166,17,218,173,56,1,14,
+28,56,124,133,93,50,146,80,179,118,117,166,205,63,252,195,63,170,9,48,63,255,253,92,219,188,38,124,18,38,219,154,58,161,221,138,196,151,54,254,26,161,74,91,63,9,19,23,93,157,105,115,230,204,57,171,11,
+140,141,237,202,173,205,107,162,39,161,47,198,212,41,210,110,205,74,18,96,200,60,40,205,14,215,103,218,252,242,151,191,82,19,160,92,254,98,110,109,62,13,62,112,9,140,199,40,73,48,212,112,2,236,219,55,
+81,162,183,41,9,35,126,174,207,180,73,155,43,64,231,73,94,109,222,38,124,12,45,33,83,47,52,92,73,2,84,204,3,210,238,116,125,166,205,187,222,181,49,168,84,42,106,2,188,239,125,239,207,173,205,107,162,
+39,161,59,94,73,128,198,90,3,123,247,30,236,19,130,36,180,253,243,50,211,230,133,23,74,214,245,3,121,182,121,27,247,222,123,95,8,125,2,166,110,104,217,72,2,76,154,7,98,215,142,188,204,180,25,30,222,
+97,173,8,230,217,230,109,194,199,240,138,86,18,96,178,238,4,144,167,189,204,19,159,132,181,107,121,154,80,121,233,210,51,193,127,253,215,127,133,194,255,191,255,247,255,130,231,158,123,111,238,109,
+222,38,124,12,175,104,83,55,180,172,59,1,196,74,150,176,147,36,236,176,153,199,9,149,44,41,227,103,186,197,230,109,220,115,207,219,67,61,76,221,208,178,94,241,123,148,131,188,197,250,187,109,166,77,
+94,108,94,19,62,134,159,215,180,67,211,204,9,32,109,253,126,218,251,73,216,167,47,239,19,42,187,197,230,53,225,147,176,134,192,212,15,77,235,73,128,162,121,0,42,23,221,48,161,178,27,108,190,22,12,211,
+43,9,144,125,45,225,248,248,222,25,122,149,146,80,1,244,54,239,174,240,119,223,221,119,3,42,130,166,126,104,154,57,1,138,197,61,37,182,89,79,66,255,191,183,121,119,108,94,19,62,134,145,90,83,63,52,
+173,39,1,230,205,3,176,5,187,183,121,119,108,94,19,62,134,122,154,146,0,217,119,23,25,27,219,189,200,206,85,73,24,109,242,54,239,142,205,107,172,95,255,182,16,226,101,234,135,166,245,36,192,178,121,0,
+70,255,188,205,187,99,243,154,240,49,92,183,146,0,203,153,19,96,231,206,93,215,88,126,148,4,91,241,54,239,142,205,107,194,199,112,124,83,63,52,205,156,0,163,163,227,215,249,252,74,146,90,194,123,155,
+239,204,211,110,195,212,15,77,235,73,128,170,121,0,111,243,110,11,127,215,93,247,190,9,37,1,170,153,19,96,199,142,98,149,158,191,36,222,230,221,178,121,155,240,49,166,126,104,90,79,2,92,215,18,192,
+219,188,59,54,111,19,30,248,127,37,1,178,191,2,182,111,31,187,198,199,13,146,80,7,240,54,239,150,205,155,220,121,231,61,33,28,203,212,15,77,51,39,192,200,200,206,101,6,20,146,208,10,240,54,239,150,
+205,155,194,199,112,221,166,126,104,90,79,2,44,154,7,160,31,192,219,188,59,54,175,9,31,67,140,148,4,200,222,17,52,60,60,58,207,244,175,36,244,4,122,155,191,207,185,167,93,227,255,159,18,55,106,50,95,
+79,2,148,204,3,48,22,224,109,222,93,225,239,184,227,238,27,48,113,71,73,128,236,131,65,67,67,59,102,88,254,149,132,33,70,111,243,238,216,188,38,124,12,95,98,49,245,67,211,204,9,176,109,219,246,34,251,
+254,36,97,5,170,183,121,119,108,94,19,62,134,135,213,212,15,77,235,73,128,126,243,0,108,5,227,109,222,29,155,215,88,183,110,125,8,43,132,148,4,200,62,37,108,235,214,145,30,62,107,102,98,90,191,183,
+249,206,217,188,38,60,240,243,154,118,104,90,215,204,96,249,133,37,243,32,52,5,189,205,187,97,243,166,240,49,196,87,17,127,169,238,117,1,91,182,12,151,153,8,154,132,150,128,183,121,119,158,118,13,30,
+82,83,55,180,172,59,1,54,111,30,154,100,211,129,36,124,152,201,219,188,155,194,223,126,251,93,33,124,140,210,212,13,45,27,73,128,62,243,64,131,131,219,188,205,59,96,243,154,240,49,236,221,164,36,64,
+99,95,22,17,193,43,136,158,132,78,6,111,243,157,125,218,53,225,129,248,155,122,161,97,195,251,3,200,47,151,204,3,178,62,208,219,124,103,109,222,6,221,245,74,2,52,190,65,132,216,201,16,150,146,132,54,
+166,183,249,206,218,188,201,109,183,221,25,194,231,249,76,189,208,112,37,9,176,70,168,154,7,101,104,216,219,124,103,108,94,19,30,136,187,34,62,218,53,190,73,20,229,169,167,182,92,161,23,48,9,159,107,
+241,54,223,153,167,221,20,62,134,213,64,166,78,104,183,226,125,2,55,109,218,60,200,98,67,19,90,2,222,230,219,111,243,26,28,95,211,8,237,154,178,91,168,28,168,98,30,156,10,135,183,249,246,218,188,198,
+173,183,222,17,78,215,83,196,111,206,86,177,20,169,248,205,82,249,75,66,167,144,183,249,246,218,188,41,124,12,91,223,153,250,160,89,51,19,160,87,57,65,216,39,224,109,190,61,54,111,138,30,19,127,73,76,
+161,185,31,144,122,242,201,167,203,236,17,144,132,37,227,222,230,215,119,68,248,24,186,126,77,93,208,170,233,95,12,145,54,102,63,237,76,19,92,192,219,124,235,109,222,246,244,107,154,160,85,75,190,27,
+36,7,190,106,158,140,247,143,183,249,246,60,237,49,189,189,235,194,63,153,249,163,136,223,154,143,70,81,30,127,124,83,63,83,195,76,248,112,132,183,249,214,10,143,232,73,168,249,107,90,160,81,75,191,
+29,40,39,40,105,39,166,95,192,219,124,235,133,7,238,205,34,126,107,63,28,73,145,230,95,47,77,64,19,62,204,228,109,190,185,54,111,131,62,24,77,3,180,105,203,247,131,229,189,63,205,187,223,132,49,2,111,
+243,205,125,218,147,220,114,203,237,97,197,79,139,61,154,180,245,11,226,114,194,69,237,66,120,21,120,155,111,190,240,192,253,90,196,111,239,231,227,41,143,60,242,196,0,253,0,38,204,27,244,54,191,114,
+155,79,10,31,195,130,15,45,230,104,81,232,68,145,19,207,105,23,68,171,192,219,124,115,68,143,97,111,70,139,248,115,133,78,22,105,139,46,208,30,53,161,153,226,109,126,229,194,3,175,85,45,198,196,190,
+208,233,178,113,227,99,125,66,149,46,73,19,22,146,120,155,111,92,120,160,131,77,139,109,20,243,190,130,11,69,46,164,104,185,200,48,123,189,205,215,39,58,220,124,243,109,161,131,218,226,74,204,11,46,
+149,129,129,71,103,153,41,100,194,36,82,38,142,120,155,95,151,73,244,24,98,66,236,180,152,18,235,130,139,69,46,172,172,93,48,45,3,45,9,188,205,191,85,248,88,124,98,102,17,191,92,112,185,72,214,206,
+147,185,38,201,36,240,54,175,11,15,188,38,137,149,22,67,98,91,112,189,200,197,247,8,11,220,132,6,117,2,111,243,58,116,158,217,226,22,197,180,167,144,135,34,23,186,86,120,197,118,51,180,14,86,187,205,
+155,224,142,41,226,19,203,181,133,60,149,13,27,54,174,21,22,24,36,210,160,159,96,181,218,124,146,155,110,186,53,124,32,108,113,138,98,152,47,241,19,73,208,35,204,219,110,142,30,67,108,111,53,217,124,
+44,58,112,63,204,168,74,17,159,216,245,20,242,94,30,126,120,160,76,63,182,13,234,5,171,193,230,99,225,129,14,158,180,152,16,179,66,55,21,185,161,217,180,27,102,40,153,142,143,110,181,249,24,174,153,
+215,95,13,241,103,11,221,88,30,122,232,221,69,161,202,50,38,27,140,119,231,65,248,122,68,135,184,162,151,118,239,81,108,138,133,110,46,15,62,248,174,62,97,129,89,45,54,168,27,176,222,32,239,54,31,67,
+61,135,173,91,210,238,57,138,73,95,97,181,20,185,217,185,26,1,185,49,229,60,111,54,31,19,127,193,171,214,125,18,139,194,106,44,15,60,176,97,64,88,20,130,52,72,4,236,147,87,131,203,54,15,252,30,115,35,
+17,190,214,125,69,247,62,80,88,237,69,130,48,157,33,88,33,212,17,232,46,117,77,120,154,176,180,102,178,222,7,247,92,240,229,143,69,222,251,189,66,137,247,127,22,120,194,216,165,36,78,134,78,216,60,
+162,227,76,92,75,214,235,142,238,177,215,43,110,41,82,89,234,23,174,82,105,202,10,175,8,122,211,168,47,208,181,156,76,136,102,137,206,223,121,5,81,161,195,133,56,103,61,215,24,221,83,191,87,184,190,
+68,40,215,25,228,27,208,214,198,146,105,77,80,25,35,49,226,58,68,156,24,177,200,252,61,94,110,69,107,131,39,27,103,33,161,56,6,223,75,106,244,58,162,123,240,194,55,90,228,73,235,21,102,133,10,79,93,
+78,168,68,215,236,173,190,201,201,48,40,92,17,170,14,138,94,141,174,109,208,43,213,226,34,149,174,53,194,144,80,18,42,84,194,58,68,37,186,6,174,101,141,87,166,67,165,191,255,157,125,194,164,80,22,150,
+152,67,223,34,150,162,115,112,174,62,31,121,119,19,162,71,232,23,138,194,140,80,18,230,133,69,97,89,184,38,92,23,170,17,215,163,127,91,142,126,102,62,250,157,153,232,24,28,171,199,71,214,23,95,124,
+241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,153,50,61,61,211,35,244,11,69,97,70,40,9,243,194,162,176,44,92,19,174,11,213,136,235,209,191,45,71,63,51,31,253,206,76,
+116,12,142,229,187,130,29,22,188,79,152,20,202,194,146,16,180,136,165,232,28,156,203,15,6,117,170,92,190,252,220,26,97,72,40,9,21,33,232,16,149,232,26,184,22,63,28,220,234,114,233,210,179,131,194,21,
+161,42,4,142,81,141,174,205,79,8,105,178,232,189,194,172,80,113,80,116,27,149,232,154,253,148,176,70,203,197,139,207,244,11,101,33,104,132,19,39,206,4,7,15,78,6,197,226,158,96,120,120,52,252,142,30,
+59,106,179,191,30,219,173,176,8,51,94,147,199,223,217,136,129,221,183,248,25,62,185,54,52,180,35,24,27,219,29,28,56,112,56,56,126,252,116,208,232,117,68,247,224,39,133,214,41,252,213,122,130,124,254,
+252,229,224,208,161,169,96,116,116,60,252,98,22,98,198,43,109,107,44,198,172,185,108,43,94,200,193,177,248,28,203,246,237,99,193,196,196,145,240,156,117,38,194,85,159,8,41,229,194,133,233,94,161,36,4,
+89,56,117,234,92,176,123,247,254,240,201,54,151,87,175,84,244,164,240,105,240,113,166,241,241,189,193,201,147,103,131,172,215,29,221,163,127,53,36,139,60,77,211,60,81,89,216,183,111,66,21,189,153,79,
+187,141,180,21,63,36,195,158,61,7,130,172,247,193,61,123,225,207,95,30,16,22,107,5,139,247,249,142,29,197,112,159,60,215,132,135,228,66,16,174,135,58,7,245,134,12,73,192,189,175,206,197,161,231,206,
+93,154,19,130,52,142,30,61,25,86,198,90,33,122,179,133,215,216,188,121,40,152,154,58,17,212,186,79,98,177,154,132,239,19,22,210,2,194,19,207,83,228,226,211,158,69,120,115,209,200,150,45,195,161,35,
+212,72,2,98,210,221,189,139,103,207,94,44,10,85,33,176,177,115,231,174,112,135,172,90,194,211,92,251,252,231,203,193,207,127,254,243,224,59,223,249,110,112,248,240,84,71,159,118,77,248,36,252,63,45,
+136,180,123,143,98,211,157,91,196,156,57,115,97,86,8,108,208,102,71,212,172,79,251,15,127,248,163,224,141,55,222,120,19,187,119,239,107,187,240,181,150,140,153,171,137,168,199,236,223,127,40,72,139,5,
+177,234,54,241,203,105,55,60,50,178,179,46,155,159,156,60,250,22,241,225,11,95,248,98,199,108,190,150,240,38,91,183,142,212,74,130,252,111,19,119,250,244,249,30,97,94,8,52,14,31,62,26,126,237,178,222,
+247,251,233,211,103,213,4,248,237,111,127,219,81,155,207,34,124,114,169,25,61,143,116,42,217,226,19,197,174,39,175,226,175,21,22,108,55,183,107,215,190,134,43,117,188,42,180,4,128,83,167,206,116,220,
+230,107,9,111,66,151,115,74,18,16,195,124,109,21,123,234,212,185,181,194,43,244,214,105,96,249,43,173,205,191,252,242,223,170,9,240,181,175,93,117,198,230,107,45,54,101,19,139,24,90,10,182,120,69,177,
+92,155,23,241,123,132,5,219,205,208,54,110,70,51,238,194,133,203,106,2,252,254,247,191,191,177,15,177,11,54,95,75,248,36,140,53,164,36,1,49,117,255,117,112,242,228,217,121,250,198,77,104,7,51,80,211,
+172,78,27,68,126,253,245,215,213,36,184,120,241,178,115,54,159,38,124,12,91,209,240,41,56,98,165,197,144,216,58,45,254,137,19,103,202,116,226,152,28,59,118,42,172,236,53,187,211,230,43,95,249,154,154,
+0,47,191,252,109,39,109,62,77,248,36,52,21,233,5,213,98,73,140,93,21,127,54,171,248,205,234,173,59,113,226,180,181,50,248,216,99,79,58,45,188,41,186,150,4,196,206,146,4,110,245,19,136,101,21,177,45,
+13,70,201,90,217,55,255,218,107,175,169,9,48,51,243,62,103,109,62,141,251,239,127,199,13,152,188,98,139,43,49,119,69,252,62,161,170,93,36,195,182,173,238,155,127,241,197,47,168,9,240,253,239,255,189,
+211,54,159,38,124,18,154,188,150,4,32,230,157,31,59,16,155,90,192,170,76,182,109,219,222,150,190,249,137,137,73,235,107,224,233,167,183,56,109,243,54,209,147,176,1,38,15,146,22,99,98,223,81,241,165,
+162,50,71,101,197,132,1,157,118,14,202,252,250,215,191,86,19,224,249,231,63,232,188,205,219,68,55,161,239,68,139,53,26,116,74,252,1,237,130,152,177,211,238,33,216,79,127,250,111,212,4,248,241,143,255,
+57,23,54,159,38,124,18,102,28,89,146,160,253,147,74,166,166,78,44,50,217,193,228,209,71,159,108,251,16,236,248,248,30,235,107,96,120,120,71,46,108,62,13,246,38,6,42,211,90,204,209,162,221,226,79,107,
+23,66,119,102,167,134,96,255,245,95,127,174,38,192,71,63,250,177,220,216,188,38,186,9,173,42,75,18,180,103,142,225,145,35,199,123,133,192,132,217,177,157,28,130,69,104,45,1,126,254,243,87,114,101,243,
+54,225,99,216,188,154,58,150,166,1,218,180,60,1,38,39,143,149,132,192,132,54,107,39,135,96,135,134,182,91,95,3,44,14,201,139,205,167,9,31,67,92,53,13,208,166,213,226,247,107,39,166,201,231,194,16,236,
+143,126,244,99,53,1,254,234,175,254,58,87,54,111,19,62,9,77,67,75,18,180,110,241,201,225,195,71,175,50,137,35,9,211,155,226,247,126,167,135,96,255,236,207,230,212,4,160,153,152,55,155,79,131,47,165,
+240,115,180,184,76,61,208,168,85,226,247,43,39,11,215,209,185,50,211,134,10,146,237,53,112,224,192,161,92,217,188,77,248,36,180,184,52,77,208,170,233,9,112,232,208,84,153,245,119,73,104,151,186,54,
+211,102,126,254,251,106,2,124,238,115,159,207,157,205,219,132,79,194,204,42,83,23,180,106,170,248,19,19,71,122,153,187,102,194,248,190,107,51,109,158,125,118,70,77,0,6,141,242,102,243,181,224,131,85,
+84,190,53,109,208,172,153,9,48,107,158,192,124,250,93,153,105,195,48,170,237,53,48,53,117,60,119,54,175,137,110,194,34,89,37,1,154,55,100,124,240,224,100,133,121,251,73,168,133,186,58,211,230,155,223,
+252,150,154,0,87,174,124,37,151,54,111,19,62,134,17,67,83,31,52,107,150,248,131,202,193,195,110,73,87,39,92,156,61,123,94,77,0,166,144,113,109,121,179,249,52,248,42,26,215,162,105,132,118,43,78,128,3,
+7,14,95,97,151,140,36,44,216,116,121,166,13,215,97,155,47,120,230,204,249,92,218,188,38,124,18,38,219,154,58,161,221,138,196,151,54,254,26,161,74,91,63,9,19,23,93,159,105,243,229,47,127,69,77,0,94,15,
+121,180,121,77,244,36,244,197,152,58,69,218,173,89,73,2,12,153,7,165,217,145,135,153,54,84,248,108,149,193,119,191,251,79,114,103,243,105,240,129,75,96,60,70,73,130,161,134,19,96,223,190,137,18,189,
+77,73,24,241,115,125,66,101,44,238,171,175,234,243,5,167,167,159,203,165,205,219,132,143,161,35,204,212,11,13,87,146,0,21,243,128,180,59,243,48,161,18,74,165,207,169,9,240,165,47,93,201,165,205,107,
+162,39,161,59,94,73,128,198,90,3,123,247,30,236,19,130,36,180,253,243,52,161,114,223,190,131,106,2,124,252,227,159,204,173,205,219,184,247,222,251,66,232,19,48,117,67,203,70,18,96,210,60,16,187,118,
+228,109,66,229,183,190,245,242,155,196,127,245,213,87,195,117,10,121,181,121,155,240,49,188,162,149,4,152,172,59,1,228,105,47,243,196,39,97,237,90,30,39,84,206,205,125,40,92,76,250,153,207,124,54,216,
+180,105,48,215,54,111,19,62,134,87,180,169,27,90,214,157,0,98,37,75,216,73,18,118,216,204,235,132,202,110,178,121,27,247,220,243,246,80,15,83,55,180,172,87,252,30,229,32,111,177,254,60,77,168,236,38,
+155,215,132,143,225,231,53,237,208,52,115,2,72,91,191,159,246,126,18,246,233,203,251,132,202,110,177,121,77,248,36,172,33,48,245,67,211,122,18,160,104,30,128,202,133,183,249,251,157,122,218,109,48,76,
+175,36,64,246,181,132,227,227,123,103,232,85,74,66,5,208,219,188,187,194,223,125,119,223,13,168,8,154,250,161,105,230,4,40,22,247,148,152,73,155,132,254,127,111,243,238,216,188,38,124,12,35,181,166,
+126,104,90,79,2,204,155,7,96,11,118,111,243,238,216,188,38,124,12,245,52,37,1,178,239,46,50,54,182,123,145,157,171,146,48,218,228,109,222,29,155,215,88,191,254,109,33,196,203,212,15,77,235,73,128,101,
+243,0,140,254,121,155,119,199,230,53,225,99,184,110,37,1,150,51,39,192,206,157,187,174,177,252,40,9,182,226,109,222,29,155,215,132,143,225,248,166,126,104,154,57,1,70,71,199,175,243,249,149,36,181,
+132,247,54,223,153,167,221,134,169,31,154,214,147,0,85,243,0,222,230,221,22,254,174,187,238,125,19,74,2,84,51,39,192,142,29,197,42,61,127,73,188,205,187,101,243,54,225,99,76,253,208,180,158,4,184,174,
+37,128,183,121,119,108,222,38,60,240,255,74,2,100,127,5,108,223,62,118,141,143,27,36,161,14,224,109,222,45,155,55,185,243,206,123,66,56,150,169,31,154,102,78,128,145,145,157,203,12,40,36,161,21,224,
+109,222,45,155,55,133,143,225,186,77,253,208,180,158,4,88,52,15,64,63,128,183,121,119,108,94,19,62,134,24,41,9,144,189,35,104,120,120,116,158,233,95,73,232,9,244,54,127,159,115,79,187,6,15,169,169,31,
+154,214,147,0,37,243,0,140,5,120,155,119,87,248,59,238,184,251,6,76,220,81,18,32,251,96,208,208,208,142,25,150,127,37,97,136,209,219,188,59,54,175,9,31,195,151,88,76,253,208,52,115,2,108,219,182,189,
+200,190,63,73,88,129,234,109,222,29,155,215,132,143,225,97,53,245,67,211,122,18,160,223,60,0,91,193,120,155,119,199,230,53,214,173,91,31,194,10,33,37,1,178,79,9,219,186,117,164,135,207,154,153,152,
+214,239,109,190,115,54,175,9,15,252,188,166,29,154,214,53,51,88,126,97,201,60,8,77,65,111,243,110,216,188,41,124,12,241,85,196,95,170,123,93,192,150,45,195,101,38,130,38,161,37,224,109,222,157,167,93,
+131,135,212,212,13,45,235,78,128,205,155,135,38,217,116,32,201,99,143,189,199,219,188,163,194,223,126,251,93,33,124,140,210,212,13,45,27,73,128,62,243,64,131,131,219,188,205,59,96,243,154,240,49,236,
+221,164,36,64,99,95,22,17,193,43,136,158,132,78,6,111,243,157,125,218,53,225,129,248,155,122,161,97,195,251,3,200,47,151,204,3,178,62,208,219,124,103,109,222,6,221,245,74,2,52,190,65,132,216,201,16,
+150,146,132,54,166,183,249,206,218,188,201,109,183,221,25,194,178,119,83,47,52,92,73,2,172,17,170,230,65,25,26,246,54,223,25,155,215,132,7,226,174,136,143,118,141,111,18,69,121,234,169,45,87,232,5,76,
+194,110,156,222,230,59,243,180,155,194,199,176,26,200,212,9,237,86,188,79,224,166,77,155,7,89,108,104,66,75,192,219,124,251,109,94,131,227,107,26,161,93,83,118,11,149,3,85,204,131,83,225,240,54,223,
+94,155,215,184,245,214,59,194,233,122,138,248,205,217,42,150,34,21,191,89,42,127,73,232,20,242,54,223,94,155,55,133,143,225,187,1,166,62,104,214,204,4,232,85,78,16,246,9,120,155,111,143,205,155,162,
+199,196,95,18,83,104,238,7,164,158,124,242,233,50,123,4,36,97,201,184,183,249,245,29,17,62,134,174,95,83,23,180,106,250,23,67,164,141,217,79,59,211,4,23,240,54,223,122,155,183,61,253,154,38,104,213,
+146,239,6,201,129,175,154,39,227,253,227,109,190,61,79,123,76,111,239,186,240,79,102,254,40,226,183,230,163,81,148,199,31,223,212,207,212,48,19,62,28,225,109,190,181,194,35,122,18,106,254,154,22,104,
+212,210,111,7,202,9,74,218,137,233,23,240,54,223,122,225,129,123,179,136,223,218,15,71,82,164,249,215,75,19,208,100,195,134,141,222,230,155,108,243,54,232,131,209,52,64,155,182,124,63,88,222,251,211,
+188,251,77,24,35,240,54,223,220,167,61,201,45,183,220,30,86,252,180,216,163,73,91,191,32,46,39,92,212,46,132,87,129,183,249,230,11,15,220,175,69,252,246,126,62,158,242,200,35,79,12,208,15,96,194,188,
+65,111,243,43,183,249,164,240,49,44,248,208,98,142,22,133,78,20,57,241,156,118,65,180,10,188,205,55,71,244,24,246,102,180,136,63,87,232,100,145,182,232,2,237,81,19,154,41,222,230,87,46,60,240,90,213,
+98,76,236,11,157,46,27,55,62,214,39,84,233,146,52,97,33,137,183,249,198,133,7,58,216,180,216,70,49,239,43,184,80,228,66,138,150,139,12,179,215,219,124,125,162,195,205,55,223,22,58,168,45,174,196,188,
+224,82,25,24,120,116,150,153,66,38,76,34,101,226,136,183,249,117,153,68,143,33,38,196,78,139,41,177,46,184,88,228,194,202,218,5,211,50,208,146,192,219,252,91,133,143,197,39,102,22,241,203,5,151,139,
+100,237,60,153,107,146,76,2,111,243,186,240,192,107,146,88,105,49,36,182,5,215,139,92,124,143,176,192,77,104,80,39,240,54,175,67,231,153,45,110,81,76,123,10,121,40,114,161,107,133,87,108,55,67,235,96,
+181,219,188,9,238,152,34,62,177,92,91,200,83,217,176,97,227,90,97,129,65,34,13,250,9,86,171,205,39,185,233,166,91,195,7,194,22,167,40,134,249,18,63,145,4,61,194,188,237,230,232,49,196,246,86,147,205,
+199,162,3,247,195,140,170,20,241,137,93,79,33,239,229,225,135,7,202,244,99,219,160,94,176,26,108,62,22,30,232,224,73,139,9,49,43,116,83,145,27,154,77,187,97,134,146,233,248,232,86,155,143,225,154,121,
+253,213,16,127,182,208,141,229,161,135,222,93,20,170,44,99,178,193,120,119,30,132,175,71,116,136,43,122,105,247,30,197,166,88,232,230,242,224,131,239,234,19,22,152,213,98,131,186,1,235,13,242,110,243,
+49,212,115,216,186,37,237,158,163,152,244,21,86,75,145,155,157,171,17,144,27,83,206,243,102,243,49,241,23,188,106,221,39,177,40,172,198,242,192,3,27,6,132,69,33,72,131,68,192,62,121,53,184,108,243,
+192,239,49,55,18,225,107,221,87,116,239,3,133,213,94,36,8,211,25,130,21,66,29,129,238,82,215,132,167,9,75,107,38,235,125,112,207,5,95,254,88,228,189,223,43,148,120,255,103,129,39,140,93,74,226,100,
+232,132,205,35,58,206,196,181,100,189,238,232,30,123,189,226,150,34,149,165,126,225,42,149,166,172,240,138,160,55,141,250,2,93,203,201,132,104,150,232,252,157,87,16,21,58,92,136,115,214,115,141,209,
+61,245,123,133,235,75,132,114,157,65,190,1,109,109,44,153,214,4,149,49,18,35,174,67,196,137,17,139,204,223,227,229,86,180,54,120,178,113,22,18,138,99,240,189,164,70,175,35,186,7,47,124,163,69,158,180,
+94,97,86,168,240,212,229,132,74,116,205,222,234,155,156,12,131,194,21,161,234,160,232,213,232,218,6,189,82,45,46,82,233,90,35,12,9,37,161,66,37,172,67,84,162,107,224,90,214,120,101,58,84,250,251,223,
+217,39,76,10,101,97,137,57,244,45,98,41,58,7,231,234,243,145,119,55,33,122,132,126,161,40,204,8,37,97,94,88,20,150,133,107,194,117,161,26,113,61,250,183,229,232,103,230,163,223,153,137,142,193,177,
+122,124,100,125,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,156,41,211,211,51,61,66,191,80,20,102,132,146,48,47,44,10,203,194,53,225,186,80,141,184,30,253,
+219,114,244,51,243,209,239,204,68,199,224,88,190,43,216,97,193,251,132,73,161,44,44,9,65,139,88,138,206,193,185,252,96,80,167,202,229,203,207,173,17,134,132,146,80,17,130,14,81,137,174,129,107,241,
+195,193,173,46,151,46,61,59,40,92,17,170,66,224,24,213,232,218,252,132,144,38,139,222,43,204,10,21,7,69,183,81,137,174,217,79,9,107,180,92,188,248,76,191,80,22,130,70,56,113,226,76,112,240,224,100,80,
+44,238,9,134,135,71,195,239,232,177,163,54,251,235,177,221,10,139,48,227,53,121,252,157,141,24,216,125,139,159,225,147,107,67,67,59,130,177,177,221,193,129,3,135,131,227,199,79,7,141,94,71,116,15,126,
+82,104,157,194,95,173,39,200,231,207,95,14,14,29,154,10,70,71,199,195,47,102,33,102,188,210,182,198,98,204,154,203,182,226,133,28,28,139,207,177,108,223,62,22,76,76,28,9,207,89,103,34,92,245,137,144,
+82,46,92,152,238,21,74,66,144,133,83,167,206,5,187,119,239,15,159,108,115,121,245,74,69,79,10,159,6,31,103,26,31,223,27,156,60,121,54,200,122,221,209,61,250,87,67,178,200,211,52,205,19,149,133,125,
+251,38,84,209,155,249,180,219,72,91,241,67,50,236,217,115,32,200,122,31,220,179,23,254,252,229,1,97,177,86,176,120,159,239,216,81,12,247,201,115,77,120,72,46,4,225,122,168,115,80,111,200,144,4,220,
+251,234,92,28,122,238,220,165,57,33,72,227,232,209,147,97,101,172,21,162,55,91,120,141,205,155,135,130,169,169,19,65,173,251,36,22,171,73,248,62,97,33,45,32,60,241,60,69,245,8,255,145,143,124,52,248,
+233,79,127,22,44,44,252,52,152,155,251,80,203,68,207,34,188,185,104,100,203,150,225,208,17,106,36,1,49,233,238,222,197,179,103,47,22,133,170,16,216,216,185,115,87,184,67,86,61,79,252,167,62,245,233,
+224,141,55,222,120,19,127,241,23,127,217,214,167,93,19,62,9,255,79,11,34,237,222,163,216,116,231,22,49,103,206,92,152,21,2,27,180,217,105,131,55,98,243,255,245,95,255,245,150,4,248,205,111,126,211,22,
+225,107,45,25,51,87,19,81,143,217,191,255,80,144,22,11,98,213,109,226,151,211,110,120,100,100,231,138,222,239,149,74,229,45,9,0,116,228,180,203,230,107,9,111,178,117,235,72,173,36,200,255,54,113,167,
+79,159,239,17,230,133,64,227,240,225,163,225,215,46,87,90,177,251,199,127,252,39,53,1,158,127,254,131,109,181,249,44,194,39,151,154,209,243,72,167,146,45,62,81,236,122,242,42,254,90,97,193,118,115,
+187,118,237,107,90,109,254,163,31,253,152,154,0,223,249,206,119,59,98,243,181,132,55,193,169,82,146,128,24,230,107,171,216,83,167,206,173,21,94,161,183,78,3,203,111,102,219,157,206,33,45,1,126,247,
+187,223,117,84,248,90,139,77,217,196,34,134,150,130,45,94,81,44,215,230,69,252,30,97,193,118,51,180,141,91,209,105,243,223,255,253,223,106,18,76,76,76,118,212,230,107,9,159,132,177,134,148,36,32,166,
+238,191,14,78,158,60,59,79,223,184,9,237,96,6,106,90,213,105,243,205,111,190,172,38,192,39,62,241,41,39,108,62,77,248,24,182,162,225,83,112,196,74,139,33,177,117,90,252,19,39,206,148,233,196,49,57,
+118,236,84,88,217,107,101,23,237,251,222,247,126,53,1,126,244,163,31,59,249,180,155,194,39,161,169,72,47,168,22,75,98,236,170,248,179,89,197,111,69,23,237,200,200,168,154,0,192,83,229,154,240,166,232,
+90,18,16,59,75,18,184,213,79,32,150,85,196,182,52,24,37,107,87,223,252,175,126,245,43,53,1,78,159,62,235,148,205,167,113,255,253,239,184,1,147,87,108,113,37,230,174,136,223,39,84,181,139,100,216,182,
+213,162,39,223,239,229,242,151,212,4,248,220,231,94,116,206,230,211,132,79,66,239,168,37,1,136,121,231,199,14,196,166,22,176,42,147,109,219,182,183,125,36,238,252,249,139,106,2,252,219,191,253,194,73,
+155,183,137,158,132,13,48,121,144,180,24,19,251,142,138,47,21,149,57,42,43,38,12,232,116,98,8,150,186,134,173,30,64,243,211,69,155,183,137,110,66,223,137,22,107,52,232,148,248,3,218,5,209,41,211,201,
+33,216,159,252,228,39,106,2,60,243,204,140,179,54,159,38,124,18,102,28,89,146,160,253,147,74,166,166,78,44,50,217,193,228,209,71,159,236,232,16,236,95,253,213,95,171,9,240,181,175,125,221,105,155,79,
+131,189,137,129,202,180,22,115,180,104,183,248,211,218,133,208,157,217,233,33,216,201,201,163,106,2,44,45,189,234,188,205,107,162,155,208,170,178,36,65,123,230,24,30,57,114,188,87,8,76,152,29,219,238,
+153,54,90,165,142,115,217,135,135,119,57,111,243,54,225,99,216,188,154,58,150,166,1,218,180,60,1,38,39,143,149,132,192,132,54,107,39,102,218,104,21,187,239,125,111,94,77,0,166,138,185,110,243,105,194,
+199,16,87,77,3,180,105,181,248,253,218,137,105,242,117,122,166,77,146,15,126,240,195,106,2,252,221,223,125,47,23,54,111,19,62,9,77,67,75,18,180,110,241,201,225,195,71,175,50,137,35,9,211,155,226,247,
+190,11,51,109,226,241,117,45,1,254,240,135,63,132,199,200,131,205,167,193,151,82,248,57,90,92,166,30,104,212,42,241,251,149,147,133,235,232,92,155,105,3,175,190,250,170,117,120,56,15,54,111,19,62,9,
+45,46,77,19,180,106,122,2,28,58,52,85,102,253,93,18,218,165,174,206,180,185,122,245,235,214,225,225,188,216,188,77,248,36,204,172,50,117,65,171,166,138,63,49,113,164,151,185,107,38,140,239,187,58,211,
+230,153,103,158,83,19,224,159,255,249,95,114,99,243,181,224,131,85,84,190,53,109,208,172,153,9,48,107,158,192,124,250,93,155,105,67,37,201,214,45,252,39,127,242,88,110,108,94,19,221,132,69,178,74,2,
+52,111,200,248,224,193,201,10,243,246,147,16,96,215,103,218,252,226,23,191,80,19,224,212,169,179,185,178,121,155,240,49,140,24,154,250,160,89,179,196,31,84,14,30,118,75,186,62,211,166,84,122,81,77,
+128,23,95,252,66,174,108,62,13,190,138,198,181,104,26,161,221,138,19,224,192,129,195,87,216,37,35,9,11,54,93,21,62,249,100,159,56,113,90,77,128,197,197,95,230,206,230,53,225,147,48,218,105,234,132,
+118,43,18,95,218,248,107,132,42,109,253,36,230,20,43,87,103,218,176,21,140,173,30,48,56,184,53,87,54,175,137,158,132,190,24,83,167,72,187,53,43,73,128,33,243,160,52,59,92,158,80,105,242,195,31,254,72,
+77,128,103,159,253,211,92,217,124,26,124,224,18,24,143,81,146,96,168,225,4,216,183,111,162,68,111,83,18,70,252,92,159,80,153,124,178,63,246,177,143,171,9,240,245,175,127,35,119,54,111,19,62,134,145,
+66,83,47,52,92,73,2,84,204,3,210,238,204,195,132,202,152,125,251,14,90,251,3,242,102,243,154,232,73,226,85,82,6,141,181,6,246,238,61,216,39,4,73,104,251,231,105,66,101,140,214,45,252,215,127,253,153,
+92,218,188,141,123,239,189,47,132,62,1,83,55,180,108,36,1,38,205,3,177,107,71,222,38,84,194,201,147,167,195,129,160,88,252,127,248,135,127,12,159,150,60,218,188,77,248,24,94,209,74,2,76,214,157,0,242,
+180,151,121,226,147,176,118,45,143,19,42,97,96,224,145,224,248,241,147,225,43,33,207,54,111,19,62,134,87,180,169,27,90,214,157,0,98,37,75,216,73,18,154,85,121,157,80,217,77,54,111,227,158,123,222,30,
+234,97,234,134,150,245,138,223,163,28,228,45,214,159,167,9,149,221,100,243,154,240,49,252,188,166,29,154,102,78,0,105,235,247,211,222,79,194,62,125,121,159,80,217,45,54,175,9,159,132,53,4,166,126,104,
+90,79,2,20,205,3,80,185,240,54,127,191,83,79,187,13,134,233,149,4,200,190,150,112,124,124,239,12,189,74,73,168,0,122,155,119,87,248,187,239,238,187,1,21,65,83,63,52,205,156,0,197,226,158,18,219,172,
+39,161,255,223,219,188,59,54,175,9,31,195,72,173,169,31,154,214,147,0,243,230,1,216,130,221,219,188,59,54,175,9,31,67,61,77,73,128,236,187,139,140,141,237,94,100,102,109,18,70,155,188,205,187,99,243,
+26,235,215,191,45,132,120,153,250,161,105,61,9,176,108,30,128,209,63,111,243,238,216,188,38,124,12,215,173,36,192,114,230,4,216,185,115,215,53,150,31,37,193,86,188,205,187,99,243,154,240,49,28,223,
+212,15,77,51,39,192,232,232,248,117,62,191,146,164,150,240,222,230,59,243,180,219,48,245,67,211,122,18,160,106,30,192,219,188,219,194,223,117,215,189,111,66,73,128,106,230,4,216,177,163,88,165,231,47,
+137,183,121,183,108,222,38,124,140,169,31,154,214,147,0,215,181,4,240,54,239,142,205,219,132,7,254,95,73,128,236,175,128,237,219,199,174,241,113,131,36,212,1,188,205,187,101,243,38,119,222,121,79,8,
+199,50,245,67,211,204,9,48,50,178,115,153,1,133,36,180,2,188,205,187,101,243,166,240,49,92,183,169,31,154,214,147,0,139,230,1,232,7,240,54,239,142,205,107,194,199,16,35,37,1,178,119,4,13,15,143,206,
+51,253,43,9,61,129,222,230,239,115,238,105,215,224,33,53,245,67,211,122,18,160,100,30,128,177,0,111,243,238,10,127,199,29,119,223,128,137,59,74,2,100,31,12,26,26,218,49,195,242,175,36,12,49,122,155,
+119,199,230,53,225,99,248,18,139,169,31,154,102,78,128,109,219,182,23,217,247,39,9,43,80,189,205,187,99,243,154,240,49,60,172,166,126,104,90,79,2,244,155,7,96,43,24,111,243,238,216,188,198,186,117,
+235,67,88,33,164,36,64,246,41,97,91,183,142,244,240,89,51,19,211,250,189,205,119,206,230,53,225,129,159,215,180,67,211,186,102,6,203,47,44,153,7,161,41,232,109,222,13,155,55,133,143,33,190,138,248,75,
+117,175,11,216,178,101,184,204,68,208,36,180,4,188,205,187,243,180,107,240,144,154,186,161,101,221,9,176,121,243,208,36,155,14,36,121,236,177,247,120,155,119,84,248,219,111,191,43,132,143,81,154,186,
+161,101,35,9,208,103,30,104,112,112,155,183,121,7,108,94,19,62,134,189,155,148,4,104,236,203,34,34,120,5,209,147,208,201,224,109,190,179,79,187,38,60,16,127,83,47,52,108,120,127,0,249,229,146,121,64,
+214,7,122,155,239,172,205,219,160,187,94,73,128,198,55,136,16,59,25,194,82,146,208,198,244,54,223,89,155,55,185,237,182,59,67,248,100,142,169,23,26,174,36,1,214,8,85,243,160,12,13,123,155,239,140,205,
+107,194,3,113,87,196,71,187,198,55,137,162,60,245,212,150,43,244,2,38,225,163,134,222,230,59,243,180,155,194,199,176,26,200,212,9,237,86,188,79,224,166,77,155,7,89,108,104,66,75,192,219,124,251,109,
+94,131,227,107,26,161,93,83,118,11,149,3,85,204,131,83,225,240,54,223,94,155,215,184,245,214,59,194,233,122,138,248,205,217,42,150,34,21,191,89,42,127,73,232,20,242,54,223,94,155,55,133,143,225,187,1,
+166,62,104,214,204,4,232,85,78,16,246,9,120,155,111,143,205,155,162,199,196,95,18,83,104,238,7,164,158,124,242,233,50,123,4,36,97,201,184,183,249,245,29,17,62,134,174,95,83,23,180,106,250,23,67,164,
+141,217,79,59,211,4,23,240,54,223,122,155,183,61,253,154,38,104,213,146,239,6,201,129,175,154,39,227,253,227,109,190,61,79,123,76,111,239,186,240,79,102,254,40,226,183,230,163,81,148,199,31,223,212,
+207,212,48,19,62,28,225,109,190,181,194,35,122,18,106,254,154,22,104,212,210,111,7,202,9,74,218,137,233,23,240,54,223,122,225,129,123,179,136,223,218,15,71,82,164,249,215,75,19,208,100,195,134,141,
+222,230,155,108,243,54,232,131,209,52,64,155,182,124,63,88,222,251,211,188,251,77,24,35,240,54,223,220,167,61,201,45,183,220,30,86,252,180,216,163,73,91,191,32,46,39,92,212,46,132,87,129,183,249,230,
+11,15,220,175,69,252,246,126,62,158,242,200,35,79,12,208,15,96,194,188,65,111,243,43,183,249,164,240,49,44,248,208,98,142,22,133,78,20,57,241,156,118,65,180,10,188,205,55,71,244,24,246,102,180,136,63,
+87,232,100,145,182,232,2,237,81,19,154,41,222,230,87,46,60,240,90,213,98,76,236,11,157,46,27,55,62,214,39,84,233,146,52,97,33,137,183,249,198,133,7,58,216,180,216,70,49,239,43,184,80,228,66,138,150,
+139,12,179,215,219,124,125,162,195,205,55,223,22,58,168,45,174,196,188,224,82,25,24,120,116,150,153,66,38,76,34,101,226,136,183,249,117,153,68,143,33,38,196,78,139,41,177,46,184,88,228,194,202,218,5,
+211,50,208,146,192,219,252,91,133,143,197,39,102,22,241,203,5,151,139,100,237,60,153,107,146,76,2,111,243,186,240,192,107,146,88,105,49,36,182,5,215,139,92,124,143,176,192,77,104,80,39,240,54,175,67,
+231,153,45,110,81,76,123,10,121,40,114,161,107,133,87,108,55,67,235,96,181,219,188,9,238,152,34,62,177,92,91,200,83,217,176,97,227,90,97,129,65,34,13,250,9,86,171,205,39,185,233,166,91,195,7,194,22,
+167,40,134,249,18,63,145,4,61,194,188,237,230,232,49,196,246,86,147,205,199,162,3,247,195,140,170,20,241,137,93,79,33,239,229,225,135,7,202,244,99,219,160,94,176,26,108,62,22,30,232,224,73,139,9,49,
+43,116,83,145,27,154,77,187,97,134,146,233,248,232,86,155,143,225,154,121,253,213,16,127,182,208,141,229,161,135,222,93,20,170,44,99,178,193,120,119,30,132,175,71,116,136,43,122,105,247,30,197,166,88,
+232,230,242,224,131,239,234,19,22,152,213,98,131,186,1,235,13,242,110,243,49,212,115,216,186,37,237,158,163,152,244,21,86,75,145,155,157,171,17,144,27,83,206,243,102,243,49,241,23,188,106,221,39,177,
+40,172,198,242,192,3,27,6,132,69,62,229,158,6,137,128,125,242,106,112,217,230,129,223,99,110,36,194,215,186,175,232,222,7,10,171,189,72,16,166,51,4,43,132,58,2,221,165,174,9,79,19,150,214,76,214,251,
+224,158,11,190,252,177,200,123,191,87,40,241,254,207,2,79,24,187,148,196,201,208,9,155,71,116,156,137,107,201,122,221,209,61,246,122,197,45,69,42,75,253,194,85,42,77,89,225,21,65,111,26,245,5,186,150,
+147,9,209,44,209,249,59,175,32,42,116,184,16,231,172,231,26,163,123,234,247,10,215,151,8,229,58,131,124,3,218,218,88,50,173,9,42,99,36,70,92,135,136,19,35,22,153,191,199,203,173,104,109,240,100,227,
+44,36,20,199,224,123,73,141,94,71,116,15,94,248,70,139,60,105,189,194,172,80,225,169,203,9,149,232,154,189,213,55,57,25,6,133,43,66,213,65,209,171,209,181,13,122,165,90,92,164,210,181,70,24,18,74,66,
+133,74,88,135,168,68,215,192,181,172,241,202,116,168,244,247,191,179,79,152,20,202,194,18,115,232,91,196,82,116,14,206,213,231,35,239,110,66,244,8,253,66,81,152,17,74,194,188,176,40,44,11,215,132,235,
+66,53,226,122,244,111,203,209,207,204,71,191,51,19,29,131,99,245,248,200,250,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,56,83,166,167,103,122,132,126,
+161,40,204,8,37,97,94,88,20,150,133,107,194,117,161,26,113,61,250,183,229,232,103,230,163,223,153,137,142,193,177,124,87,176,195,130,247,9,147,66,89,88,18,130,22,177,20,157,131,115,249,193,160,78,149,
+203,151,159,91,35,12,9,37,161,34,4,29,162,18,93,3,215,226,135,131,91,93,46,93,122,118,80,184,34,84,133,192,49,170,209,181,249,9,33,77,22,189,87,152,21,42,14,138,110,163,18,93,179,159,18,214,104,185,
+120,241,153,126,161,44,4,141,112,226,196,153,224,224,193,201,160,88,220,19,12,15,143,134,223,209,99,71,109,246,215,99,187,21,22,97,198,107,242,248,59,27,49,176,251,22,63,195,39,215,134,134,118,4,99,
+99,187,131,3,7,14,7,199,143,159,14,26,189,142,232,30,252,164,208,58,133,191,90,79,144,207,159,191,28,28,58,52,21,140,142,142,135,95,204,66,204,120,165,109,141,197,152,53,151,109,197,11,57,56,22,159,
+99,217,190,125,44,152,152,56,18,158,179,206,68,184,234,19,33,165,92,184,48,221,43,148,132,32,11,167,78,157,11,118,239,222,31,62,217,230,242,234,149,138,158,20,62,13,62,206,52,62,190,55,56,121,242,108,
+144,245,186,163,123,244,175,134,100,145,167,105,154,39,42,11,251,246,77,168,162,55,243,105,183,145,182,226,135,100,216,179,231,64,144,245,62,184,103,47,252,249,203,3,194,98,173,96,241,62,223,177,163,
+24,238,147,231,154,240,144,92,8,194,245,80,231,160,222,144,33,9,184,247,213,185,56,244,220,185,75,115,66,144,198,209,163,39,195,202,88,189,162,243,241,164,143,125,236,227,193,149,43,95,9,222,247,190,
+247,183,69,120,141,205,155,135,130,169,169,19,65,173,251,36,22,171,73,248,62,97,33,45,32,60,241,60,69,141,60,237,79,60,177,41,88,92,92,12,222,120,227,141,27,124,227,27,47,53,77,244,44,194,155,139,70,
+182,108,25,14,29,161,70,18,16,147,238,238,93,60,123,246,98,81,168,10,129,141,157,59,119,133,59,100,53,106,243,127,249,151,159,120,147,248,49,7,15,30,110,233,211,174,9,159,132,255,167,5,145,118,239,81,
+108,186,115,139,152,51,103,46,204,10,129,13,218,236,180,193,87,250,110,191,114,229,171,106,2,124,224,3,115,45,17,190,214,146,49,115,53,17,245,152,253,251,15,5,105,177,32,86,221,38,126,57,237,134,71,
+70,118,54,173,82,247,145,143,124,84,77,0,234,3,173,180,249,90,194,155,108,221,58,82,43,9,242,191,77,220,233,211,231,123,132,121,33,208,56,124,248,104,88,97,107,102,109,126,106,234,184,154,0,63,253,
+233,207,90,110,243,89,132,79,46,53,163,231,145,78,37,91,124,162,216,245,228,85,252,181,194,130,237,230,118,237,218,215,146,78,155,77,155,6,213,4,0,142,215,137,167,221,20,222,132,46,231,148,36,32,134,
+249,218,42,246,212,169,115,107,133,87,232,173,211,192,242,91,217,118,255,143,255,248,141,154,0,227,227,123,218,42,124,173,197,166,108,98,17,67,75,193,22,175,40,150,107,243,34,126,143,176,96,187,25,
+218,198,173,238,180,249,206,119,190,171,38,192,179,207,206,180,221,230,107,9,159,132,177,134,148,36,32,166,238,191,14,78,158,60,59,79,223,184,9,237,96,6,106,90,213,55,159,124,178,63,249,201,79,169,9,
+240,194,11,159,235,152,205,167,9,31,195,86,52,124,10,142,88,105,49,36,182,78,139,127,226,196,153,50,157,56,38,199,142,157,10,43,123,237,234,162,61,123,246,188,154,0,255,244,79,63,112,230,105,55,133,
+79,66,83,145,94,80,45,150,196,216,85,241,103,179,138,223,234,190,249,109,219,70,212,4,248,159,255,249,31,103,132,55,69,215,146,128,216,89,146,192,173,126,2,177,172,34,182,165,193,40,89,43,108,190,86,
+109,30,177,181,36,216,186,117,184,227,54,159,198,253,247,191,227,6,76,94,177,197,149,152,187,34,126,159,80,213,46,146,97,219,86,139,110,171,205,99,247,90,2,156,62,125,206,9,155,79,19,62,9,189,163,150,
+4,32,230,157,31,59,16,155,90,192,170,76,182,109,219,222,182,167,93,131,10,159,150,0,31,255,248,39,157,177,121,155,232,73,216,0,147,7,73,139,49,177,239,168,248,82,81,153,163,178,98,194,128,78,167,132,
+143,197,125,230,153,231,212,4,248,246,183,191,227,188,240,136,110,66,223,137,22,107,52,232,148,248,3,218,5,49,99,167,93,54,159,86,155,167,119,77,75,128,255,248,143,255,112,206,230,211,132,79,194,140,
+35,75,18,180,127,82,201,212,212,137,69,38,59,152,60,250,232,147,109,123,218,211,106,243,28,223,214,37,204,123,213,53,155,79,131,189,137,129,202,180,22,115,180,104,183,248,211,218,133,208,157,217,78,
+155,175,85,155,103,0,72,75,128,195,135,167,156,180,121,77,116,19,90,85,150,36,104,207,28,195,35,71,142,247,10,129,9,179,99,219,109,243,181,106,243,95,254,242,21,53,1,230,230,62,228,172,205,219,132,
+143,97,243,106,234,88,154,6,104,211,242,4,152,156,60,86,18,2,19,218,172,157,152,105,147,86,155,127,255,251,63,160,38,192,215,190,118,213,89,155,79,19,62,134,184,106,26,160,77,171,197,239,215,78,76,
+147,175,211,51,109,52,246,239,159,80,19,224,149,87,254,205,105,155,183,9,159,132,166,161,37,9,90,183,248,228,240,225,163,87,153,196,145,132,233,77,241,123,223,133,153,54,111,158,112,241,104,234,220,0,
+151,109,62,13,190,148,194,207,209,226,50,245,64,163,86,137,223,175,156,44,92,71,231,218,76,155,36,191,252,229,175,212,4,216,181,107,175,211,54,111,19,62,9,45,46,77,19,180,106,122,2,28,58,52,85,102,
+253,93,18,218,165,157,182,249,90,181,249,151,94,250,166,154,0,207,61,247,94,231,109,222,38,124,18,102,86,153,186,160,85,83,197,159,152,56,210,203,220,53,19,198,247,59,109,243,181,106,243,182,73,162,
+47,190,248,121,231,109,190,22,124,176,138,202,183,166,13,154,53,51,1,102,205,19,152,79,191,171,51,109,142,30,213,39,137,254,232,71,63,206,133,205,107,162,155,176,72,86,73,128,230,13,25,31,60,56,89,97,
+222,126,18,106,161,174,216,124,90,77,254,61,239,121,90,77,128,215,95,127,61,55,54,111,19,62,134,158,77,83,31,52,107,150,248,131,202,193,195,90,180,139,243,234,180,138,221,171,175,190,170,38,1,19,71,
+242,96,243,105,240,85,52,174,69,211,8,237,86,156,0,7,14,28,190,194,46,25,73,88,176,233,170,240,218,251,252,123,223,155,87,19,128,169,99,121,177,121,77,248,36,76,182,53,117,66,187,21,137,47,109,252,53,
+66,149,182,126,18,38,46,186,56,161,210,198,167,62,245,105,53,1,248,247,188,216,188,38,122,18,250,98,76,157,34,237,214,172,36,1,134,204,131,210,236,112,121,66,165,86,177,179,77,18,197,25,242,98,243,
+105,240,129,75,96,60,70,73,130,161,134,19,96,223,190,137,18,189,77,73,24,241,115,125,66,165,105,233,182,73,162,212,13,242,100,243,54,225,99,24,41,52,245,66,195,149,36,64,197,60,32,237,206,60,76,168,
+52,121,253,245,223,171,179,132,243,100,243,154,232,73,232,142,87,18,160,177,214,192,222,189,7,251,132,32,9,109,255,60,77,168,76,190,223,191,248,197,47,191,37,1,62,255,249,47,228,206,230,109,220,123,
+239,125,33,244,9,152,186,161,101,35,9,48,105,30,136,93,59,242,54,161,50,134,107,250,234,87,191,246,166,229,226,252,76,222,108,222,38,124,12,175,104,37,1,38,235,78,0,121,218,203,60,241,73,88,187,150,
+199,9,149,73,226,202,107,94,109,222,38,124,12,175,104,83,55,180,172,59,1,196,74,150,176,147,36,236,176,153,215,9,149,221,100,243,54,238,185,231,237,161,30,166,110,104,89,175,248,61,202,65,222,98,253,
+121,154,80,217,77,54,175,9,31,195,207,107,218,161,105,230,4,144,182,126,63,237,253,36,236,211,151,23,155,207,123,109,190,17,225,147,176,134,192,212,15,77,235,73,128,162,121,0,42,23,222,230,239,119,
+234,105,183,193,48,189,146,0,217,215,18,142,143,239,157,161,87,41,9,21,64,111,243,238,10,127,247,221,125,55,160,34,104,234,135,166,153,19,160,88,220,83,98,155,245,36,244,255,123,155,119,199,230,53,
+225,99,24,169,53,245,67,211,122,18,96,222,60,0,91,176,123,155,119,199,230,53,225,99,168,167,41,9,144,125,119,145,177,177,221,139,172,173,75,194,104,147,183,121,119,108,94,99,253,250,183,133,16,47,83,
+63,52,173,39,1,150,205,3,208,129,226,109,222,29,155,215,132,143,225,186,149,4,88,206,156,0,59,119,238,186,198,242,163,36,216,138,183,121,119,108,94,19,62,134,227,155,250,161,105,230,4,24,29,29,191,
+206,231,87,146,212,18,222,219,124,103,158,118,27,166,126,104,90,79,2,84,205,3,120,155,119,91,248,187,238,186,247,77,40,9,80,205,156,0,59,118,20,171,244,252,37,241,54,239,150,205,219,132,143,49,245,67,
+211,122,18,224,186,150,0,222,230,221,177,121,155,240,192,255,43,9,144,253,21,176,125,251,216,53,62,110,144,132,58,128,183,121,183,108,222,228,206,59,239,9,225,88,166,126,104,154,57,1,70,70,118,46,51,
+160,144,132,86,128,183,121,183,108,222,20,62,134,235,54,245,67,211,122,18,96,209,60,0,253,0,222,230,221,177,121,77,248,24,98,164,36,64,246,142,160,225,225,209,121,166,127,37,161,39,208,219,252,125,
+206,61,237,26,60,164,166,126,104,90,79,2,148,204,3,48,22,224,109,222,93,225,239,184,227,238,27,48,113,71,73,128,236,131,65,67,67,59,102,88,254,149,132,33,70,111,243,238,216,188,38,124,12,95,98,49,245,
+67,211,204,9,176,109,219,246,34,251,254,36,97,5,170,183,121,119,108,94,19,62,134,135,213,212,15,77,235,73,128,126,243,0,108,5,227,109,222,29,155,215,88,183,110,125,8,43,132,148,4,200,62,37,108,235,
+214,145,30,62,107,102,98,90,191,183,249,206,217,188,38,60,240,243,154,118,104,90,215,204,96,249,133,37,243,32,52,5,189,205,187,97,243,166,240,49,196,87,17,127,169,238,117,1,91,182,12,151,153,8,154,
+132,150,128,183,121,119,158,118,13,30,82,83,55,180,172,59,1,54,111,30,154,100,211,129,36,143,61,246,30,111,243,142,10,127,251,237,119,133,240,49,74,83,55,180,108,36,1,250,204,3,13,14,110,243,54,239,
+128,205,107,194,199,176,119,147,146,0,141,125,89,68,4,175,32,122,18,58,25,188,205,119,246,105,215,132,7,226,111,234,133,134,13,239,15,32,191,92,50,15,200,250,64,111,243,157,181,121,27,116,215,43,9,
+208,248,6,17,98,39,67,88,74,18,218,152,222,230,59,107,243,38,183,221,118,103,8,159,231,51,245,66,195,149,36,192,26,161,106,30,148,161,97,111,243,157,177,121,77,120,32,238,138,248,104,215,248,38,81,
+148,167,158,218,114,133,94,192,36,124,212,208,219,124,103,158,118,83,248,24,86,3,153,58,161,221,138,247,9,220,180,105,243,32,139,13,77,104,9,120,155,111,191,205,107,112,124,77,35,180,107,202,110,161,
+114,160,138,121,112,42,28,222,230,219,107,243,26,183,222,122,71,56,93,79,17,191,57,91,197,82,164,226,55,75,229,47,9,157,66,222,230,219,107,243,166,240,49,124,55,192,212,7,205,154,153,0,189,202,9,194,
+62,1,111,243,237,177,121,83,244,152,248,75,98,10,205,253,128,212,147,79,62,93,102,143,128,36,44,25,247,54,191,190,35,194,199,208,245,107,234,130,86,77,255,98,136,180,49,251,105,103,154,224,2,222,230,
+91,111,243,182,167,95,211,4,173,90,242,221,32,57,240,85,243,100,188,127,188,205,183,231,105,143,233,237,93,23,254,201,204,31,69,252,214,124,52,138,242,248,227,155,250,153,26,102,194,135,35,188,205,
+183,86,120,68,79,66,205,95,211,2,141,90,250,237,64,57,65,73,59,49,253,2,222,230,91,47,60,112,111,22,241,91,251,225,72,138,52,255,122,105,2,154,108,216,176,209,219,124,147,109,222,6,125,48,154,6,104,
+211,150,239,7,203,123,127,154,119,191,9,99,4,222,230,155,251,180,39,185,229,150,219,195,138,159,22,123,52,105,235,23,196,229,132,139,218,133,240,42,240,54,223,124,225,129,251,181,136,223,222,207,199,
+83,30,121,228,137,1,250,1,76,152,55,232,109,126,229,54,159,20,62,134,5,31,90,204,209,162,208,137,34,39,158,211,46,136,86,129,183,249,230,136,30,195,222,140,22,241,231,10,157,44,210,22,93,160,61,106,
+66,51,197,219,252,202,133,7,94,171,90,140,137,125,161,211,101,227,198,199,250,132,42,93,146,38,44,36,241,54,223,184,240,64,7,155,22,219,40,230,125,5,23,138,92,72,209,114,145,97,246,122,155,175,79,116,
+184,249,230,219,66,7,181,197,149,152,23,92,42,3,3,143,206,50,83,200,132,73,164,76,28,241,54,191,46,147,232,49,196,132,216,105,49,37,214,5,23,139,92,88,89,187,96,90,6,90,18,120,155,127,171,240,177,248,
+196,204,34,126,185,224,114,145,172,157,39,115,77,146,73,224,109,94,23,30,120,77,18,43,45,134,196,182,224,122,145,139,239,17,22,184,9,13,234,4,222,230,117,232,60,179,197,45,138,105,79,33,15,69,46,116,
+173,240,138,237,102,104,29,172,118,155,55,193,29,83,196,39,150,107,11,121,42,27,54,108,92,43,44,48,72,164,65,63,193,106,181,249,36,55,221,116,107,248,64,216,226,20,197,48,95,226,39,146,160,71,152,183,
+221,28,61,134,216,222,106,178,249,88,116,224,126,152,81,149,34,62,177,235,41,228,189,60,252,240,64,153,126,108,27,212,11,86,131,205,199,194,3,29,60,105,49,33,102,133,110,42,114,67,179,105,55,204,80,
+50,29,31,221,106,243,49,92,51,175,191,26,226,207,22,186,177,60,244,208,187,139,66,149,101,76,54,24,239,206,131,240,245,136,14,113,69,47,237,222,163,216,20,11,221,92,30,124,240,93,125,194,2,179,90,108,
+80,55,96,189,65,222,109,62,134,122,14,91,183,164,221,115,20,147,190,194,106,41,114,179,115,53,2,114,99,202,121,222,108,62,38,254,130,87,173,251,36,22,133,213,88,30,120,96,195,128,176,40,4,105,144,8,
+216,39,175,6,151,109,30,248,61,230,70,34,124,173,251,138,238,125,160,176,218,139,4,97,58,67,176,66,168,35,208,93,234,154,240,52,97,105,205,100,189,15,238,185,224,203,31,139,188,247,123,133,18,239,255,
+44,240,132,177,75,73,156,12,157,176,121,68,199,153,184,150,172,215,29,221,99,175,87,220,82,164,178,212,47,92,165,210,148,21,94,17,244,166,81,95,160,107,57,153,16,205,18,157,191,243,10,162,66,135,11,
+113,206,122,174,49,186,167,126,175,112,125,137,80,174,51,200,55,160,173,141,37,211,154,160,50,70,98,196,117,136,56,49,98,145,249,123,188,220,138,214,6,79,54,206,66,66,113,12,190,151,212,232,117,68,
+247,224,133,111,180,200,147,214,43,204,10,21,158,186,156,80,137,174,217,91,125,147,147,97,80,184,34,84,29,20,189,26,93,219,160,87,170,197,69,42,93,107,132,33,161,36,84,168,132,117,136,74,116,13,92,
+203,26,175,76,135,74,127,255,59,251,132,73,161,44,44,49,135,190,69,44,69,231,224,92,125,62,242,238,38,68,143,208,47,20,133,25,161,36,204,11,139,194,178,112,77,184,46,84,35,174,71,255,182,28,253,204,
+124,244,59,51,209,49,56,86,143,143,172,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,51,101,122,122,166,71,232,23,138,194,140,80,18,230,133,69,97,89,
+184,38,92,23,170,17,215,163,127,91,142,126,102,62,250,157,153,232,24,28,203,119,5,59,44,120,159,48,41,148,133,37,33,104,17,75,209,57,56,151,31,12,234,84,185,124,249,185,53,194,144,80,18,42,66,208,33,
+42,209,53,112,45,126,56,184,213,229,210,165,103,7,133,43,66,85,8,28,163,26,93,155,159,16,210,100,209,123,133,89,161,226,160,232,54,42,209,53,251,41,97,141,150,139,23,159,233,23,202,66,208,8,39,78,156,
+9,14,30,156,12,138,197,61,193,240,240,104,248,29,61,118,212,102,127,61,182,91,97,17,102,188,38,143,191,179,17,3,187,111,241,51,124,114,109,104,104,71,48,54,182,59,56,112,224,112,112,252,248,233,160,
+209,235,136,238,193,79,10,173,83,248,171,245,4,249,252,249,203,193,161,67,83,193,232,232,120,248,197,44,196,140,87,218,214,88,140,89,115,217,86,188,144,131,99,241,57,150,237,219,199,130,137,137,35,
+225,57,235,76,132,171,62,17,82,202,133,11,211,189,66,73,8,178,112,234,212,185,96,247,238,253,225,147,109,46,175,94,169,232,73,225,211,224,227,76,227,227,123,131,147,39,207,6,89,175,59,186,71,255,106,
+72,22,121,154,166,121,162,178,176,111,223,132,42,122,51,159,118,27,105,43,126,72,134,61,123,14,4,89,239,131,123,246,194,159,191,60,32,44,214,10,22,239,243,29,59,138,225,62,121,141,10,191,117,235,72,
+248,126,111,182,240,144,92,8,194,245,80,231,160,222,144,33,9,184,247,213,185,56,244,220,185,75,115,66,144,198,209,163,39,195,202,216,74,158,246,221,187,247,5,63,253,233,207,130,55,222,120,35,228,11,
+95,40,183,68,120,141,205,155,135,130,169,169,19,65,173,251,36,22,171,73,248,62,97,33,45,32,60,241,60,69,205,176,249,159,255,252,149,27,226,199,124,228,35,31,109,88,244,44,194,155,139,70,182,108,25,14,
+29,161,70,18,16,147,238,238,93,60,123,246,98,81,168,10,129,141,157,59,119,133,59,100,53,227,253,190,115,231,248,91,196,135,31,253,232,199,77,127,218,53,225,147,240,255,180,32,210,238,61,138,77,119,
+110,17,115,230,204,133,89,33,176,65,155,157,119,116,51,43,117,188,62,180,4,248,247,127,255,247,166,9,95,107,201,152,185,154,136,122,204,254,253,135,130,180,88,16,171,110,19,191,156,118,195,35,35,59,
+91,82,155,127,247,187,255,68,77,0,168,37,126,179,133,55,161,82,90,35,9,242,191,77,220,233,211,231,123,132,121,33,208,56,124,248,104,248,181,203,86,54,227,150,150,94,85,19,128,166,100,179,109,62,139,
+240,201,165,102,244,60,210,169,100,139,79,20,187,158,188,138,191,86,88,176,221,220,174,93,251,218,210,105,243,147,159,44,168,9,176,119,239,129,182,61,237,166,240,38,116,57,167,36,1,49,204,215,86,177,
+167,78,157,91,43,188,66,111,157,6,150,223,174,78,155,151,95,254,91,53,1,206,158,189,208,214,167,93,131,77,44,98,104,41,216,226,21,197,114,109,94,196,239,17,22,108,55,67,219,184,157,189,117,165,210,
+139,106,2,60,255,252,7,157,16,62,9,99,13,41,73,64,76,221,127,29,156,60,121,118,158,190,113,19,218,193,12,212,180,170,111,222,86,153,251,208,135,62,162,38,192,103,62,243,66,91,109,62,77,248,24,182,162,
+225,83,112,196,74,139,33,177,117,90,252,19,39,206,148,233,196,49,57,118,236,84,88,217,107,103,223,124,204,249,243,151,212,4,120,233,165,111,117,244,105,55,133,79,66,83,145,94,80,45,150,196,216,85,241,
+103,179,138,223,106,225,147,79,246,254,253,19,106,2,252,248,199,255,220,81,225,77,209,181,36,32,118,150,36,112,171,159,64,44,171,136,109,105,48,74,214,106,155,79,171,205,111,222,188,77,77,128,223,252,
+230,55,29,179,249,52,238,191,255,29,55,96,242,138,45,174,196,220,21,241,251,132,170,118,145,180,181,219,97,243,105,53,121,206,145,214,25,212,41,155,79,19,62,9,189,163,150,4,32,230,157,31,59,16,155,90,
+192,170,76,182,109,219,222,246,167,221,86,155,231,105,215,59,131,182,56,243,180,219,96,3,76,30,36,45,198,196,190,163,226,75,69,101,142,202,138,9,3,58,157,18,94,123,159,243,190,183,117,6,185,40,60,162,
+155,208,119,162,197,26,13,58,37,254,128,118,65,204,216,105,183,205,215,170,205,191,244,210,55,213,4,56,119,238,130,19,54,159,38,124,18,102,28,89,146,160,253,147,74,166,166,78,44,50,217,193,228,209,71,
+159,236,136,205,167,213,230,255,230,111,62,171,38,192,220,220,135,156,177,249,52,216,155,24,168,76,107,49,71,139,118,139,63,173,93,8,221,153,157,178,249,180,218,252,7,62,48,167,38,192,103,63,91,114,
+202,230,53,209,77,104,85,89,146,160,61,115,12,143,28,57,222,43,4,38,204,142,237,164,205,167,213,230,79,159,62,167,38,192,183,190,245,178,115,54,111,19,62,134,205,171,169,99,105,26,160,77,203,19,96,
+114,242,88,73,8,76,104,179,118,210,230,211,216,181,107,175,154,0,63,249,201,79,156,179,249,52,225,99,136,171,166,1,218,180,90,252,126,237,196,52,249,58,109,243,105,181,121,6,89,180,4,88,90,90,114,250,
+105,55,133,79,66,211,208,146,4,173,91,124,114,248,240,209,171,76,226,72,194,244,166,248,189,223,73,155,79,171,205,243,239,105,157,65,46,218,124,26,124,41,133,159,163,197,101,234,129,70,173,18,191,95,
+57,89,184,142,206,5,155,175,85,155,255,191,255,247,223,213,4,24,28,220,234,164,205,219,132,79,66,139,75,211,4,173,154,158,0,135,14,77,149,89,127,151,132,118,169,43,54,95,171,54,255,131,31,252,80,77,
+128,125,251,14,56,107,243,54,225,147,48,179,202,212,5,173,154,42,254,196,196,145,94,230,174,153,48,190,239,138,205,215,170,205,95,189,250,117,75,103,208,69,103,109,190,22,124,176,138,202,183,166,13,
+154,53,51,1,102,205,19,152,79,191,11,54,159,86,161,251,171,191,250,107,53,1,62,248,193,15,59,109,243,154,232,38,44,146,85,18,160,121,67,198,7,15,78,86,152,183,159,36,158,85,235,146,205,167,213,230,
+223,247,190,247,171,9,192,148,49,215,109,222,38,124,12,35,134,166,62,104,214,44,241,7,149,131,135,221,146,174,62,237,90,109,254,248,241,83,106,2,252,237,223,126,219,121,155,79,131,175,162,113,45,154,
+70,104,183,226,4,56,112,224,240,21,118,201,72,194,138,27,87,133,183,85,230,108,203,196,22,22,126,154,11,155,215,132,79,194,100,91,83,39,180,91,145,248,210,198,95,35,84,105,235,39,97,226,162,139,54,
+159,6,215,172,37,192,107,175,253,54,23,54,175,137,158,132,190,24,83,167,72,187,53,43,73,128,33,243,160,52,59,92,181,249,90,181,249,63,252,225,15,106,18,80,151,113,221,230,211,224,3,151,192,120,140,
+146,4,67,13,39,192,190,125,19,37,122,155,146,48,226,231,170,205,215,170,205,255,242,151,191,178,118,6,229,193,230,109,194,199,48,82,104,234,133,134,43,73,128,138,121,64,218,157,174,218,124,173,218,
+252,252,252,247,213,4,96,214,114,30,108,94,19,61,9,221,218,74,2,52,214,26,216,187,247,96,159,16,36,161,237,239,186,205,167,213,230,153,1,244,214,245,1,223,204,149,205,219,184,247,222,251,66,232,19,48,
+117,67,203,70,18,96,210,60,16,187,118,184,110,243,181,106,243,151,47,63,19,46,24,253,245,175,127,29,174,14,226,88,121,178,121,155,240,49,188,162,149,4,152,172,59,1,228,105,47,243,196,39,97,88,213,117,
+225,243,94,155,207,34,186,38,124,12,175,104,83,55,180,172,59,1,196,74,150,176,147,36,236,176,233,186,205,119,67,109,190,94,209,99,238,185,231,237,161,30,166,110,104,89,175,248,61,202,65,222,98,253,
+121,154,80,217,77,54,175,9,31,195,207,107,218,161,105,230,4,144,182,126,63,237,253,36,236,211,231,109,222,13,155,215,132,79,194,26,2,83,63,52,173,39,1,138,230,1,168,92,120,155,191,223,169,167,221,6,
+195,244,74,2,100,95,75,56,62,190,119,134,94,165,36,84,0,189,205,187,43,252,221,119,247,221,128,138,160,169,31,154,102,78,128,98,113,79,137,109,214,147,208,151,238,109,222,29,155,215,132,143,97,164,
+214,212,15,77,235,73,128,121,243,0,108,193,238,109,222,29,155,215,132,143,161,158,166,36,64,246,221,69,198,198,118,47,178,115,85,18,70,155,188,205,187,99,243,26,235,215,191,45,132,120,153,250,161,105,
+61,9,176,108,30,128,209,63,111,243,238,216,188,38,124,12,215,173,36,192,114,230,4,216,185,115,215,53,150,31,37,193,86,188,205,187,99,243,154,240,49,28,223,212,15,77,51,39,192,232,232,248,117,62,191,
+146,164,150,240,222,230,59,243,180,219,48,245,67,211,122,18,160,106,30,192,219,188,219,194,223,117,215,189,111,66,73,128,106,230,4,216,177,163,88,165,231,47,137,183,121,183,108,222,38,124,140,169,31,
+154,214,147,0,215,181,4,240,54,239,142,205,219,132,7,254,95,73,128,236,175,128,237,219,199,174,241,113,131,36,212,1,188,205,187,101,243,38,119,222,121,79,8,199,50,245,67,211,204,9,48,50,178,115,153,1,
+133,36,180,2,188,205,187,101,243,166,240,49,92,183,169,31,154,214,147,0,139,230,1,232,7,240,54,239,142,205,107,194,199,16,35,37,1,178,119,4,13,15,143,206,51,253,43,9,61,129,222,230,239,115,238,105,
+215,224,33,53,245,67,211,122,18,160,100,30,128,177,0,111,243,238,10,127,199,29,119,223,128,137,59,74,2,100,31,12,26,26,218,49,195,242,175,36,12,49,122,155,119,199,230,53,225,99,248,18,139,169,31,154,
+102,78,128,109,219,182,23,217,247,39,9,43,80,189,205,187,99,243,154,240,49,60,172,166,126,104,90,79,2,244,155,7,96,43,24,111,243,238,216,188,198,186,117,235,67,88,33,164,36,64,246,41,97,91,183,142,
+244,240,89,51,19,211,250,189,205,119,206,230,53,225,129,159,215,180,67,211,186,102,6,203,47,44,153,7,161,41,232,109,222,13,155,55,133,143,33,190,138,248,75,117,175,11,216,178,101,184,204,68,208,36,
+180,4,188,205,187,243,180,107,240,144,154,186,161,101,221,9,176,121,243,208,36,155,14,36,121,236,177,247,120,155,119,84,248,219,111,191,43,132,143,81,154,186,161,101,35,9,208,103,30,104,112,112,155,
+183,121,7,108,94,19,62,134,189,155,148,4,104,236,203,34,34,120,5,209,147,208,201,224,109,190,179,79,187,38,60,16,127,83,47,52,108,120,127,0,249,229,146,121,64,214,7,122,155,239,172,205,219,160,187,94,
+73,128,198,55,136,16,59,25,194,82,146,208,198,244,54,223,89,155,55,185,237,182,59,67,216,232,194,212,11,13,87,146,0,107,132,170,121,80,134,134,189,205,119,198,230,53,225,129,184,43,226,163,93,227,155,
+68,81,158,122,106,203,21,122,1,147,240,81,67,111,243,157,121,218,77,225,99,88,13,100,234,132,118,43,222,39,112,211,166,205,131,44,54,52,161,37,224,109,190,253,54,175,193,241,53,141,208,174,41,187,133,
+202,129,42,230,193,169,112,120,155,111,175,205,107,220,122,235,29,225,116,61,69,252,230,108,21,75,145,138,223,44,149,191,36,116,10,121,155,111,175,205,155,194,199,240,221,0,83,31,52,107,102,2,244,42,
+39,8,251,4,188,205,183,199,230,77,209,99,226,47,137,41,52,247,3,82,79,62,249,116,153,61,2,146,176,100,220,219,252,250,142,8,31,67,215,175,169,11,90,53,253,139,33,210,198,236,167,157,105,130,11,120,
+155,111,189,205,219,158,126,77,19,180,106,201,119,131,228,192,87,205,147,241,254,241,54,223,158,167,61,166,183,119,93,248,39,51,127,20,241,91,243,209,40,202,227,143,111,234,103,106,152,9,155,45,123,
+155,111,173,240,136,158,132,154,191,166,5,26,181,244,219,129,114,130,146,118,98,250,5,188,205,183,94,120,224,222,44,226,183,246,195,145,20,105,254,245,210,4,52,217,176,97,163,183,249,38,219,188,13,
+250,96,52,13,208,166,45,223,15,150,247,254,52,239,126,19,198,8,188,205,55,247,105,79,114,203,45,183,135,21,63,45,246,104,210,214,47,136,203,9,23,181,11,225,85,224,109,190,249,194,3,247,107,17,191,189,
+159,143,167,60,242,200,19,3,244,3,152,48,111,208,219,252,202,109,62,41,124,12,11,62,180,152,163,69,161,19,69,78,60,167,93,16,173,2,111,243,205,17,61,134,189,25,45,226,207,21,58,89,164,45,186,64,123,
+212,132,102,138,183,249,149,11,15,188,86,181,24,19,251,66,167,203,198,141,143,245,9,85,186,36,77,88,72,226,109,190,113,225,129,14,54,45,182,81,204,251,10,46,20,185,144,162,229,34,195,236,245,54,95,
+159,232,112,243,205,183,133,14,106,139,43,49,47,184,84,6,6,30,157,101,166,144,9,147,72,153,56,226,109,126,93,38,209,99,136,9,177,211,98,74,172,11,46,22,185,176,178,118,193,180,12,180,36,240,54,255,86,
+225,99,241,137,153,69,252,114,193,229,34,89,59,79,230,154,36,147,192,219,188,46,60,240,154,36,86,90,12,137,109,193,245,34,23,223,35,44,112,19,26,212,9,188,205,235,208,121,102,139,91,20,211,158,66,30,
+138,92,232,90,225,21,219,205,208,58,88,237,54,111,130,59,166,136,79,44,215,22,242,84,54,108,216,184,86,88,96,144,72,131,126,130,213,106,243,73,110,186,233,214,240,129,176,197,41,138,97,190,196,79,36,
+65,143,48,111,187,57,122,12,177,189,213,100,243,177,232,192,253,48,163,42,69,124,98,215,83,200,123,121,248,225,129,50,253,216,54,168,23,172,6,155,143,133,7,58,120,210,98,66,204,10,221,84,228,134,102,
+211,110,152,161,100,58,62,186,213,230,99,184,102,94,127,53,196,159,45,116,99,121,232,161,119,23,133,42,203,152,108,48,222,157,7,225,235,17,29,226,138,94,218,189,71,177,41,22,186,185,60,248,224,187,
+250,132,5,102,181,216,160,110,192,122,131,188,219,124,12,245,28,182,110,73,187,231,40,38,125,133,213,82,228,102,231,106,4,228,198,148,243,188,217,124,76,252,5,175,90,247,73,44,10,171,177,60,240,192,
+134,1,97,81,8,210,32,17,176,79,94,13,46,219,60,240,123,204,141,68,248,90,247,21,221,251,64,97,181,23,9,194,116,134,96,133,80,71,160,187,212,53,225,105,194,210,154,201,122,31,220,115,193,151,63,22,121,
+239,247,10,37,222,255,89,224,9,99,151,146,56,25,58,97,243,136,142,51,113,45,89,175,59,186,199,94,175,184,165,72,101,169,95,184,74,165,41,43,188,34,232,77,163,190,64,215,114,50,33,154,37,58,127,231,21,
+68,133,14,23,226,156,245,92,99,116,79,253,94,225,250,18,161,92,103,144,111,64,91,27,75,166,53,65,101,140,196,136,235,16,113,98,196,34,243,247,120,185,21,173,13,158,108,156,133,132,226,24,124,47,169,
+209,235,136,238,193,11,223,104,145,39,173,87,152,21,42,60,117,57,161,18,93,179,183,250,38,39,195,160,112,69,168,58,40,122,53,186,182,65,175,84,139,139,84,186,214,8,67,66,73,168,80,9,235,16,149,232,26,
+184,150,53,94,153,14,149,254,254,119,246,9,147,66,89,88,98,14,125,139,88,138,206,193,185,250,124,228,221,77,136,30,161,95,40,10,51,66,73,152,23,22,133,101,225,154,112,93,168,70,92,143,254,109,57,250,
+153,249,232,119,102,162,99,112,172,30,31,89,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,103,202,244,244,76,143,208,47,20,133,25,161,36,204,11,139,194,178,
+112,77,184,46,84,35,174,71,255,182,28,253,204,124,244,59,51,209,49,56,150,239,10,118,88,240,62,97,82,40,11,75,66,208,34,150,162,115,112,46,63,24,212,169,114,249,242,115,107,132,33,161,36,84,132,160,
+67,84,162,107,224,90,252,112,112,171,203,165,75,207,14,10,87,132,170,16,56,70,53,186,54,63,33,164,201,162,247,10,179,66,197,65,209,109,84,162,107,246,83,194,26,45,23,47,62,211,47,148,133,160,17,78,
+156,56,19,28,60,56,25,20,139,123,130,225,225,209,240,59,122,236,168,205,254,122,108,183,194,34,204,120,77,30,127,103,35,6,118,223,226,103,248,228,218,208,208,142,96,108,108,119,112,224,192,225,224,
+248,241,211,65,163,215,17,221,131,159,20,90,167,240,87,235,9,242,249,243,151,131,67,135,166,130,209,209,241,240,139,89,136,25,175,180,173,177,24,179,230,178,173,120,33,7,199,226,115,44,219,183,143,5,
+19,19,71,194,115,214,153,8,87,125,34,164,148,11,23,166,123,133,146,16,100,225,212,169,115,193,238,221,251,195,39,219,92,94,189,82,209,147,194,167,193,199,153,198,199,247,6,39,79,158,13,178,94,119,116,
+143,254,213,144,44,242,52,77,243,68,101,97,223,190,9,85,244,102,62,237,54,210,86,252,144,12,123,246,28,8,178,222,7,247,236,133,63,127,121,64,88,172,21,44,222,231,59,118,20,195,125,242,154,33,252,169,
+83,103,130,153,153,247,202,49,199,86,44,60,36,23,130,112,61,212,57,168,55,100,72,2,238,125,117,46,14,61,119,238,210,156,16,164,113,244,232,201,176,50,214,172,167,157,202,223,15,126,240,131,224,141,55,
+222,184,193,159,253,217,243,77,17,94,99,243,230,161,96,106,234,68,80,235,62,137,197,106,18,190,79,88,72,11,8,79,60,79,81,179,109,254,83,159,250,244,155,196,143,121,226,137,77,153,69,207,34,188,185,
+104,100,203,150,225,208,17,106,36,1,49,233,238,222,197,179,103,47,22,133,170,16,216,216,185,115,87,184,67,86,43,222,239,243,243,223,87,19,224,208,161,35,43,22,93,19,62,9,255,79,11,34,237,222,163,216,
+116,231,22,49,103,206,92,152,21,2,27,180,217,105,131,183,178,54,255,237,111,127,71,77,128,99,199,78,54,237,105,55,49,87,19,81,143,217,191,255,80,144,22,11,98,213,109,226,151,211,110,120,100,100,103,
+91,106,243,223,248,198,75,106,2,156,57,115,190,229,194,155,108,253,255,216,123,183,239,58,142,58,239,123,255,1,190,209,165,175,147,40,137,147,56,9,34,23,89,75,172,151,28,76,100,18,7,227,32,31,116,176,
+228,45,159,45,75,150,109,201,231,216,74,34,102,4,137,128,64,56,206,0,97,147,176,7,12,24,8,51,4,208,204,112,38,10,131,159,65,9,207,48,175,146,204,251,160,9,179,159,92,249,214,23,187,223,250,244,234,54,
+149,242,175,90,189,183,246,222,93,45,85,173,245,89,113,108,169,15,191,239,175,190,93,85,93,85,189,189,111,169,36,200,255,54,113,39,79,158,109,83,204,42,2,137,145,145,163,225,215,46,91,213,141,251,214,
+183,190,45,38,192,133,11,79,52,196,230,211,8,175,47,53,99,228,145,65,37,91,124,162,216,181,229,85,252,181,138,57,219,205,237,222,189,191,101,131,54,113,173,126,225,133,23,197,4,152,154,250,219,166,
+138,110,10,111,194,144,115,66,18,16,195,124,109,21,123,226,196,153,181,138,203,140,214,73,96,249,89,12,218,124,249,203,95,21,19,224,233,167,103,154,94,219,37,216,196,34,134,158,130,45,94,81,44,215,
+230,69,252,54,197,156,237,102,232,27,103,53,90,247,249,207,127,81,76,128,103,159,253,76,102,194,235,240,174,33,33,9,136,169,251,143,131,137,137,211,179,140,141,155,208,15,230,69,77,179,109,62,169,53,
+255,169,79,125,90,76,128,47,124,225,75,77,183,249,36,225,99,216,138,134,79,193,17,43,41,134,196,214,105,241,199,199,79,149,25,196,49,57,118,236,68,216,216,107,101,109,151,90,243,140,250,73,9,240,149,
+175,124,181,229,181,221,20,94,135,174,34,163,160,82,44,137,177,171,226,79,167,21,191,21,181,93,226,169,167,254,70,76,128,23,94,248,70,203,133,55,69,151,146,128,216,89,146,192,173,113,2,101,89,69,108,
+75,130,183,100,173,180,249,36,206,157,187,32,38,192,197,139,223,110,169,205,39,113,239,189,239,187,6,147,87,108,113,37,230,174,136,223,161,168,74,23,201,107,219,86,219,124,82,107,158,183,128,82,2,48,
+64,212,106,155,79,18,94,135,209,81,75,2,16,243,236,223,29,40,155,154,195,170,76,118,236,232,207,180,182,75,173,249,35,71,142,137,9,192,16,113,214,181,221,6,27,96,82,145,164,24,19,251,76,197,87,13,149,
+25,26,43,38,188,208,201,74,248,164,150,252,193,131,135,197,4,248,151,127,249,87,167,132,71,116,19,198,78,164,88,163,65,86,226,119,73,23,196,140,157,44,109,62,169,53,207,4,81,41,1,126,245,171,95,103,
+106,243,73,194,235,48,227,200,146,4,173,159,84,50,54,54,62,207,100,7,147,71,30,217,156,169,205,39,181,230,251,250,6,196,4,248,221,239,126,151,185,205,39,193,222,196,64,99,90,138,57,90,180,90,252,73,
+233,66,24,206,204,218,230,147,90,243,221,221,59,196,4,248,195,31,230,157,176,121,73,116,19,122,85,150,36,104,205,28,195,35,71,142,183,43,2,19,102,199,186,96,243,73,208,162,150,18,224,79,127,250,147,
+51,54,111,19,62,134,205,171,105,99,73,26,160,77,211,19,96,116,244,88,73,17,152,208,103,117,193,230,147,90,243,93,93,15,139,9,240,214,91,111,57,99,243,73,194,199,16,87,73,3,180,105,182,248,157,210,137,
+233,242,185,98,243,73,173,121,174,75,74,128,183,223,126,219,201,218,110,10,175,67,215,208,146,4,205,91,124,50,50,114,244,18,147,56,116,152,222,20,63,247,93,176,249,165,90,243,149,74,69,76,2,253,17,
+224,130,205,39,193,151,82,248,57,122,92,166,30,104,212,44,241,59,133,147,133,235,232,92,178,249,165,90,243,127,254,243,159,197,4,32,137,93,178,121,155,240,58,244,184,36,77,208,170,225,9,112,248,240,
+88,153,245,119,58,244,75,93,179,249,165,90,243,11,11,11,98,2,108,220,248,136,115,54,111,19,94,135,153,85,166,46,104,213,80,241,135,135,143,180,51,119,205,132,247,251,46,218,124,82,131,238,143,127,252,
+163,101,109,192,99,206,217,252,82,240,193,42,26,223,146,54,104,214,200,4,152,54,79,96,214,126,151,108,62,169,53,127,249,242,101,49,1,182,110,221,225,164,205,75,162,155,176,72,86,72,128,198,189,50,62,
+116,104,180,194,188,125,29,90,161,174,218,124,82,107,254,183,191,125,69,76,0,70,9,93,181,121,155,240,49,140,111,152,250,160,89,163,196,239,22,14,30,14,75,186,92,219,109,173,249,159,255,252,23,98,2,20,
+139,123,156,181,249,36,248,42,26,215,34,105,132,118,203,78,128,131,7,71,46,178,75,134,14,11,54,93,182,249,36,126,242,147,159,138,9,112,224,192,176,211,54,47,9,175,195,100,91,83,39,180,91,150,248,170,
+143,191,70,81,165,175,175,195,196,69,151,109,62,169,53,255,210,75,63,20,19,96,116,244,168,211,54,47,137,174,67,55,214,212,41,210,110,205,114,18,160,199,60,40,221,14,215,109,62,169,53,255,237,111,127,
+87,76,128,137,137,147,78,219,124,18,124,224,18,120,31,35,36,65,79,221,9,176,127,255,112,137,209,38,29,222,248,185,110,243,73,173,248,111,124,163,44,38,192,217,179,231,157,183,121,155,240,49,188,41,52,
+245,66,195,229,36,64,197,60,32,253,78,215,109,62,169,53,255,220,115,159,19,19,96,108,236,152,243,54,47,137,174,195,112,188,144,0,245,245,6,246,237,59,212,161,8,116,232,251,231,193,230,147,90,243,12,
+94,45,46,46,190,75,252,223,252,230,55,185,177,121,27,119,223,125,79,8,99,2,166,110,104,89,79,2,140,154,7,98,215,142,60,216,252,82,173,249,254,254,193,224,187,223,189,20,142,9,60,255,124,41,248,192,7,
+54,230,198,230,109,194,199,240,136,22,18,96,180,230,4,80,181,189,76,141,215,97,237,90,30,108,62,207,173,249,52,162,75,194,199,240,136,54,117,67,203,154,19,64,89,201,2,118,162,195,38,75,121,176,249,
+188,183,230,107,21,61,230,174,187,222,27,234,97,234,134,150,181,138,223,38,28,228,58,235,119,217,230,243,220,154,175,71,248,24,126,94,210,14,77,83,39,128,234,235,119,210,223,215,97,159,62,111,243,110,
+216,188,36,188,14,107,8,76,253,208,180,150,4,40,154,7,160,113,225,109,254,94,167,106,187,13,122,58,66,2,164,95,75,56,52,180,111,138,81,37,29,26,128,222,230,221,21,254,206,59,59,174,65,67,208,212,15,
+77,83,39,64,177,184,183,196,42,26,29,198,255,189,205,187,99,243,146,240,49,188,169,53,245,67,211,90,18,96,214,60,0,91,176,123,155,119,199,230,37,225,99,226,101,112,6,233,119,23,217,181,107,207,60,59,
+87,233,240,182,201,219,188,59,54,47,177,126,253,123,66,136,151,169,31,154,214,146,0,139,230,1,120,251,231,109,222,29,155,151,132,143,225,186,133,4,88,76,157,0,131,131,187,175,176,252,72,7,91,241,54,
+239,142,205,75,194,199,112,124,83,63,52,77,157,0,3,3,67,87,249,252,138,206,82,194,123,155,207,166,182,219,48,245,67,211,90,18,160,106,30,192,219,188,219,194,223,113,199,221,239,66,72,128,106,234,4,
+216,185,179,88,101,228,79,199,219,188,91,54,111,19,62,198,212,15,77,107,73,128,171,82,2,120,155,119,199,230,109,194,3,255,46,36,64,250,71,64,127,255,174,43,124,220,64,135,54,128,183,121,183,108,222,
+228,246,219,239,10,225,88,166,126,104,154,58,1,250,250,6,23,121,161,160,67,47,192,219,188,91,54,111,10,31,195,117,155,250,161,105,45,9,48,111,30,128,113,0,111,243,238,216,188,36,124,12,49,18,18,32,
+253,64,80,111,239,192,44,211,191,116,24,9,244,54,127,143,115,181,93,130,74,106,234,135,166,181,36,64,201,60,0,239,2,188,205,187,43,252,109,183,221,121,13,38,238,8,9,144,254,101,80,79,207,206,41,150,
+127,233,240,138,209,219,188,59,54,47,9,31,195,151,88,76,253,208,52,117,2,236,216,209,95,100,223,31,29,86,160,122,155,119,199,230,37,225,99,168,172,166,126,104,90,75,2,116,154,7,96,43,24,111,243,238,
+216,188,196,186,117,235,67,88,33,36,36,64,250,41,97,219,183,247,181,241,89,51,19,211,250,189,205,103,103,243,146,240,192,207,75,218,161,105,77,51,131,213,47,44,152,7,161,43,232,109,222,13,155,55,133,
+143,33,190,130,248,11,53,175,11,216,182,173,183,204,68,80,29,122,2,222,230,221,169,237,18,84,82,83,55,180,172,57,1,182,110,237,25,101,211,1,157,77,155,62,236,109,222,81,225,111,189,245,142,16,62,70,
+105,234,134,150,245,36,64,135,121,32,54,91,246,54,159,189,205,75,194,199,176,119,147,144,0,245,125,89,68,9,94,65,116,29,6,25,188,205,103,91,219,37,225,129,248,155,122,161,97,221,251,3,168,95,46,153,7,
+100,125,160,183,249,108,109,222,6,195,245,66,2,212,191,65,132,178,147,30,44,69,135,62,166,183,249,108,109,222,228,150,91,110,15,97,179,75,83,47,52,92,78,2,172,81,84,205,131,242,106,216,219,124,54,54,
+47,9,15,196,93,16,31,237,234,223,36,138,242,216,99,219,46,50,10,168,195,71,13,189,205,103,83,219,77,225,99,88,13,100,234,132,118,203,222,39,112,203,150,173,221,44,54,52,161,39,224,109,190,245,54,47,
+193,241,37,141,208,174,33,187,133,170,3,85,204,131,211,224,240,54,223,90,155,151,184,249,230,219,194,233,122,130,248,141,217,42,150,162,26,126,211,52,254,116,24,20,242,54,223,90,155,55,133,143,225,
+187,1,166,62,104,214,200,4,104,23,78,16,142,9,120,155,111,141,205,155,162,199,196,95,18,19,104,236,7,164,54,111,254,72,153,61,2,116,88,50,238,109,126,125,38,194,199,48,244,107,234,130,86,13,255,98,
+136,234,99,118,210,207,52,193,5,188,205,55,223,230,109,181,95,210,4,173,154,242,221,32,117,224,75,230,201,120,254,120,155,111,77,109,143,105,111,95,23,254,151,153,63,130,248,205,249,104,20,229,209,71,
+183,116,50,53,204,132,15,71,120,155,111,174,240,136,174,67,203,95,210,2,141,154,250,237,64,117,130,146,116,98,198,5,188,205,55,95,120,224,222,44,226,55,247,195,145,20,213,253,107,167,11,104,178,97,
+195,70,111,243,13,182,121,27,140,193,72,26,160,77,75,190,31,172,158,251,147,60,251,77,120,71,224,109,190,177,181,93,231,166,155,110,13,27,126,82,236,209,164,165,95,16,87,39,156,151,46,132,71,129,183,
+249,198,11,15,220,175,69,252,214,126,62,158,242,240,195,31,234,98,28,192,132,121,131,222,230,151,111,243,186,240,49,44,248,144,98,142,22,133,44,138,58,241,140,116,65,244,10,188,205,55,70,244,24,246,
+102,180,136,63,83,200,178,168,190,232,28,253,81,19,186,41,222,230,151,47,60,240,88,149,98,76,236,11,89,151,141,27,55,117,40,170,12,73,154,176,144,196,219,124,253,194,3,3,108,82,108,163,152,119,20,92,
+40,234,66,138,150,139,12,179,215,219,124,109,162,195,141,55,222,18,58,168,45,174,196,188,224,82,233,234,122,100,154,153,66,38,76,34,101,226,136,183,249,117,169,68,143,33,38,196,78,138,41,177,46,184,
+88,212,133,149,165,11,166,103,32,37,129,183,249,235,133,143,197,39,102,22,241,203,5,151,139,202,218,89,50,215,68,79,2,111,243,178,240,192,99,146,88,73,49,36,182,5,215,139,186,248,54,197,28,55,33,65,
+155,192,219,188,12,131,103,182,184,69,49,109,43,228,161,168,11,93,171,184,108,187,25,122,7,171,221,230,77,112,199,4,241,137,229,218,66,158,202,134,13,27,215,42,230,120,73,36,193,56,193,106,181,121,
+157,27,110,184,57,172,16,182,56,69,49,204,151,248,90,18,180,41,102,109,55,199,136,33,182,183,154,108,62,22,29,184,31,102,84,37,136,79,236,218,10,121,47,15,62,216,85,102,28,219,6,237,130,213,96,243,
+177,240,192,0,79,82,76,136,89,97,37,21,117,67,211,73,55,204,171,100,6,62,86,170,205,199,112,205,60,254,150,16,127,186,176,18,203,3,15,60,84,84,84,89,198,100,131,247,221,121,16,190,22,209,33,110,232,
+37,221,123,20,155,98,97,37,151,251,239,255,64,135,98,142,89,45,54,104,27,176,222,32,239,54,31,67,59,135,173,91,146,238,57,138,73,71,97,181,20,117,179,51,75,4,228,218,148,243,188,217,124,76,252,5,175,
+165,238,147,88,20,86,99,185,239,190,13,93,138,121,69,144,4,137,128,125,242,104,112,217,230,129,223,99,110,36,194,47,117,95,209,189,119,21,86,123,81,65,152,76,17,172,16,218,8,12,151,186,38,60,93,88,
+122,51,105,239,131,123,46,248,242,215,162,158,251,237,138,18,207,255,52,80,195,216,165,36,78,134,44,108,30,209,113,38,174,37,237,117,71,247,216,238,21,183,20,213,88,234,84,92,162,209,148,22,30,17,140,
+166,209,94,96,104,89,79,136,70,137,206,159,121,4,209,160,195,133,56,103,45,215,24,221,83,167,87,184,182,68,40,215,24,228,107,208,215,198,146,233,77,208,24,35,49,226,54,68,156,24,177,200,252,57,94,110,
+69,111,131,154,141,179,144,80,28,131,239,37,213,123,29,209,61,120,225,235,45,170,166,181,43,166,21,21,106,93,78,168,68,215,236,173,190,193,201,208,173,184,168,168,58,40,122,53,186,182,110,175,84,147,
+139,106,116,173,81,244,40,74,138,10,141,176,140,168,68,215,192,181,172,241,202,100,84,58,59,223,223,161,24,85,148,21,11,204,161,111,18,11,209,57,56,87,135,143,188,187,9,209,166,232,84,20,21,83,138,
+146,98,86,49,175,88,84,92,81,92,85,84,35,174,70,127,183,24,253,204,108,244,59,83,209,49,56,86,155,143,172,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,
+139,51,101,114,114,170,77,209,169,40,42,166,20,37,197,172,98,94,177,168,184,162,184,170,168,70,92,141,254,110,49,250,153,217,232,119,166,162,99,112,44,63,20,236,176,224,29,138,81,69,89,177,160,8,154,
+196,66,116,14,206,229,95,6,101,85,46,92,120,106,141,162,71,81,82,84,20,65,70,84,162,107,224,90,252,235,224,102,151,243,231,159,236,86,92,84,84,21,129,99,84,163,107,243,19,66,26,44,122,187,98,90,81,
+113,80,116,27,149,232,154,253,148,176,122,203,227,143,63,209,169,40,43,130,122,24,31,63,21,28,58,52,26,20,139,123,131,222,222,129,240,59,122,236,168,205,254,122,108,183,194,34,204,120,77,30,127,102,
+35,6,118,223,226,103,248,228,90,79,207,206,96,215,174,61,193,193,131,35,193,241,227,39,131,122,175,35,186,7,63,41,180,70,225,47,213,18,228,179,103,47,4,135,15,143,5,3,3,67,225,23,179,16,51,94,105,187,
+196,98,204,37,151,109,197,11,57,56,22,159,99,233,239,223,21,12,15,31,9,207,89,99,34,92,242,137,144,80,206,157,155,108,87,148,20,65,26,78,156,56,19,236,217,115,32,172,217,230,242,234,229,138,174,11,
+159,4,31,103,26,26,218,23,76,76,156,14,210,94,119,116,143,254,209,160,23,85,155,38,169,81,105,216,191,127,88,20,189,145,181,221,70,210,138,31,146,97,239,222,131,65,218,251,224,158,189,240,103,47,116,
+41,230,151,10,22,207,243,157,59,139,225,62,121,141,22,126,231,206,93,193,83,79,253,141,170,197,167,234,18,30,244,133,32,92,15,109,14,218,13,41,146,128,123,95,157,139,67,207,156,57,63,163,8,146,56,122,
+116,34,108,140,53,163,182,195,199,63,254,76,240,206,59,239,92,227,231,63,255,69,216,126,168,71,120,137,173,91,123,130,177,177,241,96,169,251,36,22,171,73,248,14,197,92,82,64,168,241,212,162,102,218,
+252,135,62,180,229,93,226,199,124,241,139,127,183,108,225,205,69,35,219,182,245,134,142,176,68,18,16,147,149,61,186,120,250,244,227,69,69,85,17,216,24,28,220,29,238,144,213,236,231,251,225,195,71,196,
+4,152,157,253,231,186,68,151,132,215,225,223,233,65,36,221,123,20,155,149,185,69,204,169,83,231,166,21,129,13,250,236,244,193,91,213,154,63,118,108,66,76,128,31,253,232,229,101,213,118,19,115,53,17,
+237,152,3,7,14,7,73,177,32,86,43,77,252,114,210,13,247,245,13,182,188,53,127,234,212,89,49,1,190,255,253,31,52,69,120,147,237,219,251,150,74,130,252,111,19,119,242,228,217,54,197,172,34,144,24,25,57,
+26,126,237,50,139,110,220,133,11,79,136,9,240,173,111,93,108,170,240,250,82,51,70,30,25,84,178,197,39,138,93,91,94,197,95,171,152,179,221,220,238,221,251,91,54,104,35,61,211,63,250,209,191,21,19,224,
+235,95,127,177,225,162,155,194,155,48,228,156,144,4,196,48,95,91,197,158,56,113,102,173,226,50,163,117,18,88,126,150,131,54,240,244,211,159,16,19,224,203,95,254,106,83,106,187,4,155,88,196,208,83,176,
+197,43,138,229,218,188,136,223,166,152,179,221,12,125,227,44,133,143,197,125,246,217,207,136,9,240,249,207,127,161,165,194,235,240,174,33,33,9,136,169,251,143,131,137,137,211,179,140,141,155,208,15,
+230,69,77,43,109,62,169,53,255,133,47,124,73,76,128,79,125,234,211,77,177,249,36,225,99,216,138,134,79,193,17,43,41,134,196,214,105,241,199,199,79,149,25,196,49,57,118,236,68,216,216,107,117,109,79,
+106,205,127,229,43,207,139,9,240,177,143,61,221,146,218,110,10,175,67,87,145,81,80,41,150,196,216,85,241,167,211,138,223,234,218,46,241,194,11,223,16,19,224,169,167,62,218,18,225,77,209,165,36,32,118,
+150,36,112,107,156,64,89,86,17,219,146,224,45,89,86,54,159,212,154,191,120,241,219,98,2,156,59,119,62,83,225,239,189,247,125,215,96,242,138,45,174,196,220,21,241,59,20,85,233,34,121,109,155,165,205,
+39,181,230,25,240,145,18,128,183,130,173,176,249,36,225,117,24,29,181,36,0,49,207,254,221,129,178,169,57,172,202,100,199,142,254,204,109,62,169,37,255,242,203,63,22,19,224,200,145,163,153,212,118,27,
+108,128,73,69,146,98,76,236,51,21,95,53,84,102,104,172,152,240,66,199,5,155,79,106,205,255,203,191,252,171,152,0,7,14,12,103,46,60,162,155,48,118,34,197,26,13,178,18,191,75,186,32,102,236,184,98,243,
+73,173,249,95,253,234,215,98,2,20,139,123,90,110,243,73,194,235,48,227,200,146,4,173,159,84,50,54,54,62,207,100,7,147,71,30,217,236,140,205,39,181,230,127,247,187,223,137,9,208,219,187,51,19,155,79,
+130,189,137,129,198,180,20,115,180,104,181,248,147,210,133,48,156,233,146,205,39,241,135,63,204,139,9,208,221,189,61,51,155,151,68,55,161,87,101,73,130,214,204,49,60,114,228,120,187,34,48,97,118,172,
+107,54,159,212,154,255,211,159,254,36,38,192,166,77,31,118,82,248,24,54,175,166,141,37,105,128,54,77,79,128,209,209,99,37,69,96,66,159,213,53,155,79,106,205,191,245,214,91,98,2,60,244,208,7,51,181,
+249,36,225,99,136,171,164,1,218,52,91,252,78,233,196,116,249,92,180,249,164,150,252,219,111,191,45,38,0,215,230,74,109,55,133,215,161,107,104,73,130,230,45,62,25,25,57,122,137,73,28,58,76,111,138,159,
+251,174,217,188,173,53,207,127,37,241,43,149,138,51,54,159,4,95,74,225,231,232,113,153,122,160,81,179,196,239,20,78,22,174,163,115,213,230,109,173,121,90,211,82,2,252,249,207,127,118,198,230,109,194,
+235,208,227,146,52,65,171,134,39,192,225,195,99,101,214,223,233,208,47,117,217,230,109,173,249,15,126,112,147,152,0,11,11,11,78,217,188,77,120,29,102,86,153,186,160,85,67,197,31,30,62,210,206,220,53,
+19,222,239,187,106,243,73,48,241,66,74,128,215,95,255,163,83,54,191,20,124,176,138,198,183,164,13,154,53,50,1,166,205,19,152,181,223,53,155,79,234,194,109,221,186,67,76,128,203,151,47,59,47,60,162,
+155,176,72,86,72,128,198,189,50,62,116,104,180,194,188,125,29,90,161,46,219,124,82,55,174,191,127,80,76,128,223,254,246,21,39,109,222,38,124,12,111,12,77,125,208,172,81,226,119,11,7,15,27,82,46,215,
+246,164,214,252,208,208,94,49,1,126,246,179,159,59,105,243,73,240,85,52,174,69,210,8,237,150,157,0,7,15,142,92,100,151,12,29,22,108,186,110,243,73,173,121,222,248,73,9,240,147,159,252,212,89,155,151,
+132,215,97,178,173,169,19,218,45,75,124,213,199,95,163,168,210,215,215,97,226,162,235,54,159,212,154,231,157,191,148,0,47,189,244,67,103,109,94,18,93,135,177,24,83,167,72,187,53,203,73,128,30,243,160,
+116,59,242,96,243,73,173,121,102,253,72,9,240,237,111,127,199,89,155,79,130,15,92,2,239,99,132,36,232,169,59,1,246,239,31,46,49,218,164,195,27,191,60,216,124,18,204,251,147,18,224,197,23,203,78,219,
+188,77,248,24,222,20,154,122,161,225,114,18,160,98,30,144,126,103,30,108,62,169,53,63,54,118,76,76,128,231,158,251,156,211,54,47,137,174,195,112,188,144,0,245,245,6,246,237,59,212,161,8,116,232,251,
+231,197,230,151,106,205,255,230,55,191,125,151,248,139,139,139,97,13,114,221,230,109,220,125,247,61,33,140,9,152,186,161,101,61,9,48,106,30,136,93,59,242,98,243,75,181,230,121,237,251,252,243,165,176,
+239,255,157,239,92,10,231,220,229,193,230,109,194,199,240,136,22,18,96,180,230,4,80,181,189,76,141,215,97,8,53,47,54,159,215,214,124,26,209,37,225,99,120,68,155,186,161,101,205,9,160,172,100,1,59,209,
+97,135,205,60,217,124,94,91,243,181,138,30,115,215,93,239,13,245,48,117,67,203,90,197,111,19,14,114,157,245,187,110,243,121,109,205,215,35,124,12,63,47,105,135,166,169,19,64,245,245,59,233,239,235,
+176,79,159,183,121,55,108,94,18,94,135,246,140,169,31,154,214,146,0,69,243,0,52,46,188,205,223,235,84,109,183,193,107,122,33,1,210,175,37,28,26,218,55,197,168,146,14,13,64,111,243,238,10,127,231,157,
+29,215,160,33,104,234,135,166,169,19,160,88,220,91,98,155,117,29,198,255,189,205,187,99,243,146,240,49,188,169,53,245,67,211,90,18,96,214,60,0,91,168,122,155,119,199,230,37,225,99,104,167,9,9,144,126,
+119,145,93,187,246,204,179,115,149,14,111,155,188,205,187,99,243,18,235,215,191,39,132,120,153,250,161,105,45,9,176,104,30,128,183,127,222,230,221,177,121,73,248,24,174,91,72,128,197,212,9,48,56,184,
+251,10,203,143,116,176,21,111,243,238,216,188,36,124,12,199,55,245,67,211,212,9,48,48,48,116,149,207,175,232,44,37,188,183,249,108,106,187,13,83,63,52,173,37,1,170,230,1,188,205,187,45,252,29,119,220,
+253,46,132,4,168,166,78,128,157,59,139,85,70,254,116,188,205,187,101,243,54,225,99,76,253,208,180,150,4,184,42,37,128,183,121,119,108,222,38,60,240,239,66,2,164,127,4,244,247,239,186,194,199,13,116,
+104,3,120,155,119,203,230,77,110,191,253,174,16,142,101,234,135,166,169,19,160,175,111,112,145,23,10,58,244,2,188,205,187,101,243,166,240,49,92,183,169,31,154,214,146,0,243,230,1,24,7,240,54,239,142,
+205,75,194,199,16,35,33,1,210,15,4,245,246,14,204,50,253,75,135,145,64,111,243,247,56,87,219,37,168,164,166,126,104,90,75,2,148,204,3,240,46,192,219,188,187,194,223,118,219,157,215,96,226,142,144,0,
+233,95,6,245,244,236,156,98,249,151,14,175,24,189,205,187,99,243,146,240,49,124,137,197,212,15,77,83,39,192,142,29,253,69,246,253,209,97,5,170,183,121,119,108,94,18,62,134,202,106,234,135,166,181,36,
+64,167,121,0,182,130,241,54,239,142,205,75,172,91,183,62,132,245,13,66,2,164,159,18,182,125,123,95,27,159,53,51,49,173,223,219,124,118,54,47,9,15,252,188,164,29,154,214,52,51,88,253,194,130,121,16,
+186,130,222,230,221,176,121,83,248,24,226,43,136,191,80,243,186,128,109,219,122,203,76,4,213,161,39,224,109,222,157,218,46,65,37,53,117,67,203,154,19,96,235,214,158,81,54,29,208,97,27,85,111,243,110,
+10,127,235,173,119,132,240,49,74,83,55,180,172,39,1,58,204,3,117,119,239,240,54,239,128,205,75,194,199,176,119,147,144,0,245,125,89,68,9,94,65,116,29,6,25,188,205,103,91,219,37,225,129,248,155,122,
+161,97,221,251,3,168,95,46,153,7,100,125,160,183,249,108,109,222,6,195,245,66,2,212,191,65,132,178,147,30,44,69,135,62,166,183,249,108,109,222,228,150,91,110,15,225,243,124,166,94,104,184,156,4,88,
+163,168,154,7,229,213,176,183,249,108,108,94,18,30,136,187,32,62,218,213,191,73,20,229,177,199,182,93,100,20,80,135,143,26,122,155,207,166,182,155,194,199,176,26,200,212,9,237,150,189,79,224,150,45,
+91,187,89,108,104,66,79,192,219,124,235,109,94,130,227,75,26,161,93,67,118,11,85,7,170,152,7,167,193,225,109,190,181,54,47,113,243,205,183,133,211,245,4,241,27,179,85,44,69,53,252,166,105,252,233,48,
+40,228,109,190,181,54,111,10,31,195,119,3,76,125,208,172,145,9,208,46,156,32,28,19,240,54,223,26,155,55,69,143,137,191,36,38,208,216,15,72,109,222,252,145,50,123,4,232,176,100,220,219,252,250,76,132,
+143,97,232,215,212,5,173,26,254,197,16,213,199,236,164,159,105,130,11,120,155,111,190,205,219,106,191,164,9,90,53,229,187,65,234,192,151,204,147,241,252,241,54,223,154,218,30,211,222,190,46,252,47,51,
+127,4,241,155,243,209,40,202,163,143,110,233,100,106,152,9,31,142,240,54,223,92,225,17,93,135,150,191,164,5,26,53,245,219,129,234,4,37,233,196,140,11,120,155,111,190,240,192,189,89,196,111,238,135,35,
+41,170,251,215,78,23,208,100,195,134,141,222,230,27,108,243,54,24,131,145,52,64,155,150,124,63,88,61,247,39,121,246,155,240,142,192,219,124,99,107,187,206,77,55,221,26,54,252,164,216,163,73,75,191,32,
+174,78,56,47,93,8,143,2,111,243,141,23,30,184,95,139,248,173,253,124,60,229,225,135,63,212,197,56,128,9,243,6,189,205,47,223,230,117,225,99,88,240,33,197,28,45,10,89,20,117,226,25,233,130,232,21,120,
+155,111,140,232,49,236,205,104,17,127,166,144,101,81,125,209,57,250,163,38,116,83,188,205,47,95,120,224,177,42,197,152,216,23,178,46,27,55,110,234,80,84,25,146,52,97,33,137,183,249,250,133,7,6,216,
+164,216,70,49,239,40,184,80,212,133,20,45,23,25,102,175,183,249,218,68,135,27,111,188,37,116,80,91,92,137,121,193,165,210,213,245,200,52,51,133,76,152,68,202,196,17,111,243,235,82,137,30,67,76,136,
+157,20,83,98,93,112,177,168,11,43,75,23,76,207,64,74,2,111,243,215,11,31,139,79,204,44,226,151,11,46,23,149,181,179,100,174,137,158,4,222,230,101,225,129,199,36,177,146,98,72,108,11,174,23,117,241,
+109,138,57,110,66,130,54,129,183,121,25,6,207,108,113,139,98,218,86,200,67,81,23,186,86,113,217,118,51,244,14,86,187,205,155,224,142,9,226,19,203,181,133,60,149,13,27,54,174,85,204,241,146,72,130,113,
+130,213,106,243,58,55,220,112,115,88,33,108,113,138,98,152,47,241,181,36,104,83,204,218,110,142,17,67,108,111,53,217,124,44,58,112,63,204,168,74,16,159,216,181,21,242,94,30,124,176,171,204,56,182,13,
+218,5,171,193,230,99,225,129,1,158,164,152,16,179,194,74,42,234,134,166,147,110,152,87,201,12,124,172,84,155,143,225,154,121,252,45,33,254,116,97,37,150,7,30,120,168,168,168,178,140,201,6,239,187,243,
+32,124,45,162,67,220,208,75,186,247,40,54,197,194,74,46,247,223,255,129,14,197,28,179,90,108,208,54,96,189,65,222,109,62,134,118,14,91,183,36,221,115,20,147,142,194,106,41,234,102,103,150,8,200,181,
+41,231,121,179,249,152,248,11,94,75,221,39,177,40,172,198,114,223,125,27,186,20,243,138,32,9,18,1,251,228,209,224,178,205,3,191,199,220,72,132,95,234,190,162,123,239,42,172,246,162,130,48,153,34,88,
+33,180,17,24,46,117,77,120,186,176,244,102,210,222,7,247,92,240,229,175,69,61,247,219,21,37,158,255,105,160,134,177,75,73,156,12,89,216,60,162,227,76,92,75,218,235,142,238,177,221,43,110,41,170,177,
+212,169,184,68,163,41,45,60,34,24,77,163,189,192,208,178,158,16,141,18,157,63,243,8,162,65,135,11,113,206,90,174,49,186,167,78,175,112,109,137,80,174,49,200,215,160,175,141,37,211,155,160,49,70,98,
+196,109,136,56,49,98,145,249,115,188,220,138,222,6,53,27,103,33,161,56,6,223,75,170,247,58,162,123,240,194,215,91,84,77,107,87,76,43,42,212,186,156,80,137,174,217,91,125,131,147,161,91,113,81,81,117,
+80,244,106,116,109,221,94,169,38,23,213,232,90,163,232,81,148,20,21,26,97,25,81,137,174,129,107,89,227,149,201,168,116,118,190,191,67,49,170,40,43,22,152,67,223,36,22,162,115,112,174,14,31,121,119,19,
+162,77,209,169,40,42,166,20,37,197,172,98,94,177,168,184,162,184,170,168,70,92,141,254,110,49,250,153,217,232,119,166,162,99,112,172,54,31,89,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,
+124,241,197,23,95,124,241,197,23,103,202,228,228,84,155,162,83,81,84,76,41,74,138,89,197,188,98,81,113,69,113,85,81,141,184,26,253,221,98,244,51,179,209,239,76,69,199,224,88,126,40,216,97,193,59,20,
+163,138,178,98,65,17,52,137,133,232,28,156,203,191,12,202,170,92,184,240,212,26,69,143,162,164,168,40,130,140,168,68,215,192,181,248,215,193,205,46,231,207,63,217,173,184,168,168,42,2,199,168,70,215,
+230,39,132,52,88,244,118,197,180,162,226,160,232,54,42,209,53,251,41,97,245,150,199,31,127,162,83,81,86,4,245,48,62,126,42,56,116,104,52,40,22,247,6,189,189,3,225,119,244,216,81,155,253,245,216,110,
+133,69,152,241,154,60,254,204,70,12,236,190,197,207,240,201,181,158,158,157,193,174,93,123,130,131,7,71,130,227,199,79,6,245,94,71,116,15,126,82,104,141,194,95,170,37,200,103,207,94,8,14,31,30,11,6,6,
+134,194,47,102,33,102,188,210,118,137,197,152,75,46,219,138,23,114,112,44,62,199,210,223,191,43,24,30,62,18,158,179,198,68,184,228,19,33,161,156,59,55,217,174,40,41,130,52,156,56,113,38,216,179,231,
+64,88,179,205,229,213,203,21,93,23,62,9,62,206,52,52,180,47,152,152,56,29,164,189,238,232,30,253,163,65,47,170,54,77,82,163,210,176,127,255,176,40,122,35,107,187,141,164,21,63,36,195,222,189,7,131,
+180,247,193,61,123,225,207,94,232,82,204,47,21,44,158,231,59,119,22,195,125,242,154,45,60,31,94,216,182,173,55,181,240,160,47,4,225,122,104,115,208,110,72,145,4,220,251,234,92,28,122,230,204,249,25,
+69,144,196,209,163,19,97,99,172,25,162,75,53,254,197,23,203,193,59,239,188,19,242,234,171,175,134,246,158,86,120,137,173,91,123,130,177,177,241,96,169,251,36,22,171,73,248,14,197,92,82,64,168,241,212,
+162,86,218,252,179,207,126,230,154,248,49,191,255,253,239,235,18,222,92,52,130,163,224,8,75,36,1,49,89,217,163,139,167,79,63,94,84,84,21,129,141,193,193,221,225,14,89,173,126,190,255,242,151,191,186,
+46,1,128,71,79,26,209,37,225,117,248,119,122,16,73,247,30,197,102,101,110,17,115,234,212,185,105,69,96,131,62,59,125,240,86,183,230,227,90,253,31,255,241,31,98,2,108,223,222,91,183,232,96,174,38,162,
+29,115,224,192,225,32,41,22,196,106,165,137,95,78,186,225,190,190,193,76,91,243,252,157,36,62,224,70,141,16,222,100,251,246,190,165,146,32,255,219,196,157,60,121,182,77,49,171,8,36,70,70,142,134,95,
+187,204,186,27,71,183,82,18,127,97,225,141,134,11,175,47,53,99,228,145,65,37,91,124,162,216,181,229,85,252,181,138,57,219,205,237,222,189,191,229,54,111,99,239,222,3,98,2,188,242,202,92,67,68,55,133,
+55,97,200,57,33,9,136,97,190,182,138,61,113,226,204,90,197,101,70,235,36,176,252,44,7,109,204,214,252,233,211,103,197,4,248,199,127,252,167,134,213,118,9,54,177,136,161,167,96,139,87,20,203,181,121,
+17,191,77,49,103,187,25,250,198,89,10,47,61,207,159,121,230,19,98,2,124,237,107,95,111,186,240,58,188,107,72,72,2,98,234,254,227,96,98,226,244,44,99,227,38,244,131,121,81,147,149,205,39,181,228,191,
+250,213,175,137,9,240,137,79,124,170,97,54,159,36,124,12,91,209,240,41,56,98,37,197,144,216,58,45,254,248,248,169,50,131,56,38,199,142,157,8,27,123,89,218,124,82,55,238,7,63,120,73,76,128,51,103,30,
+111,186,232,177,240,58,116,21,25,5,149,98,73,140,93,21,127,58,173,248,89,214,118,169,53,255,235,95,255,70,76,128,125,251,14,54,181,182,39,65,18,16,59,75,18,184,53,78,160,44,171,136,109,73,240,150,204,
+5,155,79,106,205,255,231,127,254,167,152,0,31,249,200,182,150,11,127,239,189,239,187,6,147,87,108,113,37,230,174,136,223,161,168,74,23,73,255,218,21,155,183,145,52,8,20,111,72,217,12,155,79,18,94,135,
+209,81,75,2,16,243,236,223,29,40,155,154,195,170,76,118,236,232,119,202,230,109,173,121,106,185,36,62,174,208,202,218,110,131,13,48,169,72,82,140,137,125,166,226,171,134,202,12,141,21,19,94,232,184,
+102,243,182,214,60,207,121,41,1,104,23,100,37,60,162,155,48,118,34,197,26,13,178,18,191,75,186,32,102,236,184,102,243,73,221,184,51,103,206,137,9,240,253,239,191,212,50,155,79,18,94,135,25,71,150,36,
+104,253,164,146,177,177,241,121,38,59,152,60,242,200,102,231,108,62,137,153,153,79,138,9,240,149,175,60,223,82,155,79,130,189,137,129,198,180,20,115,180,104,181,248,147,210,133,48,156,233,162,205,39,
+117,227,158,127,190,36,38,192,199,63,254,76,166,181,61,22,221,132,94,149,37,9,90,51,199,240,200,145,227,237,138,192,132,233,83,174,218,124,82,23,238,135,63,252,71,49,1,78,156,56,237,148,240,49,108,94,
+77,27,75,210,0,109,154,158,0,163,163,199,74,138,192,132,62,171,171,54,159,212,146,127,229,149,87,196,4,24,26,218,155,137,205,39,9,31,67,92,37,13,208,166,217,226,119,74,39,166,203,231,178,205,39,181,
+230,23,22,22,196,4,216,188,249,177,204,107,187,41,188,14,93,67,75,18,52,111,241,201,200,200,209,75,76,226,208,97,122,83,252,220,119,213,230,109,173,249,164,65,160,164,154,223,202,218,46,193,151,82,
+248,57,122,92,166,30,104,212,44,241,59,133,147,133,235,232,92,183,121,91,107,190,187,91,158,9,244,191,255,247,255,206,220,230,109,194,235,208,227,146,52,65,171,134,39,192,225,195,99,101,214,223,233,
+208,47,205,131,205,219,216,191,255,144,152,0,191,248,197,47,157,176,121,155,240,58,204,172,50,117,65,171,134,138,63,60,124,164,157,185,107,38,188,223,119,221,230,147,186,113,188,238,149,18,224,187,
+223,253,158,115,181,93,130,15,86,209,248,150,180,65,179,70,38,192,180,121,2,179,246,187,106,243,73,93,56,38,124,72,9,240,165,47,253,189,179,194,35,186,9,139,100,133,4,104,220,43,227,67,135,70,43,204,
+219,215,161,21,154,7,155,79,106,204,149,74,47,136,9,240,55,127,51,237,148,205,219,132,143,225,141,161,169,15,154,53,74,252,110,225,224,225,176,100,30,108,62,137,127,250,167,31,137,9,112,236,216,132,
+83,54,159,4,95,69,227,90,36,141,208,110,217,9,112,240,224,200,69,118,201,208,97,193,102,94,108,62,169,53,63,55,247,170,152,0,3,3,69,231,108,94,18,94,135,201,182,166,78,104,183,44,241,85,31,127,141,
+162,74,95,95,135,137,139,121,177,249,164,214,252,155,111,190,37,38,0,13,43,215,108,94,18,93,135,177,24,83,167,72,187,53,203,73,128,30,243,160,116,59,242,100,243,182,198,156,109,16,232,127,254,231,127,
+156,180,249,36,248,192,37,240,62,70,72,130,158,186,19,96,255,254,225,18,163,77,58,188,241,203,147,205,219,176,13,2,189,246,218,235,206,218,188,77,248,24,222,20,154,122,161,225,114,18,160,98,30,16,123,
+204,147,205,219,90,243,204,84,150,18,96,118,246,159,157,181,121,73,116,29,92,77,72,128,250,122,3,251,246,29,234,80,4,58,244,253,243,100,243,75,117,227,164,245,0,44,19,115,217,230,109,220,125,247,61,
+33,140,9,152,186,161,101,61,9,48,106,30,136,93,59,242,100,243,75,117,227,56,14,171,130,94,127,253,143,225,66,208,243,231,39,157,183,121,155,240,49,60,162,133,4,24,173,57,1,84,109,47,83,227,117,88,187,
+150,39,155,119,113,208,166,17,162,75,194,199,240,136,54,117,67,203,154,19,64,89,201,2,118,162,195,14,155,121,179,249,60,182,230,107,21,61,230,174,187,222,27,234,97,234,134,150,181,138,223,38,28,228,
+58,235,207,131,205,231,177,53,95,143,240,49,252,188,164,29,154,166,78,0,213,215,239,164,191,175,195,102,73,222,230,221,176,121,73,120,29,214,16,152,250,161,105,45,9,80,52,15,64,227,194,219,252,189,78,
+213,118,27,188,166,23,18,32,253,90,194,161,161,125,83,140,42,233,208,0,244,54,239,174,240,119,222,217,113,13,26,130,166,126,104,154,58,1,138,197,189,37,182,89,215,97,252,223,219,188,59,54,47,9,31,195,
+155,90,83,63,52,173,37,1,102,205,3,176,5,187,183,121,119,108,94,18,62,134,118,154,144,0,233,119,23,217,181,107,207,60,59,87,233,240,182,201,219,188,59,54,47,177,126,253,123,66,136,151,169,31,154,214,
+146,0,139,230,1,120,251,231,109,222,29,155,151,132,143,225,186,133,4,88,76,157,0,131,131,187,175,176,252,72,7,91,241,54,239,142,205,75,194,199,112,124,83,63,52,77,157,0,3,3,67,87,249,252,138,206,82,
+194,123,155,207,166,182,219,48,245,67,211,90,18,160,106,30,192,219,188,219,194,223,113,199,221,239,66,72,128,106,234,4,216,185,179,88,101,228,79,199,219,188,91,54,111,19,62,198,212,15,77,107,73,128,
+171,82,2,120,155,119,199,230,109,194,3,255,46,36,64,250,71,64,127,255,174,43,124,220,64,135,54,128,183,121,183,108,222,228,246,219,239,10,225,88,166,126,104,154,58,1,250,250,6,23,121,161,160,67,47,
+192,219,188,91,54,111,10,31,195,117,155,250,161,105,45,9,48,111,30,128,113,0,111,243,238,216,188,36,124,12,49,18,18,32,253,64,80,111,239,192,44,211,191,116,24,9,244,54,127,143,115,181,93,130,74,106,
+234,135,166,181,36,64,201,60,0,239,2,188,205,187,43,252,109,183,221,121,13,38,238,8,9,144,254,101,80,79,207,206,41,150,127,233,152,171,101,188,205,103,107,243,146,240,49,124,137,197,212,15,77,83,39,
+192,142,29,253,69,246,253,209,97,5,170,183,121,119,108,94,18,62,134,202,106,234,135,166,181,36,64,167,121,0,182,130,241,54,239,142,205,75,172,91,183,62,132,21,66,66,2,164,159,18,182,125,123,95,27,159,
+53,51,49,173,223,219,124,118,54,47,9,15,252,188,164,29,154,214,52,51,88,253,194,130,121,16,186,130,222,230,221,176,121,83,248,24,226,43,136,191,80,243,186,128,109,219,122,203,76,4,213,161,39,224,109,
+222,157,218,46,65,37,53,117,67,203,154,19,96,235,214,158,81,54,29,208,225,211,234,222,230,221,20,254,214,91,239,8,225,99,148,166,110,104,89,79,2,116,152,7,234,238,222,225,109,222,1,155,151,132,143,97,
+239,38,33,1,234,251,178,136,18,188,130,232,58,12,50,120,155,207,182,182,75,194,3,241,55,245,66,195,186,247,7,80,191,92,50,15,200,250,64,111,243,217,218,188,13,134,235,133,4,168,127,131,8,101,39,61,88,
+138,14,125,76,111,243,217,218,188,201,45,183,220,30,194,166,23,166,94,104,184,156,4,88,163,168,154,7,229,213,176,183,249,108,108,94,18,30,136,187,32,62,218,213,191,73,20,229,177,199,182,93,100,20,80,
+135,143,26,122,155,207,166,182,155,194,199,176,26,200,212,9,237,150,189,79,224,150,45,91,187,89,108,104,66,79,192,219,124,235,109,94,130,227,75,26,161,93,67,118,11,85,7,170,152,7,167,193,225,109,190,
+181,54,47,113,243,205,183,133,211,245,4,241,27,179,85,44,69,53,252,166,105,252,233,48,40,228,109,190,181,54,111,10,31,195,119,3,76,125,208,172,145,9,208,46,156,32,28,19,240,54,223,26,155,55,69,143,
+137,191,36,38,208,216,15,72,109,222,252,145,50,123,4,232,176,100,220,219,252,250,76,132,143,97,232,215,212,5,173,26,254,197,16,213,199,236,164,159,105,130,11,120,155,111,190,205,219,106,191,164,9,90,
+53,229,187,65,234,192,151,204,147,241,252,241,54,223,154,218,30,211,222,190,46,252,47,51,127,4,241,155,243,209,40,202,163,143,110,233,100,106,152,9,31,142,240,54,223,92,225,17,93,135,150,191,164,5,26,
+53,245,219,129,234,4,37,233,196,140,11,120,155,111,190,240,192,189,89,196,111,238,135,35,41,170,251,215,78,23,208,100,195,134,141,222,230,27,108,243,54,24,131,145,52,64,155,150,124,63,88,61,247,39,
+121,246,155,240,142,192,219,124,99,107,187,206,77,55,221,26,54,252,164,216,163,73,75,191,32,174,78,56,47,93,8,143,2,111,243,141,23,30,184,95,139,248,173,253,124,60,229,225,135,63,212,197,56,128,9,243,
+6,189,205,47,223,230,117,225,99,88,240,33,197,28,45,10,89,20,117,226,25,233,130,232,21,120,155,111,140,232,49,236,205,104,17,127,166,144,101,81,125,209,57,250,163,38,116,83,188,205,47,95,120,224,177,
+42,197,152,216,23,178,46,27,55,110,234,80,84,25,146,52,97,33,137,183,249,250,133,7,6,216,164,216,70,49,239,40,184,80,212,133,20,45,23,25,102,175,183,249,218,68,135,27,111,188,37,116,80,91,92,137,121,
+193,165,210,213,245,200,52,51,133,76,152,68,202,196,17,111,243,235,82,137,30,67,76,136,157,20,83,98,93,112,177,168,11,43,75,23,76,207,64,74,2,111,243,215,11,31,139,79,204,44,226,151,11,46,23,149,181,
+179,100,174,137,158,4,222,230,101,225,129,199,36,177,146,98,72,108,11,174,23,117,241,109,138,57,110,66,130,54,129,183,121,25,6,207,108,113,139,98,218,86,200,67,81,23,186,86,113,217,118,51,244,14,86,
+187,205,155,224,142,9,226,19,203,181,133,60,149,13,27,54,174,85,204,241,146,72,130,113,130,213,106,243,58,55,220,112,115,88,33,108,113,138,98,152,47,241,181,36,104,83,204,218,110,142,17,67,108,111,53,
+217,124,44,58,112,63,204,168,74,16,159,216,181,21,242,94,30,124,176,171,204,56,182,13,218,5,171,193,230,99,225,129,1,158,164,152,16,179,194,74,42,234,134,166,147,110,152,87,201,12,124,172,84,155,143,
+225,154,121,252,45,33,254,116,97,37,150,7,30,120,168,168,168,178,140,201,6,239,187,243,32,124,45,162,67,220,208,75,186,247,40,54,197,194,74,46,247,223,255,129,14,197,28,179,90,108,208,54,96,189,65,
+222,109,62,134,118,14,91,183,36,221,115,20,147,142,194,106,41,234,102,103,150,8,200,181,41,231,121,179,249,152,248,11,94,75,221,39,177,40,172,198,114,223,125,27,186,20,243,138,32,9,18,1,251,228,209,
+224,178,205,3,191,199,220,72,132,95,234,190,162,123,239,42,172,246,162,130,48,153,34,88,33,180,17,24,46,117,77,120,186,176,244,102,210,222,7,247,92,240,229,175,69,61,247,219,21,37,158,255,105,160,134,
+177,75,73,156,12,89,216,60,162,227,76,92,75,218,235,142,238,177,221,43,110,41,170,177,212,169,184,68,163,41,45,60,34,24,77,163,189,192,208,178,158,16,141,18,157,63,243,8,162,65,135,11,113,206,90,174,
+49,186,167,78,175,112,109,137,80,174,49,200,215,160,175,141,37,211,155,160,49,70,98,196,109,136,56,49,98,145,249,115,188,220,138,222,6,53,27,103,33,161,56,6,223,75,170,247,58,162,123,240,194,215,91,
+84,77,107,87,76,43,42,212,186,156,80,137,174,217,91,125,131,147,161,91,113,81,81,117,80,244,106,116,109,221,94,169,38,23,213,232,90,163,232,81,148,20,21,26,97,25,81,137,174,129,107,89,227,149,201,168,
+116,118,190,191,67,49,170,40,43,22,152,67,223,36,22,162,115,112,174,14,31,121,119,19,162,77,209,169,40,42,166,20,37,197,172,98,94,177,168,184,162,184,170,168,70,92,141,254,110,49,250,153,217,232,119,
+166,162,99,112,172,54,31,89,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,103,202,228,228,84,155,162,83,81,84,76,41,74,138,89,197,188,98,81,113,69,113,85,
+81,141,184,26,253,221,98,244,51,179,209,239,76,69,199,224,88,126,40,216,97,193,59,20,163,138,178,98,65,17,52,137,133,232,28,156,203,191,12,202,170,92,184,240,212,26,69,143,162,164,168,40,130,140,168,
+68,215,192,181,248,215,193,205,46,231,207,63,217,173,184,168,168,42,2,199,168,70,215,230,39,132,52,88,244,118,197,180,162,226,160,232,54,42,209,53,251,41,97,245,150,199,31,127,162,83,81,86,4,245,48,
+62,126,42,56,116,104,52,40,22,247,6,189,189,3,225,119,244,216,81,155,253,245,216,110,133,69,152,241,154,60,254,204,70,12,236,190,197,207,240,201,181,158,158,157,193,174,93,123,130,131,7,71,130,227,
+199,79,6,245,94,71,116,15,126,82,104,141,194,95,170,37,200,103,207,94,8,14,31,30,11,6,6,134,194,47,102,33,102,188,210,118,137,197,152,75,46,219,138,23,114,112,44,62,199,210,223,191,43,24,30,62,18,158,
+179,198,68,184,228,19,33,161,156,59,55,217,174,40,41,130,52,156,56,113,38,216,179,231,64,88,179,205,229,213,203,21,93,23,62,9,62,206,52,52,180,47,152,152,56,29,164,189,238,232,30,253,163,65,47,170,54,
+77,82,163,210,176,127,255,176,40,122,35,107,187,141,164,21,63,36,195,222,189,7,131,180,247,193,61,123,225,207,94,232,82,204,47,21,44,158,231,59,119,22,195,125,242,92,19,30,244,133,32,92,15,109,14,218,
+13,41,146,128,123,95,157,139,67,207,156,57,63,163,8,146,56,122,116,34,108,140,53,67,244,52,194,127,244,163,211,193,183,190,117,49,120,238,185,207,5,155,54,109,78,20,94,98,235,214,158,96,108,108,60,88,
+234,62,137,197,106,18,190,67,49,151,20,16,106,60,181,40,203,218,254,189,239,125,63,120,231,157,119,174,241,135,63,204,135,159,101,73,35,188,185,104,100,219,182,222,208,17,150,72,2,98,178,178,71,23,79,
+159,126,188,168,168,42,2,27,131,131,187,195,29,178,178,180,249,131,7,15,191,75,252,24,156,160,22,225,117,248,119,122,16,73,247,30,197,102,101,110,17,115,234,212,185,105,69,96,131,62,59,125,240,86,219,
+188,244,76,127,250,233,25,49,1,120,28,212,34,58,152,171,137,104,199,28,56,112,56,72,138,5,177,90,105,226,151,147,110,184,175,111,208,169,70,221,183,190,245,109,49,1,62,249,201,103,235,22,222,100,251,
+246,190,165,146,32,255,219,196,157,60,121,182,77,49,171,8,36,70,70,142,134,95,187,116,173,53,255,234,171,191,19,19,224,200,145,99,203,22,94,95,106,198,200,35,131,74,182,248,68,177,107,203,171,248,107,
+21,115,182,155,219,189,123,127,166,54,111,107,205,115,60,73,124,136,191,149,92,171,232,166,240,38,12,57,39,36,1,49,204,215,86,177,39,78,156,89,171,184,204,104,157,4,150,159,117,109,183,181,230,139,
+197,61,162,248,127,250,211,159,150,85,219,37,216,196,34,134,158,130,45,94,81,44,215,230,69,252,54,197,156,237,102,232,27,187,50,104,35,241,196,19,79,137,9,240,242,203,63,110,138,240,58,188,107,72,72,
+2,98,234,254,227,96,98,226,244,44,99,227,38,244,131,121,81,227,130,205,39,117,225,190,246,181,146,152,0,159,255,252,23,155,38,124,12,91,209,240,41,56,98,37,197,144,216,58,45,254,248,248,169,50,131,56,
+38,199,142,157,8,159,159,174,216,124,82,55,238,231,63,255,133,152,0,39,79,158,110,138,232,177,240,58,116,21,25,5,149,98,73,140,93,21,127,58,173,248,89,215,246,164,110,220,255,249,63,255,71,76,0,158,
+209,141,174,237,73,144,4,196,206,146,4,110,141,19,40,203,42,98,91,18,188,37,115,205,230,109,32,178,36,62,73,209,42,225,239,189,247,125,215,96,242,138,45,174,196,220,21,241,59,20,85,233,34,121,109,235,
+162,205,219,90,243,216,188,148,0,63,251,217,207,27,110,243,73,194,235,48,58,106,73,0,98,158,253,187,3,101,83,115,88,149,201,142,29,253,206,218,188,173,53,79,67,79,74,128,231,159,47,53,189,182,219,96,
+3,76,42,146,20,99,98,159,169,248,170,161,50,67,99,197,132,23,58,174,218,124,82,43,254,71,63,122,89,76,128,11,23,158,108,169,240,136,110,194,216,137,20,107,52,200,74,252,46,233,130,152,177,227,178,205,
+39,117,225,254,227,63,254,36,38,192,224,224,80,83,109,62,73,120,29,102,28,89,146,160,245,147,74,198,198,198,231,153,236,96,242,200,35,155,157,182,121,91,55,142,119,253,182,33,96,142,211,108,155,79,
+130,189,137,129,198,180,20,115,180,104,181,248,147,210,133,208,138,118,221,230,109,173,249,145,145,35,162,248,175,190,250,106,38,181,61,22,221,132,94,149,37,9,90,51,199,240,200,145,227,237,138,192,
+132,217,177,121,176,121,27,51,51,159,20,19,224,155,223,252,150,19,194,199,176,121,53,109,44,73,3,180,105,122,2,140,142,30,43,41,2,19,250,172,174,219,124,82,55,238,59,223,185,36,38,192,244,244,199,91,
+106,243,73,194,199,16,87,73,3,180,105,182,248,157,210,137,233,242,229,193,230,147,186,113,151,47,255,47,49,1,246,239,63,148,89,109,55,133,215,161,107,104,73,130,230,45,62,25,25,57,122,137,73,28,58,76,
+111,138,159,251,174,219,188,173,11,71,227,202,214,0,124,232,161,15,102,98,243,73,240,165,20,126,142,30,151,169,7,26,53,75,252,78,225,100,225,58,186,188,216,188,141,221,187,247,137,226,191,246,218,107,
+153,217,188,77,120,29,122,92,146,38,104,213,240,4,56,124,120,172,204,250,59,29,250,165,121,178,121,91,107,254,169,167,62,42,38,192,15,126,240,82,166,54,111,19,94,135,153,85,166,46,104,213,80,241,135,
+135,143,180,51,119,205,132,247,251,121,177,249,164,110,220,11,47,188,40,38,192,167,62,245,105,103,106,187,4,31,172,162,241,45,105,131,102,141,76,128,105,243,4,102,237,119,221,230,147,186,112,191,250,
+213,175,173,147,64,93,19,30,209,77,88,36,43,36,64,227,94,25,31,58,52,90,97,222,190,14,173,208,60,217,124,18,111,191,253,182,117,18,168,11,54,111,19,62,134,55,134,166,62,104,214,40,241,187,133,131,135,
+45,231,60,217,188,173,27,183,99,71,159,40,254,27,111,188,225,140,205,39,193,87,209,184,22,73,35,180,91,118,2,28,60,56,114,145,93,50,116,88,176,153,55,155,183,181,230,79,159,62,43,38,192,79,127,58,235,
+148,205,75,194,235,48,217,214,212,9,237,150,37,190,234,227,175,81,84,233,235,235,48,113,49,111,54,111,107,204,125,233,75,127,47,38,192,23,191,248,119,78,217,188,36,186,14,99,49,166,78,145,118,107,150,
+147,0,61,230,65,233,118,228,205,230,147,160,166,75,9,112,234,212,89,167,108,62,9,62,112,9,188,143,17,146,160,167,238,4,216,191,127,184,196,104,147,14,111,252,242,102,243,73,221,56,158,245,242,36,208,
+30,231,108,222,38,124,12,111,10,77,189,208,112,57,9,80,49,15,72,191,51,111,54,159,212,133,147,102,1,191,253,246,95,156,180,121,73,116,29,134,227,133,4,168,175,55,176,111,223,161,14,69,160,67,223,63,
+143,54,159,212,146,127,241,197,111,92,151,0,255,240,15,223,116,214,230,109,220,125,247,61,33,140,9,152,186,161,101,61,9,48,106,30,136,93,59,242,104,243,73,173,121,126,78,95,14,254,237,111,127,55,188,
+62,87,109,222,38,124,12,143,104,33,1,70,107,78,0,85,219,203,212,120,29,214,174,229,209,230,211,180,230,227,93,60,92,183,121,155,240,49,60,162,77,221,208,178,230,4,80,86,178,128,157,232,176,195,102,30,
+109,62,111,173,249,90,69,143,185,235,174,247,134,122,152,186,161,101,173,226,183,9,7,185,206,250,243,98,243,121,107,205,215,35,124,12,63,47,105,135,166,169,19,64,245,245,59,233,239,235,176,79,95,222,
+109,62,47,173,249,122,132,215,97,13,129,169,31,154,214,146,0,69,243,0,52,46,188,205,223,235,84,109,183,193,107,122,33,1,210,175,37,28,26,218,55,197,168,146,14,13,64,111,243,238,10,127,231,157,29,215,
+160,33,104,234,135,166,169,19,160,88,220,91,98,155,117,29,198,255,189,205,187,99,243,146,240,49,188,169,53,245,67,211,90,18,96,214,60,0,91,176,123,155,119,199,230,37,225,99,104,167,9,9,144,126,119,
+145,93,187,246,204,179,115,149,14,111,155,188,205,187,99,243,18,235,215,191,39,132,120,153,250,161,105,45,9,176,104,30,128,65,18,111,243,238,216,188,36,124,12,215,45,36,192,98,234,4,24,28,220,125,133,
+229,71,58,216,138,183,121,119,108,94,18,62,134,227,155,250,161,105,234,4,24,24,24,186,202,231,87,116,150,18,222,219,124,54,181,221,134,169,31,154,214,146,0,85,243,0,222,230,221,22,254,142,59,238,126,
+23,66,2,84,83,39,192,206,157,197,42,35,127,58,222,230,221,178,121,155,240,49,166,126,104,90,75,2,92,149,18,192,219,188,59,54,111,19,30,248,119,33,1,210,63,2,250,251,119,93,225,227,6,58,180,1,188,205,
+187,101,243,38,183,223,126,87,8,199,50,245,67,211,212,9,208,215,55,184,200,11,5,29,122,1,222,230,221,178,121,83,248,24,174,219,212,15,77,107,73,128,121,243,0,140,3,120,155,119,199,230,37,225,99,136,
+145,144,0,233,7,130,122,123,7,102,153,254,165,195,72,160,183,249,123,156,171,237,18,84,82,83,63,52,173,37,1,74,230,1,120,23,224,109,222,93,225,111,187,237,206,107,48,113,71,72,128,244,47,131,122,122,
+118,78,177,252,75,135,87,140,222,230,221,177,121,73,248,24,190,196,98,234,135,166,169,19,96,199,142,254,34,251,254,232,176,2,213,219,188,59,54,47,9,31,67,101,53,245,67,211,90,18,160,211,60,0,91,193,
+120,155,119,199,230,37,214,173,91,31,194,10,33,33,1,210,79,9,219,190,189,175,141,207,154,153,152,214,239,109,62,59,155,151,132,7,126,94,210,14,77,107,154,25,172,126,97,193,60,200,74,152,55,191,82,108,
+222,20,62,134,248,10,226,47,212,188,46,96,219,182,222,50,19,65,117,232,9,120,155,119,167,182,75,80,73,77,221,208,178,230,4,216,186,181,103,148,77,7,116,216,80,217,219,188,155,194,223,122,235,29,33,
+124,140,210,212,13,45,235,73,128,14,243,64,221,221,59,188,205,59,96,243,146,240,49,236,221,36,36,64,125,95,22,81,130,87,16,93,135,65,6,111,243,217,214,118,73,120,32,254,166,94,104,88,247,254,0,234,
+151,75,230,1,89,31,232,109,62,91,155,183,193,112,189,144,0,245,111,16,161,236,164,7,75,209,161,143,233,109,62,91,155,55,185,229,150,219,67,216,214,206,212,11,13,151,147,0,107,20,85,243,160,188,26,246,
+54,159,141,205,75,194,3,113,23,196,71,187,250,55,137,162,60,246,216,182,139,140,2,234,240,81,67,111,243,217,212,118,83,248,24,86,3,153,58,161,221,178,247,9,220,178,101,107,55,139,13,77,232,9,120,155,
+111,189,205,75,112,124,73,35,180,107,200,110,161,234,64,21,243,224,52,56,188,205,183,214,230,37,110,190,249,182,112,186,158,32,126,99,182,138,165,168,134,223,52,141,63,29,6,133,188,205,183,214,230,77,
+225,99,248,110,128,169,15,154,53,50,1,218,133,19,132,99,2,222,230,91,99,243,166,232,49,241,151,196,4,26,251,1,169,205,155,63,82,102,143,0,29,150,140,123,155,95,159,137,240,49,12,253,154,186,160,85,
+195,191,24,162,250,152,157,244,51,77,112,1,111,243,205,183,121,91,237,151,52,65,171,166,124,55,72,29,248,146,121,50,158,63,222,230,91,83,219,99,218,219,215,133,255,101,230,143,32,126,115,62,26,69,121,
+244,209,45,157,76,13,51,225,195,17,222,230,155,43,60,162,235,208,242,151,180,64,163,166,126,59,80,157,160,36,157,152,113,1,111,243,205,23,30,184,55,139,248,205,253,112,36,69,117,255,218,233,2,154,108,
+216,176,209,219,124,131,109,222,6,99,48,146,6,104,211,146,239,7,171,231,254,36,207,126,19,222,17,120,155,111,108,109,215,185,233,166,91,195,134,159,20,123,52,105,233,23,196,213,9,231,165,11,225,81,
+224,109,190,241,194,3,247,107,17,191,181,159,143,167,60,252,240,135,186,24,7,48,97,222,160,183,249,229,219,188,46,124,12,11,62,164,152,163,69,33,139,162,78,60,35,93,16,189,2,111,243,141,17,61,134,189,
+25,45,226,207,20,178,44,170,47,58,71,127,212,132,110,138,183,249,229,11,15,60,86,165,24,19,251,66,214,101,227,198,77,29,138,42,67,146,38,44,36,241,54,95,191,240,192,0,155,20,219,40,230,29,5,23,138,
+186,144,162,229,34,195,236,245,54,95,155,232,112,227,141,183,132,14,106,139,43,49,47,184,84,186,186,30,153,102,166,144,9,147,72,153,56,226,109,126,93,42,209,99,136,9,177,147,98,74,172,11,46,22,117,97,
+101,233,130,233,25,72,73,224,109,254,122,225,99,241,137,153,69,252,114,193,229,162,178,118,150,204,53,209,147,192,219,188,44,60,240,152,36,86,82,12,137,109,193,245,162,46,190,77,49,199,77,72,208,38,
+240,54,47,195,224,153,45,110,81,76,219,10,121,40,234,66,215,42,46,219,110,134,222,193,106,183,121,19,220,49,65,124,98,185,182,144,167,178,97,195,198,181,138,57,94,18,73,48,78,176,90,109,94,231,134,27,
+110,14,43,132,45,78,81,12,243,37,190,150,4,109,138,89,219,205,49,98,136,237,173,38,155,143,69,7,238,135,25,85,9,226,19,187,182,66,222,203,131,15,118,149,25,199,182,65,187,96,53,216,124,44,60,48,192,
+147,20,19,98,86,88,73,69,221,208,116,210,13,243,42,153,129,143,149,106,243,49,92,51,143,191,37,196,159,46,172,196,242,192,3,15,21,21,85,150,49,217,224,125,119,30,132,175,69,116,136,27,122,73,247,30,
+197,166,88,88,201,229,254,251,63,208,161,152,99,86,139,13,218,6,172,55,200,187,205,199,208,206,97,235,150,164,123,142,98,210,81,88,45,69,221,236,204,18,1,185,54,229,60,111,54,31,19,127,193,107,169,
+251,36,22,133,213,88,238,187,111,67,151,98,94,17,36,65,34,96,159,60,26,92,182,121,224,247,152,27,137,240,75,221,87,116,239,93,133,213,94,84,16,38,83,4,43,132,54,2,195,165,174,9,79,23,150,222,76,218,
+251,224,158,11,190,252,181,168,231,126,187,162,196,243,63,13,212,48,118,41,137,147,33,11,155,71,116,156,137,107,73,123,221,209,61,182,123,197,45,69,53,150,58,21,151,104,52,165,133,71,4,163,105,180,23,
+24,90,214,19,162,81,162,243,103,30,65,52,232,112,33,206,89,203,53,70,247,212,233,21,174,45,17,202,53,6,249,26,244,181,177,100,122,19,52,198,72,140,184,13,17,39,70,44,50,127,142,151,91,209,219,160,102,
+227,44,36,20,199,224,123,73,245,94,71,116,15,94,248,122,139,170,105,237,138,105,69,133,90,151,19,42,209,53,123,171,111,112,50,116,43,46,42,170,14,138,94,141,174,173,219,43,213,228,162,26,93,107,20,61,
+138,146,162,66,35,44,35,42,209,53,112,45,107,188,50,25,149,206,206,247,119,40,70,21,101,197,2,115,232,155,196,66,116,14,206,213,225,35,239,110,66,180,41,58,21,69,197,148,162,164,152,85,204,43,22,21,
+87,20,87,21,213,136,171,209,223,45,70,63,51,27,253,206,84,116,12,142,213,230,35,235,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,76,153,156,156,106,
+83,116,42,138,138,41,69,73,49,171,152,87,44,42,174,40,174,42,170,17,87,163,191,91,140,126,102,54,250,157,169,232,24,28,203,15,5,59,44,120,135,98,84,81,86,44,40,130,38,177,16,157,131,115,249,151,65,89,
+149,11,23,158,90,163,232,81,148,20,21,69,144,17,149,232,26,184,22,255,58,184,217,229,252,249,39,187,21,23,21,85,69,224,24,213,232,218,252,132,144,6,139,222,174,152,86,84,28,20,221,70,37,186,102,63,37,
+172,222,242,248,227,79,116,42,202,138,160,30,198,199,79,5,135,14,141,6,197,226,222,160,183,119,32,252,142,30,59,106,179,191,30,219,173,176,8,51,94,147,199,159,217,136,129,221,183,248,25,62,185,214,
+211,179,51,216,181,107,79,112,240,224,72,112,252,248,201,160,222,235,136,238,193,79,10,173,81,248,75,181,4,249,236,217,11,193,225,195,99,193,192,192,80,248,197,44,196,140,87,218,46,177,24,115,201,101,
+91,241,66,14,142,197,231,88,250,251,119,5,195,195,71,194,115,214,152,8,151,124,34,36,148,115,231,38,219,21,37,69,144,134,19,39,206,4,123,246,28,8,107,182,185,188,122,185,162,235,194,39,193,199,153,
+134,134,246,5,19,19,167,131,180,215,29,221,163,127,52,232,69,213,166,73,106,84,26,246,239,31,22,69,111,100,109,183,145,180,226,135,100,216,187,247,96,144,246,62,184,103,47,252,217,11,93,138,249,165,
+130,197,243,124,231,206,98,184,79,158,107,194,131,190,16,132,235,161,205,65,187,33,69,18,112,239,171,115,113,232,153,51,231,103,20,65,18,71,143,78,132,141,177,102,136,222,104,225,37,182,110,237,9,198,
+198,198,131,165,238,147,88,172,38,225,59,20,115,73,1,161,198,83,139,92,170,237,207,60,243,137,224,149,87,230,130,87,95,125,53,248,228,39,159,93,114,173,162,206,182,109,189,161,35,44,145,4,196,100,101,
+143,46,158,62,253,120,81,81,85,4,54,6,7,119,135,59,100,185,100,243,159,249,204,103,131,119,222,121,231,93,124,225,11,95,90,82,120,29,254,157,30,68,210,189,71,177,89,153,91,196,156,58,117,110,90,17,
+216,160,207,78,31,220,69,155,255,211,159,254,243,186,4,248,175,255,250,175,37,69,7,115,53,17,237,152,3,7,14,7,73,177,32,86,43,77,252,114,210,13,247,245,13,58,213,168,211,159,239,131,131,67,215,137,15,
+149,74,165,38,225,77,182,111,239,91,42,9,242,191,77,220,201,147,103,219,20,179,138,64,98,100,228,104,248,181,75,23,91,243,49,79,63,61,35,38,192,191,254,235,207,234,18,94,95,106,198,200,35,131,74,182,
+248,68,177,107,203,171,248,107,21,115,182,155,219,189,123,127,46,90,243,47,191,252,99,49,1,62,253,233,231,82,139,110,10,111,194,144,115,66,18,16,195,124,109,21,123,226,196,153,181,138,203,140,214,73,
+96,249,46,217,124,82,107,254,191,255,251,191,197,4,216,187,247,192,178,68,7,54,177,136,161,167,96,139,87,20,203,181,121,17,191,77,49,103,187,25,250,198,174,217,188,173,53,127,232,208,136,40,254,127,
+253,215,255,215,48,225,117,120,215,144,144,4,196,212,253,199,193,196,196,233,89,198,198,77,232,7,243,162,198,213,65,27,233,121,254,249,207,127,81,76,128,31,252,224,135,13,21,62,134,173,104,248,20,28,
+177,146,98,72,108,157,22,127,124,252,84,153,65,28,147,99,199,78,132,141,61,87,109,222,198,47,127,249,43,49,1,62,250,209,233,134,137,30,11,175,67,87,145,81,80,41,150,196,216,85,241,167,211,138,239,146,
+205,219,160,133,46,137,15,59,118,244,55,164,182,39,65,18,16,59,75,18,184,53,78,160,44,171,136,109,73,240,150,204,101,155,183,117,225,38,38,78,137,226,191,246,218,235,77,21,254,222,123,223,119,13,38,
+175,216,226,74,204,93,17,191,67,81,149,46,146,215,182,174,219,188,173,27,87,42,189,32,38,192,55,190,81,110,136,205,39,9,175,195,232,168,37,1,136,121,246,239,14,148,77,205,97,85,38,216,164,235,54,159,
+212,146,255,95,255,235,223,197,4,56,125,250,108,83,106,187,13,54,192,164,34,73,49,38,246,153,138,175,26,42,51,52,86,76,120,161,147,7,155,183,65,192,109,207,127,62,215,222,108,225,17,221,132,177,19,41,
+214,104,144,149,248,93,210,5,49,99,39,47,54,111,235,194,61,241,196,83,162,248,191,253,237,43,45,23,94,135,25,71,150,36,104,253,164,146,177,177,241,121,38,59,152,80,67,242,98,243,182,110,220,119,191,
+123,73,76,128,47,126,241,239,154,102,243,73,176,55,49,208,152,150,98,142,22,173,22,127,82,186,16,134,51,243,98,243,73,45,249,133,133,55,196,4,56,124,248,72,203,106,123,44,186,9,189,42,75,18,180,102,
+142,225,145,35,199,219,21,129,9,179,99,243,100,243,182,46,92,210,235,95,174,33,43,225,99,216,188,154,54,150,164,1,218,52,61,1,70,71,143,149,20,129,9,125,214,60,217,188,173,27,199,212,47,41,1,126,242,
+147,217,150,216,124,146,240,49,196,85,210,0,109,154,45,126,167,116,98,186,124,121,179,121,91,55,238,39,63,249,169,152,0,51,51,159,108,121,109,55,133,215,161,167,98,73,130,230,45,62,25,25,57,122,137,
+73,28,58,76,111,138,159,251,121,177,121,27,28,255,127,254,231,127,196,4,224,209,208,74,155,79,130,47,165,240,115,244,184,76,61,208,168,89,226,119,10,39,11,215,209,229,205,230,109,93,56,219,235,223,55,
+222,120,163,229,54,111,19,94,135,30,151,164,9,90,53,60,1,14,31,30,43,179,254,78,135,126,105,30,109,222,214,141,99,166,175,148,0,116,11,179,176,121,155,240,58,204,172,50,117,65,171,134,138,63,60,124,
+164,157,185,107,38,188,223,207,155,205,39,117,227,126,243,155,223,138,9,48,57,249,100,230,181,93,130,15,86,209,248,150,180,65,179,70,38,192,180,121,2,179,246,231,197,230,109,124,240,131,246,215,191,
+143,61,182,213,25,225,17,221,132,69,178,66,2,52,238,149,241,161,67,163,21,230,237,235,208,10,205,163,205,219,186,113,39,78,200,175,127,255,253,223,255,61,115,155,183,9,31,195,27,67,83,31,52,107,148,
+248,221,194,193,195,97,201,60,218,188,173,27,247,194,11,47,138,9,240,181,175,125,61,115,155,79,130,175,162,113,45,146,70,104,183,236,4,56,120,112,228,34,187,100,232,176,96,51,143,54,159,212,133,155,
+159,127,77,76,128,227,199,39,156,176,121,73,120,29,38,219,154,58,161,221,178,196,87,125,252,53,138,42,125,125,29,38,46,230,209,230,109,116,119,219,95,255,178,78,209,5,155,151,68,215,97,44,198,212,41,
+210,110,205,114,18,160,199,60,40,221,142,188,218,188,173,27,247,228,147,83,162,248,76,10,117,197,230,147,224,3,151,192,251,24,33,9,122,234,78,128,253,251,135,75,140,54,233,240,198,47,175,54,111,235,
+198,125,239,123,223,23,19,224,185,231,62,231,148,205,219,132,143,225,77,161,169,23,26,46,39,1,42,230,1,233,119,230,209,230,147,186,112,182,254,255,190,125,7,157,178,121,73,116,29,134,227,133,4,168,
+175,55,176,111,223,161,14,69,160,67,223,63,175,54,159,196,151,191,252,21,113,248,215,69,155,183,113,247,221,247,132,48,38,96,234,134,150,245,36,192,168,121,32,118,237,200,171,205,39,117,227,24,207,96,
+181,111,44,62,47,132,198,199,79,58,105,243,54,225,99,120,68,11,9,48,90,115,2,168,218,94,166,198,235,176,118,45,175,54,159,166,11,183,127,255,161,224,216,177,137,112,159,65,87,109,222,38,124,12,143,
+104,83,55,180,172,57,1,148,149,44,96,39,58,236,176,153,87,155,207,83,107,190,86,209,99,238,186,235,189,161,30,166,110,104,89,171,248,109,194,65,174,179,254,60,217,124,158,90,243,245,8,31,195,207,75,
+218,161,105,234,4,80,125,253,78,250,251,58,236,211,183,18,108,62,15,173,249,122,132,215,97,13,129,169,31,154,214,146,0,69,243,0,52,46,188,205,223,235,84,109,183,193,107,122,33,1,210,175,37,28,26,218,
+55,197,168,146,14,13,64,111,243,238,10,127,231,157,29,215,160,33,104,234,135,166,169,19,160,88,220,91,98,155,117,29,198,255,189,205,187,99,243,146,240,49,188,169,53,245,67,211,90,18,96,214,60,0,93,35,
+111,243,238,216,188,36,124,12,237,52,33,1,210,239,46,178,107,215,158,121,118,174,210,225,109,147,183,121,119,108,94,98,253,250,247,132,16,47,83,63,52,173,37,1,22,205,3,240,246,207,219,188,59,54,47,9,
+31,195,117,11,9,176,152,58,1,6,7,119,95,97,249,145,14,182,226,109,222,29,155,151,132,143,225,248,166,126,104,154,58,1,6,6,134,174,242,249,21,157,165,132,247,54,159,77,109,183,97,234,135,166,181,36,64,
+213,60,128,183,121,183,133,191,227,142,187,223,133,144,0,213,212,9,176,115,103,177,202,200,159,142,183,121,183,108,222,38,124,140,169,31,154,214,146,0,87,165,4,240,54,239,142,205,219,132,7,254,93,72,
+128,244,143,128,254,254,93,87,248,184,129,14,109,0,111,243,110,217,188,201,237,183,223,21,194,177,76,253,208,52,117,2,244,245,13,46,242,66,65,135,94,128,183,121,183,108,222,20,62,134,235,54,245,67,
+211,90,18,96,222,60,0,227,0,222,230,221,177,121,73,248,24,98,36,36,64,250,129,160,222,222,129,89,166,127,233,48,18,232,109,254,30,231,106,187,4,149,212,212,15,77,107,73,128,146,121,0,222,5,120,155,
+119,87,248,219,110,187,243,26,76,220,17,18,32,253,203,160,158,158,157,83,44,255,210,225,21,163,183,121,119,108,94,18,62,134,47,177,152,250,161,105,234,4,216,177,163,191,200,190,63,58,172,64,245,54,
+239,142,205,75,194,199,80,89,77,253,208,180,150,4,232,52,15,192,86,48,222,230,221,177,121,137,117,235,214,135,176,66,72,72,128,244,83,194,182,111,239,107,227,179,102,38,166,245,123,155,207,206,230,37,
+225,129,159,151,180,67,211,154,102,6,171,95,88,48,15,66,87,208,219,188,27,54,111,10,31,67,124,5,241,23,106,94,23,176,109,91,111,153,137,160,58,73,11,38,188,205,183,190,182,75,80,73,77,221,208,178,230,
+4,216,186,181,103,148,77,7,116,54,109,250,176,183,121,71,133,191,245,214,59,66,248,212,141,169,27,90,214,147,0,29,230,129,186,187,119,120,155,119,192,230,37,225,99,216,187,73,72,128,250,190,44,162,4,
+175,32,186,14,131,12,222,230,179,173,237,146,240,64,252,77,189,208,176,238,253,1,212,47,151,204,3,178,62,208,219,124,182,54,111,131,225,122,33,1,234,223,32,66,217,73,15,150,162,67,31,211,219,124,182,
+54,111,114,203,45,183,135,240,121,62,83,47,52,92,78,2,172,81,84,205,131,242,106,216,219,124,54,54,47,9,15,196,93,16,31,237,234,223,36,138,242,216,99,219,46,50,10,168,195,71,13,189,205,103,83,219,77,
+225,99,88,13,100,234,132,118,203,222,39,112,203,150,173,221,44,54,52,161,39,224,109,190,245,54,47,193,241,37,141,208,174,33,187,133,170,3,85,204,131,211,224,240,54,223,90,155,151,184,249,230,219,194,
+233,122,130,248,141,217,42,150,162,26,126,211,52,254,116,24,20,242,54,223,90,155,55,133,143,225,187,1,166,62,104,214,200,4,104,23,78,16,142,9,120,155,111,141,205,155,162,199,196,95,18,19,104,236,7,
+164,54,111,254,72,153,61,2,116,88,50,238,109,126,125,38,194,199,48,244,107,234,130,86,13,255,98,136,234,99,118,210,207,52,193,5,188,205,55,223,230,109,181,95,210,4,173,154,242,221,32,117,224,75,230,
+201,120,254,120,155,111,77,109,143,105,111,95,23,254,151,153,63,130,248,205,249,104,20,229,209,71,183,116,50,53,204,132,141,22,189,205,55,87,120,68,215,161,229,47,105,129,70,77,253,118,160,58,65,73,
+58,49,227,2,222,230,155,47,60,112,111,22,241,155,251,225,72,138,234,254,181,211,5,52,97,95,125,111,243,141,181,121,27,140,193,72,26,160,77,75,190,31,172,158,251,147,60,251,77,120,71,224,109,190,177,
+181,93,231,166,155,110,13,27,126,82,236,209,164,165,95,16,87,39,156,151,46,132,71,129,183,249,198,11,15,220,175,69,252,214,126,62,158,242,240,195,31,234,98,28,192,132,121,131,222,230,151,111,243,186,
+240,49,44,248,144,98,142,22,133,44,138,58,241,140,116,65,244,10,188,205,55,70,244,24,246,102,180,136,63,83,200,178,168,190,232,28,253,81,19,186,41,222,230,151,47,60,240,88,149,98,76,236,11,89,151,141,
+27,55,117,40,170,12,73,154,176,144,196,219,124,253,194,3,3,108,82,108,163,152,119,20,92,40,234,66,138,150,139,12,179,215,219,124,109,162,195,141,55,222,18,58,168,45,174,196,188,224,82,233,234,122,100,
+154,153,66,38,76,34,101,226,136,183,249,117,169,68,143,33,38,196,78,138,41,177,46,184,88,212,133,149,165,11,166,103,32,37,129,183,249,235,133,143,197,39,102,22,241,203,5,151,139,202,218,89,50,215,68,
+79,2,111,243,178,240,192,99,146,88,73,49,36,182,5,215,139,186,248,54,197,28,55,33,65,155,192,219,188,12,131,103,182,184,69,49,109,43,228,161,168,11,93,171,184,108,187,25,122,7,171,221,230,77,112,199,
+4,241,137,229,218,66,158,202,134,13,27,215,42,230,120,73,36,193,56,193,106,181,121,157,27,110,184,57,172,16,182,56,69,49,204,151,248,90,18,180,41,102,109,55,199,136,33,182,183,154,108,62,22,29,184,31,
+102,84,37,136,79,236,218,10,121,47,15,62,216,85,102,28,219,6,237,130,213,96,243,177,240,192,0,79,82,76,136,89,97,37,21,117,67,211,73,55,204,171,100,6,62,86,170,205,199,112,205,60,254,150,16,127,186,
+176,18,203,3,15,60,84,84,84,89,198,100,131,247,221,121,16,190,22,209,33,110,232,37,221,123,20,155,98,97,37,151,251,239,255,64,135,98,142,89,45,54,104,27,176,222,32,239,54,31,67,59,135,173,91,146,238,
+57,138,73,71,97,181,20,117,179,51,75,4,228,218,148,243,188,217,124,76,252,5,175,165,238,147,88,20,86,99,185,239,190,13,93,138,121,69,144,4,137,128,125,242,104,112,217,230,129,223,99,110,36,194,47,117,
+95,209,189,119,21,86,123,81,65,152,76,17,172,16,218,8,12,151,186,38,60,93,88,122,51,105,239,131,123,46,248,242,215,162,158,251,237,138,18,207,255,52,80,195,216,165,36,78,134,44,108,30,209,113,38,174,
+37,237,117,71,247,216,238,21,183,20,213,88,234,84,92,162,209,148,22,30,17,140,166,209,94,96,104,89,79,136,70,137,206,159,121,4,209,160,195,133,56,103,45,215,24,221,83,167,87,184,182,68,40,215,24,228,
+107,208,215,198,146,233,77,208,24,35,49,226,54,68,156,24,177,200,252,57,94,110,69,111,131,154,141,179,144,80,28,131,239,37,213,123,29,209,61,120,225,235,45,170,166,181,43,166,21,21,106,93,78,168,68,
+215,236,173,190,193,201,208,173,184,168,168,58,40,122,53,186,182,110,175,84,147,139,106,116,173,81,244,40,74,138,10,141,176,140,168,68,215,192,181,172,241,202,100,84,58,59,223,223,161,24,85,148,21,11,
+204,161,111,18,11,209,57,56,87,135,143,188,187,9,209,166,232,84,20,21,83,138,146,98,86,49,175,88,84,92,81,92,85,84,35,174,70,127,183,24,253,204,108,244,59,83,209,49,56,86,155,143,172,47,190,248,226,
+139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,51,101,114,114,170,77,209,169,40,42,166,20,37,197,172,98,94,177,168,184,162,184,170,168,70,92,141,254,110,49,250,153,
+217,232,119,166,162,99,112,44,63,20,236,176,224,29,138,81,69,89,177,160,8,154,196,66,116,14,206,229,95,6,101,85,46,92,120,106,141,162,71,81,82,84,20,65,70,84,162,107,224,90,252,235,224,102,151,243,
+231,159,236,86,92,84,84,21,129,99,84,163,107,243,19,66,26,44,122,187,98,90,81,113,80,116,27,149,232,154,253,148,176,122,203,227,143,63,209,169,40,43,130,122,24,31,63,21,28,58,52,26,20,139,123,131,222,
+222,129,240,59,122,236,168,205,254,122,108,183,194,34,204,120,77,30,127,102,35,6,118,223,226,103,248,228,90,79,207,206,96,215,174,61,193,193,131,35,193,241,227,39,131,122,175,35,186,7,63,41,180,70,
+225,47,213,18,228,179,103,47,4,135,15,143,5,3,3,67,225,23,179,16,51,94,105,187,196,98,204,37,151,109,197,11,57,56,22,159,99,233,239,223,21,12,15,31,9,207,89,99,34,92,242,137,144,80,206,157,155,108,87,
+148,20,65,26,78,156,56,19,236,217,115,32,172,217,230,242,234,229,138,174,11,159,4,31,103,26,26,218,23,76,76,156,14,210,94,119,116,143,254,209,160,23,85,155,38,169,81,105,216,191,127,88,20,189,145,181,
+221,70,210,138,31,146,97,239,222,131,65,218,251,224,158,189,240,103,47,116,41,230,151,10,22,207,243,157,59,139,225,62,121,174,9,15,250,66,16,174,135,54,7,237,134,20,73,192,189,175,206,197,161,103,206,
+156,159,81,4,73,28,61,58,17,54,198,154,33,122,163,133,151,216,186,181,39,24,27,27,15,150,186,79,98,177,154,132,239,80,204,37,5,132,26,79,45,114,177,182,167,17,222,92,52,178,109,91,111,232,8,75,36,1,
+49,89,217,163,139,167,79,63,94,84,84,21,129,141,193,193,221,225,14,89,46,219,252,240,240,72,240,163,31,189,28,252,219,191,253,62,248,250,215,95,12,187,150,146,240,58,252,59,61,136,164,123,143,98,179,
+50,183,136,57,117,234,220,180,34,176,65,159,157,62,184,235,54,207,184,194,59,239,188,243,46,126,241,139,95,90,133,55,87,19,209,142,57,112,224,112,144,20,11,98,181,210,196,47,39,221,112,95,223,96,110,
+108,254,197,23,191,113,93,2,192,240,240,104,162,240,38,219,183,247,45,149,4,249,223,38,238,228,201,179,109,138,89,69,32,49,50,114,52,252,218,165,139,54,111,227,173,183,222,18,19,96,124,252,100,42,225,
+245,165,102,140,60,50,168,100,139,79,20,187,182,188,138,191,86,49,103,187,185,221,187,247,231,166,53,31,215,234,227,199,79,136,226,195,7,63,184,41,181,240,38,12,57,39,36,1,49,204,215,86,177,39,78,156,
+89,171,184,204,104,157,4,150,159,199,214,252,119,190,243,93,81,252,151,94,250,199,154,69,7,54,177,136,161,167,96,139,87,20,203,181,121,17,191,77,49,103,187,25,250,198,174,219,188,212,152,227,218,254,
+242,151,191,136,9,112,230,204,185,186,133,215,225,93,67,66,18,16,83,247,31,7,19,19,167,103,25,27,55,161,31,204,139,26,215,109,222,198,217,179,231,69,241,223,126,251,237,240,252,203,17,62,134,173,104,
+248,20,28,177,146,98,72,108,157,22,127,124,252,84,153,65,28,147,99,199,78,132,141,189,60,216,188,173,27,247,195,31,254,147,152,0,23,47,126,123,89,162,199,194,235,208,85,100,20,84,138,37,49,118,85,252,
+233,180,226,187,106,243,182,110,220,195,15,63,106,109,252,29,61,58,94,119,109,79,130,36,32,118,150,36,112,107,156,64,89,86,17,219,146,224,45,89,94,108,222,214,130,127,234,169,143,138,226,191,241,198,
+155,13,23,254,222,123,223,119,13,70,24,109,113,37,230,174,136,223,161,168,74,23,201,107,219,60,217,188,141,217,217,127,22,19,224,235,95,127,161,110,155,79,18,94,135,209,81,75,2,16,243,236,223,29,40,
+155,154,195,170,76,118,236,232,207,149,205,219,186,113,91,182,116,91,237,255,192,129,225,166,136,174,195,6,152,84,36,41,198,196,62,83,241,85,67,101,134,198,138,9,47,116,242,102,243,182,110,220,211,79,
+207,136,226,191,254,250,31,155,38,60,162,155,48,118,34,197,26,13,178,18,191,75,186,32,102,236,228,209,230,109,173,248,95,255,250,215,98,2,124,233,75,127,223,18,225,117,152,113,100,73,130,214,79,42,25,
+27,27,159,103,178,131,201,35,143,108,206,157,205,219,232,233,233,183,218,255,174,93,187,27,106,243,73,176,55,49,208,152,150,98,142,22,173,22,127,82,186,16,134,51,243,104,243,182,110,220,167,63,253,
+156,40,254,191,253,219,191,53,189,182,199,162,155,208,171,178,36,65,107,230,24,30,57,114,188,93,17,152,48,59,54,175,54,111,235,194,253,254,247,191,23,19,224,217,103,63,211,114,225,99,216,188,154,54,
+150,164,1,218,52,61,1,70,71,143,149,20,129,9,125,214,60,218,188,173,27,87,44,238,177,218,255,246,237,189,77,179,249,36,225,99,136,171,164,1,218,52,91,252,78,233,196,116,249,242,106,243,54,254,238,239,
+190,44,138,255,203,95,254,170,101,181,221,20,94,135,174,161,37,9,154,183,248,100,100,228,232,37,38,113,232,48,189,41,126,238,231,209,230,109,221,184,63,254,241,143,98,2,124,236,99,79,183,180,182,75,
+240,165,20,126,142,30,151,169,7,26,53,75,252,78,225,100,225,58,186,188,218,188,173,11,199,0,143,205,254,25,153,203,82,120,29,122,92,146,38,104,213,240,4,56,124,120,172,204,250,59,29,250,165,121,182,
+121,91,55,142,33,94,73,252,159,254,116,182,165,54,111,19,94,135,153,85,166,46,104,213,80,241,135,135,143,180,51,119,205,132,247,251,121,182,121,27,111,190,249,166,152,0,147,147,79,102,86,219,37,248,
+96,21,141,111,73,27,52,107,100,2,76,155,39,48,107,127,222,108,222,214,133,27,27,59,110,181,127,86,29,103,45,60,162,155,176,72,86,72,128,198,189,50,62,116,104,180,194,188,125,29,90,161,121,182,121,91,
+55,142,9,30,146,248,63,248,193,75,153,217,188,77,248,24,218,37,166,62,104,214,40,241,187,133,131,135,195,146,121,182,121,169,27,199,117,49,197,75,74,128,147,39,79,103,102,243,73,240,85,52,174,69,210,
+8,237,150,157,0,7,15,142,92,100,151,12,29,22,108,230,217,230,109,156,58,117,214,58,239,143,107,203,210,230,37,225,117,152,108,107,234,132,118,203,18,95,245,241,215,40,170,244,245,117,152,184,152,103,
+155,183,117,225,94,122,233,135,98,2,124,235,91,23,51,183,121,73,116,29,198,98,76,157,34,237,214,44,39,1,122,204,131,210,237,200,179,205,219,186,113,31,248,192,70,107,227,111,116,244,104,230,54,159,4,
+31,184,4,222,199,8,73,208,83,119,2,236,223,63,92,98,180,73,135,55,126,121,182,121,91,55,142,46,158,109,222,159,43,54,111,19,62,134,55,133,166,94,104,184,156,4,168,152,7,164,223,153,103,155,183,241,
+205,111,94,20,19,224,107,95,43,57,99,243,146,232,58,12,199,11,9,80,95,111,96,223,190,67,29,138,64,135,190,127,158,109,62,169,27,247,249,207,127,81,76,128,189,123,15,56,101,243,54,238,190,251,158,16,
+198,4,76,221,208,178,158,4,24,53,15,196,174,29,121,182,249,164,110,220,135,62,180,69,217,253,27,239,18,255,135,63,252,71,231,108,222,38,124,12,143,104,33,1,70,107,78,0,85,219,203,212,120,29,214,174,
+229,217,230,151,234,194,49,3,248,43,95,121,62,20,254,153,103,62,225,164,205,219,132,143,225,17,109,234,134,150,53,39,128,178,146,5,236,68,135,29,54,243,108,243,46,12,218,52,178,182,155,220,117,215,
+123,67,61,76,221,208,178,86,241,219,132,131,92,103,253,121,179,249,188,180,230,235,17,62,134,159,151,180,67,211,212,9,160,250,250,157,244,247,117,216,167,111,37,216,124,30,90,243,245,8,175,195,26,2,
+83,63,52,173,37,1,138,230,1,104,92,120,155,191,215,169,218,110,131,215,244,66,2,164,95,75,56,52,180,111,138,81,37,29,26,128,222,230,221,21,254,206,59,59,174,65,67,208,212,15,77,83,39,64,177,184,183,
+196,118,104,58,140,255,123,155,119,199,230,37,225,99,120,83,107,234,135,166,181,36,192,172,121,0,38,67,120,155,119,199,230,37,225,99,104,167,9,9,144,126,119,145,93,187,246,204,179,115,149,14,111,155,
+188,205,187,99,243,18,235,215,191,39,132,120,153,250,161,105,45,9,176,104,30,128,183,127,222,230,221,177,121,73,248,24,174,91,72,128,197,212,9,48,56,184,251,10,203,143,116,176,21,111,243,238,216,188,
+36,124,12,199,55,245,67,211,212,9,48,48,48,116,149,207,175,232,44,37,188,183,249,108,106,187,13,83,63,52,173,37,1,170,230,1,188,205,187,45,252,29,119,220,253,46,132,4,168,166,78,128,157,59,139,85,70,
+254,116,188,205,187,101,243,54,225,99,76,253,208,180,150,4,184,42,37,128,183,121,119,108,222,38,60,240,239,66,2,164,127,4,244,247,239,186,194,199,13,116,104,3,120,155,119,203,230,77,110,191,253,174,
+16,142,101,234,135,166,169,19,160,175,111,112,145,23,10,58,244,2,188,205,187,101,243,166,240,49,92,183,169,31,154,214,146,0,243,230,1,24,7,240,54,239,142,205,75,194,199,16,35,33,1,210,15,4,245,246,14,
+204,50,253,75,135,145,64,111,243,247,56,87,219,37,168,164,166,126,104,90,75,2,148,204,3,216,22,70,122,155,119,67,248,219,110,187,243,26,76,220,17,18,32,253,203,160,158,158,157,83,44,255,210,225,21,
+163,183,121,119,108,94,18,62,134,47,177,152,250,161,105,234,4,216,177,163,191,200,190,63,58,172,64,245,54,239,142,205,75,194,199,80,89,77,253,208,180,150,4,232,52,15,192,86,48,222,230,221,177,121,137,
+117,235,214,135,176,66,72,72,128,244,83,194,182,111,239,107,227,179,102,38,166,245,123,155,207,206,230,37,225,129,159,151,180,67,211,154,102,6,171,95,88,48,15,66,87,208,219,188,27,54,111,10,31,67,124,
+5,241,23,106,94,23,176,109,91,111,153,137,160,58,244,4,188,205,187,83,219,37,168,164,166,110,104,89,115,2,108,221,218,51,202,166,3,58,155,54,125,216,219,188,163,194,223,122,235,29,33,124,140,210,212,
+13,45,235,73,128,14,243,64,221,221,59,188,205,59,96,243,146,240,49,236,221,36,36,64,125,95,22,81,130,87,16,93,135,65,6,111,243,217,214,118,73,120,32,254,166,94,104,88,247,254,0,234,151,75,230,1,89,31,
+232,109,62,91,155,183,193,112,189,144,0,245,111,16,161,236,164,7,75,209,161,143,233,109,62,91,155,55,185,229,150,219,67,248,60,159,169,23,26,46,39,1,214,40,170,230,65,121,53,236,109,62,27,155,151,132,
+7,226,46,136,143,118,245,111,18,69,121,236,177,109,23,25,5,212,225,163,134,222,230,179,169,237,166,240,49,172,6,50,117,66,187,101,239,19,184,101,203,214,110,22,27,154,208,19,240,54,223,122,155,151,
+224,248,146,70,104,215,144,221,66,213,129,42,230,193,105,112,120,155,111,173,205,75,220,124,243,109,225,116,61,65,252,198,108,21,75,81,13,191,105,26,127,58,12,10,121,155,111,173,205,155,194,199,240,
+221,0,83,31,52,107,100,2,180,11,39,8,199,4,188,205,183,198,230,77,209,99,226,47,137,9,52,246,3,82,155,55,127,164,204,30,1,58,44,25,247,54,191,62,19,225,99,24,250,53,117,65,171,134,127,49,68,245,49,59,
+233,103,154,224,2,222,230,155,111,243,182,218,47,105,130,86,77,249,110,144,58,240,37,243,100,60,127,188,205,183,166,182,199,180,183,175,11,255,203,204,31,65,252,230,124,52,138,242,232,163,91,58,153,
+26,102,194,135,35,188,205,55,87,120,68,215,161,229,47,105,129,70,77,253,118,160,58,65,73,58,49,227,2,222,230,155,47,60,112,111,22,241,155,251,225,72,138,234,254,181,211,5,52,217,176,97,163,183,249,6,
+219,188,13,198,96,36,13,208,166,37,223,15,86,207,253,73,158,253,38,188,35,240,54,223,216,218,174,115,211,77,183,134,13,63,41,246,104,210,210,47,136,171,19,206,75,23,194,163,192,219,124,227,133,7,238,
+215,34,126,107,63,31,79,121,248,225,15,117,49,14,96,194,188,65,111,243,203,183,121,93,248,24,22,124,72,49,71,139,66,22,69,157,120,70,186,32,122,5,222,230,27,35,122,12,123,51,90,196,159,41,100,89,84,
+95,116,142,254,168,9,221,20,111,243,203,23,30,120,172,74,49,38,246,133,172,203,198,141,155,58,20,85,134,36,77,88,72,226,109,190,126,225,129,1,54,41,182,81,204,59,10,46,20,117,33,69,203,69,134,217,235,
+109,190,54,209,225,198,27,111,9,29,212,22,87,98,94,112,169,116,117,61,50,205,76,33,19,38,145,50,113,196,219,252,186,84,162,199,16,19,98,39,197,148,88,23,92,44,234,194,202,210,5,211,51,144,146,192,219,
+252,245,194,199,226,19,51,139,248,229,130,203,69,101,237,44,153,107,162,39,129,183,121,89,120,224,49,73,172,164,24,18,219,130,235,69,93,124,155,98,142,155,144,160,77,224,109,94,134,193,51,91,220,162,
+152,182,21,242,80,212,133,174,85,92,182,221,12,189,131,213,110,243,38,184,99,130,248,196,114,109,33,79,101,195,134,141,107,21,115,188,36,146,96,156,96,181,218,188,206,13,55,220,28,86,8,91,156,162,24,
+230,75,124,45,9,218,20,179,182,155,99,196,16,219,91,77,54,31,139,14,220,15,51,170,18,196,39,118,109,133,188,151,7,31,236,42,51,142,109,131,118,193,106,176,249,88,120,96,128,39,41,38,196,172,176,146,
+138,186,161,233,164,27,230,85,50,3,31,43,213,230,99,184,102,30,127,75,136,63,93,88,137,229,129,7,30,42,42,170,44,99,178,193,251,238,60,8,95,139,232,16,55,244,146,238,61,138,77,177,176,146,203,253,247,
+127,160,67,49,199,172,22,27,180,13,88,111,144,119,155,143,161,157,195,214,45,73,247,28,197,164,163,176,90,138,186,217,153,37,2,114,109,202,121,222,108,62,38,254,130,215,82,247,73,44,10,171,177,220,
+119,223,134,46,197,188,34,72,130,68,192,62,121,52,184,108,243,192,239,49,55,18,225,151,186,175,232,222,187,10,171,189,168,32,76,166,8,86,8,109,4,134,75,93,19,158,46,44,189,153,180,247,193,61,23,124,
+249,107,81,207,253,118,69,137,231,127,26,168,97,236,82,18,39,67,22,54,143,232,56,19,215,146,246,186,163,123,108,247,138,91,138,106,44,117,42,46,209,104,74,11,143,8,70,211,104,47,48,180,172,39,68,163,
+68,231,207,60,130,104,208,225,66,156,179,150,107,140,238,169,211,43,92,91,34,148,107,12,242,53,232,107,99,201,244,38,104,140,145,24,113,27,34,78,140,88,100,254,28,47,183,162,183,65,205,198,89,72,40,
+142,193,247,146,234,189,142,232,30,188,240,245,22,85,211,218,21,211,138,10,181,46,39,84,162,107,246,86,223,224,100,232,86,92,84,84,29,20,189,26,93,91,183,87,170,201,69,53,186,214,40,122,20,37,69,133,
+70,88,70,84,162,107,224,90,214,120,101,50,42,157,157,239,239,80,140,42,202,138,5,230,208,55,137,133,232,28,156,171,195,71,222,221,132,104,83,116,42,138,138,41,69,73,49,171,152,87,44,42,174,40,174,42,
+170,17,87,163,191,91,140,126,102,54,250,157,169,232,24,28,171,205,71,214,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,23,95,124,241,197,153,50,57,57,213,166,232,84,20,21,83,
+138,146,98,86,49,175,88,84,92,81,92,85,84,35,174,70,127,183,24,253,204,108,244,59,83,209,49,56,150,31,10,118,88,240,14,197,168,162,172,88,80,4,77,98,33,58,7,231,242,47,131,178,42,23,46,60,181,70,209,
+163,40,41,42,138,32,35,42,209,53,112,45,254,117,112,179,203,249,243,79,118,43,46,42,170,138,192,49,170,209,181,249,9,33,13,22,189,93,49,173,168,56,40,186,141,74,116,205,126,74,88,189,229,241,199,159,
+232,84,148,21,65,61,140,143,159,10,14,29,26,13,138,197,189,65,111,239,64,248,29,61,118,212,102,127,61,182,91,97,17,102,188,38,143,63,179,17,3,187,111,241,51,124,114,173,167,103,103,176,107,215,158,
+224,224,193,145,224,248,241,147,65,189,215,17,221,131,159,20,90,163,240,151,106,9,242,217,179,23,130,195,135,199,130,129,129,161,240,139,89,136,25,175,180,93,98,49,230,146,203,182,226,133,28,28,139,
+207,177,244,247,239,10,134,135,143,132,231,172,49,17,46,249,68,72,40,231,206,77,182,43,74,138,32,13,39,78,156,9,246,236,57,16,214,108,115,121,245,114,69,215,133,79,130,143,51,13,13,237,11,38,38,78,7,
+105,175,59,186,71,255,104,208,139,170,77,147,212,168,52,236,223,63,44,138,222,200,218,110,35,105,197,15,201,176,119,239,193,32,237,125,112,207,94,248,179,23,186,20,243,75,5,139,231,249,206,157,197,
+112,159,60,215,132,7,125,33,8,215,67,155,131,118,67,138,36,224,222,87,231,226,208,51,103,206,207,40,130,36,142,30,157,8,27,99,205,16,189,209,194,75,108,221,218,19,140,141,141,7,75,221,39,177,88,77,
+194,119,40,230,146,2,66,141,167,22,185,88,219,211,8,111,46,26,217,182,173,55,116,132,37,146,128,152,172,236,209,197,211,167,31,47,42,170,138,192,198,224,224,238,112,135,44,151,109,62,173,240,58,252,
+59,61,136,164,123,143,98,179,50,183,136,57,117,234,220,180,34,176,65,159,157,62,120,222,108,30,113,207,159,159,12,190,242,149,231,131,143,126,116,250,58,225,205,213,68,180,99,14,28,56,28,36,197,130,
+88,173,52,241,203,73,55,220,215,55,152,91,155,255,222,247,190,31,188,243,206,59,215,248,249,207,127,33,10,111,178,125,123,223,82,73,144,255,109,226,78,158,60,219,166,152,85,4,18,35,35,71,195,175,93,
+230,213,230,143,29,155,120,151,248,49,127,243,55,211,86,225,245,165,102,140,60,50,168,100,139,79,20,187,182,188,138,191,86,49,103,187,185,221,187,247,231,202,230,37,94,126,249,199,98,2,124,245,171,
+207,39,10,111,194,144,115,66,18,16,195,124,109,21,123,226,196,153,181,138,203,140,214,73,96,249,121,108,205,235,12,12,20,69,241,225,252,249,39,150,20,29,216,196,34,134,158,130,45,94,81,44,215,230,69,
+252,54,197,156,237,102,232,27,231,185,53,31,63,223,191,254,245,23,69,241,255,243,63,255,223,154,132,215,225,93,67,66,18,16,83,247,31,7,19,19,167,103,25,27,55,161,31,204,139,154,188,217,188,212,154,
+231,141,226,255,253,191,255,87,76,128,207,124,230,179,53,11,31,195,86,52,124,10,142,88,73,49,36,182,78,139,63,62,126,170,204,32,142,201,177,99,39,194,198,94,222,108,222,214,154,255,228,39,159,181,218,
+63,93,217,90,68,143,133,215,161,171,200,40,168,20,75,98,236,170,248,211,105,197,207,139,205,219,120,253,245,63,138,226,255,195,63,124,179,166,218,158,4,73,64,236,44,73,224,214,56,129,178,172,34,182,
+37,193,91,178,60,218,188,141,51,103,206,89,107,255,208,208,222,101,11,127,239,189,239,187,6,143,26,91,92,137,185,43,226,119,40,170,210,69,242,218,54,175,54,111,235,194,253,236,103,63,23,197,159,157,
+253,231,134,9,175,195,35,197,146,0,196,60,251,119,7,202,166,230,176,42,147,29,59,250,115,109,243,82,55,110,239,222,3,214,218,63,49,113,170,97,162,235,176,1,38,21,73,138,49,177,207,84,124,213,80,153,
+161,177,98,194,11,157,60,219,188,173,21,127,241,226,119,68,241,255,253,223,255,208,80,225,17,221,132,177,19,41,214,104,144,149,248,93,210,5,49,99,39,239,54,47,241,225,15,127,196,90,251,63,254,241,103,
+154,38,188,14,51,142,44,73,208,250,73,37,99,99,227,243,76,118,48,121,228,145,205,185,182,121,91,223,253,115,159,251,130,40,254,219,111,191,29,60,248,224,67,203,182,249,36,216,155,24,104,76,75,49,71,
+139,86,139,63,41,93,8,195,153,121,183,121,169,27,199,255,191,249,230,155,98,2,240,26,184,25,181,61,22,221,132,94,149,37,9,90,51,199,240,200,145,227,237,138,192,132,217,177,121,183,121,91,11,254,201,
+39,167,172,246,207,107,221,86,8,31,195,230,213,180,177,36,13,208,166,233,9,48,58,122,172,164,8,76,232,179,230,221,230,109,188,242,202,156,40,254,75,47,253,176,225,54,159,36,124,12,113,149,52,64,155,
+102,139,223,41,157,152,46,95,222,109,222,214,119,63,124,248,136,181,246,15,15,143,54,85,116,83,120,29,186,134,150,36,104,222,226,147,145,145,163,151,152,196,161,195,244,166,248,185,159,103,155,183,
+117,227,168,229,146,248,191,253,237,43,45,169,237,18,124,41,133,159,163,199,101,234,129,70,205,18,191,83,56,89,184,142,110,37,216,188,212,144,219,177,163,207,90,251,39,39,159,204,68,120,29,122,92,146,
+38,104,213,240,4,56,124,120,172,204,250,59,29,250,165,43,193,230,109,48,179,71,18,255,141,55,222,184,246,236,111,166,205,219,132,215,97,102,149,169,11,90,53,84,252,225,225,35,237,204,93,51,225,253,
+254,74,176,121,9,250,220,244,241,165,4,248,236,103,63,223,242,218,46,193,7,171,104,124,75,218,160,89,35,19,96,218,60,129,89,251,243,106,243,182,46,220,199,62,246,76,194,59,255,15,103,38,60,162,155,
+176,72,86,72,128,198,189,50,62,116,104,180,194,188,125,29,90,161,43,193,230,109,221,184,63,252,225,15,162,248,223,252,230,197,150,219,188,77,248,24,222,24,154,250,160,89,163,196,239,22,14,30,90,100,
+222,109,222,214,138,159,152,56,153,248,206,191,213,54,159,4,95,69,227,90,36,141,208,110,217,9,112,240,224,200,69,118,201,208,97,193,230,74,176,121,27,188,219,151,196,255,151,127,249,215,204,108,94,18,
+94,135,201,182,166,78,104,183,44,241,85,31,127,141,162,74,95,95,135,137,139,43,193,230,165,46,220,224,224,144,181,246,159,56,113,42,83,225,77,209,117,24,139,49,117,138,180,91,179,156,4,232,49,15,74,
+183,99,37,216,188,173,239,94,46,255,131,40,254,107,175,189,150,169,205,39,193,7,46,129,247,49,66,18,244,212,157,0,251,247,15,151,24,109,210,225,141,223,74,176,121,169,5,143,179,217,106,255,211,79,207,
+100,110,243,54,225,99,120,83,104,234,133,134,203,73,128,138,121,64,250,157,121,183,121,27,127,251,183,31,19,197,175,84,42,225,50,182,172,109,94,18,93,135,225,120,33,1,234,235,13,236,219,119,168,67,17,
+232,208,247,95,9,54,111,235,198,125,234,83,159,182,172,245,251,154,51,54,111,227,238,187,239,9,97,76,192,212,13,45,235,73,128,81,243,64,236,218,145,119,155,79,234,191,219,26,128,219,183,247,58,99,243,
+54,225,99,120,68,11,9,48,90,115,2,168,218,94,166,198,235,176,118,45,239,54,191,84,23,238,169,167,62,26,252,249,207,127,14,133,127,235,173,255,10,30,127,124,210,41,155,183,9,31,195,35,218,212,13,45,
+107,78,0,101,37,11,216,137,14,59,108,230,221,230,211,116,225,248,121,38,129,186,106,243,54,238,186,235,189,161,30,166,110,104,89,171,248,109,194,65,174,179,254,60,218,188,11,131,54,205,16,62,134,159,
+151,180,67,211,212,9,160,250,250,157,244,247,117,216,167,111,165,216,188,235,173,249,122,132,215,97,13,129,169,31,154,214,146,0,69,243,0,52,46,86,146,205,187,222,154,175,85,116,29,94,211,11,9,144,126,
+45,225,208,208,190,41,70,149,116,104,0,122,155,119,87,248,59,239,236,184,6,13,65,83,63,52,77,157,0,197,226,222,18,219,172,235,48,74,230,109,222,29,155,151,132,143,225,77,173,169,31,154,214,146,0,179,
+230,1,216,130,221,219,188,59,54,47,9,31,67,59,77,72,128,244,187,139,236,218,181,103,158,157,171,116,120,219,228,109,222,29,155,151,88,191,254,61,33,196,203,212,15,77,107,73,128,69,243,0,188,253,243,
+54,239,142,205,75,194,199,112,221,66,2,44,166,78,128,193,193,221,87,88,126,164,131,173,120,155,119,199,230,37,225,99,56,190,169,31,154,166,78,128,129,129,161,171,124,126,69,103,41,225,189,205,103,83,
+219,109,152,250,161,105,45,9,80,53,15,224,109,222,109,225,239,184,227,238,119,33,36,64,53,117,2,236,220,89,172,50,242,167,227,109,222,45,155,183,9,31,99,234,135,166,181,36,192,85,41,1,188,205,187,99,
+243,54,225,129,127,23,18,32,253,35,160,191,127,215,21,62,110,160,67,27,192,219,188,91,54,111,114,251,237,119,133,112,44,83,63,52,77,157,0,125,125,131,139,188,80,208,161,23,224,109,222,45,155,55,133,
+143,225,186,77,253,208,180,150,4,152,55,15,192,56,128,183,121,119,108,94,18,62,134,24,9,9,144,126,32,168,183,119,96,150,233,95,58,140,4,122,155,191,199,185,218,46,65,37,53,245,67,211,90,18,160,100,30,
+128,119,1,222,230,221,21,254,182,219,238,188,6,19,119,132,4,72,255,50,168,167,103,231,20,203,191,116,120,197,232,109,222,29,155,151,132,143,97,10,187,169,31,154,166,78,128,29,59,250,139,236,251,163,
+195,10,84,111,243,238,216,188,36,124,12,149,213,212,15,77,107,73,128,78,243,0,108,5,227,109,222,29,155,151,88,183,110,125,8,43,132,132,4,72,63,37,108,251,246,190,54,246,191,51,49,173,223,219,124,118,
+54,47,9,15,252,188,164,29,154,214,52,51,88,253,194,130,121,16,186,130,222,230,221,176,121,83,248,24,226,43,136,191,80,243,186,128,109,219,122,203,76,4,213,161,39,224,109,222,157,218,46,65,37,53,117,
+67,203,154,19,96,235,214,158,81,54,29,208,217,180,233,195,222,230,29,21,254,214,91,239,8,225,99,148,166,110,104,89,79,2,116,152,7,234,238,222,225,109,222,1,155,151,132,143,97,239,38,33,1,234,251,178,
+136,18,188,130,232,58,12,50,120,155,207,182,182,75,194,3,241,55,245,66,195,186,247,7,80,191,92,50,15,200,250,64,111,243,217,218,188,13,134,235,133,4,168,127,131,8,101,39,61,88,138,14,125,76,111,243,
+217,218,188,201,45,183,220,30,194,231,249,76,189,208,112,57,9,176,70,81,53,15,202,171,97,111,243,217,216,188,36,60,16,119,65,124,180,171,127,147,40,202,99,143,109,187,200,40,160,14,31,53,244,54,159,
+77,109,55,133,143,97,53,144,169,19,218,45,123,159,192,45,91,182,118,179,216,208,132,158,128,183,249,214,219,188,4,199,151,52,66,187,134,236,22,170,14,84,49,15,78,131,195,219,124,107,109,94,226,230,
+155,111,11,167,235,9,226,55,102,171,88,138,106,248,77,211,248,211,97,80,200,219,124,107,109,222,20,62,134,239,6,152,250,160,89,35,19,160,93,56,65,56,38,224,109,190,53,54,111,138,30,19,127,73,76,160,
+177,31,144,218,188,249,35,101,246,8,208,97,201,184,183,249,245,153,8,31,195,208,175,169,11,90,53,252,139,33,170,143,217,73,63,211,4,23,240,54,223,124,155,183,213,126,73,19,180,106,202,119,131,212,129,
+47,153,39,227,249,227,109,190,53,181,61,166,189,125,93,248,95,102,254,8,226,55,231,163,81,148,71,31,221,210,201,212,48,19,62,28,225,109,190,185,194,35,186,14,45,127,73,11,52,106,234,183,3,213,9,74,
+210,137,25,23,240,54,223,124,225,129,123,179,136,223,220,15,71,82,84,247,175,157,46,160,201,134,13,27,189,205,55,216,230,109,48,6,35,105,128,54,45,249,126,176,122,238,79,242,236,55,225,29,129,183,249,
+198,214,118,157,155,110,186,53,108,248,73,177,71,147,150,126,65,92,157,112,94,186,16,30,5,222,230,27,47,60,112,191,22,241,91,251,249,120,202,195,15,127,168,139,113,0,19,230,13,122,155,95,190,205,235,
+194,199,176,224,67,138,57,90,20,178,40,234,196,51,210,5,209,43,240,54,223,24,209,99,216,155,209,34,254,76,33,203,162,250,162,115,244,71,77,232,166,120,155,95,190,240,192,99,85,138,49,177,47,100,93,54,
+110,220,212,161,168,50,36,105,194,66,18,111,243,245,11,15,12,176,73,177,141,98,222,81,112,161,168,11,41,90,46,50,204,94,111,243,181,137,14,55,222,120,75,232,160,182,184,18,243,130,75,165,171,235,145,
+105,102,10,153,48,137,148,137,35,222,230,215,165,18,61,134,152,16,59,41,166,196,186,224,98,81,23,86,150,46,152,158,129,148,4,222,230,175,23,62,22,159,152,89,196,47,23,92,46,42,107,103,201,92,19,61,9,
+188,205,203,194,3,143,73,98,37,197,144,216,22,92,47,234,226,219,20,115,220,132,4,109,2,111,243,50,12,158,217,226,22,197,180,173,144,135,162,46,116,173,226,178,237,102,232,29,172,118,155,55,193,29,19,
+196,39,150,107,11,121,42,27,54,108,92,171,152,227,37,145,4,227,4,171,213,230,117,110,184,225,230,176,66,216,226,20,197,48,95,226,107,73,208,166,152,181,221,28,35,134,216,222,106,178,249,88,116,224,
+126,152,81,149,32,62,177,107,43,228,189,60,248,96,87,153,113,108,27,180,11,86,131,205,199,194,3,3,60,73,49,33,102,133,149,84,212,13,77,39,221,48,175,146,25,248,88,169,54,31,195,53,243,248,91,66,252,
+233,194,74,44,15,60,240,80,81,81,101,25,147,13,222,119,231,65,248,90,68,135,184,161,151,116,239,81,108,138,133,149,92,238,191,255,3,29,138,57,102,181,216,160,109,192,122,131,188,219,124,12,237,28,182,
+110,73,186,231,40,38,29,133,213,82,212,205,206,44,17,144,107,83,206,243,102,243,49,241,23,188,150,186,79,98,81,88,141,229,190,251,54,116,41,230,21,65,18,36,2,246,201,163,193,101,155,7,126,143,185,145,
+8,191,212,125,69,247,222,85,88,237,69,5,97,50,69,176,66,104,35,48,92,234,154,240,116,97,233,205,164,189,15,238,185,224,203,95,139,122,238,183,43,74,60,255,211,64,13,99,151,146,56,25,178,176,121,68,
+199,153,184,150,180,215,29,221,99,187,87,220,82,84,99,169,83,113,137,70,83,90,120,68,48,154,70,123,129,161,101,61,33,26,37,58,127,230,17,68,131,14,23,226,156,181,92,99,116,79,157,94,225,218,18,161,92,
+99,144,175,65,95,27,75,166,55,65,99,140,196,136,219,16,113,98,196,34,243,231,120,185,21,189,13,106,54,206,66,66,113,12,190,151,84,239,117,68,247,224,133,175,183,168,154,214,174,152,86,84,168,117,57,
+161,18,93,179,183,250,6,39,67,183,226,162,162,234,160,232,213,232,218,186,189,82,77,46,170,209,181,70,209,163,40,41,42,52,194,50,162,18,93,3,215,178,198,43,147,81,233,236,124,127,135,98,84,81,86,44,
+48,135,190,73,44,68,231,224,92,29,62,242,238,38,68,155,162,83,81,84,76,41,74,138,89,197,188,98,81,113,69,113,85,81,141,184,26,253,221,98,244,51,179,209,239,76,69,199,224,88,109,62,178,190,248,226,139,
+47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,190,248,226,139,47,206,148,201,201,169,54,69,167,162,168,152,82,148,20,179,138,121,197,162,226,138,226,170,162,26,113,53,250,187,197,232,
+103,102,163,223,153,138,142,193,177,252,80,176,195,130,119,40,70,21,101,197,130,34,104,18,11,209,57,56,151,127,25,148,85,185,112,225,169,53,138,30,69,73,81,81,4,25,81,137,174,129,107,241,175,131,155,
+93,206,159,127,178,91,113,81,81,85,4,142,81,141,174,205,79,8,105,176,232,237,138,105,69,197,65,209,109,84,162,107,246,83,194,234,45,143,63,254,68,167,162,172,8,234,97,124,252,84,112,232,208,104,80,44,
+238,13,122,123,7,194,239,232,177,163,54,251,235,177,221,10,139,48,227,53,121,252,153,141,24,216,125,139,159,225,147,107,61,61,59,131,93,187,246,4,7,15,142,4,199,143,159,12,234,189,142,232,30,252,164,
+208,26,133,191,84,75,144,207,158,189,16,28,62,60,22,12,12,12,133,95,204,66,204,120,165,237,18,139,49,151,92,182,21,47,228,224,88,124,142,165,191,127,87,48,60,124,36,60,103,141,137,112,201,39,66,66,57,
+119,110,178,93,81,82,4,105,56,113,226,76,176,103,207,129,176,102,155,203,171,151,43,186,46,124,18,124,156,105,104,104,95,48,49,113,58,72,123,221,209,61,250,71,131,94,84,109,154,164,70,165,97,255,254,
+97,81,244,70,214,118,27,73,43,126,72,134,189,123,15,6,105,239,131,123,246,194,159,189,208,165,152,95,42,88,60,207,119,238,44,134,251,228,185,38,60,232,11,65,184,30,218,28,180,27,82,36,1,247,190,58,23,
+135,158,57,115,126,70,17,36,113,244,232,68,216,24,107,134,232,141,22,94,98,235,214,158,96,108,108,60,88,234,62,137,197,106,18,190,67,49,151,20,16,106,60,181,200,197,218,158,70,120,115,209,200,182,109,
+189,161,35,44,145,4,196,100,101,143,46,158,62,253,120,81,81,85,4,54,6,7,119,135,59,100,185,108,243,105,133,215,225,223,233,65,36,221,123,20,155,149,185,69,204,169,83,231,166,21,129,13,250,236,244,193,
+243,102,243,75,45,25,51,87,19,209,142,57,112,224,112,144,20,11,98,181,210,196,47,39,221,112,95,223,96,238,109,94,231,161,135,62,184,228,178,178,237,219,251,150,74,130,252,111,19,119,242,228,217,54,
+197,172,34,144,24,25,57,26,126,237,114,165,216,60,163,142,191,252,229,175,130,119,222,121,39,120,243,205,183,130,153,153,79,94,39,188,190,212,140,145,71,6,149,108,241,137,98,215,150,87,241,215,42,230,
+108,55,183,123,247,254,21,103,243,175,189,246,90,40,190,206,233,211,103,175,19,222,132,33,231,132,36,32,134,249,218,42,246,196,137,51,107,21,151,25,173,147,192,242,243,110,243,230,243,253,153,103,62,
+113,157,248,112,233,210,247,172,194,179,137,69,12,61,5,91,188,162,88,174,205,139,248,109,138,57,219,205,208,55,206,179,205,75,13,59,122,45,111,189,245,150,152,0,23,47,126,39,81,120,29,222,53,36,36,1,
+49,117,255,113,48,49,113,122,150,177,113,19,250,193,188,168,89,41,173,121,157,207,126,246,243,162,248,48,58,122,116,73,225,99,216,138,134,79,193,17,43,41,134,196,214,105,241,199,199,79,149,25,196,49,
+57,118,236,68,216,216,203,187,205,75,108,218,180,57,248,203,95,254,34,138,255,163,31,189,188,164,232,177,240,58,116,21,25,5,149,98,73,140,93,21,127,58,173,248,121,180,121,91,107,254,203,95,254,170,
+181,246,239,221,123,32,181,232,82,18,16,59,75,18,184,53,78,160,44,171,136,109,73,240,150,108,37,216,188,212,141,235,238,222,97,21,255,187,223,189,84,151,240,247,222,251,190,107,48,121,197,22,87,98,
+238,138,248,29,138,170,116,145,188,182,93,9,54,111,107,197,127,227,27,255,96,77,128,254,254,193,186,133,215,97,116,212,146,0,196,60,251,119,7,202,166,230,176,42,147,29,59,250,87,140,205,75,240,122,
+218,38,254,139,47,150,151,37,186,14,27,96,82,145,164,24,19,251,76,197,87,13,149,25,26,43,38,188,208,89,41,54,111,235,191,211,191,183,37,0,115,10,151,35,60,162,155,48,118,34,197,26,13,178,18,191,75,
+186,32,102,236,172,36,155,151,186,112,52,238,108,226,255,253,223,127,165,161,194,235,48,227,200,146,4,173,159,84,50,54,54,62,207,100,7,147,71,30,217,188,98,108,222,214,119,127,249,229,31,139,226,211,
+29,164,225,86,143,205,39,193,222,196,64,99,90,138,57,90,180,90,252,73,233,66,24,206,92,73,54,47,193,192,142,173,246,127,230,51,159,109,88,109,143,69,55,161,87,101,73,130,214,204,49,60,114,228,120,187,
+34,48,97,118,236,74,178,121,27,63,251,217,207,69,241,223,124,243,205,240,62,155,37,124,12,155,87,211,198,146,52,64,155,166,39,192,232,232,177,146,34,48,193,250,86,146,205,75,93,184,19,39,78,91,107,
+255,199,63,254,76,211,133,143,33,174,146,6,104,211,108,241,59,165,19,211,229,91,73,54,111,235,187,207,205,189,42,138,255,250,235,175,55,69,116,83,120,29,186,134,150,36,104,222,226,147,145,145,163,151,
+152,196,161,195,244,166,248,185,191,82,108,94,106,193,95,184,240,164,181,246,63,241,196,83,77,171,237,18,124,41,133,159,163,199,101,234,129,70,205,18,191,83,56,89,216,231,93,73,54,111,99,126,254,53,
+81,252,223,253,238,119,45,21,94,135,30,151,164,9,90,53,60,1,14,31,30,43,179,254,78,135,126,233,74,179,121,169,239,62,61,253,113,107,237,63,121,242,76,211,108,222,38,188,14,51,171,76,93,208,170,161,
+226,15,15,31,105,103,238,154,9,239,247,87,146,205,75,253,247,255,231,255,185,63,88,88,88,16,197,255,197,47,126,209,178,218,46,193,7,171,104,124,75,218,160,89,35,19,96,218,60,129,89,251,87,130,205,75,
+13,185,103,159,253,76,226,100,143,86,11,143,232,38,44,146,21,18,160,113,175,140,15,29,26,173,48,111,95,135,86,232,74,178,121,137,174,174,135,131,255,254,239,255,22,197,255,241,143,127,210,50,155,183,
+9,31,195,27,67,83,31,52,107,148,248,221,194,193,195,97,201,149,98,243,54,190,248,197,191,75,156,236,209,42,155,79,130,175,162,145,132,146,70,104,183,236,4,56,120,112,228,34,187,100,232,176,96,115,37,
+217,188,212,127,223,188,249,49,171,248,151,46,125,63,179,218,174,11,175,195,100,91,83,39,180,91,150,248,170,143,191,70,81,165,175,175,195,196,197,149,98,243,182,46,92,169,244,130,53,1,250,250,6,50,17,
+222,20,93,135,177,24,83,167,72,187,53,203,73,128,30,243,160,116,59,86,146,205,75,45,248,29,59,250,172,226,51,11,40,11,155,79,130,15,92,2,239,99,132,36,232,169,59,1,246,239,31,46,49,218,164,195,27,191,
+149,98,243,54,152,203,111,159,236,177,53,51,155,183,9,31,195,155,66,83,47,52,92,78,2,84,204,3,210,239,92,41,54,47,117,225,152,203,103,19,159,25,192,89,218,188,36,186,14,195,241,66,2,212,215,27,216,
+183,239,80,135,34,208,161,239,191,82,108,222,214,119,127,242,201,41,81,252,74,165,18,46,230,204,218,230,109,220,125,247,61,33,140,9,152,186,161,101,61,9,48,106,30,136,93,59,86,138,205,219,250,239,71,
+142,28,19,19,224,185,231,62,235,132,205,219,132,143,225,17,45,36,192,104,205,9,160,106,123,153,26,175,195,218,181,149,96,243,75,241,211,159,206,190,75,252,223,255,254,114,152,244,46,216,188,77,248,24,
+30,209,166,110,104,89,115,2,40,43,89,192,78,116,216,97,115,37,216,124,154,46,28,171,125,153,249,251,220,115,159,11,151,177,187,100,243,54,238,186,235,189,161,30,166,110,104,89,171,248,109,194,65,174,
+179,254,188,218,124,214,131,54,205,16,62,134,159,151,180,67,211,212,9,160,250,250,157,244,247,117,88,8,177,146,108,222,229,214,124,61,194,235,176,134,192,212,15,77,107,73,128,162,121,0,26,23,43,205,
+230,93,110,205,215,42,186,14,175,233,133,4,72,191,150,112,104,104,223,20,163,74,58,52,0,189,205,187,43,252,157,119,118,92,131,134,160,169,31,154,166,78,128,98,113,111,137,13,143,116,24,255,247,54,239,
+142,205,75,194,199,240,166,214,212,15,77,107,73,128,89,243,0,108,193,238,109,222,29,155,151,132,143,161,157,38,36,64,250,221,69,118,237,218,51,207,206,85,58,188,109,242,54,239,142,205,75,172,95,255,
+158,16,226,101,234,135,166,181,36,192,162,121,0,222,254,121,155,119,199,230,37,225,99,184,110,33,1,22,83,39,192,224,224,238,43,44,63,210,193,86,188,205,187,99,243,146,240,49,28,223,212,15,77,83,39,
+192,192,192,208,85,62,191,162,179,148,240,222,230,179,169,237,54,76,253,208,180,150,4,168,154,7,240,54,239,182,240,119,220,113,247,187,16,18,160,154,58,1,118,238,44,86,25,249,211,241,54,239,150,205,
+219,132,143,49,245,67,211,90,18,224,170,148,0,222,230,221,177,121,155,240,192,191,11,9,144,254,17,208,223,191,235,10,31,55,208,161,13,224,109,222,45,155,55,185,253,246,187,66,56,150,169,31,154,166,78,
+128,190,190,193,69,94,40,232,208,11,240,54,239,150,205,155,194,199,112,221,166,126,104,90,75,2,204,155,7,96,28,192,219,188,59,54,47,9,31,67,140,132,4,72,63,16,212,219,59,48,203,244,47,29,70,2,189,205,
+223,227,92,109,151,160,146,154,250,161,105,45,9,80,50,15,192,187,0,111,243,238,10,127,219,109,119,94,131,137,59,66,2,164,127,25,212,211,179,115,138,229,95,58,188,98,244,54,239,142,205,75,194,199,48,
+133,205,212,15,77,83,39,192,142,29,253,69,246,253,209,97,5,170,183,121,119,108,94,18,62,134,202,106,234,135,166,181,36,64,167,121,0,182,130,241,54,239,142,205,75,172,91,183,62,132,21,66,66,2,164,159,
+18,182,125,123,95,27,159,53,51,49,173,223,219,124,118,54,47,9,15,252,188,164,29,154,214,52,51,88,253,194,130,121,16,186,130,222,230,221,176,121,83,248,24,226,43,136,191,80,243,186,128,109,219,122,203,
+76,4,213,161,39,224,109,222,157,218,46,65,37,53,117,67,203,154,19,96,235,214,158,81,54,29,208,217,180,233,195,222,230,29,21,254,214,91,239,8,97,253,162,169,27,90,214,147,0,29,230,129,248,68,138,183,
+249,236,109,94,18,62,134,189,155,132,4,168,239,203,34,74,240,10,162,235,48,200,224,109,62,219,218,46,9,15,196,223,212,11,13,235,222,31,64,253,114,201,60,32,235,3,189,205,103,107,243,54,24,174,23,18,
+160,254,13,34,148,157,244,96,41,58,244,49,189,205,103,107,243,38,183,220,114,123,8,159,231,51,245,66,195,229,36,192,26,69,213,60,40,175,134,189,205,103,99,243,146,240,64,220,5,241,209,174,254,77,162,
+40,143,61,182,237,34,163,128,58,124,212,208,219,124,54,181,221,20,62,134,213,64,166,78,104,183,236,125,2,183,108,217,218,205,98,67,19,122,2,222,230,91,111,243,18,28,95,210,8,237,26,178,91,168,58,80,
+197,60,56,13,14,111,243,173,181,121,137,155,111,190,45,156,174,39,136,223,152,173,98,41,170,225,55,77,227,79,135,65,33,111,243,173,181,121,83,248,24,190,27,96,234,131,102,141,76,128,118,225,4,225,152,
+128,183,249,214,216,188,41,122,76,252,37,49,129,198,126,64,106,243,230,143,148,217,35,64,135,37,227,222,230,215,103,34,124,12,67,191,166,46,104,213,240,47,134,168,62,102,39,253,76,19,92,192,219,124,
+243,109,222,86,251,37,77,208,170,41,223,13,82,7,190,100,158,140,231,143,183,249,214,212,246,152,246,246,117,225,127,153,249,35,136,223,156,143,70,81,30,125,116,75,39,83,195,76,248,112,132,183,249,230,
+10,143,232,58,180,252,37,45,208,168,169,223,14,84,39,40,73,39,102,92,192,219,124,243,133,7,238,205,34,126,115,63,28,73,81,221,191,118,186,128,38,27,54,108,244,54,223,96,155,183,193,24,140,164,1,218,
+180,228,251,193,234,185,63,201,179,223,132,119,4,222,230,27,91,219,117,110,186,233,214,176,225,39,197,30,77,90,250,5,113,117,194,121,233,66,120,20,120,155,111,188,240,192,253,90,196,111,237,231,227,
+41,15,63,252,161,46,198,1,76,152,55,232,109,126,249,54,175,11,31,195,130,15,41,230,104,81,200,162,168,19,207,72,23,68,175,192,219,124,99,68,143,97,111,70,139,248,51,133,44,139,234,139,206,209,31,53,
+161,155,226,109,126,249,194,3,143,85,41,198,196,190,144,117,217,184,113,83,135,162,202,144,164,9,11,73,188,205,215,47,60,48,192,38,197,54,138,121,71,193,133,162,46,164,104,185,200,48,123,189,205,215,
+38,58,220,120,227,45,161,131,218,226,74,204,11,46,149,174,174,71,166,153,41,100,194,36,82,38,142,120,155,95,151,74,244,24,98,66,236,164,152,18,235,130,139,69,93,88,89,186,96,122,6,82,18,120,155,191,
+94,248,88,124,98,102,17,191,92,112,185,168,172,157,37,115,77,244,36,240,54,47,11,15,60,38,137,149,20,67,98,91,112,189,168,139,111,83,204,113,19,18,180,9,188,205,203,48,120,102,139,91,20,211,182,66,30,
+138,186,208,181,138,203,182,155,161,119,176,218,109,222,4,119,76,16,159,88,174,45,228,169,108,216,176,113,173,98,142,151,68,18,140,19,172,86,155,215,185,225,134,155,195,10,97,139,83,20,195,124,137,
+175,37,65,155,98,214,118,115,140,24,98,123,171,201,230,99,209,129,251,249,255,217,123,179,239,186,142,58,239,251,252,1,190,209,165,175,147,40,137,147,56,9,34,23,121,222,195,179,200,96,34,119,6,140,
+131,60,104,214,145,71,73,150,44,219,146,60,219,74,34,136,24,76,195,11,33,76,105,224,48,156,166,29,16,52,16,134,22,83,51,10,250,49,47,162,161,73,139,60,64,11,122,29,114,229,91,95,156,253,254,62,187,
+119,153,114,185,246,62,123,31,157,97,159,115,170,214,250,172,104,197,210,30,126,223,95,125,119,85,237,170,218,204,168,138,16,159,216,117,100,154,189,60,250,104,119,129,113,236,48,104,23,180,131,205,
+43,225,129,1,158,168,152,16,179,76,43,21,185,161,197,168,27,230,85,50,3,31,173,106,243,10,174,153,199,95,25,241,23,51,173,88,30,121,228,177,156,80,98,25,83,24,188,239,110,6,225,147,136,14,170,161,23,
+117,239,65,108,114,153,86,46,15,63,252,150,46,97,133,89,45,97,208,54,96,189,65,179,219,188,130,118,14,91,183,68,221,115,16,147,174,76,187,20,185,217,75,101,2,114,125,202,121,179,217,188,66,125,193,
+171,220,125,18,139,76,59,150,135,30,218,214,45,172,10,94,20,36,2,246,201,163,33,205,54,15,252,29,115,35,17,190,220,125,5,247,222,157,105,247,34,65,152,143,17,44,31,218,8,12,151,166,77,120,186,176,244,
+102,226,222,7,247,156,113,229,111,69,158,251,157,66,158,231,127,28,168,97,236,82,162,146,161,17,54,143,232,56,19,215,18,247,186,131,123,236,116,138,135,20,105,44,101,133,37,26,77,113,225,17,193,104,
+26,237,5,134,150,245,132,168,150,232,252,204,35,136,6,29,46,196,57,147,92,99,112,79,89,167,112,178,68,40,36,12,242,117,232,107,99,201,244,38,104,140,145,24,170,13,161,18,67,137,204,207,106,185,21,189,
+13,106,54,206,66,66,113,12,190,151,84,233,117,4,247,224,132,175,180,72,77,235,20,22,133,34,181,174,73,40,6,215,236,172,190,202,201,208,35,92,22,74,41,20,189,20,92,91,143,83,170,198,69,26,93,155,132,
+94,33,47,20,105,132,53,136,98,112,13,92,203,38,167,76,131,74,54,251,230,46,97,74,40,8,107,204,161,175,17,107,193,57,56,87,151,139,124,122,19,162,67,200,10,57,97,65,200,11,203,194,170,176,46,92,21,174,
+9,165,128,107,193,255,91,15,126,103,57,248,155,133,224,24,28,171,195,69,214,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,37,53,101,126,126,161,67,200,10,57,97,65,
+200,11,203,194,170,176,46,92,21,174,9,165,128,107,193,255,91,15,126,103,57,248,155,133,224,24,28,203,13,5,167,88,240,46,97,74,40,8,107,130,87,35,214,130,115,112,46,247,50,168,81,229,226,197,231,54,9,
+189,66,94,40,10,94,131,40,6,215,192,181,184,215,193,181,46,23,46,60,219,35,92,22,74,130,151,50,74,193,181,185,9,33,85,22,189,83,88,20,138,41,20,61,140,98,112,205,110,74,88,165,229,252,249,103,178,66,
+65,240,42,97,102,230,148,55,62,62,229,229,114,7,188,190,190,33,255,59,122,236,168,205,254,122,108,183,194,34,76,181,38,143,159,217,136,129,221,183,248,29,62,185,214,219,59,232,141,140,236,247,198,198,
+38,189,19,39,78,122,149,94,71,112,15,110,82,104,66,225,151,146,4,249,236,217,139,222,145,35,211,222,208,208,168,255,197,44,196,84,43,109,203,44,198,44,187,108,75,45,228,224,88,124,142,101,96,96,196,
+155,152,56,234,159,51,97,34,44,185,68,136,40,231,206,205,119,10,121,193,139,195,220,220,25,111,255,254,195,126,205,54,151,87,111,84,116,93,248,40,248,56,211,232,232,65,111,118,246,180,23,247,186,131,
+123,116,143,6,189,72,109,154,167,70,197,225,208,161,9,171,232,213,172,237,97,68,173,248,33,25,14,28,24,243,226,222,7,247,236,132,63,123,177,91,88,45,23,44,158,231,131,131,57,127,159,188,180,9,15,250,
+66,16,174,135,54,7,237,134,24,73,192,189,183,231,226,208,51,103,46,92,18,188,40,142,29,155,245,27,99,181,16,189,218,194,219,216,181,171,215,155,158,158,241,202,221,39,177,104,39,225,187,132,149,168,
+128,80,227,169,69,105,172,237,113,132,55,23,141,236,222,221,231,59,66,153,36,32,38,173,61,186,120,250,244,249,156,80,18,188,48,134,135,247,249,59,100,165,217,230,227,10,175,195,191,211,131,136,186,
+247,32,54,173,185,69,204,169,83,231,22,5,47,12,250,236,244,193,155,205,230,203,45,25,51,87,19,209,142,57,124,248,136,23,21,11,98,213,106,226,23,162,110,184,191,127,184,233,109,190,156,240,38,123,246,
+244,151,75,130,230,223,38,238,228,201,179,29,194,178,224,217,152,156,60,230,127,237,178,85,108,62,142,240,250,82,51,70,30,25,84,10,139,79,16,187,142,102,21,127,179,176,18,118,115,251,246,29,106,89,
+155,87,240,72,59,126,124,86,238,245,96,228,154,67,134,156,35,146,128,24,54,215,86,177,115,115,103,54,11,87,24,173,179,129,229,183,186,205,63,243,204,115,222,235,175,191,126,157,175,124,229,171,55,9,
+207,38,22,10,122,10,97,241,10,98,185,185,89,196,239,16,86,194,110,134,190,113,171,219,252,238,221,189,55,136,175,184,116,233,239,111,18,94,135,119,13,17,73,64,76,211,255,56,152,157,61,189,204,216,184,
+9,253,96,94,212,180,154,205,219,158,239,95,253,234,215,172,9,240,245,175,191,18,42,62,176,21,13,159,130,35,86,182,24,18,219,84,139,63,51,115,170,192,32,142,201,241,227,115,126,99,175,21,91,243,166,
+173,159,59,119,209,42,62,124,250,211,159,9,21,94,135,174,34,163,160,182,88,18,227,180,138,191,24,87,252,86,107,205,43,120,13,253,234,171,255,25,154,0,123,246,244,133,138,110,75,2,98,23,146,4,233,26,
+39,16,203,202,97,91,54,120,75,214,138,54,111,35,159,255,108,168,248,239,123,223,251,99,9,255,224,131,111,186,14,147,87,194,226,74,204,211,34,126,151,80,178,93,36,175,109,91,209,230,109,173,249,241,
+241,201,80,241,127,242,147,159,36,18,94,135,174,100,72,2,16,243,198,191,59,16,155,90,193,170,76,246,238,29,104,73,155,15,235,198,253,236,103,43,161,9,112,232,208,120,34,209,117,216,0,147,138,100,139,
+49,177,111,168,248,210,80,185,68,99,197,132,23,58,173,106,243,182,110,220,7,62,240,193,80,241,63,249,201,79,39,22,30,209,77,24,59,177,197,26,13,26,37,126,183,237,130,152,177,211,170,54,111,163,183,
+119,32,84,252,255,248,143,255,240,239,127,35,194,235,48,227,40,36,9,234,63,169,100,122,122,102,149,201,14,38,79,60,177,163,101,109,222,198,55,190,241,205,208,4,56,117,234,108,108,155,143,130,189,137,
+129,198,180,45,230,104,81,111,241,231,109,23,194,112,102,171,218,188,173,239,126,241,226,51,161,226,127,249,203,95,169,138,232,38,244,170,66,146,160,62,115,12,143,30,61,209,41,120,38,204,142,109,85,
+155,183,13,218,208,79,127,237,181,215,172,226,23,139,69,111,231,206,158,170,10,175,96,243,106,218,88,54,13,208,166,230,9,48,53,117,60,47,120,38,244,89,91,213,230,109,45,248,207,125,174,16,90,251,223,
+245,174,247,212,68,120,5,113,181,105,128,54,181,22,63,107,59,49,93,190,86,181,121,27,83,83,211,161,226,255,224,7,255,90,53,209,77,225,117,232,26,134,36,65,237,22,159,76,78,30,91,98,18,135,14,211,155,
+212,115,191,213,108,62,140,127,251,183,127,11,77,128,209,209,3,85,173,237,54,248,82,10,191,71,143,203,212,3,141,106,37,126,214,114,50,127,29,93,171,218,188,173,239,254,161,15,189,16,42,254,199,62,246,
+137,154,11,175,67,143,203,166,9,90,85,61,1,142,28,153,46,176,254,78,135,126,105,171,218,188,173,239,62,48,48,28,42,254,234,234,175,253,243,85,211,230,195,132,215,97,102,149,169,11,90,85,85,252,137,
+137,163,157,204,93,51,225,253,126,171,218,188,173,5,255,237,111,255,75,104,2,156,56,49,87,211,218,110,131,15,86,209,248,182,105,131,102,213,76,128,69,243,4,102,237,111,37,155,183,241,236,179,239,8,21,
+255,242,229,47,214,77,120,68,55,97,145,172,37,1,170,247,202,120,124,124,170,200,188,125,29,90,161,173,104,243,54,168,101,127,250,211,159,172,226,255,249,207,127,246,159,197,141,16,94,193,27,67,83,31,
+52,171,150,248,61,150,131,251,195,146,173,104,243,182,190,251,23,190,240,79,161,181,127,97,225,157,53,183,249,40,248,42,26,215,104,211,8,237,54,156,0,99,99,147,151,217,37,67,135,5,155,173,104,243,182,
+254,251,244,244,137,80,241,191,243,157,239,214,189,182,235,194,235,48,217,214,212,9,237,54,36,190,244,241,55,9,37,250,250,58,76,92,108,53,155,183,117,219,248,255,191,252,229,255,23,154,0,131,131,35,
+117,21,222,20,93,135,177,24,83,167,64,187,77,27,73,128,94,243,160,116,59,90,209,230,109,188,248,226,71,67,197,127,225,133,23,235,106,243,81,240,129,75,224,125,140,37,9,122,43,78,128,67,135,38,242,140,
+54,233,240,198,175,213,108,222,198,208,80,46,84,252,43,87,126,217,16,155,15,19,94,193,155,66,83,47,52,220,72,2,20,205,3,210,34,110,37,155,15,235,187,127,247,187,223,11,77,0,222,5,52,194,230,109,162,
+235,48,28,111,73,128,202,122,3,7,15,142,119,9,158,14,125,255,86,179,121,91,223,125,108,236,72,168,248,133,194,63,54,212,230,195,184,255,254,7,124,24,19,48,117,67,203,74,18,96,202,60,16,187,118,180,
+146,205,135,117,223,78,159,62,107,21,255,143,127,252,163,191,199,96,35,109,62,76,120,5,143,104,75,2,76,37,78,0,169,237,5,106,188,14,107,215,90,201,230,195,103,221,188,221,154,0,23,47,62,219,112,155,
+15,19,94,193,35,218,212,13,45,19,39,128,88,201,26,118,162,67,246,183,138,205,151,235,187,63,247,220,59,110,154,221,155,22,155,15,227,190,251,222,232,235,97,234,134,150,73,197,239,176,28,228,38,235,
+111,102,155,143,211,119,127,236,177,191,147,70,212,152,255,210,43,77,54,111,19,94,193,239,219,180,67,211,216,9,32,125,253,44,253,125,29,246,233,107,37,155,111,228,160,205,70,109,222,38,188,14,107,8,
+76,253,208,52,73,2,228,204,3,208,184,104,53,155,79,115,107,62,169,232,58,56,150,37,1,226,175,37,28,29,61,184,192,168,146,14,13,192,86,180,249,180,182,230,147,10,127,239,189,93,215,161,33,104,234,135,
+166,177,19,32,151,59,144,103,155,117,29,198,255,157,205,167,199,230,109,194,43,120,83,107,234,135,166,73,18,96,217,60,0,107,223,157,205,167,199,230,109,194,43,104,167,89,18,32,254,238,34,35,35,251,87,
+217,185,74,135,183,77,206,230,211,99,243,54,182,110,125,131,15,241,50,245,67,211,36,9,176,110,30,128,183,127,206,230,211,99,243,54,225,21,92,183,37,1,214,99,39,192,240,240,190,171,44,63,210,193,86,
+156,205,167,199,230,109,194,43,56,190,169,31,154,198,78,128,161,161,209,107,124,126,69,167,156,240,206,230,27,83,219,195,48,245,67,211,36,9,80,50,15,224,108,62,221,194,223,115,207,253,55,96,73,128,82,
+236,4,24,28,204,149,24,249,211,113,54,159,46,155,15,19,94,97,234,135,166,73,18,224,154,45,1,156,205,167,199,230,195,132,7,254,221,146,0,241,31,1,3,3,35,87,249,184,129,14,109,0,103,243,233,178,121,147,
+187,239,190,207,135,99,153,250,161,105,236,4,232,239,31,94,231,133,130,14,189,0,103,243,233,178,121,83,120,5,215,109,234,135,166,73,18,96,213,60,0,227,0,206,230,211,99,243,54,225,21,196,200,146,0,241,
+7,130,250,250,134,150,153,254,165,195,72,160,179,249,7,82,87,219,109,80,73,77,253,208,52,73,2,228,205,3,240,46,192,217,124,122,133,191,235,174,123,175,195,196,29,75,2,196,127,25,212,219,59,184,192,
+242,47,29,94,49,58,155,79,143,205,219,132,87,240,37,22,83,63,52,141,157,0,123,247,14,228,216,247,71,135,21,168,206,230,211,99,243,54,225,21,84,86,83,63,52,77,146,0,89,243,0,108,5,227,108,62,61,54,111,
+99,203,150,173,62,172,16,178,36,64,252,41,97,123,246,244,119,240,89,51,19,211,250,157,205,55,206,230,109,194,3,191,111,211,14,77,19,205,12,150,63,88,51,15,66,87,208,217,124,58,108,222,20,94,65,124,45,
+226,175,37,94,23,176,123,119,95,129,137,160,58,244,4,156,205,167,167,182,219,160,146,154,186,161,101,226,4,216,181,171,119,138,77,7,116,158,124,242,109,206,230,83,42,252,157,119,222,227,195,199,40,77,
+221,208,178,146,4,232,50,15,212,211,179,215,217,124,10,108,222,38,188,130,189,155,44,9,80,217,151,69,68,240,34,162,235,48,200,224,108,190,177,181,221,38,60,16,127,83,47,52,172,120,127,0,249,227,188,
+121,64,214,7,58,155,111,172,205,135,193,112,189,37,1,42,223,32,66,236,164,23,75,209,161,143,233,108,190,177,54,111,114,199,29,119,251,240,121,62,83,47,52,220,72,2,108,18,74,230,65,121,53,236,108,190,
+49,54,111,19,30,136,187,69,124,180,171,124,147,40,202,211,79,239,190,204,40,160,14,31,75,112,54,223,152,218,110,10,175,96,53,144,169,19,218,109,120,159,192,157,59,119,245,176,216,208,132,158,128,179,
+249,250,219,188,13,142,111,211,8,237,170,178,91,168,28,168,104,30,156,6,135,179,249,250,218,188,141,219,111,191,203,159,174,103,17,191,58,91,197,82,164,225,183,72,227,79,135,65,33,103,243,245,181,121,
+83,120,5,123,21,155,250,160,89,53,19,160,211,114,2,127,76,192,217,124,125,108,222,20,93,161,190,36,102,161,186,31,144,218,177,227,237,5,246,8,208,97,201,184,179,249,173,13,17,94,193,208,175,169,11,90,
+85,253,139,33,210,199,204,210,207,52,193,5,156,205,215,222,230,195,106,191,77,19,180,170,201,119,131,228,192,75,230,201,120,254,56,155,175,79,109,87,116,118,110,241,255,203,204,31,139,248,181,249,104,
+20,229,169,167,118,102,153,26,102,194,135,35,156,205,215,86,120,68,215,161,229,111,211,2,141,106,250,237,64,57,65,222,118,98,198,5,156,205,215,94,120,224,222,66,196,175,237,135,35,41,210,253,235,164,
+11,104,178,109,219,118,103,243,85,182,249,48,24,131,177,105,128,54,117,249,126,176,60,247,231,121,246,155,240,142,192,217,124,117,107,187,206,109,183,221,233,55,252,108,177,71,147,186,126,65,92,78,
+184,106,187,16,30,5,206,230,171,47,60,112,191,33,226,215,247,243,241,148,199,31,127,107,55,227,0,38,204,27,116,54,191,113,155,215,133,87,176,224,195,22,115,180,200,52,162,200,137,47,217,46,136,94,129,
+179,249,234,136,174,96,111,198,16,241,47,101,26,89,164,47,186,66,127,212,132,110,138,179,249,141,11,15,60,86,109,49,38,246,153,70,151,237,219,159,236,18,74,12,73,154,176,144,196,217,124,229,194,3,3,
+108,182,216,6,49,239,202,164,161,200,133,228,66,46,210,207,94,103,243,201,68,135,91,111,189,195,119,208,176,184,18,243,76,154,74,119,247,19,139,204,20,50,97,18,41,19,71,156,205,111,137,37,186,130,152,
+16,59,91,76,137,117,38,141,69,46,172,96,187,96,122,6,182,36,112,54,127,179,240,74,124,98,22,34,126,33,147,230,34,89,187,76,230,154,232,73,224,108,222,46,60,240,152,36,86,182,24,18,219,76,218,139,92,
+124,135,176,194,77,216,160,77,224,108,222,14,131,103,97,113,11,98,218,145,105,134,34,23,186,89,184,18,118,51,244,14,218,221,230,77,112,199,8,241,137,229,230,76,51,149,109,219,182,111,22,86,120,73,100,
+131,113,130,118,181,121,157,91,110,185,221,175,16,97,113,10,98,216,92,226,107,73,208,33,44,135,221,28,35,134,216,94,59,217,188,18,29,184,31,102,84,69,136,79,236,58,50,205,94,30,125,180,187,192,56,118,
+24,180,11,218,193,230,149,240,192,0,79,84,76,136,89,166,149,138,220,208,98,212,13,243,42,153,129,143,86,181,121,5,215,204,227,175,140,248,139,153,86,44,143,60,242,88,78,40,177,140,41,12,222,119,55,
+131,240,73,68,7,213,208,139,186,247,32,54,185,76,43,151,135,31,126,75,151,176,194,172,150,48,104,27,176,222,160,217,109,94,65,59,135,173,91,162,238,57,136,73,87,166,93,138,220,236,165,50,1,185,62,229,
+188,217,108,94,161,190,224,85,238,62,137,69,166,29,203,67,15,109,235,22,86,5,47,10,18,1,251,228,209,144,102,155,7,254,142,185,145,8,95,238,190,130,123,239,206,180,123,145,32,204,199,8,150,15,109,4,
+134,75,211,38,60,93,88,122,51,113,239,131,123,206,184,242,183,34,207,253,78,33,207,243,63,14,212,48,118,41,81,201,208,8,155,71,116,156,137,107,137,123,221,193,61,118,58,197,67,138,52,150,178,194,18,
+141,166,184,240,136,96,52,141,246,2,67,203,122,66,84,75,116,126,230,17,68,131,14,23,226,156,73,174,49,184,167,172,83,56,89,34,20,18,6,249,58,244,181,177,100,122,19,52,198,72,12,213,134,80,137,161,68,
+230,103,181,220,138,222,6,53,27,103,33,161,56,6,223,75,170,244,58,130,123,112,194,87,90,164,166,117,10,139,66,145,90,215,36,20,131,107,118,86,95,229,100,232,17,46,11,165,20,138,94,10,174,173,199,41,
+85,227,34,141,174,77,66,175,144,23,138,52,194,26,68,49,184,6,174,101,147,83,166,65,37,155,125,115,151,48,37,20,132,53,230,208,215,136,181,224,28,156,171,203,69,62,189,9,209,33,100,133,156,176,32,228,
+133,101,97,85,88,23,174,10,215,132,82,192,181,224,255,173,7,191,179,28,252,205,66,112,12,142,213,225,34,235,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,
+146,154,50,63,191,208,33,100,133,156,176,32,228,133,101,97,85,88,23,174,10,215,132,82,192,181,224,255,173,7,191,179,28,252,205,66,112,12,142,229,134,130,83,44,120,151,48,37,20,132,53,193,171,17,107,
+193,57,56,151,123,25,212,168,114,241,226,115,155,132,94,33,47,20,5,175,65,20,131,107,224,90,220,235,224,90,151,11,23,158,237,17,46,11,37,193,75,25,165,224,218,220,132,144,42,139,222,41,44,10,197,20,
+138,30,70,49,184,102,55,37,172,210,114,254,252,51,89,161,32,120,149,48,51,115,202,27,31,159,242,114,185,3,94,95,223,144,255,29,61,118,212,102,127,61,182,91,97,17,166,90,147,199,207,108,196,192,238,91,
+252,14,159,92,235,237,29,244,70,70,246,123,99,99,147,222,137,19,39,189,74,175,35,184,7,55,41,52,161,240,75,73,130,124,246,236,69,239,200,145,105,111,104,104,212,255,98,22,98,170,149,182,101,22,99,150,
+93,182,165,22,114,112,44,62,199,50,48,48,226,77,76,28,245,207,153,48,17,150,92,34,68,148,115,231,230,59,133,188,224,197,97,110,238,140,183,127,255,97,191,102,155,203,171,55,42,186,46,124,20,124,156,
+105,116,244,160,55,59,123,218,139,123,221,193,61,186,71,131,94,164,54,205,83,163,226,112,232,208,132,85,244,106,214,246,48,162,86,252,144,12,7,14,140,121,113,239,131,123,118,194,159,189,216,45,172,
+150,11,22,207,243,193,193,156,191,79,94,218,132,7,125,33,8,215,67,155,131,118,67,140,36,224,222,219,115,113,232,153,51,23,46,9,94,20,199,142,205,250,141,177,90,136,94,109,225,109,236,218,213,235,77,
+79,207,120,229,238,147,88,180,147,240,93,194,74,84,64,168,241,212,162,52,214,246,56,194,155,139,70,118,239,238,243,29,161,76,18,16,147,214,30,93,60,125,250,124,78,40,9,94,24,195,195,251,252,29,178,
+210,108,243,113,133,215,225,223,233,65,68,221,123,16,155,214,220,34,230,212,169,115,139,130,23,6,125,118,250,224,205,102,243,229,150,140,153,171,137,104,199,28,62,124,196,139,138,5,177,106,53,241,11,
+81,55,220,223,63,220,244,54,95,78,120,147,61,123,250,203,37,65,243,111,19,119,242,228,217,14,97,89,240,108,76,78,30,243,191,118,217,42,54,31,71,120,125,169,25,35,143,12,42,133,197,39,136,93,71,179,
+138,191,89,88,9,187,185,125,251,14,181,172,205,151,19,222,132,33,231,136,36,32,134,205,181,85,236,220,220,153,205,194,21,70,235,108,96,249,237,96,243,229,22,155,178,137,133,130,158,66,88,188,130,88,
+110,110,22,241,59,132,149,176,155,161,111,220,78,54,175,232,239,31,146,174,222,121,113,190,131,55,8,175,195,187,134,136,36,32,166,233,127,28,204,206,158,94,102,108,220,132,126,48,47,106,218,209,230,
+63,252,225,143,120,175,191,254,250,117,254,241,31,191,96,77,0,182,162,225,83,112,196,202,22,67,98,155,106,241,103,102,78,21,24,196,49,57,126,124,206,111,236,181,163,205,159,60,121,230,6,241,21,103,
+206,156,187,65,120,29,186,138,140,130,218,98,73,140,211,42,254,98,92,241,91,213,230,205,231,59,243,10,254,248,199,63,90,19,224,31,254,225,83,55,9,111,38,1,177,11,73,130,116,141,19,136,101,229,176,45,
+27,188,37,107,151,214,188,217,176,251,151,127,89,182,138,15,139,139,239,177,10,255,224,131,111,186,14,147,87,194,226,74,204,211,34,126,151,80,178,93,36,175,109,219,173,53,175,248,240,135,95,12,21,255,
+202,149,95,250,215,21,38,188,14,163,163,33,9,64,204,27,255,238,64,108,106,5,171,50,217,187,119,160,45,108,222,198,244,244,137,80,241,225,192,129,195,145,162,235,176,1,38,21,201,22,99,98,223,80,241,
+165,161,114,137,198,138,9,47,116,218,197,230,77,248,156,251,171,175,190,26,42,254,187,223,253,222,88,162,155,48,118,98,139,53,26,52,74,252,110,219,5,49,99,167,93,108,222,214,141,251,218,215,190,30,42,
+254,210,210,87,18,11,175,195,140,163,144,36,168,255,164,146,233,233,153,85,38,59,152,80,3,218,193,230,109,93,184,247,189,239,253,161,226,255,230,55,191,241,30,123,236,239,42,18,158,189,137,129,198,
+180,45,230,104,81,111,241,231,109,23,194,112,102,59,216,188,173,239,62,54,118,36,242,185,63,49,49,85,145,232,38,244,170,66,146,160,62,115,12,143,30,61,209,41,120,38,204,142,109,23,155,55,217,182,173,
+219,91,93,253,117,168,248,31,248,192,7,55,44,188,130,205,171,105,99,217,52,64,155,154,39,192,212,212,241,188,224,153,208,103,109,7,155,183,241,242,203,95,10,21,255,149,87,190,81,53,225,21,196,213,166,
+1,218,212,90,252,172,237,196,116,249,218,193,230,109,131,54,207,63,255,174,80,241,127,255,251,223,123,79,62,185,163,98,209,77,225,117,232,26,134,36,65,237,22,159,76,78,30,91,98,18,135,14,211,155,212,
+115,191,149,109,222,54,104,147,203,237,143,124,238,31,59,54,179,225,218,110,131,47,165,240,123,244,184,76,61,208,168,86,226,103,45,39,243,199,187,219,193,230,205,150,59,231,252,197,47,254,45,84,252,
+23,95,252,104,77,132,215,161,199,101,211,4,173,170,158,0,71,142,76,23,88,127,167,67,191,180,29,108,222,198,231,63,95,8,21,255,59,223,249,110,85,108,62,76,120,29,102,86,153,186,160,85,85,197,159,152,
+56,218,201,220,53,19,222,239,183,186,205,219,152,159,127,54,84,252,255,250,175,117,223,21,107,41,186,130,15,86,209,248,182,105,131,102,213,76,128,69,243,4,102,237,111,69,155,183,209,215,55,24,249,220,
+63,117,234,76,77,133,71,116,19,22,201,90,18,160,122,175,140,199,199,167,138,204,219,215,161,21,218,234,54,111,235,187,255,232,71,63,14,21,255,165,151,62,89,87,225,21,188,49,52,245,65,179,106,137,223,
+99,57,184,63,44,217,202,54,111,235,187,51,137,35,76,252,31,254,240,71,53,179,249,40,248,42,26,215,102,211,8,237,54,156,0,99,99,147,151,217,37,67,135,5,155,173,108,243,182,174,219,233,211,103,67,197,
+255,235,95,255,234,143,133,212,163,182,235,194,235,48,217,214,212,9,237,54,36,190,244,241,55,9,37,250,250,58,76,92,108,101,155,55,121,251,219,119,123,235,235,235,161,9,112,225,194,51,117,17,222,20,93,
+135,177,24,83,167,64,187,77,27,73,128,94,243,160,116,59,90,217,230,109,125,119,186,117,97,226,127,246,179,159,175,139,205,71,193,7,46,129,247,49,150,36,232,173,56,1,14,29,154,200,51,218,164,195,27,
+191,86,181,121,219,160,13,3,58,97,226,255,252,231,191,144,243,189,169,110,54,31,38,188,130,55,133,166,94,104,184,145,4,40,154,7,164,223,217,138,54,111,27,180,97,40,55,170,203,55,60,60,90,87,155,183,
+137,174,195,112,188,37,1,42,235,13,28,60,56,222,37,120,58,244,253,91,213,230,77,232,226,242,50,39,76,252,119,188,227,249,134,216,124,24,247,223,255,128,15,99,2,166,110,104,89,73,2,76,153,7,98,215,142,
+86,180,121,27,51,51,115,161,226,95,190,252,114,195,108,62,76,120,5,143,104,75,2,76,37,78,0,169,237,5,106,188,14,107,215,90,205,230,195,6,109,194,236,255,87,191,90,21,119,120,164,161,181,221,38,188,
+130,71,180,169,27,90,38,78,0,177,146,53,236,68,135,29,54,91,201,230,163,6,109,56,231,191,255,251,111,172,83,186,27,109,243,97,220,119,223,27,125,61,76,221,208,50,169,248,29,150,131,220,100,253,205,
+110,243,229,250,238,123,247,246,123,223,252,230,183,252,49,128,159,253,108,197,59,126,124,54,21,54,111,19,94,193,239,219,180,67,211,216,9,32,125,253,44,253,125,29,246,233,107,53,155,111,212,160,205,
+70,109,222,38,188,14,107,8,76,253,208,52,73,2,228,204,3,208,184,104,53,155,111,228,160,77,181,69,215,225,53,189,37,1,226,175,37,28,29,61,184,192,168,146,14,13,192,86,180,249,180,182,230,147,10,127,
+239,189,93,215,161,33,104,234,135,166,177,19,32,151,59,144,103,155,117,29,198,255,157,205,167,199,230,109,194,43,120,83,107,234,135,166,73,18,96,217,60,0,91,176,59,155,79,143,205,219,132,87,208,78,
+179,36,64,252,221,69,70,70,246,175,178,115,149,14,111,155,156,205,167,199,230,109,108,221,250,6,31,226,101,234,135,166,73,18,96,221,60,0,111,255,156,205,167,199,230,109,194,43,184,110,75,2,172,199,78,
+128,225,225,125,87,89,126,164,131,173,56,155,79,143,205,219,132,87,112,124,83,63,52,141,157,0,67,67,163,215,248,252,138,78,57,225,157,205,55,166,182,135,97,234,135,166,73,18,160,100,30,192,217,124,
+186,133,191,231,158,251,111,192,146,0,165,216,9,48,56,152,43,49,242,167,227,108,62,93,54,31,38,188,194,212,15,77,147,36,192,53,91,2,56,155,79,143,205,135,9,15,252,187,37,1,226,63,2,6,6,70,174,242,113,
+3,29,218,0,206,230,211,101,243,38,119,223,125,159,15,199,50,245,67,211,216,9,208,223,63,188,206,11,5,29,122,1,206,230,211,101,243,166,240,10,174,219,212,15,77,147,36,192,170,121,0,198,1,156,205,167,
+199,230,109,194,43,136,145,37,1,226,15,4,245,245,13,45,51,253,75,135,145,64,103,243,15,164,174,182,219,248,159,53,140,67,38,203,73,18,32,111,30,128,119,1,206,230,211,43,252,93,119,221,123,29,38,238,
+88,18,32,254,203,160,222,222,193,5,150,127,233,240,138,209,217,124,122,108,222,38,188,130,47,177,152,250,161,105,236,4,216,187,119,32,199,90,55,29,86,160,58,155,79,143,205,219,132,87,80,89,77,253,208,
+52,73,2,100,205,3,68,109,122,224,108,190,254,54,111,99,203,150,173,62,172,16,178,36,64,252,41,97,123,246,244,119,240,89,51,19,211,250,157,205,55,206,230,109,194,3,191,111,211,14,77,19,205,12,150,63,
+88,51,15,66,87,208,217,124,58,108,222,20,94,65,124,45,226,175,37,94,23,176,123,119,95,129,137,160,58,244,4,156,205,167,167,182,219,160,146,154,186,161,101,226,4,216,181,171,119,138,77,7,116,158,124,
+242,109,206,230,83,42,252,157,119,222,227,195,199,40,77,221,208,178,146,4,232,50,15,212,211,179,215,217,124,10,108,222,38,188,130,189,155,44,9,80,217,151,69,68,240,34,162,235,48,200,224,108,190,177,
+181,221,38,60,16,127,83,47,52,172,120,127,0,249,227,188,121,64,214,7,58,155,111,172,205,135,193,112,189,37,1,42,223,32,66,236,164,23,75,209,161,143,233,108,190,177,54,111,114,199,29,119,251,240,121,
+62,83,47,52,220,72,2,108,18,74,230,65,121,53,236,108,190,49,54,111,19,30,136,187,69,124,180,171,124,147,40,202,211,79,239,190,204,40,160,14,31,53,116,54,223,152,218,110,10,175,96,53,144,169,19,218,
+109,120,159,192,157,59,119,245,176,216,208,132,158,128,179,249,250,219,188,13,142,111,211,8,237,170,178,91,168,28,168,104,30,156,6,135,179,249,250,218,188,141,219,111,191,203,159,174,103,17,191,58,91,
+197,82,164,225,183,72,227,79,135,65,33,103,243,245,181,121,83,120,5,223,13,48,245,65,179,106,38,64,167,229,4,254,152,128,179,249,250,216,188,41,186,66,125,73,204,66,117,63,32,181,99,199,219,11,236,17,
+160,195,146,113,103,243,91,27,34,188,130,161,95,83,23,180,170,250,23,67,164,143,153,165,159,105,130,11,56,155,175,189,205,135,213,126,155,38,104,85,147,239,6,201,129,151,204,147,241,252,113,54,95,159,
+218,174,232,236,220,226,255,151,153,63,22,241,107,243,209,40,202,83,79,237,204,50,53,204,132,93,53,157,205,215,86,120,68,215,161,229,111,211,2,141,106,250,237,64,57,65,222,118,98,198,5,156,205,215,94,
+120,224,222,66,196,175,237,135,35,41,210,253,235,164,11,104,178,109,219,118,103,243,85,182,249,48,24,131,177,105,128,54,117,249,126,176,60,247,231,121,246,155,240,142,192,217,124,117,107,187,206,109,
+183,221,233,55,252,108,177,71,147,186,126,65,92,78,184,106,187,16,30,5,206,230,171,47,60,112,191,33,226,215,247,243,241,148,199,31,127,107,55,227,0,38,204,27,116,54,191,113,155,215,133,87,176,224,195,
+22,115,180,200,52,162,200,137,47,217,46,136,94,129,179,249,234,136,174,96,111,198,16,241,47,101,26,89,164,47,186,66,127,212,132,110,138,179,249,141,11,15,60,86,109,49,38,246,153,70,151,237,219,159,
+236,18,74,12,73,154,176,144,196,217,124,229,194,3,3,108,182,216,6,49,239,202,164,161,200,133,228,66,46,210,207,94,103,243,201,68,135,91,111,189,195,119,208,176,184,18,243,76,154,74,119,247,19,139,204,
+20,50,97,18,41,19,71,156,205,111,137,37,186,130,152,16,59,91,76,137,117,38,141,69,46,172,96,187,96,122,6,182,36,112,54,127,179,240,74,124,98,22,34,126,33,147,230,34,89,187,76,230,154,232,73,224,108,
+222,46,60,240,152,36,86,182,24,18,219,76,218,139,92,124,135,176,194,77,216,160,77,224,108,222,14,131,103,97,113,11,98,218,145,105,134,34,23,186,89,184,18,118,51,244,14,218,221,230,77,112,199,8,241,
+137,229,230,76,51,149,109,219,182,111,22,86,120,73,100,131,113,130,118,181,121,157,91,110,185,221,175,16,97,113,10,98,216,92,226,107,73,208,33,44,135,221,28,35,134,216,94,59,217,188,18,29,184,31,102,
+84,69,136,79,236,58,50,205,94,30,125,180,187,192,56,118,24,180,11,218,193,230,149,240,192,0,79,84,76,136,89,166,149,138,220,208,98,212,13,243,42,153,129,143,86,181,121,5,215,204,227,175,140,248,139,
+153,86,44,143,60,242,88,78,40,177,140,41,12,222,119,55,131,240,73,68,7,213,208,139,186,247,32,54,185,76,43,151,135,31,126,75,151,176,194,172,150,48,104,27,176,222,160,217,109,94,65,59,135,173,91,162,
+238,57,136,73,87,166,93,138,220,236,165,50,1,185,62,229,188,217,108,94,161,190,224,85,238,62,137,69,166,29,203,67,15,109,235,22,86,5,47,10,18,1,251,228,209,144,102,155,7,254,142,185,145,8,95,238,190,
+130,123,239,206,180,123,145,32,204,199,8,150,15,109,4,134,75,211,38,60,93,88,122,51,113,239,131,123,206,184,242,183,34,207,253,78,33,207,243,63,14,212,48,118,41,81,201,208,8,155,71,116,156,137,107,
+137,123,221,193,61,118,58,197,67,138,52,150,178,194,18,141,166,184,240,136,96,52,141,246,2,67,203,122,66,84,75,116,126,230,17,68,131,14,23,226,156,73,174,49,184,167,172,83,56,89,34,20,18,6,249,58,244,
+181,177,100,122,19,52,198,72,12,213,134,80,137,161,68,230,103,181,220,138,222,6,53,27,103,33,161,56,6,223,75,170,244,58,130,123,112,194,87,90,164,166,117,10,139,66,145,90,215,36,20,131,107,118,86,95,
+229,100,232,17,46,11,165,20,138,94,10,174,173,199,41,85,227,34,141,174,77,66,175,144,23,138,52,194,26,68,49,184,6,174,101,147,83,166,65,37,155,125,115,151,48,37,20,132,53,230,208,215,136,181,224,28,
+156,171,203,69,62,189,9,209,33,100,133,156,176,32,228,133,101,97,85,88,23,174,10,215,132,82,192,181,224,255,173,7,191,179,28,252,205,66,112,12,142,213,225,34,235,138,43,174,184,226,138,43,174,184,226,
+138,43,174,184,226,138,43,174,184,226,138,43,174,184,146,154,50,63,191,208,33,100,133,156,176,32,228,133,101,97,85,88,23,174,10,215,132,82,192,181,224,255,173,7,191,179,28,252,205,66,112,12,142,229,
+134,130,83,44,120,151,48,37,20,132,53,193,171,17,107,193,57,56,151,123,25,212,168,114,241,226,115,155,132,94,33,47,20,5,175,65,20,131,107,224,90,220,235,224,90,151,11,23,158,237,17,46,11,37,193,75,25,
+165,224,218,220,132,144,42,139,222,41,44,10,197,20,138,30,70,49,184,102,55,37,172,210,114,254,252,51,89,161,32,120,149,48,51,115,202,27,31,159,242,114,185,3,94,95,223,144,255,29,61,118,212,102,127,61,
+182,91,97,17,166,90,147,199,207,108,196,192,238,91,252,14,159,92,235,237,29,244,70,70,246,123,99,99,147,222,137,19,39,189,74,175,35,184,7,55,41,52,161,240,75,73,130,124,246,236,69,239,200,145,105,111,
+104,104,212,255,98,22,98,170,149,182,101,22,99,150,93,182,165,22,114,112,44,62,199,50,48,48,226,77,76,28,245,207,153,48,17,150,92,34,68,148,115,231,230,59,133,188,224,197,97,110,238,140,183,127,255,
+97,191,102,155,203,171,55,42,186,46,124,20,124,156,105,116,244,160,55,59,123,218,139,123,221,193,61,186,71,131,94,164,54,205,83,163,226,112,232,208,132,85,244,106,214,246,48,162,86,252,144,12,7,14,
+140,121,113,239,131,123,118,194,159,189,216,45,172,150,11,22,207,243,193,193,156,191,79,94,218,132,7,125,33,8,215,67,155,131,118,67,140,36,224,222,219,115,113,232,153,51,23,46,9,94,20,199,142,205,250,
+141,177,90,136,94,109,225,109,236,218,213,235,77,79,207,120,229,238,147,88,180,147,240,93,194,74,84,64,168,241,212,162,52,214,246,56,194,155,139,70,118,239,238,243,29,161,76,18,16,147,214,30,93,60,
+125,250,124,78,40,9,94,24,195,195,251,252,29,178,210,108,243,113,133,215,225,223,233,65,68,221,123,16,155,214,220,34,230,212,169,115,139,130,23,6,125,118,250,224,205,102,243,229,150,140,153,171,137,
+104,199,28,62,124,196,139,138,5,177,106,53,241,11,81,55,220,223,63,220,244,54,95,78,120,147,61,123,250,203,37,65,243,111,19,119,242,228,217,14,97,89,240,108,76,78,30,243,191,118,217,42,54,31,71,120,
+125,169,25,35,143,12,42,133,197,39,136,93,71,179,138,191,89,88,9,187,185,125,251,14,181,172,205,151,19,222,132,33,231,136,36,32,134,205,181,85,236,220,220,153,205,194,21,70,235,108,96,249,237,96,243,
+229,22,155,178,137,133,130,158,66,88,188,130,88,110,110,22,241,59,132,149,176,155,161,111,220,78,54,95,78,120,29,222,53,68,36,1,49,77,255,227,96,118,246,244,50,99,227,38,244,131,121,81,211,174,54,31,
+37,188,130,173,104,248,20,28,177,178,197,144,216,166,90,252,153,153,83,5,6,113,76,142,31,159,243,27,123,237,110,243,10,190,243,59,48,48,124,131,240,58,116,21,25,5,181,197,146,24,167,85,252,197,184,
+226,183,179,205,127,234,83,121,239,245,215,95,247,249,221,239,94,245,166,167,143,223,148,0,42,9,136,93,72,18,164,107,156,64,44,43,135,109,217,224,45,153,179,249,255,225,35,31,249,216,117,241,21,127,
+248,195,31,252,107,87,194,63,248,224,155,174,195,228,149,176,184,18,243,180,136,223,37,148,108,23,201,107,219,118,181,121,147,119,188,227,249,155,196,87,140,143,79,222,32,188,14,163,163,33,9,64,204,
+27,255,238,64,108,106,5,171,50,217,187,119,160,109,109,222,124,182,31,63,62,27,42,62,12,13,229,66,19,128,13,48,169,72,182,24,19,251,134,138,47,13,149,75,52,86,76,120,161,211,238,173,121,197,240,240,
+168,247,151,191,252,37,84,252,87,94,249,166,85,116,19,198,78,108,177,70,131,70,137,223,109,187,32,102,236,180,171,205,155,13,185,167,158,122,155,247,235,95,255,58,84,252,159,255,252,23,254,104,104,
+148,240,58,204,56,10,73,130,250,79,42,153,158,158,89,101,178,131,201,19,79,236,104,75,155,55,225,223,190,255,253,31,132,138,255,218,107,175,121,187,119,247,198,18,158,189,137,129,198,180,45,230,104,
+81,111,241,231,109,23,194,112,102,59,218,188,141,47,126,241,75,145,207,253,195,135,39,98,137,110,66,175,42,36,9,234,51,199,240,232,209,19,157,130,103,194,236,216,118,180,121,19,106,244,199,62,246,137,
+72,241,207,158,61,159,88,120,5,155,87,211,198,178,105,128,54,53,79,128,169,169,227,121,193,51,161,207,218,110,54,111,235,187,63,255,252,187,34,197,127,223,251,222,95,177,240,10,226,106,211,0,109,106,
+45,126,214,118,98,186,124,237,104,243,102,235,125,102,230,100,164,248,159,254,116,62,145,232,166,240,58,116,13,67,146,160,118,139,79,38,39,143,45,49,137,67,135,233,77,234,185,223,78,54,111,50,58,122,
+192,251,235,95,255,26,42,254,215,190,246,245,138,106,187,13,190,148,194,239,209,227,50,245,64,163,90,137,159,181,156,204,95,71,215,110,54,111,178,99,199,211,222,111,127,251,219,80,241,127,250,211,159,
+250,113,168,134,240,58,244,184,108,154,160,85,213,19,224,200,145,233,2,235,239,116,232,151,182,155,205,155,112,142,31,254,240,71,161,226,191,250,234,127,122,59,119,246,84,85,120,29,102,86,153,186,160,
+85,85,197,159,152,56,218,201,220,53,19,222,239,183,147,205,219,70,235,190,252,229,175,68,62,247,247,239,63,84,117,209,21,124,176,138,198,183,77,27,52,171,102,2,44,154,39,48,107,127,171,219,188,109,
+180,238,165,151,62,25,41,254,201,147,103,170,46,60,162,155,176,72,214,146,0,213,123,101,60,62,62,85,100,222,190,14,173,208,118,177,121,91,183,237,221,239,126,111,164,248,252,123,173,133,87,240,198,
+208,212,7,205,170,37,126,143,229,224,254,176,100,187,216,188,9,53,59,74,124,156,161,154,54,31,5,95,69,227,154,108,26,161,221,134,19,96,108,108,242,50,187,100,232,176,96,179,93,108,222,132,103,122,148,
+248,180,9,106,89,219,117,225,117,152,108,107,234,132,118,27,18,95,250,248,155,132,18,125,125,29,38,46,182,131,205,155,131,54,140,195,191,250,234,171,161,226,211,27,80,223,43,172,133,240,166,232,58,
+140,197,152,58,5,218,109,218,72,2,244,154,7,165,219,209,14,54,111,14,218,112,63,63,249,201,79,67,197,103,28,128,215,191,181,178,249,40,248,192,37,240,62,198,146,4,189,21,39,192,161,67,19,121,70,155,
+116,120,227,215,234,54,111,27,173,251,234,87,191,22,42,62,35,128,35,35,251,106,110,243,97,194,43,112,40,83,47,52,220,72,2,20,205,3,210,239,108,101,155,183,241,169,79,125,58,242,185,127,226,196,92,93,
+108,222,38,186,14,195,241,150,4,168,172,55,112,240,224,120,151,224,233,208,247,111,101,155,183,113,233,210,223,71,138,255,206,119,46,214,213,230,195,184,255,254,7,124,24,19,48,117,67,203,74,18,96,202,
+60,16,187,118,180,178,205,155,240,150,51,74,252,143,126,244,227,117,183,249,48,225,21,60,162,45,9,48,149,56,1,164,182,23,168,241,58,172,93,107,85,155,183,13,218,60,243,204,66,168,248,47,191,252,165,
+134,213,118,155,240,10,30,209,166,110,104,153,56,1,196,74,214,176,19,29,118,216,108,69,155,15,27,180,57,118,108,198,42,254,247,190,247,125,235,243,190,222,181,221,228,190,251,222,232,235,97,234,134,
+150,73,197,239,176,28,228,38,235,111,5,155,47,55,104,99,78,236,92,93,253,181,212,178,39,27,106,243,54,225,21,252,190,77,59,52,141,157,0,210,215,207,210,223,215,97,159,190,86,180,249,114,131,54,92,239,
+7,63,248,130,247,141,111,124,211,251,248,199,95,242,119,245,104,180,205,219,132,215,97,13,129,169,31,154,38,73,128,156,121,0,26,23,173,104,243,141,26,180,169,182,232,58,188,166,183,36,64,252,181,132,
+163,163,7,23,24,85,210,161,1,216,170,54,223,136,65,155,106,11,127,239,189,93,215,161,33,104,234,135,166,177,19,32,151,59,144,103,155,117,29,198,255,91,213,230,211,216,154,175,68,120,5,111,106,77,253,
+208,52,73,2,44,155,7,96,11,118,103,243,233,177,121,155,240,10,218,105,150,4,136,191,187,200,200,200,254,85,118,174,210,225,109,147,179,249,244,216,188,141,173,91,223,224,67,188,76,253,208,52,73,2,172,
+155,7,224,237,159,179,249,244,216,188,77,120,5,215,109,73,128,245,216,9,48,60,188,239,42,203,143,116,176,21,103,243,233,177,121,155,240,10,142,111,234,135,166,177,19,96,104,104,244,26,159,95,209,41,
+39,188,179,249,198,212,246,48,76,253,208,52,73,2,148,204,3,56,155,79,183,240,247,220,115,255,13,88,18,160,20,59,1,6,7,115,37,70,254,116,156,205,167,203,230,195,132,87,152,250,161,105,146,4,184,102,75,
+0,103,243,233,177,249,48,225,129,127,183,36,64,252,71,192,192,192,200,85,62,110,160,67,27,192,217,124,186,108,222,228,238,187,239,243,225,88,166,126,104,26,59,1,250,251,135,215,121,161,160,67,47,192,
+217,124,186,108,222,20,94,193,117,155,250,161,105,146,4,88,53,15,192,56,128,179,249,244,216,188,77,120,5,49,178,36,64,252,129,160,190,190,161,101,166,127,233,48,18,232,108,254,129,212,213,118,27,84,
+82,83,63,52,77,146,0,121,243,0,188,11,112,54,159,94,225,239,186,235,222,235,48,113,199,146,0,241,95,6,245,246,14,46,176,252,75,135,87,140,206,230,211,99,243,54,225,21,236,61,104,234,135,166,177,19,96,
+239,222,129,28,51,98,117,88,129,234,108,62,61,54,111,19,94,65,101,53,245,67,211,36,9,144,53,15,192,86,48,206,230,211,99,243,54,182,108,217,234,195,10,33,75,2,196,159,18,182,103,79,127,7,159,53,51,49,
+173,223,217,124,227,108,222,38,60,240,251,54,237,208,52,209,204,96,249,131,53,243,32,116,5,157,205,167,195,230,77,225,21,196,215,34,254,90,226,117,1,187,119,247,21,152,8,170,67,79,192,217,124,122,106,
+187,13,42,169,169,27,90,38,78,128,93,187,122,167,216,116,64,135,111,221,56,155,79,167,240,119,222,121,143,15,211,214,77,221,208,178,146,4,232,50,15,212,211,179,215,217,124,10,108,222,38,188,130,189,
+155,44,9,80,217,151,69,68,240,34,162,235,48,200,224,108,190,177,181,221,38,60,16,127,83,47,52,172,120,127,0,249,227,188,121,64,214,7,58,155,111,172,205,135,193,112,189,37,1,42,223,32,66,236,164,23,75,
+209,161,143,233,108,190,177,54,111,114,199,29,119,251,240,121,62,83,47,52,220,72,2,108,18,74,230,65,121,53,236,108,190,49,54,111,19,30,136,187,69,124,180,171,124,147,40,202,211,79,239,190,204,40,160,
+14,31,53,116,54,223,152,218,110,10,175,96,53,144,169,19,218,109,120,159,192,157,59,119,245,176,216,208,132,158,128,179,249,250,219,188,13,142,111,211,8,237,170,178,91,168,28,168,104,30,156,6,135,179,
+249,250,218,188,141,219,111,191,203,159,174,103,17,191,58,91,197,82,164,225,183,72,227,79,135,65,33,103,243,245,181,121,83,120,5,223,13,48,245,65,179,106,38,64,167,229,4,254,152,128,179,249,250,216,
+188,41,186,66,237,96,106,161,186,31,144,218,177,227,237,5,246,8,208,97,201,184,179,249,173,13,17,94,193,208,175,169,11,90,85,253,139,33,210,199,204,210,207,52,193,5,156,205,215,222,230,195,106,191,77,
+19,180,170,201,119,131,228,192,75,230,201,120,254,56,155,175,79,109,87,116,118,110,241,255,203,204,31,139,248,181,249,104,20,229,169,167,118,102,153,26,102,194,135,35,156,205,215,86,120,68,215,161,
+229,111,211,2,141,106,250,237,64,57,65,222,118,98,198,5,156,205,215,94,120,224,222,66,196,175,237,135,35,41,210,253,235,164,11,104,178,109,219,118,103,243,85,182,249,48,24,131,177,105,128,54,117,249,
+126,176,60,247,231,121,246,155,240,142,192,217,124,117,107,187,206,109,183,221,233,55,252,108,177,71,147,186,126,65,92,78,184,106,187,16,30,5,206,230,171,47,60,112,191,33,226,215,247,243,241,148,199,
+31,127,107,55,227,0,38,204,27,116,54,191,113,155,215,133,87,176,224,195,22,115,180,200,52,162,200,137,47,217,46,136,94,129,179,249,234,136,174,96,111,198,16,241,47,101,26,89,164,47,186,66,127,212,132,
+110,138,179,249,141,11,15,60,86,109,49,38,246,153,70,151,237,219,159,236,18,74,12,73,154,176,144,196,217,124,229,194,3,3,108,182,216,6,49,239,202,164,161,200,133,228,66,46,210,207,94,103,243,201,68,
+135,91,111,189,195,119,208,176,184,18,243,76,154,74,119,247,19,139,204,20,50,97,18,41,19,71,156,205,111,137,37,186,130,152,16,59,91,76,137,117,38,141,69,46,172,96,187,96,122,6,182,36,112,54,127,179,
+240,74,124,98,22,34,126,33,147,230,34,89,187,76,230,154,232,73,224,108,222,46,60,240,152,36,86,182,24,18,219,76,218,139,92,124,135,176,194,77,216,160,77,224,108,222,14,131,103,97,113,11,98,218,145,
+105,134,34,23,186,89,184,18,118,51,244,14,218,221,230,77,112,199,8,241,137,229,230,76,51,149,109,219,182,111,22,86,120,73,100,131,113,130,118,181,121,157,91,110,185,221,175,16,97,113,10,98,216,92,226,
+107,73,208,33,44,135,221,28,35,134,216,94,59,217,188,18,29,184,31,102,84,69,136,79,236,58,50,205,94,30,125,180,187,192,56,118,24,180,11,218,193,230,149,240,192,0,79,84,76,136,89,166,149,138,220,208,
+98,212,13,243,42,153,129,143,86,181,121,5,215,204,227,175,140,248,139,153,86,44,143,60,242,88,78,40,177,140,41,12,222,119,55,131,240,73,68,7,213,208,139,186,247,32,54,185,76,43,151,135,31,126,75,151,
+176,194,172,150,48,104,27,176,222,160,217,109,94,65,59,135,173,91,162,238,57,136,73,87,166,93,138,220,236,165,50,1,185,62,229,188,217,108,94,161,190,224,85,238,62,137,69,166,29,203,67,15,109,235,22,
+86,5,47,10,18,1,251,228,209,144,102,155,7,254,142,185,145,8,95,238,190,130,123,239,206,180,123,145,32,204,199,8,150,15,109,4,134,75,211,38,60,93,88,122,51,113,239,131,123,206,184,242,183,34,207,253,
+78,33,207,243,63,14,212,48,118,41,81,201,208,8,155,71,116,156,137,107,137,123,221,193,61,118,58,197,67,138,52,150,178,194,18,141,166,184,240,136,96,52,141,246,2,67,203,122,66,84,75,116,126,230,17,68,
+131,14,23,226,156,73,174,49,184,167,172,83,56,89,34,20,18,6,249,58,244,181,177,100,122,19,52,198,72,12,213,134,80,137,161,68,230,103,181,220,138,222,6,53,27,103,33,161,56,6,223,75,170,244,58,130,123,
+112,194,87,90,164,166,117,10,139,66,145,90,215,36,20,131,107,118,86,95,229,100,232,17,46,11,165,20,138,94,10,174,173,199,41,85,227,34,141,174,77,66,175,144,23,138,52,194,26,68,49,184,6,174,101,147,83,
+166,65,37,155,125,115,151,48,37,20,132,53,230,208,215,136,181,224,28,156,171,203,69,62,189,9,209,33,100,133,156,176,32,228,133,101,97,85,88,23,174,10,215,132,82,192,181,224,255,173,7,191,179,28,252,
+205,66,112,12,142,213,225,34,235,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,146,154,50,63,191,208,33,100,133,156,176,32,228,133,101,97,85,88,23,174,10,
+215,132,82,192,181,224,255,173,7,191,179,28,252,205,66,112,12,142,229,134,130,83,44,120,151,48,37,20,132,53,193,171,17,107,193,57,56,151,123,25,212,168,114,241,226,115,155,132,94,33,47,20,5,175,65,20,
+131,107,224,90,220,235,224,90,151,11,23,158,237,17,46,11,37,193,75,25,165,224,218,220,132,144,42,139,222,41,44,10,197,20,138,30,70,49,184,102,55,37,172,210,114,254,252,51,89,161,32,120,149,48,51,115,
+202,27,31,159,242,114,185,3,94,95,223,144,255,29,61,118,212,102,127,61,182,91,97,17,166,90,147,199,207,108,196,192,238,91,252,14,159,92,235,237,29,244,70,70,246,123,99,99,147,222,137,19,39,189,74,175,
+35,184,7,55,41,52,161,240,75,73,130,124,246,236,69,239,200,145,105,111,104,104,212,255,98,22,98,170,149,182,101,22,99,150,93,182,165,22,114,112,44,62,199,50,48,48,226,77,76,28,245,207,153,48,17,150,
+92,34,68,148,115,231,230,59,133,188,224,197,97,110,238,140,183,127,255,97,191,102,155,203,171,55,42,186,46,124,20,124,156,105,116,244,160,55,59,123,218,139,123,221,193,61,186,71,131,94,164,54,205,83,
+163,226,112,232,208,132,85,244,106,214,246,48,162,86,252,144,12,7,14,140,121,113,239,131,123,118,194,159,189,216,45,172,150,11,22,207,243,193,193,156,191,79,94,218,132,7,125,33,8,215,67,155,131,118,
+67,140,36,224,222,219,115,113,232,153,51,23,46,9,94,20,199,142,205,250,141,177,90,136,94,109,225,109,236,218,213,235,77,79,207,120,229,238,147,88,180,147,240,93,194,74,84,64,168,241,212,162,52,214,
+246,56,194,155,139,70,118,239,238,243,29,161,76,18,16,147,214,30,93,60,125,250,124,78,40,9,94,24,195,195,251,252,29,178,210,108,243,113,133,215,225,223,233,65,68,221,123,16,155,214,220,34,230,212,169,
+115,139,130,23,6,125,118,250,224,205,102,243,229,150,140,153,171,137,104,199,28,62,124,196,139,138,5,177,106,53,241,11,81,55,220,223,63,220,244,54,95,78,120,147,61,123,250,203,37,65,243,111,19,119,
+242,228,217,14,97,89,240,108,76,78,30,243,191,118,217,42,54,31,71,120,125,169,25,35,143,12,42,133,197,39,136,93,71,179,138,191,89,88,9,187,185,125,251,14,181,172,205,151,19,222,132,33,231,136,36,32,
+134,205,181,85,236,220,220,153,205,194,21,70,235,108,96,249,237,96,243,229,22,155,178,137,133,130,158,66,88,188,130,88,110,110,22,241,59,132,149,176,155,161,111,220,78,54,95,78,120,29,222,53,68,36,1,
+49,77,255,227,96,118,246,244,50,99,227,38,244,131,121,81,211,174,54,31,37,188,130,173,104,248,20,28,177,178,197,144,216,166,90,252,153,153,83,5,6,113,76,142,31,159,243,27,123,237,110,243,81,194,235,
+208,85,100,20,212,22,75,98,156,86,241,23,227,138,223,206,54,31,38,186,45,9,136,93,72,18,164,107,156,64,44,43,135,109,217,224,45,153,179,249,248,194,63,248,224,155,174,195,228,149,176,184,18,243,180,
+136,223,37,148,108,23,201,107,91,103,243,225,194,191,240,194,139,222,202,202,207,189,239,126,247,123,222,169,83,103,110,16,95,193,232,104,72,2,16,243,198,191,59,16,155,90,193,170,76,246,238,29,112,54,
+31,81,211,151,150,190,226,189,254,250,235,55,96,75,2,54,192,164,34,217,98,76,236,27,42,190,52,84,46,209,88,49,225,133,142,179,249,40,241,191,124,147,248,128,19,40,209,77,24,59,177,197,26,13,26,37,126,
+183,237,130,152,177,227,108,62,252,249,30,38,62,172,172,172,88,197,87,48,227,40,36,9,234,63,169,100,122,122,102,149,201,14,38,79,60,177,195,217,124,72,163,46,74,124,248,208,135,62,108,21,158,189,137,
+129,198,180,45,230,104,81,111,241,231,109,23,194,112,166,179,249,155,133,143,35,62,255,110,19,221,132,94,85,72,18,212,103,142,225,209,163,39,58,5,207,132,217,177,206,230,255,183,181,37,159,68,252,48,
+225,21,108,94,77,27,203,166,1,218,212,60,1,166,166,142,231,5,207,132,62,171,179,249,202,197,143,35,188,130,184,218,52,64,155,90,139,159,181,157,152,46,159,179,249,228,226,127,233,75,95,78,36,188,14,
+93,195,144,36,168,221,226,147,201,201,99,75,76,226,208,97,122,147,122,238,183,179,205,155,125,247,141,136,31,38,186,130,47,165,240,123,244,184,76,61,208,168,86,226,103,45,39,243,215,209,181,187,205,
+235,194,111,68,252,56,194,235,208,227,178,105,130,86,85,79,128,35,71,166,11,172,191,211,161,95,218,238,54,111,118,217,42,17,63,169,240,58,204,172,50,117,65,171,170,138,63,49,113,180,147,185,107,38,
+188,223,111,103,155,223,136,248,27,17,93,193,7,171,104,124,219,180,65,179,106,38,192,162,121,2,179,246,183,155,205,87,42,254,70,133,71,116,19,22,201,90,18,160,122,175,140,199,199,167,138,204,219,215,
+161,21,218,174,54,111,130,184,229,196,175,133,240,10,222,24,154,250,160,89,181,196,239,177,28,220,31,150,108,71,155,55,71,235,202,139,191,180,97,155,143,130,175,162,113,45,54,141,208,110,195,9,48,54,
+54,121,153,93,50,116,88,176,217,142,54,111,142,214,85,42,254,70,69,87,194,235,48,217,214,212,9,237,54,36,190,244,241,55,9,37,250,250,58,76,92,108,55,155,55,91,238,149,136,95,141,218,30,6,99,49,166,78,
+129,118,155,54,146,0,189,230,65,233,118,180,155,205,111,68,252,106,217,124,20,124,224,18,120,31,99,73,130,222,138,19,224,208,161,137,60,163,77,58,188,241,107,39,155,175,84,252,90,216,124,152,240,10,
+222,20,154,122,161,225,70,18,160,104,30,144,126,103,187,216,124,37,226,215,171,182,219,96,56,222,146,0,149,245,6,14,30,28,239,18,60,29,250,254,237,98,243,230,72,29,226,110,68,252,90,10,15,247,223,255,
+128,15,99,2,166,110,104,89,73,2,76,153,7,98,215,142,118,176,121,115,180,174,82,241,107,97,243,97,194,43,120,68,91,18,96,42,113,2,72,109,47,80,227,117,88,187,214,234,54,111,142,214,157,60,121,58,177,
+248,181,22,221,38,188,130,71,180,169,27,90,38,78,0,177,146,53,236,68,135,29,54,91,217,230,109,188,248,226,71,99,139,95,239,218,110,114,223,125,111,244,245,48,117,67,203,164,226,119,88,14,114,147,245,
+183,146,205,135,113,246,236,133,72,241,27,97,243,54,225,21,252,190,77,59,52,141,157,0,210,215,207,210,223,215,97,159,190,86,181,249,114,163,117,223,250,214,183,111,18,191,145,54,111,19,94,135,53,4,
+166,126,104,154,36,1,114,230,1,104,92,180,170,205,199,25,180,193,9,94,124,241,35,222,236,236,169,212,212,246,48,120,77,111,73,128,248,107,9,71,71,15,46,48,170,164,67,3,176,85,109,190,17,131,54,213,22,
+254,222,123,187,174,67,67,208,212,15,77,99,39,64,46,119,32,207,54,235,58,140,255,183,178,205,55,162,239,94,109,225,21,188,169,53,245,67,211,36,9,176,108,30,128,45,216,91,221,230,211,212,154,175,68,
+120,5,237,52,75,2,196,223,93,100,100,100,255,42,59,87,233,240,182,201,217,124,122,108,222,198,214,173,111,240,33,94,166,126,104,154,36,1,214,205,3,240,246,207,217,124,122,108,222,38,188,130,235,182,
+36,192,122,236,4,24,30,222,119,149,229,71,58,216,138,179,249,244,216,188,77,120,5,199,55,245,67,211,216,9,48,52,52,122,141,207,175,232,148,19,222,217,124,99,106,123,24,166,126,104,154,36,1,74,230,1,
+156,205,167,91,248,123,238,185,255,6,44,9,80,138,157,0,131,131,185,18,35,127,58,206,230,211,101,243,97,194,43,76,253,208,52,73,2,92,179,37,128,179,249,244,216,124,152,240,192,191,91,18,32,254,35,96,
+96,96,228,42,31,55,208,161,13,224,108,62,93,54,111,114,247,221,247,249,112,44,83,63,52,141,157,0,253,253,195,235,188,80,208,161,23,224,108,62,93,54,111,10,175,224,186,77,253,208,52,73,2,172,154,7,96,
+28,192,217,124,122,108,222,38,188,130,24,89,18,32,254,64,80,95,223,208,50,211,191,116,24,9,116,54,255,64,234,106,187,13,42,169,169,31,154,38,73,128,188,121,0,222,5,56,155,79,175,240,119,221,117,239,
+117,152,184,99,73,128,248,47,131,122,123,7,23,88,254,165,195,43,70,103,243,233,177,121,155,240,10,190,196,98,234,135,166,177,19,96,239,222,129,28,251,254,232,176,2,213,217,124,122,108,222,38,188,130,
+202,106,234,135,166,73,18,32,107,30,128,173,96,156,205,167,199,230,109,108,217,178,213,135,21,66,150,4,136,63,37,108,207,158,254,14,62,107,102,98,90,191,179,249,198,217,188,77,120,224,247,109,218,161,
+105,162,153,193,242,7,107,230,65,232,10,58,155,79,135,205,155,194,43,136,175,69,252,181,196,235,2,118,239,238,43,48,17,84,135,158,128,179,249,244,212,118,27,84,82,83,55,180,76,156,0,187,118,245,78,
+177,233,128,206,147,79,190,205,217,124,74,133,191,243,206,123,124,248,24,165,169,27,90,86,146,0,93,230,129,122,122,246,58,155,79,129,205,219,132,87,176,119,147,37,1,42,251,178,136,8,94,68,116,29,6,25,
+156,205,55,182,182,219,132,7,226,111,234,133,134,21,239,15,32,127,156,55,15,200,250,64,103,243,141,181,249,48,24,174,183,36,64,229,27,68,136,157,244,98,41,58,244,49,157,205,55,214,230,77,238,184,227,
+110,31,62,207,103,234,133,134,27,73,128,77,66,201,60,40,175,134,157,205,55,198,230,109,194,3,113,183,136,143,118,149,111,18,69,121,250,233,221,151,25,5,212,225,163,134,206,230,27,83,219,77,225,21,172,
+6,50,117,66,187,13,239,19,184,115,231,174,30,22,27,154,208,19,112,54,95,127,155,183,193,241,109,26,161,93,85,118,11,149,3,21,205,131,211,224,112,54,95,95,155,183,113,251,237,119,249,211,245,44,226,87,
+103,171,88,138,52,252,22,105,252,233,48,40,228,108,190,190,54,111,10,175,224,187,1,166,62,104,86,205,4,232,180,156,192,31,19,112,54,95,31,155,55,69,87,168,47,137,89,168,238,7,164,118,236,120,123,129,
+61,2,116,88,50,238,108,126,107,67,132,87,48,244,107,234,130,86,85,255,98,136,244,49,179,244,51,77,112,1,103,243,181,183,249,176,218,111,211,4,173,106,242,221,32,57,240,146,121,50,158,63,206,230,235,
+83,219,21,157,157,91,252,255,50,243,199,34,126,109,62,26,69,121,234,169,157,89,166,134,153,240,225,8,103,243,181,21,30,209,117,104,249,219,180,64,163,154,126,59,80,78,144,183,157,152,113,1,103,243,
+181,23,30,184,183,16,241,107,251,225,72,138,116,255,58,233,2,154,108,219,182,221,217,124,149,109,62,12,198,96,108,26,160,77,93,190,31,44,207,253,121,158,253,38,188,35,112,54,95,221,218,174,115,219,
+109,119,250,13,63,91,236,209,164,174,95,16,151,19,174,218,46,132,71,129,179,249,234,11,15,220,111,136,248,245,253,124,60,229,241,199,223,218,205,56,128,9,243,6,157,205,111,220,230,117,225,21,44,248,
+176,197,28,45,50,141,40,114,226,75,182,11,162,87,224,108,190,58,162,43,216,155,49,68,252,75,153,70,22,233,139,174,208,31,53,161,155,226,108,126,227,194,3,143,85,91,140,137,125,166,209,101,251,246,39,
+187,132,18,67,146,38,44,36,113,54,95,185,240,192,0,155,45,182,65,204,187,50,105,40,114,33,185,144,139,244,179,215,217,124,50,209,225,214,91,239,240,29,52,44,174,196,60,147,166,210,221,253,196,34,51,
+133,76,152,68,202,196,17,103,243,91,98,137,174,32,38,196,206,22,83,98,157,73,99,145,11,43,216,46,152,158,129,45,9,156,205,223,44,188,18,159,152,133,136,95,200,164,185,72,214,46,147,185,38,122,18,56,
+155,183,11,15,60,38,137,149,45,134,196,54,147,246,34,23,223,33,172,112,19,54,104,19,56,155,183,195,224,89,88,220,130,152,118,100,154,161,200,133,110,22,174,132,221,12,189,131,118,183,121,19,220,49,66,
+124,98,185,57,211,76,101,219,182,237,155,133,21,94,18,217,96,156,160,93,109,94,231,150,91,110,247,43,68,88,156,130,24,54,151,248,90,18,116,8,203,97,55,199,136,33,182,215,78,54,175,68,7,238,135,25,85,
+17,226,19,187,142,76,179,151,71,31,237,46,48,142,29,6,237,130,118,176,121,37,60,48,192,19,21,19,98,150,105,165,34,55,180,24,117,195,188,74,102,224,163,85,109,94,193,53,243,248,43,35,254,98,166,21,203,
+35,143,60,150,19,74,44,99,10,131,247,221,205,32,124,18,209,65,53,244,162,238,61,136,77,46,211,202,229,225,135,223,210,37,172,48,171,37,12,218,6,172,55,104,118,155,87,208,206,97,235,150,168,123,14,98,
+210,149,105,151,34,55,123,169,76,64,174,79,57,111,54,155,87,168,47,120,149,187,79,98,145,105,199,242,208,67,219,186,133,85,193,139,130,68,192,62,121,52,164,217,230,129,191,99,110,36,194,151,187,175,
+224,222,187,51,237,94,36,8,243,49,130,229,67,27,129,225,210,180,9,79,23,150,222,76,220,251,224,158,51,174,252,173,200,115,191,83,200,243,252,143,3,53,140,93,74,84,50,52,194,230,17,29,103,226,90,226,
+94,119,112,143,157,78,241,144,34,141,165,172,176,68,163,41,46,60,34,24,77,163,189,192,208,178,158,16,213,18,157,159,121,4,209,160,195,133,56,103,146,107,12,238,41,235,20,78,150,8,133,132,65,190,14,
+125,109,44,153,222,4,141,49,18,67,181,33,84,98,40,145,249,89,45,183,162,183,65,205,198,89,72,40,142,193,247,146,42,189,142,224,30,156,240,149,22,169,105,157,194,162,80,164,214,53,9,197,224,154,157,
+213,87,57,25,122,132,203,66,41,133,162,151,130,107,235,113,74,213,184,72,163,107,147,208,43,228,133,34,141,176,6,81,12,174,129,107,217,228,148,105,80,201,102,223,220,37,76,9,5,97,141,57,244,53,98,45,
+56,7,231,234,114,145,79,111,66,116,8,89,33,39,44,8,121,97,89,88,21,214,133,171,194,53,161,20,112,45,248,127,235,193,239,44,7,127,179,16,28,131,99,117,184,200,186,226,138,43,174,184,226,138,43,174,184,
+226,138,43,174,184,226,138,43,174,184,226,138,43,174,164,166,204,207,47,116,8,89,33,39,44,8,121,97,89,88,21,214,133,171,194,53,161,20,112,45,248,127,235,193,239,44,7,127,179,16,28,131,99,185,161,224,
+20,11,222,37,76,9,5,97,77,240,106,196,90,112,14,206,229,94,6,53,170,92,188,248,220,38,161,87,200,11,69,193,107,16,197,224,26,184,22,247,58,184,214,229,194,133,103,123,132,203,66,73,240,82,70,41,184,
+54,55,33,164,202,162,119,10,139,66,49,133,162,135,81,12,174,217,77,9,171,180,156,63,255,76,86,40,8,94,37,204,204,156,242,198,199,167,188,92,238,128,215,215,55,228,127,71,143,29,181,217,95,143,237,86,
+88,132,169,214,228,241,51,27,49,176,251,22,191,195,39,215,122,123,7,189,145,145,253,222,216,216,164,119,226,196,73,175,210,235,8,238,193,77,10,77,40,252,82,146,32,159,61,123,209,59,114,100,218,27,26,
+26,245,191,152,133,152,106,165,109,153,197,152,101,151,109,169,133,28,28,139,207,177,12,12,140,120,19,19,71,253,115,38,76,132,37,151,8,17,229,220,185,249,78,33,47,120,113,152,155,59,227,237,223,127,
+216,175,217,230,242,234,141,138,174,11,31,5,31,103,26,29,61,232,205,206,158,246,226,94,119,112,143,238,209,160,23,169,77,243,212,168,56,28,58,52,97,21,189,154,181,61,140,168,21,63,36,195,129,3,99,94,
+220,251,224,158,157,240,103,47,118,11,171,229,130,197,243,124,112,48,231,239,147,151,54,225,65,95,8,194,245,208,230,160,221,16,35,9,184,247,246,92,28,122,230,204,133,75,130,23,197,177,99,179,126,99,
+172,22,162,87,91,120,27,187,118,245,122,211,211,51,94,185,251,36,22,237,36,124,151,176,18,21,16,106,60,181,40,141,181,61,142,240,230,162,145,221,187,251,124,71,40,147,4,196,164,181,71,23,79,159,62,
+159,19,74,130,23,198,240,240,62,127,135,172,52,219,124,92,225,117,248,119,122,16,81,247,30,196,166,53,183,136,57,117,234,220,162,224,133,65,159,157,62,120,179,217,124,185,37,99,230,106,34,218,49,135,
+15,31,241,162,98,65,172,90,77,252,66,212,13,247,247,15,55,189,205,151,19,222,100,207,158,254,114,73,208,252,219,196,157,60,121,182,67,88,22,60,27,147,147,199,252,175,93,182,138,205,199,17,94,95,106,
+198,200,35,131,74,97,241,9,98,215,209,172,226,111,22,86,194,110,110,223,190,67,45,107,243,229,132,55,97,200,57,34,9,136,97,115,109,21,59,55,119,102,179,112,133,209,58,27,88,126,59,216,124,185,197,166,
+108,98,161,160,167,16,22,175,32,150,155,155,69,252,14,97,37,236,102,232,27,183,147,205,151,19,94,135,119,13,17,73,64,76,211,255,56,152,157,61,189,204,216,184,9,253,96,94,212,180,171,205,71,9,175,96,
+43,26,62,5,71,172,108,49,36,182,169,22,127,102,230,84,129,65,28,147,227,199,231,252,198,94,187,219,124,148,240,58,116,21,25,5,181,197,146,24,167,85,252,197,184,226,183,179,205,135,137,110,75,2,98,23,
+146,4,233,26,39,16,203,202,97,91,54,120,75,230,108,62,190,240,15,62,248,166,235,48,121,37,44,174,196,60,45,226,119,9,37,219,69,242,218,214,217,124,114,225,117,24,29,13,73,0,98,222,248,119,7,98,83,43,
+88,149,201,222,189,3,206,230,43,20,93,135,13,48,169,72,182,24,19,251,134,138,47,13,149,75,52,86,76,120,161,227,108,62,153,240,67,67,57,111,108,236,136,127,15,136,110,194,216,137,45,214,104,208,40,241,
+187,109,23,196,140,29,103,243,241,133,103,52,244,149,87,190,233,189,254,250,235,62,255,247,255,254,193,155,154,58,102,77,2,102,28,133,36,65,253,39,149,76,79,207,172,50,217,193,228,137,39,118,56,155,
+143,105,243,187,119,247,122,63,255,249,47,174,139,175,248,221,239,126,119,131,240,236,77,12,52,166,109,49,71,139,122,139,63,111,187,16,134,51,157,205,199,123,190,31,62,60,225,189,246,218,107,55,137,
+175,160,13,165,132,215,161,87,21,146,4,245,153,99,120,244,232,137,78,193,51,97,118,172,179,249,255,29,171,81,119,246,236,249,80,225,21,127,247,119,79,90,19,128,205,171,105,99,217,52,64,155,154,39,192,
+212,212,241,188,224,153,208,103,117,54,31,45,60,188,239,125,239,47,43,254,39,63,249,41,171,240,10,226,106,211,0,109,106,45,126,214,118,98,236,202,217,124,184,232,138,79,127,58,95,86,252,15,127,248,35,
+161,194,235,208,53,12,73,130,218,45,62,153,156,60,182,196,36,14,29,166,55,169,231,190,179,121,187,240,220,247,215,190,246,245,178,226,63,247,220,59,34,69,87,240,165,20,126,143,30,151,169,7,26,213,74,
+252,172,229,100,254,58,58,103,243,118,225,225,233,167,119,121,63,253,233,79,35,133,255,203,95,254,34,141,184,19,177,132,215,161,199,101,211,4,173,170,158,0,71,142,76,23,88,127,167,67,191,212,217,124,
+54,148,3,7,14,123,175,190,250,159,145,226,175,174,254,218,27,24,24,78,36,188,14,51,171,76,93,208,170,170,226,79,76,28,237,100,238,154,9,239,247,157,205,219,57,121,242,76,89,203,255,222,247,190,239,55,
+158,147,138,174,224,131,85,252,189,77,27,52,171,102,2,44,154,39,48,107,127,59,219,188,57,104,243,238,119,191,183,172,248,47,191,252,69,235,243,62,142,232,38,44,146,181,36,64,245,94,25,143,143,79,21,
+153,183,175,67,43,212,217,252,141,35,117,240,210,75,159,44,43,254,71,63,250,241,170,8,175,224,141,161,169,15,154,85,75,252,30,203,193,253,97,201,118,183,121,93,120,174,233,203,95,254,74,89,241,223,
+249,206,197,196,54,31,5,95,69,227,90,108,26,161,221,134,19,96,108,108,242,50,187,100,232,176,96,179,221,109,94,231,173,111,221,233,253,240,135,63,138,20,254,175,127,253,171,119,226,196,236,134,107,
+187,46,188,14,147,109,77,157,208,110,67,226,75,31,127,147,80,162,175,175,195,196,197,118,182,121,157,92,110,191,247,219,223,254,71,164,248,191,249,205,111,189,225,225,209,170,212,246,48,24,139,49,117,
+10,180,219,180,145,4,232,53,15,74,183,163,93,109,222,100,102,102,206,175,217,81,226,255,235,191,254,208,239,175,215,74,120,224,3,151,192,251,24,75,18,244,86,156,0,135,14,77,228,25,109,210,225,141,95,
+59,218,188,9,207,242,114,207,251,165,165,47,251,231,170,150,205,135,9,175,224,77,161,169,23,26,110,36,1,138,230,1,233,119,182,155,205,155,99,243,180,226,203,137,255,137,79,188,84,211,218,110,131,225,
+120,75,2,84,214,27,56,120,112,188,75,240,116,232,251,183,155,205,235,125,117,126,254,226,23,191,84,86,252,197,197,247,212,85,120,184,255,254,7,124,24,19,48,117,67,203,74,18,96,202,60,16,187,118,180,
+147,205,235,253,244,199,31,127,202,251,254,247,127,80,86,252,217,217,83,53,181,249,48,225,21,60,162,45,9,48,149,56,1,164,182,23,168,241,58,172,93,107,23,155,215,225,177,199,152,125,148,240,175,190,
+250,170,52,194,14,212,165,182,219,132,87,112,173,166,110,104,153,56,1,196,74,214,176,19,29,118,216,108,117,155,183,241,241,143,191,20,41,254,143,127,252,19,169,28,79,215,189,182,155,220,119,223,27,
+125,61,76,221,208,50,169,248,29,150,131,220,100,253,173,102,243,97,47,101,190,241,141,111,134,138,255,207,255,252,85,255,94,26,45,188,130,223,183,105,135,166,177,19,64,250,250,89,250,251,58,236,211,
+215,202,54,31,53,54,255,193,15,190,16,58,117,171,17,54,111,19,94,135,53,4,166,126,104,154,36,1,114,230,1,104,92,180,178,205,71,13,209,114,237,102,3,240,61,239,185,212,240,218,30,6,175,233,45,9,16,127,
+45,225,232,232,193,5,70,149,116,104,0,182,178,205,199,25,169,99,214,206,252,252,115,222,158,61,125,169,19,254,222,123,187,174,67,67,208,212,15,77,99,39,64,46,119,32,207,54,235,58,140,255,183,178,205,
+215,123,208,166,22,194,43,120,83,107,234,135,166,73,18,96,217,60,0,91,176,183,178,205,55,98,208,102,35,54,111,19,94,65,59,205,146,0,241,119,23,25,25,217,191,202,206,85,58,188,109,106,7,155,79,179,240,
+81,162,195,214,173,111,240,33,94,166,126,104,154,36,1,214,205,3,240,246,207,217,124,122,108,222,38,188,130,235,182,36,192,122,236,4,24,30,222,119,149,229,71,58,216,138,179,249,244,216,188,77,120,5,
+199,55,245,67,211,216,9,48,52,52,122,141,207,175,232,148,19,222,217,124,99,106,123,24,166,126,104,154,36,1,74,230,1,156,205,167,91,248,123,238,185,255,6,44,9,80,138,157,0,131,131,185,18,35,127,58,206,
+230,211,101,243,97,194,43,76,253,208,52,73,2,92,179,37,128,179,249,244,216,124,152,240,192,191,91,18,32,254,35,96,96,96,228,42,31,55,208,161,13,224,108,62,93,54,111,114,247,221,247,249,112,44,83,63,
+52,141,157,0,253,253,195,235,188,80,208,161,23,224,108,62,93,54,111,10,175,224,186,77,253,208,52,73,2,172,154,7,96,28,192,217,124,122,108,222,38,188,130,24,89,18,32,254,64,80,95,223,208,50,211,191,
+116,24,9,116,54,255,64,234,106,187,13,42,169,169,31,154,38,73,128,188,121,0,222,5,56,155,79,175,240,119,221,117,239,117,152,184,99,73,128,248,47,131,122,123,7,23,88,254,165,195,43,70,103,243,233,177,
+121,155,240,10,246,30,52,245,67,211,216,9,176,119,239,64,142,125,127,116,88,129,234,108,62,61,54,111,19,94,65,101,53,245,67,211,36,9,144,53,15,192,86,48,206,230,211,99,243,54,182,108,217,234,195,10,
+33,75,2,196,159,18,182,103,79,127,7,159,53,51,49,173,223,217,124,227,108,222,38,60,240,251,54,237,208,52,209,204,96,249,131,53,243,32,116,5,157,205,167,195,230,77,225,21,196,215,34,254,90,226,117,1,
+187,119,247,21,152,8,170,67,79,192,217,124,122,106,187,13,42,169,169,27,90,38,78,128,93,187,122,167,216,116,64,231,201,39,223,230,108,62,165,194,223,121,231,61,62,124,140,210,212,13,45,43,73,128,46,
+243,64,61,61,123,157,205,167,192,230,109,194,43,216,187,201,146,0,149,125,89,68,4,47,34,186,14,131,12,206,230,27,91,219,109,194,3,241,55,245,66,195,138,247,7,144,63,206,155,7,100,125,160,179,249,198,
+218,124,24,12,215,91,18,160,242,13,34,196,78,122,177,20,29,250,152,206,230,27,107,243,38,119,220,113,183,15,159,231,51,245,66,195,141,36,192,38,161,100,30,148,87,195,206,230,27,99,243,54,225,129,184,
+91,196,71,187,202,55,137,162,60,253,244,238,203,140,2,234,240,81,67,103,243,141,169,237,166,240,10,86,3,153,58,161,221,134,247,9,220,185,115,87,15,139,13,77,232,9,56,155,175,191,205,219,224,248,54,
+141,208,174,42,187,133,202,129,138,230,193,105,112,56,155,175,175,205,219,184,253,246,187,252,233,122,22,241,171,179,85,44,69,26,126,139,52,254,116,24,20,114,54,95,95,155,55,133,87,176,15,161,169,15,
+154,85,51,1,58,45,39,240,199,4,156,205,215,199,230,77,209,21,234,75,98,22,170,251,1,169,29,59,222,94,96,143,0,29,150,140,59,155,223,218,16,225,21,12,253,154,186,160,85,213,191,24,34,125,204,44,253,76,
+19,92,192,217,124,237,109,62,172,246,219,52,65,171,154,124,55,72,14,188,100,158,140,231,143,179,249,250,212,118,69,103,231,22,255,191,204,252,177,136,95,155,143,70,81,158,122,106,103,150,169,97,38,
+124,56,194,217,124,109,133,71,116,29,90,254,54,45,208,168,166,223,14,148,19,228,109,39,102,92,192,217,124,237,133,7,238,45,68,252,218,126,56,146,34,221,191,78,186,128,38,219,182,109,119,54,95,101,155,
+15,131,49,24,155,6,104,83,151,239,7,203,115,127,158,103,191,9,239,8,156,205,87,183,182,235,220,118,219,157,126,195,207,22,123,52,169,235,23,196,229,132,171,182,11,225,81,224,108,190,250,194,3,247,27,
+34,126,125,63,31,79,121,252,241,183,118,51,14,96,194,188,65,103,243,27,183,121,93,120,5,11,62,108,49,71,139,76,35,138,156,248,146,237,130,232,21,56,155,175,142,232,10,246,102,12,17,255,82,166,145,69,
+250,162,43,244,71,77,232,166,56,155,223,184,240,160,182,172,183,176,146,105,116,217,190,253,201,46,161,196,144,164,9,11,73,156,205,87,46,60,48,192,102,139,109,16,243,174,76,26,138,92,72,46,228,34,253,
+236,117,54,159,76,116,184,245,214,59,124,7,13,139,43,49,207,164,169,116,119,63,177,200,76,33,19,38,145,50,113,196,217,252,150,88,162,43,136,9,177,179,197,148,88,103,210,88,228,194,10,182,11,166,103,
+96,75,2,103,243,55,11,175,196,39,102,33,226,23,50,105,46,146,181,203,100,174,137,158,4,206,230,237,194,3,143,73,98,101,139,33,177,205,164,189,200,197,119,8,43,220,132,13,218,4,206,230,237,48,120,22,
+22,183,32,166,29,153,102,40,114,161,155,133,43,97,55,67,239,160,221,109,222,4,119,140,16,159,88,110,206,52,83,217,182,109,251,102,97,133,151,68,54,24,39,104,87,155,215,185,229,150,219,253,10,17,22,
+167,32,134,205,37,190,150,4,29,194,114,216,205,49,98,136,237,181,147,205,43,209,129,251,97,70,85,132,248,196,174,35,211,236,229,209,71,187,11,140,99,135,65,187,160,29,108,94,9,15,12,240,68,197,132,
+152,101,90,169,200,13,45,70,221,48,175,146,25,248,104,85,155,87,112,205,60,254,202,136,191,152,105,197,242,200,35,143,229,132,18,203,152,194,224,125,119,51,8,159,68,116,80,13,189,168,123,15,98,147,
+203,180,114,121,248,225,183,116,9,43,204,106,9,131,182,1,235,13,154,221,230,21,180,115,216,186,37,234,158,131,152,116,101,218,165,200,205,94,42,19,144,235,83,206,155,205,230,21,234,11,94,229,238,147,
+88,100,218,177,60,244,208,182,110,97,85,240,162,32,17,176,79,30,13,105,182,121,224,239,152,27,137,240,229,238,43,184,247,238,76,187,23,9,194,124,140,96,249,208,70,96,184,52,109,194,211,133,165,55,19,
+247,62,184,231,140,43,127,43,242,220,239,20,242,60,255,227,64,13,99,151,18,149,12,141,176,121,68,199,153,184,150,184,215,29,220,99,167,83,60,164,72,99,41,43,44,209,104,138,11,143,8,70,211,104,47,48,
+180,172,39,68,181,68,231,103,30,65,52,232,112,33,206,153,228,26,131,123,202,58,133,147,37,66,33,97,144,175,67,95,27,75,166,55,65,99,140,196,80,109,8,149,24,74,100,126,86,203,173,232,109,80,179,113,22,
+18,138,99,240,189,164,74,175,35,184,7,39,124,165,69,106,90,167,176,40,20,169,117,77,66,49,184,102,103,245,85,78,134,30,225,178,80,74,161,232,165,224,218,122,156,82,53,46,210,232,218,36,244,10,121,161,
+72,35,172,65,20,131,107,224,90,54,57,101,26,84,178,217,55,119,9,83,66,65,88,99,14,125,141,88,11,206,193,185,186,92,228,211,155,16,29,66,86,200,9,11,66,94,88,22,86,133,117,225,170,112,77,40,5,92,11,
+254,223,122,240,59,203,193,223,44,4,199,224,88,29,46,178,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,169,41,243,243,11,29,66,86,200,9,11,66,94,88,22,
+86,133,117,225,170,112,77,40,5,92,11,254,223,122,240,59,203,193,223,44,4,199,224,88,110,40,56,197,130,119,9,83,66,65,88,19,188,26,177,22,156,131,115,185,151,65,141,42,23,47,62,183,73,232,21,242,66,81,
+240,26,68,49,184,6,174,197,189,14,174,117,185,112,225,217,30,225,178,80,18,188,148,81,10,174,205,77,8,169,178,232,157,194,162,80,76,161,232,97,20,131,107,118,83,194,42,45,231,207,63,147,21,10,130,87,
+9,51,51,167,188,241,241,41,47,151,59,224,245,245,13,249,223,209,99,71,109,246,215,99,187,21,22,97,170,53,121,252,204,70,12,236,190,197,239,240,201,181,222,222,65,111,100,100,191,55,54,54,233,157,56,
+113,210,171,244,58,130,123,112,147,66,19,10,191,148,36,200,103,207,94,244,142,28,153,246,134,134,70,253,47,102,33,166,90,105,91,102,49,102,217,101,91,106,33,7,199,226,115,44,3,3,35,222,196,196,81,255,
+156,9,19,97,201,37,66,68,57,119,110,190,83,200,11,94,28,230,230,206,120,251,247,31,246,107,182,185,188,122,163,162,235,194,71,193,199,153,70,71,15,122,179,179,167,189,184,215,29,220,163,123,52,232,69,
+106,211,60,53,42,14,135,14,77,88,69,175,102,109,15,35,106,197,15,201,112,224,192,152,23,247,62,184,103,39,252,217,139,221,194,106,185,96,241,60,31,28,204,249,251,228,165,77,120,208,23,130,112,61,180,
+57,104,55,196,72,2,238,189,61,23,135,158,57,115,225,146,224,69,113,236,216,172,223,24,171,133,232,213,22,222,198,174,93,189,222,244,244,140,87,238,62,137,69,59,9,223,37,172,68,5,132,26,79,45,74,99,
+109,143,35,188,185,104,100,247,238,62,223,17,202,36,1,49,105,237,209,197,211,167,207,231,132,146,224,133,49,60,188,207,223,33,43,205,54,31,87,120,29,254,157,30,68,212,189,7,177,105,205,45,98,78,157,
+58,183,40,120,97,208,103,167,15,222,108,54,95,110,201,152,185,154,136,118,204,225,195,71,188,168,88,16,171,86,19,191,16,117,195,253,253,195,77,111,243,229,132,55,217,179,167,191,92,18,52,255,54,113,
+39,79,158,237,16,150,5,207,198,228,228,49,255,107,151,173,98,243,113,132,215,151,154,49,242,200,160,82,88,124,130,216,117,52,171,248,155,133,149,176,155,219,183,239,80,203,218,124,57,225,77,24,114,
+142,72,2,98,216,92,91,197,206,205,157,217,44,92,97,180,206,6,150,223,14,54,95,110,177,41,155,88,40,232,41,132,197,43,136,229,230,102,17,191,67,88,9,187,25,250,198,237,100,243,229,132,215,225,93,67,68,
+18,16,211,244,63,14,102,103,79,47,51,54,110,66,63,152,23,53,237,106,243,81,194,43,216,138,134,79,193,17,43,91,12,137,109,170,197,159,153,57,85,96,16,199,228,248,241,57,191,177,215,238,54,31,37,188,14,
+93,69,70,65,109,177,36,198,105,21,127,49,174,248,237,108,243,97,162,219,146,128,216,133,36,65,186,198,9,196,178,114,216,150,13,222,146,57,155,143,47,252,131,15,190,233,58,76,94,9,139,43,49,79,139,248,
+93,66,201,118,145,188,182,117,54,159,92,120,29,70,71,67,18,128,152,55,254,221,129,216,212,10,86,101,178,119,239,128,179,249,10,69,215,97,3,76,42,146,45,198,196,190,161,226,75,67,229,18,141,21,19,94,
+232,56,155,175,92,120,68,55,97,236,196,22,107,52,104,148,248,221,182,11,98,198,142,179,249,234,9,175,195,140,163,144,36,168,255,164,146,233,233,153,85,38,59,152,60,241,196,14,103,243,21,216,124,20,
+236,77,12,52,166,109,49,71,139,122,139,63,111,187,16,134,51,157,205,87,94,219,185,174,231,159,127,183,247,210,75,159,244,78,158,60,115,93,120,29,122,85,33,73,80,159,57,134,71,143,158,232,20,60,19,102,
+199,58,155,175,220,230,247,237,59,232,93,185,114,197,123,253,245,215,175,243,249,207,255,227,77,9,192,230,213,180,177,108,26,160,77,205,19,96,106,234,120,94,240,76,232,179,58,155,175,204,230,223,245,
+174,247,220,32,188,206,240,240,232,117,225,21,196,213,166,1,218,212,90,252,172,237,196,116,249,156,205,39,127,182,111,219,214,237,45,45,125,57,84,124,152,155,59,125,131,248,10,186,134,33,73,80,187,
+197,39,147,147,199,150,152,196,161,195,244,38,245,220,119,54,31,191,81,55,62,126,196,251,205,111,126,19,41,62,236,222,221,123,147,248,124,41,133,99,208,227,50,245,64,163,90,137,159,181,156,204,95,71,
+231,108,62,89,107,254,253,239,255,127,203,10,15,31,252,224,11,55,9,175,67,143,203,166,9,90,85,61,1,142,28,153,46,176,254,78,135,126,169,179,249,120,162,195,19,79,188,213,123,229,149,111,148,21,254,15,
+127,248,163,55,51,115,50,84,120,29,102,86,153,186,160,85,85,197,159,152,56,218,201,220,53,19,222,239,59,155,47,47,60,28,59,118,194,91,91,251,125,89,241,191,245,173,111,123,111,125,235,206,72,209,21,
+124,176,138,198,183,77,27,52,171,102,2,44,154,39,48,107,191,179,121,187,240,240,226,139,31,137,109,249,113,68,55,97,145,172,37,1,170,247,202,120,124,124,170,200,188,125,29,90,161,206,230,195,69,135,
+167,159,222,229,45,47,127,167,172,240,191,251,221,171,98,219,71,19,11,175,224,141,161,169,15,154,85,75,252,30,203,193,253,97,73,103,243,255,79,40,167,78,157,241,254,235,191,214,203,138,255,207,255,
+252,85,127,195,138,74,132,7,190,138,198,181,216,52,66,187,13,39,192,216,216,228,101,118,201,208,97,193,166,179,249,112,24,202,141,99,249,239,125,239,251,42,18,93,9,175,195,100,91,83,39,180,219,144,
+248,210,199,223,36,148,232,235,235,48,113,209,217,252,205,236,221,219,239,253,240,135,63,42,43,252,175,126,181,42,109,168,195,21,213,246,48,24,139,49,117,10,180,219,180,145,4,232,53,15,74,183,195,217,
+252,141,99,243,112,225,194,188,247,215,191,254,181,172,248,151,47,191,236,183,157,170,37,60,240,129,75,224,125,140,37,9,122,43,78,128,67,135,38,242,140,54,233,240,198,207,217,252,223,132,255,95,255,
+235,77,222,103,63,251,249,88,150,255,142,119,60,191,33,155,15,19,94,193,155,66,83,47,52,220,72,2,20,205,3,210,239,108,103,155,215,71,230,120,81,243,243,159,255,162,172,240,252,206,208,80,174,170,181,
+221,6,195,241,150,4,168,172,55,112,240,224,120,151,224,233,208,247,111,103,155,215,161,54,199,169,245,184,3,215,80,75,225,225,254,251,31,240,97,76,192,212,13,45,43,73,128,41,243,64,236,218,209,142,54,
+175,195,243,155,231,120,28,241,207,159,191,88,55,225,21,60,162,45,9,48,149,56,1,164,182,23,168,241,58,172,93,107,55,155,215,57,120,112,204,111,193,151,19,158,158,0,66,212,74,116,155,240,10,30,209,166,
+110,104,153,56,1,196,74,214,176,19,29,6,44,218,201,230,117,142,31,159,141,85,235,95,122,233,31,234,86,219,77,238,187,239,141,190,30,166,110,104,153,84,252,14,203,65,110,178,254,86,181,121,219,43,216,
+159,253,108,37,82,248,245,245,117,127,242,70,163,132,87,240,251,54,237,208,52,118,2,72,95,63,75,127,95,135,125,250,218,193,230,195,94,193,34,112,152,248,140,247,243,120,172,151,205,219,132,215,97,13,
+129,169,31,154,38,73,128,156,121,0,158,105,173,110,243,81,47,99,190,249,205,111,89,197,255,240,135,95,108,88,109,15,131,215,244,150,4,136,191,150,112,116,244,224,2,163,74,58,100,120,171,219,124,212,
+11,25,42,192,191,255,251,223,166,112,241,110,255,232,209,227,169,17,254,222,123,187,174,67,67,208,212,15,77,99,39,64,46,119,32,207,54,235,58,140,255,183,186,205,151,27,155,231,188,211,211,199,165,65,
+56,227,63,10,27,105,243,54,225,21,188,169,53,245,67,211,36,9,176,108,30,128,45,216,91,221,230,171,61,54,95,75,155,183,9,175,32,57,45,9,16,127,119,145,145,145,253,171,236,92,165,195,219,166,86,183,249,
+180,11,31,37,58,108,221,250,6,31,226,101,234,135,166,73,18,96,221,60,0,111,255,218,193,230,235,57,104,83,109,225,21,92,183,37,1,214,99,39,192,240,240,190,171,44,63,210,193,86,156,205,167,199,230,109,
+194,43,56,190,169,31,154,198,78,128,161,161,209,107,124,126,69,167,156,240,206,230,27,83,219,195,48,245,67,211,36,9,80,50,15,224,108,62,221,194,223,115,207,253,55,96,73,128,82,236,4,24,28,204,149,24,
+249,211,113,54,159,46,155,15,19,94,97,234,135,166,73,18,224,154,45,1,156,205,167,199,230,195,132,7,254,221,146,0,241,31,1,3,3,35,87,249,184,129,14,109,0,103,243,233,178,121,147,187,239,190,207,135,99,
+153,250,161,105,236,4,232,239,31,94,231,133,130,14,189,0,103,243,233,178,121,83,120,5,215,109,234,135,166,73,18,96,213,60,0,227,0,206,230,211,99,243,54,225,21,196,200,146,0,241,7,130,250,250,134,150,
+153,254,165,195,72,160,179,249,7,82,87,219,109,80,73,77,253,208,52,73,2,228,205,3,240,46,192,217,124,122,133,191,235,174,123,175,195,196,29,75,2,196,127,25,212,219,59,184,192,242,47,29,94,49,58,155,
+79,143,205,219,132,87,240,37,22,83,63,52,141,157,0,123,247,14,228,216,247,71,135,21,168,206,230,211,99,243,54,225,21,84,86,83,63,52,77,146,0,89,243,0,108,5,227,108,62,61,54,111,99,203,150,173,62,172,
+16,178,36,64,252,41,97,123,246,244,119,240,89,51,19,211,250,157,205,55,206,230,109,194,3,191,111,211,14,77,19,205,12,150,63,88,51,15,66,87,208,217,124,58,108,222,20,94,65,124,45,226,175,37,94,23,176,
+123,119,95,129,121,112,58,244,4,156,205,167,167,182,219,160,146,154,186,161,101,226,4,216,181,171,119,138,77,7,116,158,124,242,109,206,230,83,42,252,157,119,222,227,195,199,40,77,221,208,178,146,4,
+232,50,15,212,211,179,215,217,124,10,108,222,38,188,130,189,155,44,9,80,217,151,69,68,240,34,162,235,48,200,224,108,190,177,181,221,38,60,16,127,83,47,52,172,120,127,0,249,227,188,121,64,219,134,70,
+206,230,235,107,243,97,48,92,111,73,128,202,55,136,16,59,233,197,82,116,232,99,58,155,111,172,205,155,220,113,199,221,62,124,158,207,212,11,13,55,146,0,155,132,146,121,80,94,13,59,155,111,140,205,219,
+132,7,226,110,17,31,237,42,223,36,138,242,244,211,187,47,51,10,168,195,71,13,157,205,55,166,182,155,194,43,88,13,100,234,132,118,27,222,39,112,231,206,93,61,44,54,52,161,39,224,108,190,254,54,111,131,
+227,219,52,66,187,170,236,22,42,7,42,154,7,167,193,225,108,190,190,54,111,227,246,219,239,242,167,235,89,196,175,206,86,177,20,105,248,45,210,248,211,97,80,200,217,124,125,109,222,20,94,193,119,3,76,
+125,208,172,154,9,208,105,57,129,63,38,224,108,190,62,54,111,138,174,80,95,18,179,80,221,15,72,237,216,241,246,2,123,4,232,176,100,220,217,252,214,134,8,175,96,232,215,212,5,173,170,254,197,16,233,99,
+102,233,103,154,224,2,206,230,107,111,243,97,181,223,166,9,90,213,228,187,65,114,224,37,243,100,60,127,156,205,215,167,182,43,58,59,183,248,255,101,230,143,69,252,218,124,52,138,242,212,83,59,179,76,
+13,51,97,243,68,103,243,181,21,30,209,117,104,249,219,180,64,163,154,126,59,80,78,144,183,157,152,113,1,103,243,181,23,30,184,183,16,241,107,251,225,72,138,116,255,58,233,2,154,108,219,182,221,217,
+124,149,109,62,12,198,96,108,26,160,77,93,190,31,44,207,253,121,158,253,38,188,35,112,54,95,221,218,174,115,219,109,119,6,159,159,219,97,163,62,31,143,214,146,96,213,118,33,60,10,156,205,87,95,120,
+224,126,67,196,175,239,231,227,41,143,63,254,214,110,198,1,76,152,55,232,108,126,227,54,175,11,175,96,193,135,45,230,104,145,105,68,145,19,95,178,93,16,189,2,103,243,213,17,93,193,222,140,33,226,95,
+202,52,178,72,95,116,133,254,168,9,221,20,103,243,27,23,30,120,172,218,98,76,236,51,141,46,219,183,63,217,37,148,24,146,52,97,33,137,179,249,202,133,7,6,216,108,177,13,98,222,149,73,67,145,11,201,133,
+92,164,159,189,206,230,147,137,14,183,222,122,135,239,160,97,113,37,230,153,52,149,238,238,39,22,153,41,100,194,36,82,38,142,56,155,223,18,75,116,5,49,33,118,182,152,18,235,76,26,139,92,88,193,118,
+193,244,12,108,73,224,108,254,102,225,149,248,196,44,68,252,66,38,205,69,178,118,153,204,53,209,147,192,217,188,93,120,224,49,73,172,108,49,36,182,153,180,23,185,248,14,97,133,155,176,65,155,192,217,
+188,29,6,207,194,226,22,196,180,35,211,12,69,46,116,179,112,37,236,102,232,29,180,187,205,155,224,142,17,226,19,203,205,153,102,42,219,182,109,223,44,172,240,146,200,6,227,4,237,106,243,58,183,220,
+114,187,95,33,194,226,20,196,176,185,196,215,146,160,67,88,14,187,57,70,12,177,189,118,178,121,37,58,112,63,204,168,138,16,159,216,117,100,154,189,60,250,104,119,129,113,236,48,104,23,180,131,205,43,
+225,129,1,158,168,152,16,179,76,43,21,185,161,197,168,27,230,85,50,3,31,173,106,243,10,174,153,199,95,25,241,23,51,173,88,30,121,228,177,156,80,98,25,83,24,188,239,110,6,225,147,136,14,170,161,23,117,
+239,65,108,114,153,86,46,15,63,252,150,46,97,133,89,45,97,208,54,96,189,65,179,219,188,130,118,14,91,183,68,221,115,16,147,174,76,187,20,185,217,75,101,2,114,125,202,121,179,217,188,66,125,193,171,
+220,125,18,139,76,59,150,135,30,218,214,45,172,10,94,20,36,2,246,201,163,33,205,54,15,252,29,115,35,17,190,220,125,5,247,222,157,105,247,34,65,152,143,17,44,31,218,8,12,151,166,77,120,186,176,244,102,
+226,222,7,247,156,113,229,111,69,158,251,157,66,158,231,127,28,168,97,236,82,162,146,161,17,54,143,232,56,19,215,18,247,186,131,123,236,116,138,135,20,105,44,101,133,37,26,77,113,225,17,193,104,26,
+237,5,134,150,245,132,168,150,232,252,204,35,136,6,29,46,196,57,147,92,99,112,79,89,167,112,178,68,40,36,12,242,117,232,107,99,201,244,38,104,140,145,24,170,13,161,18,67,137,204,207,106,185,21,189,13,
+106,54,206,66,66,113,12,190,151,84,233,117,4,247,224,132,175,180,72,77,235,20,22,133,34,181,174,73,40,6,215,236,172,190,202,201,208,35,92,22,74,41,20,189,20,92,91,143,83,170,198,69,26,93,155,132,94,
+33,47,20,105,132,53,136,98,112,13,92,203,38,167,76,131,74,54,251,230,46,97,74,40,8,107,204,161,175,17,107,193,57,56,87,151,139,124,122,19,162,67,200,10,57,97,65,200,11,203,194,170,176,46,92,21,174,9,
+165,128,107,193,255,91,15,126,103,57,248,155,133,224,24,28,171,195,69,214,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,197,21,87,92,113,37,53,101,126,126,161,67,200,10,57,97,65,200,
+11,203,194,170,176,46,92,21,174,9,165,128,107,193,255,91,15,126,103,57,248,155,133,224,24,28,203,13,5,167,88,240,46,97,74,40,8,107,130,87,35,214,130,115,112,46,247,50,168,81,229,226,197,231,54,9,189,
+66,94,40,10,94,131,40,6,215,192,181,184,215,193,181,46,23,46,60,219,35,92,22,74,130,151,50,74,193,181,185,9,33,85,22,189,83,88,20,138,41,20,61,140,98,112,205,110,74,88,165,229,252,249,103,178,66,65,
+240,42,97,102,230,148,55,62,62,229,229,114,7,188,190,190,33,255,59,122,236,168,205,254,122,108,183,194,34,76,181,38,143,159,217,136,129,221,183,248,29,62,185,214,219,59,232,141,140,236,247,198,198,38,
+189,19,39,78,122,149,94,71,112,15,110,82,104,66,225,151,146,4,249,236,217,139,222,145,35,211,222,208,208,168,255,197,44,196,84,43,109,203,44,198,44,187,108,75,45,228,224,88,124,142,101,96,96,196,155,
+152,56,234,159,51,97,34,44,185,68,136,40,231,206,205,119,10,121,193,139,195,220,220,25,111,255,254,195,126,205,54,151,87,111,84,116,93,248,40,248,56,211,232,232,65,111,118,246,180,23,247,186,131,123,
+116,143,6,189,72,109,154,167,70,197,225,208,161,9,171,232,213,172,237,97,68,173,248,33,25,14,28,24,243,226,222,7,247,236,132,63,123,177,91,88,45,23,44,158,231,131,131,57,127,159,188,180,9,15,250,66,
+16,174,135,54,7,237,134,24,73,192,189,183,231,226,208,51,103,46,92,18,188,40,142,29,155,245,27,99,181,16,189,218,194,219,216,181,171,215,155,158,158,241,202,221,39,177,104,39,225,187,132,149,168,128,
+80,227,169,69,105,172,237,113,132,55,23,141,236,222,221,231,59,66,153,36,32,38,173,61,186,120,250,244,249,156,80,18,188,48,134,135,247,249,59,100,165,217,230,227,10,175,195,191,211,131,136,186,247,32,
+54,173,185,69,204,169,83,231,22,5,47,12,250,236,244,193,155,205,230,203,45,25,51,87,19,209,142,57,124,248,136,23,21,11,98,213,106,226,23,162,110,184,191,127,184,233,109,190,156,240,38,123,246,244,151,
+75,130,230,223,38,238,228,201,179,29,194,178,224,217,152,156,60,230,127,237,178,85,108,62,142,240,250,82,51,70,30,25,84,10,139,79,16,187,142,102,21,127,179,176,18,118,115,251,246,29,106,89,155,47,39,
+188,9,67,206,17,73,64,12,155,107,171,216,185,185,51,155,133,43,140,214,217,192,242,219,193,230,203,45,54,101,19,11,5,61,133,176,120,5,177,220,220,44,226,119,8,43,97,55,67,223,184,157,108,190,156,240,
+58,188,107,136,72,2,98,154,254,199,193,236,236,233,101,198,198,77,232,7,243,162,166,93,109,62,74,120,5,91,209,240,41,56,98,101,139,33,177,77,181,248,51,51,167,10,12,226,152,28,63,62,231,55,246,218,
+221,230,163,132,215,161,171,200,40,168,45,150,196,56,173,226,47,198,21,191,157,109,62,76,116,91,18,16,187,144,36,72,215,56,129,88,86,14,219,178,193,91,50,103,243,241,133,127,240,193,55,93,135,201,43,
+97,113,37,230,105,17,191,75,40,217,46,146,215,182,206,230,147,11,175,195,232,104,72,2,16,243,198,191,59,16,155,90,193,170,76,246,238,29,112,54,95,161,232,58,108,128,73,69,178,197,152,216,55,84,124,
+105,168,92,162,177,98,194,11,29,103,243,149,11,143,232,38,140,157,216,98,141,6,141,18,191,219,118,65,204,216,113,54,95,61,225,117,152,113,20,146,4,245,159,84,50,61,61,179,202,100,7,147,39,158,216,225,
+108,190,2,155,143,130,189,137,129,198,180,45,230,104,81,111,241,231,109,23,194,112,166,179,249,234,212,118,37,186,9,189,170,144,36,168,207,28,195,163,71,79,116,10,158,9,179,99,157,205,215,78,120,5,
+155,87,211,198,178,105,128,54,53,79,128,169,169,227,121,193,51,161,207,234,108,190,182,194,43,136,171,77,3,180,169,181,248,89,219,137,233,242,57,155,175,158,232,116,251,62,245,169,79,123,95,251,218,
+215,189,119,189,235,189,55,136,175,224,119,66,146,160,118,139,79,38,39,143,45,49,137,67,135,233,77,234,185,239,108,126,227,181,253,189,239,125,159,247,250,235,175,223,192,210,210,87,110,16,159,47,165,
+240,187,244,184,76,61,208,168,86,226,103,45,39,243,215,209,57,155,223,184,240,7,14,28,246,126,252,227,31,223,36,190,98,112,112,196,23,94,135,30,151,77,19,180,170,122,2,28,57,50,93,96,253,157,14,253,
+82,103,243,27,123,182,19,135,151,94,250,100,168,240,138,201,201,233,155,18,0,152,89,101,234,130,86,85,21,127,98,226,104,39,115,215,76,120,191,239,108,190,242,70,221,220,220,41,239,183,191,253,143,178,
+226,195,99,143,253,221,77,226,243,193,42,26,223,54,109,208,172,154,9,176,104,158,192,172,253,206,230,227,11,191,99,199,211,242,92,255,114,44,225,225,220,185,11,55,136,110,194,34,89,75,2,84,239,149,
+241,248,248,84,145,121,251,58,180,66,157,205,199,19,93,239,198,61,255,252,187,189,98,177,24,75,248,175,124,229,159,189,183,189,237,237,161,194,43,120,99,104,234,131,102,213,18,191,199,114,112,127,88,
+210,217,124,252,190,251,200,200,62,239,251,223,255,65,44,225,95,125,245,85,239,212,169,51,101,133,7,190,138,198,181,216,52,66,187,13,39,192,216,216,228,101,118,201,208,97,193,166,179,249,120,194,115,
+206,143,126,244,227,177,237,254,147,159,252,244,245,79,229,150,19,94,135,201,182,166,78,104,183,33,241,165,143,191,73,40,209,215,215,97,226,162,179,249,104,225,225,248,241,25,111,117,245,215,177,132,
+255,233,79,127,230,119,5,147,136,174,195,88,140,169,83,160,221,166,141,36,64,175,121,80,186,29,206,230,195,69,7,42,200,229,203,47,199,174,245,151,46,253,125,197,194,3,31,184,4,222,199,88,146,160,183,
+226,4,56,116,104,34,207,104,147,14,111,252,156,205,219,133,135,231,158,123,167,247,231,63,255,57,150,240,95,255,250,43,126,99,122,163,194,43,120,83,104,234,133,134,27,73,128,162,121,64,250,157,206,
+230,111,102,96,96,216,91,94,254,78,44,225,95,123,237,53,239,236,217,11,85,17,93,135,225,120,75,2,84,214,27,56,120,112,188,75,240,116,232,251,59,155,191,153,23,94,248,112,108,187,255,204,103,62,39,61,
+168,183,84,85,120,184,255,254,7,124,24,19,48,117,67,203,74,18,96,202,60,16,187,118,56,155,255,27,12,207,94,185,114,37,150,240,191,248,197,47,164,85,126,164,102,194,43,120,68,91,18,96,42,113,2,72,109,
+47,80,227,117,88,187,214,206,54,175,96,31,194,207,127,254,31,99,215,250,15,124,224,131,85,21,221,38,188,130,71,180,169,27,90,38,78,0,177,146,53,236,68,135,29,54,219,213,230,213,80,236,197,139,207,120,
+127,252,227,31,99,9,255,173,111,125,219,219,187,183,191,102,181,221,228,190,251,222,232,235,97,234,134,150,73,197,239,176,28,228,38,235,111,7,155,215,95,190,48,72,19,71,248,63,253,233,79,146,40,207,
+214,85,120,5,191,111,211,14,77,99,39,128,244,245,179,244,247,117,216,167,175,157,108,222,124,243,198,155,207,56,226,23,10,95,240,223,220,213,210,230,109,194,235,176,134,192,212,15,77,147,36,64,206,60,
+0,141,139,118,177,121,27,135,14,141,69,10,255,203,95,254,210,155,154,154,174,107,109,15,131,100,181,36,64,252,181,132,163,163,7,23,24,85,210,161,1,216,14,54,111,3,27,223,182,173,59,84,252,23,94,120,
+177,172,213,215,90,248,123,239,237,186,14,13,65,83,63,52,141,157,0,185,220,129,60,219,172,235,48,188,217,234,54,111,19,94,231,217,103,23,110,16,254,59,223,249,174,216,237,80,67,108,222,38,188,130,55,
+181,166,126,104,154,36,1,150,205,3,208,245,105,117,155,143,154,116,161,96,175,131,185,185,211,210,183,30,107,168,205,219,132,87,208,78,179,36,64,252,221,69,70,70,246,175,178,115,149,14,111,155,90,221,
+230,147,190,130,109,164,205,219,216,186,245,13,62,196,203,212,15,77,147,36,192,186,121,0,222,254,181,131,205,87,91,244,122,10,175,224,186,45,9,176,30,59,1,134,135,247,93,101,249,145,14,182,210,46,54,
+159,134,218,94,137,240,10,142,111,234,135,166,177,19,96,104,104,244,26,159,95,209,41,39,188,179,249,198,212,246,48,76,253,208,52,73,2,148,204,3,56,155,79,183,240,247,220,115,255,13,88,18,160,20,59,1,
+6,7,115,37,70,254,116,156,205,167,203,230,195,132,87,152,250,161,105,146,4,184,102,75,0,103,243,233,177,249,48,225,129,127,183,36,64,252,71,192,192,192,200,85,62,110,160,67,27,192,217,124,186,108,222,
+228,238,187,239,243,225,88,166,126,104,26,59,1,250,251,135,215,121,161,160,67,47,192,217,124,186,108,222,20,94,193,117,155,250,161,105,146,4,88,53,15,192,56,128,179,249,244,216,188,77,120,5,49,178,36,
+64,252,129,160,190,190,161,101,166,127,233,48,18,232,108,254,129,212,213,118,27,84,82,83,63,52,77,146,0,121,243,0,188,11,112,54,159,94,225,239,186,235,222,235,48,113,199,146,0,241,95,6,245,246,14,46,
+176,252,75,135,87,140,206,230,211,99,243,54,225,21,124,137,197,212,15,77,99,39,192,222,189,3,57,246,253,209,97,5,170,179,249,244,216,188,77,120,5,149,213,212,15,77,147,36,64,214,60,0,91,193,56,155,79,
+143,205,219,216,178,101,171,15,43,132,44,9,16,127,74,216,158,61,253,29,124,214,204,196,180,126,103,243,141,179,121,155,240,192,239,219,180,67,211,68,51,131,229,15,214,204,131,208,21,116,54,159,14,155,
+55,133,87,16,95,139,248,107,137,215,5,236,222,221,87,96,34,168,14,61,1,103,243,233,169,237,54,168,164,166,110,104,153,56,1,118,237,234,157,98,211,1,157,39,159,124,155,179,249,148,10,127,231,157,247,
+248,240,49,74,83,55,180,172,36,1,186,204,3,245,244,236,117,54,159,2,155,183,9,175,96,185,185,37,1,42,251,178,136,8,94,68,116,29,6,25,156,205,55,182,182,219,132,7,226,111,234,133,134,21,239,15,32,127,
+156,55,15,200,250,64,103,243,141,181,249,48,24,174,183,36,64,229,27,68,136,157,244,98,41,58,244,49,157,205,55,214,230,77,238,184,227,110,31,166,172,155,122,161,225,70,18,96,147,80,50,15,202,171,97,
+103,243,141,177,121,155,240,64,220,45,226,163,93,229,155,68,81,158,126,122,247,101,70,1,117,248,168,161,179,249,198,212,118,83,120,5,171,129,76,157,208,110,195,251,4,238,220,185,171,135,197,134,38,
+244,4,156,205,215,223,230,109,112,124,155,70,104,87,149,221,66,229,64,69,243,224,52,56,156,205,215,215,230,109,220,126,251,93,254,116,61,139,248,213,217,42,150,34,13,191,69,26,127,58,12,10,57,155,175,
+175,205,155,194,43,248,110,128,169,15,154,85,51,1,58,45,39,240,199,4,156,205,215,199,230,77,209,21,234,75,98,22,170,251,1,169,29,59,222,94,96,143,0,29,150,140,59,155,223,218,16,225,21,12,253,154,186,
+160,85,213,191,24,34,125,204,44,253,76,19,92,192,217,124,237,109,62,172,246,219,52,65,171,154,124,55,72,14,188,100,158,140,231,143,179,249,250,212,118,69,103,231,22,255,191,204,252,177,136,95,155,143,
+70,81,158,122,106,103,150,169,97,38,124,56,194,217,124,109,133,71,116,29,90,254,54,45,208,168,166,223,14,148,19,228,109,39,102,92,192,217,124,237,133,7,238,45,68,252,218,126,56,146,34,221,191,78,186,
+128,38,219,182,109,119,54,95,101,155,15,131,49,24,155,6,104,83,151,239,7,203,115,127,158,103,191,9,239,8,156,205,87,183,182,235,220,118,219,157,126,195,207,22,123,52,169,235,23,196,229,132,171,182,11,
+225,81,224,108,190,250,194,3,247,27,34,126,125,63,31,79,121,252,241,183,118,51,14,96,194,188,65,103,243,27,183,121,93,120,5,11,62,108,49,71,139,76,35,138,156,248,146,237,130,232,21,56,155,175,142,232,
+10,246,102,12,17,255,82,166,145,69,250,162,43,244,71,77,232,166,56,155,223,184,240,192,99,213,22,99,98,159,105,116,217,190,253,201,46,161,196,144,164,9,11,73,156,205,87,46,60,48,192,102,139,109,16,
+243,174,76,26,138,92,72,46,228,34,253,236,117,54,159,76,116,184,245,214,59,124,7,13,139,43,49,207,164,169,116,119,63,177,200,76,33,19,38,145,50,113,196,217,252,150,88,162,43,136,9,177,179,197,148,88,
+103,210,88,228,194,10,182,11,166,103,96,75,2,103,243,55,11,175,196,39,102,33,226,23,50,105,46,146,181,203,100,174,137,158,4,206,230,237,194,3,143,73,98,101,139,33,177,205,164,189,200,197,119,8,43,220,
+132,13,218,4,206,230,237,48,120,22,22,183,32,166,29,153,102,40,114,161,155,133,43,97,55,67,239,160,221,109,222,4,119,140,16,159,88,110,206,52,83,217,182,109,251,102,97,133,151,68,54,24,39,104,87,155,
+215,185,229,150,219,253,10,17,22,167,32,134,205,37,190,150,4,29,194,114,216,205,49,98,136,237,181,147,205,43,209,129,251,97,70,85,132,248,196,174,35,211,236,229,209,71,187,11,140,99,135,65,187,160,29,
+108,94,9,15,12,240,68,197,132,152,101,90,169,200,13,45,70,221,48,175,146,25,248,104,85,155,87,112,205,60,254,202,136,191,152,105,197,242,200,35,143,229,132,18,203,152,194,224,125,119,51,8,159,68,116,
+80,13,189,168,123,15,98,147,203,180,114,121,248,225,183,116,9,43,204,106,9,131,182,1,235,13,154,221,230,21,180,115,216,186,37,234,158,131,152,116,101,218,165,200,205,94,42,19,144,235,83,206,155,205,
+230,21,234,11,94,229,238,147,88,100,218,177,60,244,208,182,110,97,85,240,162,32,17,176,79,30,13,105,182,121,224,239,152,27,137,240,229,238,43,184,247,238,76,187,23,9,194,124,140,96,249,208,70,96,184,
+52,109,194,211,133,165,55,19,247,62,184,231,140,43,127,43,242,220,239,20,242,60,255,227,64,13,99,151,18,149,12,141,176,121,68,199,153,184,150,184,215,29,220,99,167,83,60,164,72,99,41,43,44,209,104,
+138,11,143,8,70,211,104,47,48,180,172,39,68,181,68,231,103,30,65,52,232,112,33,206,153,228,26,131,123,202,58,133,147,37,66,33,97,144,175,67,95,27,75,166,55,65,99,140,196,80,109,8,149,24,74,100,126,86,
+203,173,232,109,80,179,113,22,18,138,99,240,189,164,74,175,35,184,7,39,124,165,69,106,90,167,176,40,20,169,117,77,66,49,184,102,103,245,85,78,134,30,225,178,80,74,161,232,165,224,218,122,156,82,53,46,
+210,232,218,36,244,10,121,161,72,35,172,65,20,131,107,224,90,54,57,101,26,84,178,217,55,119,9,83,66,65,88,99,14,125,141,88,11,206,193,185,186,92,228,211,155,16,29,66,86,200,9,11,66,94,88,22,86,133,
+117,225,170,112,77,40,5,92,11,254,223,122,240,59,203,193,223,44,4,199,224,88,29,46,178,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,169,41,243,243,11,
+29,66,86,200,9,11,66,94,88,22,86,133,117,225,170,112,77,40,5,92,11,254,223,122,240,59,203,193,223,44,4,199,224,88,110,40,56,197,130,119,9,83,66,65,88,19,188,26,177,22,156,131,115,185,151,65,141,42,23,
+47,62,183,73,232,21,242,66,81,240,26,68,49,184,6,174,197,189,14,174,117,185,112,225,217,30,225,178,80,18,188,148,81,10,174,205,77,8,169,178,232,157,194,162,80,76,161,232,97,20,131,107,118,83,194,42,
+45,231,207,63,147,21,10,130,87,9,51,51,167,188,241,241,41,47,151,59,224,245,245,13,249,223,209,99,71,109,246,215,99,187,21,22,97,170,53,121,252,204,70,12,236,190,197,239,240,201,181,222,222,65,111,
+100,100,191,55,54,54,233,157,56,113,210,171,244,58,130,123,112,147,66,19,10,191,148,36,200,103,207,94,244,142,28,153,246,134,134,70,253,47,102,33,166,90,105,91,102,49,102,217,101,91,106,33,7,199,226,
+115,44,3,3,35,222,196,196,81,255,156,9,19,97,201,37,66,68,57,119,110,190,83,200,11,94,28,230,230,206,120,251,247,31,246,107,182,185,188,122,163,162,235,194,71,193,199,153,70,71,15,122,179,179,167,189,
+184,215,29,220,163,123,52,232,69,106,211,60,53,42,14,135,14,77,88,69,175,102,109,15,35,106,197,15,201,112,224,192,152,23,247,62,184,103,39,252,217,139,221,194,106,185,96,241,60,31,28,204,249,251,228,
+165,77,120,208,23,130,112,61,180,57,104,55,196,72,2,238,189,61,23,135,158,57,115,225,146,224,69,113,236,216,172,223,24,171,133,232,213,22,222,198,174,93,189,222,244,244,140,87,238,62,137,69,59,9,223,
+37,172,68,5,132,26,79,45,74,99,109,143,35,188,185,104,100,247,238,62,223,17,202,36,1,49,105,237,209,197,211,167,207,231,132,146,224,133,49,60,188,207,223,33,43,205,54,31,87,120,29,254,157,30,68,212,
+189,7,177,105,205,45,98,78,157,58,183,40,120,97,208,103,167,15,222,108,54,95,110,201,152,185,154,136,118,204,225,195,71,188,168,88,16,171,86,19,191,16,117,195,253,253,195,77,111,243,229,132,55,217,
+179,167,191,92,18,52,255,54,113,39,79,158,237,16,150,5,207,198,228,228,49,255,107,151,173,98,243,113,132,215,151,154,49,242,200,160,82,88,124,130,216,117,52,171,248,155,133,149,176,155,219,183,239,80,
+203,218,124,57,225,77,24,114,142,72,2,98,216,92,91,197,206,205,157,217,44,92,97,180,206,6,150,223,14,54,95,110,177,41,155,88,40,232,41,132,197,43,136,229,230,102,17,191,67,88,9,187,25,250,198,237,100,
+243,229,132,215,225,93,67,68,18,16,211,244,63,14,102,103,79,47,51,54,110,66,63,152,23,53,237,106,243,81,194,43,216,138,134,79,193,17,43,91,12,137,109,170,197,159,153,57,85,96,16,199,228,248,241,57,
+191,177,215,238,54,31,37,188,14,93,69,70,65,109,177,36,198,105,21,127,49,174,248,237,108,243,97,162,219,146,128,216,133,36,65,186,198,9,196,178,114,216,150,13,222,146,57,155,143,47,252,131,15,190,233,
+58,76,94,9,139,43,49,79,139,248,93,66,201,118,145,188,182,117,54,159,92,120,29,70,71,67,18,128,152,55,254,221,129,216,212,10,86,101,178,119,239,128,179,249,10,69,215,97,3,76,42,146,45,198,196,190,161,
+226,75,67,229,18,141,21,19,94,232,56,155,175,92,120,68,55,97,236,196,22,107,52,104,148,248,221,182,11,98,198,142,179,249,234,9,175,195,140,163,144,36,168,255,164,146,233,233,153,85,38,59,152,60,241,
+196,14,103,243,21,216,124,20,236,77,12,52,166,109,49,71,139,122,139,63,111,187,16,134,51,157,205,87,167,182,43,209,77,232,85,133,36,65,125,230,24,30,61,122,162,83,240,76,152,29,235,108,190,118,194,43,
+216,188,154,54,150,77,3,180,169,121,2,76,77,29,207,11,158,9,125,86,103,243,181,21,94,65,92,109,26,160,77,173,197,207,218,78,76,151,207,217,124,245,69,55,133,215,161,107,24,146,4,181,91,124,50,57,121,
+108,137,73,28,58,76,111,82,207,125,103,243,213,175,237,54,248,82,10,191,71,143,203,212,3,141,106,37,126,214,114,50,127,29,157,179,249,250,9,175,67,143,203,166,9,90,85,61,1,142,28,153,46,176,254,78,
+135,126,169,179,249,218,217,252,248,248,164,247,133,47,92,246,190,248,197,47,121,39,78,204,221,148,0,192,204,42,83,23,180,170,170,248,19,19,71,59,153,187,102,194,251,125,103,243,213,175,237,185,220,
+126,239,235,95,127,197,123,253,245,215,111,96,113,241,61,55,136,207,7,171,104,124,219,180,65,179,106,38,192,162,121,2,179,246,59,155,223,184,240,123,247,246,123,47,191,252,197,155,132,87,188,246,218,
+107,190,232,38,44,146,181,36,64,245,94,25,143,143,79,21,153,183,175,67,43,212,217,252,198,109,30,118,236,120,218,251,204,103,62,27,42,188,14,241,48,19,128,55,134,166,62,104,86,45,241,123,44,7,247,135,
+37,157,205,111,172,81,247,150,183,108,247,62,246,177,79,196,18,30,126,240,131,127,189,73,124,190,138,198,181,216,52,66,187,13,39,192,216,216,228,101,118,201,208,97,193,166,179,249,202,133,127,211,155,
+222,236,125,224,3,31,244,254,251,191,255,59,182,248,171,171,171,94,95,223,224,13,194,235,48,217,214,212,9,237,54,36,190,244,241,55,9,37,250,250,58,76,92,116,54,95,89,55,238,249,231,223,237,253,254,
+247,175,197,22,158,231,254,226,226,187,173,162,235,48,22,99,234,20,104,183,105,35,9,208,107,30,148,110,135,179,249,228,125,247,11,23,158,241,126,253,235,127,143,45,60,238,128,75,16,135,40,225,129,15,
+92,2,239,99,44,73,208,91,113,2,28,58,52,145,103,180,73,135,55,126,206,230,227,11,63,59,123,202,251,249,207,127,17,91,120,160,93,192,10,233,184,194,43,120,83,104,234,133,134,27,73,128,162,121,64,250,
+157,206,230,203,11,127,228,200,81,191,209,150,68,248,207,124,230,115,210,162,127,91,34,209,117,24,142,183,36,64,101,189,129,131,7,199,187,4,79,135,190,191,179,249,232,33,218,125,251,14,122,223,252,
+230,183,18,9,255,242,203,95,18,103,237,173,88,120,184,255,254,7,124,24,19,48,117,67,203,74,18,96,202,60,16,187,118,56,155,183,11,79,11,125,105,233,203,137,132,127,229,149,111,120,195,195,163,85,17,94,
+193,35,218,146,0,83,137,19,64,106,123,129,26,175,195,218,53,103,243,55,10,207,115,247,115,159,43,36,18,254,123,223,251,190,116,209,38,42,22,221,38,188,130,71,180,169,27,90,38,78,0,177,146,53,236,68,
+135,29,54,157,205,255,15,172,220,249,196,39,254,33,145,240,63,251,217,138,119,252,248,108,213,106,187,201,125,247,189,209,215,195,212,13,45,147,138,223,97,57,200,77,214,223,142,175,96,185,239,15,126,
+240,5,175,88,44,198,22,254,87,191,90,245,206,158,189,80,83,225,21,252,190,77,59,52,141,157,0,210,215,207,210,223,215,97,159,190,118,181,121,5,195,223,255,231,255,92,137,45,252,127,254,231,154,183,176,
+240,124,213,109,222,38,188,14,107,8,76,253,208,52,73,2,228,204,3,208,184,104,55,155,55,249,208,135,94,136,37,252,159,255,252,103,239,125,239,123,191,127,205,181,172,237,97,240,154,222,146,0,241,215,
+18,142,142,30,92,96,84,73,135,6,96,187,216,188,137,26,127,255,210,151,202,183,242,95,124,241,163,254,176,108,189,133,191,247,222,174,235,208,16,52,245,67,211,216,9,144,203,29,200,179,205,186,14,227,
+255,237,96,243,54,225,21,239,121,207,165,80,225,63,245,169,188,31,163,122,217,188,77,120,5,143,42,83,63,52,77,146,0,203,230,1,216,130,189,29,108,222,38,188,206,183,191,253,47,55,8,255,79,255,116,217,
+235,233,217,83,119,155,183,9,175,160,157,102,73,128,248,187,139,140,140,236,95,101,231,42,29,108,173,29,108,62,10,37,240,228,228,81,111,126,254,89,175,183,119,160,97,54,111,99,235,214,55,248,16,47,83,
+63,52,77,146,0,235,230,1,120,251,215,14,54,31,38,122,45,6,109,170,45,188,130,235,182,36,192,122,236,4,24,30,222,119,149,229,71,58,216,74,187,216,124,53,132,175,181,205,219,132,87,112,124,83,63,52,141,
+157,0,67,67,163,215,248,252,138,78,57,225,91,205,230,27,37,124,165,162,155,152,250,161,105,146,4,40,153,7,112,54,159,110,225,239,185,231,254,27,176,36,64,41,118,2,12,14,230,74,140,252,233,56,155,79,
+151,205,135,9,175,48,245,67,211,36,9,112,205,150,0,206,230,211,99,243,97,194,3,255,110,73,128,248,143,128,129,129,145,171,124,220,64,135,54,128,179,249,116,217,188,201,221,119,223,231,195,177,76,253,
+208,52,118,2,244,247,15,175,243,66,65,135,94,128,179,249,116,217,188,41,188,130,235,54,245,67,211,36,9,176,106,30,128,113,0,103,243,233,177,121,155,240,10,98,100,73,128,248,3,65,125,125,67,203,76,255,
+210,97,36,208,217,252,3,169,171,237,54,168,164,166,126,104,154,36,1,242,230,1,120,23,224,108,62,189,194,223,117,215,189,215,97,226,142,37,1,226,191,12,234,237,29,92,96,249,151,14,175,24,157,205,167,
+199,230,109,194,43,248,18,139,169,31,154,198,78,128,189,123,7,114,236,251,163,195,10,84,103,243,233,177,121,155,240,10,42,171,169,31,154,38,73,128,172,121,0,182,130,113,54,159,30,155,183,177,101,203,
+86,31,102,42,91,18,32,254,148,176,61,123,250,59,248,172,153,137,105,253,206,230,27,103,243,54,225,129,223,183,105,135,166,137,102,6,203,31,172,153,7,161,43,232,108,62,29,54,111,10,175,32,190,22,241,
+215,18,175,11,216,189,187,175,192,68,80,29,122,2,206,230,211,83,219,109,80,73,77,221,208,50,113,2,236,218,245,255,179,247,174,239,113,93,229,253,247,252,1,126,163,151,126,157,68,73,156,196,73,16,249,
+181,233,51,252,46,114,48,200,79,226,224,56,145,15,146,37,75,35,159,45,75,150,109,249,124,82,18,1,162,212,148,83,161,45,4,168,10,157,130,67,77,128,62,45,84,64,129,146,160,82,2,63,65,161,15,2,90,42,242,
+116,174,188,242,91,191,152,245,220,159,157,189,157,229,229,181,103,246,140,246,204,236,209,220,235,186,62,23,194,145,246,225,254,222,235,187,215,90,123,173,181,251,39,216,116,192,102,211,166,167,213,
+230,51,42,252,221,119,223,23,192,199,40,93,221,208,178,158,4,232,113,15,212,215,183,67,109,62,3,54,239,19,62,130,189,155,60,9,80,223,151,69,68,240,18,162,219,48,200,160,54,223,218,218,238,19,30,136,
+191,171,23,26,214,189,63,128,252,241,156,123,64,214,7,170,205,183,214,230,227,96,184,222,147,0,245,111,16,33,118,210,143,165,216,208,199,84,155,111,173,205,187,220,117,215,189,1,124,158,207,213,11,13,
+87,146,0,107,132,178,123,80,223,94,117,106,243,205,177,121,159,240,64,220,61,226,163,93,253,155,68,81,158,121,102,219,21,70,1,109,88,26,173,54,223,154,218,238,10,31,193,106,32,87,39,180,91,241,62,129,
+91,182,108,237,99,177,161,11,61,1,181,249,230,219,188,15,142,239,211,8,237,82,217,45,84,14,84,114,15,238,91,0,169,54,223,88,155,247,113,231,157,247,4,211,245,60,226,167,179,85,44,69,26,126,179,52,254,
+108,24,20,82,155,111,174,205,187,194,71,240,221,0,87,31,52,75,51,1,186,61,39,8,198,4,212,230,155,99,243,174,232,17,209,151,196,60,164,251,1,169,205,155,159,45,178,71,128,13,203,161,213,230,215,183,68,
+248,8,134,126,93,93,208,42,245,47,134,72,31,51,79,63,211,5,23,80,155,111,188,205,199,213,126,159,38,104,213,144,239,6,201,129,175,186,39,227,249,163,54,223,156,218,30,209,221,189,46,248,95,102,254,
+120,196,111,204,71,163,40,79,61,181,37,207,212,48,23,62,28,161,54,223,88,225,17,221,134,150,191,79,11,52,106,232,183,3,229,4,115,190,19,51,46,160,54,223,120,225,129,123,139,17,191,177,31,142,164,72,
+247,175,155,46,160,11,187,91,171,205,167,107,243,113,48,6,227,211,0,109,154,242,253,96,121,238,79,243,236,119,225,29,129,218,124,186,181,221,230,142,59,238,14,26,126,190,216,163,73,83,191,32,46,39,92,
+244,93,8,143,2,181,249,244,133,7,238,55,70,252,230,126,62,158,242,196,19,239,233,101,28,192,133,121,131,106,243,43,183,121,91,248,8,22,124,248,98,142,22,185,86,20,57,241,101,223,5,209,43,80,155,79,71,
+244,8,246,102,140,17,255,114,174,149,69,250,162,11,244,71,93,232,166,168,205,175,92,120,224,177,234,139,49,177,207,181,186,108,220,184,169,71,40,51,36,233,194,66,18,181,249,250,133,7,6,216,124,177,13,
+99,222,147,203,66,145,11,41,196,92,100,144,189,106,243,181,137,14,183,223,126,87,224,160,113,113,37,230,185,44,149,222,222,39,103,153,41,228,194,36,82,38,142,168,205,175,75,36,122,4,49,33,118,190,152,
+18,235,92,22,139,92,88,209,119,193,244,12,124,73,160,54,127,171,240,145,248,196,44,70,252,98,46,203,69,178,118,158,204,117,177,147,64,109,222,47,60,240,152,36,86,190,24,18,219,92,214,139,92,124,151,
+176,192,77,248,160,77,160,54,239,135,193,179,184,184,133,49,237,202,181,67,145,11,93,43,188,22,119,51,244,14,58,221,230,93,112,199,10,226,19,203,181,185,118,42,27,54,108,92,43,44,240,146,200,7,227,4,
+157,106,243,54,183,221,118,103,80,33,226,226,20,198,176,189,196,183,146,160,75,152,143,187,57,70,12,177,189,78,178,249,72,116,224,126,152,81,85,65,124,98,215,149,107,247,242,248,227,189,69,198,177,
+227,160,93,208,9,54,31,9,15,12,240,84,138,9,49,203,173,166,34,55,52,91,233,134,121,149,204,192,199,106,181,249,8,174,153,199,95,21,241,103,115,171,177,60,246,216,187,11,66,153,101,76,113,240,190,187,
+29,132,175,69,116,136,26,122,149,238,61,140,77,33,183,154,203,163,143,190,171,71,88,96,86,75,28,180,13,88,111,208,238,54,31,65,59,135,173,91,42,221,115,24,147,158,92,167,20,185,217,203,85,2,114,99,
+202,121,187,217,124,68,244,5,175,106,247,73,44,114,157,88,30,121,100,67,175,176,40,152,74,144,8,216,39,143,134,44,219,60,240,119,204,141,68,248,106,247,21,222,123,111,174,211,139,4,97,58,65,176,2,104,
+35,48,92,154,53,225,233,194,210,155,73,122,31,220,115,78,203,91,69,158,251,221,194,28,207,255,36,80,195,216,165,36,74,134,86,216,60,162,227,76,92,75,210,235,14,239,177,91,21,143,41,210,88,202,11,87,
+105,52,37,133,71,4,163,105,180,23,24,90,182,19,34,45,209,249,153,71,16,13,58,92,136,115,214,114,141,225,61,229,85,225,218,18,161,88,99,144,111,64,95,27,75,166,55,65,99,140,196,136,218,16,81,98,68,34,
+243,115,180,220,138,222,6,53,27,103,33,161,56,6,223,75,170,247,58,194,123,80,225,235,45,82,211,186,133,89,161,68,173,107,19,74,225,53,171,213,167,156,12,125,194,21,161,156,65,209,203,225,181,245,169,
+82,13,46,210,232,90,35,244,11,115,66,137,70,88,139,40,133,215,192,181,172,81,101,90,84,242,249,119,246,8,19,66,81,88,98,14,125,131,88,10,207,193,185,122,52,242,217,77,136,46,33,47,20,132,25,97,78,152,
+23,22,133,101,225,154,112,93,40,135,92,15,255,109,57,252,157,249,240,111,102,194,99,112,172,46,141,172,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,100,166,76,79,207,
+116,9,121,161,32,204,8,115,194,188,176,40,44,11,215,132,235,66,57,228,122,248,111,203,225,239,204,135,127,51,19,30,131,99,233,80,112,134,5,239,17,38,132,162,176,36,152,6,177,20,158,131,115,233,203,
+160,86,149,75,151,94,88,35,244,11,115,66,73,48,45,162,20,94,3,215,162,175,131,27,93,46,94,124,190,79,184,34,148,5,147,49,202,225,181,233,132,144,148,69,239,22,102,133,82,6,69,143,163,20,94,179,78,9,
+171,183,92,184,240,92,94,40,10,166,30,166,166,78,155,67,135,38,76,161,176,215,12,12,236,10,190,163,199,142,218,236,175,199,118,43,44,194,140,214,228,241,51,27,49,176,251,22,191,195,39,215,250,251,135,
+204,200,200,30,115,240,224,184,57,126,252,148,169,247,58,194,123,208,73,161,53,10,127,181,150,32,159,59,119,201,28,62,60,105,118,237,26,13,190,152,133,152,209,74,219,42,139,49,171,46,219,138,22,114,
+112,44,62,199,50,56,56,98,198,198,142,4,231,172,49,17,174,106,34,84,40,231,207,79,119,11,115,130,73,194,201,147,103,205,158,61,7,130,154,237,46,175,94,169,232,182,240,149,224,227,76,163,163,251,204,
+137,19,103,76,210,235,14,239,81,31,13,118,145,218,52,77,141,74,194,254,253,99,94,209,211,172,237,113,84,90,241,67,50,236,221,123,208,36,189,15,238,89,133,63,119,169,87,88,172,22,44,158,231,67,67,133,
+96,159,188,172,9,15,246,66,16,174,135,54,7,237,134,4,73,192,189,119,230,226,208,179,103,47,94,22,76,37,142,30,61,17,52,198,26,33,122,218,194,251,216,186,181,223,76,78,78,153,106,247,73,44,58,73,248,
+30,97,161,82,64,168,241,212,162,44,214,246,36,194,187,139,70,182,109,27,8,28,161,74,18,16,147,213,61,186,120,230,204,133,130,80,22,76,28,195,195,187,131,29,178,178,108,243,73,133,183,225,191,211,131,
+168,116,239,97,108,86,231,22,49,167,79,159,159,21,76,28,244,217,233,131,183,155,205,87,91,50,230,174,38,162,29,115,224,192,97,83,41,22,196,106,181,137,95,172,116,195,59,119,14,183,189,205,87,19,222,
+101,251,246,157,213,146,160,253,183,137,59,117,234,92,151,48,47,24,31,227,227,71,131,175,93,174,22,155,79,34,188,189,212,140,145,71,6,149,226,226,19,198,174,171,93,197,95,43,44,196,221,220,238,221,
+251,87,173,205,87,19,222,133,33,231,10,73,64,12,219,107,171,216,147,39,207,174,21,94,99,180,206,7,150,223,9,54,95,109,177,41,155,88,68,208,83,136,139,87,24,203,181,237,34,126,151,176,16,119,51,244,
+141,59,201,230,171,9,111,195,187,134,10,73,64,76,179,255,56,56,113,226,204,60,99,227,46,244,131,121,81,211,169,54,95,73,248,8,182,162,225,83,112,196,202,23,67,98,155,105,241,167,166,78,23,25,196,113,
+57,118,236,100,208,216,235,116,155,175,36,188,13,93,69,70,65,125,177,36,198,89,21,127,54,169,248,157,108,243,113,162,251,146,128,216,197,36,65,182,198,9,196,178,10,216,150,15,222,146,169,205,39,23,
+254,225,135,223,113,3,38,175,196,197,149,152,103,69,252,30,161,236,187,72,94,219,170,205,215,46,188,13,163,163,49,9,64,204,91,255,238,64,108,106,1,171,114,217,177,99,80,109,190,78,209,109,216,0,147,
+138,228,139,49,177,111,169,248,210,80,185,76,99,197,133,23,58,106,243,245,11,143,232,46,140,157,248,98,141,6,173,18,191,215,119,65,204,216,81,155,79,79,120,27,102,28,197,36,65,243,39,149,76,78,78,45,
+50,217,193,229,201,39,55,171,205,215,97,243,149,96,111,98,160,49,237,139,57,90,52,91,252,105,223,133,48,156,169,54,159,78,109,143,68,119,161,87,21,147,4,205,153,99,120,228,200,241,110,193,184,48,59,
+86,109,190,113,194,71,176,121,53,109,44,159,6,104,211,240,4,152,152,56,54,39,24,23,250,172,106,243,141,21,62,130,184,250,52,64,155,70,139,159,247,157,152,46,159,218,124,250,162,187,194,219,208,53,140,
+73,130,198,45,62,25,31,63,122,149,73,28,54,76,111,138,158,251,106,243,233,215,118,31,124,41,133,223,163,199,229,234,129,70,141,18,63,239,57,89,176,142,78,109,190,121,194,219,208,227,242,105,130,86,
+169,39,192,225,195,147,69,214,223,217,208,47,85,155,111,156,205,199,9,111,195,204,42,87,23,180,74,85,252,177,177,35,221,204,93,115,225,253,190,218,124,115,106,187,15,62,88,69,227,219,167,13,154,165,
+153,0,179,238,9,220,218,175,54,223,28,225,17,221,133,69,178,158,4,72,239,149,241,161,67,19,37,230,237,219,208,10,85,155,111,142,205,159,57,115,222,124,234,83,47,154,233,233,23,188,9,192,27,67,87,31,
+52,75,75,252,62,207,193,131,97,73,181,249,198,137,222,219,251,132,249,240,135,63,106,254,227,63,254,95,243,198,27,111,220,224,59,223,249,231,155,196,231,171,104,92,139,79,35,180,91,113,2,28,60,56,126,
+133,93,50,108,88,176,169,54,223,24,225,7,7,135,205,23,190,240,55,55,137,238,50,61,253,124,32,188,13,147,109,93,157,208,110,69,226,75,31,127,141,80,166,175,111,195,196,69,181,249,116,133,63,122,116,
+202,124,243,155,255,84,81,248,136,191,248,139,79,221,146,0,140,197,184,58,133,218,173,89,73,2,244,187,7,165,219,161,54,159,142,232,196,240,253,239,255,128,249,201,79,126,154,72,248,136,83,167,206,220,
+36,62,31,184,4,222,199,120,146,160,191,238,4,216,191,127,108,142,209,38,27,222,248,169,205,175,76,248,103,159,221,22,52,234,94,127,253,245,154,132,135,151,94,250,242,45,194,71,240,166,208,213,11,13,
+87,146,0,37,247,128,244,59,213,230,235,19,254,192,129,49,243,242,203,95,173,89,116,248,250,215,255,31,233,218,77,220,34,186,13,195,241,158,4,168,175,55,176,111,223,161,30,193,216,208,247,87,155,175,
+77,116,254,251,197,139,211,230,149,87,94,173,89,244,82,169,100,62,251,217,191,10,26,120,149,132,135,7,31,124,40,128,49,1,87,55,180,172,39,1,38,220,3,177,107,135,218,124,50,225,105,40,127,244,163,31,
+55,191,254,245,175,107,22,254,103,63,251,153,249,192,7,62,24,212,232,164,194,71,240,136,246,36,192,68,205,9,32,181,189,72,141,183,97,237,154,218,124,101,225,135,135,71,205,223,254,237,23,235,178,249,
+111,125,235,219,102,106,234,100,85,209,125,194,71,240,136,118,117,67,203,154,19,64,172,100,9,59,177,97,135,77,181,121,63,39,78,156,10,4,172,71,120,18,102,215,174,66,221,162,71,60,240,192,219,3,61,92,
+221,208,178,86,241,187,60,7,185,197,250,59,221,230,233,123,99,213,139,139,63,171,89,116,30,13,31,251,216,199,165,198,110,74,69,248,8,126,223,167,29,154,38,78,0,233,235,231,233,239,219,176,79,159,218,
+252,155,240,156,253,236,103,63,23,52,210,106,21,254,213,87,95,53,23,46,92,242,118,227,86,34,188,13,107,8,92,253,208,180,150,4,40,184,7,224,166,245,21,236,195,230,252,249,139,117,217,60,221,191,3,7,14,
+53,76,116,27,94,211,123,18,32,249,90,194,209,209,125,51,140,42,217,208,0,212,87,176,127,104,126,251,219,255,76,44,58,3,61,159,254,244,139,230,153,103,182,54,92,248,251,239,239,185,1,13,65,87,63,52,77,
+156,0,133,194,222,57,182,89,183,161,91,211,73,54,239,123,247,206,50,247,36,194,255,244,167,63,53,239,123,223,172,60,46,223,217,84,225,35,120,83,235,234,135,166,181,36,192,188,123,0,182,96,239,164,153,
+54,62,248,251,223,253,238,191,99,133,231,101,206,209,163,199,155,98,243,62,225,35,104,167,121,18,32,249,238,34,35,35,123,22,217,185,202,134,22,111,167,205,180,113,161,225,246,220,115,47,220,34,60,175,
+111,119,238,220,213,146,218,110,179,126,253,219,2,136,151,171,31,154,214,146,0,203,238,1,120,115,213,9,54,239,19,221,133,119,246,31,250,208,135,205,123,223,251,126,113,198,141,153,17,62,130,235,246,
+36,192,114,226,4,24,30,222,125,141,229,71,54,216,74,39,216,124,37,225,125,175,96,91,101,243,62,225,35,56,190,171,31,154,38,78,128,93,187,70,175,243,249,21,155,106,194,175,38,155,111,165,240,245,138,
+238,226,234,135,166,181,36,64,217,61,64,167,217,124,45,162,103,65,248,251,238,123,240,38,60,9,80,78,156,0,67,67,133,50,35,127,54,106,243,217,178,249,56,225,35,92,253,208,180,150,4,184,238,75,0,181,
+249,236,216,124,156,240,192,127,247,36,64,242,71,192,224,224,200,53,62,110,96,67,27,64,109,62,91,54,239,114,239,189,15,4,112,44,87,63,52,77,156,0,59,119,14,47,243,66,193,134,94,128,218,124,182,108,
+222,21,62,130,235,118,245,67,211,90,18,96,209,61,0,227,0,106,243,217,177,121,159,240,17,196,200,147,0,201,7,130,6,6,118,205,51,253,203,134,145,64,181,249,135,50,87,219,125,80,73,93,253,208,180,150,4,
+152,115,15,192,187,0,181,249,236,10,127,207,61,247,223,128,137,59,158,4,72,254,50,168,191,127,104,134,229,95,54,188,98,84,155,207,142,205,251,132,143,224,75,44,174,126,104,154,56,1,118,236,24,44,176,
+239,143,13,43,80,213,230,179,99,243,62,225,35,168,172,174,126,104,90,75,2,228,221,3,176,21,140,218,124,118,108,222,199,186,117,235,3,88,33,228,73,128,228,83,194,182,111,223,217,197,103,205,92,92,235,
+87,155,111,157,205,251,132,7,126,223,167,29,154,214,52,51,88,254,96,201,61,8,93,65,181,249,108,216,188,43,124,4,241,245,136,191,84,243,186,128,109,219,6,138,76,4,181,161,39,160,54,159,157,218,238,131,
+74,234,234,134,150,53,39,192,214,173,253,19,172,73,179,217,180,233,105,181,249,140,10,127,247,221,247,5,240,49,74,87,55,180,172,39,1,122,220,3,245,245,237,80,155,207,128,205,251,132,143,96,239,38,79,
+2,212,247,101,17,17,188,132,232,54,12,50,168,205,183,182,182,251,132,7,226,239,234,133,134,117,239,15,32,127,60,231,30,144,245,129,106,243,173,181,249,56,24,174,247,36,64,253,27,68,136,157,244,99,41,
+54,244,49,213,230,91,107,243,46,119,221,117,111,0,235,22,92,189,208,112,37,9,176,70,40,187,7,229,213,176,218,124,107,108,222,39,60,16,119,143,248,104,87,255,38,81,148,103,158,217,118,133,81,64,27,62,
+106,168,54,223,154,218,238,10,31,193,106,32,87,39,180,91,241,62,129,91,182,108,237,99,177,161,11,61,1,181,249,230,219,188,15,142,239,211,8,237,82,217,45,84,14,84,114,15,78,131,67,109,190,185,54,239,
+227,206,59,239,9,166,235,121,196,79,103,171,88,138,52,252,102,105,252,217,48,40,164,54,223,92,155,119,133,143,224,187,1,174,62,104,150,102,2,116,123,78,16,140,9,168,205,55,199,230,93,209,35,162,47,
+137,121,72,247,3,82,155,55,63,91,100,143,0,27,150,140,171,205,175,111,137,240,17,12,253,186,186,160,85,234,95,12,145,62,102,158,126,166,11,46,160,54,223,120,155,143,171,253,62,77,208,170,33,223,13,
+146,3,95,117,79,198,243,71,109,190,57,181,61,162,187,123,93,240,191,204,252,241,136,223,152,143,70,81,158,122,106,75,158,169,97,46,124,56,66,109,190,177,194,35,186,13,45,127,159,22,104,212,208,111,7,
+202,9,230,124,39,102,92,64,109,190,241,194,3,247,22,35,126,99,63,28,73,145,238,95,55,93,64,151,13,27,54,170,205,167,108,243,113,48,6,227,211,0,109,154,242,253,96,121,238,79,243,236,119,225,29,129,218,
+124,186,181,221,230,142,59,238,14,26,126,190,216,163,73,83,191,32,46,39,92,244,93,8,143,2,181,249,244,133,7,238,55,70,252,230,126,62,158,242,196,19,239,233,101,28,192,133,121,131,106,243,43,183,121,
+91,248,8,22,124,248,98,142,22,185,86,20,57,241,101,223,5,209,43,80,155,79,71,244,8,246,102,140,17,255,114,174,149,69,250,162,11,244,71,93,232,166,168,205,175,92,120,224,177,234,139,49,177,207,181,186,
+108,220,184,169,71,40,51,36,233,194,66,18,181,249,250,133,7,6,216,124,177,13,99,222,147,203,66,145,11,41,196,92,100,144,189,106,243,181,137,14,183,223,126,87,224,160,113,113,37,230,185,44,149,222,222,
+39,103,153,41,228,194,36,82,38,142,168,205,175,75,36,122,4,49,33,118,190,152,18,235,92,22,139,92,88,209,119,193,244,12,124,73,160,54,127,171,240,145,248,196,44,70,252,98,46,203,69,178,118,158,204,117,
+177,147,64,109,222,47,60,240,152,36,86,190,24,18,219,92,214,139,92,124,151,176,192,77,248,160,77,160,54,239,135,193,179,184,184,133,49,237,202,181,67,145,11,93,43,188,22,119,51,244,14,58,221,230,93,
+112,199,10,226,19,203,181,185,118,42,27,54,108,92,43,44,240,146,200,7,227,4,157,106,243,54,183,221,118,103,80,33,226,226,20,198,176,189,196,183,146,160,75,152,143,187,57,70,12,177,189,78,178,249,72,
+116,224,126,152,81,85,65,124,98,215,149,107,247,242,248,227,189,69,198,177,227,160,93,208,9,54,31,9,15,12,240,84,138,9,49,203,173,166,34,55,52,91,233,134,121,149,204,192,199,106,181,249,8,174,153,199,
+95,21,241,103,115,171,177,60,246,216,187,11,66,153,101,76,113,240,190,187,29,132,175,69,116,136,26,122,149,238,61,140,77,33,183,154,203,163,143,190,171,71,88,96,86,75,28,180,13,88,111,208,238,54,31,
+65,59,135,173,91,42,221,115,24,147,158,92,167,20,185,217,203,85,2,114,99,202,121,187,217,124,68,244,5,175,106,247,73,44,114,157,88,30,121,100,67,175,176,200,103,210,43,65,34,96,159,60,26,178,108,243,
+192,223,49,55,18,225,171,221,87,120,239,189,185,78,47,18,132,233,4,193,10,160,141,192,112,105,214,132,167,11,75,111,38,233,125,112,207,57,45,111,21,121,238,119,11,115,60,255,147,64,13,99,151,146,40,
+25,90,97,243,136,142,51,113,45,73,175,59,188,199,110,85,60,166,72,99,41,47,92,165,209,148,20,30,17,140,166,209,94,96,104,217,78,136,180,68,231,103,30,65,52,232,112,33,206,89,203,53,134,247,148,87,133,
+107,75,132,98,141,65,190,1,125,109,44,153,222,4,141,49,18,35,106,67,68,137,17,137,204,207,209,114,43,122,27,212,108,156,133,132,226,24,124,47,169,222,235,8,239,65,133,175,183,72,77,235,22,102,133,18,
+181,174,77,40,133,215,172,86,159,114,50,244,9,87,132,114,6,69,47,135,215,214,167,74,53,184,72,163,107,141,208,47,204,9,37,26,97,45,162,20,94,3,215,178,70,149,105,81,201,231,223,217,35,76,8,69,97,137,
+57,244,13,98,41,60,7,231,234,209,200,103,55,33,186,132,188,80,16,102,132,57,97,94,88,20,150,133,107,194,117,161,28,114,61,252,183,229,240,119,230,195,191,153,9,143,193,177,186,52,178,90,180,104,209,
+162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,146,153,50,61,61,211,37,228,133,130,48,35,204,9,243,194,162,176,44,92,19,174,11,229,144,235,225,191,45,135,191,51,31,254,205,76,120,12,
+142,165,67,193,25,22,188,71,152,16,138,194,146,96,26,196,82,120,14,206,165,47,131,90,85,46,93,122,97,141,208,47,204,9,37,193,180,136,82,120,13,92,139,190,14,110,116,185,120,241,249,62,225,138,80,22,
+76,198,40,135,215,166,19,66,82,22,189,91,152,21,74,25,20,61,142,82,120,205,58,37,172,222,114,225,194,115,121,161,40,152,122,152,154,58,109,14,29,154,48,133,194,94,51,48,176,43,248,142,30,59,106,179,
+191,30,219,173,176,8,51,90,147,199,207,108,196,192,238,91,252,14,159,92,235,239,31,50,35,35,123,204,193,131,227,230,248,241,83,166,222,235,8,239,65,39,133,214,40,252,213,90,130,124,238,220,37,115,248,
+240,164,217,181,107,52,248,98,22,98,70,43,109,171,44,198,172,186,108,43,90,200,193,177,248,28,203,224,224,136,25,27,59,18,156,179,198,68,184,170,137,80,161,156,63,63,221,45,204,9,38,9,39,79,158,53,
+123,246,28,8,106,182,187,188,122,165,162,219,194,87,130,143,51,141,142,238,51,39,78,156,49,73,175,59,188,71,125,52,216,69,106,211,52,53,42,9,251,247,143,121,69,79,179,182,199,81,105,197,15,201,176,
+119,239,65,147,244,62,184,103,21,254,220,165,94,97,177,90,176,120,158,15,13,21,130,125,242,178,38,60,216,11,65,184,30,218,28,180,27,18,36,1,247,222,153,139,67,207,158,189,120,89,48,149,56,122,244,68,
+208,24,107,132,232,105,11,239,99,235,214,126,51,57,57,101,170,221,39,177,232,36,225,123,132,133,74,1,161,198,83,139,178,88,219,147,8,239,46,26,217,182,109,32,112,132,42,73,64,76,86,247,232,226,153,51,
+23,10,66,89,48,113,12,15,239,14,118,200,202,178,205,39,21,222,134,255,78,15,162,210,189,135,177,89,157,91,196,156,62,125,126,86,48,113,208,103,167,15,222,110,54,95,109,201,152,187,154,136,118,204,129,
+3,135,77,165,88,16,171,213,38,126,177,210,13,239,220,57,220,246,54,95,77,120,151,237,219,119,86,75,130,246,223,38,238,212,169,115,93,194,188,96,124,140,143,31,13,190,118,185,90,108,62,137,240,246,82,
+51,70,30,25,84,138,139,79,24,187,174,118,21,127,173,176,16,119,115,187,119,239,95,181,54,95,77,120,23,134,156,43,36,1,49,108,175,173,98,79,158,60,187,86,120,141,209,58,31,88,126,39,216,124,181,197,
+166,108,98,17,65,79,33,46,94,97,44,215,182,139,248,93,194,66,220,205,208,55,238,36,155,175,38,188,13,239,26,42,36,1,49,205,254,227,224,196,137,51,243,140,141,187,208,15,230,69,77,167,218,124,37,225,
+35,216,138,134,79,193,17,43,95,12,137,109,166,197,159,154,58,93,100,16,199,229,216,177,147,65,99,175,211,109,190,146,240,54,116,21,25,5,245,197,146,24,103,85,252,217,164,226,119,178,205,199,137,238,
+75,2,98,23,147,4,217,26,39,16,203,42,96,91,62,120,75,166,54,159,92,248,135,31,126,199,13,152,188,18,23,87,98,158,21,241,123,132,178,239,34,121,109,171,54,95,187,240,54,140,142,198,36,0,49,111,253,187,
+3,177,169,5,172,202,101,199,142,65,181,249,58,69,183,97,3,76,42,146,47,198,196,190,165,226,75,67,229,50,141,21,23,94,232,168,205,215,47,60,162,187,48,118,226,139,53,26,180,74,252,94,223,5,49,99,71,
+109,62,61,225,109,152,113,20,147,4,205,159,84,50,57,57,181,200,100,7,151,39,159,220,172,54,95,135,205,87,130,189,137,129,198,180,47,230,104,209,108,241,167,125,23,194,112,166,218,124,58,181,61,18,221,
+133,94,85,76,18,52,103,142,225,145,35,199,187,5,227,194,236,88,181,249,198,9,31,193,230,213,180,177,124,26,160,77,195,19,96,98,226,216,156,96,92,232,179,170,205,55,86,248,8,226,234,211,0,109,26,45,
+126,222,119,98,186,124,106,243,233,139,238,10,111,67,215,48,38,9,26,183,248,100,124,252,232,85,38,113,216,48,189,41,122,238,171,205,167,95,219,125,240,165,20,126,143,30,151,171,7,26,53,74,252,188,231,
+100,193,58,58,181,249,230,9,111,67,143,203,167,9,90,165,158,0,135,15,79,22,89,127,103,67,191,84,109,190,113,54,31,39,188,13,51,171,92,93,208,42,85,241,199,198,142,116,51,119,205,133,247,251,106,243,
+205,169,237,62,248,96,21,141,111,159,54,104,150,102,2,204,186,39,112,107,191,218,124,115,132,71,116,23,22,201,122,18,32,189,87,198,135,14,77,148,152,183,111,67,43,84,109,190,57,54,31,39,124,4,111,12,
+93,125,208,44,45,241,251,60,7,15,134,37,213,230,155,99,243,149,224,171,104,92,139,79,35,180,91,113,2,28,60,56,126,133,93,50,108,88,176,169,54,223,154,218,110,11,111,195,100,91,87,39,180,91,145,248,
+210,199,95,35,148,233,235,219,48,113,81,109,190,185,194,51,206,114,248,240,17,105,245,239,187,69,124,96,44,198,213,41,212,110,205,74,18,160,223,61,40,221,14,181,249,230,216,60,215,55,53,117,202,124,
+229,43,47,155,55,222,120,227,6,223,249,206,63,7,241,143,196,231,3,151,192,251,24,79,18,244,215,157,0,251,247,143,205,49,218,100,195,27,63,181,249,198,214,246,177,177,9,243,183,127,251,69,243,251,223,
+255,254,38,225,109,62,243,153,207,221,16,62,130,55,133,174,94,104,184,146,4,40,185,7,164,223,169,54,159,190,240,88,251,103,63,251,87,230,215,191,254,117,172,232,54,255,250,175,63,186,37,1,120,76,120,
+18,160,190,222,192,190,125,135,122,4,99,67,223,95,109,62,61,155,31,24,24,50,159,252,228,95,152,159,253,236,231,137,68,183,249,218,215,190,126,147,248,15,62,248,80,0,99,2,174,110,104,89,79,2,76,184,7,
+98,215,14,181,249,149,213,246,103,158,217,106,62,244,161,15,155,31,253,232,71,53,139,110,83,40,236,185,73,248,8,30,209,158,4,152,168,57,1,164,182,23,169,241,54,172,93,83,155,175,93,120,30,155,239,123,
+223,172,249,222,247,190,191,34,209,127,243,155,223,152,207,125,238,175,204,246,237,3,183,8,31,193,185,92,221,208,178,230,4,16,43,89,194,78,108,216,97,83,109,62,153,240,143,62,186,193,92,184,112,201,
+124,227,27,223,92,145,232,175,191,254,255,73,131,240,75,65,195,48,78,244,136,7,30,120,123,160,135,171,27,90,214,42,126,151,231,32,183,88,191,218,252,195,222,110,219,203,47,127,117,69,162,3,199,224,88,
+220,67,18,225,35,120,44,248,180,67,211,196,9,32,125,253,60,253,125,27,246,233,83,155,247,11,207,0,13,181,244,245,215,95,95,145,232,223,252,230,63,5,174,241,200,35,143,123,159,239,149,132,183,97,13,
+129,171,31,154,214,146,0,5,247,0,52,46,212,230,31,190,169,219,198,243,56,105,183,45,14,218,5,239,125,239,108,176,93,204,74,68,183,225,53,189,39,1,146,175,37,28,29,221,55,195,168,146,13,13,64,181,249,
+55,161,11,182,18,209,127,244,163,127,11,122,2,91,182,244,221,210,141,171,87,248,251,239,239,185,1,13,65,87,63,52,77,156,0,133,194,222,57,182,89,183,97,252,95,7,109,254,208,124,240,131,151,235,18,253,
+231,63,255,121,208,231,167,239,239,235,191,167,33,124,4,111,106,93,253,208,180,150,4,152,119,15,192,22,236,250,10,246,15,205,215,191,254,247,53,117,219,24,221,27,29,221,155,170,232,113,194,71,208,78,
+243,36,64,242,221,69,70,70,246,44,178,115,149,13,111,155,244,21,236,31,152,23,95,252,76,149,110,219,235,55,186,109,238,80,109,35,106,187,205,250,245,111,11,32,94,174,126,104,90,75,2,44,187,7,224,237,
+83,167,189,130,245,189,119,103,246,141,175,225,247,102,183,237,164,92,247,255,213,50,225,35,184,110,79,2,44,39,78,128,225,225,221,215,88,126,100,131,173,116,218,76,155,56,104,15,253,217,159,125,210,
+20,139,95,52,231,207,95,10,166,198,165,45,122,61,194,71,112,124,87,63,52,77,156,0,187,118,141,94,231,243,43,54,213,132,95,173,51,109,92,92,161,91,93,219,227,112,245,67,211,90,18,160,236,30,160,147,
+108,190,86,209,179,32,252,125,247,61,120,19,158,4,40,39,78,128,161,161,66,153,145,63,155,78,179,249,102,212,246,70,8,31,225,234,135,166,181,36,192,117,95,2,168,205,103,199,230,227,132,7,254,187,39,1,
+146,63,2,6,7,71,174,241,113,3,27,218,0,106,243,217,178,121,151,123,239,125,32,128,99,185,250,161,105,226,4,216,185,115,120,153,23,10,54,244,2,212,230,179,101,243,174,240,17,92,183,171,31,154,214,146,
+0,139,238,1,24,7,80,155,207,142,205,251,132,143,32,70,158,4,72,62,16,52,48,176,107,158,233,95,54,140,4,170,205,63,148,185,218,238,131,74,234,234,135,166,181,36,192,156,123,0,222,5,168,205,103,87,248,
+123,238,185,255,6,76,220,241,36,64,242,151,65,253,253,67,51,44,255,178,225,21,163,218,124,118,108,222,39,124,4,95,98,113,245,67,211,196,9,176,99,199,96,129,125,127,108,24,3,87,155,207,142,205,251,132,
+143,160,178,186,250,161,105,45,9,144,119,15,192,86,48,106,243,217,177,121,31,235,214,173,15,96,133,144,39,1,146,79,9,219,190,125,103,23,159,53,115,113,173,95,109,190,117,54,239,19,30,248,125,159,118,
+104,90,211,204,96,249,131,37,247,32,116,5,213,230,179,97,243,174,240,17,196,215,35,254,82,205,235,2,182,109,27,40,50,17,212,134,158,128,218,124,118,106,187,15,42,169,171,27,90,214,156,0,91,183,246,79,
+176,233,128,205,166,77,79,171,205,103,84,248,187,239,190,47,128,217,197,174,110,104,89,79,2,244,184,7,234,235,219,161,54,159,1,155,247,9,31,193,222,77,158,4,168,239,203,34,34,120,9,209,109,24,100,80,
+155,111,109,109,247,9,15,196,223,213,11,13,235,222,31,64,254,120,206,61,32,235,3,213,230,91,107,243,113,48,92,239,73,128,250,55,136,16,59,233,199,82,108,232,99,170,205,183,214,230,93,238,186,235,222,
+0,62,207,231,234,133,134,43,73,128,53,66,217,61,40,175,134,213,230,91,99,243,62,225,129,184,123,196,71,187,250,55,137,162,60,243,204,182,43,140,2,218,240,81,67,181,249,214,212,118,87,248,8,86,3,185,
+58,161,221,138,247,9,220,178,101,107,31,139,13,93,232,9,168,205,55,223,230,125,112,124,159,70,104,151,202,110,161,114,160,146,123,112,26,28,106,243,205,181,121,31,119,222,121,79,48,93,207,35,126,58,
+91,197,82,164,225,55,75,227,207,134,65,33,181,249,230,218,188,43,124,4,223,13,112,245,65,179,52,19,160,219,115,130,96,76,64,109,190,57,54,239,138,30,17,125,73,204,67,186,31,144,218,188,249,217,34,123,
+4,216,176,68,74,109,126,125,75,132,143,96,232,215,213,5,173,82,255,98,136,244,49,243,244,51,93,112,1,181,249,198,219,124,92,237,247,105,130,86,13,249,110,144,28,248,170,123,50,158,63,106,243,205,169,
+237,17,221,221,235,130,255,101,230,143,71,252,198,124,52,138,242,212,83,91,242,76,13,115,97,117,172,218,124,99,133,71,116,27,90,254,62,45,208,168,161,223,14,148,19,204,249,78,204,184,128,218,124,227,
+133,7,238,45,70,252,198,126,56,146,34,221,191,110,186,128,46,27,54,108,84,155,79,217,230,227,96,12,198,167,1,218,52,229,251,193,242,220,159,230,217,239,194,59,2,181,249,116,107,187,205,29,119,220,29,
+52,252,124,177,71,147,166,126,65,92,78,184,232,187,16,30,5,106,243,233,11,15,220,111,140,248,205,253,124,60,229,137,39,222,211,203,56,128,11,243,6,213,230,87,110,243,182,240,17,44,248,240,197,28,45,
+114,173,40,114,226,203,190,11,162,87,160,54,159,142,232,17,236,205,24,35,254,229,92,43,139,244,69,23,232,143,186,208,77,81,155,95,185,240,192,99,213,23,99,98,159,107,117,217,184,113,83,143,80,102,72,
+210,133,133,36,106,243,245,11,15,12,176,249,98,27,198,188,39,151,133,34,23,82,136,185,200,32,123,213,230,107,19,29,110,191,253,174,192,65,227,226,74,204,115,89,42,189,189,79,206,50,83,200,133,73,164,
+76,28,81,155,95,151,72,244,8,98,66,236,124,49,37,214,185,44,22,185,176,162,239,130,233,25,248,146,64,109,254,86,225,35,241,137,89,140,248,197,92,150,139,100,237,60,153,235,98,39,129,218,188,95,120,
+224,49,73,172,124,49,36,182,185,172,23,185,248,46,97,129,155,240,65,155,64,109,222,15,131,103,113,113,11,99,218,149,107,135,34,23,186,86,120,45,238,102,232,29,116,186,205,187,224,142,21,196,39,150,
+107,115,237,84,54,108,216,184,86,88,224,37,145,15,198,9,58,213,230,109,110,187,237,206,160,66,196,197,41,140,97,123,137,111,37,65,151,48,31,119,115,140,24,98,123,157,100,243,145,232,192,253,48,163,
+170,130,248,196,174,43,215,238,229,241,199,123,139,140,99,199,65,187,160,19,108,62,18,30,24,224,169,20,19,98,150,91,77,69,110,104,182,210,13,243,42,153,129,143,213,106,243,17,92,51,143,191,42,226,207,
+230,86,99,121,236,177,119,23,132,50,203,152,226,224,125,119,59,8,95,139,232,16,53,244,42,221,123,24,155,66,110,53,151,71,31,125,87,143,176,192,172,150,56,104,27,176,222,160,221,109,62,130,118,14,91,
+183,84,186,231,48,38,61,185,78,41,114,179,151,171,4,228,198,148,243,118,179,249,136,232,11,94,213,238,147,88,228,58,177,60,242,200,134,94,97,81,48,149,32,17,176,79,30,13,89,182,121,224,239,152,27,137,
+240,213,238,43,188,247,222,92,167,23,9,194,116,130,96,5,208,70,96,184,52,107,194,211,133,165,55,147,244,62,184,231,156,150,183,138,60,247,187,133,57,158,255,73,160,134,177,75,73,148,12,173,176,121,68,
+199,153,184,150,164,215,29,222,99,183,42,30,83,164,177,148,23,174,210,104,74,10,143,8,70,211,104,47,48,180,108,39,68,90,162,243,51,143,32,26,116,184,16,231,172,229,26,195,123,202,171,194,181,37,66,
+177,198,32,223,128,190,54,150,76,111,130,198,24,137,17,181,33,162,196,136,68,230,231,104,185,21,189,13,106,54,206,66,66,113,12,190,151,84,239,117,132,247,160,194,215,91,164,166,117,11,179,66,137,90,
+215,38,148,194,107,86,171,79,57,25,250,132,43,66,57,131,162,151,195,107,235,83,165,26,92,164,209,181,70,232,23,230,132,18,141,176,22,81,10,175,129,107,89,163,202,180,168,228,243,239,236,17,38,132,162,
+176,196,28,250,6,177,20,158,131,115,245,104,228,179,155,16,93,66,94,40,8,51,194,156,48,47,44,10,203,194,53,225,186,80,14,185,30,254,219,114,248,59,243,225,223,204,132,199,224,88,93,26,89,45,90,180,
+104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,201,76,153,158,158,233,18,242,66,65,152,17,230,132,121,97,81,88,22,174,9,215,133,114,200,245,240,223,150,195,223,153,15,255,102,38,
+60,6,199,210,161,224,12,11,222,35,76,8,69,97,73,48,13,98,41,60,7,231,210,151,65,173,42,151,46,189,176,70,232,23,230,132,146,96,90,68,41,188,6,174,69,95,7,55,186,92,188,248,124,159,112,69,40,11,38,99,
+148,195,107,211,9,33,41,139,222,45,204,10,165,12,138,30,71,41,188,102,157,18,86,111,185,112,225,185,188,80,20,76,61,76,77,157,54,135,14,77,152,66,97,175,25,24,216,21,124,71,143,29,181,217,95,143,237,
+86,88,132,25,173,201,227,103,54,98,96,247,45,126,135,79,174,245,247,15,153,145,145,61,230,224,193,113,115,252,248,41,83,239,117,132,247,160,147,66,107,20,254,106,45,65,62,119,238,146,57,124,120,210,
+236,218,53,26,124,49,11,49,163,149,182,85,22,99,86,93,182,21,45,228,224,88,124,142,101,112,112,196,140,141,29,9,206,89,99,34,92,213,68,168,80,206,159,159,238,22,230,4,147,132,147,39,207,154,61,123,14,
+4,53,219,93,94,189,82,209,109,225,43,193,199,153,70,71,247,153,19,39,206,152,164,215,29,222,163,62,26,236,34,181,105,154,26,149,132,253,251,199,188,162,167,89,219,227,168,180,226,135,100,216,187,247,
+160,73,122,31,220,179,10,127,238,82,175,176,88,45,88,60,207,135,134,10,193,62,121,89,19,30,236,133,32,92,15,109,14,218,13,9,146,128,123,239,204,197,161,103,207,94,188,44,152,74,28,61,122,34,104,140,
+53,66,244,180,133,247,177,117,107,191,153,156,156,50,213,238,147,88,116,146,240,61,194,66,165,128,80,227,169,69,89,172,237,73,132,119,23,141,108,219,54,16,56,66,149,36,32,38,171,123,116,241,204,153,
+11,5,161,44,152,56,134,135,119,7,59,100,101,217,230,147,10,111,195,127,167,7,81,233,222,195,216,172,206,45,98,78,159,62,63,43,152,56,232,179,211,7,111,55,155,175,182,100,204,93,77,68,59,230,192,129,
+195,166,82,44,136,213,106,19,191,88,233,134,119,238,28,110,123,155,175,38,188,203,246,237,59,171,37,65,251,111,19,119,234,212,185,46,97,94,48,62,198,199,143,6,95,187,92,45,54,159,68,120,123,169,25,35,
+143,12,42,197,197,39,140,93,87,187,138,191,86,88,136,187,185,221,187,247,175,90,155,175,38,188,11,67,206,21,146,128,24,182,215,86,177,39,79,158,93,43,188,198,104,157,15,44,191,19,108,190,218,98,83,54,
+177,136,160,167,16,23,175,48,150,107,219,69,252,46,97,33,238,102,232,27,119,146,205,87,19,222,134,119,13,21,146,128,152,102,255,113,112,226,196,153,121,198,198,93,232,7,243,162,166,83,109,190,146,240,
+17,108,69,195,167,224,136,149,47,134,196,54,211,226,79,77,157,46,50,136,227,114,236,216,201,160,177,215,233,54,95,73,120,27,186,138,140,130,250,98,73,140,179,42,254,108,82,241,59,217,230,227,68,247,
+37,1,177,139,73,130,108,141,19,136,101,21,176,45,31,188,37,83,155,79,46,252,195,15,191,227,6,76,94,137,139,43,49,207,138,248,61,66,217,119,145,188,182,85,155,175,93,120,27,70,71,99,18,128,152,183,254,
+221,129,216,212,2,86,229,178,99,199,160,218,124,157,162,219,176,1,38,21,201,23,99,98,223,82,241,165,161,114,153,198,138,11,47,116,212,230,235,23,30,209,93,24,59,241,197,26,13,90,37,126,175,239,130,
+152,177,163,54,159,158,240,54,204,56,138,73,130,230,79,42,153,156,156,90,100,178,131,203,147,79,110,86,155,175,195,230,43,193,222,196,64,99,218,23,115,180,104,182,248,211,190,11,97,56,83,109,62,157,
+218,30,137,238,66,175,42,38,9,154,51,199,240,200,145,227,221,130,113,97,118,172,218,124,227,132,143,96,243,106,218,88,62,13,208,166,225,9,48,49,113,108,78,48,46,244,89,213,230,27,43,124,4,113,245,105,
+128,54,141,22,63,239,59,49,93,62,181,249,244,69,119,133,183,161,107,24,147,4,141,91,124,50,62,126,244,42,147,56,108,152,222,20,61,247,213,230,211,175,237,62,248,82,10,191,71,143,203,213,3,141,26,37,
+126,222,115,178,96,29,157,218,124,243,132,183,161,199,229,211,4,173,82,79,128,195,135,39,139,172,191,179,161,95,170,54,223,56,155,143,19,222,134,153,85,174,46,104,149,170,248,99,99,71,186,153,187,230,
+194,251,125,181,249,230,212,118,31,124,176,138,198,183,79,27,52,75,51,1,102,221,19,184,181,95,109,190,57,194,35,186,11,139,100,61,9,144,222,43,227,67,135,38,74,204,219,183,161,21,170,54,223,28,155,
+143,19,62,130,55,134,174,62,104,150,150,248,125,158,131,7,195,146,106,243,205,177,249,74,240,85,52,174,197,167,17,218,173,56,1,14,30,28,191,194,46,25,54,44,216,84,155,111,77,109,183,133,183,97,178,
+173,171,19,218,173,72,124,233,227,175,17,202,244,245,109,152,184,168,54,223,124,225,93,209,109,24,139,113,117,10,181,91,179,146,4,232,119,15,74,183,67,109,190,249,54,95,9,62,112,9,188,143,241,36,65,
+127,221,9,176,127,255,216,28,163,77,54,188,241,83,155,111,141,205,199,9,31,193,155,66,87,47,52,92,73,2,148,220,3,210,239,84,155,111,141,205,251,68,183,97,56,222,147,0,245,245,6,246,237,59,212,35,24,
+27,250,254,106,243,205,183,249,161,161,17,243,39,127,242,33,51,63,255,45,83,42,149,204,111,127,251,91,243,209,143,126,252,38,241,31,124,240,161,0,198,4,92,221,208,178,158,4,152,112,15,196,174,29,106,
+243,141,183,249,167,159,126,214,76,79,63,111,174,94,125,217,252,231,127,254,167,121,227,141,55,188,204,206,254,241,13,225,35,120,68,123,18,96,162,230,4,144,218,94,164,198,219,176,118,77,109,62,125,
+155,103,149,244,241,227,39,204,220,220,231,205,226,226,207,98,5,119,121,245,213,31,222,146,0,60,162,93,221,208,178,230,4,16,43,89,194,78,108,216,97,83,109,126,229,194,115,190,125,251,14,154,79,124,
+226,207,205,15,126,240,74,98,193,93,94,121,229,149,155,196,127,224,129,183,7,122,184,186,161,101,173,226,119,121,14,114,139,245,171,205,39,183,249,254,254,65,243,129,15,124,208,124,227,27,223,12,158,
+227,245,138,110,51,51,243,190,27,194,71,208,30,240,105,135,166,137,19,64,250,250,121,250,251,54,236,211,167,54,159,92,248,167,158,122,218,156,63,127,201,188,244,210,151,205,210,210,175,83,17,60,226,
+151,191,252,165,249,224,7,47,223,36,188,13,107,8,92,253,208,180,150,4,40,184,7,160,113,161,54,31,47,252,163,143,110,48,147,147,199,205,103,63,251,87,230,39,63,249,73,170,130,255,254,247,191,55,95,255,
+250,223,7,53,254,217,103,183,197,10,31,193,107,122,79,2,36,95,75,56,58,186,111,134,81,37,27,26,128,106,243,55,179,123,247,62,243,177,143,253,153,249,222,247,190,159,170,224,240,221,239,126,215,124,
+248,195,31,53,35,35,187,111,177,121,31,247,223,223,115,3,26,130,174,126,104,154,56,1,10,133,189,115,108,179,110,195,248,191,218,252,155,28,59,118,34,117,91,255,241,143,95,51,47,190,248,89,51,62,62,25,
+180,181,236,134,93,82,225,35,120,83,235,234,135,166,181,36,192,188,123,0,182,96,215,214,252,31,6,93,182,255,249,159,255,89,177,224,191,250,213,146,249,210,151,94,50,103,207,158,151,202,245,212,45,173,
+249,122,132,143,160,157,230,73,128,228,187,139,140,140,236,89,100,231,42,27,222,54,105,107,254,15,228,57,127,172,46,193,73,154,127,248,135,127,52,239,127,255,7,204,246,237,3,183,244,223,235,173,237,
+54,235,215,191,45,128,120,185,250,161,105,45,9,176,236,30,128,183,127,58,104,243,7,210,157,218,159,88,244,127,249,151,31,152,143,127,252,19,193,223,112,46,159,232,105,10,31,193,117,123,18,96,57,113,2,
+12,15,239,190,198,242,35,27,108,69,199,230,223,228,219,223,254,142,87,240,255,243,127,22,205,95,253,213,95,155,163,71,167,130,23,51,113,130,167,97,243,62,225,35,56,190,171,31,154,38,78,128,93,187,70,
+175,243,249,21,155,106,194,119,210,43,88,26,193,127,249,151,159,14,70,241,254,238,239,174,154,139,23,167,131,125,144,236,151,50,205,170,237,113,184,250,161,105,45,9,80,118,15,160,175,96,43,211,106,
+225,239,187,239,193,155,240,36,64,57,113,2,12,13,21,202,140,252,217,116,242,76,155,70,137,222,8,225,35,92,253,208,180,150,4,184,238,75,128,78,157,105,147,181,218,94,73,120,224,191,123,18,32,249,35,96,
+112,112,228,26,31,55,176,161,13,160,54,159,45,155,119,185,247,222,7,2,56,150,171,31,154,38,78,128,157,59,135,151,121,161,96,67,47,64,109,62,91,54,239,10,31,193,117,187,250,161,105,45,9,176,232,30,128,
+113,0,181,249,236,216,188,79,248,8,98,228,73,128,228,3,65,3,3,187,230,153,254,101,195,72,160,218,252,67,153,171,237,62,168,164,174,126,104,90,75,2,204,185,7,224,93,128,218,124,118,133,191,231,158,251,
+111,192,203,36,79,2,36,127,25,212,223,63,52,195,242,47,27,94,49,170,205,103,199,230,125,194,71,240,194,202,213,15,77,19,39,192,142,29,131,5,246,253,177,97,5,170,218,124,118,108,222,39,124,4,149,213,
+213,15,77,107,73,128,188,123,0,182,130,81,155,207,142,205,251,88,183,110,125,0,43,132,60,9,144,124,74,216,246,237,59,187,248,172,153,139,107,253,106,243,173,179,121,159,240,192,239,251,180,67,211,154,
+102,6,203,31,44,185,7,161,43,168,54,159,13,155,119,133,143,32,190,30,241,151,106,94,23,176,109,219,64,145,137,160,54,244,4,212,230,179,83,219,125,80,73,93,221,208,178,230,4,216,186,181,127,130,77,7,
+108,54,109,122,90,109,62,163,194,223,125,247,125,1,124,140,210,213,13,45,235,73,128,30,247,64,125,125,59,212,230,51,96,243,62,225,35,216,187,201,147,0,245,125,89,68,4,47,33,186,13,131,12,106,243,173,
+173,237,62,225,129,248,187,122,161,97,221,251,3,200,31,207,185,7,100,125,160,218,124,107,109,62,14,134,235,61,9,80,255,6,17,98,39,253,88,138,13,125,76,181,249,214,218,188,203,93,119,221,27,192,180,52,
+87,47,52,92,73,2,172,17,202,238,65,121,53,172,54,223,26,155,247,9,15,196,221,35,62,218,213,191,73,20,229,153,103,182,93,97,20,208,134,143,26,170,205,183,166,182,187,194,71,176,26,200,213,9,237,86,188,
+79,224,150,45,91,251,88,108,232,66,79,64,109,190,249,54,239,131,227,251,52,66,187,84,118,11,149,3,149,220,131,211,224,80,155,111,174,205,251,184,243,206,123,130,233,122,30,241,211,217,42,150,34,13,
+191,89,26,127,54,12,10,169,205,55,215,230,93,225,35,248,110,128,171,15,154,165,153,0,221,158,19,4,99,2,106,243,205,177,121,87,244,136,232,75,98,30,210,253,128,212,230,205,207,22,217,35,192,134,37,227,
+106,243,235,91,34,124,4,67,191,174,46,104,149,250,23,67,164,143,153,167,159,233,130,11,168,205,55,222,230,227,106,191,79,19,180,106,200,119,131,228,192,87,221,147,241,252,81,155,111,78,109,143,232,
+238,94,23,252,47,51,127,60,226,55,230,163,81,148,167,158,218,146,103,106,152,11,31,142,80,155,111,172,240,136,110,67,203,223,167,5,26,53,244,219,129,114,130,57,223,137,25,23,80,155,111,188,240,192,
+189,197,136,223,216,15,71,82,164,251,215,77,23,208,101,195,134,141,106,243,41,219,124,28,140,193,248,52,64,155,166,124,63,88,158,251,211,60,251,93,120,71,160,54,159,110,109,183,185,227,142,187,131,
+134,159,47,246,104,210,212,47,136,203,9,23,125,23,194,163,64,109,62,125,225,129,251,141,17,191,185,159,143,167,60,241,196,123,122,25,7,112,97,222,160,218,252,202,109,222,22,62,130,5,31,190,152,163,69,
+174,21,69,78,124,217,119,65,244,10,212,230,211,17,61,130,109,105,98,196,191,156,107,101,145,190,232,2,253,81,23,186,41,106,243,43,23,30,120,172,250,98,76,236,115,173,46,27,55,110,234,17,202,12,73,186,
+176,144,68,109,190,126,225,129,1,54,95,108,195,152,247,228,178,80,228,66,10,49,23,25,100,175,218,124,109,162,195,237,183,223,21,56,104,92,92,137,121,46,75,165,183,247,201,89,102,10,185,48,137,148,137,
+35,106,243,235,18,137,30,65,76,136,157,47,166,196,58,151,197,34,23,86,244,93,48,61,3,95,18,168,205,223,42,124,36,62,49,139,17,191,152,203,114,145,172,157,39,115,93,236,36,80,155,247,11,15,60,38,137,
+149,47,134,196,54,151,245,34,23,223,37,44,112,19,62,104,19,168,205,251,97,240,44,46,110,97,76,187,114,237,80,228,66,215,10,175,197,221,12,189,131,78,183,121,23,220,177,130,248,196,114,109,174,157,202,
+134,13,27,215,10,11,188,36,242,193,56,65,167,218,188,205,109,183,221,25,84,136,184,56,133,49,108,47,241,173,36,232,18,230,227,110,142,17,67,108,175,147,108,62,18,29,184,31,102,84,85,16,159,216,117,
+229,218,189,60,254,120,111,145,113,236,56,104,23,116,130,205,71,194,3,3,60,149,98,66,204,114,171,169,200,13,205,86,186,97,94,37,51,240,177,90,109,62,130,107,230,241,87,69,252,217,220,106,44,143,61,
+246,238,130,80,102,25,83,28,188,239,110,7,225,107,17,29,162,134,94,165,123,15,99,83,200,173,230,242,232,163,239,234,17,22,152,213,18,7,109,3,214,27,180,187,205,71,208,206,97,235,150,74,247,28,198,164,
+39,215,41,69,110,246,114,149,128,220,152,114,222,110,54,31,17,125,193,171,218,125,18,139,92,39,150,71,30,217,208,43,44,242,125,157,74,144,8,216,39,143,134,44,219,60,240,119,204,141,68,248,106,247,21,
+222,123,111,174,211,139,4,97,58,65,176,2,104,35,48,92,154,53,225,233,194,210,155,73,122,31,220,115,78,203,91,69,158,251,221,194,28,207,255,36,80,195,216,165,36,74,134,86,216,60,162,227,76,92,75,210,
+235,14,239,177,91,21,143,41,210,88,202,11,87,105,52,37,133,71,4,163,105,180,23,24,90,182,19,34,45,209,249,153,71,16,13,58,92,136,115,214,114,141,225,61,229,85,225,218,18,161,88,99,144,111,64,95,27,75,
+166,55,65,99,140,196,136,218,16,81,98,68,34,243,115,180,220,138,222,6,53,27,103,33,161,56,6,223,75,170,247,58,194,123,80,225,235,45,82,211,186,133,89,161,68,173,107,19,74,225,53,171,213,167,156,12,
+125,194,21,161,156,65,209,203,225,181,245,169,82,13,46,210,232,90,35,244,11,115,66,137,70,88,139,40,133,215,192,181,172,81,101,90,84,242,249,119,246,8,19,66,81,88,98,14,125,131,88,10,207,193,185,122,
+52,242,217,77,136,46,33,47,20,132,25,97,78,152,23,22,133,101,225,154,112,93,40,135,92,15,255,109,57,252,157,249,240,111,102,194,99,112,172,46,141,172,22,45,90,180,104,209,162,69,139,22,45,90,180,104,
+209,162,69,139,22,45,90,180,100,166,76,79,207,116,9,121,161,32,204,8,115,194,188,176,40,44,11,215,132,235,66,57,228,122,248,111,203,225,239,204,135,127,51,19,30,131,99,233,80,112,134,5,239,17,38,132,
+162,176,36,152,6,177,20,158,131,115,233,203,160,86,149,75,151,94,88,35,244,11,115,66,73,48,45,162,20,94,3,215,162,175,131,27,93,46,94,124,190,79,184,34,148,5,147,49,202,225,181,233,132,144,148,69,239,
+22,102,133,82,6,69,143,163,20,94,179,78,9,171,183,92,184,240,92,94,40,10,166,30,166,166,78,155,67,135,38,76,161,176,215,12,12,236,10,190,163,199,142,218,236,175,199,118,43,44,194,140,214,228,241,51,
+27,49,176,251,22,191,195,39,215,250,251,135,204,200,200,30,115,240,224,184,57,126,252,148,169,247,58,194,123,208,73,161,53,10,127,181,150,32,159,59,119,201,28,62,60,105,118,237,26,13,190,152,133,152,
+209,74,219,42,139,49,171,46,219,138,22,114,112,44,62,199,50,56,56,98,198,198,142,4,231,172,49,17,174,106,34,84,40,231,207,79,119,11,115,130,73,194,201,147,103,205,158,61,7,130,154,237,46,175,94,169,
+232,182,240,149,224,227,76,163,163,251,204,137,19,103,76,210,235,14,239,81,31,13,118,145,218,52,77,141,74,194,254,253,99,94,209,211,172,237,113,84,90,241,67,50,236,221,123,208,36,189,15,238,89,133,63,
+119,169,87,88,172,22,44,158,231,67,67,133,96,159,188,172,9,15,246,66,16,174,135,54,7,237,134,4,73,192,189,119,230,226,208,179,103,47,94,22,76,37,142,30,61,17,52,198,26,33,122,218,194,251,216,186,181,
+223,76,78,78,153,106,247,73,44,58,73,248,30,97,161,82,64,168,241,212,162,44,214,246,36,194,187,139,70,182,109,27,8,28,161,74,18,16,147,213,61,186,120,230,204,133,130,80,22,76,28,195,195,187,131,29,
+178,178,108,243,73,133,183,225,191,211,131,168,116,239,97,108,86,231,22,49,167,79,159,159,21,76,28,244,217,233,131,183,155,205,87,91,50,230,174,38,162,29,115,224,192,97,83,41,22,196,106,181,137,95,
+172,116,195,59,119,14,183,189,205,87,19,222,101,251,246,157,213,146,160,253,183,137,59,117,234,92,151,48,47,24,31,227,227,71,131,175,93,174,22,155,79,34,188,189,212,140,145,71,6,149,226,226,19,198,
+174,171,93,197,95,43,44,196,221,220,238,221,251,87,173,205,87,19,222,133,33,231,10,73,64,12,219,107,171,216,147,39,207,174,21,94,99,180,206,7,150,223,9,54,95,109,177,41,155,88,68,208,83,136,139,87,24,
+203,181,237,34,126,151,176,16,119,51,244,141,59,201,230,171,9,111,195,187,134,10,73,64,76,179,255,56,56,113,226,204,60,99,227,46,244,131,121,81,211,169,54,95,73,248,8,182,162,225,83,112,196,202,23,67,
+98,155,105,241,167,166,78,23,25,196,113,57,118,236,100,208,216,235,116,155,175,36,188,13,93,69,70,65,125,177,36,198,89,21,127,54,169,248,157,108,243,113,162,251,146,128,216,197,36,65,182,198,9,196,
+178,10,216,150,15,222,146,169,205,39,23,254,225,135,223,113,3,38,175,196,197,149,152,103,69,252,30,161,236,187,72,94,219,170,205,215,46,188,13,163,163,49,9,64,204,91,255,238,64,108,106,1,171,114,217,
+177,99,80,109,190,78,209,109,216,0,147,138,228,139,49,177,111,169,248,210,80,185,76,99,197,133,23,58,106,243,245,11,143,232,46,140,157,248,98,141,6,173,18,191,215,119,65,204,216,81,155,79,79,120,27,
+102,28,197,36,65,243,39,149,76,78,78,45,50,217,193,229,201,39,55,171,205,215,97,243,149,96,111,98,160,49,237,139,57,90,52,91,252,105,223,133,48,156,169,54,159,78,109,143,68,119,161,87,21,147,4,205,
+153,99,120,228,200,241,110,193,184,48,59,86,109,190,113,194,71,176,121,53,109,44,159,6,104,211,240,4,152,152,56,54,39,24,23,250,172,106,243,141,21,62,130,184,250,52,64,155,70,139,159,247,157,152,46,
+159,218,124,250,162,187,194,219,208,53,140,73,130,198,45,62,25,31,63,122,149,73,28,54,76,111,138,158,251,106,243,233,215,118,31,124,41,133,223,163,199,229,234,129,70,141,18,63,239,57,89,176,142,78,
+109,190,121,194,219,208,227,242,105,130,86,169,39,192,225,195,147,69,214,223,217,208,47,85,155,111,156,205,199,9,111,195,204,42,87,23,180,74,85,252,177,177,35,221,204,93,115,225,253,190,218,124,115,
+106,187,15,62,88,69,227,219,167,13,154,165,153,0,179,238,9,220,218,175,54,223,28,225,17,221,133,69,178,158,4,72,239,149,241,161,67,19,37,230,237,219,208,10,85,155,111,142,205,199,9,31,193,27,67,87,31,
+52,75,75,252,62,207,193,131,97,73,181,249,230,216,124,37,248,42,26,215,226,211,8,237,86,156,0,7,15,142,95,97,151,12,27,22,108,170,205,183,166,182,219,194,219,48,217,214,213,9,237,86,36,190,244,241,
+215,8,101,250,250,54,76,92,84,155,111,190,240,174,232,54,140,197,184,58,133,218,173,89,73,2,244,187,7,165,219,161,54,223,124,155,175,4,31,184,4,222,199,120,146,160,191,238,4,216,191,127,108,142,209,
+38,27,222,248,169,205,183,198,230,227,132,143,224,77,161,171,23,26,174,36,1,74,238,1,233,119,170,205,183,198,230,125,162,219,48,28,239,73,128,250,122,3,251,246,29,234,17,140,13,125,127,181,249,214,
+218,124,28,15,62,248,80,0,99,2,174,110,104,89,79,2,76,184,7,98,215,14,181,249,214,218,124,156,240,17,60,162,61,9,48,81,115,2,72,109,47,82,227,109,88,187,166,54,255,71,45,175,237,62,225,35,120,68,187,
+186,161,101,205,9,32,86,178,132,157,216,176,195,166,218,124,107,132,103,41,253,222,189,7,204,236,236,31,155,47,124,225,111,204,229,203,127,26,244,196,108,241,31,120,224,237,129,30,174,110,104,89,171,
+248,93,158,131,220,98,253,106,243,141,177,121,134,118,39,39,143,153,143,126,244,227,230,235,95,255,123,243,203,95,254,210,188,241,198,27,183,240,147,159,252,84,146,224,209,64,248,8,254,222,167,29,154,
+38,78,0,233,235,231,233,239,219,176,79,159,218,124,186,181,253,127,253,175,135,205,246,237,3,230,204,153,243,230,211,159,126,209,124,251,219,223,49,191,251,221,239,188,98,199,241,39,127,242,161,155,
+18,0,88,67,224,234,135,166,181,36,64,193,61,0,141,11,181,249,250,133,231,197,89,161,176,199,188,240,194,123,205,223,252,77,209,252,240,135,11,53,9,29,199,231,63,255,133,91,18,128,215,244,158,4,72,190,
+150,112,116,116,223,12,163,74,54,52,0,213,230,147,9,255,230,59,250,137,224,57,253,149,175,188,108,22,23,23,83,17,219,199,249,243,23,3,209,239,191,191,231,6,156,223,213,15,77,19,39,64,161,176,119,142,
+109,214,109,24,255,87,155,191,85,244,103,159,221,102,78,156,56,109,62,249,201,191,48,223,248,198,55,205,175,127,253,235,134,137,237,242,165,47,189,116,147,240,17,188,169,117,245,67,211,90,18,96,222,
+61,0,91,176,171,205,191,9,215,81,44,254,173,121,253,245,215,155,38,54,188,250,234,15,131,30,192,243,207,207,152,193,193,97,175,248,64,59,205,147,0,201,119,23,25,25,217,179,200,206,85,54,188,109,82,
+155,127,211,226,175,92,121,169,161,66,255,215,127,253,151,249,214,183,190,109,62,245,169,79,155,211,167,217,87,105,71,112,222,56,193,35,214,175,127,91,0,241,114,245,67,211,90,18,96,217,61,0,125,78,
+109,205,255,65,112,223,105,138,253,139,95,252,210,124,237,107,127,111,62,242,145,143,153,137,137,163,193,76,95,183,81,151,84,248,8,174,219,147,0,203,137,19,96,120,120,247,53,150,31,217,96,43,218,154,
+39,1,254,119,221,98,255,219,191,253,88,158,219,87,204,251,223,255,1,233,151,239,15,92,213,21,123,37,194,71,48,40,228,234,135,166,137,19,96,215,174,209,235,124,126,197,166,154,240,157,52,104,243,197,
+47,126,169,162,208,180,13,190,255,253,239,155,207,125,110,206,92,184,48,45,253,242,93,193,253,71,163,117,141,16,221,197,213,15,77,107,73,128,178,123,0,29,155,127,11,254,102,110,238,243,193,160,205,
+210,210,175,131,214,255,39,62,241,231,102,106,234,164,244,193,251,188,99,244,141,22,254,190,251,30,188,9,79,2,148,19,39,192,208,80,161,204,200,159,141,142,205,39,127,33,147,84,244,70,8,31,225,234,135,
+166,181,36,192,117,95,2,232,43,216,116,132,79,195,230,227,132,7,254,187,39,1,146,63,2,6,7,71,174,241,113,3,27,218,0,250,10,182,181,194,87,18,29,238,189,247,129,0,142,229,234,135,166,137,19,96,231,206,
+225,101,94,40,216,208,11,80,155,207,150,205,187,194,71,112,221,174,126,104,90,75,2,44,186,7,96,28,64,109,62,59,54,239,19,62,130,24,121,18,32,249,64,208,192,192,174,121,166,127,217,208,103,85,155,127,
+40,115,181,221,7,149,212,213,15,77,107,73,128,57,247,0,188,11,80,155,207,174,240,247,220,115,255,13,152,184,227,73,128,228,47,131,250,251,135,102,88,254,101,195,43,70,181,249,236,216,188,79,248,8,166,
+143,185,250,161,105,226,4,216,177,99,176,192,190,63,54,76,83,82,155,207,142,205,251,132,143,160,178,186,250,161,105,45,9,144,119,15,192,86,48,106,243,217,177,121,31,235,214,173,15,96,133,144,39,1,146,
+79,9,219,190,125,103,23,159,53,115,113,173,95,109,190,117,54,239,19,30,248,125,159,118,104,90,211,204,96,249,131,37,247,32,116,5,213,230,179,97,243,174,240,17,196,215,35,254,82,205,235,2,182,109,27,
+40,50,17,212,134,158,128,218,124,118,106,187,15,42,169,171,27,90,214,156,0,91,183,246,79,176,233,128,205,166,77,79,171,205,103,84,248,187,239,190,47,128,143,81,186,186,161,101,61,9,208,227,30,168,175,
+111,135,218,124,6,108,222,39,124,4,123,55,121,18,160,190,47,139,136,224,37,68,183,97,144,65,109,190,181,181,221,39,60,16,127,87,47,52,172,123,127,0,249,227,57,247,128,172,15,84,155,111,173,205,199,
+193,112,189,39,1,234,223,32,66,236,164,31,75,177,161,143,169,54,223,90,155,119,185,235,174,123,3,248,60,159,171,23,26,174,36,1,214,8,101,247,160,188,26,86,155,111,141,205,251,132,7,226,238,17,31,237,
+234,223,36,138,242,204,51,219,174,48,10,104,195,71,13,213,230,91,83,219,93,225,35,88,13,228,234,132,118,43,222,39,112,203,150,173,125,44,54,116,161,39,160,54,223,124,155,247,193,241,125,26,161,93,42,
+187,133,202,129,74,238,193,105,112,168,205,55,215,230,125,220,121,231,61,193,116,61,143,248,233,108,21,75,145,134,223,44,141,63,27,6,133,212,230,155,107,243,174,240,17,172,38,114,245,65,179,52,19,160,
+219,115,130,96,76,64,109,190,57,54,239,138,30,17,125,73,204,67,186,31,144,218,188,249,217,34,123,4,216,176,100,92,109,126,125,75,132,143,96,232,215,213,5,173,82,255,98,136,244,49,243,244,51,93,112,1,
+181,249,198,219,124,92,237,247,105,130,86,13,249,110,144,28,248,170,123,50,158,63,106,243,205,169,237,17,221,221,235,130,255,101,230,143,71,252,198,124,52,138,242,212,83,91,242,76,13,115,97,255,27,
+181,249,198,10,143,232,54,180,252,125,90,160,81,67,191,29,40,39,152,243,157,152,113,1,181,249,198,11,15,220,91,140,248,141,253,112,36,69,186,127,221,116,1,93,54,108,216,168,54,159,178,205,199,193,24,
+140,79,3,180,105,202,247,131,229,185,63,205,179,223,133,119,4,106,243,233,214,118,155,59,238,184,59,104,248,249,98,143,38,77,253,130,184,156,112,209,119,33,60,10,212,230,211,23,30,184,223,24,241,155,
+251,249,120,202,19,79,188,167,151,113,0,23,230,13,170,205,175,220,230,109,225,35,88,240,225,139,57,90,228,90,81,228,196,151,125,23,68,175,64,109,62,29,209,35,216,155,49,70,252,203,185,86,22,233,139,
+46,208,31,117,161,155,162,54,191,114,225,129,199,170,47,198,196,62,215,234,178,113,227,166,30,161,204,144,164,11,11,73,212,230,235,23,30,24,96,243,197,54,140,121,79,46,11,69,46,164,16,115,145,65,246,
+170,205,215,38,58,220,126,251,93,129,131,198,197,149,152,231,178,84,122,123,159,156,101,166,144,11,147,72,153,56,162,54,191,46,145,232,17,196,132,216,249,98,74,172,115,89,44,114,97,69,223,5,211,51,
+240,37,129,218,252,173,194,71,226,19,179,24,241,139,185,44,23,201,218,121,50,215,197,78,2,181,121,191,240,192,99,146,88,249,98,72,108,115,89,47,114,241,93,194,2,55,225,131,54,129,218,188,31,6,207,226,
+226,22,198,180,43,215,14,69,46,116,173,240,90,220,205,208,59,232,116,155,119,193,29,43,136,79,44,215,230,218,169,108,216,176,113,173,176,192,75,34,31,140,19,116,170,205,219,220,118,219,157,65,133,136,
+139,83,24,195,246,18,223,74,130,46,97,62,238,230,24,49,196,246,58,201,230,35,209,129,251,97,70,85,5,241,137,93,87,174,221,203,227,143,247,22,25,199,142,131,118,65,39,216,124,36,60,68,223,2,172,64,49,
+183,154,138,220,208,108,165,27,230,85,50,3,31,171,213,230,35,184,102,30,127,85,196,159,205,173,198,242,216,99,239,46,8,101,150,49,197,193,251,238,118,16,190,22,209,33,106,232,85,186,247,48,54,133,220,
+106,46,143,62,250,174,30,97,129,89,45,113,208,54,96,189,65,187,219,124,4,237,28,182,110,169,116,207,97,76,122,114,157,82,228,102,47,87,9,200,141,41,231,237,102,243,17,209,23,188,170,221,39,177,200,
+117,98,121,228,145,13,189,194,162,96,42,65,34,96,159,60,26,178,108,243,192,223,49,55,18,225,171,221,87,120,239,189,185,78,47,18,132,233,4,193,10,160,141,192,112,105,214,132,167,11,75,111,38,233,125,
+112,207,57,45,111,21,121,238,119,11,115,60,255,147,64,13,99,151,146,40,25,90,97,243,136,142,51,113,45,73,175,59,188,199,110,85,60,166,72,99,41,47,92,165,209,148,20,30,17,140,166,209,94,96,104,217,78,
+136,180,68,231,103,30,65,52,232,112,33,206,89,203,53,134,247,148,87,133,107,75,132,98,141,65,190,1,125,109,44,57,250,226,38,137,17,181,33,162,196,136,68,230,231,104,185,21,189,13,106,54,206,242,230,
+39,222,255,40,248,94,82,189,215,17,222,131,10,95,111,145,154,214,45,204,10,37,106,93,155,80,10,175,89,173,62,229,100,232,19,174,8,229,12,138,94,14,175,173,79,149,106,112,145,70,215,26,161,95,152,19,
+74,52,194,90,68,41,188,6,174,101,141,42,211,162,146,207,191,179,71,152,16,138,194,18,115,232,27,196,82,120,14,206,213,163,145,207,110,66,116,9,121,161,32,204,8,115,194,188,176,40,44,11,215,132,235,66,
+57,228,122,248,111,203,225,239,204,135,127,51,19,30,131,99,117,105,100,181,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,37,51,101,122,122,166,75,200,11,5,97,70,152,19,
+230,133,69,97,89,184,38,92,23,202,33,215,195,127,91,14,127,103,62,252,155,153,240,24,28,75,135,130,51,44,120,143,48,33,20,133,37,193,52,136,165,240,28,156,75,95,6,181,170,92,186,244,194,26,161,95,152,
+19,74,130,105,17,165,240,26,184,22,125,29,220,232,114,241,226,243,125,194,21,161,44,152,140,81,14,175,77,39,132,164,44,122,183,48,43,148,50,40,122,28,165,240,154,117,74,88,189,229,194,133,231,242,66,
+81,48,245,48,53,117,218,28,58,52,97,10,133,189,102,96,96,87,240,29,61,118,212,102,127,61,182,91,97,17,102,180,38,143,159,217,136,129,221,183,248,29,62,185,214,223,63,100,70,70,246,152,131,7,199,205,
+241,227,167,76,189,215,17,222,131,78,10,173,81,248,171,181,4,249,220,185,75,230,240,225,73,179,107,215,104,240,197,44,196,140,86,218,86,89,140,89,117,217,86,180,144,131,99,241,57,150,193,193,17,51,54,
+118,36,56,103,141,137,112,85,19,161,66,57,127,126,186,91,152,19,76,18,78,158,60,107,246,236,57,16,212,108,119,121,245,74,69,183,133,175,4,31,103,26,29,221,103,78,156,56,99,146,94,119,120,143,250,104,
+176,139,212,166,105,106,84,18,246,239,31,243,138,158,102,109,143,163,210,138,31,146,97,239,222,131,38,233,125,112,207,42,252,185,75,189,194,98,181,96,241,60,31,26,42,4,251,228,101,77,120,176,23,130,
+112,61,180,57,104,55,36,72,2,238,189,51,23,135,158,61,123,241,178,96,42,113,244,232,137,160,49,214,8,209,211,22,222,199,214,173,253,102,114,114,202,84,187,79,98,209,73,194,247,8,11,149,2,66,141,167,
+22,101,177,182,39,17,222,93,52,178,109,219,64,224,8,85,146,128,152,172,238,209,197,51,103,46,20,132,178,96,226,24,30,222,29,236,144,149,101,155,79,42,188,13,255,157,30,68,165,123,15,99,179,58,183,136,
+57,125,250,252,172,96,226,160,207,78,31,188,221,108,190,218,146,49,119,53,17,237,152,3,7,14,155,74,177,32,86,171,77,252,98,165,27,222,185,115,184,237,109,190,154,240,46,219,183,239,172,150,4,237,191,
+77,220,169,83,231,186,132,121,193,248,24,31,63,26,124,237,114,181,216,124,18,225,237,165,102,140,60,50,168,20,23,159,48,118,93,237,42,254,90,97,33,238,230,118,239,222,191,106,109,190,154,240,46,12,57,
+87,72,2,98,216,94,91,197,158,60,121,118,173,240,26,163,117,62,176,252,78,176,249,106,139,77,217,196,34,130,158,66,92,188,194,88,174,109,23,241,187,132,133,184,155,161,111,220,73,54,95,77,120,27,222,
+53,84,72,2,98,154,253,199,193,137,19,103,230,25,27,119,161,31,204,139,154,78,181,249,74,194,71,176,21,13,159,130,35,86,190,24,18,219,76,139,63,53,117,186,200,32,142,203,177,99,39,131,198,94,167,219,
+124,37,225,109,232,42,50,10,234,139,37,49,206,170,248,179,73,197,239,100,155,143,19,221,151,4,196,46,38,9,178,53,78,32,150,85,192,182,124,240,150,76,109,62,185,240,15,63,252,142,27,48,121,37,46,174,
+196,60,43,226,247,8,101,223,69,242,218,86,109,190,118,225,109,24,29,141,73,0,98,222,250,119,7,98,83,11,88,149,203,142,29,131,106,243,117,138,110,195,6,152,84,36,95,140,137,125,75,197,151,134,202,101,
+26,43,46,188,208,81,155,175,95,120,68,119,97,236,196,23,107,52,104,149,248,189,190,11,98,198,142,218,124,122,194,219,48,227,40,38,9,154,63,169,100,114,114,106,145,201,14,46,79,62,185,89,109,190,14,
+155,175,4,123,19,3,141,105,95,204,209,162,217,226,79,251,46,132,225,76,181,249,116,106,123,36,186,11,189,170,152,36,104,206,28,195,35,71,142,119,11,198,133,217,177,106,243,141,19,62,130,205,171,105,
+99,249,52,64,155,134,39,192,196,196,177,57,193,184,208,103,85,155,111,172,240,17,196,213,167,1,218,52,90,252,188,239,196,116,249,212,230,211,23,221,21,222,134,174,97,76,18,52,110,241,201,248,248,209,
+171,76,226,176,97,122,83,244,220,87,155,79,191,182,251,224,75,41,252,30,61,46,87,15,52,106,148,248,121,207,201,130,117,116,106,243,205,19,222,134,30,151,79,19,180,74,61,1,14,31,158,44,178,254,206,134,
+126,169,218,124,227,108,62,78,120,27,102,86,185,186,160,85,170,226,143,141,29,233,102,238,154,11,239,247,213,230,155,83,219,125,240,193,42,26,223,62,109,208,44,205,4,152,117,79,224,214,126,181,249,
+230,8,143,232,46,44,146,245,36,64,122,175,140,15,29,154,40,49,111,223,134,86,168,218,124,115,108,62,78,248,8,222,24,186,250,160,89,90,226,247,121,14,30,12,75,170,205,55,199,230,43,193,87,209,184,22,
+159,70,104,183,226,4,56,120,112,252,10,187,100,216,176,96,83,109,190,53,181,221,22,222,134,201,182,174,78,104,183,34,241,165,143,191,70,40,211,215,183,97,226,162,218,124,243,133,119,69,183,97,44,198,
+213,41,212,110,205,74,18,160,223,61,40,221,14,181,249,230,219,124,37,248,192,37,240,62,198,147,4,253,117,39,192,254,253,99,115,140,54,217,240,198,79,109,190,53,54,31,39,124,4,111,10,93,189,208,112,37,
+9,80,114,15,72,191,83,109,190,53,54,239,19,221,134,225,120,79,2,212,215,27,216,183,239,80,143,96,108,232,251,171,205,183,214,230,227,120,240,193,135,2,24,19,112,117,67,203,122,18,96,194,61,16,187,118,
+168,205,183,214,230,227,132,143,224,17,237,73,128,137,154,19,64,106,123,145,26,111,195,218,53,181,249,63,106,121,109,247,9,31,193,35,218,213,13,45,107,78,0,177,146,37,236,196,134,29,54,213,230,91,111,
+243,113,60,240,192,219,3,61,92,221,208,178,86,241,187,60,7,185,197,250,213,230,91,99,243,62,225,35,248,125,159,118,104,154,56,1,164,175,159,167,191,111,195,62,125,106,243,217,176,121,159,240,54,172,
+33,112,245,67,211,90,18,160,224,30,128,198,133,218,124,235,109,158,235,100,36,150,62,127,92,2,240,154,222,147,0,201,215,18,142,142,238,155,97,84,201,134,6,160,218,124,99,133,127,232,161,63,12,246,13,
+26,26,26,49,199,142,157,48,239,127,255,7,204,167,63,253,162,121,249,229,175,154,31,252,224,21,243,171,95,253,202,188,241,198,27,55,248,215,127,253,145,84,204,254,64,244,251,239,239,185,1,13,65,87,63,
+52,77,156,0,133,194,222,57,182,89,183,33,235,212,230,235,23,157,255,223,219,251,132,216,243,46,51,57,121,220,188,247,189,239,55,127,249,151,159,50,127,247,119,87,205,247,191,255,47,230,63,254,227,63,
+110,18,55,41,175,188,242,234,77,226,3,111,106,93,253,208,180,150,4,152,119,15,192,22,236,106,243,241,194,19,159,129,129,33,51,49,113,212,60,255,252,140,249,228,39,255,194,188,244,210,151,205,63,255,
+243,119,205,191,255,251,47,234,18,55,41,36,150,157,0,180,211,60,9,144,124,119,145,145,145,61,139,236,92,101,195,219,38,181,249,183,4,63,121,242,140,249,167,127,154,55,63,251,217,207,204,255,252,207,
+255,52,84,224,106,188,227,29,239,12,132,95,191,254,109,1,196,203,213,15,77,107,73,128,101,247,0,188,253,83,155,127,147,243,231,47,182,84,112,155,207,124,230,115,55,132,143,224,186,61,9,176,156,56,1,
+134,135,119,95,99,249,145,13,182,162,173,249,55,121,245,213,31,182,84,244,127,255,247,127,15,30,45,52,18,93,241,129,6,165,171,31,154,38,78,128,93,187,70,175,243,249,21,155,106,194,119,82,107,254,231,
+63,255,121,195,196,253,229,47,255,195,124,239,123,223,55,95,254,242,85,243,231,127,254,151,230,133,23,222,27,180,43,250,251,7,131,77,180,109,171,175,132,171,31,154,214,146,0,101,247,0,218,154,127,139,
+23,95,252,108,93,226,210,141,163,59,247,149,175,188,108,62,245,169,23,205,251,222,247,1,115,244,232,84,208,237,163,33,199,185,220,22,125,68,53,193,239,187,239,193,155,240,36,64,57,113,2,12,13,21,202,
+140,252,217,232,160,205,91,112,108,68,180,197,253,205,111,126,99,126,248,195,5,243,181,175,125,61,120,46,255,241,31,255,137,153,154,58,37,214,59,26,116,161,185,102,223,160,77,156,224,245,10,31,225,
+234,135,166,181,36,192,117,95,2,232,160,205,205,163,117,12,218,188,231,61,91,130,216,36,25,162,77,75,244,74,194,3,255,221,147,0,201,31,1,131,131,35,215,248,184,129,13,109,0,29,155,175,111,108,190,209,
+181,61,226,222,123,31,8,224,88,174,126,104,154,56,1,118,238,28,94,230,133,130,13,189,0,29,155,175,93,244,102,10,31,193,117,187,250,161,105,45,9,176,232,30,128,113,0,125,5,155,29,155,247,9,31,65,140,
+60,9,144,124,32,104,96,96,215,60,211,191,108,24,9,84,155,127,40,115,181,221,7,149,212,213,15,77,107,73,128,57,247,0,140,117,171,205,103,87,248,123,238,185,255,6,76,220,241,36,64,242,151,65,253,253,67,
+51,44,255,178,225,21,163,218,124,118,108,222,39,124,4,95,98,113,245,67,211,196,9,176,99,199,96,129,125,127,108,88,129,170,54,159,29,155,247,9,31,65,101,117,245,67,211,90,18,32,239,30,128,173,96,212,
+230,179,99,243,62,214,173,91,31,192,108,33,79,2,36,159,18,182,125,251,206,46,62,107,230,226,90,191,218,124,235,108,222,39,60,240,251,62,237,208,180,166,153,193,242,7,75,238,65,232,10,170,205,103,195,
+230,93,225,35,136,175,71,252,165,154,215,5,108,219,54,80,100,34,168,13,61,1,181,249,236,212,118,31,84,82,87,55,180,172,57,1,182,110,237,159,96,211,1,155,77,155,158,86,155,207,168,240,119,223,125,95,0,
+239,39,92,221,208,178,158,4,232,113,15,212,215,183,67,109,62,3,54,239,19,62,130,189,155,60,9,80,223,151,69,68,240,18,162,219,48,200,160,54,223,218,218,238,19,30,136,191,171,23,26,214,189,63,128,252,
+241,156,123,64,214,7,170,205,183,214,230,227,96,184,222,147,0,245,111,16,33,118,210,143,165,216,208,199,84,155,111,173,205,187,220,117,215,189,1,124,158,207,213,11,13,87,146,0,107,132,178,123,80,94,
+13,171,205,183,198,230,125,194,3,113,247,136,143,118,245,111,18,69,121,230,153,109,87,24,5,180,225,163,134,106,243,173,169,237,174,240,17,172,6,114,117,66,187,21,239,19,184,101,203,214,62,22,27,186,
+208,19,80,155,111,190,205,251,224,248,62,141,208,46,149,221,66,229,64,37,247,224,52,56,212,230,155,107,243,62,238,188,243,158,96,186,158,71,252,116,182,138,165,72,195,111,150,198,159,13,131,66,106,
+243,205,181,121,87,248,8,190,27,224,234,131,102,105,38,64,183,231,4,193,152,128,218,124,115,108,222,21,61,34,250,146,152,135,116,63,32,181,121,243,179,69,246,8,176,97,190,187,218,252,250,150,8,31,193,
+208,175,171,11,90,165,254,197,16,233,99,230,233,103,186,224,2,106,243,141,183,249,184,218,239,211,4,173,26,242,221,32,57,240,85,247,100,60,127,212,230,155,83,219,35,186,187,215,5,255,203,204,31,143,
+248,141,249,104,20,229,169,167,182,228,153,26,230,194,135,35,212,230,27,43,60,162,219,208,242,247,105,129,70,13,253,118,160,156,96,206,119,98,198,5,212,230,27,47,60,112,111,49,226,55,246,195,145,20,
+233,254,117,211,5,116,97,233,178,218,124,186,54,31,7,99,48,62,13,208,166,41,223,15,150,231,254,52,207,126,23,222,17,168,205,167,91,219,109,238,184,227,238,160,225,231,139,61,154,52,245,11,226,114,194,
+69,223,133,216,203,160,213,230,211,19,30,184,223,24,241,155,251,249,120,202,19,79,188,167,151,113,0,23,230,13,170,205,175,220,230,109,225,35,88,240,225,139,57,90,228,90,81,228,196,151,125,23,68,175,
+64,109,62,29,209,35,216,155,49,70,252,203,185,86,22,233,139,46,208,31,117,161,155,162,54,191,114,225,129,199,170,47,198,196,62,215,234,178,113,227,166,30,161,204,144,164,11,11,73,212,230,235,23,30,24,
+96,243,197,54,140,121,79,46,11,69,46,164,16,115,145,65,246,170,205,215,38,58,220,126,251,93,129,131,198,197,149,152,231,178,84,122,123,159,156,101,166,144,11,147,72,153,56,162,54,191,46,145,232,17,
+196,132,216,249,98,74,172,115,89,44,114,97,69,223,5,211,51,240,37,129,218,252,173,194,71,226,19,179,24,241,139,185,44,23,201,218,121,50,215,197,78,2,181,121,191,240,192,99,146,88,249,98,72,108,115,89,
+47,114,241,93,194,2,55,225,131,54,129,218,188,31,6,207,226,226,22,198,180,43,215,14,69,46,116,173,240,90,220,205,208,59,232,116,155,119,193,29,43,136,79,44,215,230,218,169,108,216,176,113,173,176,192,
+75,34,31,140,19,116,170,205,219,220,118,219,157,65,133,136,139,83,24,195,246,18,223,74,130,46,97,62,238,230,24,49,196,246,58,201,230,35,209,129,251,97,70,85,5,241,137,93,87,174,221,203,227,143,247,22,
+25,199,142,131,118,65,39,216,124,36,60,48,192,83,41,38,196,44,183,154,138,220,208,108,165,27,230,85,50,3,31,171,213,230,35,184,102,30,127,85,196,159,205,173,198,242,216,99,239,46,8,101,150,49,197,193,
+251,238,118,16,190,22,209,33,106,232,85,186,247,48,54,133,220,106,46,143,62,250,174,30,97,129,89,45,113,208,54,96,189,65,187,219,124,4,237,28,182,110,169,116,207,97,76,122,114,157,82,228,102,47,87,9,
+200,141,41,231,237,102,243,17,209,23,188,170,221,39,177,200,117,98,121,228,145,13,189,194,162,96,42,65,34,96,159,60,26,178,108,243,192,223,49,55,18,225,171,221,87,120,239,189,185,78,47,18,132,233,4,
+193,10,160,141,192,112,105,214,132,167,11,75,111,38,233,125,112,207,57,45,111,21,121,238,119,11,115,60,255,147,64,13,99,151,146,40,25,90,97,243,136,142,51,113,45,73,175,59,188,199,110,85,60,166,72,99,
+41,47,92,165,209,148,20,30,17,140,166,209,94,96,104,217,78,136,180,68,231,103,30,65,52,232,112,33,206,89,203,53,134,247,148,87,133,107,75,132,98,141,65,190,1,125,109,44,57,250,18,23,137,17,181,33,162,
+196,136,68,230,231,104,185,21,189,13,106,54,206,66,66,113,12,190,9,84,239,117,132,247,160,194,215,91,164,166,117,11,179,66,137,90,215,38,148,194,107,86,171,79,57,25,250,132,43,66,57,131,162,151,195,
+107,235,83,165,26,92,164,209,181,70,232,23,230,132,18,141,176,22,81,10,175,129,107,89,163,202,180,168,228,243,239,236,17,38,132,162,176,196,28,250,6,177,20,158,131,115,245,104,228,179,155,16,93,66,94,
+40,8,51,194,156,48,47,44,10,203,194,53,225,186,80,14,185,30,254,219,114,248,59,243,225,223,204,132,199,224,88,93,26,89,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,
+201,76,153,158,158,233,18,242,66,65,152,17,230,132,121,97,81,88,22,174,9,215,133,114,200,245,240,223,150,195,223,153,15,255,102,38,60,6,199,210,161,224,12,11,222,35,76,8,69,97,73,48,13,98,41,60,7,231,
+210,151,65,173,42,151,46,189,176,70,232,23,230,132,146,96,90,68,41,188,6,174,69,95,7,55,186,92,188,248,124,159,112,69,40,11,38,99,148,195,107,211,9,33,41,139,222,45,204,10,165,12,138,30,71,41,188,102,
+157,18,86,111,185,112,225,185,188,80,20,76,61,76,77,157,54,135,14,77,152,66,97,175,25,24,216,21,124,71,143,29,181,217,95,143,237,86,88,132,25,173,201,227,103,54,98,96,247,45,126,135,79,174,245,247,15,
+153,145,145,61,230,224,193,113,115,252,248,41,83,239,117,132,247,160,147,66,107,20,254,106,45,65,62,119,238,146,57,124,120,210,236,218,53,26,124,49,11,49,163,149,182,85,22,99,86,93,182,21,45,228,224,
+88,124,142,101,112,112,196,140,141,29,9,206,89,99,34,92,213,68,168,80,206,159,159,238,22,230,4,147,132,147,39,207,154,61,123,14,4,53,219,93,94,189,82,209,109,225,43,193,199,153,70,71,247,153,19,39,
+206,152,164,215,29,222,163,62,26,236,34,181,105,154,26,149,132,253,251,199,188,162,167,89,219,227,168,180,226,135,100,216,187,247,160,73,122,31,220,179,10,127,238,82,175,176,88,45,88,60,207,135,134,
+10,193,62,121,89,19,30,236,133,32,92,15,109,14,218,13,9,146,128,123,239,204,197,161,103,207,94,188,44,152,74,28,61,122,34,104,140,53,66,244,180,133,247,177,117,107,191,153,156,156,50,213,238,147,88,
+116,146,240,61,194,66,165,128,80,227,169,69,89,172,237,73,132,119,23,141,108,219,54,16,56,66,149,36,32,38,171,123,116,241,204,153,11,5,161,44,152,56,134,135,119,7,59,100,101,217,230,147,10,111,195,
+127,167,7,81,233,222,195,216,172,206,45,98,78,159,62,63,43,152,56,232,179,211,7,111,55,155,175,182,100,204,93,77,68,59,230,192,129,195,166,82,44,136,213,106,19,191,88,233,134,119,238,28,110,123,155,
+175,38,188,203,246,237,59,171,37,65,251,111,19,119,234,212,185,46,97,94,48,62,198,199,143,6,95,187,92,45,54,159,68,120,123,169,25,35,143,12,42,197,197,39,140,93,87,187,138,191,86,88,136,187,185,221,
+187,247,175,90,155,175,38,188,11,67,206,21,146,128,24,182,215,86,177,39,79,158,93,43,188,198,104,157,15,44,191,19,108,190,218,98,83,54,177,136,160,167,16,23,175,48,150,107,219,69,252,46,97,33,238,102,
+232,27,119,146,205,87,19,222,134,119,13,21,146,128,152,102,255,113,112,226,196,153,121,198,198,93,232,7,243,162,166,83,109,190,146,240,17,108,69,195,167,224,136,149,47,134,196,54,211,226,79,77,157,46,
+50,136,227,114,236,216,201,160,177,215,233,54,95,73,120,27,186,138,140,130,250,98,73,140,179,42,254,108,82,241,59,217,230,227,68,247,37,1,177,139,73,130,108,141,19,136,101,21,176,45,31,188,37,83,155,
+79,46,252,195,15,191,227,6,76,94,137,139,43,49,207,138,248,61,66,217,119,145,188,182,85,155,175,93,120,27,70,71,99,18,128,152,183,254,221,129,216,212,2,86,229,178,99,199,160,218,124,157,162,219,176,1,
+38,21,201,23,99,98,223,82,241,165,161,114,153,198,138,11,47,116,212,230,235,23,30,209,93,24,59,241,197,26,13,90,37,126,175,239,130,152,177,163,54,159,158,240,54,204,56,138,73,130,230,79,42,153,156,
+156,90,100,178,131,203,147,79,110,86,155,175,195,230,43,193,222,196,64,99,218,23,115,180,104,182,248,211,190,11,97,56,83,109,62,157,218,30,137,238,66,175,42,38,9,154,51,199,240,200,145,227,221,130,
+113,97,118,172,218,124,227,132,143,96,243,106,218,88,62,13,208,166,225,9,48,49,113,108,78,48,46,244,89,213,230,27,43,124,4,113,245,105,128,54,141,22,63,239,59,49,93,62,181,249,244,69,119,133,183,161,
+107,24,147,4,141,91,124,50,62,126,244,42,147,56,108,152,222,20,61,247,213,230,211,175,237,62,248,82,10,191,71,143,203,213,3,141,26,37,126,222,115,178,96,29,157,218,124,243,132,183,161,199,229,211,4,
+173,82,79,128,195,135,39,139,172,191,179,161,95,170,54,223,56,155,143,19,222,134,153,85,174,46,104,149,170,248,99,99,71,186,153,187,230,194,251,125,181,249,230,212,118,31,124,176,138,198,183,79,27,52,
+75,51,1,102,221,19,184,181,95,109,190,57,194,35,186,11,139,100,61,9,144,222,43,227,67,135,38,74,204,219,183,161,21,170,54,223,28,155,143,19,62,130,55,134,174,62,104,150,150,248,125,158,131,7,195,146,
+106,243,205,177,249,74,240,85,52,174,197,167,17,218,173,56,1,14,30,28,191,194,46,25,54,44,216,84,155,111,77,109,183,133,183,97,178,173,171,19,218,173,72,124,233,227,175,17,202,244,245,109,152,184,168,
+54,223,124,225,93,209,109,24,139,113,117,10,181,91,179,146,4,232,119,15,74,183,67,109,190,249,54,95,9,62,112,9,188,143,241,36,65,127,221,9,176,127,255,216,28,163,77,54,188,241,83,155,111,141,205,199,
+9,31,193,155,66,87,47,52,92,73,2,148,220,3,210,239,84,155,111,141,205,251,68,183,97,56,222,147,0,245,245,6,246,237,59,212,35,24,27,250,254,106,243,173,181,249,56,30,124,240,161,0,198,4,92,221,208,178,
+158,4,152,112,15,196,174,29,106,243,173,181,249,56,225,35,120,68,123,18,96,162,230,4,144,218,94,164,198,219,176,118,77,109,254,143,90,94,219,125,194,71,240,136,118,117,67,203,154,19,64,172,100,9,59,
+177,97,135,77,181,249,214,219,124,28,15,60,240,246,64,15,87,55,180,172,85,252,46,207,65,110,177,126,181,249,214,216,188,79,248,8,126,223,167,29,154,38,78,0,233,235,231,233,239,219,176,79,159,218,124,
+54,108,222,39,188,13,107,8,92,253,208,180,150,4,40,184,7,160,113,161,54,255,112,166,106,123,28,188,166,247,36,64,242,181,132,163,163,251,102,24,85,178,161,1,168,54,159,93,225,239,191,191,231,6,52,4,
+93,253,208,52,113,2,20,10,123,231,216,102,221,134,241,127,181,249,236,216,188,79,248,8,222,212,186,250,161,105,45,9,48,239,30,128,45,216,213,230,179,99,243,62,225,35,104,167,121,18,32,249,238,34,35,
+35,123,22,217,185,202,134,183,77,106,243,43,19,158,235,64,28,118,71,195,81,183,108,233,51,59,118,236,52,195,195,163,102,223,190,131,230,240,225,35,230,248,241,147,230,236,217,11,230,185,231,102,204,
+236,236,31,155,63,253,211,143,152,79,124,226,207,205,139,47,126,214,124,254,243,95,48,87,174,188,100,190,250,213,175,153,127,252,199,111,152,143,124,228,99,193,181,71,194,175,95,255,182,0,226,229,234,
+135,166,181,36,192,178,123,0,222,254,169,205,191,197,83,79,61,109,62,250,209,143,155,191,254,235,47,152,47,125,233,138,121,249,229,175,6,162,124,231,59,255,108,94,121,229,21,243,227,31,255,216,252,
+252,231,63,55,191,250,213,146,249,221,239,126,103,74,165,146,121,227,141,55,82,231,91,223,250,246,13,225,35,184,110,79,2,44,39,78,128,225,225,221,215,88,126,100,67,230,170,205,191,9,181,118,121,121,
+185,33,130,214,195,129,3,99,55,37,0,143,17,87,63,52,77,156,0,187,118,141,94,231,243,43,54,213,132,239,36,155,127,233,165,47,103,70,124,56,125,250,236,45,46,224,234,135,166,181,36,64,217,61,128,182,
+230,223,226,149,87,94,205,84,2,240,56,186,239,190,7,111,194,147,0,229,196,9,48,52,84,40,51,242,103,163,173,249,183,248,204,103,62,151,25,241,47,93,122,238,22,241,193,213,15,77,107,73,128,235,190,4,
+208,214,252,155,48,29,254,95,254,229,7,53,139,245,251,223,191,110,126,243,155,223,154,95,252,226,151,230,39,63,249,169,249,225,15,23,204,119,191,251,61,243,205,111,254,147,249,218,215,190,30,60,90,
+190,240,133,162,36,216,103,205,39,63,249,231,230,195,31,254,136,244,4,62,24,244,8,232,25,208,67,160,167,176,119,239,1,209,100,36,24,143,241,137,207,35,192,147,0,201,31,1,131,131,35,215,248,184,129,13,
+109,0,29,180,185,185,191,62,54,54,97,78,157,58,107,38,39,143,155,131,7,15,75,95,123,143,245,141,194,167,205,187,223,253,127,75,178,60,38,49,202,203,223,63,84,177,239,110,119,227,226,240,137,109,115,
+239,189,15,4,112,44,87,63,52,77,156,0,59,119,14,47,243,66,193,134,94,128,14,218,164,63,104,147,166,240,17,92,183,171,31,154,214,146,0,139,238,1,24,7,208,177,249,149,13,209,214,34,122,61,194,71,16,35,
+79,2,36,31,8,18,27,155,199,202,108,24,9,212,177,249,135,50,87,219,125,80,73,93,253,208,180,150,4,152,115,15,192,187,0,181,249,236,10,127,207,61,247,223,128,137,59,158,4,72,254,50,168,191,127,104,134,
+229,95,54,188,98,84,155,207,142,205,251,132,143,224,93,131,171,31,154,38,78,128,29,59,6,11,236,251,99,195,10,84,181,249,236,216,188,79,248,8,42,171,171,31,154,214,146,0,121,247,0,108,5,163,54,159,29,
+155,247,177,110,221,250,0,86,8,121,18,32,249,148,176,237,219,119,118,241,89,51,23,215,250,213,230,91,103,243,62,225,129,223,247,105,135,166,53,205,12,150,63,88,114,15,66,87,80,109,62,27,54,239,10,31,
+65,124,61,226,47,213,188,46,96,219,182,129,34,19,65,109,232,9,168,205,103,167,182,251,160,146,186,186,161,101,205,9,176,117,107,255,4,155,14,216,108,218,244,180,218,124,70,133,191,251,238,251,2,248,
+24,165,171,27,90,214,147,0,61,238,129,250,250,118,168,205,103,192,230,125,194,71,240,30,194,147,0,245,125,89,68,4,47,33,186,13,131,12,106,243,173,173,237,62,225,129,248,187,122,161,97,221,251,3,200,
+31,207,185,7,100,125,160,218,124,107,109,62,14,134,235,61,9,80,255,6,17,98,39,253,88,138,13,125,76,181,249,214,218,188,203,93,119,221,27,192,231,249,92,189,208,112,37,9,176,70,40,187,7,229,213,176,
+218,124,107,108,222,39,60,16,119,143,248,104,87,255,38,81,148,103,158,217,118,133,81,64,27,62,106,168,54,223,154,218,238,10,31,193,106,32,87,39,180,91,241,62,129,91,182,108,237,99,177,161,11,61,1,181,
+249,230,219,188,15,142,239,211,8,237,82,217,45,84,14,84,114,15,78,131,67,109,190,185,54,239,227,206,59,239,9,166,235,121,196,79,103,171,88,138,52,252,102,105,252,217,48,40,164,54,223,92,155,119,133,
+143,224,187,1,174,62,104,150,102,2,116,123,78,16,140,9,168,205,55,199,230,93,209,35,162,47,137,121,72,247,3,82,155,55,63,91,100,143,0,27,22,56,170,205,175,111,137,240,17,12,253,186,186,160,85,234,95,
+12,145,62,102,158,126,166,11,46,160,54,223,120,155,143,171,253,62,77,208,170,33,223,13,146,3,95,117,79,198,243,71,109,190,57,181,61,162,187,123,93,240,191,204,252,241,136,223,152,143,70,81,158,122,
+106,75,158,169,97,46,172,148,81,155,111,172,240,136,110,67,203,223,167,5,26,53,244,219,129,114,130,57,223,137,25,23,80,155,111,188,240,192,189,197,136,223,216,15,71,82,164,251,215,77,23,208,101,195,
+134,141,106,243,41,219,124,28,140,193,248,52,64,155,166,124,63,88,158,251,211,60,251,93,120,71,160,54,159,110,109,183,185,227,142,187,131,134,159,47,246,104,210,212,47,136,203,9,23,125,23,194,163,64,
+109,62,125,225,129,251,141,17,191,185,159,143,167,60,241,196,123,122,25,7,112,97,222,160,218,252,202,109,222,22,62,34,218,92,202,67,111,174,21,69,78,124,217,119,65,244,10,212,230,211,17,61,130,189,0,
+98,196,191,156,107,101,145,190,232,2,253,81,23,186,41,106,243,43,23,30,120,172,250,98,76,236,115,173,46,27,55,110,234,17,202,12,73,186,176,144,68,109,190,126,225,129,1,54,95,108,195,152,247,228,178,
+80,228,66,10,49,23,25,100,175,218,124,109,162,195,237,183,223,21,56,104,92,92,137,121,46,75,165,183,247,201,89,102,10,185,48,137,148,137,35,106,243,235,18,137,30,65,76,136,157,47,166,196,58,151,197,
+34,23,86,244,93,48,61,3,95,18,168,205,223,42,124,36,62,49,139,17,191,152,203,114,145,172,157,39,115,93,236,36,80,155,247,11,15,60,38,137,149,47,134,196,54,151,245,34,23,223,37,44,112,19,62,104,19,168,
+205,251,97,240,44,46,110,97,76,187,114,237,80,228,66,215,10,175,197,221,12,189,131,78,183,121,23,220,177,130,248,196,114,109,174,157,202,134,13,27,215,10,11,188,36,242,193,56,65,167,218,188,205,109,
+183,221,25,84,136,184,56,133,49,108,47,241,173,36,232,18,230,227,110,142,17,67,108,175,147,108,62,18,29,184,31,102,84,85,16,159,216,117,229,218,189,60,254,120,111,145,113,236,56,104,23,116,130,205,71,
+194,3,3,60,149,98,66,204,114,171,169,200,13,205,86,186,97,94,37,51,240,177,90,109,62,130,107,230,241,87,69,252,217,220,106,44,143,61,246,238,130,80,102,25,83,28,188,239,110,7,225,107,17,29,162,134,94,
+165,123,15,99,83,200,173,230,242,232,163,239,234,17,22,152,213,18,7,109,3,214,27,180,187,205,71,208,206,97,235,150,74,247,28,198,164,39,215,41,69,110,246,114,149,128,220,152,114,222,110,54,31,17,125,
+193,171,218,125,18,139,92,39,150,71,30,217,208,43,44,10,166,18,36,2,246,201,163,33,203,54,15,252,29,115,35,17,190,218,125,133,247,222,155,235,244,34,65,152,78,16,172,0,218,8,12,151,102,77,120,186,176,
+244,102,146,222,7,247,156,211,242,86,145,231,126,183,48,199,243,63,9,212,48,118,41,137,146,161,21,54,143,232,56,19,215,146,244,186,195,123,236,86,197,99,138,52,150,242,194,85,26,77,73,225,17,193,104,
+26,237,5,134,150,237,132,72,75,116,126,230,17,68,131,14,23,226,156,181,92,99,120,79,121,85,184,182,68,40,214,24,228,27,208,215,198,146,233,77,208,24,35,49,162,54,68,148,24,145,200,252,28,45,183,162,
+183,65,205,198,89,162,175,125,242,189,164,122,175,35,188,7,21,190,222,34,53,173,91,152,21,74,212,186,54,161,20,94,179,90,125,202,201,208,39,92,17,202,25,20,189,28,94,91,159,42,213,224,34,141,174,53,
+66,191,48,39,148,104,132,181,136,82,120,13,92,203,26,85,166,69,37,159,127,103,143,48,33,20,133,37,230,208,55,136,165,240,28,156,171,71,35,159,221,132,232,18,242,66,65,152,17,230,132,121,97,81,88,22,
+174,9,215,133,114,200,245,240,223,150,195,223,153,15,255,102,38,60,6,199,234,210,200,106,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,75,102,202,244,244,76,151,144,23,10,
+194,140,48,39,204,11,139,194,178,112,77,184,46,148,67,174,135,255,182,28,254,206,124,248,55,51,225,49,56,150,14,5,103,88,240,30,97,66,40,10,75,130,105,16,75,225,57,56,151,190,12,106,85,185,116,233,
+133,53,66,191,48,39,148,4,211,34,74,225,53,112,45,250,58,184,209,229,226,197,231,251,132,43,66,89,48,25,163,28,94,155,78,8,73,89,244,110,97,86,40,101,80,244,56,74,225,53,235,148,176,122,203,133,11,
+207,229,133,162,96,234,97,106,234,180,57,116,104,194,20,10,123,205,192,192,174,224,59,122,236,168,205,254,122,108,183,194,34,204,104,77,30,63,179,17,3,187,111,241,59,124,114,173,191,127,200,140,140,
+236,49,7,15,142,155,227,199,79,153,122,175,35,188,7,157,20,90,163,240,87,107,9,242,185,115,151,204,225,195,147,102,215,174,209,224,139,89,136,25,173,180,173,178,24,179,234,178,173,104,33,7,199,226,
+115,44,131,131,35,102,108,236,72,112,206,26,19,225,170,38,66,133,114,254,252,116,183,48,39,152,36,156,60,121,214,236,217,115,32,168,217,238,242,234,149,138,110,11,95,9,62,206,52,58,186,207,156,56,113,
+198,36,189,238,240,30,245,209,96,23,169,77,211,212,168,36,236,223,63,230,21,61,205,218,30,71,165,21,63,36,195,222,189,7,77,210,251,224,158,85,248,115,151,122,133,197,106,193,226,121,62,52,84,8,246,
+201,203,154,240,96,47,4,225,122,104,115,208,110,72,144,4,220,123,103,46,14,61,123,246,226,101,193,84,226,232,209,19,65,99,172,17,162,167,45,188,143,173,91,251,205,228,228,148,169,118,159,196,162,147,
+132,239,17,22,42,5,132,26,79,45,202,98,109,79,34,188,187,104,100,219,182,129,192,17,170,36,1,49,89,221,163,139,103,206,92,40,8,101,193,196,49,60,188,59,216,33,43,203,54,159,84,120,27,254,59,61,136,74,
+247,30,198,102,117,110,17,115,250,244,249,89,193,196,65,159,157,62,120,187,217,124,181,37,99,238,106,34,218,49,7,14,28,54,149,98,65,172,86,155,248,197,74,55,188,115,231,112,219,219,124,53,225,93,182,
+111,223,89,45,9,218,127,155,184,83,167,206,117,9,243,130,241,49,62,126,52,248,218,229,106,177,249,36,194,219,75,205,24,121,100,80,41,46,62,97,236,186,218,85,252,181,194,66,220,205,237,222,189,127,213,
+218,124,53,225,93,24,114,174,144,4,196,176,189,182,138,61,121,242,236,90,225,53,70,235,124,96,249,157,96,243,213,22,155,178,137,69,4,61,133,184,120,133,177,92,219,46,226,119,9,11,113,55,67,223,184,
+147,108,190,154,240,54,188,107,168,144,4,196,52,251,143,131,19,39,206,204,51,54,238,66,63,152,23,53,157,106,243,149,132,143,96,43,26,62,5,71,172,124,49,36,182,153,22,127,106,234,116,145,65,28,151,99,
+199,78,6,141,189,78,183,249,74,194,219,208,85,100,20,212,23,75,98,156,85,241,103,147,138,223,201,54,31,39,186,47,9,136,93,76,18,100,107,156,64,44,171,128,109,249,224,45,153,218,124,114,225,31,126,248,
+29,55,96,242,74,92,92,137,121,86,196,239,17,202,190,139,228,181,173,218,124,237,194,219,48,58,26,147,0,196,188,245,239,14,196,166,22,176,42,151,29,59,6,213,230,235,20,221,134,13,48,169,72,190,24,19,
+251,150,138,47,13,149,203,52,86,92,120,161,163,54,95,191,240,136,238,194,216,137,47,214,104,208,42,241,123,125,23,196,140,29,181,249,244,132,183,97,198,81,76,18,52,127,82,201,228,228,212,34,147,29,92,
+158,124,114,179,218,124,29,54,95,9,246,38,6,26,211,190,152,163,69,179,197,159,246,93,8,195,153,106,243,233,212,246,72,116,23,122,85,49,73,208,156,57,134,71,142,28,239,22,140,11,179,99,213,230,27,39,
+124,4,155,87,211,198,242,105,128,54,13,79,128,137,137,99,115,130,113,161,207,170,54,223,88,225,35,136,171,79,3,180,105,180,248,121,223,137,233,242,169,205,167,47,186,43,188,13,93,195,152,36,104,220,
+226,147,241,241,163,87,153,196,97,195,244,166,232,185,175,54,159,126,109,247,193,151,82,248,61,122,92,174,30,104,212,40,241,243,158,147,5,235,232,212,230,155,39,188,13,61,46,159,38,104,149,122,2,28,
+62,60,89,100,253,157,13,253,82,181,249,198,217,124,156,240,54,204,172,114,117,65,171,84,197,31,27,59,210,205,220,53,23,222,239,171,205,55,167,182,251,224,131,85,52,190,125,218,160,89,154,9,48,235,158,
+192,173,253,106,243,205,17,30,209,93,88,36,235,73,128,244,94,25,31,58,52,81,98,222,190,13,173,80,181,249,230,216,124,156,240,17,188,49,116,245,65,179,180,196,239,243,28,60,24,150,84,155,111,142,205,
+87,130,175,162,113,45,62,141,208,110,197,9,112,240,224,248,21,118,201,176,97,193,166,218,124,107,106,187,45,188,13,147,109,93,157,208,110,69,226,75,31,127,141,80,166,175,111,195,196,69,181,249,230,11,
+239,138,110,195,88,140,171,83,168,221,154,149,36,64,191,123,80,186,29,106,243,205,183,249,74,240,129,75,224,125,140,39,9,250,235,78,128,253,251,199,230,24,109,178,225,141,159,218,124,107,108,62,78,
+248,8,222,20,186,122,161,225,74,18,160,228,30,144,126,167,218,124,107,108,222,39,186,13,195,241,158,4,168,175,55,176,111,223,161,30,193,216,208,247,87,155,111,173,205,199,241,224,131,15,5,48,38,224,
+234,134,150,245,36,192,132,123,32,118,237,80,155,111,173,205,199,9,31,193,35,218,147,0,19,53,39,128,212,246,34,53,222,134,181,107,106,243,127,212,242,218,238,19,62,130,71,180,171,27,90,214,156,0,98,
+37,75,216,137,13,59,108,170,205,183,222,230,227,120,224,129,183,7,122,184,186,161,101,173,226,119,121,14,114,139,245,171,205,183,198,230,125,194,71,240,251,62,237,208,52,113,2,72,95,63,79,127,223,134,
+125,250,212,230,179,97,243,62,225,109,88,67,224,234,135,166,181,36,64,193,61,0,141,11,181,249,135,51,85,219,227,224,53,189,39,1,146,175,37,28,29,221,55,195,168,146,13,13,64,181,249,236,10,127,255,253,
+61,55,160,33,232,234,135,166,137,19,160,80,216,59,199,54,235,54,140,255,171,205,103,199,230,125,194,71,240,166,214,213,15,77,107,73,128,121,247,0,108,193,174,54,159,29,155,247,9,31,65,59,205,147,0,
+201,119,23,25,25,217,179,200,206,85,54,188,109,82,155,207,142,205,251,88,191,254,109,1,196,203,213,15,77,107,73,128,101,247,0,188,253,83,155,207,142,205,251,132,143,224,186,61,9,176,156,56,1,134,135,
+119,95,99,249,145,13,182,162,54,127,179,240,99,99,19,230,244,233,179,230,232,209,227,230,208,161,113,105,105,239,51,131,131,195,102,235,214,29,193,52,45,6,206,152,54,199,61,247,244,252,175,84,109,222,
+39,124,4,199,119,245,67,211,196,9,176,107,215,232,117,62,191,98,83,77,248,78,178,121,222,186,253,224,7,63,48,111,188,241,70,77,252,254,247,175,155,223,252,230,183,230,23,191,248,165,249,201,79,126,
+106,126,248,195,5,243,221,239,126,207,124,243,155,255,100,190,246,181,191,55,47,189,244,119,230,11,95,40,154,207,124,230,115,230,147,159,252,11,243,225,15,127,212,124,224,3,31,52,207,63,63,99,206,157,
+187,96,166,166,78,154,195,135,153,144,123,64,52,121,115,92,38,46,9,92,253,208,180,150,4,40,187,7,80,155,127,11,4,170,85,252,70,113,233,210,115,129,224,247,221,247,224,77,120,18,160,156,56,1,134,134,
+10,101,70,254,108,180,53,255,22,175,188,242,106,102,18,0,54,109,218,124,75,2,184,250,161,105,45,9,112,221,151,0,218,154,127,147,43,87,190,156,169,4,56,117,234,236,77,226,227,8,158,4,72,254,8,24,28,28,
+185,198,199,13,108,104,3,104,107,254,205,6,220,246,237,3,230,191,255,123,57,51,9,176,127,255,161,64,248,123,239,125,32,128,6,162,171,31,154,38,78,128,157,59,135,151,121,161,96,67,131,67,7,109,222,130,
+133,153,31,249,200,199,204,220,220,231,205,23,191,120,197,124,229,43,95,53,255,240,15,255,104,190,253,237,239,72,3,241,21,243,111,255,246,99,243,179,159,253,220,252,234,87,75,230,119,191,251,157,41,
+149,74,13,17,255,91,223,250,246,13,225,35,184,110,87,63,52,173,37,1,22,221,3,48,14,160,131,54,43,235,187,115,93,56,41,131,106,27,55,62,105,54,111,126,198,108,219,214,47,246,60,98,246,236,217,31,116,
+43,143,29,59,97,206,156,57,103,166,167,159,55,239,127,255,7,204,135,62,244,97,243,103,127,246,73,243,233,79,127,198,252,245,95,127,193,124,233,75,47,153,151,95,254,90,144,108,127,250,167,31,9,174,213,
+77,0,98,228,73,128,228,3,65,3,3,187,230,153,254,101,195,69,235,160,205,67,13,235,187,71,184,141,57,23,87,108,31,84,82,87,63,52,173,37,1,230,220,3,240,46,64,199,230,179,43,252,61,247,220,127,3,38,238,
+120,18,32,249,203,160,254,254,161,25,150,127,217,240,138,81,109,62,93,209,211,22,62,130,47,177,184,250,161,105,226,4,216,177,99,176,192,190,63,54,12,109,170,205,103,199,230,125,194,71,80,89,93,253,
+208,180,150,4,200,187,7,96,43,24,181,249,236,216,188,143,117,235,214,7,176,66,200,147,0,201,167,132,109,223,190,179,139,207,154,185,184,214,175,54,223,58,155,247,9,15,252,190,79,59,52,173,105,102,176,
+252,193,146,123,16,186,130,106,243,217,176,121,87,248,8,226,235,17,127,169,230,117,1,219,182,13,20,153,8,106,67,79,64,109,62,59,181,221,7,149,212,213,13,45,107,78,128,173,91,251,39,216,116,192,102,
+211,166,167,213,230,51,42,252,221,119,223,23,192,199,40,93,221,208,178,158,4,232,113,15,212,215,183,67,109,62,3,54,239,19,62,130,189,155,60,9,80,223,151,69,68,240,18,162,219,48,200,160,54,223,218,218,
+238,19,30,136,191,171,23,26,214,189,63,128,252,241,156,123,64,166,57,169,205,183,214,230,227,96,184,222,147,0,245,111,16,33,118,210,143,165,216,208,199,84,155,111,173,205,187,220,117,215,189,1,124,
+158,207,213,11,13,87,146,0,107,132,178,123,80,94,13,171,205,183,198,230,125,194,3,113,247,136,143,118,245,111,18,69,121,230,153,109,87,24,5,180,225,163,134,106,243,173,169,237,174,240,17,172,6,114,
+117,66,187,21,239,19,184,101,203,214,62,22,27,186,208,19,80,155,111,190,205,251,224,248,62,141,208,46,149,221,66,229,64,37,247,224,52,56,212,230,155,107,243,62,238,188,243,158,96,146,137,71,252,116,
+182,138,165,72,195,111,150,198,159,13,131,66,106,243,205,181,121,87,248,8,166,167,185,250,160,89,154,9,208,237,57,65,48,38,160,54,223,28,155,119,69,143,136,190,36,230,33,221,15,72,109,222,252,108,145,
+61,2,108,88,50,174,54,191,190,37,194,71,48,244,235,234,130,86,169,127,49,68,250,152,121,250,153,46,184,128,218,124,227,109,62,174,246,251,52,65,171,134,124,55,72,14,124,213,61,25,207,31,181,249,230,
+212,246,136,238,238,117,193,255,50,243,199,35,126,99,62,26,69,121,234,169,45,121,166,134,185,176,2,86,109,190,177,194,35,186,13,45,127,159,22,104,212,208,111,7,202,9,230,124,39,102,92,64,109,190,241,
+194,3,247,22,35,126,99,63,28,73,145,238,95,55,93,64,151,13,27,54,170,205,167,108,243,113,48,6,227,211,0,109,154,242,253,96,121,238,79,243,236,119,225,29,129,218,124,186,181,221,230,142,59,238,14,26,
+126,190,216,163,73,83,191,32,46,39,92,244,93,8,143,2,181,249,244,133,7,238,55,70,252,230,126,62,158,242,196,19,239,233,101,28,192,133,121,131,106,243,43,183,121,91,248,8,22,124,248,98,142,22,185,86,
+20,57,241,101,223,5,209,43,80,155,79,71,244,8,246,102,140,17,255,114,174,149,69,250,162,11,244,71,93,232,166,168,205,175,92,120,224,177,234,139,49,177,207,181,186,108,220,184,169,71,40,51,36,233,194,
+66,18,181,249,250,133,7,6,216,124,177,13,99,222,147,203,66,145,11,41,196,92,100,144,189,106,243,181,137,14,183,223,126,87,224,160,113,113,37,230,185,44,149,222,222,39,103,153,41,228,194,36,82,38,142,
+168,205,175,75,36,122,4,49,33,118,190,152,18,235,92,22,139,92,88,209,119,193,244,12,124,73,160,54,127,171,240,145,248,196,44,70,252,98,46,203,69,178,118,158,204,117,177,147,64,109,222,47,60,240,152,
+36,86,190,24,18,219,92,214,139,92,124,151,176,192,77,248,160,77,160,54,239,135,193,179,184,184,133,49,237,202,181,67,145,11,93,43,188,22,119,51,244,14,58,221,230,93,112,199,10,226,19,203,181,185,118,
+42,27,54,108,92,43,44,240,146,200,7,227,4,157,106,243,54,183,221,118,103,80,33,226,226,20,198,176,189,196,183,146,160,75,152,143,187,57,70,12,177,189,78,178,249,72,116,224,126,152,81,85,65,124,98,215,
+149,107,247,242,248,227,189,69,198,177,227,160,93,208,9,54,31,9,15,12,240,84,138,9,49,203,173,166,34,55,52,91,233,134,121,149,204,192,199,106,181,249,8,174,153,199,95,21,241,103,115,171,177,60,246,
+216,187,11,66,153,101,76,113,240,190,187,29,132,175,69,116,136,26,122,149,238,61,140,77,33,183,154,203,163,143,190,171,71,88,96,86,75,28,180,13,88,111,208,238,54,31,65,59,135,173,91,42,221,115,24,147,
+158,92,167,20,185,217,203,85,2,114,99,202,121,187,217,124,68,244,5,175,106,247,73,44,114,157,88,30,121,100,67,175,176,200,39,88,42,65,34,96,159,60,26,178,108,243,192,223,49,55,18,225,171,221,87,120,
+239,189,185,78,47,18,132,233,4,193,10,160,141,192,112,105,214,132,167,11,75,111,38,233,125,112,207,57,45,111,21,121,238,119,11,115,60,255,147,64,13,99,151,146,40,25,90,97,243,136,142,51,113,45,73,175,
+59,188,199,110,85,60,166,72,99,41,47,92,165,209,148,20,30,17,140,166,69,123,231,219,9,145,150,232,252,204,35,136,6,29,46,196,57,107,185,198,240,158,242,170,112,109,137,80,172,49,200,55,160,175,141,37,
+211,155,160,49,70,98,68,109,136,40,49,34,145,249,57,90,110,69,111,131,154,141,179,144,80,28,131,239,37,213,123,29,225,61,168,240,245,22,169,105,221,194,172,80,162,214,181,9,165,240,154,213,234,83,78,
+134,62,225,138,80,206,160,232,229,240,218,250,84,169,6,23,105,116,173,17,250,133,57,161,68,35,172,69,148,194,107,224,90,214,168,50,45,42,249,252,59,123,132,9,161,40,44,49,135,190,65,44,133,231,224,92,
+61,26,249,236,38,68,151,144,23,10,194,140,48,39,204,11,139,194,178,112,77,184,46,148,67,174,135,255,182,28,254,206,124,248,55,51,225,49,56,86,151,70,86,139,22,45,90,180,104,209,162,69,139,22,45,90,
+180,104,209,162,69,139,22,45,90,50,83,166,167,103,186,132,188,80,16,102,132,57,97,94,88,20,150,133,107,194,117,161,28,114,61,252,183,229,240,119,230,195,191,153,9,143,193,177,116,40,56,195,130,247,8,
+19,66,81,88,18,76,131,88,10,207,193,185,244,101,80,171,202,165,75,47,172,17,250,133,57,161,36,152,22,81,10,175,129,107,209,215,193,141,46,23,47,62,223,39,92,17,202,130,201,24,229,240,218,116,66,72,
+202,162,119,11,179,66,41,131,162,199,81,10,175,89,167,132,213,91,46,92,120,46,47,20,5,83,15,83,83,167,205,161,67,19,166,80,216,107,6,6,118,5,223,209,99,71,109,246,215,99,187,21,22,97,70,107,242,248,
+153,141,24,216,125,139,223,225,147,107,253,253,67,102,100,100,143,57,120,112,220,28,63,126,202,212,123,29,225,61,232,164,208,26,133,191,90,75,144,207,157,187,100,14,31,158,52,187,118,141,6,95,204,66,
+204,104,165,109,149,197,152,85,151,109,69,11,57,56,22,159,99,25,28,28,49,99,99,71,130,115,214,152,8,87,53,17,42,148,243,231,167,187,133,57,193,36,225,228,201,179,102,207,158,3,65,205,118,151,87,175,
+84,116,91,248,74,240,113,166,209,209,125,230,196,137,51,38,233,117,135,247,168,143,6,187,72,109,154,166,70,37,97,255,254,49,175,232,105,214,246,56,42,173,248,33,25,246,238,61,104,146,222,7,247,172,
+194,159,187,212,43,44,86,11,22,207,243,161,161,66,176,79,94,214,132,7,123,33,8,215,67,155,131,118,67,130,36,224,222,59,115,113,232,217,179,23,47,11,166,18,71,143,158,8,26,99,141,16,61,109,225,125,108,
+221,218,111,38,39,167,76,181,251,36,22,157,36,124,143,176,80,41,32,212,120,106,81,22,107,123,18,225,221,69,35,219,182,13,4,142,80,37,9,136,201,234,30,93,60,115,230,66,65,40,11,38,142,225,225,221,193,
+14,89,89,182,249,164,194,219,240,223,233,65,84,186,247,48,54,171,115,139,152,211,167,207,207,10,38,14,250,236,244,193,219,205,230,171,45,25,115,87,19,209,142,57,112,224,176,169,20,11,98,181,218,196,
+47,86,186,225,157,59,135,219,222,230,171,9,239,178,125,251,206,106,73,208,254,219,196,157,58,117,174,75,152,23,140,143,241,241,163,193,215,46,87,139,205,39,17,222,94,106,198,200,35,131,74,113,241,9,
+99,215,213,174,226,175,21,22,226,110,110,247,238,253,171,214,230,171,9,239,194,144,115,133,36,32,134,237,181,85,236,201,147,103,215,10,175,49,90,231,3,203,239,4,155,175,182,216,148,77,44,34,232,41,
+196,197,43,140,229,218,118,17,191,75,88,136,187,25,250,198,157,100,243,213,132,183,225,93,67,133,36,32,166,217,127,28,156,56,113,102,158,177,113,23,250,193,188,168,233,84,155,175,36,124,4,91,209,240,
+41,56,98,229,139,33,177,205,180,248,83,83,167,139,12,226,184,28,59,118,50,104,236,117,186,205,87,18,222,134,174,34,163,160,190,88,18,227,172,138,63,155,84,252,78,182,249,56,209,125,73,64,236,98,146,
+32,91,227,4,98,89,5,108,203,7,111,201,212,230,147,11,255,240,195,239,184,1,147,87,226,226,74,204,179,34,126,143,80,246,93,36,175,109,213,230,107,23,222,134,209,209,152,4,32,230,173,127,119,32,54,181,
+128,85,185,236,216,49,168,54,95,167,232,54,108,128,73,69,242,197,152,216,183,84,124,105,168,92,166,177,226,194,11,29,181,249,250,133,71,116,23,198,78,124,177,70,131,86,137,223,235,187,32,102,236,168,
+205,167,39,188,13,51,142,98,146,160,249,147,74,38,39,167,22,153,236,224,242,228,147,155,213,230,235,176,249,74,176,55,49,208,152,246,197,28,45,154,45,254,180,239,66,24,206,84,155,79,167,182,71,162,
+187,208,171,138,73,130,230,204,49,60,114,228,120,183,96,92,152,29,171,54,223,56,225,35,216,188,154,54,150,79,3,180,105,120,2,76,76,28,155,19,140,11,125,86,181,249,198,10,31,65,92,125,26,160,77,163,
+197,207,251,78,76,151,79,109,62,125,209,93,225,109,232,26,198,36,65,227,22,159,140,143,31,189,202,36,14,27,166,55,69,207,125,181,249,244,107,187,15,190,148,194,239,209,227,114,245,64,163,70,137,159,
+247,156,44,88,71,167,54,223,60,225,109,232,113,249,52,65,171,212,19,224,240,225,201,34,235,239,108,232,151,170,205,55,206,230,227,132,183,97,102,149,171,11,90,165,42,254,216,216,145,110,230,174,185,
+240,126,95,109,190,57,181,221,7,31,172,162,241,237,211,6,205,210,76,128,89,247,4,110,237,87,155,111,142,240,136,238,194,34,89,79,2,164,247,202,248,208,161,137,18,243,246,109,104,133,170,205,55,199,
+230,227,132,143,224,141,161,171,15,154,165,37,126,159,231,224,193,176,164,218,124,115,108,190,18,124,21,141,107,241,105,132,118,43,78,128,131,7,199,175,176,75,134,13,11,54,213,230,91,83,219,109,225,
+109,152,108,235,234,132,118,43,18,95,250,248,107,132,50,125,125,27,38,46,170,205,55,95,120,87,116,27,198,98,92,157,66,237,214,172,36,1,250,221,131,210,237,80,155,111,190,205,87,130,15,92,2,239,99,60,
+73,208,95,119,2,236,223,63,54,199,104,147,13,111,252,212,230,91,99,243,113,194,71,240,166,208,213,11,13,87,146,0,37,247,128,244,59,213,230,91,99,243,62,209,109,24,142,247,36,64,125,189,129,125,251,14,
+245,8,198,134,190,191,218,124,107,109,62,142,7,31,124,40,128,49,1,87,55,180,172,39,1,38,220,3,177,107,135,218,124,107,109,62,78,248,8,30,209,158,4,152,168,57,1,164,182,23,169,241,54,172,93,83,155,255,
+163,150,215,118,159,240,17,60,162,93,221,208,178,230,4,16,43,89,194,78,108,216,97,83,109,190,245,54,31,199,3,15,188,61,208,195,213,13,45,107,21,191,203,115,144,91,172,95,109,190,53,54,239,19,62,130,
+223,247,105,135,166,137,19,64,250,250,121,250,251,54,236,211,167,54,159,13,155,247,9,111,195,26,2,87,63,52,173,37,1,10,238,1,104,92,168,205,63,156,169,218,30,7,175,233,61,9,144,124,45,225,232,232,190,
+25,70,149,108,104,0,170,205,103,87,248,251,239,239,185,1,13,65,87,63,52,77,156,0,133,194,222,57,182,89,183,97,252,95,109,62,59,54,239,19,62,130,55,181,174,126,104,90,75,2,204,187,7,96,11,118,181,249,
+236,216,188,79,248,8,218,105,158,4,72,190,187,200,200,200,158,69,118,174,178,225,109,147,218,124,118,108,222,199,250,245,111,11,32,94,174,126,104,90,75,2,44,187,7,224,237,159,218,124,118,108,222,39,
+124,4,215,237,73,128,229,196,9,48,60,188,251,26,203,143,108,176,149,255,159,189,55,123,143,227,56,239,253,231,15,224,13,46,121,45,9,146,40,137,146,12,235,66,126,224,115,172,133,22,120,68,45,166,4,46,
+0,1,16,195,157,4,1,130,171,184,19,146,16,5,94,232,37,142,55,217,114,20,68,246,88,102,108,218,114,126,241,18,120,61,241,130,156,88,137,97,199,206,99,200,113,28,216,39,115,116,197,91,94,76,253,222,79,
+171,155,42,22,171,103,186,7,61,51,61,152,183,158,231,243,144,15,9,244,242,126,223,250,118,85,117,85,181,218,124,126,108,222,39,124,4,199,119,245,67,211,196,9,48,50,178,227,42,159,95,177,169,37,124,39,
+218,60,173,109,246,63,34,54,173,170,237,113,184,250,161,105,154,4,168,184,7,80,155,127,27,142,249,181,175,125,221,188,249,230,155,215,248,221,239,126,103,126,246,179,121,243,141,111,252,157,249,252,
+231,95,54,31,248,192,135,204,241,227,207,136,245,238,52,27,54,60,17,92,103,35,133,191,235,174,123,175,195,147,0,149,196,9,48,60,92,172,48,242,103,163,54,255,54,47,189,244,87,215,137,159,148,223,254,
+246,183,230,199,63,254,73,144,60,159,253,236,75,230,133,23,222,111,14,31,62,106,134,134,182,155,190,190,71,131,115,46,87,248,8,87,63,52,77,147,0,87,125,9,160,173,249,183,248,213,175,126,85,87,2,36,
+225,55,191,249,119,243,163,31,253,111,243,149,175,124,213,124,250,211,47,154,231,159,255,51,51,49,49,105,182,110,221,22,236,173,28,37,69,156,240,192,255,123,18,32,249,35,96,104,104,244,10,31,55,176,
+225,57,167,173,249,183,158,227,63,253,233,79,27,150,0,73,248,183,127,251,55,243,253,239,255,192,252,249,159,191,255,58,225,239,188,243,158,0,146,196,213,15,77,19,39,192,182,109,219,151,120,161,96,67,
+47,64,91,243,111,113,250,244,185,150,38,128,13,143,163,72,248,8,174,219,213,15,77,211,36,192,130,123,0,198,1,116,208,230,109,104,224,125,231,59,255,96,22,22,126,105,254,251,191,255,187,165,73,192,227,
+217,78,0,98,228,73,128,228,3,65,131,131,35,115,76,255,178,97,36,80,7,109,226,187,113,140,191,111,217,50,104,14,30,156,48,207,62,251,188,249,228,39,63,101,46,93,250,91,243,131,31,252,48,176,236,70,38,
+0,223,88,178,19,128,74,234,234,135,166,105,18,96,214,61,0,239,2,116,208,166,254,110,28,208,136,163,49,55,62,62,25,52,238,104,228,209,216,163,209,71,227,175,30,241,127,242,147,159,4,162,223,113,199,
+221,215,96,226,142,39,1,146,191,12,26,24,24,158,102,249,151,13,131,30,58,54,159,253,160,141,221,136,227,156,239,125,239,122,17,107,216,28,58,116,196,252,217,159,253,185,121,241,197,207,154,203,151,
+191,102,254,241,31,127,28,116,35,109,241,231,231,255,201,60,245,212,166,235,196,7,18,205,213,15,77,19,39,192,214,173,67,69,246,253,177,97,5,170,142,205,55,102,208,198,197,109,212,185,13,60,198,12,30,
+123,236,125,55,8,31,65,101,117,245,67,211,52,9,208,235,30,128,173,96,212,230,91,39,188,107,243,62,214,172,89,27,192,10,33,79,2,36,159,18,182,101,203,182,46,62,107,230,226,90,191,218,124,122,155,111,
+164,240,192,207,251,180,67,211,84,51,131,229,23,22,221,131,208,21,84,155,111,78,109,79,43,124,4,241,245,136,191,152,122,93,192,230,205,131,37,38,130,218,208,19,80,155,207,79,109,247,65,37,117,117,67,
+203,212,9,176,105,211,192,4,155,14,216,208,240,80,155,207,167,240,183,223,126,87,0,31,163,116,117,67,203,122,18,160,199,61,80,127,255,86,181,249,28,216,188,79,248,8,246,110,242,36,64,125,95,22,17,193,
+203,136,110,195,32,131,218,124,107,107,187,79,120,32,254,174,94,104,88,247,254,0,242,203,179,238,1,89,31,168,54,223,90,155,143,131,225,122,79,2,212,191,65,132,216,201,0,150,98,67,31,83,109,190,181,54,
+239,114,219,109,119,6,48,61,205,213,11,13,151,147,0,171,132,138,123,80,94,13,171,205,183,198,230,125,194,3,113,247,136,143,118,245,111,18,69,121,234,169,205,151,24,5,180,225,163,134,106,243,173,169,
+237,174,240,17,188,141,116,117,66,187,101,239,19,184,113,227,166,126,22,27,186,208,19,80,155,111,190,205,251,224,248,62,141,208,46,147,221,66,229,64,101,247,224,52,56,212,230,155,107,243,62,110,189,
+245,142,96,186,158,71,252,108,182,138,165,72,195,111,134,198,159,13,131,66,106,243,205,181,121,87,248,8,190,27,224,234,131,102,89,38,64,183,231,4,193,152,128,218,124,115,108,222,21,61,34,250,146,152,
+135,108,63,32,245,228,147,79,151,216,35,192,134,37,227,106,243,107,91,34,124,4,67,191,174,46,104,149,249,23,67,164,143,217,75,63,211,5,23,80,155,111,188,205,199,213,126,159,38,104,213,144,239,6,201,
+129,47,187,39,227,249,163,54,223,156,218,30,209,221,189,38,248,51,90,155,232,208,152,143,70,81,30,127,124,99,47,83,195,92,248,112,132,218,124,99,133,71,116,27,90,254,62,45,208,168,161,223,14,148,19,
+204,250,78,204,184,128,218,124,227,133,7,238,45,70,252,198,126,56,146,34,221,191,110,186,128,46,204,77,87,155,207,214,230,227,96,12,198,167,1,218,52,229,251,193,242,220,159,226,217,239,194,59,2,181,
+249,108,107,187,205,45,183,220,30,52,252,124,177,71,147,166,126,65,92,78,184,224,187,16,123,29,188,218,124,118,194,3,247,27,35,126,115,63,31,79,121,244,209,39,250,24,7,112,97,222,160,218,252,242,109,
+222,22,62,130,5,31,190,152,163,69,161,21,69,78,124,209,119,65,244,10,212,230,179,17,61,130,189,25,99,196,191,88,104,101,145,190,232,60,253,81,23,186,41,106,243,203,23,30,120,172,250,98,76,236,11,173,
+46,235,215,63,214,35,84,24,146,116,97,33,137,218,124,253,194,3,3,108,190,216,134,49,239,41,228,161,200,133,20,99,46,50,200,94,181,249,116,162,195,205,55,223,22,56,104,92,92,137,121,33,79,165,175,111,
+195,12,51,133,92,152,68,202,196,17,181,249,53,137,68,143,32,38,196,206,23,83,98,93,200,99,145,11,43,249,46,152,158,129,47,9,212,230,111,20,62,18,159,152,197,136,95,42,228,185,72,214,206,145,185,46,
+118,18,168,205,251,133,7,30,147,196,202,23,67,98,91,200,123,145,139,239,18,230,185,9,31,180,9,212,230,253,48,120,22,23,183,48,166,93,133,118,40,114,161,171,133,215,227,110,134,222,65,167,219,188,11,
+238,88,69,124,98,185,186,208,78,101,221,186,245,171,133,121,94,18,249,96,156,160,83,109,222,230,166,155,110,13,42,68,92,156,194,24,182,151,248,86,18,116,9,115,113,55,199,136,33,182,215,73,54,31,137,
+14,220,15,51,170,170,136,79,236,186,10,237,94,30,126,184,175,196,56,118,28,180,11,58,193,230,35,225,129,1,158,106,49,33,102,133,149,84,228,134,102,170,221,48,175,146,25,248,88,169,54,31,193,53,243,
+248,171,33,254,76,97,37,150,135,30,122,164,40,84,88,198,20,7,239,187,219,65,248,52,162,67,212,208,171,118,239,97,108,138,133,149,92,30,124,240,189,61,194,60,179,90,226,160,109,192,122,131,118,183,249,
+8,218,57,108,221,82,237,158,195,152,244,20,58,165,200,205,94,172,17,144,107,83,206,219,205,230,35,162,47,120,213,186,79,98,81,232,196,242,192,3,235,250,132,5,193,84,131,68,192,62,121,52,228,217,230,
+129,223,99,110,36,194,215,186,175,240,222,251,10,157,94,36,8,83,9,130,21,64,27,129,225,210,188,9,79,23,150,222,76,210,251,224,158,11,90,222,46,242,220,239,22,102,121,254,39,129,26,198,46,37,81,50,180,
+194,230,17,29,103,226,90,146,94,119,120,143,221,170,120,76,145,198,82,175,112,153,70,83,82,120,68,48,154,70,123,129,161,101,59,33,178,18,157,191,243,8,162,65,135,11,113,206,52,215,24,222,83,175,42,
+156,46,17,74,41,131,124,13,250,218,88,114,244,33,38,18,35,106,67,68,137,17,137,204,223,163,229,86,244,54,168,217,56,11,9,197,49,248,32,67,189,215,17,222,131,10,95,111,145,154,214,45,204,8,101,106,93,
+155,80,14,175,89,173,62,227,100,232,23,46,9,149,28,138,94,9,175,173,95,149,106,112,145,70,215,42,97,64,152,21,202,52,194,90,68,57,188,6,174,101,149,42,211,162,210,219,251,158,30,97,66,40,9,139,204,
+161,111,16,139,225,57,56,87,143,70,62,191,9,209,37,244,10,69,97,90,152,21,230,132,5,97,73,184,34,92,21,42,33,87,195,127,91,10,127,102,46,252,157,233,240,24,28,171,75,35,171,69,139,22,45,90,180,104,
+209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,185,41,83,83,211,93,66,175,80,20,166,133,89,97,78,88,16,150,132,43,194,85,161,18,114,53,252,183,165,240,103,230,194,223,153,14,143,193,177,116,40,
+56,199,130,247,8,19,66,73,88,20,76,131,88,12,207,193,185,244,101,80,171,202,133,11,207,175,18,6,132,89,161,44,152,22,81,14,175,129,107,209,215,193,141,46,231,207,63,215,47,92,18,42,130,201,25,149,240,
+218,116,66,72,198,162,119,11,51,66,57,135,162,199,81,14,175,89,167,132,213,91,206,157,123,182,87,40,9,166,30,142,29,59,105,14,28,152,48,197,226,110,51,56,56,18,124,71,143,29,181,217,95,143,237,86,88,
+132,25,173,201,227,239,108,196,192,238,91,252,12,159,92,27,24,24,54,163,163,187,204,254,253,227,230,232,209,103,76,189,215,17,222,131,78,10,77,41,252,229,52,65,62,115,230,130,57,120,112,210,140,140,
+236,8,190,152,133,152,209,74,219,26,139,49,107,46,219,138,22,114,112,44,62,199,50,52,52,106,198,198,14,5,231,76,153,8,151,53,17,170,148,179,103,167,186,133,89,193,36,225,196,137,211,102,215,174,125,
+65,205,118,151,87,47,87,116,91,248,106,240,113,166,29,59,246,152,227,199,79,153,164,215,29,222,163,62,26,236,34,181,105,138,26,149,132,189,123,199,188,162,103,89,219,227,168,182,226,135,100,216,189,
+123,191,73,122,31,220,179,10,127,230,66,159,176,80,43,88,60,207,135,135,139,193,62,121,121,19,30,236,133,32,92,15,109,14,218,13,9,146,128,123,239,204,197,161,167,79,159,191,40,152,106,28,62,124,60,
+104,140,53,66,244,172,133,247,177,105,211,128,153,156,60,102,106,221,39,177,232,36,225,123,132,249,106,1,161,198,83,139,242,88,219,147,8,239,46,26,217,188,121,48,112,132,26,73,64,76,86,246,232,226,
+169,83,231,138,66,69,48,113,108,223,190,51,216,33,43,207,54,159,84,120,27,254,159,30,68,181,123,15,99,179,50,183,136,57,121,242,236,140,96,226,160,207,78,31,188,221,108,190,214,146,49,119,53,17,237,
+152,125,251,14,154,106,177,32,86,43,77,252,82,181,27,222,182,109,123,219,219,124,45,225,93,182,108,217,86,43,9,218,127,155,184,103,158,57,211,37,204,9,198,199,248,248,225,224,107,151,43,197,230,147,8,
+111,47,53,99,228,145,65,165,184,248,132,177,235,106,87,241,87,11,243,113,55,183,115,231,222,21,107,243,181,132,119,97,200,185,74,18,16,195,246,218,42,246,196,137,211,171,133,215,25,173,243,129,229,
+119,130,205,215,90,108,202,38,22,17,244,20,226,226,21,198,114,117,187,136,223,37,204,199,221,12,125,227,78,178,249,90,194,219,240,174,161,74,18,16,211,252,63,14,142,31,63,53,199,216,184,11,253,96,94,
+212,116,170,205,87,19,62,130,173,104,248,20,28,177,242,197,144,216,230,90,252,99,199,78,150,24,196,113,57,114,228,68,208,216,235,116,155,175,38,188,13,93,69,70,65,125,177,36,198,121,21,127,38,169,248,
+157,108,243,113,162,251,146,128,216,197,36,65,190,198,9,196,178,138,216,150,15,222,146,169,205,39,23,254,254,251,223,125,13,38,175,196,197,149,152,231,69,252,30,161,226,187,72,94,219,170,205,167,23,
+222,134,209,209,152,4,32,230,173,127,119,32,54,53,143,85,185,108,221,58,164,54,95,167,232,54,108,128,73,69,242,197,152,216,183,84,124,105,168,92,164,177,226,194,11,29,181,249,250,133,71,116,23,198,78,
+124,177,70,131,86,137,223,231,187,32,102,236,168,205,103,39,188,13,51,142,98,146,160,249,147,74,38,39,143,45,48,217,193,101,195,134,39,213,230,235,176,249,106,176,55,49,208,152,246,197,28,45,154,45,
+254,148,239,66,24,206,84,155,207,166,182,71,162,187,208,171,138,73,130,230,204,49,60,116,232,104,183,96,92,152,29,171,54,223,56,225,35,216,188,154,54,150,79,3,180,105,120,2,76,76,28,153,21,140,11,125,
+86,181,249,198,10,31,65,92,125,26,160,77,163,197,239,245,157,152,46,159,218,124,246,162,187,194,219,208,53,140,73,130,198,45,62,25,31,63,124,153,73,28,54,76,111,138,158,251,106,243,217,215,118,31,124,
+41,133,159,163,199,229,234,129,70,141,18,191,215,115,178,96,29,157,218,124,243,132,183,161,199,229,211,4,173,50,79,128,131,7,39,75,172,191,179,161,95,170,54,223,56,155,143,19,222,134,153,85,174,46,
+104,149,169,248,99,99,135,186,153,187,230,194,251,125,181,249,230,212,118,31,124,176,138,198,183,79,27,52,203,50,1,102,220,19,184,181,95,109,190,57,194,35,186,11,139,100,61,9,144,221,43,227,3,7,38,
+202,204,219,183,161,21,170,54,223,28,155,143,19,62,130,55,134,174,62,104,150,149,248,253,158,131,7,195,146,106,243,205,177,249,106,240,85,52,174,197,167,17,218,45,59,1,246,239,31,191,196,46,25,54,44,
+216,84,155,111,77,109,183,133,183,97,178,173,171,19,218,45,75,124,233,227,175,18,42,244,245,109,152,184,168,54,223,124,225,93,209,109,24,139,113,117,10,181,91,181,156,4,24,112,15,74,183,67,109,190,
+249,54,95,13,62,112,9,188,143,241,36,193,64,221,9,176,119,239,216,44,163,77,54,188,241,83,155,111,141,205,199,9,31,193,155,66,87,47,52,92,78,2,148,221,3,210,239,84,155,111,141,205,251,68,183,97,56,
+222,147,0,245,245,6,246,236,57,208,35,24,27,250,254,106,243,173,181,249,56,238,189,247,190,0,198,4,92,221,208,178,158,4,152,112,15,196,174,29,106,243,173,181,249,56,225,35,120,68,123,18,96,34,117,2,
+72,109,47,81,227,109,88,187,166,54,255,174,150,215,118,159,240,17,60,162,93,221,208,50,117,2,136,149,44,98,39,54,236,176,169,54,223,122,155,143,227,158,123,222,25,232,225,234,134,150,105,197,239,242,
+28,228,6,235,87,155,111,141,205,251,132,143,224,231,125,218,161,105,226,4,144,190,126,47,253,125,27,246,233,83,155,207,135,205,251,132,183,97,13,129,171,31,154,166,73,128,162,123,0,26,23,106,243,247,
+231,170,182,199,193,107,122,79,2,36,95,75,184,99,199,158,105,70,149,108,104,0,170,205,231,87,248,187,239,238,185,6,13,65,87,63,52,77,156,0,197,226,238,89,182,89,183,97,252,95,109,62,63,54,239,19,62,
+130,55,181,174,126,104,154,38,1,230,220,3,176,5,187,218,124,126,108,222,39,124,4,237,52,79,2,36,223,93,100,116,116,215,2,59,87,217,240,182,73,109,62,63,54,239,99,237,218,119,4,16,47,87,63,52,77,147,0,
+75,238,1,120,251,167,54,159,31,155,247,9,31,193,117,123,18,96,41,113,2,108,223,190,243,10,203,143,108,176,21,181,249,252,216,188,79,248,8,142,239,234,135,166,137,19,96,100,100,199,85,62,191,98,83,75,
+120,181,249,214,212,246,56,92,253,208,52,77,2,84,220,3,168,205,231,91,248,187,238,186,247,58,60,9,80,73,156,0,195,195,197,10,35,127,54,106,243,111,195,239,206,206,190,98,254,240,135,63,152,197,197,55,
+204,183,191,253,29,243,201,79,126,218,28,59,118,194,108,220,216,223,20,155,143,19,62,194,213,15,77,211,36,192,85,95,2,168,205,191,197,151,190,244,101,243,230,155,111,198,242,167,63,253,201,252,232,71,
+255,219,188,252,242,95,155,115,231,46,152,193,193,225,224,222,179,180,249,56,225,129,255,247,36,64,242,71,192,208,208,232,21,62,110,96,67,27,64,109,254,190,224,126,171,137,95,141,127,254,231,159,155,
+87,95,189,100,94,120,97,198,236,220,249,214,126,10,89,212,246,136,59,239,188,39,128,99,185,250,161,105,226,4,216,182,109,251,18,47,20,108,232,5,104,107,126,121,9,224,227,215,191,254,141,249,198,55,
+254,206,124,244,163,127,97,198,199,15,5,195,184,245,10,31,193,117,187,250,161,105,154,4,88,112,15,192,56,128,182,230,223,226,203,95,254,219,76,147,192,229,63,255,243,63,205,119,191,251,61,243,153,207,
+124,214,156,56,113,210,60,253,244,230,224,209,81,75,248,8,98,228,73,128,228,3,65,131,131,35,115,76,255,178,97,36,80,91,243,111,53,236,184,150,47,124,161,20,60,235,27,153,8,46,63,253,233,79,205,223,
+252,205,23,204,212,212,115,65,187,34,46,1,168,164,174,126,104,154,38,1,102,221,3,240,46,64,7,109,110,132,169,216,71,143,158,48,159,248,196,167,204,183,190,245,237,160,87,208,172,132,120,245,213,47,95,
+19,253,142,59,238,190,6,19,119,60,9,144,252,101,208,192,192,240,52,203,191,108,120,54,233,160,77,178,46,220,35,143,252,47,179,111,223,152,249,224,7,47,154,175,126,245,178,249,197,47,22,26,150,4,167,
+78,157,185,78,124,224,75,44,174,126,104,154,56,1,182,110,29,42,178,239,143,13,43,80,117,208,166,254,110,92,111,239,255,52,35,35,69,243,236,179,207,155,87,94,249,130,216,249,207,50,73,128,217,217,191,
+185,33,1,168,172,174,126,104,154,38,1,122,221,3,176,21,140,142,205,103,59,104,195,121,105,224,157,56,113,202,188,248,226,103,131,134,31,13,192,52,9,240,129,15,124,232,154,240,107,214,172,13,224,177,
+228,73,128,228,83,194,182,108,217,214,197,103,205,92,92,235,215,177,249,229,15,218,248,90,243,235,215,111,48,7,15,78,152,143,124,228,99,65,23,241,215,191,254,181,87,252,215,95,255,151,160,193,23,9,15,
+252,190,79,59,52,77,53,51,88,126,97,209,61,8,93,65,181,249,108,7,109,170,225,54,236,138,197,93,102,122,250,207,165,39,240,74,80,243,239,191,191,247,58,241,129,248,122,196,95,76,189,46,96,243,230,193,
+18,19,65,109,232,9,168,205,55,86,120,247,121,238,226,10,238,66,37,117,117,67,203,212,9,176,105,211,192,4,155,14,216,60,246,216,251,212,230,115,42,252,237,183,223,21,192,199,40,93,221,208,178,158,4,
+232,113,15,212,223,191,85,109,190,129,54,191,28,225,35,216,187,201,147,0,245,125,89,68,4,47,35,186,13,207,34,181,249,214,214,118,159,240,64,252,93,189,208,176,238,253,1,228,151,103,221,3,178,62,80,
+109,190,181,54,31,7,195,245,158,4,168,127,131,8,177,147,1,44,197,134,62,166,218,124,107,109,222,229,182,219,238,12,224,243,124,174,94,104,184,156,4,88,37,84,220,131,242,106,88,109,190,53,54,239,19,30,
+136,187,71,124,180,171,127,147,40,202,83,79,109,190,196,40,160,13,31,53,84,155,111,77,109,119,133,143,96,53,144,171,19,218,45,123,159,192,141,27,55,245,179,216,208,133,158,128,218,124,243,109,222,7,
+199,247,105,132,118,153,236,22,42,7,42,187,7,167,193,161,54,223,92,155,247,113,235,173,119,4,211,245,60,226,103,179,85,44,69,26,126,51,52,254,108,24,20,82,155,111,174,205,187,194,71,240,221,0,87,31,
+52,203,50,1,186,61,39,8,198,4,212,230,155,99,243,174,232,17,209,151,196,60,100,251,1,169,39,159,124,186,196,30,1,54,44,25,87,155,95,219,18,225,35,24,250,117,117,65,171,204,191,24,34,125,204,94,250,
+153,46,184,128,218,124,227,109,62,174,246,251,52,65,171,134,124,55,72,14,124,217,61,25,207,31,181,249,230,212,246,136,238,238,53,193,159,204,252,241,136,223,152,143,70,81,30,127,124,99,47,83,195,92,
+248,112,132,218,124,99,133,71,116,27,90,254,62,45,208,168,161,223,14,148,19,204,250,78,204,184,128,218,124,227,133,7,238,45,70,252,198,126,56,146,34,221,191,110,186,128,46,235,214,173,87,155,207,216,
+230,227,96,12,198,167,1,218,52,229,251,193,242,220,159,226,217,239,194,59,2,181,249,108,107,187,205,45,183,220,30,52,252,124,177,71,147,166,126,65,92,78,184,224,187,16,30,5,106,243,217,11,15,220,111,
+140,248,205,253,124,60,229,209,71,159,232,99,28,192,133,121,131,106,243,203,183,121,91,248,8,22,124,248,98,142,22,133,86,20,57,241,69,223,5,209,43,80,155,207,70,244,8,246,102,140,17,255,98,161,149,69,
+250,162,243,244,71,93,232,166,168,205,47,95,120,224,177,234,139,49,177,47,180,186,172,95,255,88,143,80,97,72,210,133,133,36,106,243,245,11,15,12,176,249,98,27,198,188,167,144,135,34,23,82,140,185,200,
+32,123,213,230,211,137,14,55,223,124,91,224,160,113,113,37,230,133,60,149,190,190,13,51,204,20,114,97,18,41,19,71,212,230,215,36,18,61,130,152,16,59,95,76,137,117,33,143,69,46,172,228,187,96,122,6,
+190,36,80,155,191,81,248,72,124,98,22,35,126,169,144,231,34,89,59,71,230,186,216,73,160,54,239,23,30,120,76,18,43,95,12,137,109,33,239,69,46,190,75,152,231,38,124,208,38,80,155,247,195,224,89,92,220,
+194,152,118,21,218,161,200,133,174,22,94,143,187,25,122,7,157,110,243,46,184,99,21,241,137,229,234,66,59,149,117,235,214,175,22,230,121,73,228,131,113,130,78,181,121,155,155,110,186,53,168,16,113,113,
+10,99,216,94,226,91,73,208,37,204,197,221,28,35,134,216,94,39,217,124,36,58,112,63,204,168,170,34,62,177,235,42,180,123,121,248,225,190,18,227,216,113,208,46,232,4,155,143,132,7,6,120,170,197,132,152,
+21,86,82,145,27,154,169,118,195,188,74,102,224,99,165,218,124,4,215,204,227,175,134,248,51,133,149,88,30,122,232,145,162,80,97,25,83,28,188,239,110,7,225,211,136,14,81,67,175,218,189,135,177,41,22,86,
+114,121,240,193,247,246,8,243,204,106,137,131,182,1,235,13,218,221,230,35,104,231,176,117,75,181,123,14,99,210,83,232,148,34,55,123,177,70,64,174,77,57,111,55,155,143,136,190,224,85,235,62,137,69,161,
+19,203,3,15,172,235,19,22,216,54,189,26,36,2,246,201,163,33,207,54,15,252,30,115,35,17,190,214,125,133,247,222,87,232,244,34,65,152,74,16,172,0,218,8,12,151,230,77,120,186,176,244,102,146,222,7,247,
+92,208,242,118,145,231,126,183,48,203,243,63,9,212,48,118,41,137,146,161,21,54,143,232,56,19,215,146,244,186,195,123,236,86,197,99,138,52,150,122,133,203,52,154,146,194,35,130,209,52,218,11,12,45,219,
+9,145,149,232,252,157,71,16,13,58,92,136,115,166,185,198,240,158,122,85,225,116,137,80,74,25,228,107,208,215,198,146,233,77,208,24,35,49,162,54,68,148,24,145,200,252,61,90,110,69,111,131,154,141,179,
+144,80,28,131,239,37,213,123,29,225,61,168,240,245,22,169,105,221,194,140,80,166,214,181,9,229,240,154,213,234,51,78,134,126,225,146,80,201,161,232,149,240,218,250,85,169,6,23,105,116,173,18,6,132,89,
+161,76,35,172,69,148,195,107,224,90,86,169,50,45,42,189,189,239,233,17,38,132,146,176,200,28,250,6,177,24,158,131,115,245,104,228,243,155,16,93,66,175,80,20,166,133,89,97,78,88,16,150,132,43,194,85,
+161,18,114,53,252,183,165,240,103,230,194,223,153,14,143,193,177,186,52,178,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,146,155,50,53,53,221,37,244,10,69,97,90,152,
+21,230,132,5,97,73,184,34,92,21,42,33,87,195,127,91,10,127,102,46,252,157,233,240,24,28,75,135,130,115,44,120,143,48,33,148,132,69,193,52,136,197,240,28,156,75,95,6,181,170,92,184,240,252,42,97,64,
+152,21,202,130,105,17,229,240,26,184,22,125,29,220,232,114,254,252,115,253,194,37,161,34,152,156,81,9,175,77,39,132,100,44,122,183,48,35,148,115,40,122,28,229,240,154,117,74,88,189,229,220,185,103,
+123,133,146,96,234,225,216,177,147,230,192,129,9,83,44,238,54,131,131,35,193,119,244,216,81,155,253,245,216,110,133,69,152,209,154,60,254,206,70,12,236,190,197,207,240,201,181,129,129,97,51,58,186,
+203,236,223,63,110,142,30,125,198,212,123,29,225,61,232,164,208,148,194,95,78,19,228,51,103,46,152,131,7,39,205,200,200,142,224,139,89,136,25,173,180,173,177,24,179,230,178,173,104,33,7,199,226,115,
+44,67,67,163,102,108,236,80,112,206,148,137,112,89,19,161,74,57,123,118,170,91,152,21,76,18,78,156,56,109,118,237,218,23,212,108,119,121,245,114,69,183,133,175,6,31,103,218,177,99,143,57,126,252,148,
+73,122,221,225,61,234,163,193,46,82,155,166,168,81,73,216,187,119,204,43,122,150,181,61,142,106,43,126,72,134,221,187,247,155,164,247,193,61,171,240,103,46,244,9,11,181,130,197,243,124,120,184,24,236,
+147,151,55,225,193,94,8,194,245,208,230,160,221,144,32,9,184,247,206,92,28,122,250,244,249,139,130,169,198,225,195,199,131,198,88,35,68,207,90,120,31,155,54,13,152,201,201,99,166,214,125,18,139,78,18,
+190,71,152,175,22,16,106,60,181,40,143,181,61,137,240,238,162,145,205,155,7,3,71,168,145,4,196,100,101,143,46,158,58,117,174,40,84,4,19,199,246,237,59,131,29,178,242,108,243,73,133,183,225,255,233,65,
+84,187,247,48,54,43,115,139,152,147,39,207,206,8,38,14,250,236,244,193,219,205,230,107,45,25,115,87,19,209,142,217,183,239,160,169,22,11,98,181,210,196,47,85,187,225,109,219,182,183,189,205,215,18,
+222,101,203,150,109,181,146,160,253,183,137,123,230,153,51,93,194,156,96,124,140,143,31,14,190,118,185,82,108,62,137,240,246,82,51,70,30,25,84,138,139,79,24,187,174,118,21,127,181,48,31,119,115,59,
+119,238,93,177,54,95,75,120,23,134,156,171,36,1,49,108,175,173,98,79,156,56,189,90,120,157,209,58,31,88,126,39,216,124,173,197,166,108,98,17,65,79,33,46,94,97,44,87,183,139,248,93,194,124,220,205,208,
+55,238,36,155,175,37,188,13,239,26,170,36,1,49,205,255,227,224,248,241,83,115,140,141,187,208,15,230,69,77,167,218,124,53,225,35,216,138,134,79,193,17,43,95,12,137,109,174,197,63,118,236,100,137,65,
+28,151,35,71,78,4,141,189,78,183,249,106,194,219,208,85,100,20,212,23,75,98,156,87,241,103,146,138,223,201,54,31,39,186,47,9,136,93,76,18,228,107,156,64,44,171,136,109,249,224,45,153,218,124,114,225,
+239,191,255,221,215,96,242,74,92,92,137,121,94,196,239,17,42,190,139,228,181,173,218,124,122,225,109,24,29,141,73,0,98,222,250,119,7,98,83,243,88,149,203,214,173,67,106,243,117,138,110,195,6,152,84,
+36,95,140,137,125,75,197,151,134,202,69,26,43,46,188,208,81,155,175,95,120,68,119,97,236,196,23,107,52,104,149,248,125,190,11,98,198,142,218,124,118,194,219,48,227,40,38,9,154,63,169,100,114,242,216,
+2,147,29,92,54,108,120,82,109,190,14,155,175,6,123,19,3,141,105,95,204,209,162,217,226,79,249,46,132,225,76,181,249,108,106,123,36,186,11,189,170,152,36,104,206,28,195,67,135,142,118,11,198,133,217,
+177,106,243,141,19,62,130,205,171,105,99,249,52,64,155,134,39,192,196,196,145,89,193,184,208,103,85,155,111,172,240,17,196,213,167,1,218,52,90,252,94,223,137,233,242,169,205,103,47,186,43,188,13,93,
+195,152,36,104,220,226,147,241,241,195,151,153,196,97,195,244,166,232,185,175,54,159,125,109,247,193,151,82,248,57,122,92,174,30,104,212,40,241,123,61,39,11,214,209,169,205,55,79,120,27,122,92,62,77,
+208,42,243,4,56,120,112,178,196,250,59,27,250,165,106,243,141,179,249,56,225,109,152,89,229,234,130,86,153,138,63,54,118,168,155,185,107,46,188,223,87,155,111,78,109,247,193,7,171,104,124,251,180,65,
+179,44,19,96,198,61,129,91,251,213,230,155,35,60,162,187,176,72,214,147,0,217,189,50,62,112,96,162,204,188,125,27,90,161,106,243,205,177,249,56,225,35,120,99,232,234,131,102,89,137,223,239,57,120,48,
+44,169,54,223,28,155,175,6,95,69,227,90,124,26,161,221,178,19,96,255,254,241,75,236,146,97,195,130,77,181,249,214,212,118,91,120,27,38,219,186,58,161,221,178,196,151,62,254,42,161,66,95,223,134,137,
+139,106,243,205,23,222,21,221,134,177,24,87,167,80,187,85,203,73,128,1,247,160,116,59,212,230,155,111,243,213,224,3,151,192,251,24,79,18,12,212,157,0,123,247,142,205,50,218,100,195,27,63,181,249,214,
+216,124,156,240,17,188,41,116,245,66,195,229,36,64,217,61,32,253,78,181,249,214,216,188,79,116,27,134,227,61,9,80,95,111,96,207,158,3,61,130,177,161,239,175,54,223,90,155,143,227,222,123,239,11,96,76,
+192,213,13,45,235,73,128,9,247,64,236,218,161,54,223,90,155,143,19,62,130,71,180,39,1,38,82,39,128,212,246,18,53,222,134,181,107,106,243,239,106,121,109,247,9,31,193,35,218,213,13,45,83,39,128,88,201,
+34,118,98,195,14,155,106,243,173,183,249,56,238,185,231,157,129,30,174,110,104,153,86,252,46,207,65,110,176,126,181,249,214,216,188,79,248,8,126,222,167,29,154,38,78,0,233,235,247,210,223,183,97,159,
+62,181,249,124,216,188,79,120,27,214,16,184,250,161,105,154,4,40,186,7,160,113,161,54,127,127,174,106,123,28,188,166,247,36,64,242,181,132,59,118,236,153,102,84,201,134,6,160,218,124,126,133,191,251,
+238,158,107,208,16,116,245,67,211,196,9,80,44,238,158,101,155,117,27,198,255,213,230,243,99,243,62,225,35,120,83,235,234,135,166,105,18,96,206,61,0,91,176,171,205,231,199,230,125,194,71,208,78,243,36,
+64,242,221,69,70,71,119,45,176,115,149,13,111,155,212,230,243,99,243,62,214,174,125,71,0,241,114,245,67,211,52,9,176,228,30,128,183,127,106,243,249,177,121,159,240,17,92,183,39,1,150,18,39,192,246,
+237,59,175,176,252,200,6,91,81,155,207,143,205,251,132,143,224,248,174,126,104,154,56,1,70,70,118,92,229,243,43,54,181,132,87,155,111,77,109,143,195,213,15,77,211,36,64,197,61,128,218,124,190,133,191,
+235,174,123,175,195,147,0,149,196,9,48,60,92,172,48,242,103,163,54,159,47,155,143,19,62,194,213,15,77,211,36,192,85,95,2,168,205,191,5,143,195,23,95,252,156,249,241,143,127,98,190,250,213,203,230,252,
+249,169,96,106,118,51,109,62,78,120,224,255,61,9,144,252,17,48,52,52,122,133,143,27,216,112,211,106,243,111,9,252,189,239,125,223,188,249,230,155,55,240,139,95,252,194,188,252,242,172,153,156,60,106,
+30,120,224,225,166,213,246,136,59,239,188,39,128,99,185,250,161,105,226,4,216,182,109,251,18,47,20,108,232,5,168,205,223,103,118,238,220,227,21,223,199,63,254,227,143,205,199,63,254,9,179,99,199,238,
+224,92,141,22,62,130,235,118,245,67,211,52,9,176,224,30,128,113,0,109,205,223,103,38,38,14,39,78,0,155,255,254,239,255,54,223,252,230,183,204,11,47,204,152,77,155,182,46,219,230,125,194,71,16,35,79,2,
+36,31,8,26,28,28,153,99,250,151,13,35,129,218,154,191,47,176,118,196,172,39,9,108,126,251,219,223,154,87,95,189,100,78,158,60,19,108,11,187,92,209,109,168,164,174,126,104,154,38,1,102,221,3,240,46,64,
+91,243,111,49,57,121,196,44,46,46,46,59,9,108,126,254,243,159,155,207,125,238,37,51,54,54,30,52,184,211,10,127,199,29,119,95,131,137,59,158,4,72,254,50,104,96,96,120,154,229,95,54,188,98,212,65,155,
+235,25,29,221,105,62,250,209,191,48,63,252,225,143,50,77,6,248,193,15,126,104,62,242,145,143,74,235,125,52,177,240,17,124,137,197,213,15,77,19,39,192,214,173,67,69,246,253,177,161,155,163,131,54,241,
+173,121,26,201,227,227,135,204,75,47,253,149,121,253,245,127,201,52,25,254,248,199,63,154,215,94,251,134,121,246,217,231,131,121,25,113,194,71,80,89,93,253,208,52,77,2,244,186,7,96,43,24,29,180,73,
+222,141,227,131,80,167,78,157,53,95,254,242,165,204,31,23,191,254,245,111,204,204,204,7,110,16,126,205,154,181,1,172,16,242,36,64,242,41,97,91,182,108,235,226,179,102,46,174,245,235,216,124,242,65,27,
+90,254,244,0,232,9,148,203,229,76,18,97,106,234,185,235,132,7,220,193,167,29,154,166,154,25,44,191,176,232,30,132,174,160,142,205,47,191,239,206,245,21,139,187,204,199,63,254,151,193,88,65,189,9,192,
+239,218,226,3,241,245,136,191,152,122,93,192,230,205,131,37,38,130,218,208,19,80,155,207,190,239,78,171,157,241,133,151,95,254,107,243,139,95,44,36,78,128,159,252,228,39,55,36,0,149,212,213,13,45,83,
+39,192,166,77,3,19,108,58,96,243,216,99,239,83,155,207,120,208,198,215,154,167,17,119,230,204,57,243,149,175,124,213,252,199,127,252,62,54,1,158,127,254,133,107,194,223,126,251,93,1,180,61,92,221,208,
+178,158,4,232,113,15,212,223,191,85,109,62,67,209,107,181,230,163,231,251,230,205,3,65,163,239,59,223,249,135,160,253,240,187,223,253,135,249,240,135,63,122,157,240,17,236,221,228,73,128,250,190,44,
+34,130,151,17,221,6,187,82,155,207,174,182,199,137,94,11,87,120,32,254,174,94,104,88,247,254,0,242,203,179,238,1,89,31,168,54,223,26,225,125,162,219,48,92,239,73,128,250,55,136,16,59,25,192,82,108,
+232,99,170,205,103,111,243,203,17,254,182,219,238,12,224,243,124,174,94,104,184,156,4,88,37,84,220,131,50,234,165,54,223,26,155,247,9,15,196,221,35,62,218,213,191,73,20,229,169,167,54,95,98,20,208,
+134,183,87,106,243,173,169,237,174,240,17,172,6,114,117,66,187,101,239,19,184,113,227,166,126,22,27,186,208,19,80,155,111,190,205,251,224,248,62,141,208,46,147,221,66,229,64,101,247,224,52,56,212,230,
+155,107,243,62,110,189,245,142,96,186,158,71,252,108,182,138,165,72,195,111,134,198,159,13,131,66,106,243,205,181,121,87,248,8,190,27,224,234,131,102,89,38,64,183,231,4,193,152,128,218,124,115,108,
+222,21,61,34,250,146,152,135,108,63,32,245,228,147,79,151,120,23,109,195,146,113,181,249,181,45,17,62,130,161,95,87,23,180,202,252,139,33,210,199,236,165,159,233,130,11,168,205,55,222,230,227,106,191,
+79,19,180,106,200,119,131,228,192,151,221,147,241,252,81,155,111,78,109,143,232,238,94,19,252,201,75,35,143,248,141,249,104,20,229,241,199,55,246,50,53,204,133,15,71,168,205,55,86,120,68,183,161,229,
+239,211,2,141,26,250,237,64,57,193,172,239,196,140,11,168,205,55,94,120,224,222,98,196,111,236,135,35,41,210,253,235,166,11,232,178,110,221,122,181,249,140,109,62,14,198,96,124,26,160,77,83,190,31,44,
+207,253,41,158,253,46,188,35,80,155,207,182,182,219,220,114,203,237,65,195,207,23,123,52,105,234,23,196,229,132,11,190,11,225,81,160,54,159,189,240,192,253,198,136,223,220,207,199,83,30,125,244,137,
+62,198,1,92,152,55,168,54,191,124,155,183,133,143,96,193,135,47,230,104,81,104,69,145,19,95,244,93,16,189,2,181,249,108,68,143,96,111,198,24,241,47,22,90,89,164,47,58,79,127,212,133,110,138,218,252,
+242,133,7,30,171,190,24,19,251,66,171,203,250,245,143,245,8,21,134,36,93,88,72,162,54,95,191,240,192,0,155,47,182,97,204,123,10,121,40,114,33,197,152,139,12,178,87,109,62,157,232,112,243,205,183,5,14,
+26,23,87,98,94,200,83,233,235,219,48,195,76,33,23,38,145,50,113,68,109,126,77,34,209,35,136,9,177,243,197,148,88,23,242,88,228,194,74,190,11,166,103,224,75,2,181,249,27,133,143,196,39,102,49,226,151,
+10,121,46,146,181,115,100,174,139,157,4,106,243,126,225,129,199,36,177,242,197,144,216,22,242,94,228,226,187,132,121,110,194,7,109,2,181,121,63,12,158,197,197,45,140,105,87,161,29,138,92,232,106,225,
+245,184,155,161,119,208,233,54,239,130,59,86,17,159,88,174,46,180,83,89,183,110,253,106,97,158,151,68,62,24,39,232,84,155,183,185,233,166,91,131,10,17,23,167,48,134,237,37,190,149,4,93,194,92,220,205,
+49,98,136,237,117,146,205,71,162,3,247,195,140,170,42,226,19,187,174,66,187,151,135,31,238,43,49,142,29,7,237,130,78,176,249,72,120,96,128,167,90,76,136,89,97,37,21,185,161,153,106,55,204,171,100,6,
+62,86,170,205,71,112,205,60,254,106,136,63,83,88,137,229,161,135,30,41,10,21,150,49,197,193,251,238,118,16,62,141,232,16,53,244,170,221,123,24,155,98,97,37,151,7,31,124,111,143,48,207,172,150,56,104,
+27,176,222,160,221,109,62,130,118,14,91,183,84,187,231,48,38,61,133,78,41,114,179,23,107,4,228,218,148,243,118,179,249,136,104,255,192,90,247,73,44,10,157,88,30,120,96,93,159,176,32,152,106,144,8,216,
+39,143,134,60,219,60,240,123,204,141,68,248,90,247,21,222,123,95,161,211,139,4,97,42,65,176,2,104,35,48,92,154,55,225,233,194,210,155,73,122,31,220,115,65,203,219,69,158,251,221,194,44,207,255,36,80,
+195,216,165,36,74,134,86,216,60,162,227,76,92,75,210,235,14,239,177,91,21,143,41,210,88,234,21,46,211,104,74,10,143,8,70,211,104,47,48,180,108,39,68,86,162,243,119,30,65,52,232,112,33,206,153,230,26,
+195,123,234,85,133,211,37,66,41,101,144,175,65,95,27,75,142,190,212,65,98,68,109,136,40,49,34,145,249,123,180,220,138,222,6,53,27,103,33,161,56,6,219,183,215,123,29,225,61,168,240,245,22,169,105,221,
+194,140,80,166,214,181,9,229,240,154,213,234,51,78,134,126,225,146,80,201,161,232,149,240,218,250,85,169,6,23,105,116,173,18,6,132,89,161,76,35,172,69,148,195,107,224,90,86,169,50,45,42,189,189,239,
+233,17,38,132,146,176,200,28,250,6,177,24,158,131,115,245,104,228,243,155,16,93,66,175,80,20,166,133,89,97,78,88,16,150,132,43,194,85,161,18,114,53,252,183,165,240,103,230,194,223,153,14,143,193,177,
+186,52,178,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,146,155,50,53,53,221,37,244,10,69,97,90,152,21,230,132,5,97,73,184,34,92,21,42,33,87,195,127,91,10,127,102,46,
+252,157,233,240,24,28,75,135,130,115,44,120,143,48,33,148,132,69,193,52,136,197,240,28,156,75,95,6,181,170,92,184,240,252,42,97,64,152,21,202,130,105,17,229,240,26,184,22,125,29,220,232,114,254,252,
+115,253,194,37,161,34,152,156,81,9,175,77,39,132,100,44,122,183,48,35,148,115,40,122,28,229,240,154,117,74,88,189,229,220,185,103,123,133,146,96,234,225,216,177,147,230,192,129,9,83,44,238,54,131,131,
+35,193,119,244,216,81,155,253,245,216,110,133,69,152,209,154,60,254,206,70,12,236,190,197,207,240,201,181,129,129,97,51,58,186,203,236,223,63,110,142,30,125,198,212,123,29,225,61,232,164,208,148,194,
+95,78,19,228,51,103,46,152,131,7,39,205,200,200,142,224,139,89,136,25,173,180,173,177,24,179,230,178,173,104,33,7,199,226,115,44,67,67,163,102,108,236,80,112,206,148,137,112,89,19,161,74,57,123,118,
+170,91,152,21,76,18,78,156,56,109,118,237,218,23,212,108,119,121,245,114,69,183,133,175,6,31,103,218,177,99,143,57,126,252,148,73,122,221,225,61,234,163,193,46,82,155,166,168,81,73,216,187,119,204,43,
+122,150,181,61,142,106,43,126,72,134,221,187,247,155,164,247,193,61,171,240,103,46,244,9,11,181,130,197,243,124,120,184,24,236,147,151,55,225,193,94,8,194,245,208,230,160,221,144,32,9,184,247,206,92,
+28,122,250,244,249,139,130,169,198,225,195,199,131,198,88,35,68,207,90,120,31,155,54,13,152,201,201,99,166,214,125,18,139,78,18,190,71,152,175,22,16,106,60,181,40,143,181,61,137,240,238,162,145,205,
+155,7,3,71,168,145,4,196,100,101,143,46,158,58,117,174,40,84,4,19,199,246,237,59,131,29,178,242,108,243,73,133,183,225,255,233,65,84,187,247,48,54,43,115,139,152,147,39,207,206,8,38,14,250,236,244,
+193,219,205,230,107,45,25,115,87,19,209,142,217,183,239,160,169,22,11,98,181,210,196,47,85,187,225,109,219,182,183,189,205,215,18,222,101,203,150,109,181,146,160,253,183,137,123,230,153,51,93,194,156,
+96,124,140,143,31,14,190,118,185,82,108,62,137,240,246,82,51,70,30,25,84,138,139,79,24,187,174,118,21,127,181,48,31,119,115,59,119,238,93,177,54,95,75,120,23,134,156,171,36,1,49,108,175,173,98,79,156,
+56,189,90,120,157,209,58,31,88,126,39,216,124,173,197,166,108,98,17,65,79,33,46,94,97,44,87,183,139,248,93,194,124,220,205,208,55,238,36,155,175,37,188,13,239,26,170,36,1,49,205,255,227,224,248,241,
+83,115,140,141,187,208,15,230,69,77,167,218,124,53,225,35,216,138,134,79,193,17,43,95,12,137,109,174,197,63,118,236,100,137,65,28,151,35,71,78,4,141,189,78,183,249,106,194,219,208,85,100,20,212,23,75,
+98,156,87,241,103,146,138,223,201,54,31,39,186,47,9,136,93,76,18,228,107,156,64,44,171,136,109,249,224,45,153,218,124,114,225,239,191,255,221,215,96,242,74,92,92,137,121,94,196,239,17,42,190,139,228,
+181,173,218,124,122,225,109,24,29,141,73,0,98,222,250,119,7,98,83,243,88,149,203,214,173,67,106,243,117,138,110,195,6,152,84,36,95,140,137,125,75,197,151,134,202,69,26,43,46,188,208,81,155,175,95,120,
+68,119,97,236,196,23,107,52,104,149,248,125,190,11,98,198,142,218,124,118,194,219,48,227,40,38,9,154,63,169,100,114,242,216,2,147,29,92,54,108,120,82,109,190,14,155,175,6,123,19,3,141,105,95,204,209,
+162,217,226,79,249,46,132,225,76,181,249,108,106,123,36,186,11,189,170,152,36,104,206,28,195,67,135,142,118,11,198,133,217,177,106,243,141,19,62,130,205,171,105,99,249,52,64,155,134,39,192,196,196,
+145,89,193,184,208,103,85,155,111,172,240,17,196,213,167,1,218,52,90,252,94,223,137,233,242,169,205,103,47,186,43,188,13,93,195,152,36,104,220,226,147,241,241,195,151,153,196,97,195,244,166,232,185,
+175,54,159,125,109,247,193,151,82,248,57,122,92,174,30,104,212,40,241,123,61,39,11,214,209,169,205,55,79,120,27,122,92,62,77,208,42,243,4,56,120,112,178,196,250,59,27,250,165,106,243,141,179,249,56,
+225,109,152,89,229,234,130,86,153,138,63,54,118,168,155,185,107,46,188,223,87,155,111,78,109,247,193,7,171,104,124,251,180,65,179,44,19,96,198,61,129,91,251,213,230,155,35,60,162,187,176,72,214,147,0,
+217,189,50,62,112,96,162,204,188,125,27,90,161,106,243,205,177,249,56,225,35,120,99,232,234,131,102,89,137,223,239,57,120,48,44,169,54,223,28,155,175,6,95,69,227,90,124,26,161,221,178,19,96,255,254,
+241,75,236,146,97,195,130,77,181,249,214,212,118,91,120,27,38,219,186,58,161,221,178,196,151,62,254,42,161,66,95,223,134,137,139,106,243,205,23,222,21,221,134,177,24,87,167,80,187,85,203,73,128,1,247,
+160,116,59,212,230,155,111,243,213,224,3,151,192,251,24,79,18,12,212,157,0,123,247,142,205,50,218,100,195,27,63,181,249,214,216,124,156,240,17,188,41,116,245,66,195,229,36,64,217,61,32,253,78,181,249,
+214,216,188,79,116,27,134,227,61,9,80,95,111,96,207,158,3,61,130,177,161,239,175,54,223,90,155,143,227,222,123,239,11,96,76,192,213,13,45,235,73,128,9,247,64,236,218,161,54,223,90,155,143,19,62,130,
+71,180,39,1,38,82,39,128,212,246,18,53,222,134,181,107,106,243,239,106,121,109,247,9,31,193,35,218,213,13,45,83,39,128,88,201,34,118,98,195,14,155,106,243,173,183,249,56,238,185,231,157,129,30,174,
+110,104,153,86,252,46,207,65,110,176,126,181,249,214,216,188,79,248,8,126,222,167,29,154,38,78,0,233,235,247,210,223,183,97,159,62,181,249,124,216,188,79,120,27,214,16,184,250,161,105,154,4,40,186,7,
+160,113,161,54,127,127,174,106,123,28,188,166,247,36,64,242,181,132,59,118,236,153,102,84,201,134,6,160,218,124,126,133,191,251,238,158,107,208,16,116,245,67,211,196,9,80,44,238,158,101,155,117,27,
+198,255,213,230,243,99,243,62,225,35,120,83,235,234,135,166,105,18,96,206,61,0,91,176,171,205,231,199,230,125,194,71,208,78,243,36,64,242,221,69,70,71,119,45,176,115,149,13,111,155,212,230,243,99,243,
+62,214,174,125,71,0,241,114,245,67,211,52,9,176,228,30,128,183,127,106,243,249,177,121,159,240,17,92,183,39,1,150,18,39,192,246,237,59,175,176,252,200,6,91,81,155,207,143,205,251,132,143,224,248,174,
+126,104,154,56,1,70,70,118,92,229,243,43,54,181,132,87,155,111,77,109,143,195,213,15,77,211,36,64,197,61,128,218,124,190,133,191,235,174,123,175,195,147,0,149,196,9,48,60,92,172,48,242,103,163,54,159,
+47,155,143,19,62,194,213,15,77,211,36,192,85,95,2,168,205,231,199,230,227,132,7,254,223,147,0,201,31,1,67,67,163,87,248,184,129,13,109,0,181,249,183,4,102,151,239,191,252,203,79,154,82,233,75,230,236,
+217,243,65,15,169,21,54,239,114,231,157,247,4,112,44,87,63,52,77,156,0,219,182,109,95,226,133,130,13,189,0,181,249,251,204,99,143,61,105,222,120,227,13,243,230,155,111,94,199,215,190,246,117,115,228,
+200,241,224,186,91,37,124,4,215,237,234,135,166,105,18,96,193,61,0,89,174,54,127,159,249,220,231,94,186,65,124,155,63,253,233,79,226,12,175,154,253,251,15,54,212,230,125,194,71,16,35,79,2,36,31,8,26,
+28,28,153,99,250,151,13,35,129,218,154,191,207,188,246,218,223,85,77,0,155,55,222,248,157,249,252,231,95,54,163,163,59,27,86,219,125,80,73,93,253,208,52,77,2,204,186,7,224,93,128,182,230,223,105,222,
+255,254,15,38,78,0,155,95,254,242,87,230,19,159,248,148,217,178,101,176,33,194,223,113,199,221,215,96,226,142,39,1,146,191,12,26,24,24,158,102,249,151,13,175,24,181,53,255,22,175,189,246,141,186,146,
+32,226,159,254,233,255,152,15,125,232,195,230,137,39,54,102,42,124,4,95,98,113,245,67,211,196,9,176,117,235,80,145,125,127,108,88,129,170,131,54,111,55,234,70,71,119,136,189,255,149,183,65,152,134,31,
+254,240,71,230,249,231,255,204,172,91,215,151,202,230,125,194,71,80,89,93,253,208,52,77,2,244,186,7,96,43,24,29,180,241,55,232,246,237,27,51,95,252,226,151,130,6,224,114,146,225,91,223,250,182,57,117,
+234,76,208,229,78,43,58,172,89,179,54,128,21,66,158,4,72,62,37,108,203,150,109,93,124,214,204,197,181,126,29,180,185,190,81,199,245,28,62,124,212,92,190,252,181,101,37,2,112,140,201,201,163,193,61,36,
+21,30,72,20,159,118,104,154,106,102,176,252,194,162,123,16,186,130,58,54,159,172,53,79,45,166,54,83,171,151,147,8,184,202,23,191,88,50,123,247,238,175,42,124,4,241,245,136,191,152,122,93,192,230,205,
+131,37,38,130,218,208,19,208,177,249,244,221,184,135,31,126,196,60,247,220,180,249,193,15,126,184,172,100,160,91,249,210,75,159,55,27,55,246,123,197,7,42,169,171,27,90,166,78,128,77,155,6,38,216,116,
+192,230,177,199,222,167,99,243,203,236,191,111,216,240,132,249,192,7,62,100,230,231,255,105,89,201,176,109,219,200,117,194,223,126,251,93,1,12,83,187,186,161,101,61,9,208,227,30,168,191,127,171,218,
+124,134,125,247,254,254,45,230,227,31,255,75,179,176,240,203,212,9,240,245,175,191,118,157,240,17,236,221,228,73,128,250,190,44,34,130,151,17,221,134,65,6,181,249,236,251,238,67,67,219,131,97,230,197,
+197,197,68,9,240,179,159,205,223,32,62,241,119,245,66,195,186,247,7,144,95,158,117,15,200,250,64,181,249,236,132,247,53,234,118,239,222,107,94,121,229,139,230,143,127,252,99,108,2,188,248,226,231,110,
+72,0,134,235,61,9,80,255,6,17,98,39,3,88,138,13,125,76,181,249,123,51,27,180,137,107,205,3,215,55,49,49,105,190,242,149,175,94,39,254,119,191,251,61,121,12,223,127,77,248,219,110,187,51,128,207,243,
+185,122,161,225,114,18,96,149,80,113,15,202,171,97,181,249,198,136,238,107,216,1,221,239,61,123,246,5,143,10,87,120,32,238,30,241,209,174,254,77,162,40,79,61,181,249,18,163,128,54,124,212,80,109,190,
+49,194,187,182,238,195,22,62,130,213,64,174,78,104,183,236,125,2,55,110,220,212,207,98,67,23,122,2,106,243,205,19,222,39,122,4,199,247,105,132,118,153,236,22,42,7,42,187,7,167,193,161,54,159,173,205,
+167,21,30,110,189,245,142,96,212,209,35,126,54,91,197,82,164,225,55,67,227,207,134,65,33,181,249,230,218,188,43,124,4,223,13,112,245,65,179,44,19,160,219,115,130,96,76,64,109,190,57,54,239,138,30,17,
+125,73,204,67,182,31,144,122,242,201,167,75,236,17,96,195,146,113,181,249,181,45,17,62,130,161,95,87,23,180,202,252,139,33,210,199,236,165,159,233,130,11,168,205,55,222,230,227,106,191,79,19,180,106,
+200,119,131,228,192,151,221,147,241,252,81,155,111,78,109,143,232,238,94,19,252,201,204,31,143,248,141,249,104,20,229,241,199,55,246,50,53,204,133,15,71,168,205,55,86,120,68,183,161,229,239,211,2,141,
+26,250,237,64,57,193,172,239,196,140,11,168,205,55,94,120,224,222,98,196,111,236,135,35,41,210,253,235,166,11,232,178,110,221,122,181,249,140,109,62,14,198,96,124,26,160,77,83,190,31,44,207,253,41,
+158,253,46,188,35,80,155,207,182,182,219,220,114,203,237,65,195,207,23,123,52,105,234,23,196,229,132,11,190,11,177,215,198,169,205,103,39,60,112,191,49,226,55,247,243,241,148,71,31,125,162,143,113,0,
+23,230,13,170,205,47,223,230,109,225,35,88,240,225,139,57,90,20,90,81,228,196,23,125,23,68,175,64,109,62,27,209,35,216,155,49,70,252,139,133,86,22,233,139,206,211,31,117,161,155,162,54,191,124,225,
+129,199,170,47,198,196,190,208,234,178,126,253,99,61,66,133,33,73,23,22,146,168,205,215,47,60,48,192,230,139,109,24,243,158,66,30,138,92,72,49,230,34,131,236,85,155,79,39,58,220,124,243,109,129,131,
+198,197,149,152,23,242,84,250,250,54,204,48,83,200,133,73,164,76,28,81,155,95,147,72,244,8,98,66,236,124,49,37,214,133,60,22,185,176,146,239,130,233,25,248,146,64,109,254,70,225,35,241,137,89,140,248,
+165,66,158,139,100,237,28,153,235,98,39,129,218,188,95,120,224,49,73,172,124,49,36,182,133,188,23,185,248,46,97,158,155,240,65,155,64,109,222,15,131,103,113,113,11,99,218,85,104,135,34,23,186,90,120,
+61,238,102,232,29,116,186,205,187,224,142,85,196,39,150,171,11,237,84,214,173,91,191,90,152,231,37,145,15,198,9,58,213,230,109,110,186,233,214,160,66,196,197,41,140,97,123,137,111,37,65,151,48,23,119,
+115,140,24,98,123,157,100,243,145,232,192,253,48,163,170,138,248,196,174,171,208,238,229,225,135,251,74,140,99,199,65,187,160,19,108,62,18,30,24,224,169,22,19,98,86,88,73,69,110,104,166,218,13,243,42,
+153,129,143,149,106,243,17,92,51,143,191,26,226,207,20,86,98,121,232,161,71,138,66,133,101,76,113,240,190,187,29,132,79,35,58,68,13,189,106,247,30,198,166,88,88,201,229,193,7,223,219,35,204,51,171,37,
+14,218,6,172,55,104,119,155,143,160,157,195,214,45,213,238,57,140,73,79,161,83,138,220,236,197,26,1,185,54,229,188,221,108,62,34,250,130,87,173,251,36,22,133,78,44,15,60,176,174,79,88,16,76,53,72,4,
+236,147,71,67,158,109,30,248,61,230,70,34,124,173,251,10,239,189,175,208,233,69,130,48,149,32,88,1,180,17,24,46,205,155,240,116,97,233,205,36,189,15,238,185,160,229,237,34,207,253,110,97,150,231,127,
+18,168,97,236,82,18,37,67,43,108,30,209,113,38,174,37,233,117,135,247,216,173,138,199,20,105,44,245,10,151,105,52,37,133,71,4,163,105,180,23,24,90,182,19,34,43,209,249,59,143,32,26,116,184,16,231,76,
+115,141,225,61,245,170,194,233,18,161,148,50,200,215,160,175,141,37,211,155,160,49,70,98,68,109,136,40,49,34,145,249,123,180,220,138,222,6,53,27,103,33,161,56,6,223,75,170,247,58,194,123,80,225,235,
+45,82,211,186,133,25,161,76,173,107,19,202,225,53,171,213,103,156,12,253,194,37,161,146,67,209,43,225,181,245,171,82,13,46,210,232,90,37,12,8,179,66,153,70,88,139,40,135,215,192,181,172,82,101,90,84,
+122,123,223,211,35,76,8,37,97,145,57,244,13,98,49,60,7,231,234,209,200,231,55,33,186,132,94,161,40,76,11,179,194,156,176,32,44,9,87,132,171,66,37,228,106,248,111,75,225,207,204,133,191,51,29,30,131,
+99,117,105,100,181,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,37,55,101,106,106,186,75,232,21,138,194,180,48,43,204,9,11,194,146,112,69,184,42,84,66,174,134,255,182,
+20,254,204,92,248,59,211,225,49,56,150,14,5,231,88,240,30,97,66,40,9,139,130,105,16,139,225,57,56,151,190,12,106,85,185,112,225,249,85,194,128,48,43,148,5,211,34,202,225,53,112,45,250,58,184,209,229,
+252,249,231,250,133,75,66,69,48,57,163,18,94,155,78,8,201,88,244,110,97,70,40,231,80,244,56,202,225,53,235,148,176,122,203,185,115,207,246,10,37,193,212,195,177,99,39,205,129,3,19,166,88,220,109,6,7,
+71,130,239,232,177,163,54,251,235,177,221,10,139,48,163,53,121,252,157,141,24,216,125,139,159,225,147,107,3,3,195,102,116,116,151,217,191,127,220,28,61,250,140,169,247,58,194,123,208,73,161,41,133,
+191,156,38,200,103,206,92,48,7,15,78,154,145,145,29,193,23,179,16,51,90,105,91,99,49,102,205,101,91,209,66,14,142,197,231,88,134,134,70,205,216,216,161,224,156,41,19,225,178,38,66,149,114,246,236,84,
+183,48,43,152,36,156,56,113,218,236,218,181,47,168,217,238,242,234,229,138,110,11,95,13,62,206,180,99,199,30,115,252,248,41,147,244,186,195,123,212,71,131,93,164,54,77,81,163,146,176,119,239,152,87,
+244,44,107,123,28,213,86,252,144,12,187,119,239,55,73,239,131,123,86,225,207,92,232,19,22,106,5,139,231,249,240,112,49,216,39,47,111,194,131,189,16,132,235,161,205,65,187,33,65,18,112,239,157,185,56,
+244,244,233,243,23,5,83,141,195,135,143,7,141,177,70,136,158,181,240,62,54,109,26,48,147,147,199,76,173,251,36,22,157,36,124,143,48,95,45,32,212,120,106,81,30,107,123,18,225,221,69,35,155,55,15,6,142,
+80,35,9,136,201,202,30,93,60,117,234,92,81,168,8,38,142,237,219,119,6,59,100,229,217,230,147,10,111,195,255,211,131,168,118,239,97,108,86,230,22,49,39,79,158,157,17,76,28,244,217,233,131,183,155,205,
+215,90,50,230,174,38,162,29,179,111,223,65,83,45,22,196,106,165,137,95,170,118,195,219,182,109,111,123,155,175,37,188,203,150,45,219,106,37,65,251,111,19,247,204,51,103,186,132,57,193,248,24,31,63,28,
+124,237,114,165,216,124,18,225,237,165,102,140,60,50,168,20,23,159,48,118,93,237,42,254,106,97,62,238,230,118,238,220,187,98,109,190,150,240,46,12,57,87,73,2,98,216,94,91,197,158,56,113,122,181,240,
+58,163,117,62,176,252,78,176,249,90,139,77,217,196,34,130,158,66,92,188,194,88,174,110,23,241,187,132,249,184,155,161,111,220,73,54,95,75,120,27,222,53,84,73,2,98,154,255,199,193,241,227,167,230,24,
+27,119,161,31,204,139,154,78,181,249,106,194,71,176,21,13,159,130,35,86,190,24,18,219,92,139,127,236,216,201,18,131,56,46,71,142,156,8,26,123,157,110,243,213,132,183,161,171,200,40,168,47,150,196,56,
+175,226,207,36,21,191,147,109,62,78,116,95,18,16,187,152,36,200,215,56,129,88,86,17,219,242,193,91,50,181,249,228,194,223,127,255,187,175,193,228,149,184,184,18,243,188,136,223,35,84,124,23,201,107,
+91,181,249,244,194,219,48,58,26,147,0,196,188,245,239,14,196,166,230,177,42,151,173,91,135,212,230,235,20,221,134,13,48,169,72,190,24,19,251,150,138,47,13,149,139,52,86,92,120,161,163,54,95,191,240,
+136,238,194,216,137,47,214,104,208,42,241,251,124,23,196,140,29,181,249,236,132,183,97,198,81,76,18,52,127,82,201,228,228,177,5,38,59,184,108,216,240,164,218,124,29,54,95,13,246,38,6,26,211,190,152,
+163,69,179,197,159,242,93,8,195,153,106,243,217,212,246,72,116,23,122,85,49,73,208,156,57,134,135,14,29,237,22,140,11,179,99,213,230,27,39,124,4,155,87,211,198,242,105,128,54,13,79,128,137,137,35,179,
+130,113,161,207,170,54,223,88,225,35,136,171,79,3,180,105,180,248,189,190,19,211,229,83,155,207,94,116,87,120,27,186,134,49,73,208,184,197,39,227,227,135,47,51,137,195,134,233,77,209,115,95,109,62,
+251,218,238,131,47,165,240,115,244,184,92,61,208,168,81,226,247,122,78,22,172,163,83,155,111,158,240,54,244,184,124,154,160,85,230,9,112,240,224,100,137,245,119,54,244,75,213,230,27,103,243,113,194,
+219,48,179,202,213,5,173,50,21,127,108,236,80,55,115,215,92,120,191,175,54,223,156,218,238,131,15,86,209,248,246,105,131,102,89,38,192,140,123,2,183,246,171,205,55,71,120,68,119,97,145,172,39,1,178,
+123,101,124,224,192,68,153,121,251,54,180,66,213,230,155,99,243,113,194,71,240,198,208,213,7,205,178,18,191,223,115,240,96,88,82,109,190,57,54,95,13,190,138,198,181,248,52,66,187,101,39,192,254,253,
+227,151,216,37,195,134,5,155,106,243,173,169,237,182,240,54,76,182,117,117,66,187,101,137,47,125,252,85,66,133,190,190,13,19,23,213,230,155,47,188,43,186,13,99,49,174,78,161,118,171,150,147,0,3,238,
+65,233,118,168,205,55,223,230,171,193,7,46,129,247,49,158,36,24,168,59,1,246,238,29,155,101,180,201,134,55,126,106,243,173,177,249,56,225,35,120,83,232,234,133,134,203,73,128,178,123,64,250,157,106,
+243,173,177,121,159,232,54,12,199,123,18,160,190,222,192,158,61,7,122,4,99,67,223,95,109,190,181,54,31,199,189,247,222,23,192,152,128,171,27,90,214,147,0,19,238,129,216,181,67,109,190,181,54,31,39,
+124,4,143,104,79,2,76,164,78,0,169,237,37,106,188,13,107,215,212,230,223,213,242,218,238,19,62,130,71,180,171,27,90,166,78,0,177,146,69,236,196,134,29,54,213,230,91,111,243,113,220,115,207,59,3,61,92,
+221,208,50,173,248,93,158,131,220,96,253,106,243,173,177,121,159,240,17,252,188,79,59,52,77,156,0,210,215,239,165,191,111,195,62,125,106,243,249,176,121,159,240,54,172,33,112,245,67,211,52,9,80,116,
+15,64,227,66,109,254,254,92,213,246,56,120,77,239,73,128,228,107,9,119,236,216,51,205,168,146,13,13,64,181,249,252,10,127,247,221,61,215,160,33,232,234,135,166,137,19,160,88,220,61,203,54,235,54,140,
+255,171,205,231,199,230,125,194,71,240,166,214,213,15,77,211,36,192,156,123,0,182,96,87,155,207,143,205,251,132,143,160,157,230,73,128,228,187,139,140,142,238,90,96,231,42,27,222,54,169,205,231,199,
+230,125,172,93,251,142,0,226,229,234,135,166,105,18,96,201,61,0,111,255,212,230,243,99,243,62,225,35,184,110,79,2,44,37,78,128,237,219,119,94,97,249,145,13,182,162,54,159,31,155,247,9,31,193,241,93,
+253,208,52,113,2,140,140,236,184,202,231,87,108,106,9,175,54,223,154,218,30,135,171,31,154,166,73,128,138,123,0,181,249,124,11,127,215,93,247,94,135,39,1,42,137,19,96,120,184,88,97,228,207,70,109,62,
+95,54,31,39,124,132,171,31,154,166,73,128,171,190,4,80,155,207,143,205,199,9,15,252,191,39,1,146,63,2,134,134,70,175,240,113,3,27,218,0,106,243,249,178,121,151,59,239,188,39,128,99,185,250,161,105,
+226,4,216,182,109,251,18,47,20,108,232,5,168,205,191,197,224,224,176,185,120,241,35,230,249,231,95,8,118,60,207,139,240,17,92,183,171,31,154,166,73,128,5,247,0,140,3,168,205,223,103,46,92,120,206,188,
+249,230,155,215,241,202,43,95,48,3,3,67,77,181,121,159,240,17,196,200,147,0,201,7,130,6,7,71,230,152,254,101,195,72,96,167,219,60,199,248,195,31,254,112,67,2,68,124,251,219,255,96,38,38,14,55,181,182,
+251,160,146,186,250,161,105,154,4,152,117,15,192,187,128,78,111,205,111,216,240,68,172,248,54,255,242,47,255,106,166,167,95,8,26,206,205,18,254,142,59,238,190,6,19,119,60,9,144,252,101,208,192,192,
+240,52,203,191,108,120,197,168,173,249,119,154,255,248,143,255,72,148,4,240,167,63,253,201,188,248,226,103,205,19,79,108,108,138,240,17,180,75,92,253,208,52,113,2,108,221,58,84,100,223,31,27,86,160,
+106,107,254,157,230,244,233,179,137,19,192,230,107,95,251,186,217,181,107,111,102,54,239,19,62,130,202,234,234,135,166,105,18,160,215,61,0,91,193,232,160,205,91,118,206,140,155,151,94,250,188,41,151,
+203,169,19,225,199,63,254,73,144,68,119,223,253,142,76,106,187,205,154,53,107,3,88,33,228,73,128,228,83,194,182,108,217,214,197,103,205,92,92,235,239,244,65,27,38,198,188,240,194,140,89,88,88,72,157,
+8,111,188,241,134,249,232,71,255,194,172,91,215,151,153,240,192,207,251,180,67,211,84,51,131,229,23,22,221,131,208,21,212,65,27,127,163,110,114,242,168,153,155,251,110,93,143,135,47,126,177,20,116,35,
+151,35,124,4,241,245,136,191,152,122,93,192,230,205,131,37,38,130,218,208,19,208,177,249,234,173,121,132,252,194,23,74,117,37,2,9,116,232,208,225,212,162,219,80,73,93,221,208,50,117,2,108,218,52,48,
+193,166,3,54,143,61,246,62,29,155,79,216,154,167,37,254,145,143,124,204,44,46,46,166,78,4,30,41,127,246,103,127,30,244,231,147,10,127,251,237,119,5,240,49,74,87,55,180,172,39,1,122,220,3,245,247,111,
+213,177,249,148,93,56,254,60,121,242,140,52,254,126,156,58,17,104,100,126,246,179,47,5,221,200,90,194,71,176,119,147,39,1,234,251,178,136,8,94,70,116,27,6,25,244,21,108,125,221,184,29,59,118,155,175,
+126,245,107,117,61,30,94,123,237,27,102,247,238,189,177,194,3,241,119,245,66,195,186,247,7,144,95,158,117,15,200,250,64,181,249,229,13,218,48,162,248,233,79,127,198,252,241,143,127,76,157,8,175,190,
+250,101,175,248,192,112,189,39,1,234,223,32,66,236,100,0,75,177,161,143,169,54,159,205,160,13,49,124,246,217,231,205,235,175,191,158,42,9,232,113,216,194,223,118,219,157,1,124,158,207,213,11,13,151,
+147,0,171,132,138,123,80,94,13,171,205,103,215,119,135,3,7,198,205,55,191,249,173,68,9,240,137,79,124,234,58,225,129,184,123,196,71,187,250,55,137,162,60,245,212,230,75,140,2,218,240,81,67,181,249,
+108,132,119,121,250,233,205,230,229,151,103,171,38,192,169,83,103,174,19,31,88,13,228,234,132,118,203,222,39,112,227,198,77,253,12,125,186,208,19,80,155,207,78,120,247,121,142,203,126,224,3,31,50,191,
+249,205,191,223,48,86,224,138,207,241,125,26,161,93,38,187,133,202,129,202,238,193,105,112,168,205,47,79,244,184,214,188,251,124,63,124,248,152,249,228,39,63,37,53,255,236,13,226,223,122,235,29,193,
+116,61,143,248,217,108,21,75,145,134,223,12,141,63,27,6,133,212,230,179,169,237,113,194,87,3,225,35,248,110,128,171,15,154,101,153,0,221,158,19,4,99,2,106,243,217,9,159,70,244,136,232,75,98,30,178,
+253,128,212,147,79,62,93,98,143,0,27,150,140,171,205,175,109,137,240,17,12,253,186,186,160,85,230,95,12,145,62,102,47,253,76,23,92,64,109,190,241,54,31,87,251,125,154,160,85,67,190,27,36,7,190,236,
+158,140,231,143,218,124,115,106,123,68,119,247,154,224,79,102,254,120,196,111,204,71,163,40,143,63,190,177,151,169,97,46,124,56,66,109,190,177,194,35,186,13,45,127,159,22,104,212,208,111,7,202,9,102,
+125,39,102,92,64,109,190,241,194,3,247,22,35,126,99,63,28,73,145,238,95,55,93,64,151,117,235,214,171,205,103,108,243,113,48,6,227,211,0,109,154,242,253,96,121,238,79,241,236,119,97,244,74,109,62,219,
+218,110,115,203,45,183,7,13,63,95,236,209,164,169,95,16,151,19,46,248,46,132,71,129,218,124,246,194,3,247,27,35,126,115,63,31,79,121,244,209,39,250,24,7,112,97,222,160,218,252,242,109,222,22,62,130,
+105,102,190,152,163,69,161,21,69,78,124,209,119,65,244,10,212,230,179,17,61,130,41,232,49,226,95,44,180,178,72,95,116,158,254,168,11,221,20,181,249,229,11,15,60,86,125,49,38,246,133,86,151,245,235,31,
+235,17,42,12,73,186,176,144,68,109,190,126,225,129,1,54,95,108,195,152,247,20,242,80,228,66,138,49,23,25,100,175,218,124,58,209,225,230,155,111,11,28,52,46,174,196,188,144,167,210,215,183,97,134,153,
+66,46,76,34,101,226,136,218,252,154,68,162,71,16,19,98,231,139,41,177,46,228,177,200,133,149,124,23,76,207,192,151,4,106,243,55,10,31,137,79,204,98,196,47,21,242,92,36,107,231,200,92,23,59,9,212,230,
+253,194,3,143,73,98,229,139,33,177,45,228,189,200,197,119,9,243,220,132,15,218,4,106,243,126,24,60,139,139,91,24,211,174,66,59,20,185,208,213,194,235,113,55,67,239,160,211,109,222,5,119,172,34,62,177,
+92,93,104,167,178,110,221,250,213,194,60,47,137,124,48,78,208,169,54,111,115,211,77,183,6,21,34,46,78,97,12,219,75,124,43,9,186,132,185,184,155,99,196,16,219,235,36,155,143,68,7,238,135,25,85,85,196,
+39,118,93,133,118,47,15,63,220,87,98,28,59,14,218,5,157,96,243,145,240,192,0,79,181,152,16,179,194,74,42,114,67,51,213,110,152,87,201,12,124,172,84,155,143,224,154,121,252,213,16,127,166,176,18,203,
+67,15,61,82,20,42,44,99,138,131,247,221,237,32,124,26,209,33,106,232,85,187,247,48,54,197,194,74,46,15,62,248,222,30,97,158,89,45,113,208,54,96,189,65,187,219,124,4,237,28,182,110,169,118,207,97,76,
+122,10,157,82,228,102,47,214,8,200,181,41,231,237,102,243,17,209,23,188,106,221,39,177,40,116,98,121,224,129,117,125,194,130,96,170,65,34,96,159,60,26,242,108,243,192,239,49,55,18,225,107,221,87,120,
+239,125,133,78,47,18,132,169,4,193,10,160,141,192,112,105,222,132,167,11,75,111,38,233,125,112,207,5,45,111,23,121,238,119,11,179,60,255,147,64,13,99,135,141,40,25,90,97,243,136,142,51,113,45,73,175,
+59,188,199,110,85,60,166,72,99,169,87,184,76,163,41,41,60,34,24,77,163,189,192,208,178,157,16,89,137,206,223,121,4,209,160,195,133,56,103,154,107,12,239,169,87,21,78,151,8,165,148,65,190,6,125,109,44,
+153,222,4,141,49,18,35,106,67,68,137,17,137,204,223,163,229,86,244,54,168,217,56,11,9,197,49,216,246,189,222,235,8,239,65,133,175,183,72,77,235,22,102,132,50,181,174,77,40,135,215,172,86,159,113,50,
+244,11,151,132,74,14,69,175,132,215,214,175,74,53,184,72,163,107,149,48,32,204,10,101,26,97,45,162,28,94,3,215,178,74,149,105,81,233,237,125,79,143,48,33,148,132,69,230,208,55,136,197,240,28,156,171,
+71,35,159,223,132,232,18,122,133,162,48,45,204,10,115,194,130,176,36,92,17,174,10,149,144,171,225,191,45,133,63,51,23,254,206,116,120,12,142,213,165,145,213,162,69,139,22,45,90,180,104,209,162,69,139,
+22,45,90,180,104,209,162,69,139,150,220,148,169,169,233,46,161,87,40,10,211,194,172,48,39,44,8,75,194,21,225,170,80,9,185,26,254,219,82,248,51,115,225,239,76,135,199,224,88,58,20,156,99,193,123,132,9,
+161,36,44,10,166,65,44,134,231,224,92,250,50,168,85,229,194,133,231,87,9,3,194,172,80,22,76,139,40,135,215,192,181,232,235,224,70,151,243,231,159,235,23,46,9,21,193,228,140,74,120,109,58,33,36,99,209,
+187,133,25,161,156,67,209,227,40,135,215,172,83,194,234,45,231,206,61,219,43,148,4,83,15,199,142,157,52,7,14,76,152,98,113,183,25,28,28,9,190,163,199,142,218,236,175,199,118,43,44,194,140,214,228,241,
+119,54,98,96,247,45,126,134,79,174,13,12,12,155,209,209,93,102,255,254,113,115,244,232,51,166,222,235,8,239,65,39,133,166,20,254,114,154,32,159,57,115,193,28,60,56,105,70,70,118,4,95,204,66,204,104,
+165,109,141,197,152,53,151,109,69,11,57,56,22,159,99,25,26,26,53,99,99,135,130,115,166,76,132,203,154,8,85,202,217,179,83,221,194,172,96,146,112,226,196,105,179,107,215,190,160,102,187,203,171,151,43,
+186,45,124,53,248,56,211,142,29,123,204,241,227,167,76,210,235,14,239,81,31,13,118,145,218,52,69,141,74,194,222,189,99,94,209,179,172,237,113,84,91,241,67,50,236,222,189,223,36,189,15,238,89,133,63,
+115,161,79,88,168,21,44,158,231,195,195,197,96,159,188,188,9,15,246,66,16,174,135,54,7,237,134,4,73,192,189,119,230,226,208,211,167,207,95,20,76,53,14,31,62,30,52,198,26,33,122,214,194,251,216,180,
+105,192,76,78,30,51,181,238,147,88,116,146,240,61,194,124,181,128,80,227,169,69,121,172,237,73,132,119,23,141,108,222,60,24,56,66,141,36,32,38,43,123,116,241,212,169,115,69,161,34,152,56,182,111,223,
+25,236,144,149,103,155,79,42,188,13,255,79,15,162,218,189,135,177,89,153,91,196,156,60,121,118,70,48,113,208,103,167,15,222,110,54,95,107,201,152,187,154,136,118,204,190,125,7,77,181,88,16,171,149,38,
+126,169,218,13,111,219,182,189,237,109,190,150,240,46,91,182,108,171,149,4,237,191,77,220,51,207,156,233,18,230,4,227,99,124,252,112,240,181,203,149,98,243,73,132,183,151,154,49,242,200,160,82,92,124,
+194,216,117,181,171,248,171,133,249,184,155,219,185,115,239,138,181,249,90,194,187,48,228,92,37,9,136,97,123,109,21,123,226,196,233,213,194,235,140,214,249,192,242,59,193,230,107,45,54,101,19,139,8,
+122,10,113,241,10,99,185,186,93,196,239,18,230,227,110,134,190,113,39,217,124,45,225,109,120,215,80,37,9,136,105,254,31,7,199,143,159,154,99,108,220,133,126,48,47,106,58,213,230,171,9,31,193,86,52,
+124,10,142,88,249,98,72,108,115,45,254,177,99,39,75,12,226,184,28,57,114,34,104,236,117,186,205,87,19,222,134,174,34,163,160,190,88,18,227,188,138,63,147,84,252,78,182,249,56,209,125,73,64,236,98,146,
+32,95,227,4,98,89,69,108,203,7,111,201,212,230,147,11,127,255,253,239,190,6,147,87,226,226,74,204,243,34,126,143,80,241,93,36,175,109,213,230,211,11,111,195,232,104,76,2,16,243,214,191,59,16,155,154,
+199,170,92,182,110,29,82,155,175,83,116,27,54,192,164,34,249,98,76,236,91,42,190,52,84,46,210,88,113,225,133,142,218,124,253,194,35,186,11,99,39,190,88,163,65,171,196,239,243,93,16,51,118,212,230,179,
+19,222,134,25,71,49,73,208,252,73,37,147,147,199,22,152,236,224,178,97,195,147,106,243,117,216,124,53,216,155,24,104,76,251,98,142,22,205,22,127,202,119,33,12,103,170,205,103,83,219,35,209,93,232,85,
+197,36,65,115,230,24,30,58,116,180,91,48,46,204,142,85,155,111,156,240,17,108,94,77,27,203,167,1,218,52,60,1,38,38,142,204,10,198,133,62,171,218,124,99,133,143,32,174,62,13,208,166,209,226,247,250,78,
+76,151,79,109,62,123,209,93,225,109,232,26,198,36,65,227,22,159,140,143,31,190,204,36,14,27,166,55,69,207,125,181,249,236,107,187,15,190,148,194,207,209,227,114,245,64,163,70,137,223,235,57,89,176,
+142,78,109,190,121,194,219,208,227,242,105,130,86,153,39,192,193,131,147,37,214,223,217,208,47,85,155,111,156,205,199,9,111,195,204,42,87,23,180,202,84,252,177,177,67,221,204,93,115,225,253,190,218,
+124,115,106,187,15,62,88,69,227,219,167,13,154,101,153,0,51,238,9,220,218,175,54,223,28,225,17,221,133,69,178,158,4,200,238,149,241,129,3,19,101,230,237,219,208,10,85,155,111,142,205,199,9,31,193,27,
+67,87,31,52,203,74,252,126,207,193,131,97,73,181,249,230,216,124,53,248,42,26,215,226,211,8,237,150,157,0,251,247,143,95,98,151,12,27,22,108,170,205,183,166,182,219,194,219,48,217,214,213,9,237,150,
+37,190,244,241,87,9,21,250,250,54,76,92,84,155,111,190,240,174,232,54,140,197,184,58,133,218,173,90,78,2,12,184,7,165,219,161,54,223,124,155,175,6,31,184,4,222,199,120,146,96,160,238,4,216,187,119,
+108,150,209,38,27,222,248,169,205,183,198,230,227,132,143,224,77,161,171,23,26,46,39,1,202,238,1,233,119,170,205,183,198,230,125,162,219,48,28,239,73,128,250,122,3,123,246,28,232,17,140,13,125,127,
+181,249,214,218,124,28,247,222,123,95,0,99,2,174,110,104,89,79,2,76,184,7,98,215,14,181,249,214,218,124,156,240,17,60,162,61,9,48,145,58,1,164,182,151,168,241,54,172,93,83,155,127,87,203,107,187,79,
+248,8,30,209,174,110,104,153,58,1,196,74,22,177,19,27,118,216,84,155,111,189,205,199,113,207,61,239,12,244,112,117,67,203,180,226,119,121,14,114,131,245,171,205,183,198,230,125,194,71,240,243,62,237,
+208,52,113,2,72,95,191,151,254,190,13,251,244,169,205,231,195,230,125,194,219,176,134,192,213,15,77,211,36,64,209,61,0,141,11,181,249,251,115,85,219,227,224,53,189,39,1,146,175,37,220,177,99,207,52,
+163,74,54,52,0,213,230,243,43,252,221,119,247,92,131,134,160,171,31,154,38,78,128,98,113,247,44,219,172,219,48,254,175,54,159,31,155,247,9,31,193,155,90,87,63,52,77,147,0,115,238,1,216,130,93,109,62,
+63,54,239,19,62,130,118,154,39,1,146,239,46,50,58,186,107,129,157,171,108,120,219,164,54,159,31,155,247,177,118,237,59,2,136,151,171,31,154,166,73,128,37,247,0,188,253,83,155,207,143,205,251,132,143,
+224,186,61,9,176,148,56,1,182,111,223,121,133,229,71,54,216,138,218,124,126,108,222,39,124,4,199,119,245,67,211,196,9,48,50,178,227,42,159,95,177,169,37,188,218,124,107,106,123,28,174,126,104,154,38,
+1,42,238,1,212,230,243,45,252,93,119,221,123,29,158,4,168,36,78,128,225,225,98,133,145,63,27,181,249,124,217,124,156,240,17,174,126,104,154,38,1,174,250,18,64,109,62,63,54,31,39,60,240,255,158,4,72,
+254,8,24,26,26,189,194,199,13,108,104,3,168,205,231,203,230,93,238,188,243,158,0,142,229,234,135,166,137,19,96,219,182,237,75,188,80,176,161,23,160,54,159,47,155,119,133,143,224,186,93,253,208,52,77,
+2,44,184,7,96,28,64,109,254,45,198,198,38,204,249,243,83,102,243,230,129,150,217,188,79,248,8,98,228,73,128,228,3,65,131,131,35,115,76,255,178,97,36,80,109,254,62,243,237,111,127,199,188,249,230,155,
+215,120,245,213,47,155,141,27,251,91,86,219,125,80,73,93,253,208,52,77,2,204,186,7,224,93,64,167,219,252,251,223,255,193,235,196,183,249,171,191,122,217,244,245,61,218,50,225,239,184,227,238,107,48,
+113,199,147,0,201,95,6,13,12,12,79,179,252,203,134,87,140,157,222,154,255,202,87,190,26,155,0,17,159,248,196,167,2,1,26,109,243,62,225,35,248,18,139,171,31,154,38,78,128,173,91,135,138,236,251,99,195,
+10,212,78,111,205,127,236,99,31,175,153,0,240,199,63,254,209,124,240,131,23,131,235,109,148,205,251,132,143,160,178,186,250,161,105,154,4,232,117,15,192,86,48,157,222,154,255,31,255,227,1,243,207,255,
+252,243,68,73,0,191,253,237,111,205,115,207,77,55,180,182,219,172,89,179,54,128,21,66,158,4,72,62,37,108,203,150,109,93,124,214,204,197,181,254,78,28,180,33,6,31,253,232,95,152,114,185,156,56,17,254,
+245,95,127,97,78,158,60,221,112,225,129,159,247,105,135,166,169,102,6,203,47,44,186,7,161,43,168,131,54,111,241,224,131,235,204,103,62,243,217,196,73,0,63,253,233,207,204,196,196,225,76,108,222,21,62,
+130,248,122,196,95,76,189,46,96,243,230,193,18,19,65,109,232,9,232,160,205,245,207,115,166,202,253,205,223,188,146,42,17,190,251,221,239,153,93,187,246,102,38,186,13,149,212,213,13,45,83,39,192,166,
+77,3,19,108,58,96,243,216,99,239,211,177,249,24,158,126,122,179,249,219,191,253,74,170,68,248,198,55,254,63,233,158,13,103,34,252,237,183,223,21,192,199,40,93,221,208,178,158,4,232,113,15,212,223,191,
+85,199,230,107,180,230,135,135,71,205,223,255,253,55,83,37,194,171,175,94,146,134,219,211,203,18,62,130,189,155,60,9,80,223,151,69,68,240,50,162,219,208,199,213,177,249,218,173,249,61,123,246,153,239,
+127,255,7,169,18,225,229,151,255,218,60,242,200,255,170,41,186,79,120,32,254,174,94,104,88,247,254,0,242,203,179,238,1,89,31,168,175,96,147,183,230,15,29,58,98,230,231,231,83,37,194,39,63,249,169,96,
+234,125,18,209,109,24,174,247,36,64,253,27,68,136,157,12,96,41,54,244,49,245,21,108,250,65,155,147,39,207,152,133,133,95,38,78,130,255,251,127,255,175,249,208,135,62,28,196,169,150,240,183,221,118,
+103,0,159,231,115,245,66,195,229,36,192,42,161,226,30,148,87,195,106,243,245,117,225,24,24,122,227,141,55,18,39,194,27,111,252,46,248,157,106,194,3,113,247,136,143,118,245,111,18,69,121,234,169,205,
+151,24,5,180,225,163,134,106,243,245,247,221,185,87,134,138,255,244,167,63,165,26,76,226,173,163,43,124,4,171,129,92,157,208,110,217,251,4,110,220,184,169,159,197,134,46,244,4,212,230,151,215,127,239,
+237,253,159,193,203,163,164,73,240,189,239,125,223,43,62,199,247,105,132,118,153,236,22,42,7,42,187,7,167,193,161,54,191,188,190,123,212,176,91,183,174,207,124,254,243,47,39,74,2,98,103,139,127,235,
+173,119,4,211,245,60,226,103,179,85,44,69,26,126,51,52,254,108,24,20,82,155,191,59,147,190,123,4,111,92,191,244,165,87,171,180,7,222,184,78,248,8,190,27,224,234,131,102,89,38,64,183,231,4,193,152,128,
+218,252,242,133,119,27,117,76,53,123,237,181,111,220,144,0,207,62,251,252,117,194,67,244,37,49,15,217,126,64,234,201,39,159,46,177,71,128,13,227,224,106,243,107,51,19,222,101,116,116,167,121,229,149,
+47,6,174,112,224,192,248,13,226,3,67,191,174,46,104,149,249,23,67,164,143,217,75,63,211,5,23,80,155,79,47,122,53,225,125,54,239,131,218,239,211,4,173,26,242,221,32,57,240,101,247,100,60,127,212,230,
+151,95,219,147,138,14,221,221,107,130,63,153,249,227,17,191,49,31,141,162,72,35,165,151,134,138,11,31,142,80,155,111,172,240,136,110,67,203,223,167,5,26,53,244,219,129,114,130,89,223,137,25,23,80,155,
+111,188,240,192,189,197,136,223,216,15,71,82,164,251,215,77,23,208,101,221,186,245,106,243,25,219,124,28,140,193,248,52,64,155,166,124,63,88,158,251,83,60,251,93,120,71,160,54,159,109,109,183,185,229,
+150,219,131,134,159,47,246,104,210,212,47,136,203,9,23,124,23,194,163,64,109,62,123,225,129,251,141,17,191,185,159,143,167,60,250,232,19,125,140,3,184,48,111,80,109,126,249,54,111,11,31,193,130,15,95,
+204,209,162,208,138,34,39,190,232,187,32,122,5,106,243,217,136,30,193,4,145,24,241,47,22,90,89,164,47,58,79,127,212,133,110,138,218,252,242,133,7,30,171,190,24,19,251,66,171,203,250,245,143,245,8,21,
+134,36,93,88,68,161,54,95,191,240,192,0,155,47,182,97,204,123,10,121,40,114,33,197,152,139,12,178,87,109,62,157,232,112,243,205,183,5,14,26,23,87,98,94,200,83,233,235,219,48,195,76,33,23,38,145,50,
+113,68,109,126,77,34,209,35,136,9,177,243,197,148,88,23,242,88,228,194,74,190,11,166,103,224,75,2,181,249,27,133,143,196,39,102,49,226,151,10,121,46,146,181,115,100,174,139,157,4,106,243,126,225,129,
+199,36,177,242,197,144,216,22,242,94,228,226,187,132,121,110,194,7,109,2,181,121,63,12,158,197,197,45,140,105,87,161,29,138,92,232,106,225,245,184,155,161,119,208,233,54,239,130,59,86,17,159,88,174,
+46,180,83,89,183,110,253,106,97,158,151,68,62,24,39,232,84,155,183,185,233,166,91,131,10,17,23,167,48,134,237,37,190,149,4,93,194,92,220,205,49,98,136,237,117,146,205,71,162,3,247,195,140,170,42,226,
+19,187,174,66,187,151,135,31,238,43,49,142,29,7,237,130,78,176,249,72,120,96,128,167,90,76,136,89,97,37,21,185,161,153,106,55,204,171,100,6,62,86,170,205,71,112,205,60,254,106,136,63,83,88,137,229,
+161,135,30,41,10,21,150,49,197,193,251,238,118,16,62,141,232,16,53,244,170,221,123,24,155,98,97,37,151,7,31,124,111,143,48,207,172,150,56,104,27,248,86,197,182,155,205,71,208,206,97,235,150,106,247,
+28,198,164,167,208,41,69,110,246,98,141,128,92,155,114,222,110,54,31,17,125,193,171,214,125,18,139,66,39,150,7,30,88,215,39,44,8,166,26,36,2,246,201,163,33,207,54,15,252,30,115,35,17,190,214,125,133,
+247,222,87,232,244,34,65,152,74,16,172,0,218,8,12,151,230,77,120,186,176,244,102,146,222,7,247,92,208,242,118,145,231,126,183,48,203,243,63,9,212,48,118,41,137,146,161,21,54,143,232,56,19,215,146,244,
+186,195,123,236,86,197,99,138,52,150,122,133,203,52,154,146,194,35,130,209,52,218,11,12,45,219,9,145,149,232,252,157,71,16,13,58,92,136,115,166,185,198,240,158,122,85,225,116,137,80,74,25,228,107,208,
+215,198,146,233,77,208,24,35,49,162,54,68,148,24,145,200,252,61,90,110,69,111,131,154,141,179,144,80,28,131,239,37,213,123,29,225,61,168,240,245,22,169,105,221,194,140,80,166,214,181,9,229,240,154,
+213,234,51,78,134,126,225,146,80,201,161,232,149,240,218,250,85,169,6,23,105,116,173,18,6,132,89,161,76,35,172,69,148,195,107,224,90,86,169,50,45,42,189,189,239,233,17,38,132,146,176,200,28,250,6,177,
+24,158,131,115,245,104,228,243,155,16,93,66,175,80,20,166,133,89,97,78,88,16,150,132,43,194,85,161,18,114,53,252,183,165,240,103,230,194,223,153,14,143,193,177,186,52,178,90,180,104,209,162,69,139,22,
+45,90,180,104,209,162,69,139,22,45,90,180,104,209,146,155,50,53,53,221,37,244,10,69,97,90,152,21,230,132,5,97,73,184,34,92,21,42,33,87,195,127,91,10,127,102,46,252,157,233,240,24,28,75,135,130,115,44,
+120,143,48,33,148,132,69,193,52,136,197,240,28,156,75,95,6,181,170,92,184,240,252,42,97,64,152,21,202,130,105,17,229,240,26,184,22,125,29,220,232,114,254,252,115,253,194,37,161,34,152,156,81,9,175,77,
+39,132,100,44,122,183,48,35,148,115,40,122,28,229,240,154,117,74,88,189,229,220,185,103,123,133,146,96,234,225,216,177,147,230,192,129,9,83,44,238,54,131,131,35,193,119,244,216,81,155,253,245,216,110,
+133,69,152,209,154,60,254,206,70,12,236,190,197,207,240,201,181,129,129,97,51,58,186,203,236,223,63,110,142,30,125,198,212,123,29,225,61,232,164,208,148,194,95,78,19,228,51,103,46,152,131,7,39,205,
+200,200,142,224,139,89,136,25,173,180,173,177,24,179,230,178,173,104,33,7,199,226,115,44,67,67,163,102,108,236,80,112,206,148,137,112,89,19,161,74,57,123,118,170,91,152,21,76,18,78,156,56,109,118,237,
+218,23,212,108,119,121,245,114,69,183,133,175,6,31,103,218,177,99,143,57,126,252,148,73,122,221,225,61,234,163,193,46,82,155,166,168,81,73,216,187,119,204,43,122,150,181,61,142,106,43,126,72,134,221,
+187,247,155,164,247,193,61,171,240,103,46,244,9,11,181,130,197,243,124,120,184,24,236,147,151,55,225,193,94,8,194,245,208,230,160,221,144,32,9,184,247,206,92,28,122,250,244,249,139,130,169,198,225,
+195,199,131,198,88,35,68,207,90,120,31,155,54,13,152,201,201,99,166,214,125,18,139,78,18,190,71,152,175,22,16,106,60,181,40,143,181,61,137,240,238,162,145,205,155,7,3,71,168,145,4,196,100,101,143,46,
+158,58,117,174,40,84,4,19,199,246,237,59,131,29,178,242,108,243,73,133,183,225,255,233,65,84,187,247,48,54,43,115,139,152,147,39,207,206,8,38,14,250,236,244,193,219,205,230,107,45,25,115,87,19,209,
+142,217,183,239,160,169,22,11,98,181,210,196,47,85,187,225,109,219,182,183,189,205,215,18,222,101,203,150,109,181,146,160,253,183,137,123,230,153,51,93,194,156,96,124,140,143,31,14,190,118,185,82,108,
+62,137,240,246,82,51,70,30,25,84,138,139,79,24,187,174,118,21,127,181,48,31,119,115,59,119,238,93,177,54,95,75,120,23,134,156,171,36,1,49,108,175,173,98,79,156,56,189,90,120,157,209,58,31,88,126,39,
+216,124,173,197,166,108,98,17,65,79,33,46,94,97,44,87,183,139,248,93,194,124,220,205,208,55,238,36,155,175,37,188,13,239,26,170,36,1,49,205,255,227,224,248,241,83,115,140,141,187,208,15,230,69,77,167,
+218,124,53,225,35,216,138,134,79,193,17,43,95,12,137,109,174,197,63,118,236,100,137,65,28,151,35,71,78,4,141,189,78,183,249,106,194,219,208,85,100,20,212,23,75,98,156,87,241,103,146,138,223,201,54,31,
+39,186,47,9,136,93,76,18,228,107,156,64,44,171,136,109,249,224,45,153,218,124,114,225,239,191,255,221,215,96,242,74,92,92,137,121,94,196,239,17,42,190,139,228,181,173,218,124,122,225,109,24,29,141,73,
+0,98,222,250,119,7,98,83,243,88,149,203,214,173,67,106,243,117,138,110,195,6,152,84,36,95,140,137,125,75,197,151,134,202,69,26,43,46,188,208,81,155,175,95,120,68,119,97,236,196,23,107,52,104,149,248,
+125,190,11,98,198,142,218,124,118,194,219,48,227,40,38,9,154,63,169,100,114,242,216,2,147,29,92,54,108,120,82,109,190,14,155,175,6,123,19,3,141,105,95,204,209,162,217,226,79,249,46,132,225,76,181,249,
+108,106,123,36,186,11,189,170,152,36,104,206,28,195,67,135,142,118,11,198,133,217,177,106,243,141,19,62,130,205,171,105,99,249,52,64,155,134,39,192,196,196,145,89,193,184,208,103,85,155,111,172,240,
+17,196,213,167,1,218,52,90,252,94,223,137,233,242,169,205,103,47,186,43,188,13,93,195,152,36,104,220,226,147,241,241,195,151,153,196,97,195,244,166,232,185,175,54,159,125,109,247,193,151,82,248,57,
+122,92,174,30,104,212,40,241,123,61,39,11,214,209,169,205,55,79,120,27,122,92,62,77,208,42,243,4,56,120,112,178,196,250,59,27,250,165,106,243,141,179,249,56,225,109,152,89,229,234,130,86,153,138,63,
+54,118,168,155,185,107,46,188,223,87,155,111,78,109,247,193,7,171,104,124,251,180,65,179,44,19,96,198,61,129,91,251,213,230,155,35,60,162,187,176,72,214,147,0,217,189,50,62,112,96,162,204,188,125,27,
+90,161,106,243,205,177,249,56,225,35,120,99,232,234,131,102,89,137,223,239,57,120,48,44,169,54,223,28,155,175,6,95,69,227,90,124,26,161,221,178,19,96,255,254,241,75,236,146,97,195,130,77,181,249,214,
+212,118,91,120,27,38,219,186,58,161,221,178,196,151,62,254,42,161,66,95,223,134,137,139,106,243,205,23,222,21,221,134,177,24,87,167,80,187,85,203,73,128,1,247,160,116,59,212,230,155,111,243,213,224,3,
+151,192,251,24,79,18,12,212,157,0,123,247,142,205,50,218,100,195,27,63,181,249,214,216,124,156,240,17,188,41,116,245,66,195,229,36,64,217,61,32,253,78,181,249,214,216,188,79,116,27,134,227,61,9,80,95,
+111,96,207,158,3,61,130,177,161,239,175,54,223,90,155,143,227,222,123,239,11,96,76,192,213,13,45,235,73,128,9,247,64,236,218,161,54,223,90,155,143,19,62,130,71,180,39,1,38,82,39,128,212,246,18,53,222,
+134,181,107,106,243,239,106,121,109,247,9,31,193,35,218,213,13,45,83,39,128,88,201,34,118,98,195,14,155,106,243,173,183,249,56,238,185,231,157,129,30,174,110,104,153,86,252,46,207,65,110,176,126,181,
+249,214,216,188,79,248,8,126,222,167,29,154,38,78,0,233,235,247,210,223,183,97,159,62,181,249,124,216,188,79,120,27,214,16,184,250,161,105,154,4,40,186,7,160,113,161,54,127,127,174,106,123,28,188,166,
+247,36,64,242,181,132,59,118,236,153,102,84,201,134,6,160,218,124,126,133,191,251,238,158,107,208,16,116,245,67,211,196,9,80,44,238,158,101,155,117,27,198,255,213,230,243,99,243,62,225,35,120,83,235,
+234,135,166,105,18,96,206,61,0,91,176,171,205,231,199,230,125,194,71,208,78,243,36,64,242,221,69,70,71,119,45,176,115,149,13,111,155,212,230,243,99,243,62,214,174,125,71,0,241,114,245,67,211,52,9,176,
+228,30,128,183,127,106,243,249,177,121,159,240,17,92,183,39,1,150,18,39,192,246,237,59,175,176,252,200,6,91,81,155,207,143,205,251,132,143,224,248,174,126,104,154,56,1,70,70,118,92,229,243,43,54,181,
+132,87,155,111,77,109,143,195,213,15,77,211,36,64,197,61,128,218,124,190,133,191,235,174,123,175,195,147,0,149,196,9,48,60,92,172,48,242,103,163,54,159,47,155,143,19,62,194,213,15,77,211,36,192,85,95,
+2,168,205,231,199,230,227,132,7,254,223,147,0,201,31,1,67,67,163,87,248,184,129,13,109,0,181,249,124,217,188,203,157,119,222,19,192,177,92,253,208,52,113,2,108,219,182,125,137,23,10,54,244,2,212,230,
+243,101,243,174,240,17,92,183,171,31,154,166,73,128,5,247,0,140,3,168,205,231,199,230,125,194,71,16,35,79,2,36,31,8,26,28,28,153,99,250,151,13,35,129,106,243,247,153,13,27,158,48,199,142,61,99,118,
+237,218,155,139,218,238,131,74,234,234,135,166,105,18,96,214,61,0,239,2,58,221,230,167,166,158,51,111,190,249,230,53,230,230,190,107,6,6,134,114,33,252,29,119,220,125,13,38,238,120,18,32,249,203,160,
+129,129,225,105,150,127,217,240,138,177,147,109,158,41,215,182,248,54,31,255,248,39,188,73,208,72,155,247,9,31,193,151,88,92,253,208,52,113,2,108,221,58,84,100,223,31,27,86,160,118,114,107,126,231,
+206,61,177,9,0,175,191,254,47,230,192,129,241,166,217,188,79,248,8,42,171,171,31,154,166,73,128,94,247,0,108,5,211,201,173,121,42,64,181,4,136,248,194,23,190,24,184,69,179,106,187,205,154,53,107,3,88,
+33,228,73,128,228,83,194,182,108,217,214,197,103,205,92,92,235,239,180,214,252,75,47,253,85,162,36,248,207,255,252,131,57,123,246,124,211,133,7,126,222,167,29,154,166,154,25,44,191,176,232,30,132,174,
+96,167,15,218,156,57,115,222,252,254,247,191,79,148,8,223,252,230,183,196,57,55,53,196,230,93,225,35,136,175,71,252,197,212,235,2,54,111,30,44,49,17,212,134,158,128,14,218,188,35,216,25,229,149,87,
+190,144,40,9,224,195,31,254,104,67,106,187,15,42,169,171,27,90,166,78,128,77,155,6,38,216,116,192,230,177,199,222,167,131,54,22,251,246,141,153,159,255,252,231,137,146,96,126,254,159,130,177,131,70,9,
+127,251,237,119,5,240,49,74,87,55,180,172,39,1,122,220,3,245,247,111,213,177,121,79,163,238,99,31,251,120,98,55,120,249,229,191,14,222,171,100,45,124,4,123,55,121,18,160,190,47,139,136,224,101,68,183,
+97,144,65,199,230,111,124,166,111,218,180,213,124,231,59,255,144,40,9,222,120,227,13,115,226,196,201,186,69,247,9,15,196,223,213,11,13,235,222,31,64,126,121,214,61,32,235,3,117,108,62,190,53,127,254,
+252,148,89,90,90,74,148,8,175,189,246,13,121,172,62,89,119,109,119,97,184,222,147,0,245,111,16,33,118,50,128,165,216,208,199,212,87,176,213,91,243,15,61,244,94,83,42,189,154,248,177,48,51,243,129,101,
+9,127,219,109,119,6,240,121,62,87,47,52,92,78,2,172,18,42,238,65,121,53,172,175,96,107,183,230,25,25,252,197,47,126,145,40,9,126,252,227,31,155,145,145,98,93,194,3,113,247,136,143,118,245,111,18,69,
+121,234,169,205,151,24,5,180,225,163,134,250,10,54,89,107,158,243,254,229,95,126,50,177,27,188,248,226,231,130,88,38,21,62,130,213,64,174,78,104,183,236,125,2,55,110,220,212,207,98,67,23,122,2,157,
+108,243,105,187,113,91,182,12,154,239,125,239,251,137,146,224,55,191,249,119,51,57,121,180,166,232,17,28,223,167,17,218,101,178,91,168,28,168,236,30,156,6,135,218,124,250,46,220,179,207,62,111,202,
+229,114,162,68,248,202,87,190,26,12,190,85,19,255,214,91,239,8,186,149,30,241,179,217,42,150,34,13,191,25,26,127,54,12,10,169,205,215,215,141,227,117,237,165,75,127,155,248,177,192,4,20,159,240,17,
+124,55,192,213,7,205,178,76,128,110,207,9,130,49,1,181,249,250,7,109,38,38,38,205,191,253,219,191,37,74,2,106,185,45,122,68,244,37,49,15,217,126,64,234,201,39,159,46,177,71,128,13,75,198,213,230,215,
+46,171,255,78,28,62,245,169,207,212,76,0,230,35,248,18,128,161,95,87,23,180,202,252,139,33,210,199,236,165,159,233,130,11,168,205,167,239,187,187,13,187,193,193,97,243,163,31,253,40,54,1,120,171,232,
+171,253,62,77,208,170,33,223,13,146,3,95,118,79,198,243,71,109,190,190,190,187,143,233,233,23,110,16,159,246,130,45,124,119,247,154,224,79,102,254,120,196,111,204,71,163,40,143,63,190,177,151,153,49,
+46,188,30,85,155,95,158,240,182,192,143,60,242,191,204,103,62,243,89,115,249,242,215,164,215,48,125,77,116,27,218,4,62,45,208,168,161,223,14,148,19,204,250,78,204,184,128,218,252,242,132,247,225,10,
+15,220,91,140,248,141,253,112,36,69,186,127,221,116,1,93,214,173,91,175,54,159,145,232,113,194,71,48,6,227,211,0,109,154,242,253,96,121,238,79,241,236,119,225,29,129,218,124,182,181,221,230,150,91,
+110,15,26,126,190,216,163,73,83,191,32,46,39,92,240,93,8,143,2,181,249,236,133,7,238,55,70,252,230,126,62,158,242,232,163,79,244,49,14,224,194,208,165,218,252,242,109,222,22,62,130,17,68,95,204,209,
+162,208,138,34,39,190,232,187,32,122,5,106,243,217,136,30,193,222,140,49,226,95,44,180,178,72,95,116,158,254,168,11,221,20,181,249,229,11,15,60,86,125,49,38,246,133,86,151,245,235,31,235,17,42,12,73,
+186,176,144,68,109,190,126,225,129,1,54,95,108,195,152,247,20,242,80,228,66,138,49,23,25,100,175,218,124,58,209,225,230,155,111,11,28,52,46,174,196,188,144,167,210,215,183,97,134,153,66,46,76,34,101,
+226,136,218,252,154,68,162,71,16,19,98,231,139,41,177,46,228,177,200,133,149,124,23,76,207,192,151,4,106,243,55,10,31,137,79,204,98,196,47,21,242,92,36,107,231,200,92,23,59,9,212,230,253,194,3,143,73,
+98,229,139,33,177,45,228,189,200,197,119,9,243,220,132,15,218,4,106,243,126,24,60,139,139,91,24,211,174,66,59,20,185,208,213,194,235,113,55,67,239,160,211,109,222,5,119,172,34,62,177,92,93,104,167,
+178,110,221,250,213,194,60,47,137,124,48,78,208,169,54,111,115,211,77,183,6,21,34,46,78,97,12,219,75,124,43,9,186,132,185,184,155,99,196,16,219,235,36,155,143,68,7,238,135,25,85,85,196,39,118,93,133,
+118,47,15,63,220,87,98,28,59,14,218,5,157,96,243,145,240,192,0,79,181,152,16,179,194,74,42,114,67,51,213,110,152,87,201,12,124,172,84,155,143,224,154,121,252,213,16,127,166,176,18,203,67,15,61,82,20,
+42,44,99,138,131,247,221,237,32,124,26,209,33,106,232,85,187,247,48,54,197,194,74,46,15,62,248,222,30,97,158,89,45,113,208,54,96,189,65,187,219,124,4,237,28,182,110,169,118,207,97,76,122,10,157,82,
+228,102,47,214,8,200,181,41,231,237,102,243,17,209,23,188,106,221,39,177,40,116,98,121,224,129,117,125,194,2,251,234,85,131,68,192,62,121,52,228,217,230,129,223,99,110,36,194,215,186,175,240,222,251,
+10,157,94,36,8,83,9,130,21,64,27,129,225,210,188,9,79,23,150,222,76,210,251,224,158,11,90,222,46,242,220,239,22,102,121,254,39,129,26,198,46,37,81,50,180,194,230,17,29,103,226,90,146,94,119,120,143,
+221,170,120,76,145,198,82,175,112,153,70,83,82,120,68,48,154,70,123,129,161,101,59,33,178,18,157,191,243,8,162,65,135,11,113,206,52,215,24,222,83,175,42,156,46,17,74,41,131,124,13,250,218,88,50,189,9,
+26,99,36,70,212,134,136,18,35,18,153,191,71,203,173,232,109,80,179,113,22,18,138,99,240,189,164,122,175,35,188,7,21,190,222,34,53,173,91,152,17,202,212,186,54,161,28,94,179,90,125,198,201,208,47,92,
+18,42,57,20,189,18,94,91,191,42,213,224,34,141,174,85,194,128,48,43,148,105,132,181,136,114,120,13,92,203,42,85,166,69,165,183,247,61,61,194,132,80,18,22,153,67,223,32,22,195,115,112,174,30,141,124,
+126,19,162,75,232,21,138,194,180,48,43,204,9,11,194,146,112,69,184,42,84,66,174,134,255,182,20,254,204,92,248,59,211,225,49,56,86,151,70,86,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,
+162,69,139,22,45,90,114,83,166,166,166,187,132,94,161,40,76,11,179,194,156,176,32,44,9,87,132,171,66,37,228,106,248,111,75,225,207,204,133,191,51,29,30,131,99,233,80,112,142,5,239,17,38,132,146,176,
+40,152,6,177,24,158,131,115,233,203,160,86,149,11,23,158,95,37,12,8,179,66,89,48,45,162,28,94,3,215,162,175,131,27,93,206,159,127,174,95,184,36,84,4,147,51,42,225,181,233,132,144,140,69,239,22,102,
+132,114,14,69,143,163,28,94,179,78,9,171,183,156,59,247,108,175,80,18,76,61,28,59,118,210,28,56,48,97,138,197,221,102,112,112,36,248,142,30,59,106,179,191,30,219,173,176,8,51,90,147,199,223,217,136,
+129,221,183,248,25,62,185,54,48,48,108,70,71,119,153,253,251,199,205,209,163,207,152,122,175,35,188,7,157,20,154,82,248,203,105,130,124,230,204,5,115,240,224,164,25,25,217,17,124,49,11,49,163,149,182,
+53,22,99,214,92,182,21,45,228,224,88,124,142,101,104,104,212,140,141,29,10,206,153,50,17,46,107,34,84,41,103,207,78,117,11,179,130,73,194,137,19,167,205,174,93,251,130,154,237,46,175,94,174,232,182,
+240,213,224,227,76,59,118,236,49,199,143,159,50,73,175,59,188,71,125,52,216,69,106,211,20,53,42,9,123,247,142,121,69,207,178,182,199,81,109,197,15,201,176,123,247,126,147,244,62,184,103,21,254,204,
+133,62,97,161,86,176,120,158,15,15,23,131,125,242,242,38,60,216,11,65,184,30,218,28,180,27,18,36,1,247,222,153,139,67,79,159,62,127,81,48,213,56,124,248,120,208,24,107,132,232,89,11,239,99,211,166,1,
+51,57,121,204,212,186,79,98,209,73,194,247,8,243,213,2,66,141,167,22,229,177,182,39,17,222,93,52,178,121,243,96,224,8,53,146,128,152,172,236,209,197,83,167,206,21,133,138,96,226,216,190,125,103,176,
+67,86,158,109,62,169,240,54,252,63,61,136,106,247,30,198,102,101,110,17,115,242,228,217,25,193,196,65,159,157,62,120,187,217,124,173,37,99,238,106,34,218,49,251,246,29,52,213,98,65,172,86,154,248,165,
+106,55,188,109,219,246,182,183,249,90,194,187,108,217,178,173,86,18,180,255,54,113,207,60,115,166,75,152,19,140,143,241,241,195,193,215,46,87,138,205,39,17,222,94,106,198,200,35,131,74,113,241,9,99,
+215,213,174,226,175,22,230,227,110,110,231,206,189,43,214,230,107,9,239,194,144,115,149,36,32,134,237,181,85,236,137,19,167,87,11,175,51,90,231,3,203,239,4,155,175,181,216,148,77,44,34,232,41,196,197,
+43,140,229,234,118,17,191,75,152,143,187,25,250,198,157,100,243,181,132,183,225,93,67,149,36,32,166,249,127,28,28,63,126,106,142,177,113,23,250,193,188,168,233,84,155,175,38,124,4,91,209,240,41,56,98,
+229,139,33,177,205,181,248,199,142,157,44,49,136,227,114,228,200,137,160,177,215,233,54,95,77,120,27,186,138,140,130,250,98,73,140,243,42,254,76,82,241,59,217,230,227,68,247,37,1,177,139,73,130,124,
+141,19,136,101,21,177,45,31,188,37,83,155,79,46,252,253,247,191,251,26,76,94,137,139,43,49,207,139,248,61,66,197,119,145,188,182,85,155,79,47,188,13,163,163,49,9,64,204,91,255,238,64,108,106,30,171,
+114,217,186,117,72,109,190,78,209,109,216,0,147,138,228,139,49,177,111,169,248,210,80,185,72,99,197,133,23,58,106,243,245,11,143,232,46,140,157,248,98,141,6,173,18,191,207,119,65,204,216,81,155,207,
+78,120,27,102,28,197,36,65,243,39,149,76,78,30,91,96,178,131,203,134,13,79,170,205,215,97,243,213,96,111,98,160,49,237,139,57,90,52,91,252,41,223,133,48,156,169,54,159,77,109,143,68,119,161,87,21,147,
+4,205,153,99,120,232,208,209,110,193,184,48,59,86,109,190,113,194,71,176,121,53,109,44,159,6,104,211,240,4,152,152,56,50,43,24,23,250,172,106,243,141,21,62,130,184,250,52,64,155,70,139,223,235,59,49,
+93,62,181,249,236,69,119,133,183,161,107,24,147,4,141,91,124,50,62,126,248,50,147,56,108,152,222,20,61,247,213,230,179,175,237,62,248,82,10,63,71,143,203,213,3,141,26,37,126,175,231,100,193,58,58,181,
+249,230,9,111,67,143,203,167,9,90,101,158,0,7,15,78,150,88,127,103,67,191,84,109,190,113,54,31,39,188,13,51,171,92,93,208,42,83,241,199,198,14,117,51,119,205,133,247,251,106,243,205,169,237,62,248,96,
+21,141,111,159,54,104,150,101,2,204,184,39,112,107,191,218,124,115,132,71,116,23,22,201,122,18,32,187,87,198,7,14,76,148,153,183,111,67,43,84,109,190,57,54,31,39,124,4,111,12,93,125,208,44,43,241,251,
+61,7,15,134,37,213,230,155,99,243,213,224,171,104,92,139,79,35,180,91,118,2,236,223,63,126,137,93,50,108,88,176,169,54,223,154,218,110,11,111,195,100,91,87,39,180,91,150,248,210,199,95,37,84,232,235,
+219,48,113,81,109,190,249,194,187,162,219,48,22,227,234,20,106,183,106,57,9,48,224,30,148,110,135,218,124,243,109,190,26,124,224,18,120,31,227,73,130,129,186,19,96,239,222,177,89,70,155,108,120,227,
+167,54,223,26,155,143,19,62,130,55,133,174,94,104,184,156,4,40,187,7,164,223,169,54,223,26,155,247,137,110,195,112,188,39,1,234,235,13,236,217,115,160,71,48,54,244,253,213,230,91,107,243,113,220,123,
+239,125,1,140,9,184,186,161,101,61,9,48,225,30,136,93,59,212,230,91,107,243,113,194,71,240,136,246,36,192,68,234,4,144,218,94,162,198,219,176,118,77,109,254,93,45,175,237,62,225,35,120,68,187,186,161,
+101,234,4,16,43,89,196,78,108,216,97,83,109,190,245,54,31,199,61,247,188,51,208,195,213,13,45,211,138,223,229,57,200,13,214,175,54,223,26,155,247,9,31,193,207,251,180,67,211,196,9,32,125,253,94,250,
+251,54,236,211,167,54,159,15,155,247,9,111,195,26,2,87,63,52,77,147,0,69,247,0,52,46,212,230,239,207,85,109,143,131,215,244,158,4,72,190,150,112,199,142,61,211,140,42,217,208,0,84,155,207,175,240,119,
+223,221,115,13,26,130,174,126,104,154,56,1,138,197,221,179,108,179,110,195,248,191,218,124,126,108,222,39,124,4,111,106,93,253,208,52,77,2,204,185,7,96,11,118,181,249,252,216,188,79,248,8,218,105,158,
+4,72,190,187,200,232,232,174,5,118,174,178,225,109,147,218,124,126,108,222,199,218,181,239,8,32,94,174,126,104,154,38,1,150,220,3,240,246,79,109,62,63,54,239,19,62,130,235,246,36,192,82,226,4,216,190,
+125,231,21,150,31,217,96,43,106,243,249,177,121,159,240,17,28,223,213,15,77,19,39,192,200,200,142,171,124,126,197,166,150,240,106,243,173,169,237,113,184,250,161,105,154,4,168,184,7,80,155,207,183,
+240,119,221,117,239,117,120,18,160,146,56,1,134,135,139,21,70,254,108,212,230,243,101,243,113,194,71,184,250,161,105,154,4,184,234,75,0,181,249,252,216,124,156,240,192,255,123,18,32,249,35,96,104,104,
+244,10,31,55,176,161,13,160,54,159,47,155,119,185,243,206,123,2,56,150,171,31,154,38,78,128,109,219,182,47,241,66,193,134,94,128,218,124,190,108,222,21,62,130,235,118,245,67,211,52,9,176,224,30,128,
+113,0,181,249,252,216,188,79,248,8,98,228,73,128,228,3,65,131,131,35,115,76,255,178,97,36,80,109,254,190,220,213,118,31,84,82,87,63,52,77,147,0,179,238,1,120,23,208,233,54,207,185,198,199,39,205,161,
+67,71,130,32,231,73,248,59,238,184,251,26,76,220,241,36,64,242,151,65,3,3,195,211,44,255,178,225,21,99,39,219,252,211,79,111,54,191,250,213,175,204,155,111,190,25,176,184,184,104,14,30,156,104,153,
+205,251,132,143,224,75,44,174,126,104,154,56,1,182,110,29,42,178,239,143,13,43,80,59,217,230,191,249,205,111,93,19,223,230,227,31,255,68,75,108,222,39,124,4,149,213,213,15,77,211,36,64,175,123,0,182,
+130,233,228,214,252,210,210,146,55,1,224,31,254,97,46,216,174,165,21,181,221,102,205,154,181,1,172,16,242,36,64,242,41,97,91,182,108,235,226,179,102,46,174,245,119,82,107,254,167,63,253,89,108,2,192,
+127,253,215,146,57,114,228,120,75,133,7,126,222,167,29,154,166,154,25,44,191,176,232,30,132,174,96,167,182,230,39,38,14,87,77,128,136,23,95,252,92,83,108,222,21,62,130,248,122,196,95,76,189,46,96,243,
+230,193,18,19,65,109,232,9,116,242,160,77,177,184,211,252,235,191,254,162,102,18,252,232,71,255,219,108,220,216,223,240,218,238,131,74,234,234,134,150,169,19,96,211,166,129,9,54,29,176,121,236,177,
+247,117,252,160,13,221,191,47,125,233,203,137,220,224,212,169,51,77,19,254,246,219,239,10,224,99,148,174,110,104,89,79,2,244,184,7,234,239,223,170,131,54,33,83,83,207,39,74,130,191,254,235,217,224,92,
+141,22,62,130,189,155,60,9,80,223,151,69,68,240,50,162,219,48,200,160,99,243,111,213,234,173,91,183,153,249,249,249,154,73,192,207,108,217,50,152,153,232,62,225,129,248,187,122,161,97,221,251,3,200,
+47,207,186,7,100,125,160,142,205,191,13,231,166,150,39,113,131,11,23,158,205,180,182,187,48,92,239,73,128,250,55,136,16,59,25,192,82,108,232,99,234,216,252,141,141,186,147,39,79,155,255,247,255,254,
+95,205,36,248,210,151,94,149,158,212,187,50,21,254,182,219,238,12,224,243,124,174,94,104,184,156,4,88,37,84,220,131,242,106,88,95,193,222,248,60,127,223,251,158,54,63,252,225,143,106,38,1,61,137,225,
+225,209,204,132,7,226,238,17,31,237,234,223,36,138,242,212,83,155,47,49,10,104,195,71,13,245,21,108,124,163,238,211,159,126,49,209,35,225,133,23,102,82,139,238,10,31,193,106,32,87,39,180,91,246,62,
+129,27,55,110,234,103,177,161,11,61,1,125,5,27,223,154,159,156,60,98,254,235,191,254,171,102,18,92,190,252,181,192,81,235,17,61,130,243,249,52,66,187,76,118,11,149,3,149,221,131,211,224,232,68,155,79,
+211,133,235,235,123,212,124,251,219,223,169,153,4,191,249,205,191,155,93,187,246,166,22,30,110,189,245,142,96,186,158,71,252,108,182,138,165,72,195,111,134,198,159,13,131,66,157,108,243,105,90,243,31,
+251,216,95,36,122,36,92,188,248,145,84,194,71,240,34,202,213,7,205,178,76,128,110,207,9,130,49,129,78,182,249,52,221,184,125,251,198,204,111,127,187,88,51,9,254,254,239,191,41,207,243,247,214,20,61,
+34,250,146,152,135,108,63,32,245,228,147,79,151,216,35,192,134,37,227,157,110,243,105,6,109,24,167,255,250,215,191,81,51,9,126,255,251,223,155,177,177,241,170,194,71,48,244,235,234,130,86,153,127,49,
+68,250,152,189,244,51,93,112,1,181,249,116,93,184,247,191,255,131,137,30,9,31,250,208,135,171,138,79,237,247,105,130,86,13,249,110,144,28,248,178,123,50,158,63,106,243,233,251,238,219,183,239,48,191,
+252,229,47,107,38,193,163,143,62,126,131,240,221,221,107,130,63,153,249,227,17,191,49,31,141,162,60,254,248,198,94,166,134,185,240,225,8,181,249,244,221,56,106,240,151,191,124,169,106,2,140,143,31,
+186,38,186,13,45,127,159,22,104,212,208,111,7,202,9,102,125,39,102,92,64,109,190,190,110,220,212,212,115,177,9,240,212,83,155,110,16,159,123,139,17,191,177,31,142,164,72,247,175,155,46,160,203,186,
+117,235,213,230,235,232,194,69,240,182,240,255,252,159,127,190,78,252,151,95,158,189,65,124,96,12,198,167,1,218,52,229,251,193,242,220,159,226,217,239,194,136,150,218,124,58,225,109,184,206,115,231,
+166,204,39,63,249,41,115,240,224,161,27,132,191,229,150,219,131,199,134,47,246,104,210,212,47,136,203,9,23,124,23,194,163,64,109,62,157,240,190,90,238,10,15,220,111,140,248,205,253,124,60,229,209,71,
+159,232,99,28,192,133,121,131,106,243,181,69,79,35,124,4,11,62,124,49,71,139,66,43,138,156,248,162,239,130,232,21,168,205,103,35,122,4,123,51,198,136,127,177,208,202,34,125,209,121,250,163,46,116,83,
+212,230,151,47,60,240,88,245,197,152,216,23,90,93,214,175,127,172,71,168,48,36,233,194,66,18,181,249,250,133,7,6,216,124,177,13,99,222,83,200,67,145,11,41,198,92,100,144,189,106,243,233,68,135,155,
+111,190,45,112,208,184,184,18,243,66,158,74,95,223,134,25,102,10,185,48,137,148,137,35,106,243,107,18,137,30,65,76,136,157,47,166,196,186,144,199,34,23,86,242,93,48,61,3,95,18,168,205,223,40,124,36,
+62,49,139,17,191,84,200,115,145,172,157,35,115,93,236,36,80,155,247,11,15,60,38,137,149,47,134,196,182,144,247,34,23,223,37,204,115,19,62,104,19,168,205,251,97,240,44,46,110,97,76,187,10,237,80,228,
+66,87,11,175,199,221,12,189,131,78,183,121,23,220,177,138,248,196,114,117,161,157,202,186,117,235,87,11,243,188,36,242,193,56,65,167,218,188,205,77,55,221,26,84,136,184,56,133,49,108,47,241,173,36,
+232,18,230,226,110,142,17,67,108,175,147,108,62,18,29,184,31,102,84,85,17,159,216,117,21,218,189,60,252,112,95,137,113,236,56,104,23,116,130,205,71,194,3,3,60,213,98,66,204,10,43,169,200,13,205,84,
+187,97,94,37,51,240,177,82,109,62,130,107,230,241,87,67,252,153,194,74,44,15,61,244,72,81,168,176,140,41,14,222,119,183,131,240,105,68,135,168,161,87,237,222,195,216,20,11,43,185,60,248,224,123,123,
+132,121,102,181,196,65,219,128,245,6,237,110,243,17,180,115,152,18,94,237,158,195,152,244,20,58,165,200,205,94,172,17,144,107,83,206,219,205,230,35,162,47,120,213,186,79,98,81,232,196,242,192,3,235,
+250,132,5,193,84,131,68,192,62,121,52,228,217,230,129,223,99,110,36,194,215,186,175,240,222,251,10,157,94,36,8,83,9,130,21,64,27,129,225,210,188,9,79,23,150,222,76,210,251,224,158,11,90,222,46,242,
+220,239,22,102,121,254,39,129,26,198,46,37,81,50,180,194,230,17,29,103,226,90,146,94,119,120,143,221,170,120,76,145,198,82,175,112,153,70,83,82,120,68,48,154,70,123,129,161,101,59,33,178,18,157,191,
+243,8,162,65,135,11,113,206,52,215,24,222,83,175,42,156,46,17,74,41,131,124,13,250,218,88,50,189,9,26,99,36,70,212,134,136,18,35,18,153,191,71,203,173,232,109,80,179,113,22,18,138,99,240,189,164,122,
+175,35,188,7,21,190,222,34,53,173,91,152,17,202,212,186,54,161,28,94,179,90,125,198,201,208,47,92,18,42,57,20,189,18,94,91,191,42,213,224,34,141,174,85,194,128,48,43,148,105,132,181,136,114,120,13,92,
+203,42,85,166,69,165,183,247,61,61,194,132,80,18,22,153,67,223,32,22,195,115,112,174,30,141,124,126,19,162,75,232,21,138,194,180,48,43,204,9,11,194,146,112,69,184,42,84,66,174,134,255,182,20,254,204,
+92,248,59,211,225,49,56,86,151,70,86,139,22,45,90,180,104,209,162,69,139,22,45,90,180,104,209,162,69,139,22,45,90,114,83,166,166,166,187,132,94,161,40,76,11,179,194,156,176,32,44,9,87,132,171,66,37,
+228,106,248,111,75,225,207,204,133,191,51,29,30,131,99,233,80,112,142,5,239,17,38,132,146,176,40,152,6,177,24,158,131,115,233,203,160,86,149,11,23,158,95,37,12,8,179,66,89,48,45,162,28,94,3,215,162,
+175,131,27,93,206,159,127,174,95,184,36,84,4,147,51,42,225,181,233,132,144,140,69,239,22,102,132,114,14,69,143,163,28,94,179,78,9,171,183,156,59,247,108,175,80,18,76,61,28,59,118,210,28,56,48,97,138,
+197,221,102,112,112,36,248,142,30,59,106,179,191,30,219,173,176,8,51,90,147,199,223,217,136,129,221,183,248,25,62,185,54,48,48,108,70,71,119,153,253,251,199,205,209,163,207,152,122,175,35,188,7,157,
+20,154,82,248,203,105,130,124,230,204,5,115,240,224,164,25,25,217,17,124,49,11,49,163,149,182,53,22,99,214,92,182,21,45,228,224,88,124,142,101,104,104,212,140,141,29,10,206,153,50,17,46,107,34,84,41,
+103,207,78,117,11,179,130,73,194,137,19,167,205,174,93,251,130,154,237,46,175,94,174,232,182,240,213,224,227,76,59,118,236,49,199,143,159,50,73,175,59,188,71,125,52,216,69,106,211,20,53,42,9,123,247,
+142,121,69,207,178,182,199,81,109,197,15,201,176,123,247,126,147,244,62,184,103,21,254,204,133,62,97,161,86,176,120,158,15,15,23,131,125,242,242,38,60,216,11,65,184,30,218,28,180,27,18,36,1,247,222,
+153,139,67,79,159,62,127,81,48,213,56,124,248,120,208,24,107,132,232,89,11,239,99,211,166,1,51,57,121,204,212,186,79,98,209,73,194,247,8,243,213,2,66,141,167,22,229,177,182,39,17,222,93,52,178,121,
+243,96,224,8,53,146,128,152,172,236,209,197,83,167,206,21,133,138,96,226,216,190,125,103,176,67,86,158,109,62,169,240,54,252,63,61,136,106,247,30,198,102,101,110,17,115,242,228,217,25,193,196,65,159,
+157,62,120,187,217,124,173,37,99,238,106,34,218,49,251,246,29,52,213,98,65,172,86,154,248,165,106,55,188,109,219,246,182,183,249,90,194,187,108,217,178,173,86,18,180,255,54,113,207,60,115,166,75,152,
+19,140,143,241,241,195,193,215,46,87,138,205,39,17,222,94,106,198,200,35,131,74,113,241,9,99,215,213,174,226,175,22,230,227,110,110,231,206,189,43,214,230,107,9,239,194,144,115,149,36,32,134,237,181,
+85,236,137,19,167,87,11,175,51,90,231,3,203,239,4,155,175,181,216,148,77,44,254,255,246,206,237,55,142,42,207,227,253,7,248,197,143,121,6,156,251,141,30,30,50,234,145,134,75,6,71,36,144,9,227,36,190,
+38,105,67,18,18,199,142,115,37,132,75,204,226,69,30,161,104,208,206,176,203,34,180,15,253,210,2,135,13,172,52,171,129,245,14,176,130,153,241,11,154,181,134,89,86,102,246,197,66,50,121,202,107,30,186,
+246,247,41,234,152,195,201,169,234,170,118,119,87,181,235,28,233,163,68,137,93,151,223,247,87,223,58,247,82,208,82,8,139,87,16,203,117,157,34,126,183,48,31,118,51,180,141,243,100,243,245,132,215,97,
+172,33,34,9,136,105,246,95,7,151,46,61,55,71,223,184,9,237,96,6,106,242,106,243,81,194,43,216,138,134,79,193,17,43,91,12,137,109,166,197,191,120,241,74,149,78,28,147,243,231,47,251,149,189,188,219,
+124,148,240,58,52,21,233,5,181,197,146,24,103,85,252,153,184,226,231,217,230,195,68,183,37,1,177,11,73,130,108,245,19,136,101,149,177,45,27,140,146,57,155,143,47,252,174,93,63,89,129,201,43,97,113,37,
+230,89,17,191,40,212,108,23,201,176,173,179,249,228,194,235,208,59,26,146,0,196,60,253,177,3,177,169,121,172,202,164,191,127,216,217,124,131,162,235,176,1,38,15,146,45,198,196,62,85,241,165,162,114,
+157,202,138,9,3,58,206,230,27,23,30,209,77,232,59,177,197,26,13,210,18,191,215,118,65,204,216,113,54,223,60,225,117,152,113,20,146,4,237,159,84,50,57,121,113,129,201,14,38,123,247,238,119,54,223,128,
+205,71,193,222,196,64,101,218,22,115,180,104,183,248,83,182,11,161,59,211,217,124,115,158,118,37,186,9,173,170,144,36,104,207,28,195,179,103,47,244,8,158,9,179,99,157,205,183,78,120,5,155,87,83,199,
+178,105,128,54,45,79,128,137,137,243,21,193,51,161,205,234,108,190,181,194,43,136,171,77,3,180,105,181,248,37,219,137,105,242,57,155,111,190,232,166,240,58,52,13,67,146,160,117,139,79,198,199,207,221,
+100,18,135,14,211,155,212,123,223,217,124,243,159,118,27,124,41,133,159,163,197,101,234,129,70,173,18,191,100,57,153,191,142,206,217,124,251,132,215,161,197,101,211,4,173,154,158,0,103,206,76,86,89,
+127,167,67,187,212,217,124,235,108,62,76,120,29,102,86,153,186,160,85,83,197,31,27,59,219,195,220,53,19,198,247,157,205,183,231,105,183,193,7,171,168,124,219,180,65,179,102,38,192,140,121,2,243,233,
+119,54,223,30,225,17,221,132,69,178,150,4,104,222,144,241,233,211,19,203,204,219,215,161,22,234,108,190,61,54,31,38,188,130,17,67,83,31,52,107,150,248,125,150,131,251,221,146,206,230,219,99,243,81,
+240,85,52,174,197,166,17,218,173,58,1,78,157,26,159,101,151,12,29,22,108,58,155,79,231,105,215,133,215,97,178,173,169,19,218,173,74,124,105,227,119,9,53,218,250,58,76,92,116,54,223,126,225,77,209,117,
+232,139,49,117,10,180,235,90,77,2,12,152,7,165,217,225,108,190,253,54,31,5,31,184,4,198,99,44,73,48,208,112,2,156,60,57,86,161,183,73,135,17,63,103,243,233,216,124,152,240,10,70,10,77,189,208,112,53,
+9,176,108,30,144,118,167,179,249,116,108,222,38,186,14,221,241,150,4,104,172,53,112,226,196,233,162,224,233,208,246,119,54,159,174,205,135,177,115,231,3,62,244,9,152,186,161,101,35,9,48,97,30,136,93,
+59,156,205,167,107,243,97,194,43,120,69,91,18,96,34,113,2,200,211,94,229,137,215,97,237,154,179,249,31,167,254,180,219,132,87,240,138,54,117,67,203,196,9,32,86,178,136,157,232,176,195,166,179,249,244,
+109,62,140,29,59,126,228,235,97,234,134,150,73,197,239,182,28,228,46,235,119,54,159,142,205,219,132,87,240,243,54,237,208,52,118,2,72,91,191,68,123,95,135,125,250,156,205,103,195,230,109,194,235,176,
+134,192,212,15,77,147,36,64,217,60,0,149,11,103,243,187,50,245,180,135,193,48,189,37,1,226,175,37,28,29,61,49,77,175,146,14,21,64,103,243,217,21,126,251,246,226,10,84,4,77,253,208,52,118,2,148,203,
+199,43,108,179,174,67,255,191,179,249,236,216,188,77,120,5,35,181,166,126,104,154,36,1,230,204,3,176,5,187,179,249,236,216,188,77,120,5,245,52,75,2,196,223,93,228,216,177,167,23,216,185,74,135,209,38,
+103,243,217,177,121,27,219,182,221,239,67,188,76,253,208,52,73,2,44,153,7,96,244,207,217,124,118,108,222,38,188,130,235,182,36,192,82,236,4,56,122,244,169,219,44,63,210,193,86,156,205,103,199,230,109,
+194,43,56,190,169,31,154,198,78,128,35,71,70,239,240,249,21,157,122,194,59,155,79,231,105,15,195,212,15,77,147,36,64,205,60,128,179,249,108,11,191,117,235,206,31,96,73,128,90,236,4,24,25,41,215,232,
+249,211,113,54,159,45,155,15,19,94,97,234,135,166,73,18,224,142,45,1,156,205,103,199,230,195,132,7,254,223,146,0,241,95,1,195,195,199,110,243,113,3,29,234,0,206,230,179,101,243,38,91,182,236,240,225,
+88,166,126,104,26,59,1,134,134,142,46,49,160,160,67,43,192,217,124,182,108,222,20,94,193,117,155,250,161,105,146,4,88,48,15,64,63,128,179,249,236,216,188,77,120,5,49,178,36,64,252,142,160,193,193,35,
+115,76,255,210,161,39,208,217,252,3,153,123,218,109,240,144,154,250,161,105,146,4,168,152,7,96,44,192,217,124,118,133,223,188,121,251,10,76,220,177,36,64,252,193,160,129,129,145,105,150,127,233,48,
+196,152,119,155,31,31,159,244,94,122,105,202,235,235,59,156,186,205,219,132,87,240,37,22,83,63,52,141,157,0,253,253,195,101,246,253,209,97,5,106,94,109,158,235,254,248,227,79,188,91,183,110,173,240,
+203,95,190,150,170,205,219,132,87,240,176,154,250,161,105,146,4,40,153,7,96,43,152,188,218,252,235,175,255,195,15,196,87,188,253,246,191,164,102,243,54,54,109,218,230,195,10,33,75,2,196,159,18,118,
+248,240,80,55,159,53,51,49,173,63,47,181,249,223,254,246,223,173,9,0,239,191,255,129,127,175,89,16,30,248,121,155,118,104,154,104,102,176,252,194,162,121,16,154,130,121,172,205,191,249,230,91,161,9,0,
+159,125,246,185,216,238,190,182,218,188,41,188,130,248,90,196,95,76,188,46,224,208,161,193,42,19,65,117,104,9,228,177,54,79,165,106,97,97,33,50,9,190,250,234,43,111,100,228,88,91,159,118,27,60,164,
+166,110,104,153,56,1,14,30,28,152,96,211,1,157,125,251,126,158,219,78,27,230,217,253,254,247,31,71,38,1,76,78,94,72,69,248,141,27,183,250,240,49,74,83,55,180,108,36,1,138,230,129,250,250,250,115,221,
+105,179,99,71,209,123,247,221,217,186,73,48,61,253,106,75,109,222,38,188,130,189,155,44,9,208,216,151,69,68,240,101,68,215,161,147,33,239,157,54,111,188,241,79,117,147,224,205,55,255,185,101,162,219,
+132,7,226,111,234,133,134,13,239,15,32,191,92,49,15,200,250,64,215,55,191,211,123,249,229,233,186,73,112,227,198,123,254,185,91,245,180,155,208,93,111,73,128,198,55,136,16,59,25,192,82,116,104,99,186,
+190,249,239,160,103,240,219,111,191,141,76,130,79,62,249,84,42,145,143,182,84,248,13,27,182,248,240,121,62,83,47,52,92,77,2,116,9,53,243,160,12,13,187,190,249,239,158,234,254,254,33,239,203,47,191,
+140,76,130,191,252,229,75,105,138,13,54,197,230,109,194,3,113,183,136,143,118,141,111,18,69,121,242,201,67,179,244,2,234,240,81,67,55,4,251,61,187,119,239,241,62,253,244,191,34,147,0,167,24,27,155,88,
+181,232,166,240,10,90,41,166,78,104,183,234,125,2,15,28,56,216,199,98,67,19,90,2,110,8,246,123,184,142,27,55,254,181,110,189,224,218,181,151,87,253,180,155,224,40,54,141,208,174,41,187,133,202,129,
+150,205,131,83,225,112,67,176,119,191,207,235,245,26,194,175,127,253,70,83,132,135,245,235,55,251,211,245,44,226,55,103,171,88,138,84,252,102,168,252,233,208,41,148,183,153,54,113,107,243,175,188,242,
+247,117,147,160,90,125,39,50,1,226,8,175,224,187,1,166,62,104,214,204,4,232,177,156,192,239,19,200,147,205,39,105,198,157,61,123,174,110,18,204,205,253,167,31,195,70,68,87,168,47,137,89,104,238,7,164,
+246,239,255,69,149,61,2,116,88,50,158,71,155,143,91,155,31,28,28,241,190,250,234,127,35,147,224,207,127,254,111,177,235,190,196,194,43,232,250,53,117,65,171,166,127,49,68,218,152,37,218,153,38,100,
+112,30,109,62,110,109,158,1,180,207,62,251,44,50,9,190,249,230,27,239,196,137,103,18,9,175,158,126,155,38,104,213,146,239,6,201,129,111,154,39,227,253,147,87,155,143,91,155,191,255,254,7,188,155,55,
+223,175,251,74,184,122,245,197,186,162,67,79,207,38,255,79,102,254,88,196,111,205,71,163,40,143,63,126,160,196,212,48,19,62,28,145,87,155,79,82,155,127,235,173,183,235,38,193,175,126,245,122,168,232,
+58,212,252,109,90,160,81,75,191,29,40,39,168,216,78,76,191,64,94,109,62,73,51,238,213,87,103,98,12,36,189,21,42,60,112,111,33,226,183,246,195,145,20,105,254,245,208,4,52,161,55,44,207,54,159,164,9,
+199,156,129,122,73,192,90,76,155,248,64,31,140,77,3,180,105,203,247,131,229,189,63,197,187,223,132,49,130,188,219,124,220,218,252,240,240,81,239,235,175,191,14,77,128,189,123,159,184,75,248,251,238,
+219,232,87,252,108,177,71,147,182,126,65,92,78,184,96,187,16,94,5,121,183,249,184,181,249,222,222,199,188,63,254,241,79,119,137,255,215,191,254,207,93,194,3,247,27,34,126,123,63,31,79,121,236,177,39,
+122,233,7,48,161,217,227,108,126,75,236,218,60,173,167,15,62,248,183,21,241,255,246,183,255,243,70,71,143,255,64,120,5,115,19,109,49,71,139,66,26,69,78,124,221,118,65,180,10,156,205,111,142,85,155,87,
+236,223,255,164,55,52,116,196,191,15,83,120,96,111,198,16,241,175,23,210,44,210,22,157,167,61,106,66,51,197,217,124,125,225,77,155,183,193,107,213,22,99,98,95,72,187,236,217,179,175,40,212,232,146,52,
+97,33,137,179,249,198,133,7,94,17,182,216,6,49,47,22,178,80,228,66,202,33,23,121,215,170,153,60,219,124,92,209,225,222,123,55,248,14,26,22,87,98,94,200,82,233,237,221,59,195,76,33,19,38,145,50,113,
+196,217,252,166,88,162,43,136,9,177,179,197,148,88,23,178,88,228,194,170,182,11,166,101,96,75,2,103,243,119,11,175,196,39,102,33,226,87,11,89,46,146,181,115,100,174,137,158,4,206,230,237,194,3,175,73,
+98,101,139,33,177,45,100,189,200,197,119,11,243,220,132,13,234,4,206,230,237,208,121,22,22,183,32,166,221,133,78,40,114,161,235,132,47,194,110,134,214,65,222,109,222,4,119,140,16,159,88,174,43,116,82,
+217,189,123,207,58,97,158,65,34,27,244,19,228,213,230,117,238,185,103,189,255,64,132,197,41,136,97,103,137,175,37,65,183,48,23,118,115,244,24,98,123,121,178,121,37,58,112,63,204,168,138,16,159,216,
+117,23,58,189,60,242,72,111,149,126,236,48,168,23,228,193,230,149,240,64,7,79,84,76,136,89,97,45,21,185,161,153,168,27,102,40,153,142,143,181,106,243,10,174,153,215,95,29,241,103,10,107,177,60,252,
+240,163,101,161,198,50,166,48,24,239,238,4,225,147,136,14,170,162,23,117,239,65,108,202,133,181,92,30,122,232,103,69,97,158,89,45,97,80,55,96,189,65,167,219,188,130,122,14,91,183,68,221,115,16,147,98,
+33,47,69,110,246,122,157,128,172,76,57,239,52,155,87,168,47,120,213,187,79,98,81,200,99,121,240,193,221,189,194,130,224,69,65,34,96,159,188,26,178,108,243,192,239,49,55,18,225,235,221,87,112,239,189,
+133,188,23,9,194,84,140,96,249,80,71,160,187,52,107,194,211,132,165,53,19,247,62,184,231,130,43,223,23,121,239,247,8,21,222,255,113,224,9,99,151,18,149,12,105,216,60,162,227,76,92,75,220,235,14,238,
+177,199,41,30,82,164,178,84,18,110,82,105,138,11,175,8,122,211,168,47,208,181,172,39,68,179,68,231,239,188,130,168,208,225,66,156,51,201,53,6,247,84,114,10,39,75,132,106,194,32,175,64,91,27,75,166,53,
+65,101,140,196,80,117,8,149,24,74,100,254,174,150,91,209,218,224,201,198,89,72,40,142,193,28,253,70,175,35,184,7,39,124,163,69,158,180,30,97,70,88,230,169,235,16,150,131,107,118,86,223,228,100,232,19,
+102,133,90,6,69,175,5,215,214,231,148,106,113,145,74,87,151,48,32,84,132,101,42,97,41,177,28,92,3,215,210,229,148,73,169,148,74,63,45,10,19,66,85,88,100,14,125,139,88,12,206,193,185,138,46,242,217,77,
+136,110,161,36,148,133,105,161,34,204,9,11,194,146,112,91,184,35,212,2,238,4,255,182,20,252,204,92,240,59,211,193,49,56,86,183,139,172,43,174,184,226,138,43,174,184,226,138,43,174,184,226,138,43,174,
+184,226,138,43,174,184,226,74,102,202,212,212,116,183,80,18,202,194,180,80,17,230,132,5,97,73,184,45,220,17,106,1,119,130,127,91,10,126,102,46,248,157,233,224,24,28,203,117,5,103,88,240,162,48,33,84,
+133,69,193,107,17,139,193,57,56,151,27,12,74,171,92,187,246,74,151,48,32,84,132,101,193,75,137,229,224,26,184,22,55,28,220,234,242,210,75,127,215,39,204,10,53,193,203,24,181,224,218,220,132,144,38,
+139,222,35,204,8,203,25,20,61,140,229,224,154,221,148,176,70,203,139,47,190,92,18,170,130,215,8,23,47,94,241,78,159,158,240,202,229,227,222,224,224,17,255,59,122,236,168,205,254,122,108,183,194,34,76,
+181,38,143,191,179,17,3,187,111,241,51,124,114,109,96,96,196,59,118,236,105,239,212,169,113,239,194,133,103,189,70,175,35,184,7,55,41,52,161,240,55,147,4,249,249,231,175,121,103,206,76,122,71,142,140,
+250,95,204,66,76,181,210,182,206,98,204,186,203,182,212,66,14,142,197,231,88,134,135,143,121,99,99,103,253,115,38,76,132,155,46,17,34,202,11,47,76,245,8,21,193,139,195,229,203,87,189,167,159,126,198,
+127,178,205,229,213,171,21,93,23,62,10,62,206,52,58,122,194,187,116,233,57,47,238,117,7,247,232,94,13,122,145,167,105,138,39,42,14,39,79,142,89,69,111,230,211,30,70,212,138,31,146,225,248,241,83,94,
+220,251,224,158,157,240,207,95,235,21,22,234,5,139,247,249,200,72,217,223,39,47,107,194,131,190,16,132,235,161,206,65,189,33,70,18,112,239,249,92,28,122,245,234,75,215,5,47,138,115,231,46,249,149,177,
+86,136,222,108,225,109,28,60,56,224,77,78,94,244,234,221,39,177,200,147,240,69,97,62,42,32,60,241,60,69,89,124,218,227,8,111,46,26,57,116,104,208,119,132,58,73,64,76,214,118,239,226,115,207,189,88,22,
+106,130,23,198,209,163,79,249,59,100,101,217,230,227,10,175,195,255,211,130,136,186,247,32,54,107,115,139,152,43,87,94,152,17,188,48,104,179,211,6,239,52,155,175,183,100,204,92,77,68,61,230,153,103,
+206,120,81,177,32,86,107,77,252,106,212,13,15,13,29,237,120,155,175,39,188,201,225,195,67,245,146,160,243,183,137,123,246,217,231,187,133,57,193,179,49,62,126,206,255,218,229,90,177,249,56,194,235,75,
+205,232,121,164,83,41,44,62,65,236,186,59,85,252,117,194,124,216,205,61,245,212,201,53,107,243,245,132,55,161,203,57,34,9,136,97,103,109,21,123,249,242,213,117,194,23,244,214,217,192,242,243,96,243,
+245,22,155,178,137,133,130,150,66,88,188,130,88,174,235,20,241,187,133,249,176,155,161,109,156,39,155,175,39,188,14,99,13,17,73,64,76,179,255,58,184,116,233,185,57,250,198,77,104,7,51,80,147,87,155,
+143,18,94,193,86,52,124,10,142,88,217,98,72,108,51,45,254,197,139,87,170,116,226,152,156,63,127,217,175,236,229,221,230,163,132,215,161,169,72,47,168,45,150,196,56,171,226,207,196,21,63,207,54,31,38,
+186,45,9,136,93,72,18,100,171,159,64,44,171,140,109,217,96,148,204,217,124,124,225,119,237,250,201,10,76,94,9,139,43,49,207,138,248,69,161,102,187,72,134,109,157,205,39,23,94,135,222,209,144,4,32,230,
+233,143,29,136,77,205,99,85,38,253,253,195,206,230,27,20,93,135,13,48,121,144,108,49,38,246,169,138,47,21,149,235,84,86,76,24,208,113,54,223,184,240,136,110,66,223,137,45,214,104,144,150,248,189,182,
+11,98,198,142,179,249,230,9,175,195,140,163,144,36,104,255,164,146,201,201,139,11,76,118,48,217,187,119,191,179,249,6,108,62,10,246,38,6,42,211,182,152,163,69,187,197,159,178,93,8,221,153,206,230,155,
+243,180,43,209,77,104,85,133,36,65,123,230,24,158,61,123,161,71,240,76,152,29,235,108,190,117,194,43,216,188,154,58,150,77,3,180,105,121,2,76,76,156,175,8,158,9,109,86,103,243,173,21,94,65,92,109,26,
+160,77,171,197,47,217,78,76,147,207,217,124,243,69,55,133,215,161,105,24,146,4,173,91,124,50,62,126,238,38,147,56,116,152,222,164,222,251,206,230,155,255,180,219,224,75,41,252,28,45,46,83,15,52,106,
+149,248,37,203,201,252,117,116,206,230,219,39,188,14,45,46,155,38,104,213,244,4,56,115,102,178,202,250,59,29,218,165,206,230,91,103,243,97,194,235,48,179,202,212,5,173,154,42,254,216,216,217,30,230,
+174,153,48,190,239,108,190,61,79,187,13,62,88,69,229,219,166,13,154,53,51,1,102,204,19,152,79,191,179,249,246,8,143,232,38,44,146,181,36,64,243,134,140,79,159,158,88,102,222,190,14,181,80,103,243,237,
+177,249,48,225,21,140,24,154,250,160,89,179,196,239,179,28,220,239,150,116,54,223,30,155,143,130,175,162,113,45,54,141,208,110,213,9,112,234,212,248,44,187,100,232,176,96,211,217,124,58,79,187,46,188,
+14,147,109,77,157,208,110,85,226,75,27,191,75,168,209,214,215,97,226,162,179,249,246,11,111,138,174,67,95,140,169,83,160,93,215,106,18,96,192,60,40,205,14,103,243,237,183,249,40,248,192,37,48,30,99,
+73,130,129,134,19,224,228,201,177,10,189,77,58,140,248,57,155,79,199,230,195,132,87,48,82,104,234,133,134,171,73,128,101,243,128,180,59,157,205,167,99,243,54,209,117,232,142,183,36,64,99,173,129,19,
+39,78,23,5,79,135,182,191,179,249,116,109,62,140,157,59,31,240,161,79,192,212,13,45,27,73,128,9,243,64,236,218,225,108,62,93,155,15,19,94,193,43,218,146,0,19,137,19,64,158,246,42,79,188,14,107,215,
+156,205,255,56,245,167,221,38,188,130,87,180,169,27,90,38,78,0,177,146,69,236,68,135,29,54,157,205,167,111,243,97,236,216,241,35,95,15,83,55,180,76,42,126,183,229,32,119,89,191,179,249,116,108,222,38,
+188,130,159,183,105,135,166,177,19,64,218,250,37,218,251,58,236,211,231,108,62,27,54,111,19,94,135,53,4,166,126,104,154,36,1,202,230,1,168,92,56,155,223,149,169,167,61,12,134,233,45,9,16,127,45,225,
+232,232,137,105,122,149,116,168,0,58,155,207,174,240,219,183,23,87,160,34,104,234,135,166,177,19,160,92,62,94,97,155,117,29,250,255,157,205,103,199,230,109,194,43,24,169,53,245,67,211,36,9,48,103,30,
+128,45,216,157,205,103,199,230,109,194,43,168,167,89,18,32,254,238,34,199,142,61,189,192,206,85,58,140,54,57,155,207,142,205,219,216,182,237,126,31,226,101,234,135,166,73,18,96,201,60,0,163,127,206,
+230,179,99,243,54,225,21,92,183,37,1,150,98,39,192,209,163,79,221,102,249,145,14,182,226,108,62,59,54,111,19,94,193,241,77,253,208,52,118,2,28,57,50,122,135,207,175,232,212,19,222,217,124,58,79,123,
+24,166,126,104,154,36,1,106,230,1,156,205,103,91,248,173,91,119,254,0,75,2,212,98,39,192,200,72,185,70,207,159,142,179,249,108,217,124,152,240,10,83,63,52,77,146,0,119,108,9,224,108,62,59,54,31,38,60,
+240,255,150,4,136,255,10,24,30,62,118,155,143,27,232,80,7,112,54,159,45,155,55,217,178,101,135,15,199,50,245,67,211,216,9,48,52,116,116,137,1,5,29,90,1,206,230,179,101,243,166,240,10,174,219,212,15,
+77,147,36,192,130,121,0,250,1,156,205,103,199,230,109,194,43,136,145,37,1,226,119,4,13,14,30,153,99,250,151,14,61,129,206,230,31,200,220,211,110,131,135,212,212,15,77,147,36,64,197,60,0,99,1,206,230,
+179,43,252,230,205,219,87,96,226,142,37,1,226,15,6,13,12,140,76,179,252,75,135,33,70,103,243,217,177,121,155,240,10,190,196,98,234,135,166,177,19,160,191,127,184,204,190,63,58,172,64,205,179,205,95,
+185,242,188,247,155,223,252,163,119,225,194,165,76,216,188,77,120,5,15,171,169,31,154,38,73,128,146,121,0,182,130,201,171,205,255,238,119,31,122,183,110,221,90,225,198,141,247,82,183,121,27,155,54,
+109,243,97,133,144,37,1,226,79,9,59,124,120,168,155,207,154,153,152,214,159,7,155,191,114,229,234,15,196,55,147,32,45,155,183,9,15,252,188,77,59,52,77,52,51,88,126,97,209,60,8,77,193,188,213,230,177,
+125,91,2,192,236,236,123,169,217,188,41,188,130,248,90,196,95,76,188,46,224,208,161,193,42,19,65,117,104,9,228,173,54,127,254,252,165,208,4,176,37,65,59,159,118,27,60,164,166,110,104,153,56,1,14,30,
+28,152,96,211,1,157,125,251,126,158,203,218,60,34,215,75,130,180,133,223,184,113,171,15,31,163,52,117,67,203,70,18,160,104,30,168,175,175,63,183,157,54,245,147,224,70,219,108,222,38,188,130,189,155,
+44,9,208,216,151,69,68,240,101,68,215,161,147,33,175,157,54,113,147,160,213,162,219,132,7,226,111,234,133,134,13,239,15,32,191,92,49,15,200,250,192,60,119,218,32,114,189,36,104,215,211,110,66,119,189,
+37,1,26,223,32,66,236,100,0,75,209,161,141,153,247,190,249,164,73,208,106,225,55,108,216,226,195,231,249,76,189,208,112,53,9,208,37,212,204,131,50,52,156,247,190,249,122,73,240,238,187,55,90,98,243,
+54,225,129,184,91,196,71,187,198,55,137,162,60,249,228,161,89,122,1,117,248,168,161,235,155,223,209,80,18,172,86,116,83,120,5,171,129,76,157,208,110,213,251,4,30,56,112,176,143,197,134,38,180,4,220,
+16,108,252,36,104,230,211,110,194,241,109,26,161,93,83,118,11,149,3,45,155,7,167,194,225,134,96,191,123,170,17,57,58,9,102,91,34,60,172,95,191,217,159,174,103,17,191,57,91,197,82,164,226,55,67,229,79,
+135,78,33,55,4,187,189,161,36,104,212,230,77,225,21,124,55,192,212,7,205,154,153,0,61,150,19,248,125,2,121,154,105,83,175,54,143,200,245,146,160,89,162,43,212,151,196,44,52,247,3,82,251,247,255,162,
+202,30,1,58,44,25,207,211,76,155,56,181,249,70,146,160,17,225,21,116,253,154,186,160,85,211,191,24,34,109,204,18,237,76,19,92,32,47,54,31,183,54,31,55,9,86,35,188,122,250,109,154,160,85,75,190,27,36,
+7,190,105,158,140,247,79,158,108,62,110,109,190,94,18,188,243,206,108,67,162,67,79,207,38,255,79,102,254,88,196,111,205,71,163,40,143,63,126,160,196,212,48,19,62,28,145,39,155,143,91,155,79,146,4,113,
+68,215,161,230,111,211,2,141,90,250,237,64,57,65,197,118,98,250,5,242,100,243,113,107,243,136,28,157,4,239,38,18,30,184,183,16,241,91,251,225,72,138,52,255,122,104,2,154,236,222,189,39,119,54,31,183,
+54,223,72,18,216,132,87,208,7,99,211,0,109,218,242,253,96,121,239,79,241,238,55,97,140,32,111,54,31,183,54,31,39,9,162,68,135,251,238,219,232,87,252,108,177,71,147,182,126,65,92,78,184,96,187,16,94,5,
+121,179,249,184,181,121,68,142,74,130,215,94,187,30,42,60,112,191,33,226,183,247,243,241,148,199,30,123,162,151,126,0,19,230,13,230,209,230,227,214,230,163,146,224,243,207,255,96,21,94,193,130,15,91,
+204,209,162,144,70,145,19,95,183,93,16,173,130,60,218,124,220,218,124,88,18,124,244,209,127,220,37,186,130,189,25,67,196,191,94,72,179,72,91,116,158,246,168,9,205,148,60,218,124,220,218,188,45,9,198,
+198,38,172,226,243,90,181,197,152,216,23,210,46,123,246,236,43,10,53,186,36,77,88,72,146,71,155,143,91,155,231,157,143,237,127,248,225,71,161,226,211,193,102,139,109,16,243,98,33,11,69,46,164,28,114,
+145,126,246,230,209,230,235,213,230,235,113,239,189,27,124,7,13,139,43,49,47,100,169,244,246,238,157,97,166,144,9,147,72,153,56,146,71,155,79,42,60,162,43,136,9,177,179,197,148,88,23,178,88,228,194,
+170,182,11,166,101,96,75,130,60,216,124,82,225,149,248,196,44,68,252,106,33,203,69,178,118,142,204,53,209,147,192,217,188,93,120,224,53,73,172,108,49,36,182,133,172,23,185,248,110,97,158,155,176,65,
+157,192,217,188,29,58,207,194,226,22,196,180,187,208,9,69,46,116,157,240,69,216,205,208,58,200,187,205,155,224,142,17,226,19,203,117,133,78,42,187,119,239,89,39,204,51,72,100,131,126,130,188,218,188,
+206,61,247,172,247,31,136,176,56,5,49,236,44,241,181,36,232,22,230,194,110,142,30,67,108,47,79,54,175,68,7,238,135,25,85,17,226,19,187,238,66,167,151,71,30,233,173,210,143,29,6,245,130,60,216,188,18,
+30,232,224,137,138,9,49,43,172,165,34,55,52,19,117,195,12,37,211,241,177,86,109,94,193,53,243,250,171,35,254,76,97,45,150,135,31,126,180,44,212,88,198,20,6,227,221,157,32,124,18,209,65,85,244,162,238,
+61,136,77,185,176,150,203,67,15,253,172,40,204,51,171,37,12,234,6,172,55,232,116,155,87,80,207,97,235,150,168,123,14,98,82,44,228,165,200,205,94,175,19,144,149,41,231,157,102,243,10,245,5,175,122,247,
+73,44,10,121,44,15,62,184,187,87,88,16,188,40,72,4,236,147,87,67,150,109,30,248,61,230,70,34,124,189,251,10,238,189,183,144,247,34,65,152,138,17,44,31,234,8,116,151,102,77,120,154,176,180,102,226,222,
+7,247,92,112,229,251,34,239,253,30,161,194,251,63,14,60,97,236,82,162,146,33,13,155,71,116,156,137,107,137,123,221,193,61,246,56,197,67,138,84,150,74,194,77,42,77,113,225,21,65,111,26,245,5,186,150,
+245,132,104,150,232,252,157,87,16,21,58,92,136,115,38,185,198,224,158,74,78,225,100,137,80,77,24,228,21,104,107,99,201,180,38,168,140,145,24,170,14,161,18,67,137,204,223,213,114,43,90,27,60,217,56,11,
+9,197,49,248,94,82,163,215,17,220,131,19,190,209,34,79,90,143,48,35,44,243,212,117,8,203,193,53,59,171,111,114,50,244,9,179,66,45,131,162,215,130,107,235,115,74,181,184,72,165,171,75,24,16,42,194,50,
+149,176,148,88,14,174,129,107,233,114,202,164,84,74,165,159,22,133,9,161,42,44,50,135,190,69,44,6,231,224,92,69,23,249,236,38,68,183,80,18,202,194,180,80,17,230,132,5,97,73,184,45,220,17,106,1,119,
+130,127,91,10,126,102,46,248,157,233,224,24,28,171,219,69,214,21,87,92,113,197,21,87,92,113,197,149,53,81,254,31,147,245,224,213,190,61,173,246,0,0,0,0,73,69,78,68,174,66,96,130
+    };
+
+    const char* const png = reinterpret_cast<const char*> (data);
+    const int pngSize = static_cast<int> (sizeof (data));
+}
@@ -0,0 +1,19 @@
+/*
+  ==============================================================================
+
+    This file contains the knob filmstrip embedded in the plugin binary.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//==============================================================================
+/** Resources/knob2.png: 64 square frames of the knob from minimum to maximum,
+    stacked top to bottom.
+*/
+namespace KnobImage
+{
+    extern const char* const png;
+    extern const int pngSize;
+}
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    This file contains the per-block level summaries the processor publishes
+    for the editor's meters, and the FIFO that carries them across threads.
+
+  ==============================================================================
+*/
+
+#include "LevelMeter.h"
+
+//==============================================================================
+template <typename SampleType>
+void MeterFrame::measure (const AudioBuffer<SampleType>& buffer, int numChannels, int numSamples, float& peakdB, float& rmsdB) noexcept
+{
+    float peak = 0.0f, power = 0.0f;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        peak = jmax (peak, static_cast<float> (buffer.getMagnitude (channel, 0, numSamples)));
+
+        const auto rms = static_cast<float> (buffer.getRMSLevel (channel, 0, numSamples));
+        power += rms * rms;
+    }
+
+    peakdB = Decibels::gainToDecibels (peak, -100.0f);
+    rmsdB = Decibels::gainToDecibels (std::sqrt (power / static_cast<float> (jmax (1, numChannels))), -100.0f);
+}
+
+template void MeterFrame::measure (const AudioBuffer<float>&, int, int, float&, float&) noexcept;
+template void MeterFrame::measure (const AudioBuffer<double>&, int, int, float&, float&) noexcept;
+
+//==============================================================================
+void MeterFifo::push (const MeterFrame& frame) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite (1, start1, size1, start2, size2);
+
+    if (size1 > 0)
+        frames[start1] = frame;
+
+    fifo.finishedWrite (size1);
+}
+
+bool MeterFifo::pop (MeterFrame& frame) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead (1, start1, size1, start2, size2);
+
+    if (size1 > 0)
+        frame = frames[start1];
+
+    fifo.finishedRead (size1);
+    return size1 > 0;
+}
@@ -0,0 +1,44 @@
+/*
+  ==============================================================================
+
+    This file contains the per-block level summaries the processor publishes
+    for the editor's meters, and the FIFO that carries them across threads.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** Levels for one processed block, all in decibels. */
+struct MeterFrame
+{
+    float inputPeak = -100.0f, inputRms = -100.0f;
+    float outputPeak = -100.0f, outputRms = -100.0f;
+    float gainReduction = 0.0f;
+
+    /** Measures the peak and RMS (power averaged across channels) of a buffer region. */
+    template <typename SampleType>
+    static void measure (const AudioBuffer<SampleType>& buffer, int numChannels, int numSamples, float& peakdB, float& rmsdB) noexcept;
+};
+
+//==============================================================================
+/** Single-producer, single-consumer FIFO of MeterFrames.
+
+    push() is wait-free and drops the frame if the editor has fallen behind, so
+    the audio thread never blocks or allocates.
+*/
+class MeterFifo
+{
+public:
+    void push (const MeterFrame& frame) noexcept;
+    bool pop (MeterFrame& frame) noexcept;
+
+private:
+    static constexpr int capacity = 64;
+
+    AbstractFifo fifo { capacity };
+    MeterFrame frames[capacity];
+};
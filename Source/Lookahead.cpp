@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    This file contains the lookahead building blocks used by the compressor.
+
+  ==============================================================================
+*/
+
+#include "Lookahead.h"
+
+//==============================================================================
+template <typename SampleType>
+void LookaheadDelay<SampleType>::prepare (MemoryArena& arena, int newNumChannels, int maxDelaySamples)
+{
+    const auto capacity = nextPowerOfTwo (maxDelaySamples + 1);
+
+    numChannels = newNumChannels;
+    ring = arena.allocate<SampleType> (static_cast<size_t> (numChannels * capacity));
+    mask = capacity - 1;
+    delay = jmin (delay, maxDelaySamples);
+
+    reset();
+}
+
+template <typename SampleType>
+void LookaheadDelay<SampleType>::reset()
+{
+    if (ring != nullptr)
+        FloatVectorOperations::clear (ring, numChannels * (mask + 1));
+
+    writePosition = 0;
+}
+
+template <typename SampleType>
+void LookaheadDelay<SampleType>::setDelay (int newDelaySamples) noexcept
+{
+    jassert (newDelaySamples >= 0 && newDelaySamples <= mask);
+    delay = jlimit (0, mask, newDelaySamples);
+}
+
+template <typename SampleType>
+void LookaheadDelay<SampleType>::process (dsp::AudioBlock<SampleType>& block) noexcept
+{
+    jassert (block.getNumChannels() <= static_cast<size_t> (numChannels));
+
+    const auto numSamples = block.getNumSamples();
+
+    // With no delay the block passes through untouched, but the ring still
+    // follows it, so a delay switched on later replays recent input rather
+    // than whatever was there when it was last switched off
+    if (delay == 0)
+    {
+        push (block);
+        return;
+    }
+
+    auto position = writePosition;
+
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        auto* samples = block.getChannelPointer (channel);
+        auto* buffer = ring + channel * static_cast<size_t> (mask + 1);
+        position = writePosition;
+
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            buffer[position] = samples[i];
+            samples[i] = buffer[(position - delay) & mask];
+            position = (position + 1) & mask;
+        }
+    }
+
+    writePosition = position;
+}
+
+template <typename SampleType>
+void LookaheadDelay<SampleType>::push (const dsp::AudioBlock<const SampleType>& block) noexcept
+{
+    jassert (block.getNumChannels() <= static_cast<size_t> (numChannels));
+
+    const auto numSamples = static_cast<int> (block.getNumSamples());
+
+    for (int done = 0; done < numSamples;)
+    {
+        const auto position = (writePosition + done) & mask;
+        const auto length = jmin (numSamples - done, mask + 1 - position);
+
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+            FloatVectorOperations::copy (ring + channel * static_cast<size_t> (mask + 1) + position,
+                                         block.getChannelPointer (channel) + done, length);
+
+        done += length;
+    }
+
+    writePosition = (writePosition + numSamples) & mask;
+}
+
+template class LookaheadDelay<float>;
+template class LookaheadDelay<double>;
+
+//==============================================================================
+void SlidingMaximum::prepare (MemoryArena& arena, int maxWindowLength)
+{
+    // the deque briefly holds windowLength + 1 entries before the oldest is dropped
+    const auto capacity = nextPowerOfTwo (jmax (1, maxWindowLength) + 1);
+
+    values = arena.allocate<float> (static_cast<size_t> (capacity));
+    positions = arena.allocate<int64> (static_cast<size_t> (capacity));
+    mask = capacity - 1;
+    windowLength = jlimit (1, mask, windowLength);
+
+    reset();
+}
+
+void SlidingMaximum::reset() noexcept
+{
+    front = 0;
+    size = 0;
+    position = 0;
+}
+
+void SlidingMaximum::setWindowLength (int newWindowLength) noexcept
+{
+    jassert (newWindowLength >= 1 && newWindowLength <= mask);
+    newWindowLength = jlimit (1, mask, newWindowLength);
+
+    if (newWindowLength != windowLength)
+    {
+        windowLength = newWindowLength;
+        reset();
+    }
+}
+
+void SlidingMaximum::process (float* samples, size_t numSamples) noexcept
+{
+    if (windowLength == 1)
+        return;
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const auto value = samples[i];
+
+        // anything smaller than the new value can never be the maximum again
+        while (size > 0 && values[(front + size - 1) & mask] <= value)
+            --size;
+
+        const auto back = (front + size) & mask;
+        values[back] = value;
+        positions[back] = position;
+        ++size;
+
+        if (positions[front] <= position - windowLength)
+        {
+            front = (front + 1) & mask;
+            --size;
+        }
+
+        samples[i] = values[front];
+        ++position;
+    }
+}
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    This file contains the lookahead building blocks used by the compressor: a
+    preallocated multichannel delay line for the audio path and a sliding-window
+    maximum for the detector path.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "MemoryArena.h"
+
+//==============================================================================
+/** Fixed-capacity ring-buffer delay, one ring per channel. */
+template <typename SampleType>
+class LookaheadDelay
+{
+public:
+    void prepare (MemoryArena& arena, int numChannels, int maxDelaySamples);
+    void reset();
+
+    void setDelay (int newDelaySamples) noexcept;
+    int getDelay() const noexcept                    { return delay; }
+
+    void process (dsp::AudioBlock<SampleType>& block) noexcept;
+
+    /** Writes a block into the ring without reading anything back, so a delay
+        that isn't playing stays ready to take over.
+    */
+    void push (const dsp::AudioBlock<const SampleType>& block) noexcept;
+
+private:
+    // The channels' rings sit back to back, mask + 1 samples apart
+    SampleType* ring = nullptr;
+    int numChannels = 0, mask = 0, writePosition = 0, delay = 0;
+};
+
+//==============================================================================
+/** Running maximum over the last N samples of a signal, computed in place.
+
+    Uses a monotonic deque on a preallocated ring, so each sample is pushed and
+    popped at most once: amortised O(1) per sample for any window length.
+*/
+class SlidingMaximum
+{
+public:
+    void prepare (MemoryArena& arena, int maxWindowLength);
+    void reset() noexcept;
+
+    void setWindowLength (int newWindowLength) noexcept;
+
+    void process (float* samples, size_t numSamples) noexcept;
+
+private:
+    float* values = nullptr;
+    int64* positions = nullptr;
+    int mask = 0, front = 0, size = 0, windowLength = 1;
+    int64 position = 0;
+};
@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    This file contains the bump allocator each processor prepares its DSP
+    state from, so re-preparing reuses one block of memory instead of
+    freeing and allocating every buffer again.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** One block of memory handed out front to back, rewound rather than freed.
+
+    prepare() code rewinds the arena and allocates everything it needs from
+    it. If that doesn't fit, the requests that overflow get their own
+    allocations so the pass still works, and grow() then swaps the block for
+    one big enough for the whole pass. The caller prepares again straight
+    afterwards, after which the same or any smaller configuration fits and
+    nothing is allocated.
+*/
+class MemoryArena
+{
+public:
+    static constexpr size_t alignment = 64;
+
+    /** Returns n zeroed, default-constructed Ts, aligned for any SIMD register.
+        Only types that are trivially destructible can live here, since the
+        arena never runs destructors.
+    */
+    template <typename T>
+    T* allocate (size_t n)
+    {
+        static_assert (std::is_trivially_destructible<T>::value, "The arena never runs destructors");
+
+        if (n == 0)
+            return nullptr;
+
+        const auto numBytes = (n * sizeof (T) + alignment - 1) & ~(alignment - 1);
+        char* memory = nullptr;
+
+        if (used + numBytes <= capacity)
+        {
+            memory = block + used;
+        }
+        else
+        {
+            overflow.emplace_back (numBytes + alignment);
+            memory = alignUp (overflow.back().get());
+        }
+
+        used += numBytes;
+        std::memset (memory, 0, numBytes);
+
+        auto* objects = reinterpret_cast<T*> (memory);
+
+        for (size_t i = 0; i < n; ++i)
+            new (objects + i) T();
+
+        return objects;
+    }
+
+    /** Starts handing memory out from the beginning again. Everything allocated before is invalid. */
+    void rewind() noexcept
+    {
+        used = 0;
+    }
+
+    /** If the last pass overflowed, replaces the block with one that fits it and returns true.
+        Every pointer from that pass is invalid afterwards, so prepare again.
+    */
+    bool grow()
+    {
+        if (overflow.empty())
+            return false;
+
+        overflow.clear();
+        capacity = used;
+        storage.allocate (capacity + alignment, false);
+        block = alignUp (storage.get());
+        return true;
+    }
+
+    /** Frees everything. */
+    void release()
+    {
+        overflow.clear();
+        storage.free();
+        block = nullptr;
+        capacity = used = 0;
+    }
+
+    size_t getCapacity() const noexcept             { return capacity; }
+    size_t getNumBytesUsed() const noexcept         { return used; }
+
+private:
+    static char* alignUp (char* memory) noexcept
+    {
+        return snapPointerToAlignment (memory, alignment);
+    }
+
+    HeapBlock<char> storage;
+    char* block = nullptr;
+    size_t capacity = 0, used = 0;
+    std::vector<HeapBlock<char>> overflow;
+};
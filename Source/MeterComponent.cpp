@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    This file contains the input / gain reduction / output meter strip shown
+    along the bottom of the editor.
+
+  ==============================================================================
+*/
+
+#include "MeterComponent.h"
+
+//==============================================================================
+MeterComponent::MeterComponent()
+{
+    setOpaque (true);
+}
+
+void MeterComponent::setLevels (const MeterFrame& newLevels)
+{
+    const auto clip = [] (float dB) { return jmax (minimumdB, dB); };
+    const auto moved = [&clip] (float a, float b) { return std::abs (clip (a) - clip (b)) >= visibleChangedB; };
+
+    if (moved (newLevels.inputPeak, levels.inputPeak)
+     || moved (newLevels.inputRms, levels.inputRms)
+     || moved (newLevels.outputPeak, levels.outputPeak)
+     || moved (newLevels.outputRms, levels.outputRms)
+     || moved (newLevels.gainReduction, levels.gainReduction))
+    {
+        levels = newLevels;
+        repaint();
+    }
+}
+
+void MeterComponent::decay (float seconds)
+{
+    const auto onScale = [] (float dB) { return dB > minimumdB; };
+
+    // Once every bar is empty there is nothing left to fall, so an idle editor stops repainting
+    if (! (onScale (levels.inputPeak) || onScale (levels.inputRms) || onScale (levels.outputPeak)
+            || onScale (levels.outputRms) || levels.gainReduction < 0.0f))
+        return;
+
+    const auto fall = decaydBPerSecond * seconds;
+
+    levels.inputPeak -= fall;
+    levels.inputRms -= fall;
+    levels.outputPeak -= fall;
+    levels.outputRms -= fall;
+    levels.gainReduction = jmin (0.0f, levels.gainReduction + fall);
+    repaint();
+}
+
+void MeterComponent::paint (Graphics& g)
+{
+    g.fillAll (getLookAndFeel().findColour (ResizableWindow::backgroundColourId));
+
+    auto area = getLocalBounds().reduced (4);
+    const auto rowHeight = area.getHeight() / 3;
+
+    drawBar (g, area.removeFromTop (rowHeight), "In", levels.inputPeak, levels.inputRms);
+    drawGainReduction (g, area.removeFromTop (rowHeight), levels.gainReduction);
+    drawBar (g, area, "Out", levels.outputPeak, levels.outputRms);
+}
+
+void MeterComponent::drawBar (Graphics& g, Rectangle<int> area, const String& name, float peakdB, float rmsdB) const
+{
+    g.setColour (Colours::white);
+    g.setFont (12.0f);
+    g.drawText (name, area.removeFromLeft (30), Justification::centredLeft);
+
+    auto bar = area.reduced (0, 2).toFloat();
+    const auto proportion = [] (float dB) { return jmap (jlimit (minimumdB, 0.0f, dB), minimumdB, 0.0f, 0.0f, 1.0f); };
+
+    g.setColour (Colours::black);
+    g.fillRect (bar);
+
+    g.setColour (Colours::green.withAlpha (0.5f));
+    g.fillRect (bar.withWidth (bar.getWidth() * proportion (peakdB)));
+
+    g.setColour (Colours::green);
+    g.fillRect (bar.withWidth (bar.getWidth() * proportion (rmsdB)));
+}
+
+void MeterComponent::drawGainReduction (Graphics& g, Rectangle<int> area, float reductiondB) const
+{
+    g.setColour (Colours::white);
+    g.setFont (12.0f);
+    g.drawText ("GR", area.removeFromLeft (30), Justification::centredLeft);
+
+    auto bar = area.reduced (0, 2).toFloat();
+    const auto proportion = jmap (jlimit (minimumdB, 0.0f, reductiondB), 0.0f, minimumdB, 0.0f, 1.0f);
+
+    g.setColour (Colours::black);
+    g.fillRect (bar);
+
+    // gain reduction grows leftwards from the right-hand edge
+    g.setColour (Colours::orange);
+    g.fillRect (bar.withLeft (bar.getRight() - bar.getWidth() * proportion));
+}
@@ -0,0 +1,42 @@
+/*
+  ==============================================================================
+
+    This file contains the input / gain reduction / output meter strip shown
+    along the bottom of the editor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "LevelMeter.h"
+
+//==============================================================================
+class MeterComponent  : public Component
+{
+public:
+    MeterComponent();
+
+    /** Updates the displayed levels, repainting only if one has moved by a visible amount. */
+    void setLevels (const MeterFrame& newLevels);
+
+    /** Lets the levels fall back while no frames arrive, e.g. while the host is stopped or
+        the plugin is bypassed, so the meters don't freeze on the last block played.
+    */
+    void decay (float seconds);
+
+    void paint (Graphics& g) override;
+
+private:
+    void drawBar (Graphics& g, Rectangle<int> area, const String& name, float peakdB, float rmsdB) const;
+    void drawGainReduction (Graphics& g, Rectangle<int> area, float reductiondB) const;
+
+    static constexpr float minimumdB = -60.0f;
+    static constexpr float visibleChangedB = 0.5f;
+    static constexpr float decaydBPerSecond = 30.0f;
+
+    MeterFrame levels;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MeterComponent)
+};
@@ -0,0 +1,194 @@
+/*
+  ==============================================================================
+
+    This file contains the compressor's output gain and dry/wet mix stage.
+
+  ==============================================================================
+*/
+
+#include "OutputMixer.h"
+
+//==============================================================================
+template <typename SampleType>
+void OutputMixer<SampleType>::prepare (MemoryArena& arena, double sampleRate, int newNumChannels, int newMaxBlockSize, int maxDelaySamples)
+{
+    const auto capacity = nextPowerOfTwo (maxDelaySamples + newMaxBlockSize);
+
+    numChannels = newNumChannels;
+    maxBlockSize = newMaxBlockSize;
+    ring = arena.allocate<SampleType> (static_cast<size_t> (numChannels * capacity));
+    mask = capacity - 1;
+    delay = jmin (delay, maxDelaySamples);
+
+    wetRamp = arena.allocate<SampleType> (static_cast<size_t> (maxBlockSize));
+    dryRamp = arena.allocate<SampleType> (static_cast<size_t> (maxBlockSize));
+
+    gain.reset (sampleRate, rampSeconds);
+    mix.reset (sampleRate, rampSeconds);
+    reset();
+}
+
+template <typename SampleType>
+void OutputMixer<SampleType>::reset() noexcept
+{
+    if (ring != nullptr)
+        FloatVectorOperations::clear (ring, numChannels * (mask + 1));
+
+    writePosition = blockStart = 0;
+    gain.setCurrentAndTargetValue (gain.getTargetValue());
+    mix.setCurrentAndTargetValue (mix.getTargetValue());
+}
+
+template <typename SampleType>
+void OutputMixer<SampleType>::setGainDecibels (SampleType newGainDecibels) noexcept
+{
+    gain.setTargetValue (Decibels::decibelsToGain (newGainDecibels, static_cast<SampleType> (-100)));
+}
+
+template <typename SampleType>
+void OutputMixer<SampleType>::setMix (SampleType newWetProportion) noexcept
+{
+    mix.setTargetValue (jlimit (SampleType (0), SampleType (1), newWetProportion));
+}
+
+template <typename SampleType>
+void OutputMixer<SampleType>::setDelay (int newDelaySamples) noexcept
+{
+    jassert (newDelaySamples >= 0 && newDelaySamples + maxBlockSize <= mask + 1);
+    delay = jlimit (0, mask + 1 - maxBlockSize, newDelaySamples);
+}
+
+//==============================================================================
+template <typename SampleType>
+template <typename Function>
+void OutputMixer<SampleType>::forEachDrySegment (const dsp::AudioBlock<const SampleType>* dry, size_t channel,
+                                                 size_t numSamples, Function&& function) const noexcept
+{
+    if (dry != nullptr)
+    {
+        function (0, dry->getChannelPointer (channel), static_cast<int> (numSamples));
+        return;
+    }
+
+    // The delayed input can wrap around the end of the ring once per block
+    const auto* channelRing = ring + channel * static_cast<size_t> (mask + 1);
+    const auto readStart = (blockStart - delay) & mask;
+
+    for (int done = 0; done < static_cast<int> (numSamples);)
+    {
+        const auto position = (readStart + done) & mask;
+        const auto length = jmin (static_cast<int> (numSamples) - done, mask + 1 - position);
+        function (done, channelRing + position, length);
+        done += length;
+    }
+}
+
+template <typename SampleType>
+void OutputMixer<SampleType>::pushDry (const dsp::AudioBlock<const SampleType>& block) noexcept
+{
+    jassert (block.getNumChannels() <= static_cast<size_t> (numChannels));
+    jassert (block.getNumSamples() <= static_cast<size_t> (maxBlockSize));
+
+    const auto numSamples = static_cast<int> (block.getNumSamples());
+    blockStart = writePosition;
+
+    for (int done = 0; done < numSamples;)
+    {
+        const auto position = (writePosition + done) & mask;
+        const auto length = jmin (numSamples - done, mask + 1 - position);
+
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+            FloatVectorOperations::copy (ring + channel * static_cast<size_t> (mask + 1) + position,
+                                         block.getChannelPointer (channel) + done, length);
+
+        done += length;
+    }
+
+    writePosition = (writePosition + numSamples) & mask;
+}
+
+template <typename SampleType>
+void OutputMixer<SampleType>::readDry (dsp::AudioBlock<SampleType>& destination) const noexcept
+{
+    jassert (destination.getNumChannels() <= static_cast<size_t> (numChannels));
+
+    for (size_t channel = 0; channel < destination.getNumChannels(); ++channel)
+    {
+        auto* output = destination.getChannelPointer (channel);
+
+        forEachDrySegment (nullptr, channel, destination.getNumSamples(), [output] (int offset, const SampleType* source, int length)
+        {
+            FloatVectorOperations::copy (output + offset, source, length);
+        });
+    }
+}
+
+template <typename SampleType>
+void OutputMixer<SampleType>::process (dsp::AudioBlock<SampleType>& block, const dsp::AudioBlock<const SampleType>* dry) noexcept
+{
+    const auto numSamples = block.getNumSamples();
+
+    if (! gain.isSmoothing() && ! mix.isSmoothing())
+    {
+        const auto wetGain = gain.getTargetValue() * mix.getTargetValue();
+        const auto dryGain = SampleType (1) - mix.getTargetValue();
+
+        // Fully wet is the plain output gain, as before there was a mix
+        if (dryGain == SampleType (0))
+        {
+            if (wetGain != SampleType (1))
+                block.multiplyBy (wetGain);
+
+            return;
+        }
+
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+        {
+            auto* output = block.getChannelPointer (channel);
+
+            // Fully dry copies the dry signal untouched, so it nulls against it exactly
+            if (wetGain == SampleType (0))
+            {
+                forEachDrySegment (dry, channel, numSamples, [&] (int offset, const SampleType* source, int length)
+                {
+                    FloatVectorOperations::copy (output + offset, source, length);
+                });
+
+                continue;
+            }
+
+            FloatVectorOperations::multiply (output, wetGain, static_cast<int> (numSamples));
+
+            forEachDrySegment (dry, channel, numSamples, [&] (int offset, const SampleType* source, int length)
+            {
+                FloatVectorOperations::addWithMultiply (output + offset, source, dryGain, length);
+            });
+        }
+
+        return;
+    }
+
+    // Gliding: work the per-sample gains out once, then apply them to every channel
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const auto wetProportion = mix.getNextValue();
+        wetRamp[i] = gain.getNextValue() * wetProportion;
+        dryRamp[i] = SampleType (1) - wetProportion;
+    }
+
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        auto* output = block.getChannelPointer (channel);
+
+        FloatVectorOperations::multiply (output, wetRamp, static_cast<int> (numSamples));
+
+        forEachDrySegment (dry, channel, numSamples, [&] (int offset, const SampleType* source, int length)
+        {
+            FloatVectorOperations::addWithMultiply (output + offset, source, dryRamp + offset, length);
+        });
+    }
+}
+
+//==============================================================================
+template class OutputMixer<float>;
+template class OutputMixer<double>;
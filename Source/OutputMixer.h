@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    This file contains the last stage of the compressor's DSP chain: output
+    gain and the dry/wet mix for parallel compression, applied together.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "MemoryArena.h"
+
+//==============================================================================
+/** Applies the output gain to the compressed signal and mixes the dry input
+    back in, in one pass over the block.
+
+    The dry input is captured into a preallocated ring as each block comes in
+    and read back delayed by the chain's latency, so it lines up with the
+    compressed signal whatever the oversampling and lookahead settings. Where
+    the compressed signal also picks up phase shift, from the crossover or
+    the oversampling filters, the caller reads the delayed input out with
+    readDry(), runs it through the same filters and mixes that in instead;
+    otherwise at 100% dry the output is exactly the input delayed by the
+    reported latency. The gain only applies to the compressed signal. Gain
+    and mix both glide to new values over rampSeconds.
+*/
+template <typename SampleType>
+class OutputMixer
+{
+public:
+    static constexpr double rampSeconds = 0.05;
+
+    void prepare (MemoryArena& arena, double sampleRate, int numChannels, int maxBlockSize, int maxDelaySamples);
+
+    /** Clears the captured input and jumps gain and mix to their targets. */
+    void reset() noexcept;
+
+    void setGainDecibels (SampleType newGainDecibels) noexcept;
+
+    /** The proportion of compressed signal, from 0 (all dry) to 1 (all wet). */
+    void setMix (SampleType newWetProportion) noexcept;
+
+    /** How far behind the input the compressed signal is, in samples, less
+        whatever latency the caller's own dry filters add.
+    */
+    void setDelay (int newDelaySamples) noexcept;
+
+    /** True when the dry signal is neither heard nor gliding in, so nothing needs to prepare it. */
+    bool isFullyWet() const noexcept    { return ! mix.isSmoothing() && mix.getTargetValue() == SampleType (1); }
+
+    //==============================================================================
+    /** Captures a block of dry input. Call it before the block is processed, once per block. */
+    void pushDry (const dsp::AudioBlock<const SampleType>& block) noexcept;
+
+    /** Copies the delayed input lining up with the block last pushed into destination. */
+    void readDry (dsp::AudioBlock<SampleType>& destination) const noexcept;
+
+    /** Turns the processed block into gain * mix * wet + (1 - mix) * delayed dry, in
+        place. A dry block from readDry(), filtered by the caller, replaces the ring's.
+    */
+    void process (dsp::AudioBlock<SampleType>& block, const dsp::AudioBlock<const SampleType>* dry = nullptr) noexcept;
+
+private:
+    template <typename Function>
+    void forEachDrySegment (const dsp::AudioBlock<const SampleType>* dry, size_t channel, size_t numSamples, Function&& function) const noexcept;
+
+    SmoothedValue<SampleType> gain { SampleType (1) }, mix { SampleType (1) };
+
+    // The channels' rings sit back to back, mask + 1 samples apart, long enough
+    // to hold the delay and the block being processed
+    SampleType* ring = nullptr;
+    int numChannels = 0, mask = 0, writePosition = 0, blockStart = 0, delay = 0;
+
+    // Per-sample gains for the wet and dry signals while either value is gliding
+    SampleType* wetRamp = nullptr;
+    SampleType* dryRamp = nullptr;
+    int maxBlockSize = 0;
+};
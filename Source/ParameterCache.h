@@ -0,0 +1,47 @@
+/*
+  ==============================================================================
+
+    This file contains a cached handle to a parameter's raw value, so the audio
+    thread can read parameters without a string lookup and only act on them
+    when they change.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+class CachedParameter
+{
+public:
+    void attach (AudioProcessorValueTreeState& state, const String& parameterID)
+    {
+        value = state.getRawParameterValue (parameterID);
+        jassert (value != nullptr);
+    }
+
+    float get() const noexcept          { return value->load (std::memory_order_relaxed); }
+    int getIndex() const noexcept       { return static_cast<int> (get()); }
+    bool getBool() const noexcept       { return get() >= 0.5f; }
+
+    /** True if the value differs from the one seen by the previous call. The first call always returns true. */
+    bool changed() noexcept
+    {
+        const auto current = get();
+
+        if (current == lastSeen)
+            return false;
+
+        lastSeen = current;
+        return true;
+    }
+
+    /** Makes the next changed() call return true. */
+    void invalidate() noexcept          { lastSeen = std::numeric_limits<float>::quiet_NaN(); }
+
+private:
+    std::atomic<float>* value = nullptr;
+    float lastSeen = std::numeric_limits<float>::quiet_NaN();
+};
@@ -53,22 +53,107 @@ CompressorAudioProcessorEditor::CompressorAudioProcessorEditor (CompressorAudioP
     gainKnob->setPopupDisplayEnabled(true, false, this);
 
     addAndMakeVisible(On);
-    On.setButtonText(" 2x ");
+    On.setButtonText(" OS ");
     On.setClickingTogglesState("true");
     On.setColour(TextButton::buttonColourId, Colours::green);
     On.addListener(this);
 
+    addAndMakeVisible(oversamplingFactorBox);
+    oversamplingFactorBox.addItemList({ "1x", "2x", "4x", "8x", "16x" }, 1);
+
+    addAndMakeVisible(oversamplingFilterBox);
+    oversamplingFilterBox.addItemList({ "IIR", "FIR" }, 1);
+
+    addAndMakeVisible(oversamplingModeBox);
+    oversamplingModeBox.addItemList({ "Full", "Detector" }, 1);
+
+    addAndMakeVisible(detectorBox);
+    detectorBox.addItemList({ "Peak", "RMS", "True Peak" }, 1);
+
+    addAndMakeVisible(linkButton);
+    linkButton.setButtonText("Link");
+    linkButton.setClickingTogglesState(true);
+    linkButton.setColour(TextButton::buttonOnColourId, Colours::green);
+
+    addAndMakeVisible(linkGroupsBox);
+    linkGroupsBox.addItemList({ "All", "Zones" }, 1);
+
+    // One group number per channel, e.g. "1 1 2 2 0"; while it holds any, it overrides the box
+    addAndMakeVisible(customLinkGroupsEditor);
+    customLinkGroupsEditor.setTextToShowWhenEmpty("Groups", Colours::grey);
+    customLinkGroupsEditor.setInputRestrictions(3 * CompressorAudioProcessor::maxChannels, "0123456789 ,");
+    customLinkGroupsEditor.setText(audioProcessor.getCustomLinkGroups(), false);
+    customLinkGroupsEditor.onReturnKey = [this] { audioProcessor.setCustomLinkGroups(customLinkGroupsEditor.getText()); };
+    customLinkGroupsEditor.onFocusLost = customLinkGroupsEditor.onReturnKey;
+
+    addAndMakeVisible(keyFilterBox);
+    keyFilterBox.addItemList({ "Key Off", "Key HPF", "Key BPF" }, 1);
+
+    addAndMakeVisible(keyFrequencySlider);
+    keyFrequencySlider.setSliderStyle(Slider::LinearHorizontal);
+    keyFrequencySlider.setTextBoxStyle(Slider::TextBoxRight, false, 60, 18);
+    keyFrequencySlider.setTextValueSuffix(" Hz");
+
+    addAndMakeVisible(keyListenButton);
+    keyListenButton.setButtonText("Listen");
+    keyListenButton.setClickingTogglesState(true);
+    keyListenButton.setColour(TextButton::buttonOnColourId, Colours::orange);
+
+    addAndMakeVisible(mixSlider);
+    mixSlider.setSliderStyle(Slider::LinearHorizontal);
+    mixSlider.setTextBoxStyle(Slider::TextBoxRight, false, 60, 18);
+    mixSlider.setTextValueSuffix(" % Wet");
+
+    addAndMakeVisible(kneeSlider);
+    kneeSlider.setSliderStyle(Slider::LinearHorizontal);
+    kneeSlider.setTextBoxStyle(Slider::TextBoxRight, false, 60, 18);
+    kneeSlider.setTextValueSuffix(" dB Knee");
+
     attackAttachment = std::make_unique <AudioProcessorValueTreeState::SliderAttachment>(p.getState(), "attack", *attackKnob);
     releaseAttachment = std::make_unique < AudioProcessorValueTreeState::SliderAttachment>(p.getState(), "release", *releaseKnob);
     ratioAttachment = std::make_unique < AudioProcessorValueTreeState::SliderAttachment>(p.getState(), "ratio", *ratioKnob);
     thresholdAttachment = std::make_unique < AudioProcessorValueTreeState::SliderAttachment>(p.getState(), "threshold", *thresholdKnob);
     gainAttachment = std::make_unique < AudioProcessorValueTreeState::SliderAttachment>(p.getState(), "gain", *gainKnob);
+    detectorAttachment = std::make_unique<AudioProcessorValueTreeState::ComboBoxAttachment>(p.getState(), "detector", detectorBox);
+    linkAttachment = std::make_unique<AudioProcessorValueTreeState::ButtonAttachment>(p.getState(), "link", linkButton);
+    linkGroupsAttachment = std::make_unique<AudioProcessorValueTreeState::ComboBoxAttachment>(p.getState(), "linkGroups", linkGroupsBox);
+    keyFilterAttachment = std::make_unique<AudioProcessorValueTreeState::ComboBoxAttachment>(p.getState(), "keyFilter", keyFilterBox);
+    keyFrequencyAttachment = std::make_unique<AudioProcessorValueTreeState::SliderAttachment>(p.getState(), "keyFreq", keyFrequencySlider);
+    keyListenAttachment = std::make_unique<AudioProcessorValueTreeState::ButtonAttachment>(p.getState(), "keyListen", keyListenButton);
+    mixAttachment = std::make_unique<AudioProcessorValueTreeState::SliderAttachment>(p.getState(), "mix", mixSlider);
+    kneeAttachment = std::make_unique<AudioProcessorValueTreeState::SliderAttachment>(p.getState(), "knee", kneeSlider);
+    oversamplingFactorAttachment = std::make_unique<AudioProcessorValueTreeState::ComboBoxAttachment>(p.getState(), "osFactor", oversamplingFactorBox);
+    oversamplingFilterAttachment = std::make_unique<AudioProcessorValueTreeState::ComboBoxAttachment>(p.getState(), "osFilter", oversamplingFilterBox);
+    oversamplingModeAttachment = std::make_unique<AudioProcessorValueTreeState::ComboBoxAttachment>(p.getState(), "osMode", oversamplingModeBox);
+
+   #if COMPRESSOR_PROFILING
+    addAndMakeVisible(profileButton);
+    profileButton.setButtonText("CPU");
+    profileButton.setClickingTogglesState(true);
+    profileButton.setToggleState(audioProcessor.getProfiler().isEnabled(), dontSendNotification);
+    profileButton.setColour(TextButton::buttonOnColourId, Colours::green);
+    profileButton.addListener(this);
+
+    addAndMakeVisible(dumpProfileButton);
+    dumpProfileButton.setButtonText("Dump");
+    dumpProfileButton.addListener(this);
+
+    addAndMakeVisible(profileLabel);
+    profileLabel.setFont(Font(12.0f));
+   #endif
 
-    setSize (600, 200);
+    addAndMakeVisible(meter);
+    audioProcessor.setMeteringEnabled(true);
+    startTimerHz(30);
+
+    setSize (600, 300);
 }
 
 CompressorAudioProcessorEditor::~CompressorAudioProcessorEditor()
 {
+    stopTimer();
+    audioProcessor.setMeteringEnabled(false);
+
     attackKnob->setLookAndFeel(nullptr);
     releaseKnob->setLookAndFeel(nullptr);
     thresholdKnob->setLookAndFeel(nullptr);
@@ -81,7 +166,74 @@ void CompressorAudioProcessorEditor::buttonClicked(Button* buttonThatWasClicked)
 {
     if (buttonThatWasClicked == &On)
         audioProcessor.setFilteringEnbaled(On.getToggleState());
+
+   #if COMPRESSOR_PROFILING
+    // Each run starts from empty histograms, so the numbers belong to what was just played
+    if (buttonThatWasClicked == &profileButton)
+    {
+        audioProcessor.getProfiler().reset();
+        audioProcessor.getProfiler().setEnabled(profileButton.getToggleState());
+    }
+
+    if (buttonThatWasClicked == &dumpProfileButton)
+    {
+        const auto file = File::getSpecialLocation(File::userDocumentsDirectory)
+                              .getNonexistentChildFile("Compressor Profile " + Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S"), ".csv");
+
+        if (! audioProcessor.getProfiler().writeReport(file))
+            DBG("Could not write " << file.getFullPathName());
+    }
+   #endif
+}
+
+// Drains every block summary published since the last tick and shows the loudest of them
+void CompressorAudioProcessorEditor::timerCallback()
+{
+   #if COMPRESSOR_PROFILING
+    updateProfileLabel();
+   #endif
+
+    auto& fifo = audioProcessor.getMeterFifo();
+    MeterFrame frame, loudest;
+
+    if (! fifo.pop(loudest))
+    {
+        // Nothing is pushed while the host is stopped or the plugin bypassed, so the meters fall back on their own
+        meter.decay(static_cast<float> (getTimerInterval()) * 0.001f);
+        return;
+    }
+
+    while (fifo.pop(frame))
+    {
+        loudest.inputPeak = jmax(loudest.inputPeak, frame.inputPeak);
+        loudest.inputRms = jmax(loudest.inputRms, frame.inputRms);
+        loudest.outputPeak = jmax(loudest.outputPeak, frame.outputPeak);
+        loudest.outputRms = jmax(loudest.outputRms, frame.outputRms);
+        loudest.gainReduction = jmin(loudest.gainReduction, frame.gainReduction);
+    }
+
+    meter.setLevels(loudest);
+}
+
+#if COMPRESSOR_PROFILING
+// Shows the whole block's timings, since that is what the host's budget is spent on
+void CompressorAudioProcessorEditor::updateProfileLabel()
+{
+    auto& profiler = audioProcessor.getProfiler();
+
+    if (! profiler.isEnabled())
+    {
+        profileLabel.setText({}, dontSendNotification);
+        return;
+    }
+
+    const auto block = profiler.getStatistics(BlockProfiler::block);
+
+    profileLabel.setText("p50 " + String(block.p50Micros, 1) + " / p99 " + String(block.p99Micros, 1)
+                         + " / max " + String(block.maxMicros, 1) + " us, " + String(profiler.getNumOverruns()) + " over",
+                         dontSendNotification);
 }
+#endif
 
 //==============================================================================
 void CompressorAudioProcessorEditor::paint (juce::Graphics& g)
@@ -91,25 +243,49 @@ void CompressorAudioProcessorEditor::paint (juce::Graphics& g)
     g.setColour (juce::Colours::white);
     g.setFont (20.0f);
 
+    const int height = getHeight() - meterHeight;
+
     // Drawing the text for the dials
-    g.drawFittedText("Gain", (((getWidth() / 6) * 1) - (100 / 2)), (((getHeight() / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
-    g.drawFittedText("Attack", (((getWidth() / 6) * 2) - (100 / 2)), (((getHeight() / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
-    g.drawFittedText("Release", (((getWidth() / 6) * 3) - (100 / 2)), (((getHeight() / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
-    g.drawFittedText("Ratio", (((getWidth() / 6) * 4) - (100 / 2)), (((getHeight() / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
-    g.drawFittedText("Threshold", (((getWidth() / 6) * 5) - (100 / 2)), (((getHeight() / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
+    g.drawFittedText("Gain", (((getWidth() / 6) * 1) - (100 / 2)), (((height / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
+    g.drawFittedText("Attack", (((getWidth() / 6) * 2) - (100 / 2)), (((height / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
+    g.drawFittedText("Release", (((getWidth() / 6) * 3) - (100 / 2)), (((height / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
+    g.drawFittedText("Ratio", (((getWidth() / 6) * 4) - (100 / 2)), (((height / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
+    g.drawFittedText("Threshold", (((getWidth() / 6) * 5) - (100 / 2)), (((height / 4) * 3) - (50 / 2)), 100, 100, juce::Justification::centred, 1);
 
     g.drawFittedText("Oversampling",(getWidth() / 2) - (100 / 2), 15, 100, 100, juce::Justification::centred, 1);
 }
 
 void CompressorAudioProcessorEditor::resized()
 {
+    const int height = getHeight() - meterHeight;
+
     // Drawing the dials
-    gainKnob->setBounds(((getWidth() / 6) * 1) - (100 / 2), ((getHeight() / 2) - (60 / 2)), 100, 100);
-    attackKnob->setBounds(((getWidth() / 6) * 2) - (100 / 2), ((getHeight() / 2) - (60 / 2)), 100, 100);
-    releaseKnob->setBounds(((getWidth() / 6) * 3) - (100 / 2), ((getHeight() / 2) - (60 / 2)), 100, 100);
-    ratioKnob->setBounds(((getWidth() / 6) * 4) - (100 / 2), ((getHeight() / 2) - (60 / 2)), 100, 100);
-    thresholdKnob->setBounds(((getWidth() / 6) * 5) - (100 / 2), ((getHeight() / 2) - (60 / 2)), 100, 100);
+    gainKnob->setBounds(((getWidth() / 6) * 1) - (100 / 2), ((height / 2) - (60 / 2)), 100, 100);
+    attackKnob->setBounds(((getWidth() / 6) * 2) - (100 / 2), ((height / 2) - (60 / 2)), 100, 100);
+    releaseKnob->setBounds(((getWidth() / 6) * 3) - (100 / 2), ((height / 2) - (60 / 2)), 100, 100);
+    ratioKnob->setBounds(((getWidth() / 6) * 4) - (100 / 2), ((height / 2) - (60 / 2)), 100, 100);
+    thresholdKnob->setBounds(((getWidth() / 6) * 5) - (100 / 2), ((height / 2) - (60 / 2)), 100, 100);
     
+    meter.setBounds(getLocalBounds().removeFromBottom(meterHeight).reduced(10, 0));
+
     // Drawing the buttons
     On.setBounds((getWidth() / 2) - (50/ 2), 25, 50, 25);
+    detectorBox.setBounds(((getWidth() / 6) * 5) - (70 / 2), 3, 70, 18);
+    linkButton.setBounds(((getWidth() / 6) * 5) - (50 / 2), 25, 50, 25);
+    linkGroupsBox.setBounds(((getWidth() / 6) * 5) - (70 / 2), 52, 70, 18);
+    customLinkGroupsEditor.setBounds(((getWidth() / 6) * 5) + 30, 25, 60, 25);
+    keyFilterBox.setBounds(((getWidth() / 6) * 1) - (70 / 2), 52, 70, 18);
+    keyFrequencySlider.setBounds(((getWidth() / 6) * 2) - (70 / 2), 52, 180, 18);
+    keyListenButton.setBounds(((getWidth() / 6) * 4) - (50 / 2), 52, 50, 18);
+    mixSlider.setBounds(((getWidth() / 6) * 2) - (70 / 2), 70, 180, 18);
+    kneeSlider.setBounds(((getWidth() / 6) * 4) - (70 / 2), 70, 180, 18);
+    oversamplingFactorBox.setBounds(((getWidth() / 6) * 1) - (70 / 2), 25, 70, 25);
+    oversamplingFilterBox.setBounds(((getWidth() / 6) * 2) - (70 / 2), 25, 70, 25);
+    oversamplingModeBox.setBounds(((getWidth() / 6) * 4) - (70 / 2), 25, 70, 25);
+
+   #if COMPRESSOR_PROFILING
+    profileButton.setBounds(((getWidth() / 6) * 1) - (70 / 2), 3, 40, 18);
+    dumpProfileButton.setBounds(((getWidth() / 6) * 1) + 10, 3, 45, 18);
+    profileLabel.setBounds(((getWidth() / 6) * 1) + 60, 3, 280, 18);
+   #endif
 }
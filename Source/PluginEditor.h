@@ -14,12 +14,13 @@
 #include "myLookAndFeel.h"
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
+#include "MeterComponent.h"
 
 
 //==============================================================================
 /**
 */
-class CompressorAudioProcessorEditor  : public juce::AudioProcessorEditor, private Button::Listener
+class CompressorAudioProcessorEditor  : public juce::AudioProcessorEditor, private Button::Listener, private Timer
 {
 public:
     CompressorAudioProcessorEditor (CompressorAudioProcessor&);
@@ -38,6 +39,25 @@ private:
     std::unique_ptr<Slider> thresholdKnob;
     std::unique_ptr<Slider> gainKnob;
     TextButton On;
+    ComboBox detectorBox;
+    TextButton linkButton;
+    ComboBox linkGroupsBox;
+    TextEditor customLinkGroupsEditor;
+    ComboBox keyFilterBox;
+    Slider keyFrequencySlider;
+    TextButton keyListenButton;
+    Slider mixSlider;
+    Slider kneeSlider;
+    MeterComponent meter;
+    static constexpr int meterHeight = 60;
+    ComboBox oversamplingFactorBox;
+    ComboBox oversamplingFilterBox;
+    ComboBox oversamplingModeBox;
+   #if COMPRESSOR_PROFILING
+    TextButton profileButton;
+    TextButton dumpProfileButton;
+    Label profileLabel;
+   #endif
     myLookAndFeelV1 myLookAndFeelV1;
     
     std::unique_ptr<AudioProcessorValueTreeState::SliderAttachment> attackAttachment;
@@ -45,8 +65,24 @@ private:
     std::unique_ptr<AudioProcessorValueTreeState::SliderAttachment> ratioAttachment;
     std::unique_ptr<AudioProcessorValueTreeState::SliderAttachment> thresholdAttachment;
     std::unique_ptr<AudioProcessorValueTreeState::SliderAttachment> gainAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::ComboBoxAttachment> detectorAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::ButtonAttachment> linkAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::ComboBoxAttachment> linkGroupsAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::ComboBoxAttachment> keyFilterAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::SliderAttachment> keyFrequencyAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::ButtonAttachment> keyListenAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::SliderAttachment> mixAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::SliderAttachment> kneeAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::ComboBoxAttachment> oversamplingFactorAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::ComboBoxAttachment> oversamplingFilterAttachment;
+    std::unique_ptr<AudioProcessorValueTreeState::ComboBoxAttachment> oversamplingModeAttachment;
 
     void buttonClicked(Button* buttonThatWasClicked) override;
+    void timerCallback() override;
+
+   #if COMPRESSOR_PROFILING
+    void updateProfileLabel();
+   #endif
 
     CompressorAudioProcessor& audioProcessor;
 
@@ -19,6 +19,7 @@ CompressorAudioProcessor::CompressorAudioProcessor()
                      #if ! JucePlugin_IsMidiEffect
                       #if ! JucePlugin_IsSynth
                        .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
+                       .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false)
                       #endif
                        .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
                      #endif
@@ -32,25 +33,88 @@ CompressorAudioProcessor::CompressorAudioProcessor()
     state->createAndAddParameter("ratio", "Ratio", "Ratio", NormalisableRange<float>(1.0f, 30.0f, 3.0f), 1.0f, nullptr, nullptr);
     state->createAndAddParameter("threshold", "Threshold", "Threshold", NormalisableRange<float>(-50.0, 0.0f, 1.0f), -40.0f, nullptr, nullptr);
     state->createAndAddParameter("gain", "Gain", "Gain", NormalisableRange<float>(-15.0f, 40.0f, 5.0f), 0.0f, nullptr, nullptr);
+    state->createAndAddParameter(std::make_unique<AudioParameterChoice>("osFactor", "Oversampling Factor", StringArray { "1x", "2x", "4x", "8x", "16x" }, 1));
+    state->createAndAddParameter(std::make_unique<AudioParameterChoice>("osFilter", "Oversampling Filter", StringArray { "Polyphase IIR", "Linear Phase FIR" }, 1));
+    state->createAndAddParameter(std::make_unique<AudioParameterChoice>("osMode", "Oversampling Mode", StringArray { "Full Path", "Detector Only" }, 0));
+    state->createAndAddParameter("lookahead", "Lookahead", "ms", NormalisableRange<float>(0.0f, CompressorEngine<float>::maxLookaheadMs, 0.1f), 0.0f, nullptr, nullptr);
+    state->createAndAddParameter(std::make_unique<AudioParameterChoice>("detector", "Detector", StringArray { "Peak", "RMS", "True Peak" }, 0));
+    state->createAndAddParameter("rmsWindow", "RMS Window", "ms", NormalisableRange<float>(1.0f, CompressorEngine<float>::maxRmsWindowMs, 0.1f), 10.0f, nullptr, nullptr);
+    state->createAndAddParameter("bands", "Bands", "", NormalisableRange<float>(1.0f, static_cast<float> (CompressorParameters::maxBands), 1.0f), 1.0f, nullptr, nullptr, false, true, true);
+
+    const float defaultCrossovers[CompressorParameters::maxCrossovers] = { 120.0f, 500.0f, 2000.0f, 6000.0f };
+
+    for (int i = 0; i < CompressorParameters::maxCrossovers; ++i)
+    {
+        const String index(i + 1);
+        state->createAndAddParameter("xover" + index, "Crossover " + index, "Hz", NormalisableRange<float>(20.0f, 20000.0f, 1.0f, 0.25f), defaultCrossovers[i], nullptr, nullptr);
+    }
+
+    for (int band = 0; band < CompressorParameters::maxBands; ++band)
+    {
+        const String index(band + 1);
+        state->createAndAddParameter("attack" + index, "Band " + index + " Attack", "Attack", NormalisableRange<float>(0.0f, 20.0f, 0.1f), 0.0f, nullptr, nullptr);
+        state->createAndAddParameter("release" + index, "Band " + index + " Release", "Release", NormalisableRange<float>(0.0f, 200.0f, 0.1f), 0.0f, nullptr, nullptr);
+        state->createAndAddParameter("ratio" + index, "Band " + index + " Ratio", "Ratio", NormalisableRange<float>(1.0f, 30.0f, 3.0f), 1.0f, nullptr, nullptr);
+        state->createAndAddParameter("threshold" + index, "Band " + index + " Threshold", "Threshold", NormalisableRange<float>(-50.0, 0.0f, 1.0f), -40.0f, nullptr, nullptr);
+    }
+
+    state->createAndAddParameter("link", "Stereo Link", "", NormalisableRange<float>(0.0f, 1.0f, 1.0f), 0.0f, nullptr, nullptr, false, true, true, AudioProcessorParameter::genericParameter, true);
+    state->createAndAddParameter(std::make_unique<AudioParameterChoice>("keyFilter", "Key Filter", StringArray { "Off", "High Pass", "Band Pass" }, 0));
+    state->createAndAddParameter("keyFreq", "Key Frequency", "Hz", NormalisableRange<float>(20.0f, 20000.0f, 1.0f, 0.25f), 100.0f, nullptr, nullptr);
+    state->createAndAddParameter("keyListen", "Key Listen", "", NormalisableRange<float>(0.0f, 1.0f, 1.0f), 0.0f, nullptr, nullptr, false, true, true, AudioProcessorParameter::genericParameter, true);
+    state->createAndAddParameter(std::make_unique<AudioParameterBool>("bypass", "Bypass", false));
+    state->createAndAddParameter(std::make_unique<AudioParameterChoice>("linkGroups", "Link Groups", StringArray { "All Channels", "Front / Surround / Height" }, 0));
+    state->createAndAddParameter("mix", "Mix", "%", NormalisableRange<float>(0.0f, 100.0f, 1.0f), 100.0f, nullptr, nullptr);
+    state->createAndAddParameter("knee", "Knee", "dB", NormalisableRange<float>(0.0f, 24.0f, 0.1f), 0.0f, nullptr, nullptr);
+    // Changes the latency, so it is kept away from automation
+    state->createAndAddParameter("blockMode", "Block Mode", "", NormalisableRange<float>(0.0f, 1.0f, 1.0f), 0.0f,
+                                 [](float value) { return value > 0.5f ? String("Fixed Sub-Blocks") : String("Host Buffers"); },
+                                 nullptr, false, false, true);
+
+    // One group per channel for the custom link scheme, set from the editor rather than automated
+    state->createAndAddParameter("customLinkGroups", "Custom Link Groups", "", NormalisableRange<float>(0.0f, 1.0f, 1.0f), 0.0f, nullptr, nullptr, false, true, true, AudioProcessorParameter::genericParameter, true);
+
+    for (int channel = 0; channel < maxChannels; ++channel)
+    {
+        const String index(channel + 1);
+        state->createAndAddParameter("linkGroup" + index, "Channel " + index + " Link Group", "", NormalisableRange<float>(0.0f, static_cast<float> (CompressorParameters::maxLinkGroups), 1.0f), 0.0f,
+                                     [](float value) { return value < 0.5f ? String("Own") : "Group " + String(roundToInt(value)); },
+                                     nullptr, false, false, true);
+    }
+
+    state->state = ValueTree("Compressor");
+
+    jassert(getParameters().size() <= maxStateValues);
+
+    // These belong to the session's routing and latency, so a preset never changes them
+    for (auto* parameterID : { "bypass", "osFactor", "osFilter", "osMode", "blockMode", "linkGroups", "customLinkGroups" })
+        sessionParameters[state->getParameter(parameterID)->getParameterIndex()] = true;
+
+    for (int channel = 0; channel < maxChannels; ++channel)
+        sessionParameters[state->getParameter("linkGroup" + String(channel + 1))->getParameterIndex()] = true;
 
-    state->state = ValueTree("attack");
-    state->state = ValueTree("release");
-    state->state = ValueTree("ratio");
-    state->state = ValueTree("threshold");
-    state->state = ValueTree("gain");
+    for (int i = 0; i < getParameters().size(); ++i)
+        if (auto* parameter = dynamic_cast<RangedAudioParameter*>(getParameters().getUnchecked(i)))
+            rawParameterValues[i] = state->getRawParameterValue(parameter->paramID);
 
-    dsp::Gain<float> inputGain;
-    inputGain.setGainDecibels(0);
-    
-    dsp::Compressor<float> compressor;
-    compressor.setAttack(1.0f);
-    compressor.setRatio(1);
-    compressor.setRelease(5.0f);
-    compressor.setThreshold(-40.0f);
+    if (! presetBank.open(getPresetBankFile()))
+        createFactoryPresets();
+
+    parameters.attach(*state);
+    floatEngine.attach(*state);
+    doubleEngine.attach(*state);
+    state->addParameterListener("osFactor", this);
+
+   #if COMPRESSOR_PROFILING
+    floatEngine.setProfiler(&profiler);
+    doubleEngine.setProfiler(&profiler);
+   #endif
 }
 
 CompressorAudioProcessor::~CompressorAudioProcessor()
 {
+    state->removeParameterListener("osFactor", this);
+    cancelPendingUpdate();
 }
 
 //==============================================================================
@@ -89,57 +153,364 @@ bool CompressorAudioProcessor::isMidiEffect() const
 
 double CompressorAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    return tailSeconds.load(std::memory_order_relaxed);
 }
 
 int CompressorAudioProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    return jmax(1, presetBank.getNumPresets());   // NB: some hosts don't cope very well if you tell them there are 0 programs,
+                                                  // so this should be at least 1, even if you're not really implementing programs.
 }
 
 int CompressorAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load(std::memory_order_relaxed);
 }
 
+// Some hosts switch programs from the audio thread, so this reads the blob straight out of
+// the bank and never allocates. Gain, threshold and ratio then glide to their new values.
 void CompressorAudioProcessor::setCurrentProgram (int index)
 {
+    float values[maxStateValues];
+    int numValues = -1;
+
+    {
+        // The bank is only locked while a save swaps it, and a program change then is dropped
+        const SpinLock::ScopedTryLockType lock(presetBankLock);
+
+        if (! lock.isLocked())
+            return;
+
+        const void* data = nullptr;
+        size_t size = 0;
+        int program = 0;
+
+        if (presetBank.getPreset(index, data, size))
+            numValues = ParameterBlob::read(data, size, values, maxStateValues, program);
+    }
+
+    if (numValues < 0)
+        return;
+
+    // A preset never switches bypass, oversampling, block mode or link groups
+    applyParameterValues(values, numValues, false);
+    currentProgram = index;
 }
 
 const juce::String CompressorAudioProcessor::getProgramName (int index)
 {
-    return {};
+    const SpinLock::ScopedLockType lock(presetBankLock);
+    return presetBank.getName(index);
 }
 
 void CompressorAudioProcessor::changeProgramName (int index, const juce::String& newName)
 {
+    StringArray names;
+    Array<MemoryBlock> blobs;
+    getPresets(names, blobs);
+
+    if (! isPositiveAndBelow(index, names.size()) || newName.isEmpty())
+        return;
+
+    names.set(index, newName);
+    writePresetBank(names, blobs);
+}
+
+bool CompressorAudioProcessor::saveUserPreset (const String& name)
+{
+    if (name.isEmpty())
+        return false;
+
+    StringArray names;
+    Array<MemoryBlock> blobs;
+    getPresets(names, blobs);
+
+    MemoryBlock blob;
+    getStateInformation(blob);
+
+    // Saving under a name the bank already has replaces that preset
+    auto index = names.indexOf(name);
+
+    if (index < 0)
+    {
+        index = names.size();
+        names.add(name);
+        blobs.add(blob);
+    }
+    else
+    {
+        blobs.set(index, blob);
+    }
+
+    if (! writePresetBank(names, blobs))
+        return false;
+
+    currentProgram = index;
+    return true;
+}
+
+void CompressorAudioProcessor::getPresets (StringArray& names, Array<MemoryBlock>& blobs) const
+{
+    const SpinLock::ScopedLockType lock(presetBankLock);
+
+    for (int i = 0; i < presetBank.getNumPresets(); ++i)
+    {
+        const void* data = nullptr;
+        size_t size = 0;
+
+        if (presetBank.getPreset(i, data, size))
+        {
+            names.add(presetBank.getName(i));
+            blobs.add(MemoryBlock(data, size));
+        }
+    }
+}
+
+bool CompressorAudioProcessor::writePresetBank (const StringArray& names, const Array<MemoryBlock>& blobs)
+{
+    MemoryBlock bank;
+
+    {
+        MemoryOutputStream stream(bank, false);
+
+        if (! PresetBank::write(stream, names, blobs))
+            return false;
+    }
+
+    // The file is written whole and then moved into place, so other instances never map half a bank
+    const auto file = getPresetBankFile();
+    file.getParentDirectory().createDirectory();
+    TemporaryFile temporaryFile(file);
+
+    if (! temporaryFile.getFile().replaceWithData(bank.getData(), bank.getSize()))
+        return false;
+
+    // This instance keeps its copy in memory, which also lets go of its mapping before the file is replaced
+    {
+        const SpinLock::ScopedLockType lock(presetBankLock);
+        presetBank.open(std::move(bank));
+    }
+
+    return temporaryFile.overwriteTargetFileWithTemporary();
+}
+
+void CompressorAudioProcessor::setCustomLinkGroups (const String& groups)
+{
+    StringArray numbers;
+    numbers.addTokens(groups, " ,", "");
+    numbers.removeEmptyStrings();
+
+    const auto setValue = [this](const String& parameterID, float value)
+    {
+        auto* parameter = state->getParameter(parameterID);
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    };
+
+    // Clearing the list only switches the groups off, so they come back as they were
+    if (! numbers.isEmpty())
+        for (int channel = 0; channel < maxChannels; ++channel)
+            setValue("linkGroup" + String(channel + 1), channel < numbers.size() ? static_cast<float> (jlimit(0, CompressorParameters::maxLinkGroups, numbers[channel].getIntValue())) : 0.0f);
+
+    setValue("customLinkGroups", numbers.isEmpty() ? 0.0f : 1.0f);
+}
+
+String CompressorAudioProcessor::getCustomLinkGroups() const
+{
+    if (! parameters.customLinkGroups.getBool())
+        return {};
+
+    StringArray numbers;
+
+    for (int channel = 0; channel < getTotalNumOutputChannels(); ++channel)
+        numbers.add(String(parameters.channelLinkGroups[channel].getIndex()));
+
+    return numbers.joinIntoString(" ");
+}
+
+void CompressorAudioProcessor::setParameterDirect (int index, float normalisedValue) noexcept
+{
+    if (! isPositiveAndBelow(index, getParameters().size()) || rawParameterValues[index] == nullptr)
+        return;
+
+    auto* parameter = static_cast<RangedAudioParameter*>(getParameters().getUnchecked(index));
+    parameter->setValue(jlimit(0.0f, 1.0f, normalisedValue));
+
+    // Read back, so the engines see the value the parameter snapped to
+    rawParameterValues[index]->store(parameter->convertFrom0to1(parameter->getValue()), std::memory_order_relaxed);
+}
+
+File CompressorAudioProcessor::getPresetBankFile()
+{
+    return File::getSpecialLocation(File::userApplicationDataDirectory).getChildFile(JucePlugin_Name).getChildFile("Presets.bank");
+}
+
+void CompressorAudioProcessor::applyParameterValues (const float* values, int numValues, bool includeSessionParameters)
+{
+    const auto& parameterList = getParameters();
+
+    // Parameters the blob predates go back to their defaults
+    for (int i = 0; i < parameterList.size(); ++i)
+    {
+        auto* parameter = parameterList.getUnchecked(i);
+
+        if (sessionParameters[i] && ! includeSessionParameters)
+            continue;
+
+        const float value = i < numValues ? values[i] : parameter->getDefaultValue();
+
+        if (parameter->getValue() != value)
+            parameter->setValueNotifyingHost(value);
+    }
+}
+
+void CompressorAudioProcessor::createFactoryPresets()
+{
+    struct FactoryPreset
+    {
+        const char* name;
+        std::initializer_list<std::pair<const char*, float>> settings;
+    };
+
+    const FactoryPreset factoryPresets[] =
+    {
+        { "Default",        {} },
+        { "Vocal Leveller", { { "attack", 5.0f }, { "release", 80.0f }, { "ratio", 4.0f }, { "threshold", -24.0f }, { "gain", 5.0f }, { "detector", 1.0f } } },
+        { "Drum Bus",       { { "attack", 10.0f }, { "release", 50.0f }, { "ratio", 4.0f }, { "threshold", -18.0f }, { "gain", 5.0f }, { "link", 1.0f } } },
+        { "Mix Glue",       { { "attack", 20.0f }, { "release", 150.0f }, { "ratio", 4.0f }, { "threshold", -12.0f }, { "link", 1.0f }, { "detector", 1.0f } } },
+        { "Peak Limiter",   { { "release", 50.0f }, { "ratio", 28.0f }, { "threshold", -6.0f }, { "lookahead", 5.0f }, { "detector", 2.0f }, { "link", 1.0f } } },
+    };
+
+    const auto& parameterList = getParameters();
+    StringArray names;
+    Array<MemoryBlock> blobs;
+
+    for (auto& preset : factoryPresets)
+    {
+        float values[maxStateValues];
+
+        for (int i = 0; i < parameterList.size(); ++i)
+            values[i] = parameterList.getUnchecked(i)->getDefaultValue();
+
+        for (auto& setting : preset.settings)
+        {
+            auto* parameter = state->getParameter(setting.first);
+            values[parameter->getParameterIndex()] = parameter->convertTo0to1(setting.second);
+        }
+
+        MemoryBlock blob;
+        MemoryOutputStream stream(blob, false);
+        ParameterBlob::write(stream, values, parameterList.size(), names.size());
+        stream.flush();
+
+        names.add(preset.name);
+        blobs.add(blob);
+    }
+
+    MemoryBlock bank;
+    MemoryOutputStream stream(bank, false);
+    PresetBank::write(stream, names, blobs);
+    stream.flush();
+
+    presetBank.open(std::move(bank));
 }
 
 //==============================================================================
 void CompressorAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    dsp::ProcessSpec spec;
- //   int osFactor = static_cast<int>(oversampling->getOversamplingFactor());
+    // Only one engine runs at a time, so the other gives its memory back
+    if (isUsingDoublePrecision())
+    {
+        floatEngine.release();
+        prepareEngine(doubleEngine, sampleRate, samplesPerBlock);
+    }
+    else
+    {
+        doubleEngine.release();
+        prepareEngine(floatEngine, sampleRate, samplesPerBlock);
+    }
+}
+
+template <typename SampleType>
+void CompressorAudioProcessor::prepareEngine(CrossfadingEngine<SampleType>& engine, double sampleRate, int samplesPerBlock)
+{
+    if (! workerThreadsEnabled)
+        workerPool = nullptr;
+    else if (workerPool == nullptr)
+        workerPool = std::make_unique<SharedResourcePointer<SharedWorkerPool>>();
+
+    const int numSidechainChannels = getChannelCountOfBus(true, 1);
+    const int sidechainChannelOffset = numSidechainChannels > 0 ? getChannelIndexInProcessBlockBuffer(true, 1, 0) : 0;
+
+    // Only the layout's channels and the selected oversampling factor are made room for
+    const int oversamplingOrder = parameters.oversamplingFactor.getIndex();
+
+    auto prepareFromArena = [&]
+    {
+        arena.rewind();
+        zoneLinkGroups = arena.allocate<int>(static_cast<size_t> (getNumOutputChannels()));
+        fillZoneLinkGroups(getChannelLayoutOfBus(false, 0), zoneLinkGroups);
 
-    spec.sampleRate = sampleRate * 2;
-    spec.maximumBlockSize = samplesPerBlock * 2;
-    spec.numChannels = getNumOutputChannels();
+        engine.prepare(sampleRate, samplesPerBlock, getNumOutputChannels(), numSidechainChannels, sidechainChannelOffset, zoneLinkGroups, workerPool != nullptr ? &workerPool->getObject() : nullptr, arena, oversamplingOrder);
+    };
 
-    compressor.reset();
-    compressor.prepare(spec);
-    
-    inputGain.reset();
-    inputGain.prepare(spec);
+    // A configuration bigger than any before overflows the arena on the first pass,
+    // so the arena grows to fit and the engine prepares again into it. Anything the
+    // same size or smaller reuses the memory without allocating.
+    prepareFromArena();
 
-    oversampling.reset(new dsp::Oversampling<float>(getNumOutputChannels(), 2, dsp::Oversampling<float>::filterHalfBandFIREquiripple, false));
-    oversampling->initProcessing(static_cast<size_t> (samplesPerBlock));
+    if (arena.grow())
+        prepareFromArena();
+
+    dspMemoryBytes = arena.getCapacity() + engine.getExternalMemoryBytes();
+    preparedOversamplingOrder = engine.getPreparedOversamplingOrder();
+
+   #if COMPRESSOR_PROFILING
+    profiler.prepare(sampleRate);
+   #endif
+
+    // Pick up the current settings first, so the gain starts where it should rather than ramping from 0 dB
+    parameters.invalidate();
+    engine.update(parameters, getTargetPath());
+    setLatencySamples(engine.getLatencySamples());
+    tailSeconds = engine.getTailSeconds();
 }
 
 void CompressorAudioProcessor::releaseResources()
 {
-    // When playback stops, you can use this as an opportunity to free up any
-    // spare memory, etc.
+    // Nothing may process until the next prepareToPlay(), so all the DSP memory can go
+    floatEngine.release();
+    doubleEngine.release();
+    arena.release();
+    workerPool = nullptr;
+    zoneLinkGroups = nullptr;
+    dspMemoryBytes = 0;
+    preparedOversamplingOrder = -1;
+}
+
+void CompressorAudioProcessor::parameterChanged (const String&, float newValue)
+{
+    // Called on whichever thread set the factor, so the work is handed to the message thread
+    if (roundToInt(newValue) > preparedOversamplingOrder.load())
+        triggerAsyncUpdate();
+}
+
+void CompressorAudioProcessor::handleAsyncUpdate()
+{
+    const auto order = preparedOversamplingOrder.load();
+
+    if (order < 0 || parameters.oversamplingFactor.getIndex() <= order)
+        return;
+
+    // Until then the engine has played the highest factor it had room for. Suspending
+    // waits for the host's callback lock, so processBlock() never sees the engine rebuilt.
+    suspendProcessing(true);
+
+    if (isUsingDoublePrecision())
+        prepareEngine(doubleEngine, getSampleRate(), getBlockSize());
+    else
+        prepareEngine(floatEngine, getSampleRate(), getBlockSize());
+
+    suspendProcessing(false);
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -149,12 +520,23 @@ bool CompressorAudioProcessor::isBusesLayoutSupported (const BusesLayout& layout
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Any layout up to maxChannels works, named or discrete: every channel is just another detector lane
+    const auto& mainOutput = layouts.getMainOutputChannelSet();
+
+    if (mainOutput.isDisabled() || mainOutput.size() > maxChannels)
         return false;
 
+   #if ! JucePlugin_IsSynth
+    // The sidechain is optional; when enabled it is mono or matches the main bus
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto& sidechain = layouts.getChannelSet(true, 1);
+
+        if (! sidechain.isDisabled() && sidechain.size() != 1 && sidechain != mainOutput)
+            return false;
+    }
+   #endif
+
     // This checks if the input layout matches the output layout
    #if ! JucePlugin_IsSynth
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
@@ -166,48 +548,120 @@ bool CompressorAudioProcessor::isBusesLayoutSupported (const BusesLayout& layout
 }
 #endif
 
-void CompressorAudioProcessor::updateParameters() {
-    float attack = *state->getRawParameterValue("attack");
-    float release = *state->getRawParameterValue("release");
-    float ratio = *state->getRawParameterValue("ratio");
-    float threshold = *state->getRawParameterValue("threshold");
-    float gain = *state->getRawParameterValue("gain");
+void CompressorAudioProcessor::fillZoneLinkGroups(const AudioChannelSet& layout, int* groups) {
+    // The front bed, the surrounds and everything else (heights, ambisonic or discrete
+    // channels) each share a detector, while LFE channels keep their own
+    for (int channel = 0; channel < layout.size(); ++channel)
+    {
+        switch (layout.getTypeOfChannel(channel))
+        {
+            case AudioChannelSet::left:
+            case AudioChannelSet::right:
+            case AudioChannelSet::centre:
+            case AudioChannelSet::leftCentre:
+            case AudioChannelSet::rightCentre:
+            case AudioChannelSet::wideLeft:
+            case AudioChannelSet::wideRight:
+                groups[channel] = 0;
+                break;
+
+            case AudioChannelSet::leftSurround:
+            case AudioChannelSet::rightSurround:
+            case AudioChannelSet::centreSurround:
+            case AudioChannelSet::leftSurroundSide:
+            case AudioChannelSet::rightSurroundSide:
+            case AudioChannelSet::leftSurroundRear:
+            case AudioChannelSet::rightSurroundRear:
+                groups[channel] = 1;
+                break;
+
+            case AudioChannelSet::LFE:
+            case AudioChannelSet::LFE2:
+                groups[channel] = -1;
+                break;
+
+            default:
+                groups[channel] = 2;
+                break;
+        }
+    }
+}
+
+void CompressorAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+{
+    processBlockInternal(buffer, floatEngine);
+}
+
+void CompressorAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer&)
+{
+    processBlockInternal(buffer, doubleEngine);
+}
+
+void CompressorAudioProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+{
+    processBlockBypassedInternal(buffer, floatEngine);
+}
+
+void CompressorAudioProcessor::processBlockBypassed (juce::AudioBuffer<double>& buffer, juce::MidiBuffer&)
+{
+    processBlockBypassedInternal(buffer, doubleEngine);
+}
+
+EnginePath CompressorAudioProcessor::getTargetPath() const
+{
+    if (parameters.bypass.getBool())
+        return EnginePath::bypassed;
+
+    return filteringEnabled.load(std::memory_order_relaxed) ? EnginePath::oversampled : EnginePath::direct;
+}
 
-    inputGain.setGainDecibels(gain);
-    compressor.setAttack(attack);
-    compressor.setRatio(ratio);
-    compressor.setRelease(release);
-    compressor.setThreshold(threshold);
+AudioProcessorParameter* CompressorAudioProcessor::getBypassParameter() const
+{
+    return state->getParameter("bypass");
 }
 
-void CompressorAudioProcessor::process(dsp::ProcessContextReplacing<float> context) {
-    //do processing here and output
-    updateParameters();
-    compressor.process(context);
-    inputGain.process(context);
+template <typename SampleType>
+void CompressorAudioProcessor::processBlockBypassedInternal (AudioBuffer<SampleType>& buffer, CrossfadingEngine<SampleType>& engine)
+{
+    // Still delayed by the reported latency, so the host's compensation stays right
+    for (auto i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
+        buffer.clear (i, 0, buffer.getNumSamples());
+
+    engine.processBypassed(buffer);
 }
 
-void CompressorAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+template <typename SampleType>
+void CompressorAudioProcessor::processBlockInternal (AudioBuffer<SampleType>& buffer, CrossfadingEngine<SampleType>& engine)
 {
     juce::ScopedNoDenormals noDenormals;
+    COMPRESSOR_PROFILE_BLOCK(profiler, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
-    // If OS button selected then OS, else only run effects without OS
-    dsp::AudioBlock<float> block(buffer);
-    if (!filteringEnabled) {
-        // create new block of upsampled buffer
-        dsp::AudioBlock<float> osBlock = oversampling->processSamplesUp(block);
-        // send upsampled block to process to effect
-        process(dsp::ProcessContextReplacing<float>(osBlock));
-        // process the original block back down
-        oversampling->processSamplesDown(block);
-    }
-    else {
-        process(dsp::ProcessContextReplacing<float>(block));
+    engine.update(parameters, getTargetPath());
+
+    if (engine.getLatencySamples() != getLatencySamples())
+        setLatencySamples(engine.getLatencySamples());
+
+    tailSeconds.store(engine.getTailSeconds(), std::memory_order_relaxed);
+
+    const bool metering = meteringEnabled.load(std::memory_order_relaxed);
+    const bool listening = parameters.keyListen.getBool();
+    const int numChannels = getNumOutputChannels();
+    MeterFrame meterFrame;
+
+    if (metering)
+        MeterFrame::measure(buffer, numChannels, buffer.getNumSamples(), meterFrame.inputPeak, meterFrame.inputRms);
+
+    engine.process(buffer, listening, isNonRealtime());
+
+    if (metering) {
+        MeterFrame::measure(buffer, numChannels, buffer.getNumSamples(), meterFrame.outputPeak, meterFrame.outputRms);
+        meterFrame.gainReduction = listening ? 0.0f : engine.getGainReduction();
+        meterFifo.push(meterFrame);
     }
 }
 
@@ -229,21 +683,39 @@ juce::AudioProcessorEditor* CompressorAudioProcessor::createEditor()
 //==============================================================================
 void CompressorAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    // You should use this method to store your parameters in the memory block.
-    // You could do that either as raw data, or use the XML or ValueTree classes
-    // as intermediaries to make it easy to save and load complex data.
+    // One float per parameter, so hundreds of instances save without building a tree each
+    const auto& parameterList = getParameters();
+    float values[maxStateValues];
+
+    for (int i = 0; i < parameterList.size(); ++i)
+        values[i] = parameterList.getUnchecked(i)->getValue();
+
     MemoryOutputStream stream(destData, false);
-    state->state.writeToStream(stream);
+    ParameterBlob::write(stream, values, parameterList.size(), getCurrentProgram());
 }
 
 void CompressorAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
-    // You should use this method to restore your parameters from this memory block,
-    // whose contents will have been created by the getStateInformation() call.
-    ValueTree tree = ValueTree::readFromData(data, sizeInBytes);
+    float values[maxStateValues];
+    int program = 0;
+    const int numValues = ParameterBlob::read(data, static_cast<size_t> (jmax(0, sizeInBytes)), values, maxStateValues, program);
+
+    if (numValues >= 0)
+    {
+        applyParameterValues(values, numValues, true);
+        currentProgram = jlimit(0, getNumPrograms() - 1, program);
+        return;
+    }
+
+    // Sessions saved before the binary format hold the whole ValueTree, or XML
+    ValueTree tree = ValueTree::readFromData(data, static_cast<size_t> (jmax(0, sizeInBytes)));
+
+    if (! tree.isValid())
+        if (auto xml = getXmlFromBinary(data, sizeInBytes))
+            tree = ValueTree::fromXml(*xml);
 
     if (tree.isValid()) {
-        state->state = tree;
+        state->replaceState(tree);
     }
 }
 
@@ -12,11 +12,18 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "CrossfadingEngine.h"
+#include "WorkerPool.h"
+#include "LevelMeter.h"
+#include "PresetBank.h"
+#include "MemoryArena.h"
 
 //==============================================================================
 /**
 */
-class CompressorAudioProcessor  : public juce::AudioProcessor
+class CompressorAudioProcessor  : public juce::AudioProcessor,
+                                  private AudioProcessorValueTreeState::Listener,
+                                  private AsyncUpdater
 {
 public:
     //==============================================================================
@@ -26,16 +33,47 @@ public:
     void prepareToPlay (double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
 
+    // Called from the message thread; the audio thread crossfades to the new path
     void setFilteringEnbaled(const bool shouldBeEnabled)
     {
         filteringEnabled = shouldBeEnabled;
     }
 
+    // The editor switches metering on while it is open, so a closed editor costs nothing
+    void setMeteringEnabled(const bool shouldBeEnabled)
+    {
+        meteringEnabled = shouldBeEnabled;
+    }
+
+    MeterFifo& getMeterFifo() { return meterFifo; }
+
+    /** Lets offline multiband and wide-layout work borrow the process-wide worker pool.
+        Takes effect at the next prepareToPlay(); disabled keeps everything on the calling
+        thread, for hosts that already spread instances across cores.
+    */
+    void setWorkerThreadsEnabled(const bool shouldBeEnabled)
+    {
+        workerThreadsEnabled = shouldBeEnabled;
+    }
+
+   #if COMPRESSOR_PROFILING
+    BlockProfiler& getProfiler() { return profiler; }
+   #endif
+
    #ifndef JucePlugin_PreferredChannelConfigurations
     bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+
+    // The plugin bypasses itself through this parameter, so it can fade and keep its latency
+    AudioProcessorParameter* getBypassParameter() const override;
+
+    // Double-precision hosts get their own engine, so buffers are never converted
+    bool supportsDoublePrecisionProcessing() const override { return true; }
     
 
     //==============================================================================
@@ -63,18 +101,113 @@ public:
 
     AudioProcessorValueTreeState& getState();
 
-    void process(dsp::ProcessContextReplacing<float> context);
-    void updateParameters();
+    /** Bytes of DSP state this instance holds while prepared: its arena, plus the
+        oversampling stages and crossfade buffer JUCE allocates for it. It covers
+        the bus layout's channels and the oversampling factor selected so far, and
+        grows when a higher factor is chosen. Safe to call from any thread, for
+        capacity planning across large sessions.
+    */
+    size_t getDspMemoryBytes() const noexcept { return dspMemoryBytes.load(std::memory_order_relaxed); }
+
+    /** Where a user preset bank is looked for; without one the programs are the factory presets. */
+    static File getPresetBankFile();
+
+    /** Saves the current settings into the preset bank file as a program of this name,
+        replacing one that already has it, and makes it the current program. The first
+        save copies the factory presets into the file. Called from the message thread.
+    */
+    bool saveUserPreset(const String& name);
+
+    /** Custom link groups as text, one number per channel from 1 to maxLinkGroups:
+        while linked, channels with the same number share a detector, and 0 or a
+        missing number keeps a channel's own. Empty text goes back to the link groups
+        scheme. Called from the message thread.
+    */
+    void setCustomLinkGroups(const String& groups);
+    String getCustomLinkGroups() const;
+
+    /** Sets a parameter, by index, from a thread that owns the processor outright
+        between blocks, e.g. StreamEngine's period thread. The value lands on the
+        parameter and on the atomic the engines read, without the listener locks
+        setValueNotifyingHost() takes, and nothing is notified: there is no host or
+        editor to tell. A higher oversampling factor set this way plays at the one
+        prepared for until the next prepareToPlay().
+    */
+    void setParameterDirect(int index, float normalisedValue) noexcept;
+
+    static constexpr int maxChannels = CompressorParameters::maxChannels;
 
 private:
-    bool filteringEnabled = false;
+    template <typename SampleType>
+    void prepareEngine(CrossfadingEngine<SampleType>& engine, double sampleRate, int samplesPerBlock);
+
+    template <typename SampleType>
+    void processBlockInternal(AudioBuffer<SampleType>& buffer, CrossfadingEngine<SampleType>& engine);
+
+    template <typename SampleType>
+    void processBlockBypassedInternal(AudioBuffer<SampleType>& buffer, CrossfadingEngine<SampleType>& engine);
+
+    EnginePath getTargetPath() const;
 
-    dsp::Compressor<float> compressor;
-    dsp::Gain<float> inputGain;
-    std::unique_ptr<dsp::Oversampling<float>> oversampling;
+    // The engine is only sized for the oversampling factor selected when it was prepared,
+    // so choosing a higher one prepares it again from the message thread
+    void parameterChanged(const String& parameterID, float newValue) override;
+    void handleAsyncUpdate() override;
+    std::atomic<int> preparedOversamplingOrder { -1 };
+
+    std::atomic<bool> filteringEnabled { false };
+
+    // Only the engine matching the host's precision is prepared and run
+    CrossfadingEngine<float> floatEngine;
+    CrossfadingEngine<double> doubleEngine;
+
+    // Shared by both engines, and by every other instance in the process, for offline
+    // multiband and wide-layout work. Held only while prepared, so the last instance
+    // released stops the threads.
+    std::unique_ptr<SharedResourcePointer<SharedWorkerPool>> workerPool;
+    bool workerThreadsEnabled = true;
+
+    // Every buffer the engines own comes from here, and is rewound rather than freed on re-prepare
+    MemoryArena arena;
+    std::atomic<size_t> dspMemoryBytes { 0 };
+
+    // Link groups for the "Front / Surround / Height" scheme, worked out from the bus layout
+    int* zoneLinkGroups = nullptr;
+    static void fillZoneLinkGroups(const AudioChannelSet& layout, int* groups);
+
+    // Written by the audio thread whenever the tail is worked out, read by the host
+    std::atomic<double> tailSeconds { 0.0 };
+
+    std::atomic<bool> meteringEnabled { false };
+    MeterFifo meterFifo;
+
+   #if COMPRESSOR_PROFILING
+    BlockProfiler profiler;
+   #endif
+
+    // Programs and saved states carry one normalised value per parameter, in creation order
+    static constexpr int maxStateValues = 128;
+    void applyParameterValues(const float* values, int numValues, bool includeSessionParameters);
+    void createFactoryPresets();
+    void getPresets(StringArray& names, Array<MemoryBlock>& blobs) const;
+    bool writePresetBank(const StringArray& names, const Array<MemoryBlock>& blobs);
+
+    // Routing, latency and bypass, by parameter index, which only a saved session restores
+    bool sessionParameters[maxStateValues] = {};
+
+    // What the engines read for each parameter, by index, for setParameterDirect()
+    std::atomic<float>* rawParameterValues[maxStateValues] = {};
+
+    // Held by the audio thread only as a try-lock, around reading a program out of the bank
+    PresetBank presetBank;
+    mutable SpinLock presetBankLock;
+    std::atomic<int> currentProgram { 0 };
 
     ScopedPointer<AudioProcessorValueTreeState> state;
 
+    // Attached once in the constructor, so the audio thread never looks parameters up by name
+    CompressorParameters parameters;
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CompressorAudioProcessor)
 };
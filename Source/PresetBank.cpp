@@ -0,0 +1,169 @@
+/*
+  ==============================================================================
+
+    This file contains the processor's compact binary state and the preset
+    bank built from it.
+
+  ==============================================================================
+*/
+
+#include "PresetBank.h"
+
+namespace
+{
+    inline uint32 readUint32 (const uint8* bytes) noexcept
+    {
+        return ByteOrder::littleEndianInt (bytes);
+    }
+
+    inline uint16 readUint16 (const uint8* bytes) noexcept
+    {
+        return ByteOrder::littleEndianShort (bytes);
+    }
+}
+
+//==============================================================================
+bool ParameterBlob::isBlob (const void* data, size_t size) noexcept
+{
+    return size >= headerSize && readUint32 (static_cast<const uint8*> (data)) == magic;
+}
+
+void ParameterBlob::write (OutputStream& stream, const float* values, int numValues, int program)
+{
+    stream.writeInt (static_cast<int> (magic));
+    stream.writeShort (static_cast<short> (version));
+    stream.writeShort (static_cast<short> (numValues));
+    stream.writeInt (program);
+
+    for (int i = 0; i < numValues; ++i)
+        stream.writeFloat (values[i]);
+}
+
+int ParameterBlob::read (const void* data, size_t size, float* values, int maxValues, int& program) noexcept
+{
+    if (! isBlob (data, size))
+        return -1;
+
+    const auto* bytes = static_cast<const uint8*> (data);
+
+    // Later versions may change the layout, which this one can't guess at
+    if (readUint16 (bytes + 4) != version)
+        return -1;
+
+    const auto numStored = static_cast<int> (readUint16 (bytes + 6));
+
+    if (size < getSize (numStored))
+        return -1;
+
+    program = static_cast<int> (readUint32 (bytes + 8));
+
+    const auto numValues = jmin (numStored, maxValues);
+
+    for (int i = 0; i < numValues; ++i)
+    {
+        const auto bits = readUint32 (bytes + headerSize + sizeof (float) * static_cast<size_t> (i));
+        std::memcpy (values + i, &bits, sizeof (float));
+        values[i] = jlimit (0.0f, 1.0f, values[i]);
+    }
+
+    return numValues;
+}
+
+//==============================================================================
+bool PresetBank::open (const File& file)
+{
+    mappedFile = std::make_unique<MemoryMappedFile> (file, MemoryMappedFile::readOnly);
+    memory.reset();
+    data = static_cast<const uint8*> (mappedFile->getData());
+    size = mappedFile->getSize();
+
+    if (readHeader())
+        return true;
+
+    mappedFile.reset();
+    return false;
+}
+
+bool PresetBank::open (MemoryBlock&& bank)
+{
+    mappedFile.reset();
+    memory = std::move (bank);
+    data = static_cast<const uint8*> (memory.getData());
+    size = memory.getSize();
+
+    if (readHeader())
+        return true;
+
+    memory.reset();
+    return false;
+}
+
+bool PresetBank::readHeader() noexcept
+{
+    numPresets = 0;
+    entrySize = 0;
+
+    if (data == nullptr || size < headerSize || readUint32 (data) != magic || readUint16 (data + 4) != version)
+    {
+        data = nullptr;
+        size = 0;
+        return false;
+    }
+
+    entrySize = readUint32 (data + 8);
+
+    // A truncated file keeps the presets that are whole
+    if (entrySize > nameSize)
+        numPresets = jmin (static_cast<int> (readUint16 (data + 6)), static_cast<int> ((size - headerSize) / entrySize));
+
+    return true;
+}
+
+String PresetBank::getName (int index) const
+{
+    if (! isPositiveAndBelow (index, numPresets))
+        return {};
+
+    const auto* name = reinterpret_cast<const char*> (data + headerSize + static_cast<size_t> (index) * entrySize);
+    return String::fromUTF8 (name, static_cast<int> (strnlen (name, nameSize)));
+}
+
+bool PresetBank::getPreset (int index, const void*& presetData, size_t& presetSize) const noexcept
+{
+    if (! isPositiveAndBelow (index, numPresets))
+        return false;
+
+    presetData = data + headerSize + static_cast<size_t> (index) * entrySize + nameSize;
+    presetSize = entrySize - nameSize;
+    return true;
+}
+
+bool PresetBank::write (OutputStream& stream, const StringArray& names, const Array<MemoryBlock>& blobs)
+{
+    jassert (names.size() == blobs.size());
+
+    size_t blobSize = ParameterBlob::headerSize;
+
+    for (auto& blob : blobs)
+        blobSize = jmax (blobSize, blob.getSize());
+
+    // Whole floats keep every blob aligned inside the mapping
+    blobSize = (blobSize + 3) & ~static_cast<size_t> (3);
+
+    bool ok = stream.writeInt (static_cast<int> (magic))
+           && stream.writeShort (static_cast<short> (version))
+           && stream.writeShort (static_cast<short> (blobs.size()))
+           && stream.writeInt (static_cast<int> (nameSize + blobSize));
+
+    for (int i = 0; i < blobs.size() && ok; ++i)
+    {
+        char name[nameSize] = {};
+        names[i].copyToUTF8 (name, nameSize);
+
+        ok = stream.write (name, nameSize)
+          && stream.write (blobs.getReference (i).getData(), blobs.getReference (i).getSize())
+          && stream.writeRepeatedByte (0, blobSize - blobs.getReference (i).getSize());
+    }
+
+    return ok;
+}
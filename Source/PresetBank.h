@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    This file contains the processor's compact binary state and the preset
+    bank built from it.
+
+    A state blob is a 12-byte header followed by one little-endian float per
+    parameter: its normalised value, in the order the processor creates its
+    parameters. New parameters are only ever appended, so an older blob just
+    holds fewer values, and the rest keep their defaults.
+
+    A bank is a header followed by fixed-size entries, each a 32-byte name
+    and a blob. Banks on disk are memory-mapped and never copied, so loading
+    a preset reads straight from the mapping.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+struct ParameterBlob
+{
+    static constexpr uint32 magic = 0x53504d43;     // "CMPS"
+    static constexpr uint16 version = 1;
+    static constexpr size_t headerSize = 12;
+
+    static size_t getSize (int numValues) noexcept  { return headerSize + sizeof (float) * static_cast<size_t> (numValues); }
+
+    static bool isBlob (const void* data, size_t size) noexcept;
+
+    static void write (OutputStream& stream, const float* values, int numValues, int program);
+
+    /** Copies up to maxValues normalised values out of a blob without allocating.
+        Returns the number of values read, or -1 if the data is not a blob this
+        version understands.
+    */
+    static int read (const void* data, size_t size, float* values, int maxValues, int& program) noexcept;
+};
+
+//==============================================================================
+/** A bank of named state blobs, either memory-mapped from a file or held in memory.
+    It is never edited in place: saving a preset writes a whole new bank and opens that.
+*/
+class PresetBank
+{
+public:
+    static constexpr uint32 magic = 0x42504d43;     // "CMPB"
+    static constexpr uint16 version = 1;
+    static constexpr size_t headerSize = 12;
+    static constexpr size_t nameSize = 32;
+
+    /** Maps a bank file. Returns false, leaving the bank empty, if it is missing or malformed. */
+    bool open (const File& file);
+
+    /** Takes over a bank built in memory, e.g. the factory presets. */
+    bool open (MemoryBlock&& bank);
+
+    int getNumPresets() const noexcept              { return numPresets; }
+    String getName (int index) const;
+
+    /** Points data at a preset's blob inside the bank; nothing is copied or allocated. */
+    bool getPreset (int index, const void*& data, size_t& size) const noexcept;
+
+    /** Writes a bank. Every blob is padded to the longest, so entries stay fixed-size. */
+    static bool write (OutputStream& stream, const StringArray& names, const Array<MemoryBlock>& blobs);
+
+private:
+    bool readHeader() noexcept;
+
+    std::unique_ptr<MemoryMappedFile> mappedFile;
+    MemoryBlock memory;
+    const uint8* data = nullptr;
+    size_t size = 0, entrySize = 0;
+    int numPresets = 0;
+};
@@ -0,0 +1,620 @@
+/*
+  ==============================================================================
+
+    This file contains the SIMD compressor kernel used by the plugin processor.
+
+  ==============================================================================
+*/
+
+#include "SIMDCompressor.h"
+
+namespace
+{
+    // The detector rows are float whatever the audio precision
+    inline void rectify (float* row, const float* input, int numSamples) noexcept
+    {
+        FloatVectorOperations::abs (row, input, numSamples);
+    }
+
+    inline void rectify (float* row, const double* input, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            row[i] = static_cast<float> (std::abs (input[i]));
+    }
+
+    inline void square (float* row, const float* input, int numSamples) noexcept
+    {
+        FloatVectorOperations::multiply (row, input, input, numSamples);
+    }
+
+    inline void square (float* row, const double* input, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            row[i] = static_cast<float> (input[i] * input[i]);
+    }
+
+    inline void multiply (float* samples, const float* gains, int numSamples) noexcept
+    {
+        FloatVectorOperations::multiply (samples, gains, numSamples);
+    }
+
+    inline void multiply (double* samples, const float* gains, int numSamples) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            samples[i] *= gains[i];
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setThreshold (float newThresholddB)
+{
+    // dsp::Compressor floors the threshold at -200 dB; log2(10) / 20 converts dB to log2 units
+    thresholddB = newThresholddB;
+    log2Threshold.setTargetValue (jmax (-200.0f, thresholddB) * 0.166096404f);
+    updateGainCurve();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setRatio (float newRatio)
+{
+    jassert (newRatio >= 1.0f);
+
+    ratio = newRatio;
+    update();
+    updateGainCurve();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setKnee (float newKneedB)
+{
+    jassert (newKneedB >= 0.0f);
+
+    kneedB = newKneedB;
+    log2Knee.setTargetValue (kneedB * 0.166096404f);
+    updateGainCurve();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setAttack (float newAttackMs)
+{
+    attackTime = newAttackMs;
+    update();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setRelease (float newReleaseMs)
+{
+    releaseTime = newReleaseMs;
+    update();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setLinkMode (LinkMode newLinkMode)
+{
+    const auto group = newLinkMode == LinkMode::linked ? 0 : -1;
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        linkGroups[channel] = group;
+
+    if (updateRows())
+        reset();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setDetectorMode (DetectorMode newDetectorMode) noexcept
+{
+    if (newDetectorMode == detectorMode)
+        return;
+
+    detectorMode = newDetectorMode;
+
+    // Whatever the new detector held is from the last time it was selected
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        rmsWindows[channel].reset();
+
+    truePeak.reset();
+
+    // The held window depends on how late the detector is
+    setLookahead (lookahead);
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setRmsWindow (float newWindowMs) noexcept
+{
+    rmsWindowMs = newWindowMs;
+    updateRmsWindow();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setLinkGroups (const int* groupForChannel) noexcept
+{
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        linkGroups[channel] = groupForChannel[channel];
+
+    if (updateRows())
+        reset();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setLookahead (int newLookaheadSamples) noexcept
+{
+    lookahead = newLookaheadSamples;
+    lookaheadDelay.setDelay (lookahead);
+
+    // the held peak must cover the sample being output plus everything still in
+    // the delay, which the detector's latency has already used part of
+    const auto windowLength = jmax (1, lookahead - getDetectorLatency() + 1);
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        peakHolds[channel].setWindowLength (windowLength);
+}
+
+//==============================================================================
+template <typename SampleType>
+void SIMDCompressor<SampleType>::prepare (MemoryArena& arena, const dsp::ProcessSpec& spec, int maxLookaheadSamples, int maxRmsWindowSamples)
+{
+    jassert (spec.sampleRate > 0);
+    jassert (spec.numChannels > 0);
+
+    sampleRate = spec.sampleRate;
+    numChannels = spec.numChannels;
+    maxBlockSize = spec.maximumBlockSize;
+
+    // One gain row per channel, so any grouping fits
+    gainRows = arena.allocate<float*> (numChannels);
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        gainRows[channel] = arena.allocate<float> (maxBlockSize);
+
+    thresholdRamp = arena.allocate<float> (maxBlockSize);
+    slopeRamp = arena.allocate<float> (maxBlockSize);
+    kneeRamp = arena.allocate<float> (maxBlockSize);
+
+    // Every channel starts unlinked; the engine applies its link setting after preparing
+    linkGroups = arena.allocate<int> (numChannels);
+    rowForChannel = arena.allocate<int> (numChannels);
+    rowChannels = arena.allocate<int> (numChannels);
+    rowStart = arena.allocate<int> (numChannels + 1);
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        linkGroups[channel] = rowForChannel[channel] = -1;
+
+    updateRows();
+
+    // one slot per SIMD lane, rounded up to whole registers
+    const auto numGroups = (numChannels + Vec::size() - 1) / Vec::size();
+    envelopeState = arena.allocate<float> (numGroups * Vec::size());
+    envelopeTiles = arena.allocate<float> (numGroups * Vec::size() * envelopeTileLength);
+
+    peakHolds = arena.allocate<SlidingMaximum> (numChannels);
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        peakHolds[channel].prepare (arena, maxLookaheadSamples + 1);
+
+    lookaheadDelay.prepare (arena, static_cast<int> (numChannels), maxLookaheadSamples);
+    setLookahead (jmin (lookahead, maxLookaheadSamples));
+
+    maxRmsWindow = jmax (1, maxRmsWindowSamples);
+    rmsWindows = arena.allocate<RunningMeanSquare> (numChannels);
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        rmsWindows[channel].prepare (arena, maxRmsWindow);
+
+    truePeak.prepare (arena, static_cast<int> (numChannels));
+
+    log2Threshold.reset (sampleRate, thresholdRampSeconds);
+    slope.reset (sampleRate, thresholdRampSeconds);
+    log2Knee.reset (sampleRate, thresholdRampSeconds);
+    update();
+    updateRmsWindow();
+    reset();
+
+    gainCurve.prepare ({ log2Threshold.getTargetValue(), slope.getTargetValue(), log2Knee.getTargetValue() });
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::release()
+{
+    gainCurve.release();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::reset()
+{
+    const auto numGroups = (numChannels + Vec::size() - 1) / Vec::size();
+    FloatVectorOperations::clear (envelopeState, static_cast<int> (numGroups * Vec::size()));
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+    {
+        peakHolds[channel].reset();
+        rmsWindows[channel].reset();
+    }
+
+    truePeak.reset();
+    lookaheadDelay.reset();
+    log2Threshold.setCurrentAndTargetValue (log2Threshold.getTargetValue());
+    slope.setCurrentAndTargetValue (slope.getTargetValue());
+    log2Knee.setCurrentAndTargetValue (log2Knee.getTargetValue());
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::setSampleRate (double newSampleRate)
+{
+    jassert (newSampleRate > 0);
+
+    sampleRate = newSampleRate;
+    log2Threshold.reset (sampleRate, thresholdRampSeconds);
+    slope.reset (sampleRate, thresholdRampSeconds);
+    log2Knee.reset (sampleRate, thresholdRampSeconds);
+    update();
+    updateRmsWindow();
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::update()
+{
+    const auto expFactor = -2.0 * MathConstants<double>::pi * 1000.0 / sampleRate;
+    const auto calculateCte = [expFactor] (float timeMs)
+    {
+        return timeMs < 1.0e-3f ? 0.0f : static_cast<float> (std::exp (expFactor / timeMs));
+    };
+
+    cteAttack = calculateCte (attackTime);
+    cteRelease = calculateCte (releaseTime);
+    slope.setTargetValue (1.0f / ratio - 1.0f);
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::updateGainCurve() noexcept
+{
+    gainCurve.setSettings ({ log2Threshold.getTargetValue(), slope.getTargetValue(), log2Knee.getTargetValue() });
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::updateRmsWindow() noexcept
+{
+    const auto windowLength = jlimit (1, maxRmsWindow, roundToInt (rmsWindowMs * 0.001 * sampleRate));
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        rmsWindows[channel].setWindowLength (windowLength);
+}
+
+template <typename SampleType>
+bool SIMDCompressor<SampleType>::updateRows() noexcept
+{
+    if (numChannels == 0)
+        return false;
+
+    // Rows are numbered by each group's first channel, so the unlinked case is the identity
+    auto changed = false;
+    numRows = 0;
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+    {
+        auto row = -1;
+
+        if (linkGroups[channel] >= 0)
+            for (size_t earlier = 0; earlier < channel && row < 0; ++earlier)
+                if (linkGroups[earlier] == linkGroups[channel])
+                    row = rowForChannel[earlier];
+
+        if (row < 0)
+            row = static_cast<int> (numRows++);
+
+        changed = changed || rowForChannel[channel] != row;
+        rowForChannel[channel] = row;
+    }
+
+    // Counting sort of the channels by row
+    for (size_t row = 0; row <= numRows; ++row)
+        rowStart[row] = 0;
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        ++rowStart[rowForChannel[channel]];
+
+    for (size_t row = 1; row < numRows; ++row)
+        rowStart[row] += rowStart[row - 1];
+
+    for (auto channel = static_cast<int> (numChannels); --channel >= 0;)
+        rowChannels[--rowStart[rowForChannel[channel]]] = channel;
+
+    rowStart[numRows] = static_cast<int> (numChannels);
+
+    return changed;
+}
+
+//==============================================================================
+template <typename SampleType>
+void SIMDCompressor<SampleType>::computeGains (const dsp::AudioBlock<const SampleType>& detectorInput, WorkerPool* workers) noexcept
+{
+    jassert (detectorInput.getNumChannels() == numChannels);
+    jassert (detectorInput.getNumSamples() <= maxBlockSize);
+
+    const auto numSamples = detectorInput.getNumSamples();
+
+    // While the threshold, ratio or knee is gliding every row reads the same per-sample
+    // ramps; once settled, every row reads the table built for the targets, if it's ready
+    pendingThresholds = nullptr;
+    pendingSlopes = nullptr;
+    pendingKnees = nullptr;
+    pendingCurve = nullptr;
+
+    if (log2Threshold.isSmoothing() || slope.isSmoothing() || log2Knee.isSmoothing())
+    {
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            thresholdRamp[i] = log2Threshold.getNextValue();
+            slopeRamp[i] = slope.getNextValue();
+            kneeRamp[i] = log2Knee.getNextValue();
+        }
+
+        pendingThresholds = thresholdRamp;
+        pendingSlopes = slopeRamp;
+        pendingKnees = kneeRamp;
+    }
+    else
+    {
+        pendingCurve = gainCurve.acquire ({ log2Threshold.getTargetValue(), slope.getTargetValue(), log2Knee.getTargetValue() });
+    }
+
+    pendingInput = &detectorInput;
+    rowPointers = gainRows;
+
+    if (workers != nullptr && numRows > rowsPerTask)
+    {
+        auto computeTask = [] (void* context, int task)
+        {
+            auto& compressor = *static_cast<SIMDCompressor*> (context);
+            const auto firstRow = static_cast<size_t> (task) * rowsPerTask;
+            compressor.computeRows (firstRow, jmin (firstRow + rowsPerTask, compressor.numRows));
+        };
+
+        workers->run (static_cast<int> ((numRows + rowsPerTask - 1) / rowsPerTask), computeTask, this);
+    }
+    else
+    {
+        computeRows (0, numRows);
+    }
+
+    pendingInput = nullptr;
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::computeRows (size_t firstRow, size_t lastRow) noexcept
+{
+    const auto& detectorInput = *pendingInput;
+    const auto numSamples = detectorInput.getNumSamples();
+
+    for (auto row = firstRow; row < lastRow; ++row)
+    {
+        detectRow (row, numSamples);
+        peakHolds[row].process (rowPointers[row], numSamples);
+    }
+
+    if (numRows == 1)
+        runLinkedEnvelope (numSamples);
+    else
+        runEnvelopes (firstRow, lastRow, numSamples);
+
+    for (auto row = firstRow; row < lastRow; ++row)
+        computeGainRow (rowPointers[row], numSamples);
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::detectRow (size_t row, size_t numSamples) noexcept
+{
+    const auto& detectorInput = *pendingInput;
+    auto* level = rowPointers[row];
+    const auto* channel = rowChannels + rowStart[row];
+    const auto* lastChannel = rowChannels + rowStart[row + 1];
+
+    // Fill the gain row with the detector's level; a row shared by several channels holds
+    // the peak, the mean power or the highest true peak across them
+    switch (detectorMode)
+    {
+        case DetectorMode::peak:
+        {
+            rectify (level, detectorInput.getChannelPointer (static_cast<size_t> (*channel)), static_cast<int> (numSamples));
+
+            while (++channel != lastChannel)
+            {
+                const auto* input = detectorInput.getChannelPointer (static_cast<size_t> (*channel));
+
+                for (size_t i = 0; i < numSamples; ++i)
+                    level[i] = jmax (level[i], static_cast<float> (std::abs (input[i])));
+            }
+
+            break;
+        }
+
+        case DetectorMode::rms:
+        {
+            square (level, detectorInput.getChannelPointer (static_cast<size_t> (*channel)), static_cast<int> (numSamples));
+
+            while (++channel != lastChannel)
+            {
+                const auto* input = detectorInput.getChannelPointer (static_cast<size_t> (*channel));
+
+                for (size_t i = 0; i < numSamples; ++i)
+                    level[i] += static_cast<float> (input[i] * input[i]);
+            }
+
+            const auto numRowChannels = rowStart[row + 1] - rowStart[row];
+
+            if (numRowChannels > 1)
+                FloatVectorOperations::multiply (level, 1.0f / static_cast<float> (numRowChannels), static_cast<int> (numSamples));
+
+            rmsWindows[row].process (level, numSamples);
+            break;
+        }
+
+        case DetectorMode::truePeak:
+        {
+            FloatVectorOperations::clear (level, static_cast<int> (numSamples));
+
+            for (; channel != lastChannel; ++channel)
+                truePeak.process (*channel, detectorInput.getChannelPointer (static_cast<size_t> (*channel)), level, numSamples);
+
+            break;
+        }
+    }
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::applyGains (dsp::AudioBlock<SampleType>& block) const noexcept
+{
+    jassert (block.getNumChannels() == numChannels);
+
+    const auto numSamples = static_cast<int> (block.getNumSamples());
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        multiply (block.getChannelPointer (channel), getGains (channel), numSamples);
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::applyGainsDecimated (dsp::AudioBlock<SampleType>& block, size_t factor) const noexcept
+{
+    jassert (block.getNumChannels() == numChannels);
+    jassert (block.getNumSamples() * factor <= maxBlockSize);
+
+    const auto numSamples = block.getNumSamples();
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+    {
+        auto* samples = block.getChannelPointer (channel);
+        const auto* gains = getGains (channel);
+
+        for (size_t i = 0; i < numSamples; ++i, gains += factor)
+        {
+            auto gain = gains[0];
+
+            for (size_t j = 1; j < factor; ++j)
+                gain = jmin (gain, gains[j]);
+
+            samples[i] *= gain;
+        }
+    }
+}
+
+template <typename SampleType>
+const float* SIMDCompressor<SampleType>::getGains (size_t channel) const noexcept
+{
+    return gainRows[rowForChannel[channel]];
+}
+
+template <typename SampleType>
+float SIMDCompressor<SampleType>::getMinimumGain (size_t numSamples) const noexcept
+{
+    auto minimum = 1.0f;
+
+    for (size_t row = 0; row < numRows; ++row)
+        minimum = jmin (minimum, FloatVectorOperations::findMinimum (gainRows[row], static_cast<int> (numSamples)));
+
+    return minimum;
+}
+
+//==============================================================================
+template <typename SampleType>
+void SIMDCompressor<SampleType>::runLinkedEnvelope (size_t numSamples) noexcept
+{
+    auto* envelope = rowPointers[0];
+    auto yold = envelopeState[0];
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const auto x = envelope[i];
+        const auto cte = x > yold ? cteAttack : cteRelease;
+        yold = x + cte * (yold - x);
+        envelope[i] = yold;
+    }
+
+    envelopeState[0] = yold;
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::runEnvelopes (size_t firstRow, size_t lastRow, size_t numSamples) noexcept
+{
+    jassert (firstRow % Vec::size() == 0);
+
+    const auto attack = Vec::expand (cteAttack);
+    const auto release = Vec::expand (cteRelease);
+
+    for (auto first = firstRow; first < lastRow; first += Vec::size())
+    {
+        const auto numLanes = jmin (Vec::size(), lastRow - first);
+        auto* tile = envelopeTiles + first * envelopeTileLength;
+        auto yold = Vec::fromRawArray (envelopeState + first);
+
+        // Lanes without a row run on whatever the tile holds and are never written back
+        for (size_t start = 0; start < numSamples; start += envelopeTileLength)
+        {
+            const auto tileLength = jmin (envelopeTileLength, numSamples - start);
+
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                const auto* envelope = rowPointers[first + lane] + start;
+
+                for (size_t i = 0; i < tileLength; ++i)
+                    tile[i * Vec::size() + lane] = envelope[i];
+            }
+
+            for (size_t i = 0; i < tileLength; ++i)
+            {
+                auto* frame = tile + i * Vec::size();
+                const auto x = Vec::fromRawArray (frame);
+                const auto isAttacking = Vec::greaterThan (x, yold);
+                const auto cte = (attack & isAttacking) + (release & ~isAttacking);
+
+                yold = x + cte * (yold - x);
+                yold.copyToRawArray (frame);
+            }
+
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                auto* envelope = rowPointers[first + lane] + start;
+
+                for (size_t i = 0; i < tileLength; ++i)
+                    envelope[i] = tile[i * Vec::size() + lane];
+            }
+        }
+
+        yold.copyToRawArray (envelopeState + first);
+    }
+}
+
+template <typename SampleType>
+void SIMDCompressor<SampleType>::computeGainRow (float* envelopeInGainOut, size_t numSamples) const noexcept
+{
+    if (pendingCurve != nullptr)
+    {
+        GainCurveTable::lookup (pendingCurve, envelopeInGainOut, numSamples);
+        return;
+    }
+
+    // Written so the loops auto-vectorise
+    if (pendingThresholds != nullptr)
+    {
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            const auto level = FastMath::log2 (jmax (envelopeInGainOut[i], 1.0e-20f));
+            envelopeInGainOut[i] = FastMath::exp2 (GainCurveSettings::getGain (level, pendingThresholds[i], pendingSlopes[i], pendingKnees[i]));
+        }
+
+        return;
+    }
+
+    const auto threshold = log2Threshold.getTargetValue();
+    const auto targetSlope = slope.getTargetValue();
+    const auto knee = log2Knee.getTargetValue();
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const auto level = FastMath::log2 (jmax (envelopeInGainOut[i], 1.0e-20f));
+        envelopeInGainOut[i] = FastMath::exp2 (GainCurveSettings::getGain (level, threshold, targetSlope, knee));
+    }
+}
+
+//==============================================================================
+template class SIMDCompressor<float>;
+template class SIMDCompressor<double>;
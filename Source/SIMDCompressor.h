@@ -0,0 +1,227 @@
+/*
+  ==============================================================================
+
+    This file contains the SIMD compressor kernel used by the plugin processor.
+
+    Channels are processed together in SIMD lanes so that the envelope
+    followers of up to SIMDRegister<float>::size() channels run in one pass,
+    and the gain computer works on contiguous gain rows. Once the threshold,
+    ratio and knee have settled it reads each gain from a precomputed curve
+    table (see GainCurveTable); while they glide, or until the table for new
+    settings is ready, it evaluates the curve with branch-free approximations
+    of log2/exp2. Channels can be gathered into link groups: each group gets
+    one detector row, fed by the per-sample peak across its channels, and
+    linked mode is simply one group holding every channel.
+
+    In unlinked mode with the peak detector and a hard knee the output
+    matches dsp::Compressor<float> (same ballistics, same curve) within
+    1e-4 dB of gain while gliding, and within the table's 0.031 dB once
+    settled. The RMS and true-peak detectors replace only the rectifier in
+    front of the ballistics: a linked row takes the mean power or the
+    highest true peak across its channels.
+
+    The audio path runs at SampleType precision, so a double-precision host
+    needs no conversion copies. The detector and the gain rows are always
+    float: the gain curve is no more accurate than that anyway.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Lookahead.h"
+#include "Detectors.h"
+#include "WorkerPool.h"
+#include "GainCurve.h"
+
+//==============================================================================
+template <typename SampleType>
+class SIMDCompressor
+{
+public:
+    enum class LinkMode
+    {
+        unlinked = 0,
+        linked
+    };
+
+    enum class DetectorMode
+    {
+        peak = 0,
+        rms,
+        truePeak
+    };
+
+    //==============================================================================
+    void setThreshold (float newThresholddB);
+    void setRatio (float newRatio);
+
+    /** Sets the width of the soft knee centred on the threshold; 0 is a hard knee. */
+    void setKnee (float newKneedB);
+    void setAttack (float newAttackMs);
+    void setRelease (float newReleaseMs);
+    void setLinkMode (LinkMode newLinkMode);
+
+    /** Selects what the ballistics follow. Switching starts the new detector
+        from silence, and is safe to call from the audio thread.
+    */
+    void setDetectorMode (DetectorMode newDetectorMode) noexcept;
+
+    /** How many samples the selected detector's levels trail its input by. */
+    int getDetectorLatency() const noexcept         { return detectorMode == DetectorMode::truePeak ? TruePeakDetector::latencySamples : 0; }
+
+    /** Sets the RMS detector's window, clamped to the length given to prepare(). */
+    void setRmsWindow (float newWindowMs) noexcept;
+
+    /** Channels given the same non-negative group share one detector; channels
+        with a negative group keep their own. Reads one entry per prepared channel
+        and never allocates, so it is safe to call from the audio thread.
+    */
+    void setLinkGroups (const int* groupForChannel) noexcept;
+
+    /** Delays the audio by this many samples and holds detector peaks over the
+        same window, less the detector's own latency, so gain reduction is in
+        place before a transient arrives. It must be at least that latency for
+        the gain to line up with the audio at all.
+    */
+    void setLookahead (int newLookaheadSamples) noexcept;
+    int getLookahead() const noexcept               { return lookahead; }
+
+    //==============================================================================
+    /** Takes every buffer the kernel needs from the arena, sized for the largest
+        block, lookahead and RMS window it will be asked for.
+    */
+    void prepare (MemoryArena& arena, const dsp::ProcessSpec& spec, int maxLookaheadSamples = 0, int maxRmsWindowSamples = 0);
+
+    /** Frees the gain curve tables, which live outside the arena. */
+    void release();
+    size_t getExternalMemoryBytes() const noexcept  { return gainCurve.getMemoryBytes(); }
+    void reset();
+
+    /** Changes the rate the detector runs at without reallocating, e.g. when the
+        oversampling factor changes. Blocks must still fit the prepared maximum size.
+    */
+    void setSampleRate (double newSampleRate);
+
+    /** Runs the detector and gain computer over a block, leaving one gain row per
+        link group ready for applyGains(). If a worker pool is given, the rows are
+        split into independent tasks across it.
+    */
+    void computeGains (const dsp::AudioBlock<const SampleType>& detectorInput, WorkerPool* workers = nullptr) noexcept;
+
+    /** Multiplies a block by the gains computed by the last computeGains() call. */
+    void applyGains (dsp::AudioBlock<SampleType>& block) const noexcept;
+
+    /** Applies gains computed at factor times the block's rate, using the deepest
+        reduction within each group of factor gains so decimation cannot miss a peak.
+    */
+    void applyGainsDecimated (dsp::AudioBlock<SampleType>& block, size_t factor) const noexcept;
+
+    const float* getGains (size_t channel) const noexcept;
+
+    /** Returns the smallest gain left by the last computeGains() call, for metering. */
+    float getMinimumGain (size_t numSamples) const noexcept;
+
+    template <typename ProcessContext>
+    void process (const ProcessContext& context, WorkerPool* workers = nullptr) noexcept
+    {
+        processWithKey (context, context.getInputBlock(), workers);
+    }
+
+    /** Like process(), but the detector listens to a separate key signal, e.g. a
+        sidechain. The key must have the same number of channels and samples.
+    */
+    template <typename ProcessContext>
+    void processWithKey (const ProcessContext& context, const dsp::AudioBlock<const SampleType>& key, WorkerPool* workers = nullptr) noexcept
+    {
+        const auto& inputBlock = context.getInputBlock();
+        auto& outputBlock = context.getOutputBlock();
+
+        jassert (inputBlock.getNumChannels() == outputBlock.getNumChannels());
+        jassert (inputBlock.getNumSamples() == outputBlock.getNumSamples());
+
+        if (context.isBypassed)
+        {
+            outputBlock.copyFrom (inputBlock);
+            return;
+        }
+
+        computeGains (key, workers);
+
+        if (context.usesSeparateInputAndOutputBlocks())
+            outputBlock.copyFrom (inputBlock);
+
+        lookaheadDelay.process (outputBlock);
+        applyGains (outputBlock);
+    }
+
+private:
+    using Vec = dsp::SIMDRegister<float>;
+
+    void update();
+    void updateRmsWindow() noexcept;
+    bool updateRows() noexcept;
+    void computeRows (size_t firstRow, size_t lastRow) noexcept;
+    void detectRow (size_t row, size_t numSamples) noexcept;
+    void runLinkedEnvelope (size_t numSamples) noexcept;
+    void runEnvelopes (size_t firstRow, size_t lastRow, size_t numSamples) noexcept;
+    void updateGainCurve() noexcept;
+    void computeGainRow (float* envelopeInGainOut, size_t numSamples) const noexcept;
+
+    //==============================================================================
+    float** gainRows = nullptr;
+    float* envelopeState = nullptr;
+
+    // One register of rows at a time is transposed through these, a tile of
+    // samples at a time, so the envelope loop reads and writes whole registers.
+    // Each register group has its own, so tasks never share one.
+    static constexpr size_t envelopeTileLength = 64;
+    float* envelopeTiles = nullptr;
+    size_t numChannels = 0, maxBlockSize = 0;
+
+    // Detector rows: each link group's channels are listed in rowChannels
+    // from rowStart[row] up to rowStart[row + 1]
+    int* linkGroups = nullptr;
+    int* rowForChannel = nullptr;
+    int* rowChannels = nullptr;
+    int* rowStart = nullptr;
+    size_t numRows = 0;
+
+    // Whole SIMD registers per task, so no two tasks share an envelope group
+    static constexpr size_t rowsPerTask = 2 * Vec::SIMDNumElements;
+
+    // The block being worked on, shared with the tasks of one computeGains() call
+    const dsp::AudioBlock<const SampleType>* pendingInput = nullptr;
+    float* const* rowPointers = nullptr;
+    const float* pendingThresholds = nullptr;
+    const float* pendingSlopes = nullptr;
+    const float* pendingKnees = nullptr;
+    const float* pendingCurve = nullptr;
+
+    SlidingMaximum* peakHolds = nullptr;
+
+    // RMS windows are per detector row, true-peak histories per channel
+    DetectorMode detectorMode = DetectorMode::peak;
+    RunningMeanSquare* rmsWindows = nullptr;
+    int maxRmsWindow = 1;
+    float rmsWindowMs = 10.0f;
+    TruePeakDetector truePeak;
+
+    LookaheadDelay<SampleType> lookaheadDelay;
+    int lookahead = 0;
+
+    double sampleRate = 44100.0;
+    float thresholddB = 0.0f, ratio = 1.0f, kneedB = 0.0f, attackTime = 1.0f, releaseTime = 100.0f;
+    float cteAttack = 0.0f, cteRelease = 0.0f;
+
+    // Threshold and knee (in log2 units) and ratio changes glide over this time, so
+    // neither automation nor a program change steps the gain
+    static constexpr double thresholdRampSeconds = 0.05;
+    SmoothedValue<float> log2Threshold, slope, log2Knee;
+    float* thresholdRamp = nullptr;
+    float* slopeRamp = nullptr;
+    float* kneeRamp = nullptr;
+
+    GainCurveTable gainCurve;
+};
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    This file contains a small fork/join worker pool for splitting one block's
+    DSP work across threads.
+
+  ==============================================================================
+*/
+
+#include "WorkerPool.h"
+
+//==============================================================================
+class WorkerPool::Worker  : public Thread
+{
+public:
+    Worker (WorkerPool& p, int index)
+        : Thread ("Compressor worker " + String (index)), pool (p)
+    {
+    }
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            wait (-1);
+
+            if (threadShouldExit())
+                break;
+
+            pool.runPendingTasks();
+        }
+    }
+
+private:
+    WorkerPool& pool;
+};
+
+//==============================================================================
+WorkerPool::WorkerPool (int numWorkers)
+{
+    for (int i = 0; i < numWorkers; ++i)
+        workers.add (new Worker (*this, i))->startThread (9);
+}
+
+WorkerPool::~WorkerPool()
+{
+    for (auto* worker : workers)
+    {
+        worker->signalThreadShouldExit();
+        worker->notify();
+    }
+
+    for (auto* worker : workers)
+        worker->stopThread (1000);
+}
+
+void WorkerPool::run (int newNumTasks, Task task, void* context) noexcept
+{
+    // Another instance has the workers; this batch is no worse off on its own thread
+    if (busy.exchange (true, std::memory_order_acquire))
+    {
+        for (int i = 0; i < newNumTasks; ++i)
+            task (context, i);
+
+        return;
+    }
+
+    // Close the previous batch before touching the task, so a late worker can't start it
+    numTasks = 0;
+
+    currentTask = task;
+    currentContext = context;
+    tasksRemaining = newNumTasks;
+    nextTask = 0;
+    numTasks = newNumTasks;
+
+    for (int i = 0; i < jmin (workers.size(), newNumTasks - 1); ++i)
+        workers.getUnchecked (i)->notify();
+
+    runPendingTasks();
+
+    while (tasksRemaining.load() > 0)
+        Thread::yield();
+
+    busy.store (false, std::memory_order_release);
+}
+
+void WorkerPool::runPendingTasks() noexcept
+{
+    for (;;)
+    {
+        auto index = nextTask.load();
+
+        if (index >= numTasks.load())
+            return;
+
+        // Only claim an index that is still current, so a stale read can never swallow one
+        if (nextTask.compare_exchange_weak (index, index + 1))
+        {
+            currentTask (currentContext, index);
+            --tasksRemaining;
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    This file contains a small fork/join worker pool for splitting one block's
+    DSP work across threads.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** Runs a fixed number of independent tasks across a set of parked threads.
+
+    run() never allocates: the task is a plain function pointer plus context,
+    workers claim task indices from an atomic counter, and the calling thread
+    joins in until every task is done. One batch runs at a time; a caller that
+    finds the pool busy runs its tasks itself rather than waiting.
+*/
+class WorkerPool
+{
+public:
+    using Task = void (*) (void* context, int taskIndex);
+
+    explicit WorkerPool (int numWorkers);
+    ~WorkerPool();
+
+    int getNumWorkers() const noexcept              { return workers.size(); }
+
+    /** Calls task (context, i) for every i in [0, numTasks) and returns once all calls have finished.
+        Safe to call from several threads at once.
+    */
+    void run (int numTasks, Task task, void* context) noexcept;
+
+private:
+    class Worker;
+
+    void runPendingTasks() noexcept;
+
+    OwnedArray<Worker> workers;
+
+    Task currentTask = nullptr;
+    void* currentContext = nullptr;
+    std::atomic<int> numTasks { 0 }, nextTask { 0 }, tasksRemaining { 0 };
+    std::atomic<bool> busy { false };
+
+    JUCE_DECLARE_NON_COPYABLE (WorkerPool)
+};
+
+//==============================================================================
+/** The one pool every instance in the process shares through a SharedResourcePointer,
+    so a session full of instances parks a handful of threads rather than a handful each.
+*/
+class SharedWorkerPool  : public WorkerPool
+{
+public:
+    static constexpr int maxWorkers = 7;
+
+    SharedWorkerPool() : WorkerPool (jlimit (0, maxWorkers, SystemStats::getNumCpus() - 1)) {}
+};
@@ -10,12 +10,49 @@
 */
 
 #include "myLookAndFeel.h"
+#include "KnobImage.h"
+
+//==============================================================================
+KnobFilmstrip::KnobFilmstrip()
+    : filmstrip (ImageCache::getFromMemory (KnobImage::png, KnobImage::pngSize))
+{
+    // A strip shorter than it is wide holds no whole frame
+    if (filmstrip.isValid())
+        numFrames = filmstrip.getHeight() / filmstrip.getWidth();
+}
+
+const Image& KnobFilmstrip::getFrame (int frameIndex, int sizeInPixels)
+{
+    JUCE_ASSERT_MESSAGE_MANAGER_IS_LOCKED
+    jassert (isValid());
+
+    // Every window resize or display move can ask for a new size, so old ones are dropped
+    if (framesBySize.size() >= maxCachedSizes && framesBySize.find (sizeInPixels) == framesBySize.end())
+        framesBySize.clear();
+
+    auto& frames = framesBySize[sizeInPixels];
+
+    if (frames.empty())
+    {
+        const auto frameSize = filmstrip.getWidth();
+        frames.reserve (static_cast<size_t> (numFrames));
+
+        for (int i = 0; i < numFrames; ++i)
+        {
+            Image frame (Image::ARGB, sizeInPixels, sizeInPixels, true);
+            Graphics g (frame);
+            g.setImageResamplingQuality (Graphics::highResamplingQuality);
+            g.drawImage (filmstrip, 0, 0, sizeInPixels, sizeInPixels, 0, i * frameSize, frameSize, frameSize);
+            frames.push_back (frame);
+        }
+    }
+
+    return frames[static_cast<size_t> (jlimit (0, numFrames - 1, frameIndex))];
+}
 
 //==============================================================================
 myLookAndFeelV1::myLookAndFeelV1()
 {
-    File knobImageFile1 = File::getSpecialLocation(File::SpecialLocationType::userDesktopDirectory).getChildFile("knob2.png");
-    img1 = ImageCache::getFromFile(knobImageFile1);
 }
 
 //==============================================================================
@@ -23,11 +60,10 @@ void myLookAndFeelV1::drawRotarySlider(Graphics& g,
     int x, int y, int width, int height, float sliderPos,
     float rotaryStartAngle, float rotaryEndAngle, Slider& slider)
 {
-
-    if (img1.isValid())
+    if (filmstrip->isValid())
     {
         const double rotation = (slider.getValue() - slider.getMinimum()) / (slider.getMaximum() - slider.getMinimum());
-        const int frames = img1.getHeight() / img1.getWidth();
+        const int frames = filmstrip->getNumFrames();
         const int frameId = (int)ceil(rotation * ((double)frames - 1.0));
         const float radius = jmin(width / 2.0f, height / 2.0f);
         const float centerX = x + width * 0.5f;
@@ -35,15 +71,19 @@ void myLookAndFeelV1::drawRotarySlider(Graphics& g,
         const float rx = centerX - radius - 1.0f;
         const float ry = centerY - radius;
 
-        g.drawImage(img1, (int)rx, (int)ry,2 * (int)radius, 2 * (int)radius, 0,frameId * img1.getWidth(), img1.getWidth(), img1.getWidth());
+        // Draw at the display's physical resolution so the blit needs no rescaling
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        const int sizeInPixels = roundToInt(2 * (int)radius * scale);
+        const Image& frame = filmstrip->getFrame(frameId, sizeInPixels);
+
+        if (scale == 1.0f)
+            g.drawImageAt(frame, (int)rx, (int)ry);
+        else
+            g.drawImageTransformed(frame, AffineTransform::scale(1.0f / scale).translated((float)(int)rx, (float)(int)ry));
     }
     else
     {
-        static const float textPpercent = 0.35f;
-        Rectangle<float> text_bounds(1.0f + width * (1.0f - textPpercent) / 2.0f, 0.5f * height, width * textPpercent, 0.5f * height);
-
-        g.setColour(Colours::white);
-
-        g.drawFittedText(String("No Image"), text_bounds.getSmallestIntegerContainer(), Justification::horizontallyCentred | Justification::centred, 1);
+        // Without the filmstrip the knobs still have to be usable
+        LookAndFeel_V4::drawRotarySlider(g, x, y, width, height, sliderPos, rotaryStartAngle, rotaryEndAngle, slider);
     }
 }
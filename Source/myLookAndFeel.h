@@ -12,6 +12,33 @@
 #pragma once
 #include "../JuceLibraryCode/JuceHeader.h"
 
+//==============================================================================
+/** The knob filmstrip, decoded once per process and shared by every editor.
+
+    The image is compiled into the plugin (see KnobImage.h); if it ever fails
+    to decode, the knobs fall back to LookAndFeel_V4's drawing. Frames are
+    cut out and rescaled the first time a knob of a given physical pixel size
+    is drawn, so repaints afterwards are plain unscaled blits; only the last
+    few sizes are kept. Only touched from the message thread.
+*/
+class KnobFilmstrip
+{
+public:
+    KnobFilmstrip();
+
+    bool isValid() const noexcept               { return numFrames > 0; }
+    int getNumFrames() const noexcept           { return numFrames; }
+
+    const Image& getFrame (int frameIndex, int sizeInPixels);
+
+private:
+    static constexpr size_t maxCachedSizes = 8;
+
+    Image filmstrip;
+    int numFrames = 0;
+    std::map<int, std::vector<Image>> framesBySize;
+};
+
 //==============================================================================
 class myLookAndFeelV1 : public LookAndFeel_V4
 {
@@ -22,5 +49,5 @@ public:
         float rotaryStartAngle, float rotaryEndAngle, Slider& slider) override;
 
 private:
-    Image img1;
-};
\ No newline at end of file
+    SharedResourcePointer<KnobFilmstrip> filmstrip;
+};
@@ -0,0 +1,323 @@
+/*
+  ==============================================================================
+
+    This file contains the multi-stream engine benchmark.
+
+    It runs a StreamEngine at each requested stream count over a loopback
+    stand-in for the audio device: every stream plays the same material,
+    an audio file or generated bursts of noise, from its own offset, and a
+    control thread keeps sending parameter changes through the command
+    queue while it runs. It reports the real-time factor across all
+    streams, p50/p99/max period time against the period's deadline, how
+    many periods and streams missed it, and the longest the calling thread
+    spun waiting for the workers to finish a period. Build it as a console application
+    compiling the plugin's Source files and StreamEngine.cpp alongside this
+    one, with the same JucePlugin_* definitions as the plugin target.
+
+    Usage:
+        StreamEngine [--streams <n,n,...>] [--cores <c,c,...>] [--block <samples>]
+                     [--rate <hz>] [--channels <n>] [--seconds <s>]
+                     [--input <file>] [--realtime] [--output <results.csv>]
+
+    By default it runs 16, 64 and 256 streams as fast as they go, which
+    measures throughput. --realtime paces periods to the wall clock like a
+    real device, which is what the deadline counts are for: each stream
+    count then passes only if no period finished late, and the run exits
+    with 1 if any count failed.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <iostream>
+#include <thread>
+#include "StreamEngine.h"
+
+//==============================================================================
+/** Stands in for a multi-stream audio interface, looping one piece of material into every stream. */
+class LoopbackDevice
+{
+public:
+    LoopbackDevice (const File& input, int numChannels, double sampleRate)
+    {
+        AudioFormatManager formatManager;
+        formatManager.registerBasicFormats();
+
+        if (std::unique_ptr<AudioFormatReader> reader { formatManager.createReaderFor (input) })
+        {
+            const auto length = static_cast<int> (jmin (reader->lengthInSamples, static_cast<int64> (sampleRate * 60.0)));
+            material.setSize (numChannels, length);
+            reader->read (&material, 0, length, 0, true, true);
+
+            // Mono files feed every channel
+            for (int channel = static_cast<int> (reader->numChannels); channel < numChannels; ++channel)
+                material.copyFrom (channel, 0, material, 0, 0, length);
+
+            return;
+        }
+
+        // Ten seconds of noise bursts at changing levels, so the compressor keeps moving
+        Random random (0x5eed);
+        material.setSize (numChannels, static_cast<int> (sampleRate * 10.0));
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int i = 0; i < material.getNumSamples(); ++i)
+            {
+                const auto burst = (i / static_cast<int> (sampleRate * 0.25)) % 4;
+                material.setSample (channel, i, (random.nextFloat() * 2.0f - 1.0f) * (burst == 3 ? 0.0f : 0.1f * static_cast<float> (burst + 1)));
+            }
+    }
+
+    /** Copies the next period of material into every stream. */
+    void read (StreamEngine& engine, int64 period)
+    {
+        const auto length = material.getNumSamples();
+
+        for (int stream = 0; stream < engine.getNumStreams(); ++stream)
+        {
+            auto& buffer = engine.getStreamBuffer (stream);
+            const auto numSamples = buffer.getNumSamples();
+
+            // A prime stride keeps the streams out of step with each other
+            auto position = static_cast<int> ((period * numSamples + static_cast<int64> (stream) * 7919) % length);
+
+            for (int done = 0; done < numSamples;)
+            {
+                const auto chunk = jmin (numSamples - done, length - position);
+
+                for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+                    buffer.copyFrom (channel, done, material, channel % material.getNumChannels(), position, chunk);
+
+                done += chunk;
+                position = (position + chunk) % length;
+            }
+        }
+    }
+
+private:
+    AudioBuffer<float> material;
+};
+
+//==============================================================================
+struct RunSettings
+{
+    Array<int> cores;
+    int blockSize = 256, numChannels = 2;
+    double sampleRate = 48000.0, secondsOfAudio = 10.0;
+    File input;
+    bool realtime = false;
+};
+
+struct RunResult
+{
+    int numStreams = 0, numWorkers = 0;
+    double realTimeFactor = 0.0, deadlineMicros = 0.0;
+    double p50Micros = 0.0, p99Micros = 0.0, maxMicros = 0.0, worstStreamMicros = 0.0, maxWaitMicros = 0.0;
+    uint64 numPeriods = 0, periodMisses = 0, streamMisses = 0, commandsDropped = 0;
+};
+
+static int findParameterIndex (CompressorAudioProcessor& processor, const String& id)
+{
+    auto* parameter = processor.getState().getParameter (id);
+    return parameter != nullptr ? parameter->getParameterIndex() : -1;
+}
+
+static RunResult runStreams (int numStreams, const RunSettings& settings, LoopbackDevice& device)
+{
+    StreamEngine::Config config;
+    config.numStreams = numStreams;
+    config.numChannels = settings.numChannels;
+    config.sampleRate = settings.sampleRate;
+    config.blockSize = settings.blockSize;
+    config.cores = settings.cores;
+
+    StreamEngine engine (config);
+
+    const auto thresholdIndex = findParameterIndex (engine.getProcessor (0), "threshold");
+    const auto ratioIndex = findParameterIndex (engine.getProcessor (0), "ratio");
+    const auto numPeriods = jmax (100, static_cast<int> (settings.secondsOfAudio * settings.sampleRate / settings.blockSize));
+    const auto numWarmUpPeriods = 10;
+    const auto periodSeconds = settings.blockSize / settings.sampleRate;
+
+    // The control thread sweeps a few streams' settings every few periods, the way an
+    // automation or remote-control client would
+    std::atomic<bool> finished { false };
+    std::atomic<uint64> commandsDropped { 0 };
+
+    std::thread control ([&]
+    {
+        Random random (0xc0de);
+
+        while (! finished.load())
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                const auto stream = random.nextInt (numStreams);
+
+                if (! engine.setParameter (stream, thresholdIndex, random.nextFloat())
+                    || ! engine.setParameter (stream, ratioIndex, random.nextFloat() * 0.5f))
+                    ++commandsDropped;
+            }
+
+            Thread::sleep (jmax (1, static_cast<int> (periodSeconds * 4000.0)));
+        }
+    });
+
+    std::vector<double> periodTimes;
+    periodTimes.reserve (static_cast<size_t> (numPeriods));
+
+    double totalSeconds = 0.0;
+    const auto runStart = Time::getHighResolutionTicks();
+
+    for (int period = 0; period < numWarmUpPeriods + numPeriods; ++period)
+    {
+        if (period == numWarmUpPeriods)
+            engine.resetStatistics();
+
+        device.read (engine, period);
+
+        const auto start = Time::getHighResolutionTicks();
+        engine.processPeriod();
+        const auto seconds = Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - start);
+
+        if (period >= numWarmUpPeriods)
+        {
+            periodTimes.push_back (seconds);
+            totalSeconds += seconds;
+        }
+
+        if (settings.realtime)
+        {
+            // Wait for the device to want the next period
+            const auto due = runStart + Time::secondsToHighResolutionTicks ((period + 1) * periodSeconds);
+
+            while (Time::getHighResolutionTicks() < due)
+                Thread::yield();
+        }
+    }
+
+    finished = true;
+    control.join();
+
+    std::sort (periodTimes.begin(), periodTimes.end());
+    const auto percentile = [&periodTimes] (double p) { return periodTimes[static_cast<size_t> (p * (periodTimes.size() - 1))] * 1.0e6; };
+
+    RunResult result;
+    result.numStreams = numStreams;
+    result.numWorkers = engine.getNumWorkers();
+    result.realTimeFactor = numStreams * numPeriods * periodSeconds / totalSeconds;
+    result.deadlineMicros = periodSeconds * 1.0e6;
+    result.p50Micros = percentile (0.5);
+    result.p99Micros = percentile (0.99);
+    result.maxMicros = periodTimes.back() * 1.0e6;
+
+    const auto periodStatistics = engine.getPeriodStatistics();
+    result.numPeriods = periodStatistics.numPeriods;
+    result.periodMisses = periodStatistics.deadlineMisses;
+    result.maxWaitMicros = periodStatistics.maxWaitMicros;
+
+    for (int stream = 0; stream < numStreams; ++stream)
+    {
+        const auto streamStatistics = engine.getStreamStatistics (stream);
+        result.streamMisses += streamStatistics.deadlineMisses;
+        result.worstStreamMicros = jmax (result.worstStreamMicros, streamStatistics.maxMicros);
+    }
+
+    result.commandsDropped = commandsDropped.load();
+    return result;
+}
+
+//==============================================================================
+static const char* csvHeader = "streams,workers,blockSize,sampleRate,channels,realtime,realTimeFactor,deadlineus,p50us,p99us,maxus,worstStreamus,periods,periodMisses,streamMisses,commandsDropped,maxWaitus";
+
+static String toCsvRow (const RunSettings& settings, const RunResult& result)
+{
+    String row;
+    row << result.numStreams << "," << result.numWorkers << "," << settings.blockSize << "," << settings.sampleRate << ","
+        << settings.numChannels << "," << (settings.realtime ? 1 : 0) << "," << String (result.realTimeFactor, 2) << ","
+        << String (result.deadlineMicros, 1) << "," << String (result.p50Micros, 2) << "," << String (result.p99Micros, 2) << ","
+        << String (result.maxMicros, 2) << "," << String (result.worstStreamMicros, 2) << "," << String (result.numPeriods) << ","
+        << String (result.periodMisses) << "," << String (result.streamMisses) << "," << String (result.commandsDropped) << ","
+        << String (result.maxWaitMicros, 2);
+    return row;
+}
+
+static Array<int> parseList (const String& text)
+{
+    StringArray tokens;
+    tokens.addTokens (text, ",", "");
+
+    Array<int> values;
+
+    for (auto& token : tokens)
+        if (token.trim().isNotEmpty())
+            values.add (token.trim().getIntValue());
+
+    return values;
+}
+
+int main (int argc, char* argv[])
+{
+    ScopedJuceInitialiser_GUI juceInitialiser;
+
+    ArgumentList args (argc, argv);
+    RunSettings settings;
+    Array<int> streamCounts { 16, 64, 256 };
+    File outputFile;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        const auto& arg = args[i];
+
+        if (arg == "--streams" && i + 1 < args.size())
+            streamCounts = parseList (args[++i].text);
+        else if (arg == "--cores" && i + 1 < args.size())
+            settings.cores = parseList (args[++i].text);
+        else if (arg == "--block" && i + 1 < args.size())
+            settings.blockSize = jmax (1, args[++i].text.getIntValue());
+        else if (arg == "--rate" && i + 1 < args.size())
+            settings.sampleRate = jmax (8000.0, args[++i].text.getDoubleValue());
+        else if (arg == "--channels" && i + 1 < args.size())
+            settings.numChannels = jlimit (1, CompressorAudioProcessor::maxChannels, args[++i].text.getIntValue());
+        else if (arg == "--seconds" && i + 1 < args.size())
+            settings.secondsOfAudio = jmax (0.1, args[++i].text.getDoubleValue());
+        else if (arg == "--input" && i + 1 < args.size())
+            settings.input = args[++i].resolveAsFile();
+        else if (arg == "--realtime")
+            settings.realtime = true;
+        else if (arg == "--output" && i + 1 < args.size())
+            outputFile = args[++i].resolveAsFile();
+    }
+
+    LoopbackDevice device (settings.input, settings.numChannels, settings.sampleRate);
+    StringArray rows { csvHeader };
+    int numFailures = 0;
+
+    for (auto numStreams : streamCounts)
+    {
+        const auto result = runStreams (jmax (1, numStreams), settings, device);
+        rows.add (toCsvRow (settings, result));
+
+        std::cout << result.numStreams << " streams on " << result.numWorkers << " workers: "
+                  << String (result.realTimeFactor, 1) << "x real time, period p50/p99/max "
+                  << String (result.p50Micros, 1) << "/" << String (result.p99Micros, 1) << "/" << String (result.maxMicros, 1)
+                  << " us of " << String (result.deadlineMicros, 1) << " us, "
+                  << String (result.periodMisses) << "/" << String (result.numPeriods) << " periods late, "
+                  << String (result.streamMisses) << " late stream blocks, worst stream "
+                  << String (result.worstStreamMicros, 1) << " us, caller waited up to "
+                  << String (result.maxWaitMicros, 1) << " us" << std::endl;
+
+        // Run flat out, periods queue back to back, so only a paced run says anything about lateness
+        if (settings.realtime)
+        {
+            const auto passed = result.periodMisses == 0;
+            numFailures += passed ? 0 : 1;
+            std::cout << (passed ? "PASS " : "FAIL ") << result.numStreams << " streams met every period's deadline" << std::endl;
+        }
+    }
+
+    if (outputFile != File())
+        outputFile.replaceWithText (rows.joinIntoString ("\n") + "\n");
+
+    return numFailures > 0 ? 1 : 0;
+}
@@ -0,0 +1,301 @@
+/*
+  ==============================================================================
+
+    This file contains the multi-stream engine: one process hosting many
+    independent compressor chains.
+
+  ==============================================================================
+*/
+
+#include "StreamEngine.h"
+
+//==============================================================================
+struct StreamEngine::Stream
+{
+    std::unique_ptr<CompressorAudioProcessor> processor;
+    AudioBuffer<float> buffer;
+    MidiBuffer midi;
+
+    // Only the worker running the stream writes these
+    std::atomic<int64> lastTicks { 0 }, maxTicks { 0 };
+    std::atomic<uint32> deadlineMisses { 0 };
+};
+
+//==============================================================================
+class StreamEngine::Worker  : public Thread
+{
+public:
+    Worker (StreamEngine& e, int i, int c)
+        : Thread ("Stream worker " + String (i)), engine (e), index (i), core (c)
+    {
+    }
+
+    void run() override
+    {
+        if (isPositiveAndBelow (core, 32))
+            Thread::setCurrentThreadAffinityMask (1u << core);
+
+        while (! threadShouldExit())
+        {
+            wait (-1);
+
+            if (threadShouldExit())
+                break;
+
+            engine.runStreams (index);
+        }
+    }
+
+private:
+    StreamEngine& engine;
+    const int index, core;
+};
+
+//==============================================================================
+StreamEngine::StreamEngine (const Config& config)
+{
+    for (int i = 0; i < jmax (1, config.numStreams); ++i)
+    {
+        auto* stream = streams.add (new Stream());
+        stream->processor = std::make_unique<CompressorAudioProcessor>();
+
+        // The engine already spreads streams across every core it was given
+        stream->processor->setWorkerThreadsEnabled (false);
+
+        if (config.initialState.getSize() > 0)
+            stream->processor->setStateInformation (config.initialState.getData(), static_cast<int> (config.initialState.getSize()));
+
+        stream->processor->setPlayConfigDetails (config.numChannels, config.numChannels, config.sampleRate, config.blockSize);
+        stream->processor->prepareToPlay (config.sampleRate, config.blockSize);
+        stream->buffer.setSize (config.numChannels, config.blockSize);
+        stream->midi.ensureSize (256);
+    }
+
+    callerCore = config.cores.isEmpty() ? -1 : config.cores.getFirst();
+    const auto numWorkers = config.cores.isEmpty() ? SystemStats::getNumCpus() : config.cores.size();
+
+    for (int i = 1; i < numWorkers; ++i)
+        workers.add (new Worker (*this, i, config.cores.isEmpty() ? -1 : config.cores[i]));
+
+    ranges.allocate (static_cast<size_t> (numWorkers), true);
+
+    deadlineTicks = static_cast<int64> (config.blockSize / config.sampleRate * static_cast<double> (Time::getHighResolutionTicksPerSecond()));
+
+    for (auto* worker : workers)
+        worker->startThread (9);
+}
+
+StreamEngine::~StreamEngine()
+{
+    for (auto* worker : workers)
+    {
+        worker->signalThreadShouldExit();
+        worker->notify();
+    }
+
+    for (auto* worker : workers)
+        worker->stopThread (1000);
+
+    for (auto* stream : streams)
+        stream->processor->releaseResources();
+}
+
+AudioBuffer<float>& StreamEngine::getStreamBuffer (int stream) noexcept
+{
+    return streams.getUnchecked (stream)->buffer;
+}
+
+CompressorAudioProcessor& StreamEngine::getProcessor (int stream) noexcept
+{
+    return *streams.getUnchecked (stream)->processor;
+}
+
+//==============================================================================
+bool StreamEngine::setParameter (int stream, int parameterIndex, float normalisedValue) noexcept
+{
+    if (! isPositiveAndBelow (stream, streams.size()))
+        return false;
+
+    const auto scope = commandFifo.write (1);
+
+    if (scope.blockSize1 + scope.blockSize2 == 0)
+        return false;
+
+    auto& command = commands[scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2];
+    command.stream = stream;
+    command.parameterIndex = parameterIndex;
+    command.value = jlimit (0.0f, 1.0f, normalisedValue);
+    return true;
+}
+
+void StreamEngine::applyCommands() noexcept
+{
+    const auto apply = [this] (int start, int size)
+    {
+        for (int i = start; i < start + size; ++i)
+        {
+            const auto& command = commands[i];
+            streams.getUnchecked (command.stream)->processor->setParameterDirect (command.parameterIndex, command.value);
+        }
+    };
+
+    const auto scope = commandFifo.read (commandFifo.getNumReady());
+    apply (scope.startIndex1, scope.blockSize1);
+    apply (scope.startIndex2, scope.blockSize2);
+}
+
+//==============================================================================
+void StreamEngine::processPeriod() noexcept
+{
+    if (! callerPinned)
+    {
+        if (isPositiveAndBelow (callerCore, 32))
+            Thread::setCurrentThreadAffinityMask (1u << callerCore);
+
+        callerPinned = true;
+    }
+
+    periodStart = Time::getHighResolutionTicks();
+
+    // Between periods nothing runs, so commands land on every stream at the same block boundary
+    applyCommands();
+
+    // Contiguous shares keep each worker on the same streams, and their caches warm, from
+    // period to period; stealing only moves what's left when one falls behind
+    const auto numStreams = static_cast<uint32> (streams.size());
+    const auto numWorkers = static_cast<uint32> (getNumWorkers());
+    streamsRemaining = static_cast<int> (numStreams);
+
+    for (uint32 worker = 0; worker < numWorkers; ++worker)
+        ranges[worker] = packRange (numStreams * worker / numWorkers, numStreams * (worker + 1) / numWorkers);
+
+    for (auto* worker : workers)
+        worker->notify();
+
+    runStreams (0);
+
+    const auto waitStart = Time::getHighResolutionTicks();
+
+    while (streamsRemaining.load() > 0)
+        Thread::yield();
+
+    const auto periodEnd = Time::getHighResolutionTicks();
+    const auto waitTicks = periodEnd - waitStart;
+    lastWaitTicks.store (waitTicks, std::memory_order_relaxed);
+
+    if (waitTicks > maxWaitTicks.load (std::memory_order_relaxed))
+        maxWaitTicks.store (waitTicks, std::memory_order_relaxed);
+
+    const auto ticks = periodEnd - periodStart;
+    lastPeriodTicks.store (ticks, std::memory_order_relaxed);
+
+    if (ticks > maxPeriodTicks.load (std::memory_order_relaxed))
+        maxPeriodTicks.store (ticks, std::memory_order_relaxed);
+
+    if (ticks > deadlineTicks)
+        periodDeadlineMisses.store (periodDeadlineMisses.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    numPeriods.store (numPeriods.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void StreamEngine::runStreams (int worker) noexcept
+{
+    for (int stream; claimStream (worker, stream);)
+    {
+        processStream (stream);
+        --streamsRemaining;
+    }
+}
+
+bool StreamEngine::claimStream (int worker, int& stream) noexcept
+{
+    const auto numWorkers = getNumWorkers();
+
+    // Our own share from the front first, then everyone else's from the back
+    for (int offset = 0; offset < numWorkers; ++offset)
+    {
+        auto& range = ranges[(worker + offset) % numWorkers];
+        auto packed = range.load();
+
+        for (;;)
+        {
+            const auto begin = static_cast<uint32> (packed >> 32);
+            const auto end = static_cast<uint32> (packed);
+
+            if (begin >= end)
+                break;
+
+            const auto claimed = offset == 0 ? packRange (begin + 1, end) : packRange (begin, end - 1);
+
+            if (range.compare_exchange_weak (packed, claimed))
+            {
+                stream = static_cast<int> (offset == 0 ? begin : end - 1);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void StreamEngine::processStream (int index) noexcept
+{
+    auto& stream = *streams.getUnchecked (index);
+    const auto start = Time::getHighResolutionTicks();
+
+    stream.midi.clear();
+    stream.processor->processBlock (stream.buffer, stream.midi);
+
+    const auto end = Time::getHighResolutionTicks();
+    const auto ticks = end - start;
+    stream.lastTicks.store (ticks, std::memory_order_relaxed);
+
+    if (ticks > stream.maxTicks.load (std::memory_order_relaxed))
+        stream.maxTicks.store (ticks, std::memory_order_relaxed);
+
+    // A stream misses when its output wasn't ready by the end of the period, however
+    // little of that time was its own
+    if (end - periodStart > deadlineTicks)
+        stream.deadlineMisses.store (stream.deadlineMisses.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+//==============================================================================
+StreamEngine::StreamStatistics StreamEngine::getStreamStatistics (int index) const noexcept
+{
+    const auto& stream = *streams.getUnchecked (index);
+
+    StreamStatistics statistics;
+    statistics.lastMicros = Time::highResolutionTicksToSeconds (stream.lastTicks.load (std::memory_order_relaxed)) * 1.0e6;
+    statistics.maxMicros = Time::highResolutionTicksToSeconds (stream.maxTicks.load (std::memory_order_relaxed)) * 1.0e6;
+    statistics.deadlineMisses = stream.deadlineMisses.load (std::memory_order_relaxed);
+    return statistics;
+}
+
+StreamEngine::PeriodStatistics StreamEngine::getPeriodStatistics() const noexcept
+{
+    PeriodStatistics statistics;
+    statistics.numPeriods = numPeriods.load (std::memory_order_relaxed);
+    statistics.lastMicros = Time::highResolutionTicksToSeconds (lastPeriodTicks.load (std::memory_order_relaxed)) * 1.0e6;
+    statistics.maxMicros = Time::highResolutionTicksToSeconds (maxPeriodTicks.load (std::memory_order_relaxed)) * 1.0e6;
+    statistics.lastWaitMicros = Time::highResolutionTicksToSeconds (lastWaitTicks.load (std::memory_order_relaxed)) * 1.0e6;
+    statistics.maxWaitMicros = Time::highResolutionTicksToSeconds (maxWaitTicks.load (std::memory_order_relaxed)) * 1.0e6;
+    statistics.deadlineMisses = periodDeadlineMisses.load (std::memory_order_relaxed);
+    return statistics;
+}
+
+void StreamEngine::resetStatistics() noexcept
+{
+    for (auto* stream : streams)
+    {
+        stream->lastTicks.store (0, std::memory_order_relaxed);
+        stream->maxTicks.store (0, std::memory_order_relaxed);
+        stream->deadlineMisses.store (0, std::memory_order_relaxed);
+    }
+
+    numPeriods.store (0, std::memory_order_relaxed);
+    lastPeriodTicks.store (0, std::memory_order_relaxed);
+    maxPeriodTicks.store (0, std::memory_order_relaxed);
+    lastWaitTicks.store (0, std::memory_order_relaxed);
+    maxWaitTicks.store (0, std::memory_order_relaxed);
+    periodDeadlineMisses.store (0, std::memory_order_relaxed);
+}
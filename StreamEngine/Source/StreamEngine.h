@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    This file contains the multi-stream engine: one process hosting many
+    independent compressor chains, e.g. one per broadcast playout stream.
+
+    The engine owns one CompressorAudioProcessor per stream, all prepared for
+    the same rate, block size and channel count. Every audio period the
+    caller fills the streams' buffers and calls processPeriod(), which runs
+    them on a work-stealing scheduler: each worker starts on its own share
+    of the streams and steals from the others once that runs dry. Workers
+    can be pinned to a set of cores, and the calling thread takes part as
+    worker 0.
+
+    Parameter changes go through a lock-free command queue and are applied
+    at the start of the next period, so a control thread never touches a
+    processor while it runs. They are written straight to the parameters'
+    values, as nothing else listens to the processors, so applying them takes
+    no locks.
+
+    Once the caller runs out of streams it spins, yielding, until the workers
+    finish theirs: that wait is at most the longest stream still running,
+    and blocking on an event instead would add a wake-up to the end of every
+    period. How long the caller waited is kept with the period statistics. Every stream keeps deadline accounting: how
+    long it took, and how often it finished after the period's real-time
+    deadline.
+
+    Build it as a static library compiling the plugin's Source files
+    alongside this one, with the same JucePlugin_* definitions as the plugin
+    target. Main.cpp is a console benchmark of it.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../../Source/PluginProcessor.h"
+
+//==============================================================================
+class StreamEngine
+{
+public:
+    struct Config
+    {
+        int numStreams = 16;
+        int numChannels = 2;
+        double sampleRate = 48000.0;
+        int blockSize = 256;
+
+        /** Cores to pin workers to, one worker per entry; the first is the caller's.
+            Empty means one unpinned worker per CPU. Cores above 31 can't be pinned.
+        */
+        Array<int> cores;
+
+        /** Every stream starts from this state, e.g. one saved by the plugin. */
+        MemoryBlock initialState;
+    };
+
+    explicit StreamEngine (const Config& config);
+    ~StreamEngine();
+
+    int getNumStreams() const noexcept              { return streams.size(); }
+    int getNumWorkers() const noexcept              { return workers.size() + 1; }
+
+    /** The buffer a stream reads its input from and writes its output to.
+        Only touch it between processPeriod() calls.
+    */
+    AudioBuffer<float>& getStreamBuffer (int stream) noexcept;
+
+    /** A stream's processor, for looking up parameters or saving its state.
+        Only touch it between processPeriod() calls.
+    */
+    CompressorAudioProcessor& getProcessor (int stream) noexcept;
+
+    /** Processes every stream's buffer in place, returning once all are done.
+        Call it from one thread only, normally the audio device's.
+    */
+    void processPeriod() noexcept;
+
+    //==============================================================================
+    /** Queues a change to a stream's parameter, given as a normalised value, for the
+        start of the next period. Wait-free; call it from one control thread. Returns
+        false if the queue is full.
+    */
+    bool setParameter (int stream, int parameterIndex, float normalisedValue) noexcept;
+
+    //==============================================================================
+    struct StreamStatistics
+    {
+        double lastMicros = 0.0, maxMicros = 0.0;
+        uint32 deadlineMisses = 0;
+    };
+
+    struct PeriodStatistics
+    {
+        uint64 numPeriods = 0;
+        double lastMicros = 0.0, maxMicros = 0.0;
+        double lastWaitMicros = 0.0, maxWaitMicros = 0.0;     // the caller spinning on the workers
+        uint64 deadlineMisses = 0;
+    };
+
+    /** Safe from any thread. */
+    StreamStatistics getStreamStatistics (int stream) const noexcept;
+    PeriodStatistics getPeriodStatistics() const noexcept;
+
+    /** Clears every counter, from the processPeriod() thread or while it isn't running. */
+    void resetStatistics() noexcept;
+
+private:
+    class Worker;
+    struct Stream;
+
+    struct Command
+    {
+        int stream = 0, parameterIndex = 0;
+        float value = 0.0f;
+    };
+
+    void applyCommands() noexcept;
+    void runStreams (int worker) noexcept;
+    bool claimStream (int worker, int& stream) noexcept;
+    void processStream (int stream) noexcept;
+
+    static uint64 packRange (uint32 begin, uint32 end) noexcept    { return (static_cast<uint64> (begin) << 32) | end; }
+
+    //==============================================================================
+    OwnedArray<Stream> streams;
+    OwnedArray<Worker> workers;
+
+    // Each worker's share of the streams, as [begin, end) packed into one word so the
+    // owner popping the front and thieves popping the back agree through a single CAS
+    HeapBlock<std::atomic<uint64>> ranges;
+    std::atomic<int> streamsRemaining { 0 };
+
+    static constexpr int commandCapacity = 1024;
+    AbstractFifo commandFifo { commandCapacity };
+    Command commands[commandCapacity];
+
+    int callerCore = -1;
+    bool callerPinned = false;
+
+    int64 periodStart = 0, deadlineTicks = 0;
+    std::atomic<uint64> numPeriods { 0 }, periodDeadlineMisses { 0 };
+    std::atomic<int64> lastPeriodTicks { 0 }, maxPeriodTicks { 0 };
+    std::atomic<int64> lastWaitTicks { 0 }, maxWaitTicks { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (StreamEngine)
+};